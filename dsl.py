@@ -51,8 +51,28 @@ DSL_PPH_EVENT_STREAM_ADDED   = 0
 DSL_PPH_EVENT_STREAM_DELETED = 1
 DSL_PPH_EVENT_STREAM_ENDED   = 2
 
+DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED = int('FFFFFFFF',16)
+
+DSL_PPH_ODE_STATS_PHASE_PRE_PROCESS = 0
+DSL_PPH_ODE_STATS_PHASE_CHECK = 1
+DSL_PPH_ODE_STATS_PHASE_POST_PROCESS = 2
+
+DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS = 500
+
 DSL_SINK_APP_DATA_TYPE_SAMPLE = 0
 DSL_SINK_APP_DATA_TYPE_BUFFER = 1
+DSL_SINK_APP_DATA_TYPE_BUFFER_LIST = 2
+
+DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST = 0
+DSL_SINK_APP_DELIVERY_POLICY_DROP_NEWEST = 1
+DSL_SINK_APP_DELIVERY_POLICY_BLOCK = 2
+
+DSL_SINK_SHM_DATA_TYPE_METADATA = 0
+DSL_SINK_SHM_DATA_TYPE_FRAMES = 1
+
+DSL_SINK_META_EXPORT_TRANSPORT_FILE = 0
+DSL_SINK_META_EXPORT_TRANSPORT_UNIX = 1
+DSL_SINK_META_EXPORT_TRANSPORT_TCP = 2
 
 DSL_FLOW_OK    = 0
 DSL_FLOW_EOS   = 1
@@ -103,6 +123,10 @@ DSL_VIDEO_ORIENTATION_FLIP_UPPER_LEFT_TO_LOWER_RIGHT  = 7
 DSL_SOURCE_CODEC_PARSER_H264 = 0
 DSL_SOURCE_CODEC_PARSER_H265 = 1
 
+DSL_SOURCE_META_REPLAY_SURFACE_NONE = 0
+DSL_SOURCE_META_REPLAY_SURFACE_BLANK = 1
+DSL_SOURCE_META_REPLAY_SURFACE_TEST_PATTERN = 2
+
 DSL_CODEC_H264 = 0
 DSL_CODEC_H265 = 1
 DSL_CODEC_MPEG4 = 2
@@ -211,6 +235,10 @@ DSL_HEAT_MAP_LEGEND_LOCATION_RIGHT = 1
 DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM = 2
 DSL_HEAT_MAP_LEGEND_LOCATION_LEFT = 3
 
+DSL_HEAT_MAP_MODE_ACCUMULATE = 0
+DSL_HEAT_MAP_MODE_DECAY = 1
+DSL_HEAT_MAP_MODE_WINDOW = 2
+
 DSL_CAPTURE_TYPE_OBJECT = 0
 DSL_CAPTURE_TYPE_FRAME = 1
 
@@ -339,10 +367,126 @@ class dsl_rtsp_connection_data(Structure):
         ('sleep', c_uint),
         ('timeout', c_uint)]
 
+class dsl_rtsp_reconnection_stats(Structure):
+    _fields_ = [
+        ('active', c_uint),
+        ('waiting', c_uint),
+        ('peak_active', c_uint),
+        ('attempts', c_uint),
+        ('successes', c_uint),
+        ('failures', c_uint),
+        ('deferrals', c_uint)]
+
 class dsl_webrtc_connection_data(Structure):
     _fields_ = [
         ('current_state', c_uint)]
 
+class dsl_latency_stats(Structure):
+    _fields_ = [
+        ('count', c_uint64),
+        ('min', c_uint64),
+        ('max', c_uint64),
+        ('mean', c_uint64),
+        ('p50', c_uint64),
+        ('p90', c_uint64),
+        ('p99', c_uint64)]
+
+class dsl_ode_action_executor_stats(Structure):
+    _fields_ = [
+        ('workers', c_uint),
+        ('queue_depth', c_uint),
+        ('peak_queue_depth', c_uint),
+        ('submitted', c_uint64),
+        ('completed', c_uint64),
+        ('rejected', c_uint64),
+        ('queue_latency', dsl_latency_stats),
+        ('run_latency', dsl_latency_stats)]
+
+class dsl_callback_listener_stats(Structure):
+    _fields_ = [
+        ('name', c_wchar_p),
+        ('queue_depth', c_uint),
+        ('peak_queue_depth', c_uint),
+        ('dispatched', c_uint64),
+        ('coalesced', c_uint64),
+        ('overflows', c_uint64),
+        ('slow_count', c_uint64),
+        ('queue_latency', dsl_latency_stats),
+        ('run_latency', dsl_latency_stats)]
+
+class dsl_sink_app_delivery_stats(Structure):
+    _fields_ = [
+        ('queue_depth', c_uint),
+        ('peak_queue_depth', c_uint),
+        ('received', c_uint64),
+        ('delivered', c_uint64),
+        ('dropped', c_uint64),
+        ('lag', dsl_latency_stats)]
+
+class dsl_source_app_wrapped_buffer(Structure):
+    _fields_ = [
+        ('data', c_void_p),
+        ('size', c_uint64),
+        ('client_data', c_void_p)]
+
+class dsl_shm_source_stats(Structure):
+    _fields_ = [
+        ('num_slots', c_uint),
+        ('occupied', c_uint),
+        ('peak_occupied', c_uint),
+        ('producer_attached', c_bool),
+        ('producer_restarts', c_uint),
+        ('frames_received', c_uint64),
+        ('overruns', c_uint64)]
+
+class dsl_meta_replay_source_stats(Structure):
+    _fields_ = [
+        ('batches_replayed', c_uint64),
+        ('frames_replayed', c_uint64),
+        ('objects_replayed', c_uint64),
+        ('late_batches', c_uint64),
+        ('records_skipped', c_uint64),
+        ('bytes_read', c_uint64)]
+
+class dsl_shm_sink_stats(Structure):
+    _fields_ = [
+        ('num_slots', c_uint),
+        ('readers', c_uint),
+        ('slow_readers', c_uint),
+        ('frames_written', c_uint64),
+        ('objects_dropped', c_uint64),
+        ('reader_skips', c_uint64)]
+
+class dsl_meta_export_sink_stats(Structure):
+    _fields_ = [
+        ('queue_depth', c_uint),
+        ('peak_queue_depth', c_uint),
+        ('connects', c_uint),
+        ('records_written', c_uint64),
+        ('records_dropped', c_uint64),
+        ('raw_bytes', c_uint64),
+        ('bytes_written', c_uint64)]
+
+class dsl_meter_source_stats(Structure):
+    _fields_ = [
+        ('source_id', c_uint),
+        ('frame_count', c_uint64),
+        ('session_fps_avg', c_double),
+        ('interval_fps_avg', c_double),
+        ('jitter_p50', c_uint64),
+        ('jitter_p90', c_uint64),
+        ('jitter_p99', c_uint64),
+        ('jitter_max', c_uint64),
+        ('stall_count', c_uint64),
+        ('drop_count', c_uint64)]
+
+class dsl_component_startup_timing(Structure):
+    _fields_ = [
+        ('name', c_wchar_p),
+        ('construct_us', c_uint64),
+        ('link_us', c_uint64),
+        ('state_change_us', c_uint64)]
+
 class dsl_ode_occurrence_source_info(Structure):
     _fields_ = [
         ('source_id', c_uint),
@@ -419,6 +563,13 @@ DSL_LONG_P = POINTER(c_long)
 DSL_DOUBLE_P = POINTER(c_double)
 DSL_FLOAT_P = POINTER(c_float)
 DSL_RTSP_CONNECTION_DATA_P = POINTER(dsl_rtsp_connection_data)
+DSL_RTSP_RECONNECTION_STATS_P = POINTER(dsl_rtsp_reconnection_stats)
+DSL_ODE_ACTION_EXECUTOR_STATS_P = POINTER(dsl_ode_action_executor_stats)
+DSL_SINK_APP_DELIVERY_STATS_P = POINTER(dsl_sink_app_delivery_stats)
+DSL_SHM_SOURCE_STATS_P = POINTER(dsl_shm_source_stats)
+DSL_META_REPLAY_SOURCE_STATS_P = POINTER(dsl_meta_replay_source_stats)
+DSL_SHM_SINK_STATS_P = POINTER(dsl_shm_sink_stats)
+DSL_META_EXPORT_SINK_STATS_P = POINTER(dsl_meta_export_sink_stats)
 
 ##
 ## Callback Typedefs
@@ -452,6 +603,10 @@ DSL_ODE_TRIGGER_LIMIT_STATE_CHANGE_LISTENER = \
 DSL_PPH_METER_CLIENT_HANDLER = \
     CFUNCTYPE(c_bool, DSL_DOUBLE_P, DSL_DOUBLE_P, c_uint, c_void_p)
 
+# dsl_pph_meter_stats_handler_cb
+DSL_PPH_METER_STATS_HANDLER = \
+    CFUNCTYPE(c_bool, POINTER(dsl_meter_source_stats), c_uint, c_void_p)
+
 # dsl_pph_custom_client_handler_cb
 DSL_PPH_CUSTOM_CLIENT_HANDLER = \
     CFUNCTYPE(c_uint, c_void_p, c_void_p)
@@ -524,6 +679,15 @@ DSL_DISPLAY_TYPE_RGBA_COLOR_PROVIDER = \
 DSL_PPH_BUFFER_TIMEOUT_HANDLER = \
     CFUNCTYPE(None, c_uint, c_void_p)
 
+# dsl_pph_ode_budget_overrun_handler_cb
+DSL_PPH_ODE_BUDGET_OVERRUN_HANDLER = \
+    CFUNCTYPE(None, c_uint, c_uint, c_uint64, c_uint, c_void_p)
+
+# dsl_pipeline_latency_report_handler_cb
+DSL_PIPELINE_LATENCY_REPORT_HANDLER = \
+    CFUNCTYPE(None, POINTER(c_wchar_p), POINTER(c_uint), 
+        POINTER(dsl_latency_stats), c_uint, POINTER(dsl_latency_stats), c_void_p)
+
 # dsl_eos_listener_cb
 DSL_EOS_HANDLER = \
     CFUNCTYPE(c_uint, c_void_p)
@@ -536,6 +700,10 @@ DSL_SOURCE_APP_NEED_DATA_HANDLER = \
 DSL_SOURCE_APP_ENOUGH_DATA_HANDLER = \
     CFUNCTYPE(None, c_void_p)
 
+# dsl_source_app_buffer_release_cb
+DSL_SOURCE_APP_BUFFER_RELEASE_CB = \
+    CFUNCTYPE(None, c_void_p, c_void_p)
+
 # dsl_sink_app_new_data_handler_cb
 DSL_SINK_APP_NEW_DATA_HANDLER = \
     CFUNCTYPE(c_uint, c_uint, c_void_p, c_void_p)
@@ -1618,6 +1786,54 @@ def dsl_ode_action_list_size():
     result =_dsl.dsl_ode_action_list_size()
     return int(result)
 
+##
+## dsl_ode_action_executor_params_get()
+##
+_dsl.dsl_ode_action_executor_params_get.argtypes = [POINTER(c_uint), 
+    POINTER(c_uint)]
+_dsl.dsl_ode_action_executor_params_get.restype = c_uint
+def dsl_ode_action_executor_params_get():
+    global _dsl
+    max_workers = c_uint(0)
+    queue_capacity = c_uint(0)
+    result = _dsl.dsl_ode_action_executor_params_get(
+        DSL_UINT_P(max_workers), DSL_UINT_P(queue_capacity))
+    return int(result), max_workers.value, queue_capacity.value
+
+##
+## dsl_ode_action_executor_params_set()
+##
+_dsl.dsl_ode_action_executor_params_set.argtypes = [c_uint, c_uint]
+_dsl.dsl_ode_action_executor_params_set.restype = c_uint
+def dsl_ode_action_executor_params_set(max_workers, queue_capacity):
+    global _dsl
+    result = _dsl.dsl_ode_action_executor_params_set(
+        max_workers, queue_capacity)
+    return int(result)
+
+##
+## dsl_ode_action_executor_stats_get()
+##
+_dsl.dsl_ode_action_executor_stats_get.argtypes = [
+    DSL_ODE_ACTION_EXECUTOR_STATS_P]
+_dsl.dsl_ode_action_executor_stats_get.restype = c_uint
+def dsl_ode_action_executor_stats_get():
+    global _dsl
+    stats = dsl_ode_action_executor_stats()
+    result = _dsl.dsl_ode_action_executor_stats_get(
+        DSL_ODE_ACTION_EXECUTOR_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_ode_action_executor_stats_clear()
+##
+_dsl.dsl_ode_action_executor_stats_clear.argtypes = []
+_dsl.dsl_ode_action_executor_stats_clear.restype = c_uint
+def dsl_ode_action_executor_stats_clear():
+    global _dsl
+    result = _dsl.dsl_ode_action_executor_stats_clear()
+    return int(result)
+
 ##
 ## dsl_ode_area_inclusion_new()
 ##
@@ -2082,6 +2298,21 @@ def dsl_ode_trigger_reset(name):
     result =_dsl.dsl_ode_trigger_reset(name)
     return int(result)
 
+##
+## dsl_ode_trigger_counts_get()
+##
+_dsl.dsl_ode_trigger_counts_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_ode_trigger_counts_get.restype = c_uint
+def dsl_ode_trigger_counts_get(name):
+    global _dsl
+    events = c_uint64(0)
+    frames = c_uint64(0)
+    accumulated = c_uint64(0)
+    result =_dsl.dsl_ode_trigger_counts_get(name, DSL_UINT64_P(events),
+        DSL_UINT64_P(frames), DSL_UINT64_P(accumulated))
+    return int(result), events.value, frames.value, accumulated.value
+
 ##
 ## dsl_ode_trigger_reset_timeout_get()
 ##
@@ -2766,6 +2997,32 @@ def dsl_ode_heat_mapper_legend_settings_set(name, enabled, location, width, heig
         enabled, location, width, height)
     return int(result)
 
+##
+## dsl_ode_heat_mapper_mode_get()
+##
+_dsl.dsl_ode_heat_mapper_mode_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_mode_get.restype = c_uint
+def dsl_ode_heat_mapper_mode_get(name):
+    global _dsl 
+    mode = c_uint(0)
+    interval = c_uint(0)
+    size = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_mode_get(name, DSL_UINT_P(mode), 
+        DSL_UINT_P(interval), DSL_UINT_P(size))
+    return int(result), mode.value, interval.value, size.value 
+
+##
+## dsl_ode_heat_mapper_mode_set()
+##
+_dsl.dsl_ode_heat_mapper_mode_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint, c_uint]
+_dsl.dsl_ode_heat_mapper_mode_set.restype = c_uint
+def dsl_ode_heat_mapper_mode_set(name, mode, interval, size):
+    global _dsl
+    result = _dsl.dsl_ode_heat_mapper_mode_set(name, mode, interval, size)
+    return int(result)
+
 ##
 ## dsl_ode_heat_mapper_color_palette_get()
 ##
@@ -2811,7 +3068,20 @@ def dsl_ode_heat_mapper_metrics_get(name):
     size = c_uint(0)
     result = _dsl.dsl_ode_heat_mapper_metrics_get(name,
         byref(buffer), DSL_UINT_P(size))
-    print (buffer[0])
+    return int(result), buffer, size.value
+
+##
+## dsl_ode_heat_mapper_source_metrics_get()
+##
+_dsl.dsl_ode_heat_mapper_source_metrics_get.argtypes = [c_wchar_p, c_uint,
+    POINTER(DSL_UINT64_P), POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_source_metrics_get.restype = c_uint
+def dsl_ode_heat_mapper_source_metrics_get(name, source_id):
+    global _dsl 
+    buffer = POINTER(c_uint64)()
+    size = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_source_metrics_get(name, source_id,
+        byref(buffer), DSL_UINT_P(size))
     return int(result), buffer, size.value
 
 ##
@@ -2971,6 +3241,125 @@ def dsl_pph_ode_display_meta_alloc_size_set(name, size):
     result =_dsl.dsl_pph_ode_display_meta_alloc_size_set(name, size)
     return int(result)
 
+##
+## dsl_pph_ode_parallel_mode_get()
+##
+_dsl.dsl_pph_ode_parallel_mode_get.argtypes = [c_wchar_p, 
+    POINTER(c_bool), POINTER(c_uint)]
+_dsl.dsl_pph_ode_parallel_mode_get.restype = c_uint
+def dsl_pph_ode_parallel_mode_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    workers = c_uint(0)
+    result =_dsl.dsl_pph_ode_parallel_mode_get(name, 
+        DSL_BOOL_P(enabled), DSL_UINT_P(workers))
+    return int(result), enabled.value, workers.value
+
+##
+## dsl_pph_ode_parallel_mode_set()
+##
+_dsl.dsl_pph_ode_parallel_mode_set.argtypes = [c_wchar_p, c_bool, c_uint]
+_dsl.dsl_pph_ode_parallel_mode_set.restype = c_uint
+def dsl_pph_ode_parallel_mode_set(name, enabled, workers):
+    global _dsl
+    result =_dsl.dsl_pph_ode_parallel_mode_set(name, enabled, workers)
+    return int(result)
+
+##
+## dsl_pph_ode_stats_enabled_get()
+##
+_dsl.dsl_pph_ode_stats_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pph_ode_stats_enabled_get.restype = c_uint
+def dsl_pph_ode_stats_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_pph_ode_stats_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pph_ode_stats_enabled_set()
+##
+_dsl.dsl_pph_ode_stats_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pph_ode_stats_enabled_set.restype = c_uint
+def dsl_pph_ode_stats_enabled_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_pph_ode_stats_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pph_ode_stats_trigger_get()
+##
+_dsl.dsl_pph_ode_stats_trigger_get.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, POINTER(dsl_latency_stats)]
+_dsl.dsl_pph_ode_stats_trigger_get.restype = c_uint
+def dsl_pph_ode_stats_trigger_get(name, trigger, phase):
+    global _dsl
+    stats = dsl_latency_stats()
+    result =_dsl.dsl_pph_ode_stats_trigger_get(name, trigger, phase, 
+        byref(stats))
+    return int(result), stats
+
+##
+## dsl_pph_ode_stats_action_get()
+##
+_dsl.dsl_pph_ode_stats_action_get.argtypes = [c_wchar_p, c_wchar_p, 
+    POINTER(dsl_latency_stats)]
+_dsl.dsl_pph_ode_stats_action_get.restype = c_uint
+def dsl_pph_ode_stats_action_get(name, action):
+    global _dsl
+    stats = dsl_latency_stats()
+    result =_dsl.dsl_pph_ode_stats_action_get(name, action, byref(stats))
+    return int(result), stats
+
+##
+## dsl_pph_ode_stats_frame_get()
+##
+_dsl.dsl_pph_ode_stats_frame_get.argtypes = [c_wchar_p, 
+    POINTER(dsl_latency_stats)]
+_dsl.dsl_pph_ode_stats_frame_get.restype = c_uint
+def dsl_pph_ode_stats_frame_get(name):
+    global _dsl
+    stats = dsl_latency_stats()
+    result =_dsl.dsl_pph_ode_stats_frame_get(name, byref(stats))
+    return int(result), stats
+
+##
+## dsl_pph_ode_stats_clear()
+##
+_dsl.dsl_pph_ode_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_pph_ode_stats_clear.restype = c_uint
+def dsl_pph_ode_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_pph_ode_stats_clear(name)
+    return int(result)
+
+##
+## dsl_pph_ode_stats_budget_get()
+##
+_dsl.dsl_pph_ode_stats_budget_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_ode_stats_budget_get.restype = c_uint
+def dsl_pph_ode_stats_budget_get(name):
+    global _dsl
+    budget = c_uint(0)
+    result =_dsl.dsl_pph_ode_stats_budget_get(name, DSL_UINT_P(budget))
+    return int(result), budget.value
+
+##
+## dsl_pph_ode_stats_budget_set()
+##
+_dsl.dsl_pph_ode_stats_budget_set.argtypes = [c_wchar_p, c_uint,
+    DSL_PPH_ODE_BUDGET_OVERRUN_HANDLER, c_void_p]
+_dsl.dsl_pph_ode_stats_budget_set.restype = c_uint
+def dsl_pph_ode_stats_budget_set(name, budget, handler, client_data):
+    global _dsl
+    handler_cb = DSL_PPH_ODE_BUDGET_OVERRUN_HANDLER(handler)
+    callbacks.append(handler_cb)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result =_dsl.dsl_pph_ode_stats_budget_set(name, budget, 
+        handler_cb, c_client_data)
+    return int(result)
+
 ##
 ## dsl_pph_custom_new()
 ##
@@ -3020,6 +3409,41 @@ def dsl_pph_meter_interval_set(name, interval):
     result =_dsl.dsl_pph_meter_interval_set(name, interval)
     return int(result)
 
+##
+## dsl_pph_meter_stats_new()
+##
+_dsl.dsl_pph_meter_stats_new.argtypes = [c_wchar_p, c_uint, DSL_PPH_METER_STATS_HANDLER, c_void_p]
+_dsl.dsl_pph_meter_stats_new.restype = c_uint
+def dsl_pph_meter_stats_new(name, interval, stats_handler, client_data):
+    global _dsl
+    stats_handler_cb = DSL_PPH_METER_STATS_HANDLER(stats_handler)
+    callbacks.append(stats_handler_cb)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result =_dsl.dsl_pph_meter_stats_new(name, interval, stats_handler_cb, c_client_data)
+    return int(result)
+
+##
+## dsl_pph_meter_stall_threshold_get()
+##
+_dsl.dsl_pph_meter_stall_threshold_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_meter_stall_threshold_get.restype = c_uint
+def dsl_pph_meter_stall_threshold_get(name):
+    global _dsl
+    threshold = c_uint(0)
+    result =_dsl.dsl_pph_meter_stall_threshold_get(name, DSL_UINT_P(threshold))
+    return int(result), threshold.value
+
+##
+## dsl_pph_meter_stall_threshold_set()
+##
+_dsl.dsl_pph_meter_stall_threshold_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pph_meter_stall_threshold_set.restype = c_uint
+def dsl_pph_meter_stall_threshold_set(name, threshold):
+    global _dsl
+    result =_dsl.dsl_pph_meter_stall_threshold_set(name, threshold)
+    return int(result)
+
 ##
 ## dsl_pph_nmp_new()
 ##
@@ -3516,6 +3940,99 @@ def dsl_source_app_sample_push(name, sample):
     result =_dsl.dsl_source_app_sample_push(name, sample)
     return int(result)
 
+##
+## dsl_source_app_buffers_push()
+##
+_dsl.dsl_source_app_buffers_push.argtypes = [c_wchar_p, 
+    POINTER(c_void_p), c_uint]
+_dsl.dsl_source_app_buffers_push.restype = c_uint
+def dsl_source_app_buffers_push(name, buffers):
+    global _dsl
+    arr = (c_void_p * len(buffers))()
+    arr[:] = buffers
+    result =_dsl.dsl_source_app_buffers_push(name, arr, len(buffers))
+    return int(result)
+
+##
+## Release callbacks are called once per pushed buffer, so the ctypes wrapper 
+## is created once per client function and the client_data is passed through
+## as a plain opaque value (e.g. a buffer index) rather than a boxed object.
+##
+_source_app_buffer_release_cbs = {}
+def _source_app_buffer_release_cb(release_cb):
+    if release_cb not in _source_app_buffer_release_cbs:
+        _source_app_buffer_release_cbs[release_cb] = \
+            DSL_SOURCE_APP_BUFFER_RELEASE_CB(release_cb)
+    return _source_app_buffer_release_cbs[release_cb]
+
+##
+## dsl_source_app_buffer_push_wrapped()
+##
+_dsl.dsl_source_app_buffer_push_wrapped.argtypes = [c_wchar_p, 
+    c_void_p, c_uint64, DSL_SOURCE_APP_BUFFER_RELEASE_CB, c_void_p]
+_dsl.dsl_source_app_buffer_push_wrapped.restype = c_uint
+def dsl_source_app_buffer_push_wrapped(name, data, size, 
+    release_cb, client_data):
+    global _dsl
+    c_release_cb = _source_app_buffer_release_cb(release_cb)
+    result =_dsl.dsl_source_app_buffer_push_wrapped(name, 
+        data, size, c_release_cb, client_data)
+    return int(result)
+
+##
+## dsl_source_app_buffers_push_wrapped()
+##
+_dsl.dsl_source_app_buffers_push_wrapped.argtypes = [c_wchar_p, 
+    POINTER(dsl_source_app_wrapped_buffer), c_uint, 
+    DSL_SOURCE_APP_BUFFER_RELEASE_CB]
+_dsl.dsl_source_app_buffers_push_wrapped.restype = c_uint
+def dsl_source_app_buffers_push_wrapped(name, buffers, release_cb):
+    global _dsl
+    c_release_cb = _source_app_buffer_release_cb(release_cb)
+    arr = (dsl_source_app_wrapped_buffer * len(buffers))()
+    for i, (data, size, client_data) in enumerate(buffers):
+        arr[i] = dsl_source_app_wrapped_buffer(data, size, client_data)
+    result =_dsl.dsl_source_app_buffers_push_wrapped(name, 
+        arr, len(buffers), c_release_cb)
+    return int(result)
+
+##
+## dsl_source_app_buffer_pool_size_get()
+##
+_dsl.dsl_source_app_buffer_pool_size_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint)]
+_dsl.dsl_source_app_buffer_pool_size_get.restype = c_uint
+def dsl_source_app_buffer_pool_size_get(name):
+    global _dsl
+    size = c_uint(0)
+    result = _dsl.dsl_source_app_buffer_pool_size_get(name, DSL_UINT_P(size))
+    return int(result), size.value 
+
+##
+## dsl_source_app_buffer_pool_size_set()
+##
+_dsl.dsl_source_app_buffer_pool_size_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_app_buffer_pool_size_set.restype = c_uint
+def dsl_source_app_buffer_pool_size_set(name, size):
+    global _dsl
+    result = _dsl.dsl_source_app_buffer_pool_size_set(name, size)
+    return int(result)
+
+##
+## dsl_source_app_buffer_pool_acquire()
+##
+_dsl.dsl_source_app_buffer_pool_acquire.argtypes = [c_wchar_p, 
+    POINTER(c_void_p), POINTER(c_void_p), POINTER(c_uint64)]
+_dsl.dsl_source_app_buffer_pool_acquire.restype = c_uint
+def dsl_source_app_buffer_pool_acquire(name):
+    global _dsl
+    buffer = c_void_p(0)
+    data = c_void_p(0)
+    size = c_uint64(0)
+    result = _dsl.dsl_source_app_buffer_pool_acquire(name, 
+        pointer(buffer), pointer(data), DSL_UINT64_P(size))
+    return int(result), buffer.value, data.value, size.value 
+
 ##
 ## dsl_source_app_eos()
 ##
@@ -3629,6 +4146,76 @@ def dsl_source_app_max_level_bytes_set(name, level):
     result = _dsl.dsl_source_app_max_level_bytes_set(name, level)
     return int(result)
 
+##
+## dsl_source_shm_new()
+##
+_dsl.dsl_source_shm_new.argtypes = [c_wchar_p, c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_source_shm_new.restype = c_uint
+def dsl_source_shm_new(name, shm_name, buffer_in_format, 
+    width, height, fps_n, fps_d, num_slots):
+    global _dsl
+    result =_dsl.dsl_source_shm_new(name, shm_name, buffer_in_format, 
+        width, height, fps_n, fps_d, num_slots)
+    return int(result)
+
+##
+## dsl_source_shm_stats_get()
+##
+_dsl.dsl_source_shm_stats_get.argtypes = [c_wchar_p, DSL_SHM_SOURCE_STATS_P]
+_dsl.dsl_source_shm_stats_get.restype = c_uint
+def dsl_source_shm_stats_get(name):
+    global _dsl
+    stats = dsl_shm_source_stats()
+    result = _dsl.dsl_source_shm_stats_get(name, DSL_SHM_SOURCE_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_source_shm_stats_clear()
+##
+_dsl.dsl_source_shm_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_source_shm_stats_clear.restype = c_uint
+def dsl_source_shm_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_source_shm_stats_clear(name)
+    return int(result)
+
+##
+## dsl_source_meta_replay_new()
+##
+_dsl.dsl_source_meta_replay_new.argtypes = [c_wchar_p, c_wchar_p, c_double,
+    c_uint, c_uint, c_uint]
+_dsl.dsl_source_meta_replay_new.restype = c_uint
+def dsl_source_meta_replay_new(name, file_path, speed, surface_type, 
+    width, height):
+    global _dsl
+    result =_dsl.dsl_source_meta_replay_new(name, file_path, speed, 
+        surface_type, width, height)
+    return int(result)
+
+##
+## dsl_source_meta_replay_stats_get()
+##
+_dsl.dsl_source_meta_replay_stats_get.argtypes = [c_wchar_p, 
+    DSL_META_REPLAY_SOURCE_STATS_P]
+_dsl.dsl_source_meta_replay_stats_get.restype = c_uint
+def dsl_source_meta_replay_stats_get(name):
+    global _dsl
+    stats = dsl_meta_replay_source_stats()
+    result = _dsl.dsl_source_meta_replay_stats_get(name, 
+        DSL_META_REPLAY_SOURCE_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_source_meta_replay_stats_clear()
+##
+_dsl.dsl_source_meta_replay_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_source_meta_replay_stats_clear.restype = c_uint
+def dsl_source_meta_replay_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_source_meta_replay_stats_clear(name)
+    return int(result)
+
 ##
 ## dsl_source_csi_new()
 ##
@@ -4340,6 +4927,54 @@ def dsl_source_rtsp_connection_stats_clear(name):
     result = _dsl.dsl_source_rtsp_connection_stats_clear(name)
     return int(result)
 
+##
+## dsl_source_rtsp_reconnection_params_get()
+##
+_dsl.dsl_source_rtsp_reconnection_params_get.argtypes = [POINTER(c_uint), 
+    POINTER(c_uint)]
+_dsl.dsl_source_rtsp_reconnection_params_get.restype = c_uint
+def dsl_source_rtsp_reconnection_params_get():
+    global _dsl
+    max_concurrent = c_uint(0)
+    max_backoff = c_uint(0)
+    result = _dsl.dsl_source_rtsp_reconnection_params_get(
+        DSL_UINT_P(max_concurrent), DSL_UINT_P(max_backoff))
+    return int(result), max_concurrent.value, max_backoff.value
+
+##
+## dsl_source_rtsp_reconnection_params_set()
+##
+_dsl.dsl_source_rtsp_reconnection_params_set.argtypes = [c_uint, c_uint]
+_dsl.dsl_source_rtsp_reconnection_params_set.restype = c_uint
+def dsl_source_rtsp_reconnection_params_set(max_concurrent, max_backoff):
+    global _dsl
+    result = _dsl.dsl_source_rtsp_reconnection_params_set(
+        max_concurrent, max_backoff)
+    return int(result)
+
+##
+## dsl_source_rtsp_reconnection_stats_get()
+##
+_dsl.dsl_source_rtsp_reconnection_stats_get.argtypes = [
+    DSL_RTSP_RECONNECTION_STATS_P]
+_dsl.dsl_source_rtsp_reconnection_stats_get.restype = c_uint
+def dsl_source_rtsp_reconnection_stats_get():
+    global _dsl
+    stats = dsl_rtsp_reconnection_stats()
+    result = _dsl.dsl_source_rtsp_reconnection_stats_get(
+        DSL_RTSP_RECONNECTION_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_source_rtsp_reconnection_stats_clear()
+##
+_dsl.dsl_source_rtsp_reconnection_stats_clear.argtypes = []
+_dsl.dsl_source_rtsp_reconnection_stats_clear.restype = c_uint
+def dsl_source_rtsp_reconnection_stats_clear():
+    global _dsl
+    result = _dsl.dsl_source_rtsp_reconnection_stats_clear()
+    return int(result)
+
 ##
 ## dsl_source_rtsp_latency_get()
 ##
@@ -5925,6 +6560,126 @@ def dsl_sink_app_data_type_set(name, data_type):
     result =_dsl.dsl_sink_app_data_type_set(name, data_type)
     return int(result)
 
+##
+## dsl_sink_app_delivery_settings_get()
+##
+_dsl.dsl_sink_app_delivery_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_sink_app_delivery_settings_get.restype = c_uint
+def dsl_sink_app_delivery_settings_get(name):
+    global _dsl
+    queue_size = c_uint(0)
+    policy = c_uint(0)
+    batch_size = c_uint(0)
+    result =_dsl.dsl_sink_app_delivery_settings_get(name, 
+        DSL_UINT_P(queue_size), DSL_UINT_P(policy), DSL_UINT_P(batch_size))
+    return int(result), queue_size.value, policy.value, batch_size.value
+
+##
+## dsl_sink_app_delivery_settings_set()
+##
+_dsl.dsl_sink_app_delivery_settings_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint, c_uint]
+_dsl.dsl_sink_app_delivery_settings_set.restype = c_uint
+def dsl_sink_app_delivery_settings_set(name, queue_size, policy, batch_size):
+    global _dsl
+    result =_dsl.dsl_sink_app_delivery_settings_set(name, 
+        queue_size, policy, batch_size)
+    return int(result)
+
+##
+## dsl_sink_app_delivery_stats_get()
+##
+_dsl.dsl_sink_app_delivery_stats_get.argtypes = [c_wchar_p, 
+    DSL_SINK_APP_DELIVERY_STATS_P]
+_dsl.dsl_sink_app_delivery_stats_get.restype = c_uint
+def dsl_sink_app_delivery_stats_get(name):
+    global _dsl
+    stats = dsl_sink_app_delivery_stats()
+    result =_dsl.dsl_sink_app_delivery_stats_get(name, 
+        DSL_SINK_APP_DELIVERY_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_sink_app_delivery_stats_clear()
+##
+_dsl.dsl_sink_app_delivery_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_sink_app_delivery_stats_clear.restype = c_uint
+def dsl_sink_app_delivery_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_sink_app_delivery_stats_clear(name)
+    return int(result)
+
+##
+## dsl_sink_shm_new()
+##
+_dsl.dsl_sink_shm_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_wchar_p,
+    c_uint, c_uint, c_uint]
+_dsl.dsl_sink_shm_new.restype = c_uint
+def dsl_sink_shm_new(name, shm_name, data_type, buffer_out_format, 
+    width, height, num_slots):
+    global _dsl
+    result =_dsl.dsl_sink_shm_new(name, shm_name, data_type, 
+        buffer_out_format, width, height, num_slots)
+    return int(result)
+
+##
+## dsl_sink_shm_stats_get()
+##
+_dsl.dsl_sink_shm_stats_get.argtypes = [c_wchar_p, DSL_SHM_SINK_STATS_P]
+_dsl.dsl_sink_shm_stats_get.restype = c_uint
+def dsl_sink_shm_stats_get(name):
+    global _dsl
+    stats = dsl_shm_sink_stats()
+    result =_dsl.dsl_sink_shm_stats_get(name, DSL_SHM_SINK_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_sink_shm_stats_clear()
+##
+_dsl.dsl_sink_shm_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_sink_shm_stats_clear.restype = c_uint
+def dsl_sink_shm_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_sink_shm_stats_clear(name)
+    return int(result)
+
+##
+## dsl_sink_meta_export_new()
+##
+_dsl.dsl_sink_meta_export_new.argtypes = [c_wchar_p, c_uint, c_wchar_p,
+    c_uint, c_uint]
+_dsl.dsl_sink_meta_export_new.restype = c_uint
+def dsl_sink_meta_export_new(name, transport, location, 
+    compression_level, queue_size):
+    global _dsl
+    result =_dsl.dsl_sink_meta_export_new(name, transport, location, 
+        compression_level, queue_size)
+    return int(result)
+
+##
+## dsl_sink_meta_export_stats_get()
+##
+_dsl.dsl_sink_meta_export_stats_get.argtypes = [c_wchar_p, 
+    DSL_META_EXPORT_SINK_STATS_P]
+_dsl.dsl_sink_meta_export_stats_get.restype = c_uint
+def dsl_sink_meta_export_stats_get(name):
+    global _dsl
+    stats = dsl_meta_export_sink_stats()
+    result =_dsl.dsl_sink_meta_export_stats_get(name, 
+        DSL_META_EXPORT_SINK_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_sink_meta_export_stats_clear()
+##
+_dsl.dsl_sink_meta_export_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_sink_meta_export_stats_clear.restype = c_uint
+def dsl_sink_meta_export_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_sink_meta_export_stats_clear(name)
+    return int(result)
+
 ##
 ## dsl_sink_fake_new()
 ##
@@ -7349,6 +8104,31 @@ def dsl_pipeline_new_component_add_many(pipeline, components):
     result =_dsl.dsl_pipeline_new_component_add_many(pipeline, arr)
     return int(result)
 
+##
+## dsl_pipeline_new_from_spec()
+##
+_dsl.dsl_pipeline_new_from_spec.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_new_from_spec.restype = c_uint
+def dsl_pipeline_new_from_spec(spec):
+    global _dsl
+    result =_dsl.dsl_pipeline_new_from_spec(spec)
+    return int(result)
+
+##
+## dsl_pipeline_startup_timings_get()
+##
+_dsl.dsl_pipeline_startup_timings_get.argtypes = [c_wchar_p, 
+    POINTER(POINTER(dsl_component_startup_timing)), POINTER(c_uint)]
+_dsl.dsl_pipeline_startup_timings_get.restype = c_uint
+def dsl_pipeline_startup_timings_get(name):
+    global _dsl
+    timings = POINTER(dsl_component_startup_timing)()
+    size = c_uint(0)
+    result = _dsl.dsl_pipeline_startup_timings_get(name,
+        byref(timings), DSL_UINT_P(size))
+    return int(result), [(timings[i].name, timings[i].construct_us, 
+        timings[i].link_us, timings[i].state_change_us) for i in range(size.value)]
+
 ##
 ## dsl_pipeline_delete()
 ##
@@ -7814,6 +8594,127 @@ def dsl_pipeline_is_live(name):
     result =_dsl.dsl_pipeline_is_live(name,  DSL_BOOL_P(is_live))
     return int(result), is_live.value
 
+##
+## dsl_pipeline_latency_point_add()
+##
+_dsl.dsl_pipeline_latency_point_add.argtypes = [c_wchar_p, 
+    c_wchar_p, c_uint, c_bool]
+_dsl.dsl_pipeline_latency_point_add.restype = c_uint
+def dsl_pipeline_latency_point_add(name, component, pad, terminal):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_point_add(name, 
+        component, pad, terminal)
+    return int(result)
+
+##
+## dsl_pipeline_latency_point_previous_set()
+##
+_dsl.dsl_pipeline_latency_point_previous_set.argtypes = [c_wchar_p, 
+    c_wchar_p, c_uint, c_wchar_p, c_uint]
+_dsl.dsl_pipeline_latency_point_previous_set.restype = c_uint
+def dsl_pipeline_latency_point_previous_set(name, 
+    component, pad, previous, previous_pad):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_point_previous_set(name, 
+        component, pad, previous, previous_pad)
+    return int(result)
+
+##
+## dsl_pipeline_latency_point_remove()
+##
+_dsl.dsl_pipeline_latency_point_remove.argtypes = [c_wchar_p, c_wchar_p, c_uint]
+_dsl.dsl_pipeline_latency_point_remove.restype = c_uint
+def dsl_pipeline_latency_point_remove(name, component, pad):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_point_remove(name, component, pad)
+    return int(result)
+
+##
+## dsl_pipeline_latency_enabled_get()
+##
+_dsl.dsl_pipeline_latency_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_latency_enabled_get.restype = c_uint
+def dsl_pipeline_latency_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_latency_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pipeline_latency_enabled_set()
+##
+_dsl.dsl_pipeline_latency_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_latency_enabled_set.restype = c_uint
+def dsl_pipeline_latency_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_latency_point_stats_get()
+##
+_dsl.dsl_pipeline_latency_point_stats_get.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, POINTER(dsl_latency_stats)]
+_dsl.dsl_pipeline_latency_point_stats_get.restype = c_uint
+def dsl_pipeline_latency_point_stats_get(name, component, pad):
+    global _dsl
+    stats = dsl_latency_stats()
+    result = _dsl.dsl_pipeline_latency_point_stats_get(name, component, pad, 
+        byref(stats))
+    return int(result), stats
+
+##
+## dsl_pipeline_latency_total_stats_get()
+##
+_dsl.dsl_pipeline_latency_total_stats_get.argtypes = [c_wchar_p, 
+    POINTER(dsl_latency_stats)]
+_dsl.dsl_pipeline_latency_total_stats_get.restype = c_uint
+def dsl_pipeline_latency_total_stats_get(name):
+    global _dsl
+    stats = dsl_latency_stats()
+    result = _dsl.dsl_pipeline_latency_total_stats_get(name, byref(stats))
+    return int(result), stats
+
+##
+## dsl_pipeline_latency_stats_clear()
+##
+_dsl.dsl_pipeline_latency_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_latency_stats_clear.restype = c_uint
+def dsl_pipeline_latency_stats_clear(name):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_stats_clear(name)
+    return int(result)
+
+##
+## dsl_pipeline_latency_report_handler_add()
+##
+_dsl.dsl_pipeline_latency_report_handler_add.argtypes = [c_wchar_p, 
+    DSL_PIPELINE_LATENCY_REPORT_HANDLER, c_uint, c_void_p]
+_dsl.dsl_pipeline_latency_report_handler_add.restype = c_uint
+def dsl_pipeline_latency_report_handler_add(name, client_handler, 
+    interval, client_data):
+    global _dsl
+    c_client_handler = DSL_PIPELINE_LATENCY_REPORT_HANDLER(client_handler)
+    callbacks.append(c_client_handler)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result = _dsl.dsl_pipeline_latency_report_handler_add(name, 
+        c_client_handler, interval, c_client_data)
+    return int(result)
+
+##
+## dsl_pipeline_latency_report_handler_remove()
+##
+_dsl.dsl_pipeline_latency_report_handler_remove.argtypes = [c_wchar_p, 
+    DSL_PIPELINE_LATENCY_REPORT_HANDLER]
+_dsl.dsl_pipeline_latency_report_handler_remove.restype = c_uint
+def dsl_pipeline_latency_report_handler_remove(name, client_handler):
+    global _dsl
+    c_client_handler = DSL_PIPELINE_LATENCY_REPORT_HANDLER(client_handler)
+    result = _dsl.dsl_pipeline_latency_report_handler_remove(name, 
+        c_client_handler)
+    return int(result)
+
 ##
 ## dsl_pipeline_main_loop_new()
 ##
@@ -8666,3 +9567,57 @@ def dsl_info_log_function_restore():
     global _dsl
     result = _dsl.dsl_info_log_function_restore()
     return int(result)
+
+##
+## dsl_info_callback_dispatcher_params_get()
+##
+_dsl.dsl_info_callback_dispatcher_params_get.argtypes = [POINTER(c_uint), 
+    POINTER(c_uint)]
+_dsl.dsl_info_callback_dispatcher_params_get.restype = c_uint
+def dsl_info_callback_dispatcher_params_get():
+    global _dsl
+    queue_capacity = c_uint(0)
+    slow_threshold = c_uint(0)
+    result = _dsl.dsl_info_callback_dispatcher_params_get(
+        DSL_UINT_P(queue_capacity), DSL_UINT_P(slow_threshold))
+    return int(result), queue_capacity.value, slow_threshold.value
+
+##
+## dsl_info_callback_dispatcher_params_set()
+##
+_dsl.dsl_info_callback_dispatcher_params_set.argtypes = [c_uint, c_uint]
+_dsl.dsl_info_callback_dispatcher_params_set.restype = c_uint
+def dsl_info_callback_dispatcher_params_set(queue_capacity, slow_threshold):
+    global _dsl
+    result = _dsl.dsl_info_callback_dispatcher_params_set(
+        queue_capacity, slow_threshold)
+    return int(result)
+
+##
+## dsl_info_callback_dispatcher_stats_get()
+##
+_dsl.dsl_info_callback_dispatcher_stats_get.argtypes = [
+    POINTER(POINTER(dsl_callback_listener_stats)), POINTER(c_uint)]
+_dsl.dsl_info_callback_dispatcher_stats_get.restype = c_uint
+def dsl_info_callback_dispatcher_stats_get():
+    global _dsl
+    stats = POINTER(dsl_callback_listener_stats)()
+    size = c_uint(0)
+    result = _dsl.dsl_info_callback_dispatcher_stats_get(
+        byref(stats), DSL_UINT_P(size))
+    return int(result), [(stats[i].name, stats[i].queue_depth, 
+        stats[i].peak_queue_depth, stats[i].dispatched, stats[i].coalesced,
+        stats[i].overflows, stats[i].slow_count,
+        dsl_latency_stats.from_buffer_copy(stats[i].queue_latency),
+        dsl_latency_stats.from_buffer_copy(stats[i].run_latency)) 
+        for i in range(size.value)]
+
+##
+## dsl_info_callback_dispatcher_stats_clear()
+##
+_dsl.dsl_info_callback_dispatcher_stats_clear.argtypes = []
+_dsl.dsl_info_callback_dispatcher_stats_clear.restype = c_uint
+def dsl_info_callback_dispatcher_stats_clear():
+    global _dsl
+    result = _dsl.dsl_info_callback_dispatcher_stats_clear()
+    return int(result)
@@ -44,6 +44,7 @@ THE SOFTWARE.
 #include <math.h>
 #include <fstream>
 #include <thread>
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <typeinfo>
@@ -1656,6 +1656,36 @@ uint dsl_ode_action_list_size()
     return DSL::Services::GetServices()->OdeActionListSize();
 }
 
+DslReturnType dsl_ode_action_executor_params_get(uint* max_workers, 
+    uint* queue_capacity)
+{
+    RETURN_IF_PARAM_IS_NULL(max_workers);
+    RETURN_IF_PARAM_IS_NULL(queue_capacity);
+
+    return DSL::Services::GetServices()->OdeActionExecutorParamsGet(
+        max_workers, queue_capacity);
+}
+
+DslReturnType dsl_ode_action_executor_params_set(uint max_workers, 
+    uint queue_capacity)
+{
+    return DSL::Services::GetServices()->OdeActionExecutorParamsSet(
+        max_workers, queue_capacity);
+}
+
+DslReturnType dsl_ode_action_executor_stats_get(
+    dsl_ode_action_executor_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    return DSL::Services::GetServices()->OdeActionExecutorStatsGet(stats);
+}
+
+DslReturnType dsl_ode_action_executor_stats_clear()
+{
+    return DSL::Services::GetServices()->OdeActionExecutorStatsClear();
+}
+
 DslReturnType dsl_ode_area_inclusion_new(const wchar_t* name, 
     const wchar_t* polygon, boolean show, uint bbox_test_point)
 {
@@ -2270,6 +2300,21 @@ DslReturnType dsl_ode_trigger_reset(const wchar_t* name)
     return DSL::Services::GetServices()->OdeTriggerReset(cstrName.c_str());
 }
 
+DslReturnType dsl_ode_trigger_counts_get(const wchar_t* name, 
+    uint64_t* events, uint64_t* frames, uint64_t* accumulated)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(events);
+    RETURN_IF_PARAM_IS_NULL(frames);
+    RETURN_IF_PARAM_IS_NULL(accumulated);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerCountsGet(cstrName.c_str(),
+        events, frames, accumulated);
+}
+
 DslReturnType dsl_ode_trigger_reset_timeout_get(const wchar_t* name, uint *timeout)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3214,6 +3259,33 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name,
         cstrName.c_str(), enabled, location, width, height);
 }
 
+DslReturnType dsl_ode_heat_mapper_mode_get(const wchar_t* name, 
+    uint* mode, uint* interval, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(mode);
+    RETURN_IF_PARAM_IS_NULL(interval);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperModeGet(
+        cstrName.c_str(), mode, interval, size);
+}
+
+DslReturnType dsl_ode_heat_mapper_mode_set(const wchar_t* name, 
+    uint mode, uint interval, uint size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperModeSet(
+        cstrName.c_str(), mode, interval, size);
+}
+
 DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3238,6 +3310,20 @@ DslReturnType dsl_ode_heat_mapper_metrics_get(const wchar_t* name,
         cstrName.c_str(), buffer, size);
 }
 
+DslReturnType dsl_ode_heat_mapper_source_metrics_get(const wchar_t* name,
+    uint source_id, const uint64_t** buffer, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffer);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperSourceMetricsGet(
+        cstrName.c_str(), source_id, buffer, size);
+}
+
 DslReturnType dsl_ode_heat_mapper_metrics_print(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3359,6 +3445,44 @@ DslReturnType dsl_pph_meter_interval_set(const wchar_t* name, uint interval)
     return DSL::Services::GetServices()->PphMeterIntervalSet(cstrName.c_str(), interval);
 }
 
+DslReturnType dsl_pph_meter_stats_new(const wchar_t* name, uint interval,
+    dsl_pph_meter_stats_handler_cb stats_handler, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats_handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMeterStatsNew(cstrName.c_str(),
+        interval, stats_handler, client_data);
+}
+
+DslReturnType dsl_pph_meter_stall_threshold_get(const wchar_t* name, 
+    uint* threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(threshold);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMeterStallThresholdGet(
+        cstrName.c_str(), threshold);
+}
+
+DslReturnType dsl_pph_meter_stall_threshold_set(const wchar_t* name, 
+    uint threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMeterStallThresholdSet(
+        cstrName.c_str(), threshold);
+}
+
 DslReturnType dsl_pph_ode_new(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3470,6 +3594,140 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint
         cstrName.c_str(), size);
 }
 
+DslReturnType dsl_pph_ode_parallel_mode_get(const wchar_t* name, 
+    boolean* enabled, uint* workers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(workers);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeParallelModeGet(
+        cstrName.c_str(), enabled, workers);
+}
+
+DslReturnType dsl_pph_ode_parallel_mode_set(const wchar_t* name, 
+    boolean enabled, uint workers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeParallelModeSet(
+        cstrName.c_str(), enabled, workers);
+}
+
+DslReturnType dsl_pph_ode_stats_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_stats_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_stats_trigger_get(const wchar_t* name, 
+    const wchar_t* trigger, uint phase, dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(trigger);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrTrigger(trigger);
+    std::string cstrTrigger(wstrTrigger.begin(), wstrTrigger.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsTriggerGet(
+        cstrName.c_str(), cstrTrigger.c_str(), phase, stats);
+}
+
+DslReturnType dsl_pph_ode_stats_action_get(const wchar_t* name, 
+    const wchar_t* action, dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(action);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrAction(action);
+    std::string cstrAction(wstrAction.begin(), wstrAction.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsActionGet(
+        cstrName.c_str(), cstrAction.c_str(), stats);
+}
+
+DslReturnType dsl_pph_ode_stats_frame_get(const wchar_t* name, 
+    dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsFrameGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_pph_ode_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsClear(cstrName.c_str());
+}
+
+DslReturnType dsl_pph_ode_stats_budget_get(const wchar_t* name, uint* budget)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(budget);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsBudgetGet(
+        cstrName.c_str(), budget);
+}
+
+DslReturnType dsl_pph_ode_stats_budget_set(const wchar_t* name, uint budget,
+    dsl_pph_ode_budget_overrun_handler_cb handler, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    if (budget)
+    {
+        RETURN_IF_PARAM_IS_NULL(handler);
+    }
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsBudgetSet(
+        cstrName.c_str(), budget, handler, client_data);
+}
+
 DslReturnType dsl_pph_nmp_new(const wchar_t* name, const wchar_t* label_file,
     uint process_method, uint match_method, float match_threshold)
 {
@@ -4268,6 +4526,91 @@ DslReturnType dsl_source_app_sample_push(const wchar_t* name, void* sample)
         sample);
 }
 
+DslReturnType dsl_source_app_buffers_push(const wchar_t* name, 
+    void** buffers, uint num_buffers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffers);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBuffersPush(cstrName.c_str(), 
+        buffers, num_buffers);
+}
+
+DslReturnType dsl_source_app_buffer_push_wrapped(const wchar_t* name, 
+    void* data, uint64_t size, dsl_source_app_buffer_release_cb release_cb,
+    void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(data);
+    RETURN_IF_PARAM_IS_NULL(release_cb);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    dsl_source_app_wrapped_buffer buffer{data, size, client_data};
+
+    return DSL::Services::GetServices()->SourceAppBuffersPushWrapped(
+        cstrName.c_str(), &buffer, 1, release_cb);
+}
+
+DslReturnType dsl_source_app_buffers_push_wrapped(const wchar_t* name, 
+    const dsl_source_app_wrapped_buffer* buffers, uint num_buffers, 
+    dsl_source_app_buffer_release_cb release_cb)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffers);
+    RETURN_IF_PARAM_IS_NULL(release_cb);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBuffersPushWrapped(
+        cstrName.c_str(), buffers, num_buffers, release_cb);
+}
+
+DslReturnType dsl_source_app_buffer_pool_size_get(const wchar_t* name, 
+    uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBufferPoolSizeGet(
+        cstrName.c_str(), size);
+}
+
+DslReturnType dsl_source_app_buffer_pool_size_set(const wchar_t* name, 
+    uint size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBufferPoolSizeSet(
+        cstrName.c_str(), size);
+}
+
+DslReturnType dsl_source_app_buffer_pool_acquire(const wchar_t* name, 
+    void** buffer, void** data, uint64_t* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffer);
+    RETURN_IF_PARAM_IS_NULL(data);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBufferPoolAcquire(
+        cstrName.c_str(), buffer, data, size);
+}
+
 DslReturnType dsl_source_app_eos(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -4390,6 +4733,91 @@ DslReturnType dsl_source_app_max_level_bytes_set(const wchar_t* name,
 //    return DSL::Services::GetServices()->SourceAppLeakyTypeSet(cstrName.c_str(),
 //        leaky_type);
 //}
+
+DslReturnType dsl_source_shm_new(const wchar_t* name, const wchar_t* shm_name,
+    const wchar_t* buffer_in_format, uint width, uint height, 
+    uint fps_n, uint fps_d, uint num_slots)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(shm_name);
+    RETURN_IF_PARAM_IS_NULL(buffer_in_format);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrShmName(shm_name);
+    std::string cstrShmName(wstrShmName.begin(), wstrShmName.end());
+    std::wstring wstrBufferInFormat(buffer_in_format);
+    std::string cstrBufferInFormat(wstrBufferInFormat.begin(), 
+        wstrBufferInFormat.end());
+
+    return DSL::Services::GetServices()->SourceShmNew(cstrName.c_str(), 
+        cstrShmName.c_str(), cstrBufferInFormat.c_str(), width, height, 
+        fps_n, fps_d, num_slots);
+}
+
+DslReturnType dsl_source_shm_stats_get(const wchar_t* name, 
+    dsl_shm_source_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceShmStatsGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_source_shm_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceShmStatsClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_source_meta_replay_new(const wchar_t* name, 
+    const wchar_t* file_path, double speed, uint surface_type, 
+    uint width, uint height)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(file_path);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->SourceMetaReplayNew(cstrName.c_str(), 
+        cstrFilePath.c_str(), speed, surface_type, width, height);
+}
+
+DslReturnType dsl_source_meta_replay_stats_get(const wchar_t* name, 
+    dsl_meta_replay_source_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceMetaReplayStatsGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_source_meta_replay_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceMetaReplayStatsClear(
+        cstrName.c_str());
+}
   
 DslReturnType dsl_source_csi_new(const wchar_t* name, 
     uint width, uint height, uint fps_n, uint fps_d)
@@ -5470,6 +5898,36 @@ DslReturnType dsl_source_rtsp_connection_stats_clear(const wchar_t* name)
         cstrName.c_str());
 }
 
+DslReturnType dsl_source_rtsp_reconnection_params_get(uint* max_concurrent, 
+    uint* max_backoff)
+{
+    RETURN_IF_PARAM_IS_NULL(max_concurrent);
+    RETURN_IF_PARAM_IS_NULL(max_backoff);
+
+    return DSL::Services::GetServices()->SourceRtspReconnectionParamsGet(
+        max_concurrent, max_backoff);
+}
+
+DslReturnType dsl_source_rtsp_reconnection_params_set(uint max_concurrent, 
+    uint max_backoff)
+{
+    return DSL::Services::GetServices()->SourceRtspReconnectionParamsSet(
+        max_concurrent, max_backoff);
+}
+
+DslReturnType dsl_source_rtsp_reconnection_stats_get(
+    dsl_rtsp_reconnection_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    return DSL::Services::GetServices()->SourceRtspReconnectionStatsGet(stats);
+}
+
+DslReturnType dsl_source_rtsp_reconnection_stats_clear()
+{
+    return DSL::Services::GetServices()->SourceRtspReconnectionStatsClear();
+}
+
 DslReturnType dsl_source_rtsp_latency_get(const wchar_t* name, uint* latency)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -7748,6 +8206,141 @@ DslReturnType dsl_sink_app_data_type_set(const wchar_t* name, uint data_type)
     return DSL::Services::GetServices()->SinkAppDataTypeSet(cstrName.c_str(),
         data_type);
 }
+
+DslReturnType dsl_sink_app_delivery_settings_get(const wchar_t* name, 
+    uint* queue_size, uint* policy, uint* batch_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(queue_size);
+    RETURN_IF_PARAM_IS_NULL(policy);
+    RETURN_IF_PARAM_IS_NULL(batch_size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppDeliverySettingsGet(
+        cstrName.c_str(), queue_size, policy, batch_size);
+}
+
+DslReturnType dsl_sink_app_delivery_settings_set(const wchar_t* name, 
+    uint queue_size, uint policy, uint batch_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppDeliverySettingsSet(
+        cstrName.c_str(), queue_size, policy, batch_size);
+}
+
+DslReturnType dsl_sink_app_delivery_stats_get(const wchar_t* name,
+    dsl_sink_app_delivery_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppDeliveryStatsGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_sink_app_delivery_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppDeliveryStatsClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_sink_shm_new(const wchar_t* name, const wchar_t* shm_name,
+    uint data_type, const wchar_t* buffer_out_format, uint width, uint height, 
+    uint num_slots)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(shm_name);
+    RETURN_IF_PARAM_IS_NULL(buffer_out_format);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrShmName(shm_name);
+    std::string cstrShmName(wstrShmName.begin(), wstrShmName.end());
+    std::wstring wstrBufferOutFormat(buffer_out_format);
+    std::string cstrBufferOutFormat(wstrBufferOutFormat.begin(), 
+        wstrBufferOutFormat.end());
+
+    return DSL::Services::GetServices()->SinkShmNew(cstrName.c_str(),
+        cstrShmName.c_str(), data_type, cstrBufferOutFormat.c_str(), 
+        width, height, num_slots);
+}
+
+DslReturnType dsl_sink_shm_stats_get(const wchar_t* name,
+    dsl_shm_sink_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkShmStatsGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_sink_shm_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkShmStatsClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_sink_meta_export_new(const wchar_t* name, uint transport,
+    const wchar_t* location, uint compression_level, uint queue_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(location);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrLocation(location);
+    std::string cstrLocation(wstrLocation.begin(), wstrLocation.end());
+
+    return DSL::Services::GetServices()->SinkMetaExportNew(cstrName.c_str(),
+        transport, cstrLocation.c_str(), compression_level, queue_size);
+}
+
+DslReturnType dsl_sink_meta_export_stats_get(const wchar_t* name,
+    dsl_meta_export_sink_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkMetaExportStatsGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_sink_meta_export_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkMetaExportStatsClear(
+        cstrName.c_str());
+}
     
 DslReturnType dsl_sink_fake_new(const wchar_t* name)
 {
@@ -9923,6 +10516,30 @@ DslReturnType dsl_pipeline_new_component_add_many(const wchar_t* name,
     return DSL_RESULT_SUCCESS;
 }
 
+DslReturnType dsl_pipeline_new_from_spec(const wchar_t* spec)
+{
+    RETURN_IF_PARAM_IS_NULL(spec);
+
+    std::wstring wstrSpec(spec);
+    std::string cstrSpec(wstrSpec.begin(), wstrSpec.end());
+    
+    return DSL::Services::GetServices()->PipelineNewFromSpec(cstrSpec.c_str());
+}
+
+DslReturnType dsl_pipeline_startup_timings_get(const wchar_t* name,
+    const dsl_component_startup_timing** timings, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(timings);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineStartupTimingsGet(
+        cstrName.c_str(), timings, size);
+}
+
 DslReturnType dsl_pipeline_new_many(const wchar_t** names)
 {
     RETURN_IF_PARAM_IS_NULL(names);
@@ -10633,6 +11250,148 @@ DslReturnType dsl_pipeline_error_message_last_get(const wchar_t* name,
     return retval;
 }
     
+DslReturnType dsl_pipeline_latency_point_add(const wchar_t* name, 
+    const wchar_t* component, uint pad, boolean terminal)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(component);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyPointAdd(
+        cstrName.c_str(), cstrComponent.c_str(), pad, terminal);
+}
+
+DslReturnType dsl_pipeline_latency_point_previous_set(const wchar_t* name, 
+    const wchar_t* component, uint pad, 
+    const wchar_t* previous, uint previous_pad)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(component);
+    RETURN_IF_PARAM_IS_NULL(previous);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+    std::wstring wstrPrevious(previous);
+    std::string cstrPrevious(wstrPrevious.begin(), wstrPrevious.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyPointPreviousSet(
+        cstrName.c_str(), cstrComponent.c_str(), pad, 
+        cstrPrevious.c_str(), previous_pad);
+}
+
+DslReturnType dsl_pipeline_latency_point_remove(const wchar_t* name, 
+    const wchar_t* component, uint pad)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(component);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyPointRemove(
+        cstrName.c_str(), cstrComponent.c_str(), pad);
+}
+
+DslReturnType dsl_pipeline_latency_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_latency_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_latency_point_stats_get(const wchar_t* name, 
+    const wchar_t* component, uint pad, dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(component);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyPointStatsGet(
+        cstrName.c_str(), cstrComponent.c_str(), pad, stats);
+}
+
+DslReturnType dsl_pipeline_latency_total_stats_get(const wchar_t* name, 
+    dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyTotalStatsGet(
+        cstrName.c_str(), stats);
+}
+
+DslReturnType dsl_pipeline_latency_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyStatsClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_pipeline_latency_report_handler_add(const wchar_t* name, 
+    dsl_pipeline_latency_report_handler_cb handler, uint interval, 
+    void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyReportHandlerAdd(
+        cstrName.c_str(), handler, interval, client_data);
+}
+
+DslReturnType dsl_pipeline_latency_report_handler_remove(const wchar_t* name, 
+    dsl_pipeline_latency_report_handler_cb handler)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PipelineLatencyReportHandlerRemove(
+        cstrName.c_str(), handler);
+}
+
 DslReturnType dsl_pipeline_main_loop_new(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -11627,6 +12386,38 @@ DslReturnType dsl_info_log_function_restore()
     return DSL::Services::GetServices()->InfoLogFunctionRestore();
 }
 
+DslReturnType dsl_info_callback_dispatcher_params_get(uint* queue_capacity,
+    uint* slow_threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(queue_capacity);
+    RETURN_IF_PARAM_IS_NULL(slow_threshold);
+
+    return DSL::Services::GetServices()->InfoCallbackDispatcherParamsGet(
+        queue_capacity, slow_threshold);
+}
+
+DslReturnType dsl_info_callback_dispatcher_params_set(uint queue_capacity,
+    uint slow_threshold)
+{
+    return DSL::Services::GetServices()->InfoCallbackDispatcherParamsSet(
+        queue_capacity, slow_threshold);
+}
+
+DslReturnType dsl_info_callback_dispatcher_stats_get(
+    const dsl_callback_listener_stats** stats, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(stats);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    return DSL::Services::GetServices()->InfoCallbackDispatcherStatsGet(
+        stats, size);
+}
+
+DslReturnType dsl_info_callback_dispatcher_stats_clear()
+{
+    return DSL::Services::GetServices()->InfoCallbackDispatcherStatsClear();
+}
+
 DslReturnType dsl_setup_spd_logger(spdlog::logger* logger)
 {
     return DSL::Services::GetServices()->SetSpdLogger(logger);
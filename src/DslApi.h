@@ -258,6 +258,10 @@ THE SOFTWARE.
 #define DSL_RESULT_PIPELINE_GET_FAILED                              0x00080013
 #define DSL_RESULT_PIPELINE_SET_FAILED                              0x00080014
 #define DSL_RESULT_PIPELINE_MAIN_LOOP_REQUEST_FAILED                0x00080015
+#define DSL_RESULT_PIPELINE_SPEC_INVALID                            0x00080016
+#define DSL_RESULT_PIPELINE_LATENCY_POINT_ADD_FAILED                0x00080017
+#define DSL_RESULT_PIPELINE_LATENCY_POINT_REMOVE_FAILED             0x00080018
+#define DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND                 0x00080019
 
 #define DSL_RESULT_BRANCH_RESULT                                    0x000B0000
 #define DSL_RESULT_BRANCH_NAME_NOT_UNIQUE                           0x000B0001
@@ -283,6 +287,7 @@ THE SOFTWARE.
 #define DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE                       0x000D0009
 #define DSL_RESULT_PPH_METER_INVALID_INTERVAL                       0x000D000A
 #define DSL_RESULT_PPH_PAD_TYPE_INVALID                             0x000D000B
+#define DSL_RESULT_PPH_STATS_NOT_FOUND                              0x000D000C
 
 /**
  * ODE Trigger API Return Values
@@ -469,6 +474,7 @@ THE SOFTWARE.
 #define DSL_RESULT_ODE_HEAT_MAPPER_ACTION_ADD_FAILED                0x00A00007
 #define DSL_RESULT_ODE_HEAT_MAPPER_ACTION_REMOVE_FAILED             0x00A00008
 #define DSL_RESULT_ODE_HEAT_MAPPER_ACTION_NOT_IN_USE                0x00A00009
+#define DSL_RESULT_ODE_HEAT_MAPPER_SOURCE_NOT_FOUND                 0x00A0000A
 
 /**
  * ODE Preprocessor API Return Values
@@ -552,6 +558,26 @@ THE SOFTWARE.
 #define DSL_PPH_EVENT_STREAM_DELETED                                1
 #define DSL_PPH_EVENT_STREAM_ENDED                                  2
 
+/**
+ * @brief DSL ODE Pad Probe Handler - no limit on the number of Display Meta 
+ * structures acquired for each frame, the default.
+ */
+#define DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED               UINT32_MAX
+
+/**
+ * @brief DSL ODE Pad Probe Handler - Trigger phases measured when 
+ * statistics are enabled.
+ */
+#define DSL_PPH_ODE_STATS_PHASE_PRE_PROCESS                         0
+#define DSL_PPH_ODE_STATS_PHASE_CHECK                               1
+#define DSL_PPH_ODE_STATS_PHASE_POST_PROCESS                        2
+
+/**
+ * @brief DSL Meter Pad Probe Handler - default time between two frames 
+ * from the same source, in milliseconds, above which a stall is counted.
+ */
+#define DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS                    500
+
 /**
  * @brief DSL Stream Format Types
  */
@@ -608,6 +634,13 @@ THE SOFTWARE.
 #define DSL_SOURCE_CODEC_PARSER_H264                                0
 #define DSL_SOURCE_CODEC_PARSER_H265                                1
 
+/**
+ * @brief Surface types for the Metadata Replay Source.
+ */
+#define DSL_SOURCE_META_REPLAY_SURFACE_NONE                         0
+#define DSL_SOURCE_META_REPLAY_SURFACE_BLANK                        1
+#define DSL_SOURCE_META_REPLAY_SURFACE_TEST_PATTERN                 2
+
 #define DSL_TILER_SHOW_ALL_SOURCES                                  NULL
 
 #define DSL_CODEC_H264                                              0
@@ -677,12 +710,6 @@ THE SOFTWARE.
 #define DSL_SOCKET_CONNECTION_STATE_INITIATED                       1
 #define DSL_SOCKET_CONNECTION_STATE_FAILED                          2
 
-/**
- * @brief time to sleep between checks for new-buffer timeout
- * In units of milliseconds
- */
-#define DSL_RTSP_TEST_FOR_BUFFER_TIMEOUT_PERIOD_MS                  100
-
 /**
  * @brief time to sleep after a failed reconnection before
  * starting a new re-connection cycle. In units of seconds.
@@ -696,6 +723,18 @@ THE SOFTWARE.
  */
 #define DSL_RTSP_CONNECTION_TIMEOUT_S                               20
 
+/**
+ * @brief default maximum number of RTSP Source reconnection attempts
+ * in progress at any one time, process wide.
+ */
+#define DSL_RTSP_RECONNECTION_MAX_CONCURRENT                        4
+
+/**
+ * @brief default maximum time to sleep between failed reconnection 
+ * attempts as the backoff grows exponentially. In units of seconds.
+ */
+#define DSL_RTSP_RECONNECTION_MAX_BACKOFF_S                         120
+
 /**
  * @brief TLS certificate validation flags used to validate the 
  * RTSP server certificate.
@@ -821,6 +860,13 @@ THE SOFTWARE.
 #define DSL_HEAT_MAP_LEGEND_LOCATION_RIGHT                          1
 #define DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM                         2
 #define DSL_HEAT_MAP_LEGEND_LOCATION_LEFT                           3
+
+/**
+ * @brief Heat-Map accumulation modes.
+ */
+#define DSL_HEAT_MAP_MODE_ACCUMULATE                                0
+#define DSL_HEAT_MAP_MODE_DECAY                                     1
+#define DSL_HEAT_MAP_MODE_WINDOW                                    2
  
 /**
  * @brief On-Screen Heat-Map legend locations.
@@ -855,6 +901,30 @@ THE SOFTWARE.
 */
 #define DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX               100
 
+/**
+ * @brief default maximum number of worker threads used to execute the 
+ * asynchronous Pipeline, Player, Branch, Sink and Source ODE Actions.
+ */
+#define DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS                 2
+
+/**
+ * @brief default maximum number of asynchronous ODE Actions that can be
+ * queued for execution, process wide. Occurrences beyond this are rejected.
+ */
+#define DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY              256
+
+/**
+ * @brief default maximum number of notifications queued for each client 
+ * listener by the Callback Dispatcher. Notifications beyond this are dropped.
+ */
+#define DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY              64
+
+/**
+ * @brief default time, in units of milliseconds, above which a client 
+ * listener's callback is counted as slow by the Callback Dispatcher.
+ */
+#define DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS           100
+
 /**
  * @brief Unique class relational identifiers for Class A/B testing
  */
@@ -1079,6 +1149,21 @@ THE SOFTWARE.
 // Data types provided by the APP Sink via dsl_sink_app_new_data_handler_cb
 #define DSL_SINK_APP_DATA_TYPE_SAMPLE                               0
 #define DSL_SINK_APP_DATA_TYPE_BUFFER                               1
+#define DSL_SINK_APP_DATA_TYPE_BUFFER_LIST                          2
+
+// Queue policies for the App Sink's asynchronous delivery mode
+#define DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST                    0
+#define DSL_SINK_APP_DELIVERY_POLICY_DROP_NEWEST                    1
+#define DSL_SINK_APP_DELIVERY_POLICY_BLOCK                          2
+
+// Data types written by the Shared Memory Sink to its ring
+#define DSL_SINK_SHM_DATA_TYPE_METADATA                             0
+#define DSL_SINK_SHM_DATA_TYPE_FRAMES                               1
+
+// Transports used by the Metadata Export Sink to write its record stream
+#define DSL_SINK_META_EXPORT_TRANSPORT_FILE                         0
+#define DSL_SINK_META_EXPORT_TRANSPORT_UNIX                         1
+#define DSL_SINK_META_EXPORT_TRANSPORT_TCP                          2
 
 // Valid return values for the dsl_sink_app_new_data_handler_cb
 #define DSL_FLOW_OK                                                 0
@@ -1161,6 +1246,50 @@ typedef struct dsl_rtsp_connection_data
    
 }dsl_rtsp_connection_data;
 
+/**
+ * @struct dsl_rtsp_reconnection_stats
+ * @brief a structure of process wide reconnection stats for all RTSP Sources
+ */
+typedef struct dsl_rtsp_reconnection_stats
+{
+    /**
+     * @brief number of reconnection attempts currently in progress
+     */ 
+    uint active;
+
+    /**
+     * @brief number of RTSP Sources currently waiting for a free attempt slot
+     */ 
+    uint waiting;
+
+    /**
+     * @brief peak number of concurrent attempts since the stats were last cleared
+     */ 
+    uint peak_active;
+
+    /**
+     * @brief count of reconnection attempts started since the stats were last cleared
+     */ 
+    uint attempts;
+
+    /**
+     * @brief count of attempts that reconnected successfully
+     */ 
+    uint successes;
+
+    /**
+     * @brief count of attempts that failed or timed out
+     */ 
+    uint failures;
+
+    /**
+     * @brief count of attempts that were deferred because the maximum number
+     * of concurrent attempts was in progress
+     */ 
+    uint deferrals;
+
+}dsl_rtsp_reconnection_stats;
+
 /**
  * @struct dsl_recording_info
  * @brief recording session information provided to the client on callback
@@ -1257,6 +1386,433 @@ typedef struct _dsl_webrtc_connection_data
 
 } dsl_webrtc_connection_data;
 
+/**
+ * @struct dsl_component_startup_timing
+ * @brief startup timing breakdown for a single Pipeline component
+ */
+typedef struct _dsl_component_startup_timing
+{
+    /**
+     * @brief unique name of the component
+     */
+    const wchar_t* name;
+    
+    /**
+     * @brief time in microseconds taken to construct the component
+     */
+    uint64_t construct_us;
+    
+    /**
+     * @brief time in microseconds taken to link the component on first Play,
+     * 0 if not yet linked
+     */
+    uint64_t link_us;
+    
+    /**
+     * @brief time in microseconds from the start of the Pipeline's first 
+     * state change until the component reached a state of PLAYING, 
+     * 0 if not yet reached
+     */
+    uint64_t state_change_us;
+
+} dsl_component_startup_timing;
+
+/**
+ * @struct dsl_latency_stats
+ * @brief summary of a latency histogram, all times in nanoseconds.
+ */
+typedef struct _dsl_latency_stats
+{
+    /**
+     * @brief number of latencies recorded
+     */
+    uint64_t count;
+    
+    /**
+     * @brief minimum, maximum and mean latency recorded
+     */
+    uint64_t min;
+    uint64_t max;
+    uint64_t mean;
+    
+    /**
+     * @brief 50th, 90th and 99th percentile latencies, to a precision of 
+     * about 6%.
+     */
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+
+} dsl_latency_stats;
+
+/**
+ * @struct dsl_ode_action_executor_stats
+ * @brief process wide stats for the executor of asynchronous ODE Actions.
+ */
+typedef struct _dsl_ode_action_executor_stats
+{
+    /**
+     * @brief number of worker threads currently running
+     */
+    uint workers;
+
+    /**
+     * @brief number of actions currently queued and waiting to execute
+     */
+    uint queue_depth;
+
+    /**
+     * @brief peak queue depth since the stats were last cleared
+     */
+    uint peak_queue_depth;
+
+    /**
+     * @brief count of actions submitted, completed, and rejected because
+     * the queue was full, since the stats were last cleared
+     */
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t rejected;
+
+    /**
+     * @brief time from submission to the start of execution
+     */
+    dsl_latency_stats queue_latency;
+
+    /**
+     * @brief time taken to execute each action
+     */
+    dsl_latency_stats run_latency;
+
+} dsl_ode_action_executor_stats;
+
+/**
+ * @struct dsl_callback_listener_stats
+ * @brief stats for a single client listener notified by the Callback Dispatcher.
+ */
+typedef struct _dsl_callback_listener_stats
+{
+    /**
+     * @brief name of the listener - the name of the owning object followed 
+     * by the type of listener.
+     */
+    const wchar_t* name;
+
+    /**
+     * @brief number of notifications currently queued for the listener, 
+     * and the peak since the stats were last cleared
+     */
+    uint queue_depth;
+    uint peak_queue_depth;
+
+    /**
+     * @brief count of notifications queued, coalesced with a queued 
+     * notification, and dropped because the queue was full, since the 
+     * stats were last cleared
+     */
+    uint64_t dispatched;
+    uint64_t coalesced;
+    uint64_t overflows;
+
+    /**
+     * @brief count of callbacks that took longer than the slow threshold
+     */
+    uint64_t slow_count;
+
+    /**
+     * @brief time from notification to the start of the callback
+     */
+    dsl_latency_stats queue_latency;
+
+    /**
+     * @brief time taken by each callback
+     */
+    dsl_latency_stats run_latency;
+
+} dsl_callback_listener_stats;
+
+/**
+ * @struct dsl_sink_app_delivery_stats
+ * @brief stats for an App Sink's asynchronous delivery queue.
+ */
+typedef struct _dsl_sink_app_delivery_stats
+{
+    /**
+     * @brief number of samples currently queued for delivery
+     */
+    uint queue_depth;
+
+    /**
+     * @brief peak queue depth since the stats were last cleared
+     */
+    uint peak_queue_depth;
+
+    /**
+     * @brief number of samples received from the Pipeline
+     */
+    uint64_t received;
+
+    /**
+     * @brief number of samples delivered to the client handler
+     */
+    uint64_t delivered;
+
+    /**
+     * @brief number of samples dropped because the queue was full
+     */
+    uint64_t dropped;
+
+    /**
+     * @brief consumer lag - time from the sample being received to the
+     * start of the client handler call that delivers it.
+     */
+    dsl_latency_stats lag;
+
+} dsl_sink_app_delivery_stats;
+
+/**
+ * @struct dsl_source_app_wrapped_buffer
+ * @brief client owned memory to push, without copying, to an App Source.
+ */
+typedef struct _dsl_source_app_wrapped_buffer
+{
+    /**
+     * @brief pointer to the client's frame data.
+     */
+    void* data;
+
+    /**
+     * @brief size of the frame data in bytes.
+     */
+    uint64_t size;
+
+    /**
+     * @brief opaque pointer to client data returned with the release callback
+     * for this buffer.
+     */
+    void* client_data;
+
+} dsl_source_app_wrapped_buffer;
+
+/**
+ * @struct dsl_shm_source_stats
+ * @brief stats for a Shared Memory Source's frame ring.
+ */
+typedef struct _dsl_shm_source_stats
+{
+    /**
+     * @brief number of frame slots in the ring.
+     */
+    uint num_slots;
+
+    /**
+     * @brief number of slots currently committed by the producer and
+     * not yet released by the Pipeline.
+     */
+    uint occupied;
+
+    /**
+     * @brief peak number of occupied slots since the stats were last cleared.
+     */
+    uint peak_occupied;
+
+    /**
+     * @brief true if a live producer process is attached to the ring.
+     */
+    boolean producer_attached;
+
+    /**
+     * @brief number of times a producer has re-attached to the ring since
+     * the stats were last cleared.
+     */
+    uint producer_restarts;
+
+    /**
+     * @brief number of frames received from the producer.
+     */
+    uint64_t frames_received;
+
+    /**
+     * @brief number of frames the producer failed to write because the 
+     * ring was full.
+     */
+    uint64_t overruns;
+
+} dsl_shm_source_stats;
+
+/**
+ * @struct dsl_meta_replay_source_stats
+ * @brief stats for a Metadata Replay Source.
+ */
+typedef struct _dsl_meta_replay_source_stats
+{
+    /**
+     * @brief number of batched buffers pushed.
+     */
+    uint64_t batches_replayed;
+
+    /**
+     * @brief number of frames pushed.
+     */
+    uint64_t frames_replayed;
+
+    /**
+     * @brief number of objects pushed.
+     */
+    uint64_t objects_replayed;
+
+    /**
+     * @brief number of batches pushed more than 5 ms after their scheduled 
+     * time, when replaying at a set speed. A Pipeline that can't keep up
+     * with the replay speed increments this count.
+     */
+    uint64_t late_batches;
+
+    /**
+     * @brief number of records skipped as invalid or of unknown type.
+     */
+    uint64_t records_skipped;
+
+    /**
+     * @brief number of bytes read from the recorded stream.
+     */
+    uint64_t bytes_read;
+
+} dsl_meta_replay_source_stats;
+
+/**
+ * @struct dsl_shm_sink_stats
+ * @brief stats for a Shared Memory Sink's broadcast ring.
+ */
+typedef struct _dsl_shm_sink_stats
+{
+    /**
+     * @brief number of slots in the ring.
+     */
+    uint num_slots;
+
+    /**
+     * @brief number of live reader processes attached to the ring.
+     */
+    uint readers;
+
+    /**
+     * @brief number of attached readers that have fallen a full ring 
+     * behind the writer and will skip ahead on their next read.
+     */
+    uint slow_readers;
+
+    /**
+     * @brief number of frames written to the ring.
+     */
+    uint64_t frames_written;
+
+    /**
+     * @brief number of objects not written because a frame had more objects
+     * than a slot can hold.
+     */
+    uint64_t objects_dropped;
+
+    /**
+     * @brief number of frames skipped by all readers.
+     */
+    uint64_t reader_skips;
+
+} dsl_shm_sink_stats;
+
+/**
+ * @struct dsl_meta_export_sink_stats
+ * @brief stats for a Metadata Export Sink's record queue and writer.
+ */
+typedef struct _dsl_meta_export_sink_stats
+{
+    /**
+     * @brief number of records currently queued for the writer.
+     */
+    uint queue_depth;
+
+    /**
+     * @brief peak queue depth since the stats were last cleared.
+     */
+    uint peak_queue_depth;
+
+    /**
+     * @brief number of successful socket connections.
+     */
+    uint connects;
+
+    /**
+     * @brief number of records written to the file or socket.
+     */
+    uint64_t records_written;
+
+    /**
+     * @brief number of records dropped because the queue was full or the
+     * file or socket could not be written.
+     */
+    uint64_t records_dropped;
+
+    /**
+     * @brief number of record bytes written, before compression.
+     */
+    uint64_t raw_bytes;
+
+    /**
+     * @brief number of block bytes written to the file or socket, after
+     * compression.
+     */
+    uint64_t bytes_written;
+
+} dsl_meta_export_sink_stats;
+
+/**
+ * @struct dsl_meter_source_stats
+ * @brief performance measurements for a single source reported by a Meter
+ * Pad Probe Handler. Jitter is the difference between two consecutive 
+ * inter-frame intervals, in nanoseconds.
+ */
+typedef struct _dsl_meter_source_stats
+{
+    /**
+     * @brief unique id of the source - i.e. the Streammuxer pad index.
+     */
+    uint source_id;
+    
+    /**
+     * @brief number of frames received since the start of the session.
+     */
+    uint64_t frame_count;
+    
+    /**
+     * @brief average frames-per-second for the current session and for
+     * the last reporting interval.
+     */
+    double session_fps_avg;
+    double interval_fps_avg;
+    
+    /**
+     * @brief 50th, 90th and 99th percentile and maximum inter-frame jitter 
+     * for the last reporting interval.
+     */
+    uint64_t jitter_p50;
+    uint64_t jitter_p90;
+    uint64_t jitter_p99;
+    uint64_t jitter_max;
+    
+    /**
+     * @brief number of inter-frame intervals that exceeded the Meter's stall 
+     * threshold since the start of the session.
+     */
+    uint64_t stall_count;
+    
+    /**
+     * @brief number of frames missing from the source's frame numbers
+     * since the start of the session.
+     */
+    uint64_t drop_count;
+
+} dsl_meter_source_stats;
+
 /**
  * @struct _dsl_coordinate
  * @brief defines a frame coordinate by it's x and y pixel position
@@ -1635,6 +2191,18 @@ typedef boolean (*dsl_ode_post_process_frame_cb)(void* buffer,
  */
 typedef boolean (*dsl_pph_meter_client_handler_cb)(double* session_fps_averages, 
     double* interval_fps_averages, uint source_count, void* client_data);
+
+/**
+ * @brief callback typedef for a client to handle new Pipeline performance data
+ * calculated by the Meter Pad Probe Handler, at an interval specified by the client.
+ * @param[in] stats array of performance measurements, one per source, 
+ * specified by source_count.
+ * @param[in] source_count number of structures in the stats array.
+ * @param[in] client_data opaque pointer to client's user data.
+ * @return true to continue reporting, false to stop.
+ */
+typedef boolean (*dsl_pph_meter_stats_handler_cb)(dsl_meter_source_stats* stats, 
+    uint source_count, void* client_data);
     
 /**
  * @brief callback typedef for a client pad probe handler function. Once added to a Component, 
@@ -1655,6 +2223,19 @@ typedef uint (*dsl_pph_custom_client_handler_cb)(void* buffer, void* client_data
  */
 typedef void (*dsl_pph_buffer_timeout_handler_cb)(uint timeout, void* client_data);
     
+/**
+ * @brief callback typedef for a client handler function to be used with an
+ * ODE Pad Probe Handler (PPH). Once set, the client callback will be called
+ * for each frame that takes longer than the frame budget to process. 
+ * @param[in] source_id unique id of the source for the frame.
+ * @param[in] frame_num frame number of the frame.
+ * @param[in] duration time taken to process the frame in microseconds.
+ * @param[in] budget the frame budget that was exceeded in microseconds.
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_pph_ode_budget_overrun_handler_cb)(uint source_id,
+    uint frame_num, uint64_t duration, uint budget, void* client_data);
+
 /**
  * @brief callback typedef for a client handler function to be used with a
  * End of Stream (EOS) Pad Probe Handler (PPH). Once the PPH is added to a 
@@ -1693,6 +2274,24 @@ typedef uint (*dsl_pph_stream_event_handler_cb)(uint stream_event,
 typedef void (*dsl_state_change_listener_cb)(uint prev_state, 
     uint curr_state, void* client_data);
 
+/**
+ * @brief callback typedef for a client handler function. Once added to a Pipeline,
+ * the function will be called at a client specified interval with the latency
+ * statistics for each of the Pipeline's Latency Points.
+ * @param[in] components array of component names, one per Latency Point.
+ * @param[in] pads array of pads, one of DSL_PAD_SINK or DSL_PAD_SRC,
+ * one per Latency Point.
+ * @param[in] point_stats array of latency statistics, one per Latency Point,
+ * measured from the previous point. Empty for the first point.
+ * @param[in] point_count number of Latency Points in each array.
+ * @param[in] total_stats end-to-end latency statistics measured from the 
+ * first to the last Latency Point.
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_pipeline_latency_report_handler_cb)(const wchar_t** components,
+    uint* pads, dsl_latency_stats* point_stats, uint point_count, 
+    dsl_latency_stats* total_stats, void* client_data);
+
 /**
  * @brief callback typedef for a client listener function. Once added to a Pipeline, 
  * the function will be called on receipt of EOS message from the Pipeline bus.
@@ -1847,14 +2446,25 @@ typedef void (*dsl_source_app_need_data_handler_cb)(uint length, void* client_da
  */
 typedef void (*dsl_source_app_enough_data_handler_cb)(void* client_data);
 
+/**
+ * @brief Callback typedef for the App Source Component. The function is passed
+ * to dsl_source_app_buffer_push_wrapped or dsl_source_app_buffers_push_wrapped
+ * and is called once the Pipeline has released the client's wrapped memory.
+ * The callback may be called from any streaming thread.
+ * @param[in] data pointer to the client memory that is no longer in use.
+ * @param[in] client_data opaque pointer to client's user data.
+ */
+typedef void (*dsl_source_app_buffer_release_cb)(void* data, void* client_data);
+
 /**
  * @brief Callback typedef for the App Sink Component. The function is registered
  * when the App Sink is created with dsl_sink_app_new. Once the Pipeline is playing, 
  * the function will be called when new data is available to process. The type of
  * data is specified with the App Sink constructor.
  * @param[in] data_type type of data provided. Either DSL_SINK_APP_DATA_TYPE_SAMPLE
- * or DSL_SINK_APP_DATA_TYPE_BUFFER.
- * @param[in] data pointer to either a sample or buffer to process.
+ * or DSL_SINK_APP_DATA_TYPE_BUFFER, or DSL_SINK_APP_DATA_TYPE_BUFFER_LIST when
+ * the App Sink's delivery batch-size is greater than one.
+ * @param[in] data pointer to either a sample, buffer, or buffer-list to process.
  * @param[in] client_data opaque pointer to client's user data.
  * @return one of the DSL_FLOW constant values.
  */
@@ -2961,6 +3571,46 @@ DslReturnType dsl_ode_action_delete_all();
  */
 uint dsl_ode_action_list_size();
 
+/**
+ * @brief Gets the current process wide params of the executor used to run the
+ * asynchronous Pipeline, Player, Branch, Sink and Source ODE Actions off the 
+ * streaming thread. The params are set to DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS
+ * and DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY on first use.
+ * @param[out] max_workers maximum number of actions executing at any one time.
+ * Occurrences of the same action always execute one at a time, in order.
+ * @param[out] queue_capacity maximum number of actions queued for execution.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_executor_params_get(uint* max_workers, 
+    uint* queue_capacity);
+
+/**
+ * @brief Sets the process wide params of the asynchronous ODE Action executor.
+ * @param[in] max_workers maximum number of actions executing at any one time.
+ * Must be greater than 0.
+ * @param[in] queue_capacity maximum number of actions queued for execution.
+ * Must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_executor_params_set(uint max_workers, 
+    uint queue_capacity);
+
+/**
+ * @brief Gets the current process wide stats of the asynchronous ODE Action 
+ * executor.
+ * @param[out] stats the current executor stats.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_executor_stats_get(
+    dsl_ode_action_executor_stats* stats);
+
+/**
+ * @brief Clears the process wide stats of the asynchronous ODE Action executor.
+ * Note: "workers" and "queue_depth" are not cleared.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_executor_stats_clear();
+
 /**
  * @brief Creates a uniquely named ODE Inclusion Area
  * @param[in] name unique name of the ODE area to create
@@ -3463,6 +4113,18 @@ DslReturnType dsl_ode_trigger_cross_view_settings_set(const wchar_t* name,
  */
 DslReturnType dsl_ode_trigger_reset(const wchar_t* name);
 
+/**
+ * @brief Gets the current counts for the named ODE Trigger, aggregated over
+ * all sources. The Trigger keeps its per-frame state for each source separately.
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] events number of events triggered since creation or last reset.
+ * @param[out] frames number of frames processed since the first event.
+ * @param[out] accumulated number of occurrences accumulated over all sources.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_counts_get(const wchar_t* name, 
+    uint64_t* events, uint64_t* frames, uint64_t* accumulated);
+
 /**
  * @brief Gets the current auto-reset timer setting for the named ODE Trigger. If set, 
  * the Trigger, upon reaching its limit, will start a timer to then auto-reset on expiration.
@@ -4131,6 +4793,38 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_get(const wchar_t* name,
 DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name, 
     boolean enabled, uint location, uint width, uint height);
 
+/**
+ * @brief Gets the current accumulation mode settings for the named ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[out] mode current mode, one of DSL_HEAT_MAP_MODE_*
+ * @param[out] interval update interval in units of seconds.
+ * @param[out] size number of intervals for the half-life of the decay, or 
+ * for the length of the window. 
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_mode_get(const wchar_t* name, 
+    uint* mode, uint* interval, uint* size);
+
+/**
+ * @brief Sets the accumulation mode for the named ODE Heat-Mapper. 
+ * DSL_HEAT_MAP_MODE_ACCUMULATE (default) accumulates until the metrics are 
+ * cleared. DSL_HEAT_MAP_MODE_DECAY reduces all counts once every interval 
+ * so that they halve every size intervals. DSL_HEAT_MAP_MODE_WINDOW maps 
+ * the occurrences of the last size intervals only. Setting the mode clears 
+ * the current metrics.
+ * @param[in] name unique name of the ODE Heat-Mapper to update.
+ * @param[in] mode new mode, one of DSL_HEAT_MAP_MODE_*
+ * @param[in] interval update interval in units of seconds, ignored for
+ * DSL_HEAT_MAP_MODE_ACCUMULATE.
+ * @param[in] size number of intervals for the half-life of the decay, or
+ * for the length of the window. Ignored for DSL_HEAT_MAP_MODE_ACCUMULATE.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_mode_set(const wchar_t* name, 
+    uint mode, uint interval, uint size);
+
 /**
  * @brief Calls on an ODE Heat-Mapper to clear its current heat-map metrics
  * returning the map to its initial all-zero state. 
@@ -4146,7 +4840,8 @@ DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name);
  * @param[out] buffer a linear buffer of metric map data. Each row or 
  * map data is serialized to a single buffer of size cols*rows. 
  * Each element in the buffer indicates the total number of occurrences
- * accumulated for the position in the map.
+ * accumulated for the position in the map. The buffer is the live map, 
+ * updated in place, and is valid until the ODE Heat-Mapper is deleted.
  * @param[out] size size of buffer - cols*rows.
  * @return DSL_RESULT_SUCCESS on success, 
  * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
@@ -4154,6 +4849,23 @@ DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name);
 DslReturnType dsl_ode_heat_mapper_metrics_get(const wchar_t* name,
     const uint64_t** buffer, uint* size);
 
+/**
+ * @brief Get the current heat-map metrics of a single source from an 
+ * ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[in] source_id unique id of the source to query.
+ * @param[out] buffer a linear buffer of the source's metric map data, 
+ * serialized in the same format as dsl_ode_heat_mapper_metrics_get. The 
+ * buffer is the live map, updated in place, and is valid until the 
+ * ODE Heat-Mapper is deleted.
+ * @param[out] size size of buffer - cols*rows.
+ * @return DSL_RESULT_SUCCESS on success, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_SOURCE_NOT_FOUND if no occurrences have been
+ * mapped for source_id, DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_source_metrics_get(const wchar_t* name,
+    uint source_id, const uint64_t** buffer, uint* size);
+
 /**
  * @brief Calls on an ODE Heat-Mapper to print its current heat-map metrics
  * to the console. 
@@ -4210,78 +4922,193 @@ DslReturnType dsl_ode_heat_mapper_delete_many(const wchar_t** names);
 DslReturnType dsl_ode_heat_mapper_delete_all();
 
 /**
- * @brief Returns the size of the list of ODE Heat-Mappers.
- * @return the number of ODE Heat-Mapper in the list.
+ * @brief Returns the size of the list of ODE Heat-Mappers.
+ * @return the number of ODE Heat-Mapper in the list.
+ */
+uint dsl_ode_heat_mapper_list_size();
+
+/**
+ * @brief creates a new, uniquely named Object Detection Event (ODE) PPH component
+ * @param[in] name unique name for the new Handler
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_new(const wchar_t* name);
+
+/**
+ * @brief Adds a named ODE Trigger to a named ODE Handler Component
+ * @param[in] name unique name of the ODE Handler to update
+ * @param[in] trigger unique name of the Trigger to add
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_trigger_add(const wchar_t* name, const wchar_t* trigger);
+
+/**
+ * @brief Adds a Null terminated listed of named ODE Triggers to a named ODE Handler Component
+ * @param[in] name unique name of the ODE Handler to update
+ * @param[in] triggers Null terminated list of Trigger names to add
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_trigger_add_many(const wchar_t* name, const wchar_t** triggers);
+
+/**
+ * @brief Removes a named ODE Trigger from a named ODE Handler Component
+ * @param[in] name unique name of the ODE Handler to update
+ * @param[in] odeType unique name of the Trigger to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_trigger_remove(const wchar_t* name, const wchar_t* trigger);
+
+/**
+ * @brief Removes a Null terminated listed of named ODE Triggers from a named ODE Handler Component
+ * @param[in] name unique name of the ODE Handler to update
+ * @param[in] triggers Null terminated list of Trigger names to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_trigger_remove_many(const wchar_t* name, const wchar_t** triggers);
+
+/**
+ * @brief Removes all ODE Triggers from a named ODE Handler Component
+ * @param[in] name unique name of the ODE Handler to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name);
+
+/**
+ * @brief Gets the current setting for the maximum number of Display Meta structures
+ * that can be allocated for each frame. Structures are only acquired once an element
+ * needs one. Each structure can hold up to 16 display elements for each display type
+ * (lines, arrows, rectangles, etc.). The default is 
+ * DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] count current maximum Display Meta structures allocated per frame
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint* size);
+
+/**
+ * @brief Sets the current setting for the maximum number of Display Meta structures
+ * that can be allocated for each frame. Structures are only acquired once an element
+ * needs one. Each structure can hold up to 16 display elements for each display type
+ * (lines, arrows, rectangles, etc.). The default is 
+ * DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED. Set to 0 to disable display meta.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] size maximum Display Meta structures allocated per frame
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint size);
+
+/**
+ * @brief Gets the current parallel-mode settings for the named ODE Pad Probe 
+ * Handler. When enabled, the frames of each batch are evaluated by a pool of 
+ * worker threads. The default is disabled, i.e. frames are evaluated serially.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if parallel mode is enabled, false otherwise.
+ * @param[out] workers number of worker threads used in parallel mode.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-uint dsl_ode_heat_mapper_list_size();
+DslReturnType dsl_pph_ode_parallel_mode_get(const wchar_t* name, 
+    boolean* enabled, uint* workers);
 
 /**
- * @brief creates a new, uniquely named Object Detection Event (ODE) PPH component
- * @param[in] name unique name for the new Handler
+ * @brief Sets the parallel-mode settings for the named ODE Pad Probe Handler.
+ * When enabled, the frames of each batch are evaluated by a pool of worker 
+ * threads with the streaming thread participating. Each Trigger still processes
+ * the frames of a batch in order, and Display Meta is added to the frames in
+ * order, so results are identical to serial evaluation.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable parallel mode, false to disable.
+ * @param[in] workers number of worker threads to use in addition to the 
+ * streaming thread. Set to 0 to use one less than the number of processors.
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_new(const wchar_t* name);
+DslReturnType dsl_pph_ode_parallel_mode_set(const wchar_t* name, 
+    boolean enabled, uint workers);
 
 /**
- * @brief Adds a named ODE Trigger to a named ODE Handler Component
- * @param[in] name unique name of the ODE Handler to update
- * @param[in] trigger unique name of the Trigger to add
+ * @brief Gets the current stats-enabled setting for the named ODE Pad Probe
+ * Handler. The default is disabled.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if stats are enabled, false otherwise.
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_trigger_add(const wchar_t* name, const wchar_t* trigger);
+DslReturnType dsl_pph_ode_stats_enabled_get(const wchar_t* name, 
+    boolean* enabled);
 
 /**
- * @brief Adds a Null terminated listed of named ODE Triggers to a named ODE Handler Component
- * @param[in] name unique name of the ODE Handler to update
- * @param[in] triggers Null terminated list of Trigger names to add
+ * @brief Sets the stats-enabled setting for the named ODE Pad Probe Handler.
+ * When enabled, the handler records call counts and latency histograms for 
+ * the PreProcessFrame, CheckForOccurrence and PostProcessFrame phases of each
+ * Trigger, for each Action, and for each frame. Trigger phases include the 
+ * time taken by their Actions.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable stats, false to disable.
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_trigger_add_many(const wchar_t* name, const wchar_t** triggers);
+DslReturnType dsl_pph_ode_stats_enabled_set(const wchar_t* name, 
+    boolean enabled);
 
 /**
- * @brief Removes a named ODE Trigger from a named ODE Handler Component
- * @param[in] name unique name of the ODE Handler to update
- * @param[in] odeType unique name of the Trigger to remove
- * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ * @brief Gets the latency stats for one phase of a named ODE Trigger.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[in] trigger unique name of the ODE Trigger to get stats for.
+ * @param[in] phase one of the DSL_PPH_ODE_STATS_PHASE_* constants.
+ * @param[out] stats call count and latencies in nanoseconds.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_STATS_NOT_FOUND if 
+ * no stats have been recorded for the Trigger and phase.
  */
-DslReturnType dsl_pph_ode_trigger_remove(const wchar_t* name, const wchar_t* trigger);
+DslReturnType dsl_pph_ode_stats_trigger_get(const wchar_t* name, 
+    const wchar_t* trigger, uint phase, dsl_latency_stats* stats);
 
 /**
- * @brief Removes a Null terminated listed of named ODE Triggers from a named ODE Handler Component
- * @param[in] name unique name of the ODE Handler to update
- * @param[in] triggers Null terminated list of Trigger names to remove
+ * @brief Gets the latency stats for a named ODE Action.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[in] action unique name of the ODE Action to get stats for.
+ * @param[out] stats call count and latencies in nanoseconds.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_STATS_NOT_FOUND if 
+ * no stats have been recorded for the Action.
+ */
+DslReturnType dsl_pph_ode_stats_action_get(const wchar_t* name, 
+    const wchar_t* action, dsl_latency_stats* stats);
+
+/**
+ * @brief Gets the latency stats for all frames processed by the named ODE 
+ * Pad Probe Handler while stats are enabled.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] stats frame count and latencies in nanoseconds.
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_trigger_remove_many(const wchar_t* name, const wchar_t** triggers);
+DslReturnType dsl_pph_ode_stats_frame_get(const wchar_t* name, 
+    dsl_latency_stats* stats);
 
 /**
- * @brief Removes all ODE Triggers from a named ODE Handler Component
- * @param[in] name unique name of the ODE Handler to update
+ * @brief Clears all stats recorded by the named ODE Pad Probe Handler.
+ * @param[in] name unique name of the ODE Handler to update.
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name);
+DslReturnType dsl_pph_ode_stats_clear(const wchar_t* name);
 
 /**
- * @brief Gets the current setting for the number of Display Meta structures that
- * are allocated for each frame. Each structure can hold up to 16 display elements
- * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * @brief Gets the current frame budget for the named ODE Pad Probe Handler.
  * @param[in] name unique name of the ODE Handler to query.
- * @param[out] count current count of Display Meta structures allocated per frame
+ * @param[out] budget frame budget in microseconds, 0 if disabled (default).
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint* size);
+DslReturnType dsl_pph_ode_stats_budget_get(const wchar_t* name, uint* budget);
 
 /**
- * @brief Sets the current setting for the number of Display Meta structures that
- * are allocated for each frame. Each structure can hold up to 16 display elements
- * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * @brief Sets the frame budget for the named ODE Pad Probe Handler. The 
+ * client handler is called, from the streaming thread, for each frame that 
+ * takes longer than the budget to process. The budget can be set with stats
+ * disabled.
  * @param[in] name unique name of the ODE Handler to update.
- * @param[in] size number of Display Meta structures allocated per frame
+ * @param[in] budget frame budget in microseconds, 0 to disable.
+ * @param[in] handler client handler to call on each budget overrun.
+ * @param[in] client_data opaque pointer to client's data returned with 
+ * each call to the handler.
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
-DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint size);
+DslReturnType dsl_pph_ode_stats_budget_set(const wchar_t* name, uint budget,
+    dsl_pph_ode_budget_overrun_handler_cb handler, void* client_data);
 
 /**
  * @brief creates a new, uniquely named Custom pad-probe-handler to process a buffer
@@ -4320,6 +5147,40 @@ DslReturnType dsl_pph_meter_interval_get(const wchar_t* name, uint* interval);
  */
 DslReturnType dsl_pph_meter_interval_set(const wchar_t* name, uint interval);
 
+/**
+ * @brief creates a new, uniquely named Meter pad-probe-handler that reports
+ * frame-rate, jitter, stall and drop measurements for each source.
+ * @param[in] name unique component name for the new Meter
+ * @param[in] interval interval at which to report performance measurements
+ * in seconds.
+ * @param[in] stats_handler client callback function, called at "interval" 
+ * with an array of performance measurements, one per source.
+ * @param[in] client_data opaque pointer to client date returned with the callback
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_meter_stats_new(const wchar_t* name, uint interval,
+    dsl_pph_meter_stats_handler_cb stats_handler, void* client_data);
+
+/**
+ * @brief gets the current stall threshold for the named Meter.
+ * @param[in] name unique name of the Meter to query.
+ * @param[out] threshold time between two frames from the same source, in 
+ * milliseconds, above which a stall is counted.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_meter_stall_threshold_get(const wchar_t* name, 
+    uint* threshold);
+
+/**
+ * @brief sets the stall threshold for the named Meter. The default is 
+ * DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS.
+ * @param[in] name unique name of the Meter to update.
+ * @param[in] threshold new threshold in milliseconds, must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_meter_stall_threshold_set(const wchar_t* name, 
+    uint threshold);
+
 /**
  * @brief Creates a new, uniquely named Non-Maximum Processor (NMP) Pad 
  * Probe Handler (PPH) component.
@@ -4816,6 +5677,89 @@ DslReturnType dsl_source_app_buffer_push(const wchar_t* name, void* buffer);
  */
 DslReturnType dsl_source_app_sample_push(const wchar_t* name, void* sample);
 
+/**
+ * @brief Pushes a batch of new buffers to a uniquely named App Source component
+ * for processing with a single call. Ownership of each buffer is transferred
+ * to the App Source. Buffers acquired with dsl_source_app_buffer_pool_acquire
+ * can be pushed with this service once filled.
+ * @param[in] name unqiue name of the App Source to push to.
+ * @param[in] buffers array of buffers to push to the App Source.
+ * @param[in] num_buffers number of buffers in the array.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffers_push(const wchar_t* name, 
+    void** buffers, uint num_buffers);
+
+/**
+ * @brief Wraps client memory in a new buffer, without copying, and pushes it
+ * to a uniquely named App Source component for processing. The memory must 
+ * remain valid and unchanged until the release callback is called.
+ * If the App Source is not linked, the call fails, the memory remains with 
+ * the client, and the callback is not called.
+ * @param[in] name unqiue name of the App Source to push to.
+ * @param[in] data pointer to the client's frame data.
+ * @param[in] size size of the frame data in bytes.
+ * @param[in] release_cb function to call when the Pipeline releases the memory.
+ * @param[in] client_data opaque pointer to client data passed back into the 
+ * release_cb function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_push_wrapped(const wchar_t* name, 
+    void* data, uint64_t size, dsl_source_app_buffer_release_cb release_cb,
+    void* client_data);
+
+/**
+ * @brief Wraps a batch of client memory blocks in new buffers, without copying,
+ * and pushes them to a uniquely named App Source component with a single call.
+ * The release callback is called once for each block, with the block's 
+ * client_data, when the Pipeline releases it.
+ * @param[in] name unqiue name of the App Source to push to.
+ * @param[in] buffers array of client memory blocks to push.
+ * @param[in] num_buffers number of memory blocks in the array.
+ * @param[in] release_cb function to call when the Pipeline releases each block.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffers_push_wrapped(const wchar_t* name, 
+    const dsl_source_app_wrapped_buffer* buffers, uint num_buffers, 
+    dsl_source_app_buffer_release_cb release_cb);
+
+/**
+ * @brief Gets the current buffer-pool size for the named App Source Component.
+ * @param[in] name unique name of the App Source to query.
+ * @param[out] size number of buffers pre-allocated when the App Source is 
+ * linked. Default = 0, no buffer-pool.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_pool_size_get(const wchar_t* name, 
+    uint* size);
+
+/**
+ * @brief Sets the buffer-pool size for the named App Source Component. 
+ * When set, the App Source pre-allocates the given number of frame-sized
+ * buffers (from the buffer-in-format and dimensions) when linked, which the
+ * client acquires with dsl_source_app_buffer_pool_acquire and fills in place.
+ * @param[in] name unique name of the App Source to update.
+ * @param[in] size number of buffers to pre-allocate, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_pool_size_set(const wchar_t* name, 
+    uint size);
+
+/**
+ * @brief Acquires a free buffer from the named App Source's buffer-pool.
+ * The client fills the buffer's data in place and then pushes the buffer
+ * with dsl_source_app_buffer_push or dsl_source_app_buffers_push. The buffer 
+ * returns to the pool once the Pipeline has released it. The call does not 
+ * block; when all buffers are in use, *buffer is set to NULL.
+ * @param[in] name unique name of the App Source to acquire from.
+ * @param[out] buffer acquired buffer or NULL if the pool is exhausted.
+ * @param[out] data writable pointer to the buffer's frame data.
+ * @param[out] size size of the buffer's frame data in bytes.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_pool_acquire(const wchar_t* name, 
+    void** buffer, void** data, uint64_t* size);
+
 /**
  * @brief Notifies a uniquely named App Source component that no more buffers
  * are available.
@@ -4940,6 +5884,83 @@ DslReturnType dsl_source_app_max_level_bytes_set(const wchar_t* name,
  */
 //DslReturnType dsl_source_app_leaky_type_set(const wchar_t* name,
 //    uint leaky_type);
+
+/**
+ * @brief Creates a new, uniquely named Shared Memory Source component. The 
+ * Source creates a named shared-memory ring of frame slots that a producer
+ * process writes raw frames into using the DSL Shared Memory Producer library
+ * (DslShmProducer.h). Frames are read from the ring in place, without copying.
+ * The Source is always live.
+ * @param[in] name unique name for the new Source.
+ * @param[in] shm_name name of the POSIX shared-memory ring to create, 
+ * e.g. L"/camera-1". A stale ring with the same name is replaced.
+ * @param[in] buffer_in_format one of the DSL_VIDEO_FORMAT constants.
+ * @param[in] width width of the source in pixels.
+ * @param[in] height height of the source in pixels.
+ * @param[in] fps-n frames/second fraction numerator.
+ * @param[in] fps-d frames/second fraction denominator.
+ * @param[in] num_slots number of frame slots in the ring.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shm_new(const wchar_t* name, const wchar_t* shm_name,
+    const wchar_t* buffer_in_format, uint width, uint height, 
+    uint fps_n, uint fps_d, uint num_slots);
+
+/**
+ * @brief Gets the current ring stats for the named Shared Memory Source.
+ * @param[in] name unique name of the Shared Memory Source to query.
+ * @param[out] stats current slot occupancy, overrun, and producer stats.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shm_stats_get(const wchar_t* name, 
+    dsl_shm_source_stats* stats);
+
+/**
+ * @brief Clears the current ring stats for the named Shared Memory Source.
+ * @param[in] name unique name of the Shared Memory Source to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_shm_stats_clear(const wchar_t* name);
+
+/**
+ * @brief Creates a new, uniquely named Metadata Replay Source component. The
+ * Source replays a metadata stream recorded to file by a Metadata Export Sink, 
+ * pushing a buffer with a reconstructed NvDsBatchMeta - frames, objects, 
+ * tracker data, and classifier labels - for each recorded batch. The Source
+ * replaces the Pipeline's Streammuxer and must be the Pipeline's only Source.
+ * An end-of-stream is sent after the last record is replayed.
+ * @param[in] name unique name for the new Source.
+ * @param[in] file_path path to the recorded metadata stream.
+ * @param[in] speed replay speed relative to the recorded timestamps, 
+ * e.g. 1.0 for real-time, 4.0 for four times real-time. 0 to replay at
+ * the maximum speed the Pipeline can process.
+ * @param[in] surface_type one of the DSL_SOURCE_META_REPLAY_SURFACE constants.
+ * Blank and test-pattern surfaces are RGBA in system memory.
+ * @param[in] width width of the surface in pixels, unused for 
+ * DSL_SOURCE_META_REPLAY_SURFACE_NONE.
+ * @param[in] height height of the surface in pixels, unused for
+ * DSL_SOURCE_META_REPLAY_SURFACE_NONE.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_meta_replay_new(const wchar_t* name, 
+    const wchar_t* file_path, double speed, uint surface_type, 
+    uint width, uint height);
+
+/**
+ * @brief Gets the current replay stats for the named Metadata Replay Source.
+ * @param[in] name unique name of the Metadata Replay Source to query.
+ * @param[out] stats current replay stats.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_meta_replay_stats_get(const wchar_t* name, 
+    dsl_meta_replay_source_stats* stats);
+
+/**
+ * @brief Clears the current replay stats for the named Metadata Replay Source.
+ * @param[in] name unique name of the Metadata Replay Source to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_meta_replay_stats_clear(const wchar_t* name);
     
 /**
  * @brief creates a new, uniquely named CSI Camera Source component. A unique 
@@ -5651,6 +6672,47 @@ DslReturnType dsl_source_rtsp_connection_data_get(const wchar_t* name,
  */
 DslReturnType dsl_source_rtsp_connection_stats_clear(const wchar_t* name); 
 
+/**
+ * @brief Gets the current process wide reconnection params shared by all 
+ * RTSP Sources. The parameters are set to DSL_RTSP_RECONNECTION_MAX_CONCURRENT
+ * and DSL_RTSP_RECONNECTION_MAX_BACKOFF_S on first use.
+ * @param[out] max_concurrent maximum number of reconnection attempts in
+ * progress at any one time. Sources that were most recently healthy are
+ * granted a free attempt slot first.
+ * @param[out] max_backoff maximum time, in units of seconds, to sleep after a 
+ * failed connection. The sleep time of each source doubles, with jitter, on 
+ * each consecutive failure up to this maximum.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_reconnection_params_get(uint* max_concurrent, 
+    uint* max_backoff);
+
+/**
+ * @brief Sets the process wide reconnection params shared by all RTSP Sources.
+ * @param[in] max_concurrent maximum number of reconnection attempts in
+ * progress at any one time. Must be greater than 0.
+ * @param[in] max_backoff maximum time, in units of seconds, to sleep after a 
+ * failed connection. Must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_reconnection_params_set(uint max_concurrent, 
+    uint max_backoff);
+
+/**
+ * @brief Gets the current process wide reconnection stats for all RTSP Sources.
+ * @param[out] stats the current reconnection stats. 
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_reconnection_stats_get(
+    dsl_rtsp_reconnection_stats* stats); 
+
+/**
+ * @brief Clears the process wide reconnection stats for all RTSP Sources.
+ * Note: "active" and "waiting" are not cleared.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_reconnection_stats_clear(); 
+
 /**
  * @brief Gets the current latency setting for the named RTSP Source.
  * @param name[in] name of the RTSP Source to query.
@@ -7224,6 +8286,132 @@ DslReturnType dsl_sink_app_data_type_get(const wchar_t* name, uint* data_type);
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
  */
 DslReturnType dsl_sink_app_data_type_set(const wchar_t* name, uint data_type);
+
+/**
+ * @brief Gets the current delivery settings in use by a named App Sink.
+ * @param[in] name unique name of the App Sink to query
+ * @param[out] queue_size maximum number of samples queued for delivery by the
+ * App Sink's delivery thread. 0 = synchronous delivery on the streaming thread.
+ * @param[out] policy one of the DSL_SINK_APP_DELIVERY_POLICY constants
+ * applied when the queue is full.
+ * @param[out] batch_size maximum number of buffers delivered per call to the
+ * client handler. 
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_delivery_settings_get(const wchar_t* name, 
+    uint* queue_size, uint* policy, uint* batch_size);
+
+/**
+ * @brief Sets the delivery settings for a named App Sink. With a queue_size
+ * greater than 0 samples are queued by the streaming thread and delivered to
+ * the client handler by a dedicated delivery thread so that a slow client
+ * no longer stalls the Pipeline. Settings can only be updated when the App
+ * Sink is not linked.
+ * @param[in] name unique name of the App Sink to update
+ * @param[in] queue_size maximum number of samples queued for delivery.
+ * Set to 0 to restore synchronous delivery on the streaming thread (default).
+ * @param[in] policy one of the DSL_SINK_APP_DELIVERY_POLICY constants
+ * applied when the queue is full.
+ * @param[in] batch_size maximum number of buffers delivered per call to the 
+ * client handler. When greater than 1, up to batch_size queued buffers are 
+ * delivered as a GstBufferList with data_type DSL_SINK_APP_DATA_TYPE_BUFFER_LIST.
+ * Batching requires a queue_size greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_delivery_settings_set(const wchar_t* name, 
+    uint queue_size, uint policy, uint batch_size);
+
+/**
+ * @brief Gets the current delivery stats for a named App Sink. The stats
+ * are updated in asynchronous delivery mode only.
+ * @param[in] name unique name of the App Sink to query
+ * @param[out] stats pointer to a dsl_sink_app_delivery_stats structure.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_delivery_stats_get(const wchar_t* name,
+    dsl_sink_app_delivery_stats* stats);
+
+/**
+ * @brief Clears the delivery stats for a named App Sink.
+ * Note: "queue_depth" is not cleared.
+ * @param[in] name unique name of the App Sink to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_delivery_stats_clear(const wchar_t* name);
+
+/**
+ * @brief Creates a new, uniquely named Shared Memory Sink component to write
+ * frames and/or object metadata to a named POSIX shared-memory ring that any
+ * number of reader processes can map with the DSL Shared Memory Consumer
+ * library. The Sink never waits for readers; slow readers skip ahead.
+ * @param[in] name unique component name for the new Shared Memory Sink.
+ * @param[in] shm_name name of the POSIX shared-memory ring to create.
+ * @param[in] data_type either DSL_SINK_SHM_DATA_TYPE_METADATA or 
+ * DSL_SINK_SHM_DATA_TYPE_FRAMES.
+ * @param[in] buffer_out_format one of the DSL_VIDEO_FORMAT constants to
+ * write frames in. Unused for DSL_SINK_SHM_DATA_TYPE_METADATA.
+ * @param[in] width width to scale the frames to in pixels. 
+ * Unused for DSL_SINK_SHM_DATA_TYPE_METADATA.
+ * @param[in] height height to scale the frames to in pixels.
+ * Unused for DSL_SINK_SHM_DATA_TYPE_METADATA.
+ * @param[in] num_slots number of slots in the ring.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise.
+ */
+DslReturnType dsl_sink_shm_new(const wchar_t* name, const wchar_t* shm_name,
+    uint data_type, const wchar_t* buffer_out_format, uint width, uint height, 
+    uint num_slots);
+
+/**
+ * @brief Gets the current ring stats for a named Shared Memory Sink.
+ * @param[in] name unique name of the Shared Memory Sink to query
+ * @param[out] stats pointer to a dsl_shm_sink_stats structure.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_shm_stats_get(const wchar_t* name,
+    dsl_shm_sink_stats* stats);
+
+/**
+ * @brief Clears the frames-written, objects-dropped, and reader-skips
+ * stats for a named Shared Memory Sink.
+ * @param[in] name unique name of the Shared Memory Sink to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_shm_stats_clear(const wchar_t* name);
+
+/**
+ * @brief Creates a new, uniquely named Metadata Export Sink component to 
+ * serialize the batch metadata of each buffer into a compact binary record 
+ * stream, written to a file, Unix domain socket or TCP socket. Records are 
+ * written by the Sink's own thread from a bounded queue, and dropped when 
+ * the queue is full.
+ * @param[in] name unique component name for the new Metadata Export Sink.
+ * @param[in] transport one of the DSL_SINK_META_EXPORT_TRANSPORT constants.
+ * @param[in] location file path, Unix domain socket path, or "host:port"
+ * for DSL_SINK_META_EXPORT_TRANSPORT_TCP.
+ * @param[in] compression_level zstd compression level for each block of 
+ * records, 0 to disable. Requires BUILD_WITH_ZSTD=true in the Makefile.
+ * @param[in] queue_size maximum number of records to queue for writing.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise.
+ */
+DslReturnType dsl_sink_meta_export_new(const wchar_t* name, uint transport,
+    const wchar_t* location, uint compression_level, uint queue_size);
+
+/**
+ * @brief Gets the current stats for a named Metadata Export Sink.
+ * @param[in] name unique name of the Metadata Export Sink to query
+ * @param[out] stats pointer to a dsl_meta_export_sink_stats structure.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_meta_export_stats_get(const wchar_t* name,
+    dsl_meta_export_sink_stats* stats);
+
+/**
+ * @brief Clears the stats for a named Metadata Export Sink. The peak queue
+ * depth is reset to the current queue depth.
+ * @param[in] name unique name of the Metadata Export Sink to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_meta_export_stats_clear(const wchar_t* name);
     
 /**
  * @brief Creates a new, uniquely named Fake Sink component.
@@ -8619,6 +9807,30 @@ DslReturnType dsl_pipeline_new_many(const wchar_t** names);
 DslReturnType dsl_pipeline_new_component_add_many(const wchar_t* name, 
     const wchar_t** components);
 
+/**
+ * @brief creates a new Pipeline, with all of its components, from a single
+ * JSON specification. Each component defined in the spec is created, then 
+ * added to its parent Branch, Tee, or the Pipeline itself. Pad Probe Handlers
+ * are added to the components they name. See /docs/api-pipeline.md for the
+ * specification format.
+ * @param[in] spec NULL terminated JSON specification for the new Pipeline.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ * On failure, all components created from the spec are deleted.
+ */
+DslReturnType dsl_pipeline_new_from_spec(const wchar_t* spec);
+
+/**
+ * @brief gets the startup timing - construction, link, and first state change
+ * to PLAYING - for each component of a Pipeline created from a JSON spec.
+ * @param[in] name unique name of the Pipeline to query.
+ * @param[out] timings pointer to an array of component startup timings owned
+ * by the Pipeline. The array remains valid until the next call to this service.
+ * @param[out] size number of entries in the timings array.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_startup_timings_get(const wchar_t* name,
+    const dsl_component_startup_timing** timings, uint* size);
+
 /**
  * @brief deletes a Pipeline object by name.
  * @param[in] name unique name of the Pipeline to delete.
@@ -9130,6 +10342,121 @@ DslReturnType dsl_pipeline_state_change_listener_add(const wchar_t* name,
 DslReturnType dsl_pipeline_state_change_listener_remove(const wchar_t* name, 
     dsl_state_change_listener_cb listener);
 
+/**
+ * @brief Adds a Latency Point to the sink or src pad of a component in a named
+ * Pipeline. Each buffer crossing the pad is stamped and the latency from the 
+ * previous Latency Point recorded. Points must be added in Pipeline order,
+ * one branch at a time; the first point starts, and each terminal point ends,
+ * the end-to-end latency.
+ * @param[in] name name of the Pipeline to update.
+ * @param[in] component name of the component to add the Latency Point to. 
+ * Use the Pipeline's name, with DSL_PAD_SRC, for the Pipeline's Streammuxer.
+ * @param[in] pad pad to add the Latency Point to; DSL_PAD_SINK or DSL_PAD_SRC.
+ * @param[in] terminal set to true if the point ends a branch of the Pipeline,
+ * e.g. a Sink on one branch of a Tee. If no point is terminal, the last point
+ * added ends the end-to-end latency.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_point_add(const wchar_t* name, 
+    const wchar_t* component, uint pad, boolean terminal);
+
+/**
+ * @brief Sets the Latency Point that a Latency Point measures from, e.g. for
+ * the first point on the second and later branches of a Tee. By default, 
+ * a point measures from the nearest non-terminal point added before it.
+ * @param[in] name name of the Pipeline to update.
+ * @param[in] component name of the component the Latency Point is added to.
+ * @param[in] pad pad the Latency Point is added to.
+ * @param[in] previous name of the component of the previous Latency Point,
+ * a non-terminal point added before the point.
+ * @param[in] previous_pad pad of the previous Latency Point.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_point_previous_set(const wchar_t* name, 
+    const wchar_t* component, uint pad, 
+    const wchar_t* previous, uint previous_pad);
+
+/**
+ * @brief Removes a Latency Point previously added with 
+ * dsl_pipeline_latency_point_add. All in-flight stamps are discarded.
+ * @param[in] name name of the Pipeline to update.
+ * @param[in] component name of the component to remove the Latency Point from.
+ * @param[in] pad pad to remove the Latency Point from.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_point_remove(const wchar_t* name, 
+    const wchar_t* component, uint pad);
+
+/**
+ * @brief Gets the current latency tracing enabled setting for a named Pipeline.
+ * @param[in] name name of the Pipeline to query.
+ * @param[out] enabled true if tracing is enabled, false otherwise. Default = true.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief Sets the latency tracing enabled setting for a named Pipeline.
+ * @param[in] name name of the Pipeline to update.
+ * @param[in] enabled set to true to enable tracing, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
+/**
+ * @brief Gets the latency statistics for a Latency Point, measured from the
+ * previous Latency Point in the named Pipeline.
+ * @param[in] name name of the Pipeline to query.
+ * @param[in] component name of the component the Latency Point is added to.
+ * @param[in] pad pad the Latency Point is added to.
+ * @param[out] stats latency statistics in nanoseconds.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_point_stats_get(const wchar_t* name, 
+    const wchar_t* component, uint pad, dsl_latency_stats* stats);
+
+/**
+ * @brief Gets the end-to-end latency statistics for a named Pipeline, measured
+ * from the first to the last Latency Point.
+ * @param[in] name name of the Pipeline to query.
+ * @param[out] stats latency statistics in nanoseconds.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_total_stats_get(const wchar_t* name, 
+    dsl_latency_stats* stats);
+
+/**
+ * @brief Clears all latency statistics for a named Pipeline.
+ * @param[in] name name of the Pipeline to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_stats_clear(const wchar_t* name);
+
+/**
+ * @brief Adds a callback to be called periodically with the latency statistics
+ * for a named Pipeline.
+ * @param[in] name name of the Pipeline to update.
+ * @param[in] handler pointer to the client's function to call.
+ * @param[in] interval reporting interval in seconds.
+ * @param[in] client_data opaque pointer to client data passed into the handler.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_report_handler_add(const wchar_t* name, 
+    dsl_pipeline_latency_report_handler_cb handler, uint interval, 
+    void* client_data);
+
+/**
+ * @brief Removes a callback previously added with 
+ * dsl_pipeline_latency_report_handler_add.
+ * @param[in] name name of the Pipeline to update.
+ * @param[in] handler pointer to the client's function to remove.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_report_handler_remove(const wchar_t* name, 
+    dsl_pipeline_latency_report_handler_cb handler);
+
 /**
  * @brief Creates a new main-context and main-loop for a named Pipeline. This service
  * must be called prior to calling dsl_pipeline_play and dsl_pipeline_main_loop_run.
@@ -9846,6 +11173,50 @@ DslReturnType dsl_info_log_file_set_with_ts(const wchar_t* file_path);
  */
 DslReturnType dsl_info_log_function_restore();
 
+/**
+ * @brief Gets the current params of the process wide Callback Dispatcher used
+ * to notify client listeners - RTSP Source state-change, Record session, 
+ * Pipeline error-message, and Player termination - off the calling thread.
+ * The params are set to DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY and
+ * DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS on first use.
+ * @param[out] queue_capacity maximum number of notifications queued for 
+ * each listener.
+ * @param[out] slow_threshold time, in units of ms, above which a listener's 
+ * callback is counted as slow.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_callback_dispatcher_params_get(uint* queue_capacity,
+    uint* slow_threshold);
+
+/**
+ * @brief Sets the params of the process wide Callback Dispatcher.
+ * @param[in] queue_capacity maximum number of notifications queued for 
+ * each listener. Must be greater than 0.
+ * @param[in] slow_threshold time, in units of ms, above which a listener's 
+ * callback is counted as slow. Must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_callback_dispatcher_params_set(uint queue_capacity,
+    uint slow_threshold);
+
+/**
+ * @brief Gets the current stats for each client listener notified by the
+ * process wide Callback Dispatcher.
+ * @param[out] stats pointer to an array of listener stats owned by the 
+ * dispatcher. The array remains valid until the next call to this service.
+ * @param[out] size number of entries in the stats array.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_callback_dispatcher_stats_get(
+    const dsl_callback_listener_stats** stats, uint* size);
+
+/**
+ * @brief Clears the stats for all client listeners notified by the process 
+ * wide Callback Dispatcher. Note: "queue_depth" is not cleared.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_callback_dispatcher_stats_clear();
+
 /**
  * @brief Sets up the spdlog logger instance for logging within the DSL services.
  * @param[in] logger Shared pointer to the spdlog logger to be used for logging.
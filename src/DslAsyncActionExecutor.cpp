@@ -0,0 +1,249 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslAsyncActionExecutor.h"
+
+namespace DSL
+{
+    static gpointer AsyncActionWorkerThread(gpointer pExecutor)
+    {
+        static_cast<AsyncActionExecutor*>(pExecutor)->HandleWorker();
+        return NULL;
+    }
+
+    AsyncActionExecutor* AsyncActionExecutor::GetExecutor()
+    {
+        // Created on first use and intentionally never destroyed, as actions 
+        // may still cancel their queued tasks during process exit.
+        static AsyncActionExecutor* pInstance = new AsyncActionExecutor();
+        
+        return pInstance;
+    }
+
+    AsyncActionExecutor::AsyncActionExecutor()
+        : m_maxWorkers(DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS)
+        , m_queueCapacity(DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY)
+        , m_workers(0)
+        , m_idleWorkers(0)
+        , m_queueDepth(0)
+        , m_peakQueueDepth(0)
+        , m_submitted(0)
+        , m_completed(0)
+        , m_rejected(0)
+    {
+        LOG_FUNC();
+    }
+
+    bool AsyncActionExecutor::Submit(const void* key, 
+        const std::function<void()>& task)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_executorMutex);
+        
+        if (m_queueDepth >= m_queueCapacity)
+        {
+            // Rejections are counted, not logged, as they come in bursts.
+            m_rejected++;
+            return false;
+        }
+        Strand& strand = m_strands[key];
+        strand.tasks.push_back(Task{task, CycleCounter::Now()});
+        
+        // A running strand is re-queued by its worker on task completion.
+        if (!strand.ready and !strand.running)
+        {
+            strand.ready = true;
+            m_readyStrands.push_back(key);
+        }
+        m_queueDepth++;
+        m_peakQueueDepth = std::max(m_peakQueueDepth, m_queueDepth);
+        m_submitted++;
+        
+        StartWorkers();
+        g_cond_signal(&m_executorCond);
+        
+        return true;
+    }
+
+    void AsyncActionExecutor::Cancel(const void* key)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_executorMutex);
+        
+        auto iter = m_strands.find(key);
+        if (iter == m_strands.end())
+        {
+            return;
+        }
+        m_queueDepth -= iter->second.tasks.size();
+        iter->second.tasks.clear();
+
+        // The worker of a running strand removes it on task completion.
+        if (!iter->second.running)
+        {
+            m_readyStrands.erase(std::remove(m_readyStrands.begin(), 
+                m_readyStrands.end(), key), m_readyStrands.end());
+            m_strands.erase(iter);
+        }
+    }
+
+    void AsyncActionExecutor::GetParams(uint* maxWorkers, uint* queueCapacity)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_executorMutex);
+        
+        *maxWorkers = m_maxWorkers;
+        *queueCapacity = m_queueCapacity;
+    }
+
+    bool AsyncActionExecutor::SetParams(uint maxWorkers, uint queueCapacity)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_executorMutex);
+        
+        if (!maxWorkers or !queueCapacity)
+        {
+            LOG_ERROR("Invalid async action executor params: Max Workers = "
+                << maxWorkers << ", Queue Capacity = " << queueCapacity);
+            return false;
+        }
+        m_maxWorkers = maxWorkers;
+        m_queueCapacity = queueCapacity;
+        
+        // Start any new workers now allowed, and wake all idle workers so 
+        // that any surplus can exit.
+        StartWorkers();
+        g_cond_broadcast(&m_executorCond);
+        
+        return true;
+    }
+
+    void AsyncActionExecutor::GetStats(dsl_ode_action_executor_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_executorMutex);
+        
+        stats->workers = m_workers;
+        stats->queue_depth = m_queueDepth;
+        stats->peak_queue_depth = m_peakQueueDepth;
+        stats->submitted = m_submitted;
+        stats->completed = m_completed;
+        stats->rejected = m_rejected;
+        m_queueLatency.GetStats(&stats->queue_latency);
+        m_runLatency.GetStats(&stats->run_latency);
+    }
+
+    void AsyncActionExecutor::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_executorMutex);
+        
+        m_peakQueueDepth = m_queueDepth;
+        m_submitted = 0;
+        m_completed = 0;
+        m_rejected = 0;
+        m_queueLatency.Clear();
+        m_runLatency.Clear();
+    }
+
+    void AsyncActionExecutor::StartWorkers()
+    {
+        while (m_workers < m_maxWorkers and 
+            m_idleWorkers < m_readyStrands.size())
+        {
+            // New workers are idle until they take their first task.
+            m_workers++;
+            m_idleWorkers++;
+            g_thread_unref(g_thread_new("dsl-async-action", 
+                AsyncActionWorkerThread, this));
+        }
+    }
+
+    void AsyncActionExecutor::HandleWorker()
+    {
+        g_mutex_lock(&m_executorMutex);
+        
+        while (m_workers <= m_maxWorkers)
+        {
+            if (m_readyStrands.empty())
+            {
+                g_cond_wait(&m_executorCond, &m_executorMutex);
+                continue;
+            }
+            const void* key = m_readyStrands.front();
+            m_readyStrands.pop_front();
+            
+            // Strands are only removed when neither ready nor running.
+            Strand& strand = m_strands[key];
+            strand.ready = false;
+            strand.running = true;
+            
+            Task task(std::move(strand.tasks.front()));
+            strand.tasks.pop_front();
+            m_queueDepth--;
+            m_idleWorkers--;
+            
+            uint64_t startCycles = CycleCounter::Now();
+            m_queueLatency.Record(
+                CycleCounter::ToNanoseconds(startCycles - task.submitCycles));
+            
+            g_mutex_unlock(&m_executorMutex);
+            try
+            {
+                task.function();
+            }
+            catch(...)
+            {
+                LOG_ERROR("Async action executor task threw exception");
+            }
+            uint64_t runCycles = CycleCounter::Now() - startCycles;
+            
+            // Release the task, and anything it holds, before re-locking.
+            task.function = nullptr;
+            g_mutex_lock(&m_executorMutex);
+            
+            m_runLatency.Record(CycleCounter::ToNanoseconds(runCycles));
+            m_completed++;
+            m_idleWorkers++;
+            
+            strand.running = false;
+            if (strand.tasks.empty())
+            {
+                m_strands.erase(key);
+            }
+            else
+            {
+                // Back of the ready queue so that one busy strand cannot 
+                // starve the others.
+                strand.ready = true;
+                m_readyStrands.push_back(key);
+                g_cond_signal(&m_executorCond);
+            }
+        }
+        m_workers--;
+        m_idleWorkers--;
+        
+        g_mutex_unlock(&m_executorMutex);
+    }
+}
@@ -0,0 +1,206 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ASYNC_ACTION_EXECUTOR_H
+#define _DSL_ASYNC_ACTION_EXECUTOR_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslLatencyHistogram.h"
+#include <deque>
+#include <functional>
+
+namespace DSL
+{
+    /**
+     * @class AsyncActionExecutor
+     * @brief Process wide executor for the asynchronous ODE Actions that 
+     * control Pipelines, Players, Branches, Sinks and Sources. Occurrences 
+     * are queued from the streaming threads to a bounded queue, and executed 
+     * by a small pool of worker threads. Tasks submitted with the same key 
+     * form a strand - they execute one at a time, in the order submitted - 
+     * while tasks with different keys may execute concurrently up to the 
+     * maximum number of workers. Submissions beyond the queue capacity are 
+     * rejected so that bursts of events never block the streaming thread.
+     */
+    class AsyncActionExecutor
+    {
+    public:
+
+        /**
+         * @brief Returns the process wide Async Action Executor, creating
+         * it on first call.
+         * @return pointer to the Async Action Executor singleton.
+         */
+        static AsyncActionExecutor* GetExecutor();
+
+        /**
+         * @brief Queues a task for execution by a worker thread. Never blocks
+         * waiting for space in the queue.
+         * @param[in] key unique key of the strand to submit to, typically the 
+         * address of the submitting action.
+         * @param[in] task function to execute.
+         * @return true if queued, false if rejected because the queue is full.
+         */
+        bool Submit(const void* key, const std::function<void()>& task);
+
+        /**
+         * @brief Drops all tasks queued for a strand. A task of the strand
+         * that is currently executing is not waited for.
+         * @param[in] key unique key of the strand to cancel.
+         */
+        void Cancel(const void* key);
+
+        /**
+         * @brief Gets the current executor parameters.
+         * @param[out] maxWorkers maximum number of worker threads.
+         * @param[out] queueCapacity maximum number of queued tasks.
+         */
+        void GetParams(uint* maxWorkers, uint* queueCapacity);
+
+        /**
+         * @brief Sets the executor parameters. Surplus workers exit once 
+         * idle when the maximum number of workers is reduced. Tasks already
+         * queued are unaffected when the queue capacity is reduced.
+         * @param[in] maxWorkers maximum number of worker threads.
+         * @param[in] queueCapacity maximum number of queued tasks.
+         * @return true if valid and set, false otherwise.
+         */
+        bool SetParams(uint maxWorkers, uint queueCapacity);
+
+        /**
+         * @brief Gets the current executor statistics.
+         * @param[out] stats statistics structure to fill in.
+         */
+        void GetStats(dsl_ode_action_executor_stats* stats);
+
+        /**
+         * @brief Clears the accumulated executor statistics. The workers and
+         * queue depth are unaffected and the peak is reset to the queue depth.
+         */
+        void ClearStats();
+
+        /**
+         * @brief Executes queued tasks until the worker is surplus. Called 
+         * by each worker thread on start.
+         */
+        void HandleWorker();
+
+    private:
+
+        /**
+         * @brief private ctor for this singleton class.
+         */
+        AsyncActionExecutor();
+
+        /**
+         * @brief Starts new workers, up to the maximum, until there is an
+         * idle worker for each ready strand. Must be called with 
+         * m_executorMutex locked.
+         */
+        void StartWorkers();
+
+        /**
+         * @struct Task
+         * @brief a task queued for execution.
+         */
+        struct Task
+        {
+            std::function<void()> function;
+            uint64_t submitCycles;
+        };
+
+        /**
+         * @struct Strand
+         * @brief the queued tasks of a single key, executed in order.
+         */
+        struct Strand
+        {
+            std::deque<Task> tasks;
+            bool ready;
+            bool running;
+        };
+
+        /**
+         * @brief mutex protecting all members below.
+         */
+        DslMutex m_executorMutex;
+
+        /**
+         * @brief condition signaled when a strand becomes ready to execute,
+         * or the maximum number of workers is changed.
+         */
+        DslCond m_executorCond;
+
+        /**
+         * @brief maximum number of worker threads.
+         */
+        uint m_maxWorkers;
+
+        /**
+         * @brief maximum number of queued tasks across all strands.
+         */
+        uint m_queueCapacity;
+
+        /**
+         * @brief number of worker threads running, and of those, the number
+         * not currently executing a task.
+         */
+        uint m_workers;
+        uint m_idleWorkers;
+
+        /**
+         * @brief number of tasks queued across all strands.
+         */
+        uint m_queueDepth;
+
+        /**
+         * @brief map of all strands with queued or executing tasks by key.
+         */
+        std::map<const void*, Strand> m_strands;
+
+        /**
+         * @brief keys of all strands ready to execute, in the order they 
+         * became ready.
+         */
+        std::deque<const void*> m_readyStrands;
+
+        /**
+         * @brief accumulated statistics.
+         */
+        uint m_peakQueueDepth;
+        uint64_t m_submitted;
+        uint64_t m_completed;
+        uint64_t m_rejected;
+
+        /**
+         * @brief time from submission to start of execution, and time to
+         * execute, for each task.
+         */
+        LatencyHistogram m_queueLatency;
+        LatencyHistogram m_runLatency;
+    };
+}
+
+#endif // _DSL_ASYNC_ACTION_EXECUTOR_H
@@ -56,6 +56,7 @@ namespace DSL
             , m_requestPadId(-1)
             , m_linkMethod(DSL_PIPELINE_LINK_METHOD_DEFAULT)
             , m_isLinked(false)
+            , m_linkTime(0)
             , m_batchSize(0)
             , m_gpuId(0)
             , m_nvbufMemType(DSL_NVBUF_MEM_TYPE_DEFAULT)
@@ -83,6 +84,7 @@ namespace DSL
             , m_requestPadId(-1)
             , m_linkMethod(DSL_PIPELINE_LINK_METHOD_DEFAULT)
             , m_isLinked(false)
+            , m_linkTime(0)
             , m_batchSize(0)
             , m_gpuId(0)
             , m_nvbufMemType(DSL_NVBUF_MEM_TYPE_DEFAULT)
@@ -207,6 +209,30 @@ namespace DSL
             return m_isLinked;
         }
 
+        /**
+         * @brief Gets the time taken to link this Bintr on its last LinkAll,
+         * including the link to its upstream peer, as measured by its parent.
+         * @return link time in microseconds, 0 if never linked.
+         */
+        uint64_t GetLinkTime()
+        {
+            LOG_FUNC();
+            
+            return m_linkTime;
+        }
+
+        /**
+         * @brief Sets the time taken to link this Bintr. Called by the parent
+         * Bintr once this Bintr has been fully linked.
+         * @param[in] linkTime link time in microseconds.
+         */
+        void SetLinkTime(uint64_t linkTime)
+        {
+            LOG_FUNC();
+            
+            m_linkTime = linkTime;
+        }
+
         /**
          * @brief gets the current batchSize in use by this Bintr
          * @return the current batchSize
@@ -318,6 +344,11 @@ namespace DSL
          */
         bool m_isLinked;
         
+        /**
+         * @brief time in microseconds this Bintr took to link on last LinkAll
+         */
+        uint64_t m_linkTime;
+        
         /**
          * @brief current batch size for this Bintr
          */
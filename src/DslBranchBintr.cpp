@@ -37,6 +37,7 @@ namespace DSL
         , m_nextPrimaryInferBintrIndex(0)
         , m_nextGstBintrIndex(0)
         , m_nextComponentIndex(0)
+        , m_lastLinkTime(0)
     {
         LOG_FUNC();
 
@@ -751,6 +752,12 @@ namespace DSL
                 << "' are already assembled");
             return false;
         }
+        // Pipelines start the clock in PipelineBintr::LinkAll, before linking
+        // their sources, so only true branches start it here.
+        if (!m_isPipeline)
+        {
+            m_lastLinkTime = g_get_monotonic_time();
+        }
         if (!((m_linkMethod == DSL_PIPELINE_LINK_METHOD_BY_POSITION)
             ? LinkAllPositional()
             : LinkAllOrdered()))
@@ -779,6 +786,17 @@ namespace DSL
         return true;
     }
         
+    void BranchBintr::AddLinkedComponent(DSL_BINTR_PTR pChildBintr)
+    {
+        LOG_FUNC();
+        
+        gint64 currentTime = g_get_monotonic_time();
+        pChildBintr->SetLinkTime(currentTime - m_lastLinkTime);
+        m_lastLinkTime = currentTime;
+        
+        m_linkedComponents.push_back(pChildBintr);
+    }
+        
     bool BranchBintr::LinkAllPositional()
     {
         LOG_FUNC();
@@ -800,7 +818,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pRemuxerBintr);
+            AddLinkedComponent(m_pRemuxerBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up Stream Remuxer '" 
                 << m_pRemuxerBintr->GetName() << "' successfully");
         }
@@ -816,7 +834,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pPreprocBintr);
+            AddLinkedComponent(m_pPreprocBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up PreprocBintr '" 
                 << m_pPreprocBintr->GetName() << "' successfully");
         }
@@ -845,7 +863,7 @@ namespace DSL
                 {
                     return false;
                 }
-                m_linkedComponents.push_back(imap.second);
+                AddLinkedComponent(imap.second);
  
                 LOG_INFO("Branch '" << GetName() << "' Linked up Primary Infer Bin '" 
                     << imap.second->GetName() << "' successfully");                    
@@ -865,7 +883,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pTrackerBintr);
+            AddLinkedComponent(m_pTrackerBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up Tracker '" 
                 << m_pTrackerBintr->GetName() << "' successfully");
         }
@@ -884,7 +902,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pSecondaryInfersBintr);
+            AddLinkedComponent(m_pSecondaryInfersBintr);
             LOG_INFO("Branch '" << GetName() 
                 << "' Linked up all Secondary Inference Bins '" 
                 << m_pSecondaryInfersBintr->GetName() << "' successfully");
@@ -904,7 +922,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pSegVisualBintr);
+            AddLinkedComponent(m_pSegVisualBintr);
             LOG_INFO("Branch '" << GetName() 
                 << "' Linked up Segmentation Visualizer '" 
                 << m_pSegVisualBintr->GetName() << "' successfully");
@@ -924,7 +942,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pOfvBintr);
+            AddLinkedComponent(m_pOfvBintr);
             LOG_INFO("Branch '" << GetName() 
                 << "' Linked up Optical Flow Detector '" 
                 << m_pOfvBintr->GetName() << "' successfully");
@@ -944,7 +962,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pTilerBintr);
+            AddLinkedComponent(m_pTilerBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up Tiler '" 
                 << m_pTilerBintr->GetName() << "' successfully");
         }
@@ -963,7 +981,7 @@ namespace DSL
                 {
                     return false;
                 }
-                m_linkedComponents.push_back(imap.second);
+                AddLinkedComponent(imap.second);
  
                 LOG_INFO("Branch '" << GetName() << "' Linked up GST Bin '" 
                     << imap.second->GetName() << "' successfully");                    
@@ -983,7 +1001,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pOsdBintr);
+            AddLinkedComponent(m_pOsdBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up OSD '" 
                 << m_pOsdBintr->GetName() << "' successfully");
         }
@@ -1002,7 +1020,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pDemuxerBintr);
+            AddLinkedComponent(m_pDemuxerBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up Stream Demuxer '" 
                 << m_pDemuxerBintr->GetName() << "' successfully");
         }
@@ -1021,7 +1039,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pSplitterBintr);
+            AddLinkedComponent(m_pSplitterBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up Stream Splitter'" 
                 << m_pSplitterBintr->GetName() << "' successfully");
         }
@@ -1041,7 +1059,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pMultiSinksBintr);
+            AddLinkedComponent(m_pMultiSinksBintr);
             LOG_INFO("Branch '" << GetName() << "' Linked up all Sinks '" 
                 << m_pMultiSinksBintr->GetName() << "' successfully");
         }
@@ -1069,7 +1087,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(imap.second);
+            AddLinkedComponent(imap.second);
             LOG_INFO("Branch '" << GetName() << "' Linked up Component '" 
                 << imap.second->GetName() << "' successfully");
         }
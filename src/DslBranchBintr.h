@@ -271,6 +271,19 @@ namespace DSL
         bool LinkAllOrdered();
 
     protected:
+
+        /**
+         * @brief adds a fully linked Child Bintr to the vector of linked 
+         * components, setting the Child's link time since the previous add.
+         * @param[in] pChildBintr Child Bintr to add.
+         */
+        void AddLinkedComponent(DSL_BINTR_PTR pChildBintr);
+        
+        /**
+         * @brief monotonic time, in microseconds, of the last linked-component
+         * add, or the start of the current LinkAll.
+         */
+        gint64 m_lastLinkTime;
     
         /**
          * @brief Index variable to incremment/assign on component add.
@@ -0,0 +1,307 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslCallbackDispatcher.h"
+
+namespace DSL
+{
+    static gpointer CallbackDispatcherThread(gpointer pListener)
+    {
+        CallbackDispatcher::GetDispatcher()->HandleListener(pListener);
+        return NULL;
+    }
+
+    CallbackDispatcher* CallbackDispatcher::GetDispatcher()
+    {
+        // Created on first use and intentionally never destroyed, as owners 
+        // may still remove their listeners during process exit.
+        static CallbackDispatcher* pInstance = new CallbackDispatcher();
+        
+        return pInstance;
+    }
+
+    CallbackDispatcher::CallbackDispatcher()
+        : m_queueCapacity(DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY)
+        , m_slowThreshold(DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS)
+    {
+        LOG_FUNC();
+    }
+
+    bool CallbackDispatcher::Dispatch(const void* pOwner, const void* pListener, 
+        const std::string& name, const std::function<void()>& notification, 
+        bool coalesce)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        Listener*& pListenerEntry = m_listeners[std::make_pair(pOwner, pListener)];
+        if (!pListenerEntry)
+        {
+            pListenerEntry = new Listener(name);
+        }
+        Listener* pEntry = pListenerEntry;
+        
+        if (coalesce and pEntry->notifications.size() and 
+            pEntry->notifications.back().coalesce)
+        {
+            // Keep the original submit time so the queue latency reflects
+            // the time the listener has been waiting.
+            pEntry->notifications.back().function = notification;
+            pEntry->coalesced++;
+            return true;
+        }
+        if (pEntry->notifications.size() >= m_queueCapacity)
+        {
+            // Overflows are counted, not logged, as they come in storms.
+            pEntry->overflows++;
+            return false;
+        }
+        pEntry->notifications.push_back(
+            Notification{notification, coalesce, CycleCounter::Now()});
+        pEntry->peakQueueDepth = std::max(pEntry->peakQueueDepth, 
+            (uint)pEntry->notifications.size());
+        pEntry->dispatched++;
+        
+        if (pEntry->workerRunning)
+        {
+            g_cond_signal(&pEntry->notificationCond);
+        }
+        else
+        {
+            pEntry->workerRunning = true;
+            g_thread_unref(g_thread_new("dsl-callback", 
+                CallbackDispatcherThread, pEntry));
+        }
+        return true;
+    }
+
+    void CallbackDispatcher::RemoveListener(const void* pOwner, 
+        const void* pListener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        auto iter = m_listeners.find(std::make_pair(pOwner, pListener));
+        if (iter != m_listeners.end())
+        {
+            RemoveListener(iter);
+        }
+    }
+
+    void CallbackDispatcher::RemoveAllListeners(const void* pOwner)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        // The map may change while waiting on a callback in progress, so
+        // the next listener is found again after each removal.
+        auto iter = m_listeners.lower_bound(
+            std::make_pair(pOwner, (const void*)NULL));
+        while (iter != m_listeners.end() and iter->first.first == pOwner)
+        {
+            RemoveListener(iter);
+            iter = m_listeners.lower_bound(
+                std::make_pair(pOwner, (const void*)NULL));
+        }
+    }
+
+    void CallbackDispatcher::RemoveListener(ListenerMap::iterator iter)
+    {
+        Listener* pEntry = iter->second;
+        m_listeners.erase(iter);
+        
+        if (!pEntry->workerRunning)
+        {
+            delete pEntry;
+            return;
+        }
+        
+        // A running worker deletes its listener on exit, once no remover
+        // is waiting on it.
+        pEntry->removed = true;
+        pEntry->notifications.clear();
+        g_cond_signal(&pEntry->notificationCond);
+        
+        // A callback that removes its own listener can't wait on itself.
+        if (!pEntry->pCallbackThread or 
+            pEntry->pCallbackThread == g_thread_self())
+        {
+            return;
+        }
+        pEntry->removeWaiters++;
+        while (pEntry->pCallbackThread)
+        {
+            g_cond_wait(&m_callbackDoneCond, &m_dispatcherMutex);
+        }
+        if (!--pEntry->removeWaiters and !pEntry->workerRunning)
+        {
+            delete pEntry;
+        }
+    }
+
+    void CallbackDispatcher::GetParams(uint* queueCapacity, uint* slowThreshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        *queueCapacity = m_queueCapacity;
+        *slowThreshold = m_slowThreshold;
+    }
+
+    bool CallbackDispatcher::SetParams(uint queueCapacity, uint slowThreshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        if (!queueCapacity or !slowThreshold)
+        {
+            LOG_ERROR("Invalid callback dispatcher params: Queue Capacity = "
+                << queueCapacity << ", Slow Threshold = " << slowThreshold);
+            return false;
+        }
+        m_queueCapacity = queueCapacity;
+        m_slowThreshold = slowThreshold;
+        
+        return true;
+    }
+
+    const std::vector<dsl_callback_listener_stats>& CallbackDispatcher::GetStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        m_stats.clear();
+        m_statsNames.clear();
+        
+        for (auto const& imap: m_listeners)
+        {
+            Listener* pEntry = imap.second;
+            m_statsNames.push_back(std::wstring(pEntry->name.begin(), 
+                pEntry->name.end()));
+            
+            dsl_callback_listener_stats stats{0};
+            stats.queue_depth = pEntry->notifications.size();
+            stats.peak_queue_depth = pEntry->peakQueueDepth;
+            stats.dispatched = pEntry->dispatched;
+            stats.coalesced = pEntry->coalesced;
+            stats.overflows = pEntry->overflows;
+            stats.slow_count = pEntry->slowCount;
+            pEntry->queueLatency.GetStats(&stats.queue_latency);
+            pEntry->runLatency.GetStats(&stats.run_latency);
+            m_stats.push_back(stats);
+        }
+        // Names are set once the vector of names is complete and stable.
+        for (uint i = 0; i < m_stats.size(); i++)
+        {
+            m_stats[i].name = m_statsNames[i].c_str();
+        }
+        return m_stats;
+    }
+
+    void CallbackDispatcher::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        for (auto const& imap: m_listeners)
+        {
+            Listener* pEntry = imap.second;
+            pEntry->peakQueueDepth = pEntry->notifications.size();
+            pEntry->dispatched = 0;
+            pEntry->coalesced = 0;
+            pEntry->overflows = 0;
+            pEntry->slowCount = 0;
+            pEntry->queueLatency.Clear();
+            pEntry->runLatency.Clear();
+        }
+    }
+
+    void CallbackDispatcher::HandleListener(void* pListener)
+    {
+        Listener* pEntry = static_cast<Listener*>(pListener);
+        
+        g_mutex_lock(&m_dispatcherMutex);
+        
+        while (!pEntry->removed)
+        {
+            if (pEntry->notifications.empty())
+            {
+                gint64 endTime = g_get_monotonic_time() + 
+                    DSL_CALLBACK_DISPATCHER_IDLE_TIMEOUT_MS*G_TIME_SPAN_MILLISECOND;
+                if (!g_cond_wait_until(&pEntry->notificationCond, 
+                    &m_dispatcherMutex, endTime) and 
+                    pEntry->notifications.empty())
+                {
+                    break;
+                }
+                continue;
+            }
+            Notification notification(std::move(pEntry->notifications.front()));
+            pEntry->notifications.pop_front();
+            
+            uint64_t startCycles = CycleCounter::Now();
+            pEntry->queueLatency.Record(CycleCounter::ToNanoseconds(
+                startCycles - notification.submitCycles));
+            
+            pEntry->pCallbackThread = g_thread_self();
+            g_mutex_unlock(&m_dispatcherMutex);
+            try
+            {
+                notification.function();
+            }
+            catch(...)
+            {
+                LOG_ERROR("Client listener '" << pEntry->name 
+                    << "' threw an exception");
+            }
+            uint64_t runTime = CycleCounter::ToNanoseconds(
+                CycleCounter::Now() - startCycles);
+            
+            // Release the notification, and anything it holds, before re-locking.
+            notification.function = nullptr;
+            g_mutex_lock(&m_dispatcherMutex);
+            
+            pEntry->pCallbackThread = NULL;
+            g_cond_broadcast(&m_callbackDoneCond);
+            
+            pEntry->runLatency.Record(runTime);
+            if (runTime > (uint64_t)m_slowThreshold*1000000)
+            {
+                // Warn on the first slow callback since creation or clear.
+                if (!pEntry->slowCount++)
+                {
+                    LOG_WARN("Client listener '" << pEntry->name 
+                        << "' is slow, callback took " << runTime/1000000 
+                        << " ms and is delaying its own notifications");
+                }
+            }
+        }
+        pEntry->workerRunning = false;
+        if (pEntry->removed and !pEntry->removeWaiters)
+        {
+            delete pEntry;
+        }
+        g_mutex_unlock(&m_dispatcherMutex);
+    }
+}
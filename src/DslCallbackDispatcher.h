@@ -0,0 +1,246 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_CALLBACK_DISPATCHER_H
+#define _DSL_CALLBACK_DISPATCHER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslLatencyHistogram.h"
+#include <deque>
+#include <functional>
+
+namespace DSL
+{
+    /**
+     * @brief time a listener's worker thread waits for a new notification
+     * before exiting. A new worker is started on the next notification.
+     */
+    #define DSL_CALLBACK_DISPATCHER_IDLE_TIMEOUT_MS                     1000
+
+    /**
+     * @class CallbackDispatcher
+     * @brief Process wide dispatcher for client listener notifications. Each
+     * listener - identified by its owner and callback function - has its own 
+     * bounded queue and its own worker thread, so that a slow client callback
+     * only delays its own notifications. Notifications of a listener are 
+     * delivered one at a time, in order. A coalescable notification replaces
+     * the listener's most recent queued notification if also coalescable, so
+     * that storms of state changes deliver the latest state only.
+     */
+    class CallbackDispatcher
+    {
+    public:
+
+        /**
+         * @brief Returns the process wide Callback Dispatcher, creating it 
+         * on first call.
+         * @return pointer to the Callback Dispatcher singleton.
+         */
+        static CallbackDispatcher* GetDispatcher();
+
+        /**
+         * @brief Queues a notification for delivery to a client listener. 
+         * Never blocks waiting for the listener.
+         * @param[in] pOwner object that owns the listener, typically the 
+         * component that the listener was added to.
+         * @param[in] pListener client callback function of the listener.
+         * @param[in] name name of the listener used for stats and logging.
+         * @param[in] notification function that calls the client callback. 
+         * Must capture all data by value.
+         * @param[in] coalesce true if the notification may replace the 
+         * listener's most recent queued notification.
+         * @return true if queued or coalesced, false if dropped because the
+         * listener's queue is full.
+         */
+        bool Dispatch(const void* pOwner, const void* pListener, 
+            const std::string& name, const std::function<void()>& notification, 
+            bool coalesce);
+
+        /**
+         * @brief Removes a listener, dropping all of its queued notifications.
+         * If the listener's callback is in progress on its worker thread, the
+         * call waits for the callback to return, so that the client's data 
+         * can be freed once removed. A callback that removes its own listener
+         * is not waited for. Must not be called while holding a lock that the
+         * listener's callback may take.
+         * @param[in] pOwner object that owns the listener.
+         * @param[in] pListener client callback function of the listener.
+         */
+        void RemoveListener(const void* pOwner, const void* pListener);
+
+        /**
+         * @brief Removes all listeners of an owner, waiting for callbacks in 
+         * progress as RemoveListener does. Called on owner destruction.
+         * @param[in] pOwner object that owns the listeners to remove.
+         */
+        void RemoveAllListeners(const void* pOwner);
+
+        /**
+         * @brief Gets the current dispatcher parameters.
+         * @param[out] queueCapacity maximum number of queued notifications
+         * per listener.
+         * @param[out] slowThreshold callback time in milliseconds above which
+         * a listener is counted as slow.
+         */
+        void GetParams(uint* queueCapacity, uint* slowThreshold);
+
+        /**
+         * @brief Sets the dispatcher parameters.
+         * @param[in] queueCapacity maximum number of queued notifications
+         * per listener.
+         * @param[in] slowThreshold callback time in milliseconds above which
+         * a listener is counted as slow.
+         * @return true if valid and set, false otherwise.
+         */
+        bool SetParams(uint queueCapacity, uint slowThreshold);
+
+        /**
+         * @brief Gets the current statistics for all listeners.
+         * @return vector of listener stats, owned by the dispatcher and 
+         * valid until the next call.
+         */
+        const std::vector<dsl_callback_listener_stats>& GetStats();
+
+        /**
+         * @brief Clears the accumulated statistics for all listeners. The
+         * queue depths are unaffected and the peaks reset to the queue depths.
+         */
+        void ClearStats();
+
+        /**
+         * @brief Delivers the queued notifications of a single listener until
+         * idle or removed. Called by each listener's worker thread on start.
+         * @param[in] pListener listener to deliver the notifications of.
+         */
+        void HandleListener(void* pListener);
+
+    private:
+
+        /**
+         * @brief private ctor for this singleton class.
+         */
+        CallbackDispatcher();
+
+        /**
+         * @struct Notification
+         * @brief a notification queued for delivery.
+         */
+        struct Notification
+        {
+            std::function<void()> function;
+            bool coalesce;
+            uint64_t submitCycles;
+        };
+
+        /**
+         * @struct Listener
+         * @brief the queue, worker state, and stats of a single listener.
+         */
+        struct Listener
+        {
+            Listener(const std::string& listenerName)
+                : name(listenerName)
+                , workerRunning(false)
+                , removed(false)
+                , pCallbackThread(NULL)
+                , removeWaiters(0)
+                , peakQueueDepth(0)
+                , dispatched(0)
+                , coalesced(0)
+                , overflows(0)
+                , slowCount(0)
+            {};
+            
+            std::string name;
+            std::deque<Notification> notifications;
+            DslCond notificationCond;
+            bool workerRunning;
+            bool removed;
+            
+            // worker thread while in the client callback, NULL otherwise.
+            GThread* pCallbackThread;
+            
+            // removers waiting for the callback to return. The listener is
+            // deleted by the last of the worker and the waiting removers.
+            uint removeWaiters;
+            uint peakQueueDepth;
+            uint64_t dispatched;
+            uint64_t coalesced;
+            uint64_t overflows;
+            uint64_t slowCount;
+            LatencyHistogram queueLatency;
+            LatencyHistogram runLatency;
+        };
+
+        /**
+         * @brief map of listeners keyed by owner and callback function.
+         */
+        typedef std::map<std::pair<const void*, const void*>, 
+            Listener*> ListenerMap;
+
+        /**
+         * @brief Removes a listener found in m_listeners and waits for its 
+         * callback in progress, if any. Must be called with m_dispatcherMutex
+         * locked, which is released while waiting.
+         * @param[in] iter iterator of the listener to remove.
+         */
+        void RemoveListener(ListenerMap::iterator iter);
+
+        /**
+         * @brief mutex protecting all members below, and all listeners.
+         */
+        DslMutex m_dispatcherMutex;
+
+        /**
+         * @brief signaled each time a client callback returns.
+         */
+        DslCond m_callbackDoneCond;
+
+        /**
+         * @brief maximum number of queued notifications per listener.
+         */
+        uint m_queueCapacity;
+
+        /**
+         * @brief callback time in milliseconds above which a listener 
+         * is counted as slow.
+         */
+        uint m_slowThreshold;
+
+        /**
+         * @brief map of all listeners by owner and callback function.
+         */
+        ListenerMap m_listeners;
+
+        /**
+         * @brief stats and listener names returned by the last call to
+         * GetStats.
+         */
+        std::vector<dsl_callback_listener_stats> m_stats;
+        std::vector<std::wstring> m_statsNames;
+    };
+}
+
+#endif // _DSL_CALLBACK_DISPATCHER_H
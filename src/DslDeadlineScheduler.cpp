@@ -0,0 +1,436 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslDeadlineScheduler.h"
+
+namespace DSL
+{
+    /**
+     * @brief resolution of the timing wheel in nanoseconds.
+     */
+    static const uint64_t DEADLINE_SCHEDULER_TICK_NS = 
+        (uint64_t)DSL_DEADLINE_SCHEDULER_TICK_MS*1000000;
+
+    struct DeadlineWatch
+    {
+        /**
+         * @brief unique id for this watch.
+         */
+        uint id;
+
+        /**
+         * @brief producer written last-activity timestamp in nanoseconds.
+         */
+        const std::atomic<uint64_t>* pTimestamp;
+
+        /**
+         * @brief watch timeout in nanoseconds.
+         */
+        uint64_t timeout;
+
+        /**
+         * @brief client handler and data to call on missed deadline.
+         */
+        GSourceFunc handler;
+        gpointer clientData;
+        
+        /**
+         * @brief owner of the watch, resolved to its Pipeline's main-context
+         * on each dispatch.
+         */
+        GstObject* pOwner;
+
+        /**
+         * @brief monotonic time the watch was (re)armed in nanoseconds.
+         */
+        uint64_t armTime;
+
+        /**
+         * @brief wheel position, valid while linked.
+         */
+        uint slot;
+        uint rounds;
+        bool linked;
+
+        /**
+         * @brief idle source held while a missed deadline is pending dispatch.
+         */
+        MainContextSource idleSource;
+
+        /**
+         * @brief intrusive links for the slot's list.
+         */
+        DeadlineWatch* pPrev;
+        DeadlineWatch* pNext;
+    };
+
+    static gpointer DeadlineSchedulerThread(gpointer pScheduler)
+    {
+        static_cast<DeadlineScheduler*>(pScheduler)->HandleWheel();
+        return NULL;
+    }
+
+    DeadlineScheduler* DeadlineScheduler::GetScheduler()
+    {
+        // Created on first use and intentionally never destroyed, as watches 
+        // may still be removed by other singletons during process exit.
+        static DeadlineScheduler* pInstance = new DeadlineScheduler();
+        
+        return pInstance;
+    }
+
+    uint64_t DeadlineScheduler::Now()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        
+        return (uint64_t)now.tv_sec*1000000000 + now.tv_nsec;
+    }
+
+    DeadlineScheduler::DeadlineScheduler()
+        : m_pSchedulerThread(NULL)
+        , m_wheel(DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS, NULL)
+        , m_currentSlot(0)
+        , m_currentTickTime(Now())
+        , m_linkedWatches(0)
+        , m_lastWatchId(0)
+        , m_missedCount(0)
+        , m_stopping(false)
+    {
+        LOG_FUNC();
+        
+        m_pSchedulerThread = g_thread_new("dsl-deadline-scheduler", 
+            DeadlineSchedulerThread, this);
+        
+        LOG_INFO("Deadline scheduler created with " 
+            << DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS << " slots of " 
+            << DSL_DEADLINE_SCHEDULER_TICK_MS << " ms");
+    }
+
+    DeadlineScheduler::~DeadlineScheduler()
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+            m_stopping = true;
+            g_cond_broadcast(&m_schedulerCond);
+        }
+        g_thread_join(m_pSchedulerThread);
+        
+        for (auto &imap: m_watches)
+        {
+            imap.second->idleSource.Remove();
+            delete imap.second;
+        }
+    }
+
+    uint DeadlineScheduler::AddWatch(const std::atomic<uint64_t>* pTimestamp, 
+        uint timeout, GSourceFunc handler, gpointer clientData, GstObject* pOwner)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        if (!pTimestamp or !handler)
+        {
+            LOG_ERROR("Invalid timestamp or handler for new deadline watch");
+            return 0;
+        }
+        // Skip 0 on wrap-around as it is reserved for "no watch".
+        if (!++m_lastWatchId)
+        {
+            ++m_lastWatchId;
+        }
+        DeadlineWatch* pWatch = new DeadlineWatch{m_lastWatchId, pTimestamp, 
+            (uint64_t)timeout*1000000, handler, clientData, pOwner, Now(), 
+            0, 0, false, {}, NULL, NULL};
+            
+        m_watches[pWatch->id] = pWatch;
+        
+        InsertWatch(pWatch, std::max(pTimestamp->load(std::memory_order_acquire), 
+            pWatch->armTime) + pWatch->timeout);
+        
+        LOG_DEBUG("Deadline watch " << pWatch->id << " added with timeout of " 
+            << timeout << " ms");
+        return pWatch->id;
+    }
+
+    bool DeadlineScheduler::RemoveWatch(uint watchId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        auto imap = m_watches.find(watchId);
+        if (imap == m_watches.end())
+        {
+            return false;
+        }
+        DeadlineWatch* pWatch = imap->second;
+        
+        UnlinkWatch(pWatch);
+        pWatch->idleSource.Remove();
+        m_watches.erase(imap);
+        delete pWatch;
+        
+        LOG_DEBUG("Deadline watch " << watchId << " removed");
+        return true;
+    }
+
+    bool DeadlineScheduler::SetWatchTimeout(uint watchId, uint timeout)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        auto imap = m_watches.find(watchId);
+        if (imap == m_watches.end())
+        {
+            return false;
+        }
+        DeadlineWatch* pWatch = imap->second;
+        pWatch->timeout = (uint64_t)timeout*1000000;
+        
+        // Re-slot the watch now in case the deadline was brought forward. A
+        // watch pending dispatch will pick up the new timeout when re-armed.
+        if (pWatch->linked)
+        {
+            UnlinkWatch(pWatch);
+            InsertWatch(pWatch, std::max(
+                pWatch->pTimestamp->load(std::memory_order_acquire), 
+                pWatch->armTime) + pWatch->timeout);
+        }
+        return true;
+    }
+
+    uint DeadlineScheduler::GetNumWatches()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        return m_watches.size();
+    }
+
+    uint64_t DeadlineScheduler::GetMissedCount()
+    {
+        LOG_FUNC();
+        
+        return m_missedCount;
+    }
+
+    void DeadlineScheduler::InsertWatch(DeadlineWatch* pWatch, uint64_t deadline)
+    {
+        // Restart the wheel's clock if it has been idle.
+        if (!m_linkedWatches)
+        {
+            m_currentTickTime = Now();
+        }
+        uint64_t ticks = (deadline > m_currentTickTime)
+            ? (deadline - m_currentTickTime + DEADLINE_SCHEDULER_TICK_NS - 1) /
+                DEADLINE_SCHEDULER_TICK_NS
+            : 1;
+        if (!ticks)
+        {
+            ticks = 1;
+        }
+        pWatch->slot = (m_currentSlot + ticks) % DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS;
+        pWatch->rounds = (ticks - 1) / DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS;
+        pWatch->linked = true;
+        
+        pWatch->pPrev = NULL;
+        pWatch->pNext = m_wheel[pWatch->slot];
+        if (pWatch->pNext)
+        {
+            pWatch->pNext->pPrev = pWatch;
+        }
+        m_wheel[pWatch->slot] = pWatch;
+        m_linkedWatches++;
+        
+        // Wake the scheduler thread so it can recalculate its sleep time.
+        g_cond_signal(&m_schedulerCond);
+    }
+
+    void DeadlineScheduler::UnlinkWatch(DeadlineWatch* pWatch)
+    {
+        if (!pWatch->linked)
+        {
+            return;
+        }
+        if (pWatch->pPrev)
+        {
+            pWatch->pPrev->pNext = pWatch->pNext;
+        }
+        else
+        {
+            m_wheel[pWatch->slot] = pWatch->pNext;
+        }
+        if (pWatch->pNext)
+        {
+            pWatch->pNext->pPrev = pWatch->pPrev;
+        }
+        pWatch->pPrev = pWatch->pNext = NULL;
+        pWatch->linked = false;
+        m_linkedWatches--;
+    }
+
+    void DeadlineScheduler::ProcessSlot(uint64_t now)
+    {
+        DeadlineWatch* pWatch = m_wheel[m_currentSlot];
+        while (pWatch)
+        {
+            DeadlineWatch* pNext = pWatch->pNext;
+            
+            if (pWatch->rounds)
+            {
+                pWatch->rounds--;
+                pWatch = pNext;
+                continue;
+            }
+            UnlinkWatch(pWatch);
+            
+            // Activity since the watch was queued moves the deadline forward,
+            // in which case the watch is simply re-queued.
+            uint64_t deadline = std::max(
+                pWatch->pTimestamp->load(std::memory_order_acquire), 
+                pWatch->armTime) + pWatch->timeout;
+            if (deadline > now)
+            {
+                InsertWatch(pWatch, deadline);
+            }
+            else
+            {
+                m_missedCount.fetch_add(1, std::memory_order_relaxed);
+                pWatch->idleSource.AddIdle(pWatch->pOwner, 
+                    DeadlineMissedHandler, GUINT_TO_POINTER(pWatch->id));
+            }
+            pWatch = pNext;
+        }
+    }
+
+    uint DeadlineScheduler::TicksToNextOccupiedSlot()
+    {
+        if (!m_linkedWatches)
+        {
+            return 0;
+        }
+        for (uint i = 1; i <= DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS; i++)
+        {
+            if (m_wheel[(m_currentSlot + i) % DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS])
+            {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void DeadlineScheduler::HandleWheel()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        while (!m_stopping)
+        {
+            uint ticks = TicksToNextOccupiedSlot();
+            if (!ticks)
+            {
+                g_cond_wait(&m_schedulerCond, &m_schedulerMutex);
+                continue;
+            }
+            uint64_t wakeTime = m_currentTickTime + ticks*DEADLINE_SCHEDULER_TICK_NS;
+            uint64_t now = Now();
+            if (now < wakeTime)
+            {
+                // g_get_monotonic_time is based on the same CLOCK_MONOTONIC. 
+                // Re-evaluate on wake, a new watch may now be due sooner.
+                g_cond_wait_until(&m_schedulerCond, &m_schedulerMutex, 
+                    wakeTime/1000);
+                continue;
+            }
+            // Advance the wheel one tick at a time up to the current time.
+            while (m_currentTickTime + DEADLINE_SCHEDULER_TICK_NS <= now)
+            {
+                m_currentTickTime += DEADLINE_SCHEDULER_TICK_NS;
+                m_currentSlot = (m_currentSlot + 1) % 
+                    DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS;
+                ProcessSlot(now);
+            }
+        }
+    }
+
+    void DeadlineScheduler::HandleDeadlineMissed(uint watchId)
+    {
+        GSourceFunc handler;
+        gpointer clientData;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+            
+            auto imap = m_watches.find(watchId);
+            if (imap == m_watches.end())
+            {
+                return;
+            }
+            imap->second->idleSource.Clear();
+            handler = imap->second->handler;
+            clientData = imap->second->clientData;
+        }
+        
+        // Call the client outside of the lock so that it is free to 
+        // add, update, or remove watches, including its own.
+        int rearm(false);
+        try
+        {
+            rearm = handler(clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Deadline watch " << watchId 
+                << " handler threw an exception");
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        auto imap = m_watches.find(watchId);
+        if (imap == m_watches.end())
+        {
+            return;
+        }
+        DeadlineWatch* pWatch = imap->second;
+        if (rearm)
+        {
+            pWatch->armTime = Now();
+            InsertWatch(pWatch, pWatch->armTime + pWatch->timeout);
+        }
+        else
+        {
+            m_watches.erase(imap);
+            delete pWatch;
+        }
+    }
+
+    static int DeadlineMissedHandler(gpointer pWatchId)
+    {
+        DeadlineScheduler::GetScheduler()->HandleDeadlineMissed(
+            GPOINTER_TO_UINT(pWatchId));
+        
+        // single shot, the watch is re-armed by the scheduler if required.
+        return false;
+    }
+}
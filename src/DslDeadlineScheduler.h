@@ -0,0 +1,245 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_DEADLINE_SCHEDULER_H
+#define _DSL_DEADLINE_SCHEDULER_H
+
+#include "Dsl.h"
+#include "DslMainContext.h"
+#include <atomic>
+
+namespace DSL
+{
+    /**
+     * @brief resolution of the Deadline Scheduler's timing wheel.
+     */
+    #define DSL_DEADLINE_SCHEDULER_TICK_MS                              10
+
+    /**
+     * @brief number of slots in the timing wheel. Deadlines further out
+     * than one revolution (slots * tick) are held over for a number of rounds.
+     */
+    #define DSL_DEADLINE_SCHEDULER_WHEEL_SLOTS                          256
+
+    /**
+     * @struct DeadlineWatch
+     * @brief a single registered watch, linked into one slot of the wheel.
+     */
+    struct DeadlineWatch;
+
+    /**
+     * @class DeadlineScheduler
+     * @brief Process wide scheduler that watches any number of "last-activity"
+     * timestamps with a single timing wheel serviced by one dedicated thread.
+     * The timestamps are written by their producers (e.g. a streaming thread)
+     * with a single atomic store. The scheduler only evaluates a watch when its
+     * deadline expires, re-queues it lazily if activity has moved the deadline
+     * forward, and calls the client's handler - from the main-context of the
+     * owner's Pipeline - only when the deadline has actually been missed.
+     */
+    class DeadlineScheduler
+    {
+    public:
+
+        /**
+         * @brief Returns the process wide Deadline Scheduler, creating it
+         * and starting its thread on first call.
+         * @return pointer to the Deadline Scheduler singleton.
+         */
+        static DeadlineScheduler* GetScheduler();
+
+        /**
+         * @brief Returns the current value of the monotonic clock used by
+         * all watches.
+         * @return current monotonic time in nanoseconds.
+         */
+        static uint64_t Now();
+
+        /**
+         * @brief dtor for the DeadlineScheduler class. Stops and joins the
+         * scheduler thread and frees all remaining watches.
+         */
+        ~DeadlineScheduler();
+
+        /**
+         * @brief Adds a new watch to the scheduler. The watch's deadline is
+         * the later of the watched timestamp and the time the watch was armed,
+         * plus the timeout.
+         * @param[in] pTimestamp pointer to the monotonic timestamp (ns) to watch,
+         * a value of 0 means no activity has been recorded yet.
+         * @param[in] timeout timeout for the watch in milliseconds.
+         * @param[in] handler function to call on the main-loop when the deadline
+         * is missed. Return true to re-arm the watch from the current time, 
+         * false to remove it.
+         * @param[in] clientData opaque pointer to pass back to the handler.
+         * @param[in] pOwner GST object of the owning component used to find
+         * the main-context to call the handler on, NULL for the default. The
+         * owner must remain valid until the watch is removed.
+         * @return unique non-zero watch id on success, 0 otherwise.
+         */
+        uint AddWatch(const std::atomic<uint64_t>* pTimestamp, uint timeout,
+            GSourceFunc handler, gpointer clientData, GstObject* pOwner);
+
+        /**
+         * @brief Removes a watch previously added with AddWatch.
+         * @param[in] watchId unique id of the watch to remove.
+         * @return true if the watch was found and removed, false otherwise.
+         */
+        bool RemoveWatch(uint watchId);
+
+        /**
+         * @brief Updates the timeout for a watch previously added with AddWatch.
+         * @param[in] watchId unique id of the watch to update.
+         * @param[in] timeout new timeout for the watch in milliseconds.
+         * @return true if the watch was found and updated, false otherwise.
+         */
+        bool SetWatchTimeout(uint watchId, uint timeout);
+
+        /**
+         * @brief Gets the number of watches currently held by the scheduler.
+         * @return current watch count.
+         */
+        uint GetNumWatches();
+
+        /**
+         * @brief Gets the total number of missed deadlines dispatched by the
+         * scheduler, for diagnostics and testing.
+         * @return accumulated missed-deadline count.
+         */
+        uint64_t GetMissedCount();
+
+        /**
+         * @brief Scheduler thread function, loops advancing the wheel until stopped.
+         */
+        void HandleWheel();
+
+        /**
+         * @brief Dispatches a missed deadline to the watch's handler. Called
+         * on the main-context of the watch's owner.
+         * @param[in] watchId unique id of the watch that missed its deadline.
+         */
+        void HandleDeadlineMissed(uint watchId);
+
+    private:
+
+        /**
+         * @brief private ctor for this singleton class.
+         */
+        DeadlineScheduler();
+
+        /**
+         * @brief inserts a watch into the slot of the wheel for its current 
+         * deadline. Must be called with m_schedulerMutex locked.
+         * @param[in] pWatch watch to insert.
+         * @param[in] deadline absolute monotonic deadline in nanoseconds.
+         */
+        void InsertWatch(DeadlineWatch* pWatch, uint64_t deadline);
+
+        /**
+         * @brief unlinks a watch from its wheel slot if currently linked.
+         * Must be called with m_schedulerMutex locked.
+         * @param[in] pWatch watch to unlink.
+         */
+        void UnlinkWatch(DeadlineWatch* pWatch);
+
+        /**
+         * @brief evaluates all due watches in the current slot, re-queuing the 
+         * watches whose deadline has moved forward and dispatching the rest.
+         * Must be called with m_schedulerMutex locked.
+         * @param[in] now current monotonic time in nanoseconds.
+         */
+        void ProcessSlot(uint64_t now);
+
+        /**
+         * @brief calculates the number of ticks until the next occupied slot.
+         * Must be called with m_schedulerMutex locked.
+         * @return number of ticks, 0 if the wheel is empty.
+         */
+        uint TicksToNextOccupiedSlot();
+
+        /**
+         * @brief mutex protecting the wheel and all watches.
+         */
+        DslMutex m_schedulerMutex;
+
+        /**
+         * @brief condition signaled when a watch is inserted, or on stop.
+         */
+        DslCond m_schedulerCond;
+
+        /**
+         * @brief scheduler thread created with g_thread_new.
+         */
+        GThread* m_pSchedulerThread;
+
+        /**
+         * @brief map of all current watches by unique id.
+         */
+        std::map<uint, DeadlineWatch*> m_watches;
+
+        /**
+         * @brief head of the intrusive list of watches for each wheel slot.
+         */
+        std::vector<DeadlineWatch*> m_wheel;
+
+        /**
+         * @brief index of the wheel slot for the current tick.
+         */
+        uint m_currentSlot;
+
+        /**
+         * @brief monotonic time of the current tick in nanoseconds.
+         */
+        uint64_t m_currentTickTime;
+
+        /**
+         * @brief number of watches currently linked into the wheel.
+         */
+        uint m_linkedWatches;
+
+        /**
+         * @brief last assigned unique watch id.
+         */
+        uint m_lastWatchId;
+
+        /**
+         * @brief accumulated count of missed deadlines.
+         */
+        std::atomic<uint64_t> m_missedCount;
+
+        /**
+         * @brief set on destruction to stop the scheduler thread.
+         */
+        bool m_stopping;
+    };
+
+    /**
+     * @brief Idle callback to dispatch a missed deadline on the main-context.
+     * @param[in] pWatchId unique id of the watch packed with GUINT_TO_POINTER.
+     * @return false always to self remove.
+     */
+    static int DeadlineMissedHandler(gpointer pWatchId);
+}
+
+#endif // _DSL_DEADLINE_SCHEDULER_H
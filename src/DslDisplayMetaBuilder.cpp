@@ -0,0 +1,345 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslDisplayMetaBuilder.h"
+
+namespace DSL
+{
+    DisplayTemplate::DisplayTemplate()
+    {
+    }
+    
+    DisplayTemplate::~DisplayTemplate()
+    {
+        Clear();
+    }
+    
+    void DisplayTemplate::Clear()
+    {
+        for (auto& ivec: m_texts)
+        {
+            g_free(ivec.display_text);
+            g_free(ivec.font_params.font_name);
+        }
+        m_texts.clear();
+        m_lines.clear();
+        m_arrows.clear();
+        m_rects.clear();
+        m_circles.clear();
+    }
+    
+    uint DisplayTemplate::GetElementCount()
+    {
+        return m_texts.size() + m_lines.size() + m_arrows.size() +
+            m_rects.size() + m_circles.size();
+    }
+    
+    NvOSD_TextParams* DisplayTemplate::AddText()
+    {
+        m_texts.push_back(NvOSD_TextParams{0});
+        return &m_texts.back();
+    }
+
+    NvOSD_LineParams* DisplayTemplate::AddLine()
+    {
+        m_lines.push_back(NvOSD_LineParams{0});
+        return &m_lines.back();
+    }
+
+    NvOSD_ArrowParams* DisplayTemplate::AddArrow()
+    {
+        m_arrows.push_back(NvOSD_ArrowParams{0});
+        return &m_arrows.back();
+    }
+
+    NvOSD_RectParams* DisplayTemplate::AddRect()
+    {
+        m_rects.push_back(NvOSD_RectParams{0});
+        return &m_rects.back();
+    }
+
+    NvOSD_CircleParams* DisplayTemplate::AddCircle()
+    {
+        m_circles.push_back(NvOSD_CircleParams{0});
+        return &m_circles.back();
+    }
+
+    // ********************************************************************
+
+    DisplayMetaBuilder::DisplayMetaBuilder()
+        : m_pBatchMeta(NULL)
+        , m_maxDisplayMeta(0)
+        , m_pTemplate(NULL)
+        , m_textCursor(0)
+        , m_lineCursor(0)
+        , m_arrowCursor(0)
+        , m_rectCursor(0)
+        , m_circleCursor(0)
+    {
+    }
+
+    DisplayMetaBuilder::DisplayMetaBuilder(NvDsBatchMeta* pBatchMeta, 
+        uint maxDisplayMeta)
+        : m_pBatchMeta(pBatchMeta)
+        , m_maxDisplayMeta(maxDisplayMeta)
+        , m_pTemplate(NULL)
+        , m_textCursor(0)
+        , m_lineCursor(0)
+        , m_arrowCursor(0)
+        , m_rectCursor(0)
+        , m_circleCursor(0)
+    {
+    }
+
+    DisplayMetaBuilder::DisplayMetaBuilder(DisplayTemplate& displayTemplate)
+        : m_pBatchMeta(NULL)
+        , m_maxDisplayMeta(0)
+        , m_pTemplate(&displayTemplate)
+        , m_textCursor(0)
+        , m_lineCursor(0)
+        , m_arrowCursor(0)
+        , m_rectCursor(0)
+        , m_circleCursor(0)
+    {
+    }
+
+    bool DisplayMetaBuilder::IsEnabled()
+    {
+        return (m_pTemplate or (m_pBatchMeta and m_maxDisplayMeta));
+    }
+
+    NvOSD_TextParams* DisplayMetaBuilder::AddText()
+    {
+        if (m_pTemplate)
+        {
+            return m_pTemplate->AddText();
+        }
+        NvDsDisplayMeta* pDisplayMeta = NextDisplayMeta(m_textCursor,
+            &NvDsDisplayMeta::num_labels);
+        
+        return (pDisplayMeta)
+            ? &pDisplayMeta->text_params[pDisplayMeta->num_labels++]
+            : NULL;
+    }
+
+    NvOSD_LineParams* DisplayMetaBuilder::AddLine()
+    {
+        if (m_pTemplate)
+        {
+            return m_pTemplate->AddLine();
+        }
+        NvDsDisplayMeta* pDisplayMeta = NextDisplayMeta(m_lineCursor,
+            &NvDsDisplayMeta::num_lines);
+        
+        return (pDisplayMeta)
+            ? &pDisplayMeta->line_params[pDisplayMeta->num_lines++]
+            : NULL;
+    }
+
+    NvOSD_ArrowParams* DisplayMetaBuilder::AddArrow()
+    {
+        if (m_pTemplate)
+        {
+            return m_pTemplate->AddArrow();
+        }
+        NvDsDisplayMeta* pDisplayMeta = NextDisplayMeta(m_arrowCursor,
+            &NvDsDisplayMeta::num_arrows);
+        
+        return (pDisplayMeta)
+            ? &pDisplayMeta->arrow_params[pDisplayMeta->num_arrows++]
+            : NULL;
+    }
+
+    NvOSD_RectParams* DisplayMetaBuilder::AddRect()
+    {
+        if (m_pTemplate)
+        {
+            return m_pTemplate->AddRect();
+        }
+        NvDsDisplayMeta* pDisplayMeta = NextDisplayMeta(m_rectCursor,
+            &NvDsDisplayMeta::num_rects);
+        
+        return (pDisplayMeta)
+            ? &pDisplayMeta->rect_params[pDisplayMeta->num_rects++]
+            : NULL;
+    }
+
+    NvOSD_CircleParams* DisplayMetaBuilder::AddCircle()
+    {
+        if (m_pTemplate)
+        {
+            return m_pTemplate->AddCircle();
+        }
+        NvDsDisplayMeta* pDisplayMeta = NextDisplayMeta(m_circleCursor,
+            &NvDsDisplayMeta::num_circles);
+        
+        return (pDisplayMeta)
+            ? &pDisplayMeta->circle_params[pDisplayMeta->num_circles++]
+            : NULL;
+    }
+
+    bool DisplayMetaBuilder::AddTemplate(const DisplayTemplate& displayTemplate)
+    {
+        if (!IsEnabled())
+        {
+            return false;
+        }
+        // The strings are freed with the Display Meta, so each frame 
+        // needs its own copy.
+        for (const auto& ivec: displayTemplate.m_texts)
+        {
+            NvOSD_TextParams* pTextParams = AddText();
+            if (!pTextParams)
+            {
+                return false;
+            }
+            *pTextParams = ivec;
+            pTextParams->display_text = g_strdup(ivec.display_text);
+            pTextParams->font_params.font_name = 
+                g_strdup(ivec.font_params.font_name);
+        }
+        return (CopyElements(displayTemplate.m_lines, m_lineCursor,
+                &NvDsDisplayMeta::num_lines, 
+                &NvDsDisplayMeta::line_params) == 
+                    displayTemplate.m_lines.size() and
+            CopyElements(displayTemplate.m_arrows, m_arrowCursor,
+                &NvDsDisplayMeta::num_arrows, 
+                &NvDsDisplayMeta::arrow_params) == 
+                    displayTemplate.m_arrows.size() and
+            CopyElements(displayTemplate.m_rects, m_rectCursor,
+                &NvDsDisplayMeta::num_rects, 
+                &NvDsDisplayMeta::rect_params) == 
+                    displayTemplate.m_rects.size() and
+            CopyElements(displayTemplate.m_circles, m_circleCursor,
+                &NvDsDisplayMeta::num_circles, 
+                &NvDsDisplayMeta::circle_params) == 
+                    displayTemplate.m_circles.size());
+    }
+
+    bool DisplayMetaBuilder::IsFirstAdd(const void* pOwner)
+    {
+        if (std::find(m_owners.begin(), m_owners.end(), pOwner) != 
+            m_owners.end())
+        {
+            return false;
+        }
+        m_owners.push_back(pOwner);
+        return true;
+    }
+
+    NvDsDisplayMeta* DisplayMetaBuilder::GetDisplayMeta()
+    {
+        if (m_displayMeta.empty())
+        {
+            return AcquireDisplayMeta();
+        }
+        return m_displayMeta.front();
+    }
+
+    uint DisplayMetaBuilder::GetAcquiredCount()
+    {
+        return m_displayMeta.size();
+    }
+
+    void DisplayMetaBuilder::AddToFrame(NvDsFrameMeta* pFrameMeta)
+    {
+        // Frames may be added to from worker threads, see AcquireDisplayMeta
+        if (m_displayMeta.size())
+        {
+            nvds_acquire_meta_lock(m_pBatchMeta);
+            for (const auto& ivec: m_displayMeta)
+            {
+                nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+            }
+            nvds_release_meta_lock(m_pBatchMeta);
+        }
+        m_displayMeta.clear();
+        m_owners.clear();
+        m_textCursor = m_lineCursor = m_arrowCursor = 
+            m_rectCursor = m_circleCursor = 0;
+    }
+
+    NvDsDisplayMeta* DisplayMetaBuilder::NextDisplayMeta(uint& cursor, 
+        guint NvDsDisplayMeta::*pCount)
+    {
+        // Skip over the structures that have been filled for this kind.
+        while (cursor < m_displayMeta.size() and 
+            m_displayMeta[cursor]->*pCount >= MAX_ELEMENTS_IN_DISPLAY_META)
+        {
+            cursor++;
+        }
+        if (cursor < m_displayMeta.size())
+        {
+            return m_displayMeta[cursor];
+        }
+        return AcquireDisplayMeta();
+    }
+
+    template<typename T>
+    uint DisplayMetaBuilder::CopyElements(const std::vector<T>& elements, 
+        uint& cursor, guint NvDsDisplayMeta::*pCount,
+        T (NvDsDisplayMeta::*pParams)[MAX_ELEMENTS_IN_DISPLAY_META])
+    {
+        uint copied(0);
+        
+        while (copied < elements.size())
+        {
+            NvDsDisplayMeta* pDisplayMeta = NextDisplayMeta(cursor, pCount);
+            if (!pDisplayMeta)
+            {
+                break;
+            }
+            uint count = std::min<uint>(elements.size() - copied,
+                MAX_ELEMENTS_IN_DISPLAY_META - pDisplayMeta->*pCount);
+                
+            memcpy(&(pDisplayMeta->*pParams)[pDisplayMeta->*pCount], 
+                &elements[copied], count*sizeof(T));
+                
+            pDisplayMeta->*pCount += count;
+            copied += count;
+        }
+        return copied;
+    }
+
+    NvDsDisplayMeta* DisplayMetaBuilder::AcquireDisplayMeta()
+    {
+        if (!m_pBatchMeta or m_displayMeta.size() >= m_maxDisplayMeta)
+        {
+            return NULL;
+        }
+        // The batch meta lock is recursive and makes the pool safe to use 
+        // from the worker threads when frames are processed in parallel.
+        nvds_acquire_meta_lock(m_pBatchMeta);
+        NvDsDisplayMeta* pDisplayMeta = 
+            nvds_acquire_display_meta_from_pool(m_pBatchMeta);
+        nvds_release_meta_lock(m_pBatchMeta);
+        
+        if (pDisplayMeta)
+        {
+            m_displayMeta.push_back(pDisplayMeta);
+        }
+        return pDisplayMeta;
+    }
+}
@@ -0,0 +1,300 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_DISPLAY_META_BUILDER_H
+#define _DSL_DISPLAY_META_BUILDER_H
+
+#include "Dsl.h"
+#include "DslFrameArena.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_DISPLAY_TEMPLATE_PTR std::shared_ptr<DisplayTemplate>
+    #define DSL_DISPLAY_TEMPLATE_NEW() \
+        std::shared_ptr<DisplayTemplate>(new DisplayTemplate())
+
+    /**
+     * @class DisplayTemplate
+     * @brief Precompiled block of display elements for static Display Types,
+     * i.e. types whose position, text, and colors do not change from frame 
+     * to frame. The elements are recorded once, with a recording 
+     * DisplayMetaBuilder, and then copied in bulk into each frame's Display 
+     * Meta with DisplayMetaBuilder::AddTemplate.
+     */
+    class DisplayTemplate
+    {
+    public:
+    
+        /**
+         * @brief ctor for an empty DisplayTemplate class
+         */
+        DisplayTemplate();
+        
+        /**
+         * @brief dtor for the DisplayTemplate class, frees the recorded text.
+         */
+        ~DisplayTemplate();
+        
+        /**
+         * @brief Removes all recorded elements.
+         */
+        void Clear();
+        
+        /**
+         * @brief Gets the total number of recorded elements of all kinds.
+         * @return number of recorded elements.
+         */
+        uint GetElementCount();
+        
+        /**
+         * @brief Records a new text element. The display_text and font_name 
+         * strings assigned to the element are owned by the template.
+         * @return pointer to the new text element.
+         */
+        NvOSD_TextParams* AddText();
+        
+        /**
+         * @brief Records a new line element.
+         * @return pointer to the new line element.
+         */
+        NvOSD_LineParams* AddLine();
+        
+        /**
+         * @brief Records a new arrow element.
+         * @return pointer to the new arrow element.
+         */
+        NvOSD_ArrowParams* AddArrow();
+        
+        /**
+         * @brief Records a new rectangle element.
+         * @return pointer to the new rectangle element.
+         */
+        NvOSD_RectParams* AddRect();
+        
+        /**
+         * @brief Records a new circle element.
+         * @return pointer to the new circle element.
+         */
+        NvOSD_CircleParams* AddCircle();
+        
+    private:
+    
+        // templates own their text, copying would double free.
+        DisplayTemplate(const DisplayTemplate&) = delete;
+        DisplayTemplate& operator=(const DisplayTemplate&) = delete;
+    
+        friend class DisplayMetaBuilder;
+    
+        /**
+         * @brief recorded elements, one vector for each kind of element.
+         */
+        std::vector<NvOSD_TextParams> m_texts;
+        std::vector<NvOSD_LineParams> m_lines;
+        std::vector<NvOSD_ArrowParams> m_arrows;
+        std::vector<NvOSD_RectParams> m_rects;
+        std::vector<NvOSD_CircleParams> m_circles;
+    };
+
+    /**
+     * @class DisplayMetaBuilder
+     * @brief Builds the Display Meta for a single frame. Display Meta 
+     * structures are acquired from the batch's pool only when the first 
+     * element that needs one is added. A fill cursor is kept for each kind
+     * of element (text, line, arrow, rectangle, circle) so that the next 
+     * free slot is found without scanning the structures that are already 
+     * full. Only the structures acquired are added to the frame.
+     */
+    class DisplayMetaBuilder
+    {
+    public:
+    
+        /**
+         * @brief ctor for a disabled DisplayMetaBuilder, used when no batch
+         * meta is available. All Add services will return NULL.
+         */
+        DisplayMetaBuilder();
+    
+        /**
+         * @brief ctor for the DisplayMetaBuilder class
+         * @param[in] pBatchMeta batch meta to acquire the Display Meta from.
+         * @param[in] maxDisplayMeta maximum number of Display Meta structures 
+         * that can be acquired for the frame, 0 to disable.
+         */
+        DisplayMetaBuilder(NvDsBatchMeta* pBatchMeta, uint maxDisplayMeta);
+        
+        /**
+         * @brief ctor for a recording DisplayMetaBuilder. All elements added
+         * are recorded in the provided template instead of in Display Meta.
+         * @param[in] displayTemplate template to record the elements in.
+         */
+        DisplayMetaBuilder(DisplayTemplate& displayTemplate);
+        
+        /**
+         * @brief Determines if elements can be added.
+         * @return true if Display Meta can be acquired, false otherwise.
+         */
+        bool IsEnabled();
+        
+        /**
+         * @brief Adds a text element.
+         * @return pointer to the new text element, NULL if none available.
+         */
+        NvOSD_TextParams* AddText();
+        
+        /**
+         * @brief Adds a line element.
+         * @return pointer to the new line element, NULL if none available.
+         */
+        NvOSD_LineParams* AddLine();
+        
+        /**
+         * @brief Adds an arrow element.
+         * @return pointer to the new arrow element, NULL if none available.
+         */
+        NvOSD_ArrowParams* AddArrow();
+        
+        /**
+         * @brief Adds a rectangle element.
+         * @return pointer to the new rectangle element, NULL if none available.
+         */
+        NvOSD_RectParams* AddRect();
+        
+        /**
+         * @brief Adds a circle element.
+         * @return pointer to the new circle element, NULL if none available.
+         */
+        NvOSD_CircleParams* AddCircle();
+        
+        /**
+         * @brief Adds all elements of a precompiled template. Lines, arrows,
+         * rectangles, and circles are copied in blocks into the free slots 
+         * of the Display Meta. Text elements are copied one at a time as 
+         * their strings are duplicated for the frame.
+         * @param[in] displayTemplate template to copy the elements from.
+         * @return true if all elements were added, false otherwise.
+         */
+        bool AddTemplate(const DisplayTemplate& displayTemplate);
+        
+        /**
+         * @brief Determines if this is the first add for an owner of display 
+         * elements, such as an Area shared by multiple Triggers, for the frame.
+         * @param[in] pOwner unique pointer identifying the owner.
+         * @return true on the first call for pOwner, false for all others.
+         */
+        bool IsFirstAdd(const void* pOwner);
+        
+        /**
+         * @brief Gets the first Display Meta structure for the frame, 
+         * acquiring it if needed, for clients that add elements directly.
+         * @return the first Display Meta structure, NULL if disabled.
+         */
+        NvDsDisplayMeta* GetDisplayMeta();
+        
+        /**
+         * @brief Gets the number of Display Meta structures acquired so far.
+         * @return number of structures acquired.
+         */
+        uint GetAcquiredCount();
+        
+        /**
+         * @brief Adds all acquired Display Meta structures to a frame. The
+         * builder is emptied so that each structure is only added once.
+         * @param[in] pFrameMeta frame meta to add the Display Meta to.
+         */
+        void AddToFrame(NvDsFrameMeta* pFrameMeta);
+        
+    private:
+    
+        /**
+         * @brief Gets the Display Meta structure with a free slot for one 
+         * kind of element, advancing the kind's cursor past full structures
+         * and acquiring a new structure when all are full.
+         * @param[in,out] cursor fill cursor for the kind of element.
+         * @param[in] pCount member holding the structure's element count.
+         * @return Display Meta with a free slot, NULL if none available.
+         */
+        NvDsDisplayMeta* NextDisplayMeta(uint& cursor, 
+            guint NvDsDisplayMeta::*pCount);
+            
+        /**
+         * @brief Copies a vector of elements of one kind into the free slots
+         * of the Display Meta, one block per Display Meta structure.
+         * @param[in] elements vector of elements to copy.
+         * @param[in,out] cursor fill cursor for the kind of element.
+         * @param[in] pCount member holding the structure's element count.
+         * @param[in] pParams member holding the structure's elements.
+         * @return number of elements copied.
+         */
+        template<typename T>
+        uint CopyElements(const std::vector<T>& elements, uint& cursor,
+            guint NvDsDisplayMeta::*pCount,
+            T (NvDsDisplayMeta::*pParams)[MAX_ELEMENTS_IN_DISPLAY_META]);
+    
+        /**
+         * @brief Acquires a new Display Meta structure from the batch's pool.
+         * @return the new Display Meta, NULL if the maximum has been reached.
+         */
+        NvDsDisplayMeta* AcquireDisplayMeta();
+    
+        /**
+         * @brief batch meta to acquire the Display Meta from.
+         */
+        NvDsBatchMeta* m_pBatchMeta;
+        
+        /**
+         * @brief maximum number of Display Meta structures for the frame.
+         */
+        uint m_maxDisplayMeta;
+        
+        /**
+         * @brief template to record the elements in, NULL if not recording.
+         */
+        DisplayTemplate* m_pTemplate;
+        
+        /**
+         * @brief owners that have added their elements to the frame.
+         */
+        FrameArenaVector<const void*> m_owners;
+        
+        /**
+         * @brief Display Meta structures acquired for the frame, in order.
+         */
+        FrameArenaVector<NvDsDisplayMeta*> m_displayMeta;
+        
+        /**
+         * @brief fill cursors, one for each kind of element, indexing 
+         * the first structure in m_displayMeta that may have a free slot.
+         */
+        uint m_textCursor;
+        uint m_lineCursor;
+        uint m_arrowCursor;
+        uint m_rectCursor;
+        uint m_circleCursor;
+    };
+}
+
+#endif // _DSL_DISPLAY_META_BUILDER_H
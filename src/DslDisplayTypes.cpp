@@ -126,6 +126,7 @@ namespace DSL
     
     DisplayType::DisplayType(const char* name)
         : Base(name)
+        , m_version(0)
     {
         LOG_FUNC();
     }
@@ -145,13 +146,33 @@ namespace DSL
         g_mutex_unlock(&m_propertyMutex);        
     }
     
-    void DisplayType::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void DisplayType::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
         LOG_FUNC();
         LOG_ERROR("Base Display Type can not be overlaid");
     }
     
+    bool DisplayType::IsStatic()
+    {
+        return false;
+    }
+    
+    uint DisplayType::GetVersion()
+    {
+        return m_version;
+    }
+    
+    void DisplayType::CompileMeta(DisplayTemplate& displayTemplate)
+    {
+        LOG_FUNC();
+        
+        DisplayMetaBuilder recorder(displayTemplate);
+        
+        // Static Display Types make no use of the frame meta.
+        AddMeta(recorder, NULL);
+    }
+    
     // ********************************************************************
 
     RgbaColor::RgbaColor(const char* name, 
@@ -365,6 +386,11 @@ namespace DSL
         m_pColor->Unlock();
     }
     
+    bool RgbaFont::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+    
     // ********************************************************************
 
     RgbaText::RgbaText(const char* name, 
@@ -402,6 +428,12 @@ namespace DSL
         m_pBgColor->Unlock();
     }
     
+    bool RgbaText::IsStatic()
+    {
+        return (m_pFont->IsStatic() and m_pBgColor->IsStatic() and
+            (!m_shadowEnabled or m_pShadowColor->IsStatic()));
+    }
+    
     bool RgbaText::AddShadow(uint xOffset, uint yOffset, DSL_RGBA_COLOR_PTR pColor)
     {
         LOG_FUNC();
@@ -420,35 +452,28 @@ namespace DSL
         m_pShadowFont = DSL_RGBA_FONT_NEW("", 
             m_pFont->m_fontName.c_str(), m_pFont->font_size, m_pShadowColor);
             
+        m_version++;
         return true;
     }
     
-    void RgbaText::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaText::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        if (!displayMetaData.IsEnabled())
         {
             return;
         }
         if (m_shadowEnabled)
         {
-            NvOSD_TextParams *pTextParams = &pDisplayMeta->
-                text_params[pDisplayMeta->num_labels++];
-            
+            NvOSD_TextParams *pTextParams = displayMetaData.AddText();
+            if (!pTextParams)
+            {
+                return;
+            }
             
             pTextParams->x_offset = x_offset + m_shadowXOffset;
             pTextParams->y_offset = y_offset + m_shadowYOffset;
@@ -467,8 +492,11 @@ namespace DSL
                 MAX_DISPLAY_LEN, 0);
                 
         }
-        NvOSD_TextParams *pTextParams = &pDisplayMeta->
-            text_params[pDisplayMeta->num_labels++];
+        NvOSD_TextParams *pTextParams = displayMetaData.AddText();
+        if (!pTextParams)
+        {
+            return;
+        }
         
         Lock();
         // copy over our text params, display_text currently == NULL
@@ -501,24 +529,21 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaLine::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    bool RgbaLine::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+
+    void RgbaLine::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        // and ensure we have available space in the display meta.
+        NvOSD_LineParams* pLineParams = displayMetaData.AddLine();
+        if (!pLineParams)
         {
             return;
         }
@@ -526,7 +551,7 @@ namespace DSL
         line_color = *m_pColor;
         m_pColor->Unlock();
 
-        pDisplayMeta->line_params[pDisplayMeta->num_lines++] = *this;
+        *pLineParams = *this;
     }
     
     // ********************************************************************
@@ -546,31 +571,28 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaArrow::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    bool RgbaArrow::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+
+    void RgbaArrow::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_arrows < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        // and ensure we have available space in the display meta.
+        NvOSD_ArrowParams* pArrowParams = displayMetaData.AddArrow();
+        if (!pArrowParams)
         {
             return;
         }
         m_pColor->Lock();
         arrow_color = *m_pColor;
         m_pColor->Unlock();
-        pDisplayMeta->arrow_params[pDisplayMeta->num_arrows++] = *this;
+        *pArrowParams = *this;
     }
 
     // ********************************************************************
@@ -593,24 +615,21 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaRectangle::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    bool RgbaRectangle::IsStatic()
+    {
+        return (m_pColor->IsStatic() and m_pBgColor->IsStatic());
+    }
+
+    void RgbaRectangle::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_rects < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        // and ensure we have available space in the display meta.
+        NvOSD_RectParams* pRectParams = displayMetaData.AddRect();
+        if (!pRectParams)
         {
             return;
         }
@@ -622,7 +641,7 @@ namespace DSL
         bg_color = *m_pBgColor;
         m_pBgColor->Unlock();
         
-        pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = *this;
+        *pRectParams = *this;
     }
     
     // ********************************************************************
@@ -648,7 +667,12 @@ namespace DSL
         g_free(coordinates);
     }
 
-    void RgbaPolygon::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    bool RgbaPolygon::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+
+    void RgbaPolygon::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -661,17 +685,9 @@ namespace DSL
         {
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
-            if (!pDisplayMeta)
+            // and ensure we have available space in the display meta.
+            NvOSD_LineParams* pLineParams = displayMetaData.AddLine();
+            if (!pLineParams)
             {
                 return;
             }
@@ -684,7 +700,7 @@ namespace DSL
                 border_width, 
                 color};
                 
-            pDisplayMeta->line_params[pDisplayMeta->num_lines++] = line;
+            *pLineParams = line;
         }
     }
 
@@ -712,7 +728,12 @@ namespace DSL
         g_free(coordinates);
     }
 
-    void RgbaMultiLine::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    bool RgbaMultiLine::IsStatic()
+    {
+        return m_pColor->IsStatic();
+    }
+
+    void RgbaMultiLine::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -725,17 +746,9 @@ namespace DSL
         {
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
-            if (!pDisplayMeta)
+            // and ensure we have available space in the display meta.
+            NvOSD_LineParams* pLineParams = displayMetaData.AddLine();
+            if (!pLineParams)
             {
                 return;
             }
@@ -747,7 +760,7 @@ namespace DSL
                 line_width, 
                 color};
                 
-            pDisplayMeta->line_params[pDisplayMeta->num_lines++] = line;
+            *pLineParams = line;
         }
     }
     // ********************************************************************
@@ -767,14 +780,20 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaCircle::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    bool RgbaCircle::IsStatic()
+    {
+        return (m_pColor->IsStatic() and m_pBgColor->IsStatic());
+    }
+
+    void RgbaCircle::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        if (displayMetaData.empty())
+        NvOSD_CircleParams* pCircleParams = displayMetaData.AddCircle();
+        if (!pCircleParams)
         {
             return;
         }
@@ -785,8 +804,7 @@ namespace DSL
         bg_color = *m_pBgColor;
         m_pBgColor->Unlock();
         
-        displayMetaData.at(0)->circle_params[
-            displayMetaData.at(0)->num_circles++] = *this;
+        *pCircleParams = *this;
     }
 
     // ********************************************************************
@@ -804,7 +822,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceDimensions::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceDimensions::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -829,7 +847,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceFrameRate::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceFrameRate::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -855,7 +873,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceUniqueId::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceUniqueId::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -880,7 +898,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceStreamId::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceStreamId::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -905,7 +923,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceName::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceName::AddMeta(DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslDisplayMetaBuilder.h"
 #include "randomcolor.h"
 
 #define MAX_DISPLAY_LEN 64
@@ -168,15 +169,41 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        virtual void AddMeta(std::vector<NvDsDisplayMeta*>& 
+        virtual void AddMeta(DisplayMetaBuilder& 
             displayMetaData, NvDsFrameMeta* pFrameMeta);
             
+        /**
+         * @brief Determines if the Display Type's meta is the same for every 
+         * frame, i.e. it has no dynamic colors or per-frame text, and can be
+         * precompiled into a DisplayTemplate.
+         * @return true if static, false otherwise.
+         */
+        virtual bool IsStatic();
+        
+        /**
+         * @brief Gets the Display Type's version, incremented on each change
+         * to a property that affects the Display Type's meta.
+         * @return current version.
+         */
+        uint GetVersion();
+        
+        /**
+         * @brief Records the Display Type's meta in a DisplayTemplate. 
+         * @param[in] displayTemplate template to record the meta in.
+         */
+        void CompileMeta(DisplayTemplate& displayTemplate);
+            
     protected:
         
         /**
          * @brief Mutex to ensure mutual exlusion for propery read/writes
          */
         DslMutex m_propertyMutex;
+        
+        /**
+         * @brief version of the Display Type's properties.
+         */
+        std::atomic<uint> m_version;
     };
     
     // ********************************************************************
@@ -223,6 +250,12 @@ namespace DSL
          * @brief noop SetNext for static color.
          */
         virtual void SetNext(){};
+        
+        /**
+         * @brief Determines if the color is static, i.e. SetNext is a noop.
+         * @return true for all static colors, false for dynamic colors.
+         */
+        virtual bool IsStatic(){return true;};
     };
 
     // ********************************************************************
@@ -287,7 +320,11 @@ namespace DSL
         /**
          * @brief Set the RGB values to the next color in the Palette.
          */
-        void SetNext();
+        void SetNext();        
+        /**
+         * @brief Palette, random, and on-demand colors change with SetNext.
+         */
+        bool IsStatic(){return false;};
         
         /**
          * @brief Gets the palette index.
@@ -347,7 +384,11 @@ namespace DSL
         /**
          * @brief Set the RGB values to the next random color.
          */
-        void SetNext();
+        void SetNext();        
+        /**
+         * @brief Palette, random, and on-demand colors change with SetNext.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -390,7 +431,11 @@ namespace DSL
         /**
          * @brief Calls the client's call back to get the next RGB values.
          */
-        void SetNext();
+        void SetNext();        
+        /**
+         * @brief Palette, random, and on-demand colors change with SetNext.
+         */
+        bool IsStatic(){return false;};
         
     private:
     
@@ -437,6 +482,12 @@ namespace DSL
          */
         inline void Unlock();
         
+        /**
+         * @brief Determines if the font's color is static.
+         * @return true if the font's color is static.
+         */
+        bool IsStatic();
+        
         /**
          * @breif actual tty font name
          */
@@ -496,9 +547,15 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
+        
         std::string m_text;
         
     private:
@@ -567,8 +624,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
             
     private:
     
@@ -607,8 +670,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
             
     private:
     
@@ -650,8 +719,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
             
     private:
     
@@ -723,8 +798,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
 
     private:
     
@@ -790,8 +871,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
 
     private:
     
@@ -830,8 +917,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Determines if the Display Type can be precompiled.
+         * @return true if all of the Display Type's colors are static.
+         */
+        bool IsStatic();
 
     private:
     
@@ -873,9 +966,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Source text changes with each frame, never static.
+         */
+        bool IsStatic(){return false;};
+        
     private:
     
         /**
@@ -916,9 +1014,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Source text changes with each frame, never static.
+         */
+        bool IsStatic(){return false;};
+        
     private:
     
         /**
@@ -959,9 +1062,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Source text changes with each frame, never static.
+         */
+        bool IsStatic(){return false;};
+        
     private:
     
         /**
@@ -1002,9 +1110,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Source text changes with each frame, never static.
+         */
+        bool IsStatic(){return false;};
+        
     private:
     
         /**
@@ -1045,9 +1158,14 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Source text changes with each frame, never static.
+         */
+        bool IsStatic(){return false;};
+        
     private:
     
         /**
@@ -64,8 +64,7 @@ namespace DSL
             // Create a unique name by appending the plugin name
             AppendSuffix(factoryName);
             
-            m_pGstObj = GST_OBJECT(gst_element_factory_make(factoryName, 
-                GetCStrName()));
+            m_pGstObj = GST_OBJECT(CreateElement(factoryName, GetCStrName()));
             if (!m_pGstObj)
             {
                 LOG_ERROR("Failed to create new Element '" << name << "'");
@@ -88,8 +87,7 @@ namespace DSL
             AppendSuffix(factoryName);
             AppendSuffix(suffix);
             
-            m_pGstObj = GST_OBJECT(gst_element_factory_make(factoryName, 
-                GetCStrName()));
+            m_pGstObj = GST_OBJECT(CreateElement(factoryName, GetCStrName()));
             if (!m_pGstObj)
             {
                 LOG_ERROR("Failed to create new Element '" << name << "'");
@@ -105,6 +103,53 @@ namespace DSL
             LOG_FUNC();
         };
 
+        /**
+         * @brief Finds a GST Element Factory by name. Lookups are cached for the
+         * life of the process so that each new Elementr avoids the registry 
+         * search performed by gst_element_factory_make.
+         * @param[in] factoryName unique GST factory name to find.
+         * @return the cached factory, or NULL if no such factory exists.
+         */
+        static GstElementFactory* FindFactory(const char* factoryName)
+        {
+            static DslMutex factoryCacheMutex;
+            static std::unordered_map<std::string, GstElementFactory*> factoryCache;
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&factoryCacheMutex);
+
+            auto ifactory = factoryCache.find(factoryName);
+            if (ifactory != factoryCache.end())
+            {
+                return ifactory->second;
+            }
+            // Cache owns the reference returned by find. Failed lookups 
+            // are not cached so that late plugin registrations are found.
+            GstElementFactory* pFactory = gst_element_factory_find(factoryName);
+            if (pFactory)
+            {
+                factoryCache[factoryName] = pFactory;
+            }
+            return pFactory;
+        }
+
+        /**
+         * @brief Creates a new GST Element from a cached GST Element Factory.
+         * @param[in] factoryName unique GST factory name to create from.
+         * @param[in] name unique name for the new GST Element.
+         * @return new GST Element on successful creation, NULL otherwise.
+         */
+        static GstElement* CreateElement(const char* factoryName, const char* name)
+        {
+            GstElementFactory* pFactory = FindFactory(factoryName);
+            if (!pFactory)
+            {
+                LOG_ERROR("Failed to find GST Element Factory '" 
+                    << factoryName << "'");
+                return NULL;
+            }
+            return gst_element_factory_create(pFactory, name);
+        }
+
         /**
          * @brief Adds the Sink and Src Pad Probes to this GST Element
          */
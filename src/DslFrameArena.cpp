@@ -0,0 +1,182 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslFrameArena.h"
+
+namespace DSL
+{
+    thread_local FrameArena* FrameArena::s_pCurrent(NULL);
+
+    FrameArena::FrameArena(size_t blockSize)
+        : m_pCurrentBlock(NULL)
+        , m_capacity(0)
+        , m_peakBytesInUse(0)
+        , m_allocationCount(0)
+        , m_blockAllocationCount(0)
+        , m_resetCount(0)
+    {
+        LOG_FUNC();
+        
+        m_pCurrentBlock = NewBlock(std::max(blockSize, (size_t)64), NULL);
+    }
+
+    FrameArena::~FrameArena()
+    {
+        LOG_FUNC();
+        
+        FreeBlocks(m_pCurrentBlock);
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        // Reserve enough to align the start of the allocation within the block.
+        size_t paddedSize = std::max(size, (size_t)1) + alignment - 1;
+        
+        m_allocationCount++;
+        
+        while (true)
+        {
+            FrameArenaBlock* pBlock = m_pCurrentBlock.load();
+            
+            size_t offset = pBlock->offset.fetch_add(paddedSize);
+            if (offset + paddedSize <= pBlock->size)
+            {
+                uintptr_t address = (uintptr_t)(pBlock->pData + offset);
+                address = (address + alignment - 1) & ~(uintptr_t)(alignment - 1);
+                return (void*)address;
+            }
+            AddBlock(pBlock, paddedSize);
+        }
+    }
+
+    void FrameArena::Reset()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_blockMutex);
+        
+        m_peakBytesInUse = std::max(m_peakBytesInUse, GetBytesInUse());
+        m_resetCount++;
+        
+        FrameArenaBlock* pBlock = m_pCurrentBlock.load();
+        
+        // If the last batch needed more than one block, replace them all with 
+        // a single block that can hold the entire batch next time.
+        if (pBlock->pPrevious)
+        {
+            size_t capacity = m_capacity;
+            FreeBlocks(pBlock);
+            m_capacity = 0;
+            pBlock = NewBlock(capacity, NULL);
+            m_pCurrentBlock = pBlock;
+        }
+        pBlock->offset = 0;
+    }
+
+    uint64_t FrameArena::GetAllocationCount()
+    {
+        return m_allocationCount;
+    }
+
+    uint64_t FrameArena::GetBlockAllocationCount()
+    {
+        return m_blockAllocationCount;
+    }
+
+    uint64_t FrameArena::GetResetCount()
+    {
+        return m_resetCount;
+    }
+
+    size_t FrameArena::GetBytesInUse()
+    {
+        size_t bytesInUse(0);
+        
+        for (FrameArenaBlock* pBlock = m_pCurrentBlock.load(); pBlock; 
+            pBlock = pBlock->pPrevious)
+        {
+            bytesInUse += std::min(pBlock->offset.load(), pBlock->size);
+        }
+        return bytesInUse;
+    }
+
+    size_t FrameArena::GetPeakBytesInUse()
+    {
+        return m_peakBytesInUse;
+    }
+
+    size_t FrameArena::GetCapacity()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_blockMutex);
+        
+        return m_capacity;
+    }
+
+    FrameArena* FrameArena::GetCurrent()
+    {
+        return s_pCurrent;
+    }
+
+    void FrameArena::SetCurrent(FrameArena* pArena)
+    {
+        s_pCurrent = pArena;
+    }
+
+    void FrameArena::AddBlock(FrameArenaBlock* pFullBlock, size_t minSize)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_blockMutex);
+        
+        // Another thread may have added a block while waiting on the lock.
+        if (m_pCurrentBlock.load() != pFullBlock)
+        {
+            return;
+        }
+        m_pCurrentBlock = NewBlock(std::max(pFullBlock->size*2, minSize), 
+            pFullBlock);
+    }
+
+    FrameArenaBlock* FrameArena::NewBlock(size_t size, FrameArenaBlock* pPrevious)
+    {
+        FrameArenaBlock* pBlock = new FrameArenaBlock;
+        pBlock->pData = new uint8_t[size];
+        pBlock->size = size;
+        pBlock->offset = 0;
+        pBlock->pPrevious = pPrevious;
+        
+        m_capacity += size;
+        m_blockAllocationCount++;
+        
+        return pBlock;
+    }
+
+    void FrameArena::FreeBlocks(FrameArenaBlock* pBlock)
+    {
+        while (pBlock)
+        {
+            FrameArenaBlock* pPrevious = pBlock->pPrevious;
+            delete[] pBlock->pData;
+            delete pBlock;
+            pBlock = pPrevious;
+        }
+    }
+}
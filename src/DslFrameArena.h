@@ -0,0 +1,360 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_FRAME_ARENA_H
+#define _DSL_FRAME_ARENA_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief default size of the first block allocated by a Frame Arena.
+     */
+    #define DSL_FRAME_ARENA_DEFAULT_BLOCK_SIZE 16384
+
+    /**
+     * @struct FrameArenaBlock
+     * @brief single block of memory owned by a Frame Arena. 
+     */
+    struct FrameArenaBlock
+    {
+        /**
+         * @brief start of the block's memory.
+         */
+        uint8_t* pData;
+        
+        /**
+         * @brief size of the block's memory in bytes.
+         */
+        size_t size;
+        
+        /**
+         * @brief offset of the next free byte, may exceed size once full.
+         */
+        std::atomic<size_t> offset;
+        
+        /**
+         * @brief block that was current before this block was added.
+         */
+        FrameArenaBlock* pPrevious;
+    };
+
+    /**
+     * @class FrameArena
+     * @brief Bump allocator for scratch data that only lives for the 
+     * processing of a single batch. Memory is handed out by advancing an 
+     * offset into the current block and is reclaimed all at once on Reset.
+     * When a block overflows a larger one is added, and on Reset all blocks
+     * are coalesced into a single block large enough for the batch. Once 
+     * warmed up, each batch is served from one block with no heap allocations.
+     * Allocate is thread-safe, Reset must not be called while allocating.
+     */
+    class FrameArena
+    {
+    public:
+
+        /**
+         * @brief ctor for the FrameArena class
+         * @param[in] blockSize size of the initial block in bytes.
+         */
+        FrameArena(size_t blockSize = DSL_FRAME_ARENA_DEFAULT_BLOCK_SIZE);
+
+        /**
+         * @brief dtor for the FrameArena class
+         */
+        ~FrameArena();
+
+        /**
+         * @brief Allocates memory from the arena. The memory is valid until 
+         * the next call to Reset and is never freed individually.
+         * @param[in] size number of bytes to allocate.
+         * @param[in] alignment required alignment, must be a power of 2.
+         * @return pointer to the allocated memory.
+         */
+        void* Allocate(size_t size, size_t alignment);
+        
+        /**
+         * @brief Reclaims all memory allocated since the last Reset.
+         */
+        void Reset();
+        
+        /**
+         * @brief Gets the number of allocations served since creation.
+         * @return number of calls to Allocate.
+         */
+        uint64_t GetAllocationCount();
+        
+        /**
+         * @brief Gets the number of blocks allocated from the heap since 
+         * creation, including the initial block.
+         * @return number of heap allocations made by the arena.
+         */
+        uint64_t GetBlockAllocationCount();
+        
+        /**
+         * @brief Gets the number of times the arena has been reset.
+         * @return number of calls to Reset.
+         */
+        uint64_t GetResetCount();
+        
+        /**
+         * @brief Gets the number of bytes allocated since the last Reset.
+         * @return bytes in use, including alignment padding.
+         */
+        size_t GetBytesInUse();
+        
+        /**
+         * @brief Gets the highest number of bytes in use at the time of Reset.
+         * @return peak bytes in use for a single batch.
+         */
+        size_t GetPeakBytesInUse();
+        
+        /**
+         * @brief Gets the total size of all blocks currently owned by the arena.
+         * @return capacity in bytes.
+         */
+        size_t GetCapacity();
+        
+        /**
+         * @brief Gets the arena installed for the calling thread.
+         * @return current arena, NULL if none. 
+         */
+        static FrameArena* GetCurrent();
+        
+        /**
+         * @brief Installs an arena for the calling thread.
+         * @param[in] pArena arena to install, NULL to uninstall.
+         */
+        static void SetCurrent(FrameArena* pArena);
+        
+    private:
+    
+        /**
+         * @brief Adds a new current block if pFullBlock is still current.
+         * @param[in] pFullBlock block that could not serve an allocation.
+         * @param[in] minSize minimum size of the new block.
+         */
+        void AddBlock(FrameArenaBlock* pFullBlock, size_t minSize);
+        
+        /**
+         * @brief Allocates a new block from the heap.
+         * @param[in] size size of the block in bytes.
+         * @param[in] pPrevious block that was current before the new block.
+         * @return the new block.
+         */
+        FrameArenaBlock* NewBlock(size_t size, FrameArenaBlock* pPrevious);
+        
+        /**
+         * @brief Frees a block and all blocks that precede it.
+         * @param[in] pBlock last block in the chain to free.
+         */
+        void FreeBlocks(FrameArenaBlock* pBlock);
+        
+        /**
+         * @brief block currently serving allocations.
+         */
+        std::atomic<FrameArenaBlock*> m_pCurrentBlock;
+        
+        /**
+         * @brief mutex to serialize the adding of new blocks.
+         */
+        DslMutex m_blockMutex;
+        
+        /**
+         * @brief total size of all blocks, guarded by m_blockMutex.
+         */
+        size_t m_capacity;
+        
+        /**
+         * @brief highest bytes in use at the time of Reset.
+         */
+        size_t m_peakBytesInUse;
+        
+        /**
+         * @brief number of calls to Allocate.
+         */
+        std::atomic<uint64_t> m_allocationCount;
+        
+        /**
+         * @brief number of blocks allocated from the heap.
+         */
+        std::atomic<uint64_t> m_blockAllocationCount;
+        
+        /**
+         * @brief number of calls to Reset.
+         */
+        uint64_t m_resetCount;
+        
+        /**
+         * @brief arena installed for each thread.
+         */
+        static thread_local FrameArena* s_pCurrent;
+    };
+
+    /**
+     * @class FrameArenaScope
+     * @brief Installs a Frame Arena for the calling thread for the lifetime
+     * of the scope, restoring the previous arena on exit. Frame Arena 
+     * Allocators constructed within the scope allocate from the arena.
+     */
+    class FrameArenaScope
+    {
+    public:
+    
+        /**
+         * @brief ctor for the FrameArenaScope class
+         * @param[in] pArena arena to install for the calling thread.
+         * @param[in] resetOnExit if true, the arena is reset on exit.
+         */
+        FrameArenaScope(FrameArena* pArena, bool resetOnExit = false)
+            : m_pArena(pArena)
+            , m_pPrevious(FrameArena::GetCurrent())
+            , m_resetOnExit(resetOnExit)
+        {
+            FrameArena::SetCurrent(pArena);
+        };
+        
+        /**
+         * @brief dtor for the FrameArenaScope class
+         */
+        ~FrameArenaScope()
+        {
+            FrameArena::SetCurrent(m_pPrevious);
+            if (m_resetOnExit and m_pArena)
+            {
+                m_pArena->Reset();
+            }
+        };
+        
+    private:
+    
+        /**
+         * @brief arena installed by this scope.
+         */
+        FrameArena* m_pArena;
+        
+        /**
+         * @brief arena to restore on exit.
+         */
+        FrameArena* m_pPrevious;
+        
+        /**
+         * @brief if true, m_pArena is reset on exit.
+         */
+        bool m_resetOnExit;
+    };
+
+    /**
+     * @class FrameArenaAllocator
+     * @brief Standard library allocator that allocates from the Frame Arena
+     * installed for the calling thread at the time of construction. If no 
+     * arena is installed, it falls back to the heap so that containers can
+     * be used outside of a batch, e.g. when called from a client or test.
+     * Containers using this allocator must not outlive the arena's next Reset.
+     */
+    template<typename T>
+    class FrameArenaAllocator
+    {
+    public:
+    
+        typedef T value_type;
+        
+        /**
+         * @brief containers adopt the arena of the container they are move
+         * assigned from, so that a long lived container can be re-bound to
+         * the arena of the current batch.
+         */
+        typedef std::true_type propagate_on_container_move_assignment;
+        
+        FrameArenaAllocator() noexcept
+            : m_pArena(FrameArena::GetCurrent())
+        {};
+        
+        FrameArenaAllocator(FrameArena* pArena) noexcept
+            : m_pArena(pArena)
+        {};
+        
+        template<typename U>
+        FrameArenaAllocator(const FrameArenaAllocator<U>& other) noexcept
+            : m_pArena(other.GetArena())
+        {};
+        
+        T* allocate(size_t n)
+        {
+            if (m_pArena)
+            {
+                return static_cast<T*>(m_pArena->Allocate(n*sizeof(T), alignof(T)));
+            }
+            return static_cast<T*>(::operator new(n*sizeof(T)));
+        };
+        
+        void deallocate(T* p, size_t n) noexcept
+        {
+            // Arena memory is reclaimed all at once on Reset.
+            if (!m_pArena)
+            {
+                ::operator delete(p);
+            }
+        };
+        
+        FrameArena* GetArena() const noexcept
+        {
+            return m_pArena;
+        };
+        
+        template<typename U>
+        bool operator==(const FrameArenaAllocator<U>& other) const noexcept
+        {
+            return m_pArena == other.GetArena();
+        };
+        
+        template<typename U>
+        bool operator!=(const FrameArenaAllocator<U>& other) const noexcept
+        {
+            return m_pArena != other.GetArena();
+        };
+        
+    private:
+    
+        /**
+         * @brief arena to allocate from, NULL to use the heap.
+         */
+        FrameArena* m_pArena;
+    };
+    
+    /**
+     * @brief vector allocated from the calling thread's Frame Arena.
+     */
+    template<typename T>
+    using FrameArenaVector = std::vector<T, FrameArenaAllocator<T>>;
+    
+    /**
+     * @brief string allocated from the calling thread's Frame Arena.
+     */
+    typedef std::basic_string<char, std::char_traits<char>, 
+        FrameArenaAllocator<char>> FrameArenaString;
+}
+
+#endif // _DSL_FRAME_ARENA_H
@@ -0,0 +1,184 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslLatencyHistogram.h"
+
+namespace DSL
+{
+    double CycleCounter::GetNanosecondsPerCycle()
+    {
+        // calibrated once, thread-safe on first use.
+        static double nanosecondsPerCycle(Calibrate());
+        
+        return nanosecondsPerCycle;
+    }
+    
+    double CycleCounter::Calibrate()
+    {
+#if defined(__aarch64__)
+        // the virtual counter's frequency is provided by the system.
+        uint64_t frequency;
+        __asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (frequency));
+        if (frequency)
+        {
+            return 1000000000.0 / frequency;
+        }
+#endif
+#if defined(__x86_64__) || defined(__aarch64__)
+        auto clockStart = std::chrono::steady_clock::now();
+        uint64_t cyclesStart = Now();
+        
+        // spin for long enough to get a stable ratio.
+        std::chrono::nanoseconds elapsed(0);
+        while (elapsed < std::chrono::milliseconds(5))
+        {
+            elapsed = std::chrono::steady_clock::now() - clockStart;
+        }
+        uint64_t cycles = Now() - cyclesStart;
+        if (cycles)
+        {
+            double nanosecondsPerCycle = (double)elapsed.count() / cycles;
+            LOG_INFO("Cycle counter calibrated at " << nanosecondsPerCycle
+                << " ns/cycle");
+            return nanosecondsPerCycle;
+        }
+#endif
+        return 1.0;
+    }
+    
+    // ********************************************************************
+    
+    LatencyHistogram::LatencyHistogram()
+    {
+        LOG_FUNC();
+        
+        Clear();
+    }
+    
+    uint LatencyHistogram::getBucket(uint64_t value)
+    {
+        if (value < DSL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return (uint)value;
+        }
+        // the position of the most significant bit selects the power of 
+        // two, the bits that follow it select the linear sub-bucket.
+        uint exponent = 63 - __builtin_clzll(value);
+        if (exponent > DSL_LATENCY_HISTOGRAM_MAX_EXPONENT)
+        {
+            return DSL_LATENCY_HISTOGRAM_BUCKETS - 1;
+        }
+        uint shift = exponent - DSL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+        uint subBucket = (value >> shift) & (DSL_LATENCY_HISTOGRAM_SUB_BUCKETS - 1);
+        
+        return DSL_LATENCY_HISTOGRAM_SUB_BUCKETS + 
+            shift*DSL_LATENCY_HISTOGRAM_SUB_BUCKETS + subBucket;
+    }
+    
+    uint64_t LatencyHistogram::getBucketValue(uint bucket)
+    {
+        if (bucket < DSL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return bucket;
+        }
+        uint shift = (bucket - DSL_LATENCY_HISTOGRAM_SUB_BUCKETS) / 
+            DSL_LATENCY_HISTOGRAM_SUB_BUCKETS;
+        uint64_t subBucket = (bucket - DSL_LATENCY_HISTOGRAM_SUB_BUCKETS) % 
+            DSL_LATENCY_HISTOGRAM_SUB_BUCKETS;
+        uint64_t lowest = (DSL_LATENCY_HISTOGRAM_SUB_BUCKETS + subBucket) << shift;
+        
+        return lowest + ((1ULL << shift) >> 1);
+    }
+    
+    void LatencyHistogram::Record(uint64_t value)
+    {
+        m_buckets[getBucket(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        
+        uint64_t min = m_min.load(std::memory_order_relaxed);
+        while (value < min and !m_min.compare_exchange_weak(min, value,
+            std::memory_order_relaxed));
+        
+        uint64_t max = m_max.load(std::memory_order_relaxed);
+        while (value > max and !m_max.compare_exchange_weak(max, value,
+            std::memory_order_relaxed));
+    }
+    
+    uint64_t LatencyHistogram::GetCount()
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+    
+    uint64_t LatencyHistogram::GetPercentile(double percentile)
+    {
+        uint64_t count = GetCount();
+        if (!count)
+        {
+            return 0;
+        }
+        uint64_t target = std::max((uint64_t)1, 
+            (uint64_t)std::ceil(percentile/100.0*count));
+        uint64_t cumulative(0);
+        
+        for (uint i = 0; i < DSL_LATENCY_HISTOGRAM_BUCKETS; i++)
+        {
+            cumulative += m_buckets[i].load(std::memory_order_relaxed);
+            if (cumulative >= target)
+            {
+                // the bucket's mid-point can't be outside of the values seen.
+                return std::min(std::max(getBucketValue(i), 
+                    m_min.load(std::memory_order_relaxed)), 
+                    m_max.load(std::memory_order_relaxed));
+            }
+        }
+        return m_max.load(std::memory_order_relaxed);
+    }
+    
+    void LatencyHistogram::GetStats(dsl_latency_stats* stats)
+    {
+        stats->count = GetCount();
+        stats->min = (stats->count) ? m_min.load(std::memory_order_relaxed) : 0;
+        stats->max = m_max.load(std::memory_order_relaxed);
+        stats->mean = (stats->count) 
+            ? m_sum.load(std::memory_order_relaxed) / stats->count 
+            : 0;
+        stats->p50 = GetPercentile(50.0);
+        stats->p90 = GetPercentile(90.0);
+        stats->p99 = GetPercentile(99.0);
+    }
+    
+    void LatencyHistogram::Clear()
+    {
+        for (auto& bucket: m_buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_min.store(UINT64_MAX, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,204 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_LATENCY_HISTOGRAM_H
+#define _DSL_LATENCY_HISTOGRAM_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief number of linear sub-buckets for each power of two. Values are
+     * recorded with a relative precision of 1/16th, about 6%.
+     */
+    #define DSL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS 4
+    #define DSL_LATENCY_HISTOGRAM_SUB_BUCKETS \
+        (1 << DSL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+    
+    /**
+     * @brief highest power of two tracked, values above 2^40 nanoseconds 
+     * (about 18 minutes) are recorded in the last bucket.
+     */
+    #define DSL_LATENCY_HISTOGRAM_MAX_EXPONENT 40
+    
+    #define DSL_LATENCY_HISTOGRAM_BUCKETS \
+        (DSL_LATENCY_HISTOGRAM_SUB_BUCKETS + \
+        (DSL_LATENCY_HISTOGRAM_MAX_EXPONENT - \
+            DSL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) * \
+        DSL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_LATENCY_HISTOGRAM_PTR std::shared_ptr<LatencyHistogram>
+    #define DSL_LATENCY_HISTOGRAM_NEW() \
+        std::shared_ptr<LatencyHistogram>(new LatencyHistogram())
+
+    /**
+     * @class CycleCounter
+     * @brief Low-overhead timestamps read from the CPU's cycle counter - the 
+     * TSC on x86-64 and the virtual counter on AArch64 - with the monotonic
+     * clock used on all other architectures.
+     */
+    class CycleCounter
+    {
+    public:
+    
+        /**
+         * @brief Reads the current value of the cycle counter.
+         * @return current counter value in units of cycles.
+         */
+        static inline uint64_t Now()
+        {
+#if defined(__x86_64__)
+            uint32_t lo, hi;
+            __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+            return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+            uint64_t value;
+            __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (value));
+            return value;
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        };
+        
+        /**
+         * @brief Converts a difference in cycles to nanoseconds.
+         * @param[in] cycles number of cycles to convert.
+         * @return the number of nanoseconds.
+         */
+        static inline uint64_t ToNanoseconds(uint64_t cycles)
+        {
+            return (uint64_t)(cycles*GetNanosecondsPerCycle());
+        };
+        
+        /**
+         * @brief Gets the number of nanoseconds per cycle. The counter is 
+         * calibrated on first call, which should be made from a client thread
+         * so that the streaming threads are not delayed.
+         * @return nanoseconds per cycle.
+         */
+        static double GetNanosecondsPerCycle();
+        
+    private:
+    
+        /**
+         * @brief Measures the counter's frequency against the monotonic clock.
+         * @return nanoseconds per cycle.
+         */
+        static double Calibrate();
+    };
+
+    /**
+     * @class LatencyHistogram
+     * @brief HDR-style histogram of latencies in nanoseconds. Values are 
+     * counted in log-linear buckets - 16 linear sub-buckets for each power 
+     * of two - so the histogram has a fixed size and constant-time recording
+     * with a bounded relative error. Record is lock-free and may be called 
+     * from multiple threads.
+     */
+    class LatencyHistogram
+    {
+    public:
+    
+        /**
+         * @brief ctor for the LatencyHistogram class
+         */
+        LatencyHistogram();
+        
+        /**
+         * @brief Records a single latency value.
+         * @param[in] value latency in nanoseconds.
+         */
+        void Record(uint64_t value);
+        
+        /**
+         * @brief Gets the number of values recorded.
+         * @return number of values recorded since creation or last clear.
+         */
+        uint64_t GetCount();
+        
+        /**
+         * @brief Gets the value at the given percentile, to the precision
+         * of the bucket it falls in.
+         * @param[in] percentile percentile to get, 0.0 to 100.0.
+         * @return value at the percentile, 0 if no values recorded.
+         */
+        uint64_t GetPercentile(double percentile);
+        
+        /**
+         * @brief Gets a summary of the recorded values.
+         * @param[out] stats count, min, max, mean and percentiles.
+         */
+        void GetStats(dsl_latency_stats* stats);
+        
+        /**
+         * @brief Clears all recorded values.
+         */
+        void Clear();
+        
+    private:
+    
+        /**
+         * @brief Gets the bucket index for a value.
+         * @param[in] value value to find the bucket for.
+         * @return index into m_buckets.
+         */
+        static uint getBucket(uint64_t value);
+        
+        /**
+         * @brief Gets the value at the middle of a bucket.
+         * @param[in] bucket index of the bucket.
+         * @return the mid-point value of the bucket.
+         */
+        static uint64_t getBucketValue(uint bucket);
+    
+        /**
+         * @brief count of values recorded in each bucket.
+         */
+        std::atomic<uint64_t> m_buckets[DSL_LATENCY_HISTOGRAM_BUCKETS];
+        
+        /**
+         * @brief number of values recorded.
+         */
+        std::atomic<uint64_t> m_count;
+        
+        /**
+         * @brief sum of all values recorded.
+         */
+        std::atomic<uint64_t> m_sum;
+        
+        /**
+         * @brief minimum and maximum values recorded.
+         */
+        std::atomic<uint64_t> m_min;
+        std::atomic<uint64_t> m_max;
+    };
+}
+
+#endif // _DSL_LATENCY_HISTOGRAM_H
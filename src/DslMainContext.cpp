@@ -0,0 +1,167 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMainContext.h"
+
+namespace DSL
+{
+    thread_local GstObject* MainContextSource::s_pCurrentOwner(NULL);
+    
+    /**
+     * @brief key for the main-context stored with a top-level Pipeline.
+     */
+    static GQuark MainContextQuark()
+    {
+        static GQuark quark = g_quark_from_static_string("dsl-main-context");
+        
+        return quark;
+    }
+    
+    /**
+     * @brief mutex to guard the main-context stored with each Pipeline 
+     * against replacement while it is being referenced. Intentionally never 
+     * destroyed, as sources may be added by threads still running at exit.
+     */
+    static DslMutex& MainContextMutex()
+    {
+        static DslMutex* pMutex = new DslMutex();
+        
+        return *pMutex;
+    }
+
+    void MainContextSource::SetPipelineContext(GstObject* pGstPipeline, 
+        GMainContext* pMainContext)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&MainContextMutex());
+        
+        // The Pipeline holds its own reference, released on replacement.
+        g_object_set_qdata_full(G_OBJECT(pGstPipeline), MainContextQuark(),
+            (pMainContext) ? g_main_context_ref(pMainContext) : NULL,
+            (GDestroyNotify)g_main_context_unref);
+    }
+    
+    GMainContext* MainContextSource::RefContext(GstObject* pOwner)
+    {
+        if (!pOwner)
+        {
+            pOwner = s_pCurrentOwner;
+        }
+        if (pOwner)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&MainContextMutex());
+            
+            GstObject* pObject = GST_OBJECT(gst_object_ref(pOwner));
+            while (pObject)
+            {
+                GMainContext* pMainContext = (GMainContext*)g_object_get_qdata(
+                    G_OBJECT(pObject), MainContextQuark());
+                if (pMainContext)
+                {
+                    gst_object_unref(pObject);
+                    return g_main_context_ref(pMainContext);
+                }
+                GstObject* pParent = gst_object_get_parent(pObject);
+                gst_object_unref(pObject);
+                pObject = pParent;
+            }
+        }
+        // Not owned by a Pipeline with its own main-context, use the 
+        // calling thread's default, i.e. a Pipeline's own main-loop thread,
+        // otherwise the global default main-context.
+        return g_main_context_ref_thread_default();
+    }
+
+    MainContextSource::MainContextSource()
+        : m_pMainContext(NULL)
+        , m_pSource(NULL)
+    {
+        // No logging, constructed as a member of many components.
+    }
+    
+    MainContextSource::~MainContextSource()
+    {
+        Remove();
+    }
+    
+    bool MainContextSource::AddTimeout(GstObject* pOwner, uint interval, 
+        GSourceFunc func, gpointer data)
+    {
+        return attach(pOwner, g_timeout_source_new(interval), func, data);
+    }
+
+    bool MainContextSource::AddIdle(GstObject* pOwner, 
+        GSourceFunc func, gpointer data)
+    {
+        return attach(pOwner, g_idle_source_new(), func, data);
+    }
+    
+    bool MainContextSource::Remove()
+    {
+        if (!m_pSource)
+        {
+            return false;
+        }
+        // Safe if the source has already been destroyed by returning false.
+        g_source_destroy(m_pSource);
+        Clear();
+        
+        return true;
+    }
+    
+    void MainContextSource::Clear()
+    {
+        if (m_pSource)
+        {
+            g_source_unref(m_pSource);
+            g_main_context_unref(m_pMainContext);
+            m_pSource = NULL;
+            m_pMainContext = NULL;
+        }
+    }
+    
+    bool MainContextSource::attach(GstObject* pOwner, GSource* pSource, 
+        GSourceFunc func, gpointer data)
+    {
+        // As with g_timeout_add/g_idle_add, a source already held is left to
+        // run - it is only released.
+        Clear();
+        
+        GMainContext* pMainContext = RefContext(pOwner);
+        
+        g_source_set_callback(pSource, func, data, NULL);
+        if (!g_source_attach(pSource, pMainContext))
+        {
+            LOG_ERROR("Failed to attach source to main-context");
+            g_source_unref(pSource);
+            g_main_context_unref(pMainContext);
+            return false;
+        }
+        m_pSource = pSource;
+        m_pMainContext = pMainContext;
+        
+        return true;
+    }
+}
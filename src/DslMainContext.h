@@ -0,0 +1,210 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_MAIN_CONTEXT_H
+#define _DSL_MAIN_CONTEXT_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @class MainContextSource
+     * @brief Holds a timeout or idle GSource attached to the main-context of
+     * the Pipeline that owns the calling component - the Pipeline's own 
+     * main-context if one has been created with NewMainLoop, or the default 
+     * main-context otherwise. Replaces the use of g_timeout_add/g_idle_add 
+     * and g_source_remove, which only operate on the default main-context.
+     */
+    class MainContextSource
+    {
+    public:
+    
+        /**
+         * @brief Associates a main-context with a top-level Pipeline so that
+         * all components within the Pipeline attach their sources to it.
+         * @param[in] pGstPipeline top-level Pipeline GST object.
+         * @param[in] pMainContext main-context for the Pipeline, NULL to
+         * revert to the default main-context.
+         */
+        static void SetPipelineContext(GstObject* pGstPipeline, 
+            GMainContext* pMainContext);
+        
+        /**
+         * @brief Gets the main-context for an owner, searching up through 
+         * the owner's parents for its Pipeline. 
+         * @param[in] pOwner GST object of the owning component. If NULL, the
+         * object installed for the calling thread by MainContextScope is used.
+         * @return new reference to the Pipeline's main-context if found, else
+         * to the calling thread's default main-context. Free with 
+         * g_main_context_unref.
+         */
+        static GMainContext* RefContext(GstObject* pOwner);
+        
+        /**
+         * @brief Gets the GST object installed for the calling thread.
+         * @return current object, NULL if none.
+         */
+        static GstObject* GetCurrentOwner()
+        {
+            return s_pCurrentOwner;
+        };
+        
+        /**
+         * @brief Sets the GST object for the calling thread.
+         * @param[in] pOwner object to install, may be NULL.
+         */
+        static void SetCurrentOwner(GstObject* pOwner)
+        {
+            s_pCurrentOwner = pOwner;
+        };
+    
+        /**
+         * @brief ctor for the MainContextSource class
+         */
+        MainContextSource();
+        
+        /**
+         * @brief dtor for the MainContextSource class. Removes the 
+         * source if still attached.
+         */
+        ~MainContextSource();
+
+        /**
+         * @brief Adds a timeout source to the owner's main-context.
+         * @param[in] pOwner GST object of the owning component, may be NULL.
+         * @param[in] interval timeout interval in milliseconds.
+         * @param[in] func function to call on timeout, as per g_timeout_add.
+         * @param[in] data opaque pointer to pass to the function.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddTimeout(GstObject* pOwner, uint interval, 
+            GSourceFunc func, gpointer data);
+
+        /**
+         * @brief Adds an idle source to the owner's main-context.
+         * @param[in] pOwner GST object of the owning component, may be NULL.
+         * @param[in] func function to call when idle, as per g_idle_add.
+         * @param[in] data opaque pointer to pass to the function.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddIdle(GstObject* pOwner, GSourceFunc func, gpointer data);
+        
+        /**
+         * @brief Removes the source from its main-context. Safe to call from
+         * any thread, including from the source's own function.
+         * @return true if a source was held, false otherwise.
+         */
+        bool Remove();
+        
+        /**
+         * @brief Releases the source without removing it, called by a source
+         * function that is about to return false to self remove.
+         */
+        void Clear();
+        
+        /**
+         * @brief Checks if a source is currently held.
+         * @return true if held, false otherwise.
+         */
+        explicit operator bool() const
+        {
+            return m_pSource != NULL;
+        };
+        
+    private:
+    
+        /**
+         * @brief No copying, the source and main-context references are owned.
+         */
+        MainContextSource(const MainContextSource&) = delete;
+        MainContextSource& operator=(const MainContextSource&) = delete;
+    
+        /**
+         * @brief attaches a new source to the owner's main-context, 
+         * releasing any source currently held.
+         * @param[in] pOwner GST object of the owning component, may be NULL.
+         * @param[in] pSource new source to attach, consumed by this call.
+         * @param[in] func function to set as the source's callback.
+         * @param[in] data opaque pointer to pass to the function.
+         * @return true on successful attach, false otherwise.
+         */
+        bool attach(GstObject* pOwner, GSource* pSource, 
+            GSourceFunc func, gpointer data);
+    
+        /**
+         * @brief main-context the source is attached to, referenced.
+         */
+        GMainContext* m_pMainContext;
+        
+        /**
+         * @brief the held source, referenced, NULL if none.
+         */
+        GSource* m_pSource;
+        
+        /**
+         * @brief owner installed for each thread.
+         */
+        static thread_local GstObject* s_pCurrentOwner;
+    };
+    
+    /**
+     * @class MainContextScope
+     * @brief Installs the owning GST object (e.g. the Pad being probed) for 
+     * the calling thread for the lifetime of the scope, restoring the 
+     * previous object on exit. Sources added with a NULL owner within the 
+     * scope are attached to the main-context of the object's Pipeline.
+     */
+    class MainContextScope
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MainContextScope class
+         * @param[in] pOwner object to install, may be NULL.
+         */
+        MainContextScope(GstObject* pOwner)
+            : m_pPrevious(MainContextSource::GetCurrentOwner())
+        {
+            MainContextSource::SetCurrentOwner(pOwner);
+        };
+        
+        /**
+         * @brief dtor for the MainContextScope class
+         */
+        ~MainContextScope()
+        {
+            MainContextSource::SetCurrentOwner(m_pPrevious);
+        };
+        
+    private:
+    
+        /**
+         * @brief object installed before this scope.
+         */
+        GstObject* m_pPrevious;
+    };
+}
+
+#endif // _DSL_MAIN_CONTEXT_H
@@ -0,0 +1,282 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_META_EXPORT_FORMAT_H
+#define _DSL_META_EXPORT_FORMAT_H
+
+/**
+ * Binary record stream written by the DSL Metadata Export Sink to a file, 
+ * Unix domain socket or TCP socket. This header has no dependencies other 
+ * than libc so that it can be used by readers in other processes.
+ *
+ * All fields are packed, without padding, in host (little-endian) byte order.
+ *
+ * Layout of the stream
+ *   dsl_meta_export_stream_header        once, at the start of each file or 
+ *                                        socket connection
+ *   dsl_meta_export_block_header         followed by stored_size bytes of 
+ *   [stored_size bytes]                  block payload, repeated
+ *
+ * A block's payload is num_records batch records, raw_size bytes in total, 
+ * compressed as a single zstd frame if the block's codec is 
+ * DSL_META_EXPORT_CODEC_ZSTD.
+ *
+ * Layout of each batch record
+ *   dsl_meta_export_batch                record_size bytes in total, including
+ *                                        this header
+ *   for each of num_frames frames
+ *     dsl_meta_export_frame
+ *     for each of num_objects objects
+ *       dsl_meta_export_object
+ *       [label_length bytes]             object label, not null terminated
+ *       for each of num_classifier_labels labels
+ *         dsl_meta_export_label
+ *         [label_length bytes]           classifier label, not null terminated
+ *
+ * Readers should skip a batch record by record_size, and a block by 
+ * stored_size, so that fields can be appended in later versions.
+ */
+
+#include <stdint.h>
+
+#define DSL_META_EXPORT_STREAM_MAGIC                                0x4D4C5344
+#define DSL_META_EXPORT_BLOCK_MAGIC                                 0x424C5344
+#define DSL_META_EXPORT_VERSION                                     1
+
+/**
+ * @brief codec values for the block payload.
+ */
+#define DSL_META_EXPORT_CODEC_NONE                                  0
+#define DSL_META_EXPORT_CODEC_ZSTD                                  1
+
+/**
+ * @brief record type values.
+ */
+#define DSL_META_EXPORT_RECORD_TYPE_BATCH                           1
+
+/**
+ * @brief number of misc-info values copied from each frame and object. 
+ * Equal to MAX_USER_FIELDS in the DeepStream metadata. 
+ */
+#define DSL_META_EXPORT_MISC_INFO_SIZE                              4
+
+#pragma pack(push, 1)
+
+/**
+ * @struct dsl_meta_export_stream_header
+ * @brief Written once at the start of each file or socket connection.
+ */
+typedef struct _dsl_meta_export_stream_header
+{
+    /**
+     * @brief DSL_META_EXPORT_STREAM_MAGIC.
+     */
+    uint32_t magic;
+
+    /**
+     * @brief DSL_META_EXPORT_VERSION.
+     */
+    uint16_t version;
+
+    uint16_t reserved;
+
+    /**
+     * @brief wall-clock time the stream was started, in nanoseconds since
+     * the epoch.
+     */
+    uint64_t start_time;
+
+} dsl_meta_export_stream_header;
+
+/**
+ * @struct dsl_meta_export_block_header
+ * @brief Precedes each block of batch records.
+ */
+typedef struct _dsl_meta_export_block_header
+{
+    /**
+     * @brief DSL_META_EXPORT_BLOCK_MAGIC.
+     */
+    uint32_t magic;
+
+    /**
+     * @brief one of the DSL_META_EXPORT_CODEC values.
+     */
+    uint16_t codec;
+
+    uint16_t reserved;
+
+    /**
+     * @brief number of batch records in the block.
+     */
+    uint32_t num_records;
+
+    /**
+     * @brief size of the block payload before compression.
+     */
+    uint32_t raw_size;
+
+    /**
+     * @brief size of the block payload as written to the stream.
+     */
+    uint32_t stored_size;
+
+} dsl_meta_export_block_header;
+
+/**
+ * @struct dsl_meta_export_batch
+ * @brief Header for the record of one batched buffer.
+ */
+typedef struct _dsl_meta_export_batch
+{
+    /**
+     * @brief size of the record in bytes, including this header.
+     */
+    uint32_t record_size;
+
+    /**
+     * @brief DSL_META_EXPORT_RECORD_TYPE_BATCH.
+     */
+    uint16_t record_type;
+
+    /**
+     * @brief number of frame records that follow.
+     */
+    uint16_t num_frames;
+
+    /**
+     * @brief presentation timestamp of the buffer in nanoseconds.
+     */
+    uint64_t pts;
+
+} dsl_meta_export_batch;
+
+/**
+ * @struct dsl_meta_export_frame
+ * @brief Record for each frame in the batch.
+ */
+typedef struct _dsl_meta_export_frame
+{
+    uint32_t source_id;
+    uint32_t batch_id;
+    int32_t frame_num;
+
+    /**
+     * @brief NTP timestamp of the frame in nanoseconds.
+     */
+    uint64_t ntp_timestamp;
+
+    uint32_t source_frame_width;
+    uint32_t source_frame_height;
+
+    /**
+     * @brief misc frame info set by upstream components, including the
+     * ODE Accumulators and Heat-Mappers.
+     */
+    int64_t misc_frame_info[DSL_META_EXPORT_MISC_INFO_SIZE];
+
+    /**
+     * @brief number of display meta structures attached to the frame, and
+     * the total number of each display element they hold.
+     */
+    uint16_t num_display_meta;
+    uint16_t num_rects;
+    uint16_t num_labels;
+    uint16_t num_lines;
+    uint16_t num_arrows;
+    uint16_t num_circles;
+
+    /**
+     * @brief number of object records that follow.
+     */
+    uint32_t num_objects;
+
+} dsl_meta_export_frame;
+
+/**
+ * @struct dsl_meta_export_object
+ * @brief Record for each object in the frame.
+ */
+typedef struct _dsl_meta_export_object
+{
+    /**
+     * @brief unique tracking id for the object, UINT64_MAX if untracked.
+     */
+    uint64_t object_id;
+
+    int32_t class_id;
+    uint32_t unique_component_id;
+    float confidence;
+    float tracker_confidence;
+
+    /**
+     * @brief bounding box of the object in pixels.
+     */
+    float left;
+    float top;
+    float width;
+    float height;
+
+    /**
+     * @brief misc object info set by upstream components, including the 
+     * ODE Trigger persistence and direction values.
+     */
+    int64_t misc_obj_info[DSL_META_EXPORT_MISC_INFO_SIZE];
+
+    /**
+     * @brief number of classifier label records that follow the object label.
+     */
+    uint16_t num_classifier_labels;
+
+    /**
+     * @brief length of the object label that follows this record.
+     */
+    uint8_t label_length;
+
+} dsl_meta_export_object;
+
+/**
+ * @struct dsl_meta_export_label
+ * @brief Record for each classifier label of an object.
+ */
+typedef struct _dsl_meta_export_label
+{
+    /**
+     * @brief unique component id of the classifier.
+     */
+    uint32_t unique_component_id;
+
+    int32_t result_class_id;
+    float result_prob;
+
+    /**
+     * @brief length of the label that follows this record.
+     */
+    uint8_t label_length;
+
+} dsl_meta_export_label;
+
+#pragma pack(pop)
+
+#endif // _DSL_META_EXPORT_FORMAT_H
@@ -0,0 +1,299 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMetaExportReader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if !defined(BUILD_WITH_ZSTD)
+    #error "BUILD_WITH_ZSTD must be defined"
+#elif BUILD_WITH_ZSTD == true
+    #include <zstd.h>
+#endif
+
+namespace DSL
+{
+    MetaExportReader::MetaExportReader(const char* name, const char* filePath)
+        : m_name(name)
+        , m_filePath(filePath)
+        , m_fd(-1)
+        , m_startTime(0)
+        , m_recordOffset(0)
+        , m_recordsRemaining(0)
+        , m_bytesRead(0)
+        , m_recordsSkipped(0)
+    {
+        LOG_FUNC();
+        
+        m_fd = open(m_filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (m_fd < 0)
+        {
+            LOG_ERROR("MetaExportReader '" << m_name << "' failed to open '" 
+                << m_filePath << "' with errno = " << errno);
+            throw std::exception();
+        }
+        if (!Rewind())
+        {
+            close(m_fd);
+            throw std::exception();
+        }
+    }
+    
+    MetaExportReader::~MetaExportReader()
+    {
+        LOG_FUNC();
+        
+        close(m_fd);
+    }
+    
+    bool MetaExportReader::Rewind()
+    {
+        LOG_FUNC();
+        
+        m_block.clear();
+        m_recordOffset = 0;
+        m_recordsRemaining = 0;
+        m_bytesRead = 0;
+        m_recordsSkipped = 0;
+        
+        dsl_meta_export_stream_header header{0};
+        if (lseek(m_fd, 0, SEEK_SET) != 0 or 
+            !ReadAll(&header, sizeof(header)) or
+            header.magic != DSL_META_EXPORT_STREAM_MAGIC or
+            header.version < DSL_META_EXPORT_VERSION)
+        {
+            LOG_ERROR("'" << m_filePath << "' is not a metadata export stream for "
+                << "MetaExportReader '" << m_name << "'");
+            return false;
+        }
+        m_startTime = header.start_time;
+        
+        return true;
+    }
+    
+    const dsl_meta_export_batch* MetaExportReader::ReadRecord()
+    {
+        // don't log function for performance
+        
+        while (true)
+        {
+            if (!m_recordsRemaining)
+            {
+                if (!ReadBlock())
+                {
+                    return NULL;
+                }
+                continue;
+            }
+            const dsl_meta_export_batch* pRecord = 
+                (const dsl_meta_export_batch*)(m_block.data() + m_recordOffset);
+            size_t available = m_block.size() - m_recordOffset;
+            
+            // The next record can't be found once a record size is corrupt,
+            // so the remainder of the block is skipped.
+            if (available < sizeof(dsl_meta_export_batch) or
+                pRecord->record_size < sizeof(dsl_meta_export_batch) or
+                pRecord->record_size > available)
+            {
+                LOG_WARN("MetaExportReader '" << m_name << "' skipping " 
+                    << m_recordsRemaining << " records of a corrupt block");
+                m_recordsSkipped += m_recordsRemaining;
+                m_recordsRemaining = 0;
+                continue;
+            }
+            m_recordOffset += pRecord->record_size;
+            m_recordsRemaining--;
+            
+            if (pRecord->record_type != DSL_META_EXPORT_RECORD_TYPE_BATCH or
+                !ValidateRecord(pRecord, pRecord->record_size))
+            {
+                m_recordsSkipped++;
+                continue;
+            }
+            return pRecord;
+        }
+    }
+    
+    bool MetaExportReader::ValidateRecord(const dsl_meta_export_batch* pRecord,
+        size_t size)
+    {
+        // don't log function for performance
+        
+        if (size < sizeof(dsl_meta_export_batch) or pRecord->record_size > size or
+            pRecord->record_size < sizeof(dsl_meta_export_batch))
+        {
+            return false;
+        }
+        const uint8_t* pBytes = (const uint8_t*)pRecord;
+        size_t end = pRecord->record_size;
+        size_t pos = sizeof(dsl_meta_export_batch);
+        
+        for (uint frameNum = 0; frameNum < pRecord->num_frames; frameNum++)
+        {
+            if (pos + sizeof(dsl_meta_export_frame) > end)
+            {
+                return false;
+            }
+            const dsl_meta_export_frame* pFrame = 
+                (const dsl_meta_export_frame*)(pBytes + pos);
+            pos += sizeof(dsl_meta_export_frame);
+            
+            for (uint objectNum = 0; objectNum < pFrame->num_objects; objectNum++)
+            {
+                if (pos + sizeof(dsl_meta_export_object) > end)
+                {
+                    return false;
+                }
+                const dsl_meta_export_object* pObject = 
+                    (const dsl_meta_export_object*)(pBytes + pos);
+                pos += sizeof(dsl_meta_export_object) + pObject->label_length;
+                
+                for (uint labelNum = 0; 
+                    labelNum < pObject->num_classifier_labels; labelNum++)
+                {
+                    if (pos + sizeof(dsl_meta_export_label) > end)
+                    {
+                        return false;
+                    }
+                    const dsl_meta_export_label* pLabel = 
+                        (const dsl_meta_export_label*)(pBytes + pos);
+                    pos += sizeof(dsl_meta_export_label) + pLabel->label_length;
+                }
+            }
+        }
+        return pos <= end;
+    }
+    
+    bool MetaExportReader::ReadBlock()
+    {
+        // don't log function for performance
+        
+        dsl_meta_export_block_header header{0};
+        
+        while (true)
+        {
+            // A clean end of the stream falls on a header boundary.
+            if (!ReadAll(&header.magic, sizeof(header.magic)))
+            {
+                return false;
+            }
+            if (header.magic == DSL_META_EXPORT_STREAM_MAGIC)
+            {
+                dsl_meta_export_stream_header streamHeader{0};
+                if (!ReadAll((uint8_t*)&streamHeader + sizeof(header.magic), 
+                    sizeof(streamHeader) - sizeof(header.magic)))
+                {
+                    break;
+                }
+                continue;
+            }
+            if (header.magic != DSL_META_EXPORT_BLOCK_MAGIC or
+                !ReadAll((uint8_t*)&header + sizeof(header.magic), 
+                    sizeof(header) - sizeof(header.magic)) or
+                header.raw_size > DSL_META_EXPORT_MAX_READ_BLOCK_SIZE or
+                header.stored_size > DSL_META_EXPORT_MAX_READ_BLOCK_SIZE)
+            {
+                break;
+            }
+            if (header.codec == DSL_META_EXPORT_CODEC_NONE)
+            {
+                if (header.raw_size != header.stored_size)
+                {
+                    break;
+                }
+                m_block.resize(header.raw_size);
+                if (!ReadAll(m_block.data(), m_block.size()))
+                {
+                    break;
+                }
+            }
+            else if (header.codec == DSL_META_EXPORT_CODEC_ZSTD)
+            {
+#if BUILD_WITH_ZSTD == true
+                m_stored.resize(header.stored_size);
+                if (!ReadAll(m_stored.data(), m_stored.size()))
+                {
+                    break;
+                }
+                m_block.resize(header.raw_size);
+                size_t rawSize = ZSTD_decompress(m_block.data(), m_block.size(),
+                    m_stored.data(), m_stored.size());
+                if (ZSTD_isError(rawSize) or rawSize != header.raw_size)
+                {
+                    LOG_ERROR("MetaExportReader '" << m_name 
+                        << "' failed to decompress block of '" 
+                        << m_filePath << "'");
+                    return false;
+                }
+#else
+                LOG_ERROR("To replay compressed streams, set BUILD_WITH_ZSTD=true in the Makefile");
+                return false;
+#endif
+            }
+            else
+            {
+                // Blocks of an unknown codec are skipped by their stored size.
+                if (lseek(m_fd, header.stored_size, SEEK_CUR) < 0)
+                {
+                    break;
+                }
+                m_bytesRead += header.stored_size;
+                m_recordsSkipped += header.num_records;
+                continue;
+            }
+            m_recordOffset = 0;
+            m_recordsRemaining = header.num_records;
+            
+            return true;
+        }
+        LOG_ERROR("MetaExportReader '" << m_name 
+            << "' found a truncated or corrupt block in '" << m_filePath << "'");
+        return false;
+    }
+    
+    bool MetaExportReader::ReadAll(void* pData, size_t size)
+    {
+        // don't log function for performance
+        
+        uint8_t* pBytes = (uint8_t*)pData;
+        while (size)
+        {
+            ssize_t bytesRead = read(m_fd, pBytes, size);
+            if (bytesRead < 0 and errno == EINTR)
+            {
+                continue;
+            }
+            if (bytesRead <= 0)
+            {
+                return false;
+            }
+            m_bytesRead += bytesRead;
+            pBytes += bytesRead;
+            size -= bytesRead;
+        }
+        return true;
+    }
+}
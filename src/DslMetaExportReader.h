@@ -0,0 +1,194 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_META_EXPORT_READER_H
+#define _DSL_META_EXPORT_READER_H
+
+#include "Dsl.h"
+#include "DslMetaExportFormat.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_META_EXPORT_READER_PTR std::shared_ptr<MetaExportReader>
+    #define DSL_META_EXPORT_READER_NEW(name, filePath) \
+        std::shared_ptr<MetaExportReader>(new MetaExportReader(name, filePath))
+
+    /**
+     * @brief maximum size of a block payload accepted by the reader, before
+     * and after decompression. Guards against allocating for a corrupt header.
+     */
+    #define DSL_META_EXPORT_MAX_READ_BLOCK_SIZE                     (64*1024*1024)
+
+    /**
+     * @class MetaExportReader
+     * @brief Reads the batch records of a block stream (DslMetaExportFormat.h)
+     * recorded to a file by the Metadata Export Sink, one record at a time.
+     * Stream headers found between blocks, written on each reconnect of a 
+     * recorded socket, are skipped.
+     */
+    class MetaExportReader
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MetaExportReader class. Throws on failure to 
+         * open the file or on an invalid stream header.
+         * @param[in] name name of the owning component for logging.
+         * @param[in] filePath path to the recorded stream.
+         */
+        MetaExportReader(const char* name, const char* filePath);
+
+        /**
+         * @brief dtor for the MetaExportReader class.
+         */
+        ~MetaExportReader();
+        
+        /**
+         * @brief Rewinds the reader to the first record of the stream.
+         * @return true on success, false otherwise.
+         */
+        bool Rewind();
+        
+        /**
+         * @brief Reads the next valid batch record from the stream. Records
+         * of unknown type and records that fail validation are skipped.
+         * @return pointer to the record, valid until the next call to 
+         * ReadRecord or Rewind. NULL at the end of the stream or on a read, 
+         * format, or decompression error.
+         */
+        const dsl_meta_export_batch* ReadRecord();
+        
+        /**
+         * @brief Gets the wall-clock start time of the stream.
+         * @return start time in nanoseconds since the epoch.
+         */
+        uint64_t GetStartTime()
+        {
+            return m_startTime;
+        };
+        
+        /**
+         * @brief Gets the number of bytes read from the file since the 
+         * reader was created or last rewound.
+         * @return number of bytes read.
+         */
+        uint64_t GetBytesRead()
+        {
+            return m_bytesRead;
+        };
+        
+        /**
+         * @brief Gets the number of records skipped since the reader was
+         * created or last rewound.
+         * @return number of records skipped.
+         */
+        uint64_t GetRecordsSkipped()
+        {
+            return m_recordsSkipped;
+        };
+        
+        /**
+         * @brief Validates that all frame, object and label records of a 
+         * batch record, including their labels, lie within its record_size.
+         * @param[in] pRecord batch record to validate.
+         * @param[in] size number of bytes available at pRecord.
+         * @return true if the record can be walked safely, false otherwise.
+         */
+        static bool ValidateRecord(const dsl_meta_export_batch* pRecord, 
+            size_t size);
+        
+    private:
+    
+        /**
+         * @brief Reads and validates the next block, decompressing its payload
+         * if required. Stream headers preceding the block are skipped.
+         * @return true if a block was read, false at the end of the stream or 
+         * on error.
+         */
+        bool ReadBlock();
+        
+        /**
+         * @brief Reads exactly size bytes from the file.
+         * @param[out] pData buffer to read into.
+         * @param[in] size number of bytes to read.
+         * @return true on success, false at the end of the file or on error.
+         */
+        bool ReadAll(void* pData, size_t size);
+    
+        /**
+         * @brief name of the owning component.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief path to the recorded stream.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief file descriptor for the recorded stream.
+         */
+        int m_fd;
+        
+        /**
+         * @brief start time from the first stream header.
+         */
+        uint64_t m_startTime;
+        
+        /**
+         * @brief payload of the current block after decompression.
+         */
+        std::vector<uint8_t> m_block;
+        
+        /**
+         * @brief payload of the current block as stored, if compressed.
+         */
+        std::vector<uint8_t> m_stored;
+        
+        /**
+         * @brief offset of the next record in the current block.
+         */
+        size_t m_recordOffset;
+        
+        /**
+         * @brief number of records remaining in the current block.
+         */
+        uint m_recordsRemaining;
+        
+        /**
+         * @brief number of bytes read since created or last rewound.
+         */
+        uint64_t m_bytesRead;
+        
+        /**
+         * @brief number of records skipped since created or last rewound.
+         */
+        uint64_t m_recordsSkipped;
+    };
+}
+
+#endif // _DSL_META_EXPORT_READER_H
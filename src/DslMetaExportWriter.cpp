@@ -0,0 +1,407 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMetaExportWriter.h"
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if !defined(BUILD_WITH_ZSTD)
+    #error "BUILD_WITH_ZSTD must be defined"
+#elif BUILD_WITH_ZSTD == true
+    #include <zstd.h>
+#endif
+
+namespace DSL
+{
+    MetaExportWriter::MetaExportWriter(const char* name, uint transport, 
+        const char* location, uint compressionLevel, uint queueSize)
+        : m_name(name)
+        , m_transport(transport)
+        , m_location(location)
+        , m_compressionLevel(compressionLevel)
+        , m_queueSize(queueSize)
+        , m_fd(-1)
+        , m_nextConnectTime(0)
+        , m_peakQueueDepth(0)
+        , m_recordsWritten(0)
+        , m_recordsDropped(0)
+        , m_rawBytes(0)
+        , m_bytesWritten(0)
+        , m_connects(0)
+        , m_pWriteThread(NULL)
+        , m_stopWrite(false)
+    {
+        LOG_FUNC();
+        
+        if (m_transport > DSL_SINK_META_EXPORT_TRANSPORT_TCP or !m_queueSize or
+            m_compressionLevel > DSL_META_EXPORT_MAX_COMPRESSION_LEVEL)
+        {
+            LOG_ERROR("Invalid parameters for MetaExportWriter '" 
+                << m_name << "'");
+            throw std::exception();
+        }
+#if BUILD_WITH_ZSTD != true
+        if (m_compressionLevel)
+        {
+            LOG_ERROR("To use compression, set BUILD_WITH_ZSTD=true in the Makefile");
+            throw std::exception();
+        }
+#endif
+        if (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_UNIX and 
+            m_location.size() >= sizeof(sockaddr_un::sun_path))
+        {
+            LOG_ERROR("Socket path '" << m_location 
+                << "' is too long for MetaExportWriter '" << m_name << "'");
+            throw std::exception();
+        }
+        if (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_TCP and
+            m_location.rfind(':') == std::string::npos)
+        {
+            LOG_ERROR("Location '" << m_location 
+                << "' is not host:port for MetaExportWriter '" << m_name << "'");
+            throw std::exception();
+        }
+        
+        // Fail on create for a bad file path. Sockets are connected on first
+        // write so that the reader can be started after the Pipeline.
+        if (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_FILE and !Open())
+        {
+            throw std::exception();
+        }
+        m_pWriteThread = g_thread_new("dsl-meta-export", 
+            meta_export_write_thread, this);
+    }
+    
+    MetaExportWriter::~MetaExportWriter()
+    {
+        LOG_FUNC();
+        
+        g_mutex_lock(&m_writeMutex);
+        m_stopWrite = true;
+        g_cond_signal(&m_writeCond);
+        g_mutex_unlock(&m_writeMutex);
+        
+        g_thread_join(m_pWriteThread);
+        
+        Close();
+    }
+
+    bool MetaExportWriter::QueueRecord(std::vector<uint8_t>& record)
+    {
+        // don't log function for performance
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writeMutex);
+        
+        if (m_recordQueue.size() >= m_queueSize)
+        {
+            m_recordsDropped++;
+            return false;
+        }
+        m_recordQueue.push_back(std::move(record));
+        m_peakQueueDepth = std::max(m_peakQueueDepth, 
+            (uint)m_recordQueue.size());
+            
+        g_cond_signal(&m_writeCond);
+        return true;
+    }
+
+    void MetaExportWriter::GetStats(dsl_meta_export_sink_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writeMutex);
+        
+        stats->queue_depth = m_recordQueue.size();
+        stats->peak_queue_depth = m_peakQueueDepth;
+        stats->connects = m_connects;
+        stats->records_written = m_recordsWritten;
+        stats->records_dropped = m_recordsDropped;
+        stats->raw_bytes = m_rawBytes;
+        stats->bytes_written = m_bytesWritten;
+    }
+    
+    void MetaExportWriter::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writeMutex);
+        
+        m_peakQueueDepth = m_recordQueue.size();
+        m_connects = 0;
+        m_recordsWritten = 0;
+        m_recordsDropped = 0;
+        m_rawBytes = 0;
+        m_bytesWritten = 0;
+    }
+    
+    void MetaExportWriter::HandleWrite()
+    {
+        LOG_FUNC();
+        
+        std::vector<uint8_t> payload;
+#if BUILD_WITH_ZSTD == true
+        std::vector<uint8_t> compressed;
+        ZSTD_CCtx* pCCtx = (m_compressionLevel) ? ZSTD_createCCtx() : NULL;
+#endif
+        g_mutex_lock(&m_writeMutex);
+        
+        // Queued records are written before stopping.
+        while (m_recordQueue.size() or !m_stopWrite)
+        {
+            if (m_recordQueue.empty())
+            {
+                g_cond_wait(&m_writeCond, &m_writeMutex);
+                continue;
+            }
+            // Coalesce all queued records, up to the maximum block size, so 
+            // that a lagging writer makes fewer and better compressed writes.
+            uint numRecords(0);
+            payload.clear();
+            while (m_recordQueue.size() and (payload.empty() or 
+                payload.size() + m_recordQueue.front().size() 
+                    <= DSL_META_EXPORT_MAX_BLOCK_SIZE))
+            {
+                payload.insert(payload.end(), m_recordQueue.front().begin(),
+                    m_recordQueue.front().end());
+                m_recordQueue.pop_front();
+                numRecords++;
+            }
+            g_mutex_unlock(&m_writeMutex);
+            
+            dsl_meta_export_block_header header{DSL_META_EXPORT_BLOCK_MAGIC,
+                DSL_META_EXPORT_CODEC_NONE, 0, numRecords, 
+                (uint32_t)payload.size(), (uint32_t)payload.size()};
+            const uint8_t* pPayload = payload.data();
+            
+#if BUILD_WITH_ZSTD == true
+            if (pCCtx)
+            {
+                compressed.resize(ZSTD_compressBound(payload.size()));
+                size_t compressedSize = ZSTD_compressCCtx(pCCtx, 
+                    compressed.data(), compressed.size(), 
+                    payload.data(), payload.size(), m_compressionLevel);
+                    
+                // The block is written uncompressed on failure.
+                if (ZSTD_isError(compressedSize))
+                {
+                    LOG_ERROR("MetaExportWriter '" << m_name 
+                        << "' failed to compress block: " 
+                        << ZSTD_getErrorName(compressedSize));
+                }
+                else
+                {
+                    header.codec = DSL_META_EXPORT_CODEC_ZSTD;
+                    header.stored_size = compressedSize;
+                    pPayload = compressed.data();
+                }
+            }
+#endif
+            bool written = WriteBlock(&header, pPayload);
+            
+            g_mutex_lock(&m_writeMutex);
+            
+            if (written)
+            {
+                m_recordsWritten += numRecords;
+                m_rawBytes += header.raw_size;
+                m_bytesWritten += sizeof(header) + header.stored_size;
+            }
+            else
+            {
+                m_recordsDropped += numRecords;
+            }
+        }
+        g_mutex_unlock(&m_writeMutex);
+        
+#if BUILD_WITH_ZSTD == true
+        ZSTD_freeCCtx(pCCtx);
+#endif
+    }
+    
+    bool MetaExportWriter::Open()
+    {
+        LOG_FUNC();
+        
+        if (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_FILE)
+        {
+            m_fd = open(m_location.c_str(), 
+                O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (m_fd < 0)
+            {
+                LOG_ERROR("MetaExportWriter '" << m_name << "' failed to open '" 
+                    << m_location << "' with errno = " << errno);
+                return false;
+            }
+        }
+        else if (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_UNIX)
+        {
+            sockaddr_un address{0};
+            address.sun_family = AF_UNIX;
+            strncpy(address.sun_path, m_location.c_str(), 
+                sizeof(address.sun_path)-1);
+                
+            m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (m_fd >= 0 and connect(m_fd, (sockaddr*)&address, 
+                sizeof(address)) != 0)
+            {
+                Close();
+            }
+        }
+        else
+        {
+            size_t separator = m_location.rfind(':');
+            std::string host = m_location.substr(0, separator);
+            std::string port = m_location.substr(separator+1);
+            
+            addrinfo hints{0};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            addrinfo* pAddresses(NULL);
+            
+            if (getaddrinfo(host.c_str(), port.c_str(), &hints, &pAddresses) == 0)
+            {
+                for (addrinfo* pAddress = pAddresses; pAddress and m_fd < 0; 
+                    pAddress = pAddress->ai_next)
+                {
+                    m_fd = socket(pAddress->ai_family, 
+                        pAddress->ai_socktype | SOCK_CLOEXEC, 
+                        pAddress->ai_protocol);
+                    if (m_fd >= 0 and connect(m_fd, pAddress->ai_addr, 
+                        pAddress->ai_addrlen) != 0)
+                    {
+                        Close();
+                    }
+                }
+                freeaddrinfo(pAddresses);
+            }
+        }
+        if (m_fd < 0)
+        {
+            LOG_WARN("MetaExportWriter '" << m_name 
+                << "' failed to connect to '" << m_location << "'");
+            return false;
+        }
+        if (m_transport != DSL_SINK_META_EXPORT_TRANSPORT_FILE)
+        {
+            // Bound the time the writer thread can be blocked by a reader
+            // that stops reading.
+            timeval timeout{DSL_META_EXPORT_RECONNECT_INTERVAL_US/1000000, 0};
+            setsockopt(m_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writeMutex);
+            m_connects++;
+        }
+        dsl_meta_export_stream_header header{DSL_META_EXPORT_STREAM_MAGIC,
+            DSL_META_EXPORT_VERSION, 0, (uint64_t)g_get_real_time()*1000};
+            
+        if (!WriteAll(&header, sizeof(header)))
+        {
+            Close();
+            return false;
+        }
+        LOG_INFO("MetaExportWriter '" << m_name << "' opened '" 
+            << m_location << "'");
+        return true;
+    }
+    
+    void MetaExportWriter::Close()
+    {
+        LOG_FUNC();
+        
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+    }
+    
+    bool MetaExportWriter::WriteBlock(dsl_meta_export_block_header* pHeader, 
+        const uint8_t* pPayload)
+    {
+        // don't log function for performance
+        
+        if (m_fd < 0)
+        {
+            // A file is never reopened as it would be truncated. Sockets are
+            // reconnected at most once per interval, dropping blocks between.
+            if (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_FILE or
+                g_get_monotonic_time() < m_nextConnectTime)
+            {
+                return false;
+            }
+            if (!Open())
+            {
+                m_nextConnectTime = g_get_monotonic_time() 
+                    + DSL_META_EXPORT_RECONNECT_INTERVAL_US;
+                return false;
+            }
+        }
+        if (!WriteAll(pHeader, sizeof(*pHeader)) or
+            !WriteAll(pPayload, pHeader->stored_size))
+        {
+            LOG_ERROR("MetaExportWriter '" << m_name << "' failed to write to '"
+                << m_location << "' with errno = " << errno);
+            Close();
+            m_nextConnectTime = g_get_monotonic_time() 
+                + DSL_META_EXPORT_RECONNECT_INTERVAL_US;
+            return false;
+        }
+        return true;
+    }
+    
+    bool MetaExportWriter::WriteAll(const void* pData, size_t size)
+    {
+        // don't log function for performance
+        
+        const uint8_t* pBytes = (const uint8_t*)pData;
+        while (size)
+        {
+            // MSG_NOSIGNAL - a closed socket must not raise SIGPIPE.
+            ssize_t written = (m_transport == DSL_SINK_META_EXPORT_TRANSPORT_FILE)
+                ? write(m_fd, pBytes, size)
+                : send(m_fd, pBytes, size, MSG_NOSIGNAL);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            pBytes += written;
+            size -= written;
+        }
+        return true;
+    }
+    
+    static gpointer meta_export_write_thread(gpointer pMetaExportWriter)
+    {
+        static_cast<MetaExportWriter*>(pMetaExportWriter)->HandleWrite();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,257 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_META_EXPORT_WRITER_H
+#define _DSL_META_EXPORT_WRITER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslMetaExportFormat.h"
+
+#include <deque>
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_META_EXPORT_WRITER_PTR std::shared_ptr<MetaExportWriter>
+    #define DSL_META_EXPORT_WRITER_NEW(name, transport, location, \
+        compressionLevel, queueSize) \
+        std::shared_ptr<MetaExportWriter>(new MetaExportWriter(name, \
+            transport, location, compressionLevel, queueSize))
+
+    /**
+     * @brief maximum zstd compression level for the block payload.
+     */
+    #define DSL_META_EXPORT_MAX_COMPRESSION_LEVEL                   19
+    
+    /**
+     * @brief maximum size of a block payload before compression. Queued 
+     * records are written in a single block up to this size.
+     */
+    #define DSL_META_EXPORT_MAX_BLOCK_SIZE                          (1024*1024)
+
+    /**
+     * @brief time to wait before reconnecting to a socket that failed to
+     * connect or was closed by the reader.
+     */
+    #define DSL_META_EXPORT_RECONNECT_INTERVAL_US                   1000000
+
+    /**
+     * @class MetaExportWriter
+     * @brief Writes batch records to a file, Unix domain socket or TCP 
+     * socket as a block stream (DslMetaExportFormat.h). Records are queued 
+     * by the caller and written by the writer's own thread, so that a slow
+     * or disconnected reader never blocks the caller. Records are dropped 
+     * when the queue is full, and while a socket is disconnected.
+     */
+    class MetaExportWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MetaExportWriter class. Throws on failure to 
+         * open the file, or on invalid parameters. Sockets are connected by
+         * the writer thread on first write.
+         * @param[in] name name of the owning component for logging.
+         * @param[in] transport one of the DSL_SINK_META_EXPORT_TRANSPORT values.
+         * @param[in] location file path, Unix domain socket path, or 
+         * "host:port" for TCP.
+         * @param[in] compressionLevel zstd compression level for each block, 
+         * 0 to disable compression.
+         * @param[in] queueSize maximum number of records to queue.
+         */
+        MetaExportWriter(const char* name, uint transport, 
+            const char* location, uint compressionLevel, uint queueSize);
+
+        /**
+         * @brief dtor for the MetaExportWriter class. Writes all queued
+         * records, stops the writer thread and closes the file or socket.
+         */
+        ~MetaExportWriter();
+        
+        /**
+         * @brief Queues a batch record for the writer thread.
+         * @param[in] record complete batch record starting with a 
+         * dsl_meta_export_batch header. Moved into the queue.
+         * @return false if the record was dropped, true otherwise.
+         */
+        bool QueueRecord(std::vector<uint8_t>& record);
+        
+        /**
+         * @brief Gets the current stats for the MetaExportWriter.
+         * @param[out] stats current stats.
+         */
+        void GetStats(dsl_meta_export_sink_stats* stats);
+        
+        /**
+         * @brief Clears all counters, and resets the peak queue depth to the 
+         * current depth.
+         */
+        void ClearStats();
+        
+        /**
+         * @brief Writer thread function. Writes queued records in blocks
+         * until stopped.
+         */
+        void HandleWrite();
+        
+    private:
+    
+        /**
+         * @brief Opens the file, or connects to the socket, and writes the 
+         * stream header.
+         * @return true on success, false otherwise.
+         */
+        bool Open();
+        
+        /**
+         * @brief Closes the file or socket.
+         */
+        void Close();
+        
+        /**
+         * @brief Writes a block to the file or socket, closing a socket
+         * on failure.
+         * @param[in] pHeader block header to write.
+         * @param[in] pPayload block payload of pHeader->stored_size bytes.
+         * @return true on success, false otherwise.
+         */
+        bool WriteBlock(dsl_meta_export_block_header* pHeader, 
+            const uint8_t* pPayload);
+        
+        /**
+         * @brief Writes all bytes to the file or socket.
+         * @param[in] pData data to write.
+         * @param[in] size number of bytes to write.
+         * @return true on success, false otherwise.
+         */
+        bool WriteAll(const void* pData, size_t size);
+    
+        /**
+         * @brief name of the owning component.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief one of the DSL_SINK_META_EXPORT_TRANSPORT values.
+         */
+        uint m_transport;
+        
+        /**
+         * @brief file path, socket path, or host:port.
+         */
+        std::string m_location;
+        
+        /**
+         * @brief zstd compression level, 0 if disabled.
+         */
+        uint m_compressionLevel;
+        
+        /**
+         * @brief maximum number of records to queue.
+         */
+        uint m_queueSize;
+        
+        /**
+         * @brief file or socket descriptor, -1 when closed.
+         */
+        int m_fd;
+        
+        /**
+         * @brief monotonic time in microseconds before which a socket is not
+         * reconnected.
+         */
+        int64_t m_nextConnectTime;
+        
+        /**
+         * @brief queue of records waiting to be written.
+         */
+        std::deque<std::vector<uint8_t>> m_recordQueue;
+        
+        /**
+         * @brief peak depth of the record queue since the stats were cleared.
+         */
+        uint m_peakQueueDepth;
+        
+        /**
+         * @brief number of records written since the stats were cleared.
+         */
+        uint64_t m_recordsWritten;
+        
+        /**
+         * @brief number of records dropped since the stats were cleared.
+         */
+        uint64_t m_recordsDropped;
+        
+        /**
+         * @brief number of record bytes written before compression since 
+         * the stats were cleared.
+         */
+        uint64_t m_rawBytes;
+        
+        /**
+         * @brief number of bytes written to the file or socket since the 
+         * stats were cleared.
+         */
+        uint64_t m_bytesWritten;
+        
+        /**
+         * @brief number of successful socket connections since the stats 
+         * were cleared.
+         */
+        uint m_connects;
+        
+        /**
+         * @brief writer thread, NULL when not running.
+         */
+        GThread* m_pWriteThread;
+        
+        /**
+         * @brief set to stop the writer thread once the queue is empty.
+         */
+        bool m_stopWrite;
+        
+        /**
+         * @brief mutex to protect the record queue and stats.
+         */
+        DslMutex m_writeMutex;
+        
+        /**
+         * @brief condition to signal the writer thread on new records 
+         * and stop.
+         */
+        DslCond m_writeCond;
+    };
+
+    /**
+     * @brief Thread function for the MetaExportWriter.
+     * @param[in] pMetaExportWriter pointer to the MetaExportWriter instance.
+     * @return NULL always.
+     */
+    static gpointer meta_export_write_thread(gpointer pMetaExportWriter);
+}
+
+#endif // _DSL_META_EXPORT_WRITER_H
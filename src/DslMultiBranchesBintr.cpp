@@ -308,6 +308,7 @@ namespace DSL
             imap.second->SetBatchSize(m_batchSize);
             
             // link back upstream to the Tee, the src for this Child Component 
+            gint64 linkStartTime = g_get_monotonic_time();
             if (!imap.second->LinkAll() or 
                 !imap.second->LinkToSourceTee(m_pTee, "src_%u"))
             {
@@ -316,6 +317,7 @@ namespace DSL
                     << imap.second->GetName() << "'");
                 return false;
             }
+            imap.second->SetLinkTime(g_get_monotonic_time() - linkStartTime);
         }
         m_isLinked = true;
         return true;
@@ -1160,12 +1160,12 @@ namespace DSL
             }
             bool result(false);
 
-            if (pad == DSL_PAD_SINK)
+            if (pad == DSL_PAD_SINK and m_pSinkPadBufferProbe)
             {
                 result = m_pSinkPadBufferProbe->AddPadProbeHandler(
                     pPadProbeHandler);
             }
-            else if (pad == DSL_PAD_SRC)
+            else if (pad == DSL_PAD_SRC and m_pSrcPadBufferProbe)
             {
                 result = m_pSrcPadBufferProbe->AddPadProbeHandler(
                     pPadProbeHandler);
@@ -1194,12 +1194,12 @@ namespace DSL
             
             bool result(false);
 
-            if (pad == DSL_PAD_SINK)
+            if (pad == DSL_PAD_SINK and m_pSinkPadBufferProbe)
             {
                 result = m_pSinkPadBufferProbe->RemovePadProbeHandler(
                     pPadProbeHandler);
             }
-            else if (pad == DSL_PAD_SRC)
+            else if (pad == DSL_PAD_SRC and m_pSrcPadBufferProbe)
             {
                 result = m_pSrcPadBufferProbe->RemovePadProbeHandler(
                     pPadProbeHandler);
@@ -31,6 +31,7 @@ namespace DSL
 
     OdeAccumulator::OdeAccumulator(const char* name)
         : OdeBase(name)
+        , m_pParentStats(NULL)
     {
         LOG_FUNC();
     }
@@ -43,7 +44,7 @@ namespace DSL
     }
 
     void OdeAccumulator::HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         for (const auto &imap: m_pOdeActionsIndexed)
@@ -52,7 +53,7 @@ namespace DSL
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
             try
             {
-                pOdeAction->HandleOccurrence(pOdeTrigger, pBuffer, 
+                pOdeAction->InvokeOccurrence(pOdeTrigger, pBuffer, 
                     displayMetaData, pFrameMeta, NULL);
             }
             catch(...)
@@ -82,6 +83,11 @@ namespace DSL
         m_pOdeActions[pChild->GetName()] = pChild;
         m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
         
+        if (m_pParentStats)
+        {
+            m_pParentStats->AddComponent(
+                std::dynamic_pointer_cast<OdeBase>(pChild).get());
+        }
         return true;
     }
 
@@ -100,6 +106,11 @@ namespace DSL
         m_pOdeActions.erase(pChild->GetName());
         m_pOdeActionsIndexed.erase(pChild->GetIndex());
 
+        if (m_pParentStats)
+        {
+            m_pParentStats->RemoveComponent(
+                std::dynamic_pointer_cast<OdeBase>(pChild).get());
+        }
         // Clear the parent relationship and index
         pChild->ClearParentName();
         pChild->SetIndex(0);
@@ -114,10 +125,35 @@ namespace DSL
         {
             LOG_DEBUG("Removing Action '" << imap.second->GetName() 
                 <<"' from OdeAccumulator '" << GetName() << "'");
+            if (m_pParentStats)
+            {
+                m_pParentStats->RemoveComponent(
+                    std::dynamic_pointer_cast<OdeBase>(imap.second).get());
+            }
             imap.second->ClearParentName();
         }
         m_pOdeActions.clear();
         m_pOdeActionsIndexed.clear();
     }
     
+    void OdeAccumulator::SetParentStats(OdeStats* pParentStats)
+    {
+        LOG_FUNC();
+        
+        for (auto &imap: m_pOdeActions)
+        {
+            OdeBase* pOdeAction = 
+                std::dynamic_pointer_cast<OdeBase>(imap.second).get();
+            if (m_pParentStats)
+            {
+                m_pParentStats->RemoveComponent(pOdeAction);
+            }
+            if (pParentStats)
+            {
+                pParentStats->AddComponent(pOdeAction);
+            }
+        }
+        m_pParentStats = pParentStats;
+    }
+    
 }
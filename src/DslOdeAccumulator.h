@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslOdeBase.h"
+#include "DslOdeStats.h"
 
 namespace DSL
 {
@@ -61,7 +62,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -82,6 +83,13 @@ namespace DSL
          * @brief Removes all child ODE Actions from this OdeAccumulator
          */
         void RemoveAllActions(); 
+        
+        /**
+         * @brief Sets the stats of the parent Trigger's ODE Handler, adding 
+         * this OdeAccumulator's Actions to them.
+         * @param[in] pParentStats stats of the parent Handler, NULL on removal.
+         */
+        void SetParentStats(OdeStats* pParentStats);
 
     private:
     
@@ -99,6 +107,11 @@ namespace DSL
          * @brief Map of child ODE Actions indexed by their add-order for execution
          */
         std::map <uint, DSL_BASE_PTR> m_pOdeActionsIndexed;
+        
+        /**
+         * @brief stats of the parent Trigger's ODE Handler, NULL if none.
+         */
+        OdeStats* m_pParentStats;
 
     };
 
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslOdeTrigger.h"
 #include "DslOdeAction.h"
+#include "DslAsyncActionExecutor.h"
 #include "DslDisplayTypes.h"
 
 #if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
@@ -35,6 +36,8 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    thread_local OdeActionGate* OdeActionGate::s_pCurrent(NULL);
+
     OdeAction::OdeAction(const char* name)
         : OdeBase(name)
     {
@@ -68,7 +71,6 @@ namespace DSL
 
     AsyncOdeAction::AsyncOdeAction(const char* name) 
         : OdeAction(name)
-        , m_timerId(0)
     {
         LOG_FUNC();
     };
@@ -77,38 +79,36 @@ namespace DSL
     {
         LOG_FUNC();
         
-        if (m_timerId)
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            LOG_WARN("Removing scheduled asynchronous action on dtor of '"
-                << GetName() << "'");
-                
-            g_source_remove(m_timerId);
-        }
+        // Drop any occurrences still queued. Not called with the property
+        // mutex held, as the executor may be running an occurrence now.
+        AsyncActionExecutor::GetExecutor()->Cancel(this);
     }
 
     void AsyncOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
         if (m_enabled)
         {
-            // Schedule the do_async_action to add the branch in 
-            // the main-loop context.
-            m_timerId = g_timeout_add(1, do_async_action, this);
-        }
-    }
-
-    static int do_async_action(gpointer pAction)
-    {
-        static_cast<AsyncOdeAction*>(pAction)->
-            DoAsyncAction();
+            // Queued occurrences hold a weak reference only, so they are
+            // dropped, not executed, once the Action has been deleted.
+            std::weak_ptr<Base> pWeakAction(shared_from_this());
+            uint sourceId = (pFrameMeta) ? pFrameMeta->source_id : 0;
             
-        // on-shot timer always
-        return false;
+            // Rejections, on a full queue, are counted by the executor.
+            AsyncActionExecutor::GetExecutor()->Submit(this, 
+                [pWeakAction, sourceId]()
+                {
+                    DSL_BASE_PTR pAction = pWeakAction.lock();
+                    if (pAction)
+                    {
+                        std::static_pointer_cast<AsyncOdeAction>(pAction)->
+                            DoAsyncAction(sourceId);
+                    }
+                });
+        }
     }
 
 
@@ -131,7 +131,7 @@ namespace DSL
     }
 
     void FormatBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -179,7 +179,7 @@ namespace DSL
     }
 
     void ScaleBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -264,7 +264,7 @@ namespace DSL
     }
 
     void StyleBBoxCornersOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -370,7 +370,7 @@ namespace DSL
     }
 
     void StyleBBoxCrosshairOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -451,7 +451,7 @@ namespace DSL
     }
     
     void CustomOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -462,14 +462,14 @@ namespace DSL
         }
         try
         {
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            if (displayMetaData.size())
-            {
-                pDisplayMeta = displayMetaData.at(0);
-            }
+            NvDsDisplayMeta* pDisplayMeta = displayMetaData.GetDisplayMeta();
+            
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
-            m_clientHandler(pTrigger->s_eventCount, pTrigger->m_wName.c_str(), 
+            DSL_ODE_TRIGGER_SOURCE_STATE_PTR pSourceState = 
+                OdeTriggerFrameView(pTrigger.get(), 
+                    pFrameMeta->source_id).GetSourceState();
+            m_clientHandler(pSourceState->m_eventId, pTrigger->m_wName.c_str(), 
                 pBuffer, pDisplayMeta, pFrameMeta, pObjectMeta, m_clientData);
         }
         catch(...)
@@ -498,7 +498,6 @@ namespace DSL
         , m_cudaDevicePropRead(false)
         , m_captureType(captureType)
         , m_outdir(outdir)
-        , m_idleThreadFunctionId(0)
     {
         LOG_FUNC();
     }
@@ -508,10 +507,10 @@ namespace DSL
         LOG_FUNC();
 
         // If the idle-thread for processing images is currently running.
-        if (m_idleThreadFunctionId)
+        if (m_idleThreadFunction)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureQueueMutex);
-            g_source_remove(m_idleThreadFunctionId);
+            m_idleThreadFunction.Remove();
         }
 
         RemoveAllChildren();
@@ -653,7 +652,7 @@ namespace DSL
     }
     
     void CaptureOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         HandleOccurrence(pBuffer, pFrameMeta, pObjectMeta);
@@ -785,10 +784,10 @@ namespace DSL
         
         m_pBufferSurfaces.push(pBufferSurface);
         
-        if (!m_idleThreadFunctionId)
+        if (!m_idleThreadFunction)
         {
             LOG_INFO("Starting idle thread for image processing");
-            m_idleThreadFunctionId = g_idle_add(idle_thread_handler, this);
+            m_idleThreadFunction.AddIdle(NULL, idle_thread_handler, this);
         }
     }
 
@@ -806,7 +805,7 @@ namespace DSL
             if (!m_pBufferSurfaces.size())
             {
                 LOG_ERROR("Buffer-Surface queue is empty");
-                m_idleThreadFunctionId = 0;
+                m_idleThreadFunction.Clear();
                 return FALSE;
             }
             
@@ -839,7 +838,7 @@ namespace DSL
         }
         catch(...)
         {
-            m_idleThreadFunctionId = 0;
+            m_idleThreadFunction.Clear();
             return FALSE;
         }
         LOG_INFO("Saved JPEG Image with id = " << pBufferSurface->GetUniqueId());
@@ -949,7 +948,7 @@ namespace DSL
             return TRUE;
         }
         // Else, clear the thread-function id and return false to NOT reschedule.
-        m_idleThreadFunctionId = 0;
+        m_idleThreadFunction.Clear();
         return FALSE;
     }
 
@@ -969,7 +968,7 @@ namespace DSL
     }
     
     void DisableHandlerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -983,6 +982,24 @@ namespace DSL
 
     // ********************************************************************
 
+    /**
+     * @brief Appends a printf formatted value to a Frame Arena String, 
+     * without the temporary std::string of std::to_string.
+     * @param[in,out] text string to append to.
+     * @param[in] format printf format string for the value(s).
+     */
+    static void AppendFormatted(FrameArenaString& text, const char* format, ...)
+    {
+        char value[64];
+        
+        va_list args;
+        va_start(args, format);
+        vsnprintf(value, sizeof(value), format, args);
+        va_end(args);
+        
+        text.append(value);
+    }
+
     CustomizeLabelOdeAction::CustomizeLabelOdeAction(const char* name, 
         const std::vector<uint>& contentTypes)
         : OdeAction(name)
@@ -1012,14 +1029,16 @@ namespace DSL
     }
 
     void CustomizeLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-    GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+    GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
     NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
         if (m_enabled and pObjectMeta)
         {   
-            std::string label;
+            // Scratch label, allocated from the current frame arena if any.
+            FrameArenaString label;
+            label.reserve(MAX_DISPLAY_LEN);
             
             // Free up the existing label memory, and reallocate to ensure suffcient size
             g_free(pObjectMeta->text_params.display_text);
@@ -1036,33 +1055,33 @@ namespace DSL
                     break;
                 case DSL_METRIC_OBJECT_TRACKING_ID:
                     label.append((label.size()) ? " | " : "");
-                    label.append(std::to_string(pObjectMeta->object_id));
+                    AppendFormatted(label, "%" G_GUINT64_FORMAT, 
+                        pObjectMeta->object_id);
                     break;
                 case DSL_METRIC_OBJECT_LOCATION :
                     label.append((label.size()) ? " | L:" : "L:");
-                    label.append(std::to_string(lrint(pObjectMeta->rect_params.left)));
-                    label.append(",");
-                    label.append(std::to_string(lrint(pObjectMeta->rect_params.top)));
+                    AppendFormatted(label, "%ld,%ld", 
+                        lrint(pObjectMeta->rect_params.left),
+                        lrint(pObjectMeta->rect_params.top));
                     break;
                 case DSL_METRIC_OBJECT_DIMENSIONS :
                     label.append(((label.size()) ? " | D:" : "D:"));
-                    label.append(std::to_string(lrint(pObjectMeta->rect_params.width)));
-                    label.append("x");
-                    label.append(std::to_string(lrint(pObjectMeta->rect_params.height)));
+                    AppendFormatted(label, "%ldx%ld", 
+                        lrint(pObjectMeta->rect_params.width),
+                        lrint(pObjectMeta->rect_params.height));
                     break;
                 case DSL_METRIC_OBJECT_CONFIDENCE_INFERENCE :
                     label.append(((label.size()) ? " | IC:" : "IC:"));
-                    label.append(std::to_string(pObjectMeta->confidence));
+                    AppendFormatted(label, "%f", pObjectMeta->confidence);
                     break;
                 case DSL_METRIC_OBJECT_CONFIDENCE_TRACKER :
                     label.append(((label.size()) ? " | TC:" : "TC:"));
-                    label.append(std::to_string(pObjectMeta->tracker_confidence));
+                    AppendFormatted(label, "%f", pObjectMeta->tracker_confidence);
                     break;
                 case DSL_METRIC_OBJECT_PERSISTENCE :
                     label.append(((label.size()) ? " | T:" : "T:"));
-                    label.append(std::to_string(pObjectMeta->
-                        misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE]));
-                    label.append("s");
+                    AppendFormatted(label, "%" G_GINT64_FORMAT "s", 
+                        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE]);
                     break;
                 default :
                     LOG_ERROR("Invalid 'object content type' for customize label action '" <<
@@ -1088,6 +1107,31 @@ namespace DSL
         , m_pBgColor(pBgColor)
     {
         LOG_FUNC();
+        
+        // Split the format string once, rather than searching it for each 
+        // of the tokens on every occurrence.
+        std::string literal;
+        for (size_t i = 0; i < m_formatString.size(); i++)
+        {
+            if (m_formatString[i] == '%' and i+1 < m_formatString.size() and
+                isdigit(m_formatString[i+1]))
+            {
+                int token = m_formatString[++i] - '0';
+                if (token == 1 and i+1 < m_formatString.size() and 
+                    m_formatString[i+1] == '0')
+                {
+                    token = 10;
+                    i++;
+                }
+                m_formatTokens.push_back(std::make_pair(literal, token));
+                literal.clear();
+            }
+            else
+            {
+                literal.push_back(m_formatString[i]);
+            }
+        }
+        m_formatTokens.push_back(std::make_pair(literal, -1));
     }
 
     DisplayOdeAction::~DisplayOdeAction()
@@ -1096,79 +1140,31 @@ namespace DSL
     }
 
     void DisplayOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and displayMetaData.IsEnabled())
         {
-            DSL_ODE_TRIGGER_PTR pTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
-
-            // check to see if we're adding meta data - client can disable
-            // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
-            if (!pDisplayMeta)
+            // ensure we have available space in the display meta.
+            NvOSD_TextParams *pTextParams = displayMetaData.AddText();
+            if (!pTextParams)
             {
                 return;
             }
-            
-            NvOSD_TextParams *pTextParams = 
-                &displayMetaData.at(0)->text_params[pDisplayMeta->num_labels++];
             pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
             
-            std::string text(m_formatString.c_str());
+            // Scratch text, allocated from the current frame arena if any.
+            FrameArenaString text;
+            text.reserve(MAX_DISPLAY_LEN);
             
-            if (pObjectMeta)
-            {
-                std::string location = 
-                    std::to_string(lrint(pObjectMeta->rect_params.left)) +
-                    "," + std::to_string(lrint(pObjectMeta->rect_params.top));
-                std::string dimensions = 
-                    std::to_string(lrint(pObjectMeta->rect_params.width)) +
-                    "x" + std::to_string(lrint(pObjectMeta->rect_params.height));
-                
-                text = std::regex_replace(text, std::regex("\%0"), 
-                    pObjectMeta->obj_label);
-                text = std::regex_replace(text, std::regex("\%1"), 
-                    std::to_string(pObjectMeta->object_id));
-                text = std::regex_replace(text, std::regex("\%2"), location);
-                text = std::regex_replace(text, std::regex("\%3"), dimensions);
-                text = std::regex_replace(text, std::regex("\%4"), 
-                    std::to_string(pObjectMeta->confidence));
-                text = std::regex_replace(text, std::regex("\%5"), 
-                    std::to_string(pObjectMeta->tracker_confidence));
-                text = std::regex_replace(text, std::regex("\%6"), 
-                    std::to_string(pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE]));
-            }
-            else
+            for (const auto &ivec: m_formatTokens)
             {
-                if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
-                    DSL_FRAME_INFO_OCCURRENCES)
+                text.append(ivec.first);
+                if (ivec.second >= 0)
                 {
-                    text = std::regex_replace(text, std::regex("\%8"), 
-                        std::to_string(pFrameMeta->misc_frame_info[
-                            DSL_FRAME_INFO_OCCURRENCES]));
-                }
-                else if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
-                    DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
-                {
-                    text = std::regex_replace(text, std::regex("\%9"), 
-                        std::to_string(pFrameMeta->misc_frame_info[
-                            DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN]));
-                    text = std::regex_replace(text, std::regex("\%10"), 
-                        std::to_string(pFrameMeta->misc_frame_info[
-                            DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT]));
+                    AppendTokenValue(text, ivec.second, pFrameMeta, pObjectMeta);
                 }
             }
             text.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
@@ -1188,11 +1184,80 @@ namespace DSL
             // Text background color
             pTextParams->set_bg_clr = m_hasBgColor;
             pTextParams->text_bg_clr = *m_pBgColor;
-            
-            nvds_add_display_meta_to_frame(pFrameMeta, displayMetaData.at(0));
         }
     }
     
+    void DisplayOdeAction::AppendTokenValue(FrameArenaString& text, int token,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (pObjectMeta)
+        {
+            switch (token)
+            {
+            case 0 :
+                text.append(pObjectMeta->obj_label);
+                return;
+            case 1 :
+                AppendFormatted(text, "%" G_GUINT64_FORMAT, 
+                    pObjectMeta->object_id);
+                return;
+            case 2 :
+                AppendFormatted(text, "%ld,%ld", 
+                    lrint(pObjectMeta->rect_params.left), 
+                    lrint(pObjectMeta->rect_params.top));
+                return;
+            case 3 :
+                AppendFormatted(text, "%ldx%ld", 
+                    lrint(pObjectMeta->rect_params.width), 
+                    lrint(pObjectMeta->rect_params.height));
+                return;
+            case 4 :
+                AppendFormatted(text, "%f", pObjectMeta->confidence);
+                return;
+            case 5 :
+                AppendFormatted(text, "%f", pObjectMeta->tracker_confidence);
+                return;
+            case 6 :
+                AppendFormatted(text, "%" G_GINT64_FORMAT, 
+                    pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE]);
+                return;
+            case 10 :
+                // "%1" takes precedence over "%10" for Object events.
+                AppendFormatted(text, "%" G_GUINT64_FORMAT "0", 
+                    pObjectMeta->object_id);
+                return;
+            }
+        }
+        else
+        {
+            gint64 activeIndex = 
+                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX];
+                
+            if (token == 8 and activeIndex == DSL_FRAME_INFO_OCCURRENCES)
+            {
+                AppendFormatted(text, "%" G_GINT64_FORMAT, 
+                    pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES]);
+                return;
+            }
+            if (token == 9 and 
+                activeIndex == DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
+            {
+                AppendFormatted(text, "%" G_GINT64_FORMAT, pFrameMeta->
+                    misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN]);
+                return;
+            }
+            if (token == 10 and 
+                activeIndex == DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
+            {
+                AppendFormatted(text, "%" G_GINT64_FORMAT, pFrameMeta->
+                    misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT]);
+                return;
+            }
+        }
+        // Tokens without a value for the event are displayed as is.
+        AppendFormatted(text, "%%%d", token);
+    }
+    
     // ********************************************************************
 
     EmailOdeAction::EmailOdeAction(const char* name, 
@@ -1210,7 +1275,7 @@ namespace DSL
     }
 
     void EmailOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1219,13 +1284,17 @@ namespace DSL
         {
             DSL_ODE_TRIGGER_PTR pTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+            OdeTriggerFrameView frame(pTrigger.get(), pFrameMeta->source_id);
+            const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+            const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+                frame.GetSourceState();
             
             std::vector<std::string> body;
             
             body.push_back(std::string("Trigger Name        : " 
                 + pTrigger->GetName() + "<br>"));
             body.push_back(std::string("  Unique ODE Id     : " 
-                + std::to_string(pTrigger->s_eventCount) + "<br>"));
+                + std::to_string(pSourceState->m_eventId) + "<br>"));
             body.push_back(std::string("  NTP Timestamp     : " 
                 +  Ntp2Str(pFrameMeta->ntp_timestamp) + "<br>"));
             body.push_back(std::string("  Source Data       : ------------------------<br>"));
@@ -1251,7 +1320,7 @@ namespace DSL
                 +  std::to_string(pFrameMeta->source_frame_height) + "<br>"));
             body.push_back(std::string("  Object Data       : ------------------------<br>"));
             body.push_back(std::string("    Occurrences     : " 
-                +  std::to_string(pTrigger->m_occurrences) + "<br>"));
+                +  std::to_string(pSourceState->m_occurrences) + "<br>"));
 
             if (pObjectMeta)
             {
@@ -1333,8 +1402,8 @@ namespace DSL
             }
             body.push_back(std::string("  Criteria          : ------------------------<br>"));
             body.push_back(std::string("    Class Id        : " 
-                +  std::to_string(pTrigger->m_classId) + "<br>"));
-            if (pTrigger->m_inferDoneOnly)
+                +  std::to_string(pConfig->m_classId) + "<br>"));
+            if (pConfig->m_inferDoneOnly)
             {
                 body.push_back(std::string("    Infer Done Only       : Yes<br>"));
             }
@@ -1343,20 +1412,20 @@ namespace DSL
                 body.push_back(std::string("    Inference       : No<br>"));
             }
             body.push_back(std::string("    Min Infer Conf  : " 
-                +  std::to_string(pTrigger->m_minConfidence) + "<br>"));
+                +  std::to_string(pConfig->m_minConfidence) + "<br>"));
             body.push_back(std::string("    Min Track Conf  : " 
-                +  std::to_string(pTrigger->m_minConfidence) + "<br>"));
+                +  std::to_string(pConfig->m_minConfidence) + "<br>"));
             body.push_back(std::string("    Min Frame Count : " 
-                +  std::to_string(pTrigger->m_minFrameCountN) + " out of " 
-                +  std::to_string(pTrigger->m_minFrameCountD) + "<br>"));
+                +  std::to_string(pConfig->m_minFrameCountN) + " out of " 
+                +  std::to_string(pConfig->m_minFrameCountD) + "<br>"));
             body.push_back(std::string("    Min Width       : " 
-                +  std::to_string(lrint(pTrigger->m_minWidth)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_minWidth)) + "<br>"));
             body.push_back(std::string("    Min Height      : " 
-                +  std::to_string(lrint(pTrigger->m_minHeight)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_minHeight)) + "<br>"));
             body.push_back(std::string("    Max Width       : " 
-                +  std::to_string(lrint(pTrigger->m_maxWidth)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_maxWidth)) + "<br>"));
             body.push_back(std::string("    Max Height      : " 
-                +  std::to_string(lrint(pTrigger->m_maxHeight)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_maxHeight)) + "<br>"));
             
             std::dynamic_pointer_cast<Mailer>(m_pMailer)->QueueMessage(m_subject, body);
         }
@@ -1370,7 +1439,6 @@ namespace DSL
         , m_filePath(filePath)
         , m_mode(mode)
         , m_forceFlush(forceFlush)
-        , m_flushThreadFunctionId(0)
     {
         LOG_FUNC();
     }
@@ -1384,10 +1452,10 @@ namespace DSL
             return;
         }
         
-        if (m_flushThreadFunctionId)
+        if (m_flushThreadFunction)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
-            g_source_remove(m_flushThreadFunctionId);
+            m_flushThreadFunction.Remove();
         }
             
         m_ostream.close();
@@ -1400,7 +1468,7 @@ namespace DSL
         m_ostream.flush();
         
         // end the thread
-        m_flushThreadFunctionId = 0;
+        m_flushThreadFunction.Clear();
         return false;
     }
 
@@ -1473,7 +1541,7 @@ namespace DSL
     }
 
     void FileTextOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1485,9 +1553,13 @@ namespace DSL
         }
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        OdeTriggerFrameView frame(pTrigger.get(), pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         m_ostream << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        m_ostream << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        m_ostream << "  Unique ODE Id     : " << pSourceState->m_eventId << "\n";
         m_ostream << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         m_ostream << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -1508,7 +1580,7 @@ namespace DSL
 
         if (pObjectMeta)
         {
-            m_ostream << "    Occurrences     : " << pTrigger->m_occurrences << "\n";
+            m_ostream << "    Occurrences     : " << pSourceState->m_occurrences << "\n";
             m_ostream << "    Obj ClassId     : " << pObjectMeta->class_id << "\n";
             m_ostream << "    Infer Id        : " << pObjectMeta->unique_component_id << "\n";
             m_ostream << "    Tracking Id     : " << pObjectMeta->object_id << "\n";
@@ -1559,17 +1631,17 @@ namespace DSL
         }
 
         m_ostream << "  Criteria          : ------------------------" << "\n";
-        m_ostream << "    Class Id        : " << pTrigger->m_classId << "\n";
-        m_ostream << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        m_ostream << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        m_ostream << "    Min Frame Count : " << pTrigger->m_minFrameCountN
-            << " out of " << pTrigger->m_minFrameCountD << "\n";
-        m_ostream << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        m_ostream << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        m_ostream << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        m_ostream << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
-
-        if (pTrigger->m_inferDoneOnly)
+        m_ostream << "    Class Id        : " << pConfig->m_classId << "\n";
+        m_ostream << "    Min Infer Conf  : " << pConfig->m_minConfidence << "\n";
+        m_ostream << "    Min Track Conf  : " << pConfig->m_minTrackerConfidence << "\n";
+        m_ostream << "    Min Frame Count : " << pConfig->m_minFrameCountN
+            << " out of " << pConfig->m_minFrameCountD << "\n";
+        m_ostream << "    Min Width       : " << lrint(pConfig->m_minWidth) << "\n";
+        m_ostream << "    Min Height      : " << lrint(pConfig->m_minHeight) << "\n";
+        m_ostream << "    Max Width       : " << lrint(pConfig->m_maxWidth) << "\n";
+        m_ostream << "    Max Height      : " << lrint(pConfig->m_maxHeight) << "\n";
+
+        if (pConfig->m_inferDoneOnly)
         {
             m_ostream << "    Inference   : Yes\n\n";
         }
@@ -1580,9 +1652,9 @@ namespace DSL
         
         // If we're force flushing the stream and the flush
         // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
+        if (m_forceFlush and !m_flushThreadFunction)
         {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+            m_flushThreadFunction.AddIdle(NULL, FileActionFlush, this);
         }
     }
 
@@ -1661,7 +1733,7 @@ namespace DSL
     }
 
     void FileCsvOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1673,9 +1745,13 @@ namespace DSL
         }
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        OdeTriggerFrameView frame(pTrigger.get(), pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         m_ostream << pTrigger->GetName() << ",";
-        m_ostream << pTrigger->s_eventCount << ",";
+        m_ostream << pSourceState->m_eventId << ",";
         m_ostream << pFrameMeta->ntp_timestamp << ",";
         if (pFrameMeta->bInferDone)
         {
@@ -1691,7 +1767,7 @@ namespace DSL
         m_ostream << pFrameMeta->frame_num << ",";
         m_ostream << pFrameMeta->source_frame_width << ",";
         m_ostream << pFrameMeta->source_frame_height << ",";
-        m_ostream << pTrigger->m_occurrences << ",";
+        m_ostream << pSourceState->m_occurrences << ",";
 
         if (pObjectMeta)
         {
@@ -1732,15 +1808,15 @@ namespace DSL
             m_ostream << "0,0,0,0,0";
         }
 
-        m_ostream << pTrigger->m_classId << ",";
-        m_ostream << lrint(pTrigger->m_minWidth) << ",";
-        m_ostream << lrint(pTrigger->m_minHeight) << ",";
-        m_ostream << lrint(pTrigger->m_maxWidth) << ",";
-        m_ostream << lrint(pTrigger->m_maxHeight) << ",";
-        m_ostream << pTrigger->m_minConfidence << ",";
-        m_ostream << pTrigger->m_minTrackerConfidence << ",";
+        m_ostream << pConfig->m_classId << ",";
+        m_ostream << lrint(pConfig->m_minWidth) << ",";
+        m_ostream << lrint(pConfig->m_minHeight) << ",";
+        m_ostream << lrint(pConfig->m_maxWidth) << ",";
+        m_ostream << lrint(pConfig->m_maxHeight) << ",";
+        m_ostream << pConfig->m_minConfidence << ",";
+        m_ostream << pConfig->m_minTrackerConfidence << ",";
 
-        if (pTrigger->m_inferDoneOnly)
+        if (pConfig->m_inferDoneOnly)
         {
             m_ostream << "Yes\n";
         }
@@ -1751,9 +1827,9 @@ namespace DSL
         
         // If we're force flushing the stream and the flush
         // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
+        if (m_forceFlush and !m_flushThreadFunction)
         {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+            m_flushThreadFunction.AddIdle(NULL, FileActionFlush, this);
         }
     }
     
@@ -1791,7 +1867,7 @@ namespace DSL
     }
 
     void FileMotcOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1816,9 +1892,9 @@ namespace DSL
         
         // If we're force flushing the stream and the flush
         // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
+        if (m_forceFlush and !m_flushThreadFunction)
         {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+            m_flushThreadFunction.AddIdle(NULL, FileActionFlush, this);
         }
     }
     
@@ -1840,12 +1916,12 @@ namespace DSL
     }
 
     void FillSurroundingsOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (m_enabled and pObjectMeta and displayMetaData.size())
+        if (m_enabled and pObjectMeta and displayMetaData.IsEnabled())
         {
             
             uint x1(roundf(pObjectMeta->rect_params.left));
@@ -1853,41 +1929,41 @@ namespace DSL
             uint x2(x1+roundf(pObjectMeta->rect_params.width)); 
             uint y2(y1+roundf(pObjectMeta->rect_params.height)); 
             uint rWidth = roundf(pObjectMeta->rect_params.width);
-            
-            std::string leftRectName("left-rect");
-            
-            DSL_RGBA_RECTANGLE_PTR pLeftRect = 
-                DSL_RGBA_RECTANGLE_NEW(leftRectName.c_str(), 
-                    0, 0, x1, pFrameMeta->source_frame_height, 
-                    0, m_pColor, true, m_pColor);
-                
-            pLeftRect->AddMeta(displayMetaData, pFrameMeta);
-
-            std::string rightRectName("right-rect");
-            
-            DSL_RGBA_RECTANGLE_PTR pRightRect = 
-                DSL_RGBA_RECTANGLE_NEW(rightRectName.c_str(), 
-                    x2, 0, pFrameMeta->source_frame_width, 
-                    pFrameMeta->source_frame_height, 
-                    0, m_pColor, true, m_pColor);
-    
-            pRightRect->AddMeta(displayMetaData, pFrameMeta);
-
-            std::string topRectName("top-rect");
-            
-            DSL_RGBA_RECTANGLE_PTR pTopRect = DSL_RGBA_RECTANGLE_NEW(
-                topRectName.c_str(), x1, 0, rWidth, y1, 0, m_pColor, true, m_pColor);
-                
-            pTopRect->AddMeta(displayMetaData, pFrameMeta);
-
-            std::string bottomRectName("bottom-rect");
-            
-            DSL_RGBA_RECTANGLE_PTR pBottomRect = DSL_RGBA_RECTANGLE_NEW(
-                bottomRectName.c_str(), x1, y2, rWidth, 
-                pFrameMeta->source_frame_height, 
-                0, m_pColor, true, m_pColor);
+            uint frameWidth(pFrameMeta->source_frame_width);
+            uint frameHeight(pFrameMeta->source_frame_height);
+            
+            // left, right, top and bottom rectangles - left, top, width, height
+            uint rects[4][4] = {
+                {0, 0, x1, frameHeight},
+                {x2, 0, frameWidth, frameHeight},
+                {x1, 0, rWidth, y1},
+                {x1, y2, rWidth, frameHeight}};
+            
+            m_pColor->Lock();
+            NvOSD_ColorParams color = *m_pColor;
+            m_pColor->Unlock();
+            
+            // Add the rectangles directly to the display meta, rather than 
+            // with a new RGBA Rectangle Display Type for each.
+            for (uint i = 0; i < 4; i++)
+            {
+                NvOSD_RectParams* pRectParams = displayMetaData.AddRect();
+                if (!pRectParams)
+                {
+                    return;
+                }
+                NvOSD_RectParams rectParams{0};
+                rectParams.left = rects[i][0];
+                rectParams.top = rects[i][1];
+                rectParams.width = rects[i][2];
+                rectParams.height = rects[i][3];
+                rectParams.border_width = 0;
+                rectParams.border_color = color;
+                rectParams.has_bg_color = true;
+                rectParams.bg_color = color;
                 
-            pBottomRect->AddMeta(displayMetaData, pFrameMeta);
+                *pRectParams = rectParams;
+            }
         }
     }
 
@@ -1909,13 +1985,18 @@ namespace DSL
     }
 
     void FillFrameOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled)
         {
+            NvOSD_RectParams* pRectParams = displayMetaData.AddRect();
+            if (!pRectParams)
+            {
+                return;
+            }
             NvOSD_RectParams rectParams{0};
             rectParams.left = 0;
             rectParams.top = 0;
@@ -1925,8 +2006,7 @@ namespace DSL
             rectParams.has_bg_color = true;
             rectParams.bg_color = *m_pColor;
             
-            displayMetaData.at(0)->rect_params[displayMetaData.at(0)->
-                num_rects++] = rectParams;
+            *pRectParams = rectParams;
         }
     }
 
@@ -1944,7 +2024,7 @@ namespace DSL
     }
 
     void LogOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1953,9 +2033,13 @@ namespace DSL
         {
             DSL_ODE_TRIGGER_PTR pTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+            OdeTriggerFrameView frame(pTrigger.get(), pFrameMeta->source_id);
+            const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+            const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+                frame.GetSourceState();
             
             LOG_INFO("Trigger Name        : " << pTrigger->GetName());
-            LOG_INFO("  Unique ODE Id     : " << pTrigger->s_eventCount);
+            LOG_INFO("  Unique ODE Id     : " << pSourceState->m_eventId);
             LOG_INFO("  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp));
             LOG_INFO("  Source Data       : ------------------------");
             
@@ -1977,7 +2061,7 @@ namespace DSL
             
             if (pObjectMeta)
             {
-                LOG_INFO("    Occurrences     : " << pTrigger->m_occurrences );
+                LOG_INFO("    Occurrences     : " << pSourceState->m_occurrences );
                 LOG_INFO("    Obj ClassId     : " << pObjectMeta->class_id);
                 LOG_INFO("    Infer Id        : " << pObjectMeta->unique_component_id);
                 LOG_INFO("    Tracking Id     : " << pObjectMeta->object_id);
@@ -2040,18 +2124,18 @@ namespace DSL
                 }
             }
             LOG_INFO("  Criteria          : ------------------------");
-            LOG_INFO("    Class Id        : " << pTrigger->m_classId );
+            LOG_INFO("    Class Id        : " << pConfig->m_classId );
             LOG_INFO("    Min Infer Id    : " << pTrigger->m_inferId );
-            LOG_INFO("    Min Infer Conf  : " << pTrigger->m_minConfidence);
-            LOG_INFO("    Min Track Conf  : " << pTrigger->m_minTrackerConfidence);
-            LOG_INFO("    Frame Count     : " << pTrigger->m_minFrameCountN
-                << " out of " << pTrigger->m_minFrameCountD);
-            LOG_INFO("    Min Width       : " << pTrigger->m_minWidth);
-            LOG_INFO("    Min Height      : " << pTrigger->m_minHeight);
-            LOG_INFO("    Max Width       : " << pTrigger->m_maxWidth);
-            LOG_INFO("    Max Height      : " << pTrigger->m_maxHeight);
-            
-            if (pTrigger->m_inferDoneOnly)
+            LOG_INFO("    Min Infer Conf  : " << pConfig->m_minConfidence);
+            LOG_INFO("    Min Track Conf  : " << pConfig->m_minTrackerConfidence);
+            LOG_INFO("    Frame Count     : " << pConfig->m_minFrameCountN
+                << " out of " << pConfig->m_minFrameCountD);
+            LOG_INFO("    Min Width       : " << pConfig->m_minWidth);
+            LOG_INFO("    Min Height      : " << pConfig->m_minHeight);
+            LOG_INFO("    Max Width       : " << pConfig->m_maxWidth);
+            LOG_INFO("    Max Height      : " << pConfig->m_maxHeight);
+            
+            if (pConfig->m_inferDoneOnly)
             {
                 LOG_INFO("    Inference       : Yes");
             }
@@ -2107,7 +2191,7 @@ namespace DSL
     }
 
     void MessageMetaAddOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2227,7 +2311,7 @@ namespace DSL
     }
     
     void MonitorOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2240,6 +2324,10 @@ namespace DSL
         {
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
+            OdeTriggerFrameView frame(pTrigger.get(), pFrameMeta->source_id);
+            const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+            const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+                frame.GetSourceState();
                 
             dsl_ode_occurrence_info info{0};
             
@@ -2247,7 +2335,7 @@ namespace DSL
             std::wstring wstrTriggerName(pTrigger->GetName().begin(), 
                 pTrigger->GetName().end());
             info.trigger_name = wstrTriggerName.c_str();
-            info.unique_ode_id = pTrigger->s_eventCount;
+            info.unique_ode_id = pSourceState->m_eventId;
             info.ntp_timestamp = pFrameMeta->ntp_timestamp;
             info.source_info.inference_done = pFrameMeta->bInferDone;
             info.source_info.source_id = pFrameMeta->source_id;
@@ -2338,16 +2426,16 @@ namespace DSL
             }
             
             // Trigger criteria set for this ODE occurrence.
-            info.criteria_info.class_id =  pTrigger->m_classId;
-            info.criteria_info.inference_done_only = pTrigger->m_inferDoneOnly;
+            info.criteria_info.class_id =  pConfig->m_classId;
+            info.criteria_info.inference_done_only = pConfig->m_inferDoneOnly;
             info.criteria_info.inference_component_id = pTrigger->m_inferId;
-            info.criteria_info.min_inference_confidence = pTrigger->m_minConfidence;
-            info.criteria_info.min_tracker_confidence = pTrigger->m_minTrackerConfidence;
-            info.criteria_info.min_width = pTrigger->m_minWidth;
-            info.criteria_info.min_height = pTrigger->m_minHeight;
-            info.criteria_info.max_width = pTrigger->m_maxWidth;
-            info.criteria_info.max_height = pTrigger->m_maxHeight;
-            info.criteria_info.interval = pTrigger->m_interval;
+            info.criteria_info.min_inference_confidence = pConfig->m_minConfidence;
+            info.criteria_info.min_tracker_confidence = pConfig->m_minTrackerConfidence;
+            info.criteria_info.min_width = pConfig->m_minWidth;
+            info.criteria_info.min_height = pConfig->m_minHeight;
+            info.criteria_info.max_width = pConfig->m_maxWidth;
+            info.criteria_info.max_height = pConfig->m_maxHeight;
+            info.criteria_info.interval = pConfig->m_interval;
             
             // Call the Client's monitor callback with the info and client-data
             m_clientMonitor(&info, m_clientData);
@@ -2378,7 +2466,7 @@ namespace DSL
     }
 
     void FormatLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2419,7 +2507,7 @@ namespace DSL
     }
 
     void OffsetLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2477,7 +2565,7 @@ namespace DSL
     }
 
     void SnapLabelToGridOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2512,7 +2600,7 @@ namespace DSL
     }
 
     void ConnectLabelToBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2619,10 +2707,12 @@ namespace DSL
     AddDisplayMetaOdeAction::AddDisplayMetaOdeAction(const char* name, 
         DSL_DISPLAY_TYPE_PTR pDisplayType)
         : OdeAction(name)
+        , m_compiledVersion(0)
     {
         LOG_FUNC();
 
         m_pDisplayTypes.push_back(pDisplayType);
+        compileDisplayTypes();
     }
 
     AddDisplayMetaOdeAction::~AddDisplayMetaOdeAction()
@@ -2633,23 +2723,71 @@ namespace DSL
     void AddDisplayMetaOdeAction::AddDisplayType(DSL_DISPLAY_TYPE_PTR pDisplayType)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_pDisplayTypes.push_back(pDisplayType);
+        compileDisplayTypes();
     }
     
     void AddDisplayMetaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and displayMetaData.IsEnabled())
+        {
+            // recompile if a Display Type has changed since last compiled.
+            if (getDisplayTypesVersion() != m_compiledVersion)
+            {
+                compileDisplayTypes();
+            }
+            for (const auto &ivec: m_displaySegments)
+            {
+                if (ivec.second)
+                {
+                    displayMetaData.AddTemplate(*ivec.second);
+                }
+                else
+                {
+                    ivec.first->AddMeta(displayMetaData, pFrameMeta);
+                }
+            }
+        }
+    }
+
+    uint AddDisplayMetaOdeAction::getDisplayTypesVersion()
+    {
+        uint version(0);
+        
+        for (const auto &ivec: m_pDisplayTypes)
+        {
+            version += ivec->GetVersion();
+        }
+        return version;
+    }
+
+    void AddDisplayMetaOdeAction::compileDisplayTypes()
+    {
+        LOG_FUNC();
+        
+        m_displaySegments.clear();
+        
+        for (const auto &ivec: m_pDisplayTypes)
         {
-            for (const auto &ivec: m_pDisplayTypes)
+            if (!ivec->IsStatic())
+            {
+                m_displaySegments.push_back({ivec, nullptr});
+                continue;
+            }
+            // start a new template if the previous Display Type was dynamic.
+            if (m_displaySegments.empty() or !m_displaySegments.back().second)
             {
-                ivec->AddMeta(displayMetaData, pFrameMeta);
+                m_displaySegments.push_back({nullptr, DSL_DISPLAY_TEMPLATE_NEW()});
             }
+            ivec->CompileMeta(*m_displaySegments.back().second);
         }
+        m_compiledVersion = getDisplayTypesVersion();
     }
 
     // ********************************************************************
@@ -2666,7 +2804,7 @@ namespace DSL
     }
     
     void RemoveObjectOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2693,15 +2831,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void PipelinePauseOdeAction::DoAsyncAction()
+    void PipelinePauseOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelinePause(m_pipeline.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -2719,15 +2852,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void PipelinePlayOdeAction::DoAsyncAction()
+    void PipelinePlayOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelinePlay(m_pipeline.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -2745,15 +2873,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void PipelineStopOdeAction::DoAsyncAction()
+    void PipelineStopOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelineStop(m_pipeline.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -2771,15 +2894,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void PlayerPauseOdeAction::DoAsyncAction()
+    void PlayerPauseOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PlayerPause(m_player.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -2797,15 +2915,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void PlayerPlayOdeAction::DoAsyncAction()
+    void PlayerPlayOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PlayerPlay(m_player.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -2823,15 +2936,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void PlayerStopOdeAction::DoAsyncAction()
+    void PlayerStopOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PlayerStop(m_player.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -2840,7 +2948,6 @@ namespace DSL
         bool forceFlush)
         : OdeAction(name)
         , m_forceFlush(forceFlush)
-        , m_flushThreadFunctionId(0)
     {
         LOG_FUNC();
     }
@@ -2849,15 +2956,15 @@ namespace DSL
     {
         LOG_FUNC();
 
-        if (m_flushThreadFunctionId)
+        if (m_flushThreadFunction)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
-            g_source_remove(m_flushThreadFunctionId);
+            m_flushThreadFunction.Remove();
         }
     }
 
     void PrintOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2868,9 +2975,13 @@ namespace DSL
         }
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        OdeTriggerFrameView frame(pTrigger.get(), pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         std::cout << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        std::cout << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        std::cout << "  Unique ODE Id     : " << pSourceState->m_eventId << "\n";
         std::cout << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         std::cout << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -2955,18 +3066,18 @@ namespace DSL
             }
         }
         std::cout << "  Criteria          : ------------------------" << "\n";
-        std::cout << "    Class Id        : " << pTrigger->m_classId << "\n";
+        std::cout << "    Class Id        : " << pConfig->m_classId << "\n";
         std::cout << "    Infer Id        : " << pTrigger->m_inferId << "\n";
-        std::cout << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        std::cout << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        std::cout << "    Min Frame Count : " << pTrigger->m_minFrameCountN
-            << " out of " << pTrigger->m_minFrameCountD << "\n";
-        std::cout << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        std::cout << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        std::cout << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        std::cout << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
+        std::cout << "    Min Infer Conf  : " << pConfig->m_minConfidence << "\n";
+        std::cout << "    Min Track Conf  : " << pConfig->m_minTrackerConfidence << "\n";
+        std::cout << "    Min Frame Count : " << pConfig->m_minFrameCountN
+            << " out of " << pConfig->m_minFrameCountD << "\n";
+        std::cout << "    Min Width       : " << lrint(pConfig->m_minWidth) << "\n";
+        std::cout << "    Min Height      : " << lrint(pConfig->m_minHeight) << "\n";
+        std::cout << "    Max Width       : " << lrint(pConfig->m_maxWidth) << "\n";
+        std::cout << "    Max Height      : " << lrint(pConfig->m_maxHeight) << "\n";
 
-        if (pTrigger->m_inferDoneOnly)
+        if (pConfig->m_inferDoneOnly)
         {
             std::cout << "    Inference       : Yes\n\n";
         }
@@ -2977,9 +3088,9 @@ namespace DSL
 
         // If we're force flushing the stream and the flush
         // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
+        if (m_forceFlush and !m_flushThreadFunction)
         {
-            m_flushThreadFunctionId = g_idle_add(PrintActionFlush, this);
+            m_flushThreadFunction.AddIdle(NULL, PrintActionFlush, this);
         }
         
     }
@@ -2991,7 +3102,7 @@ namespace DSL
         std::cout << std::flush;
         
         // end the thread
-        m_flushThreadFunctionId = 0;
+        m_flushThreadFunction.Clear();
         return false;
     }
 
@@ -3015,7 +3126,7 @@ namespace DSL
     }
 
     void RedactOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3054,16 +3165,11 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void AddSinkOdeAction::DoAsyncAction()
+    void AddSinkOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelineComponentAdd(m_pipeline.c_str(), 
             m_sink.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -3082,16 +3188,11 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void RemoveSinkOdeAction::DoAsyncAction()
+    void RemoveSinkOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelineComponentRemove(m_pipeline.c_str(), 
             m_sink.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -3110,16 +3211,11 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void AddSourceOdeAction::DoAsyncAction()
+    void AddSourceOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelineComponentAdd(m_pipeline.c_str(), 
             m_source.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -3138,16 +3234,11 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void RemoveSourceOdeAction::DoAsyncAction()
+    void RemoveSourceOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->PipelineComponentRemove(m_pipeline.c_str(), 
             m_source.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -3165,7 +3256,7 @@ namespace DSL
     }
     
     void ResetTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3194,7 +3285,7 @@ namespace DSL
     }
     
     void DisableTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3222,7 +3313,7 @@ namespace DSL
     }
     
     void EnableTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3250,7 +3341,7 @@ namespace DSL
     }
     
     void DisableActionOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3277,7 +3368,7 @@ namespace DSL
     }
     
     void EnableActionOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3306,7 +3397,7 @@ namespace DSL
     }
     
     void AddAreaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3336,7 +3427,7 @@ namespace DSL
     }
     
     void RemoveAreaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3367,7 +3458,7 @@ namespace DSL
     }
     
     void RecordSinkStartOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3396,7 +3487,7 @@ namespace DSL
     }
     
     void RecordSinkStopOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3428,7 +3519,7 @@ namespace DSL
     }
     
     void RecordTapStartOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3457,7 +3548,7 @@ namespace DSL
     }
     
     void RecordTapStopOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3487,7 +3578,7 @@ namespace DSL
     }
     
     void TilerShowSourceOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3521,16 +3612,11 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void AddBranchOdeAction::DoAsyncAction()
+    void AddBranchOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->TeeBranchAdd(m_tee.c_str(), 
             m_branch.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
     // ********************************************************************
@@ -3540,7 +3626,6 @@ namespace DSL
         : AsyncOdeAction(name)
         , m_demuxer(demuxer)
         , m_branch(branch)
-        , m_destStreamId(-1)
     {
         LOG_FUNC();
     }
@@ -3550,37 +3635,15 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void AddBranchToOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void AddBranchToOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-
-        if (m_enabled)
-        {
-            // Get the stream-id from the frame source-id which has the 
-            // unique Pipeline-id or'ed in by the Streammuxer
-            m_destStreamId = pFrameMeta->source_id &
-                DSL_PIPELINE_SOURCE_STREAM_ID_MASK;
-            
-            // Schedule the do_async_action to remove the branch in 
-            // the main-loop context.
-            m_timerId = g_timeout_add(1, do_async_action, this);
-        }
-    }
-
-    void AddBranchToOdeAction::DoAsyncAction()
-    {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
+        // Get the stream-id from the frame source-id which has the 
+        // unique Pipeline-id or'ed in by the Streammuxer
+        uint streamId = sourceId & DSL_PIPELINE_SOURCE_STREAM_ID_MASK;
+        
         // Ignore the return value, errors will be logged 
         Services::GetServices()->TeeDemuxerBranchAddTo(m_demuxer.c_str(), 
-            m_branch.c_str(), m_destStreamId);
-
-        // reset the timer resource id.
-        m_timerId = 0;
-        
-        m_destStreamId = -1;
+            m_branch.c_str(), streamId);
     }
 
     // ********************************************************************
@@ -3590,7 +3653,6 @@ namespace DSL
         : AsyncOdeAction(name)
         , m_demuxer(demuxer)
         , m_branch(branch)
-        , m_destStreamId(-1)
     {
         LOG_FUNC();
     }
@@ -3600,37 +3662,15 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void MoveBranchToOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void MoveBranchToOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-
-        if (m_enabled)
-        {
-            // Get the stream-id from the frame source-id which has the 
-            // unique Pipeline-id or'ed in by the Streammuxer
-            m_destStreamId = pFrameMeta->source_id &
-                DSL_PIPELINE_SOURCE_STREAM_ID_MASK;
-
-            // Schedule the do_async_action to remove the branch in 
-            // the main-loop context.
-            m_timerId = g_timeout_add(1, do_async_action, this);
-        }
-    }
-    
-    void MoveBranchToOdeAction::DoAsyncAction()
-    {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
+        // Get the stream-id from the frame source-id which has the 
+        // unique Pipeline-id or'ed in by the Streammuxer
+        uint streamId = sourceId & DSL_PIPELINE_SOURCE_STREAM_ID_MASK;
+        
         // Ignore the return value, errors will be logged 
         Services::GetServices()->TeeDemuxerBranchMoveTo(m_demuxer.c_str(), 
-            m_branch.c_str(), m_destStreamId);
-
-        // reset the timer resource id.
-        m_timerId = 0;
-        
-        m_destStreamId = -1;
+            m_branch.c_str(), streamId);
     }
     
     // ********************************************************************
@@ -3649,16 +3689,11 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void RemoveBranchOdeAction::DoAsyncAction()
+    void RemoveBranchOdeAction::DoAsyncAction(uint sourceId)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
         // Ignore the return value, errors will be logged 
         Services::GetServices()->TeeBranchRemove(m_tee.c_str(), 
             m_branch.c_str());
-
-        // reset the timer resource id.
-        m_timerId = 0;
     }
 
 }
\ No newline at end of file
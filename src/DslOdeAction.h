@@ -28,10 +28,12 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslOdeBase.h"
+#include "DslOdeStats.h"
 #include "DslSurfaceTransform.h"
 #include "DslDisplayTypes.h"
 #include "DslPlayerBintr.h"
 #include "DslMailer.h"
+#include "DslMainContext.h"
 
 namespace DSL
 {
@@ -302,6 +304,89 @@ namespace DSL
         std::shared_ptr<RemoveBranchOdeAction>(new RemoveBranchOdeAction(name, tee, branch))
         
         
+    // ********************************************************************
+
+    /**
+     * @class OdeActionGate
+     * @brief Abstract gate entered before each ODE Action invoked by the 
+     * calling thread. Installed by the ODE Pad Probe Handler in parallel mode
+     * so that Actions are invoked in the same order as serial evaluation.
+     */
+    class OdeActionGate
+    {
+    public:
+    
+        /**
+         * @brief dtor for the OdeActionGate virtual class
+         */
+        virtual ~OdeActionGate(){};
+        
+        /**
+         * @brief Blocks until the calling thread may invoke its next Action.
+         */
+        virtual void Enter() = 0;
+        
+        /**
+         * @brief Gets the gate installed for the calling thread.
+         * @return the installed gate, NULL if none.
+         */
+        static OdeActionGate* GetCurrent()
+        {
+            return s_pCurrent;
+        };
+        
+        /**
+         * @brief Installs a gate for the calling thread.
+         * @param[in] pGate gate to install, NULL to uninstall.
+         */
+        static void SetCurrent(OdeActionGate* pGate)
+        {
+            s_pCurrent = pGate;
+        };
+        
+    private:
+    
+        /**
+         * @brief gate installed for each thread.
+         */
+        static thread_local OdeActionGate* s_pCurrent;
+    };
+    
+    /**
+     * @class OdeActionGateScope
+     * @brief Installs an OdeActionGate for the calling thread for the lifetime
+     * of the scope, restoring the previous gate on exit.
+     */
+    class OdeActionGateScope
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeActionGateScope class
+         * @param[in] pGate gate to install, may be NULL.
+         */
+        OdeActionGateScope(OdeActionGate* pGate)
+            : m_pPrevious(OdeActionGate::GetCurrent())
+        {
+            OdeActionGate::SetCurrent(pGate);
+        };
+        
+        /**
+         * @brief dtor for the OdeActionGateScope class
+         */
+        ~OdeActionGateScope()
+        {
+            OdeActionGate::SetCurrent(m_pPrevious);
+        };
+        
+    private:
+    
+        /**
+         * @brief gate installed before this scope.
+         */
+        OdeActionGate* m_pPrevious;
+    };
+
     // ********************************************************************
 
     class OdeAction : public OdeBase
@@ -326,9 +411,31 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         virtual void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta) = 0;
         
+        /**
+         * @brief Calls HandleOccurrence, recording its latency if ODE stats 
+         * are installed for the calling thread. Used by ODE Triggers and 
+         * Accumulators to invoke their Actions. Enters the OdeActionGate 
+         * installed for the calling thread, if any, beforehand.
+         */
+        void InvokeOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+        {
+            OdeActionGate* pGate = OdeActionGate::GetCurrent();
+            if (pGate)
+            {
+                pGate->Enter();
+            }
+            OdeStatsTimer statsTimer(OdeStats::GetCurrent(), this,
+                DSL_ODE_STATS_PHASE_ACTION);
+                
+            HandleOccurrence(pOdeTrigger, pBuffer, displayMetaData,
+                pFrameMeta, pObjectMeta);
+        };
+        
     protected:
 
         std::string Ntp2Str(uint64_t ntp);
@@ -356,8 +463,9 @@ namespace DSL
         ~AsyncOdeAction();
         
         /**
-         * @brief Handles the ODE occurrence by scheduling the DoAsyncAction 
-         * timer callback.
+         * @brief Handles the ODE occurrence by submitting the DoAsyncAction 
+         * to the Async Action Executor. Occurrences of the same action are 
+         * executed one at a time, in order.
          * @param[in] pBuffer pointer to the batched stream buffer that triggered 
          * the event.
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered 
@@ -368,29 +476,16 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        virtual void DoAsyncAction() = 0;
-        
-    protected:
-    
-        /**
-         * @brief g_timer_add event source.
-         */ 
-        uint m_timerId;
+        virtual void DoAsyncAction(uint sourceId) = 0;
     };
-
-    /**
-     * @brief timer callback function to call an AsyncOdeAction in the context
-     * of the main-loop. 
-     * @param pAction asynchronous action to invoke - call DoAsyncAction().
-     * @return False always - one shot timer.
-     */
-    static int do_async_action(gpointer pAction);
     
     // ********************************************************************
 
@@ -429,7 +524,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -488,7 +583,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -540,7 +635,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -611,7 +706,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -679,7 +774,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -731,7 +826,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -844,9 +939,9 @@ namespace DSL
         std::queue<std::shared_ptr<DslBufferSurface>> m_pBufferSurfaces;
 
         /**
-         * @brief gnome thread id for the idle thread to initiate image conversion.
+         * @brief idle source to initiate image conversion.
         */
-        uint m_idleThreadFunctionId;
+        MainContextSource m_idleThreadFunction;
 
         /**
          * @brief mutux to guard the image-capture queue read/write access.
@@ -962,7 +1057,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1015,16 +1110,33 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
     
+        /**
+         * @brief Appends the value for a single format token to the display text.
+         * @param[in,out] text display text to append to.
+         * @param[in] token format token number, i.e. 4 for "%4".
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the event.
+         * @param[in] pObjectMeta pointer to the Object Meta data for the event,
+         * NULL for Frame level events.
+         */
+        void AppendTokenValue(FrameArenaString& text, int token,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+    
         /**
          * @brief client defined display string with format tokens
          */
         std::string m_formatString;
         
+        /**
+         * @brief the format string split on construction into literal text, 
+         * each followed by the number of the format token to replace, -1 if none.
+         */
+        std::vector<std::pair<std::string, int>> m_formatTokens;
+        
         /**
          * @brief Horizontal X-offset for the ODE occurrence data to display
          */
@@ -1084,7 +1196,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1129,7 +1241,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1177,7 +1289,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -1215,7 +1327,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
         /**
@@ -1278,7 +1390,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1327,7 +1439,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1372,7 +1484,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1421,13 +1533,36 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
     
-        std::vector<DSL_DISPLAY_TYPE_PTR> m_pDisplayTypes;
+        /**
+         * @brief Sums the versions of all Display Types.
+         * @return current sum of versions.
+         */
+        uint getDisplayTypesVersion();
     
+        /**
+         * @brief Compiles the Display Types into Display Segments.
+         */
+        void compileDisplayTypes();
+    
+        std::vector<DSL_DISPLAY_TYPE_PTR> m_pDisplayTypes;
+        
+        /**
+         * @brief Display Types in the order added. Each consecutive run of
+         * static types is precompiled into a single template, paired with
+         * a NULL type. Dynamic types are paired with a NULL template.
+         */
+        std::vector<std::pair<DSL_DISPLAY_TYPE_PTR, 
+            DSL_DISPLAY_TEMPLATE_PTR>> m_displaySegments;
+            
+        /**
+         * @brief sum of the Display Type versions when last compiled.
+         */
+        uint m_compiledVersion;
     };
 
     // ********************************************************************
@@ -1465,7 +1600,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1523,7 +1658,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1576,7 +1711,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1629,7 +1764,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1682,7 +1817,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
     };
         
@@ -1709,10 +1844,11 @@ namespace DSL
         ~PipelinePauseOdeAction();
         
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * Callback function is called in the main-loop context.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -1743,10 +1879,11 @@ namespace DSL
         ~PipelinePlayOdeAction();
         
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * Callback function is called in the main-loop context.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -1777,10 +1914,11 @@ namespace DSL
         ~PipelineStopOdeAction();
         
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * Callback function is called in the main-loop context.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -1811,10 +1949,11 @@ namespace DSL
         ~PlayerPauseOdeAction();
         
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * Callback function is called in the main-loop context.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -1845,10 +1984,11 @@ namespace DSL
         ~PlayerPlayOdeAction();
         
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * Callback function is called in the main-loop context.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -1879,10 +2019,11 @@ namespace DSL
         ~PlayerStopOdeAction();
         
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * Callback function is called in the main-loop context.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -1921,7 +2062,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1938,12 +2079,12 @@ namespace DSL
         bool m_forceFlush;
     
         /**
-         * @brief gnome thread id for the background thread to flush
+         * @brief idle source to flush the output stream
          */
-        uint m_flushThreadFunctionId;
+        MainContextSource m_flushThreadFunction;
 
         /**
-         * @brief mutex to protect mutual access to m_flushThreadFunctionId
+         * @brief mutex to protect mutual access to m_flushThreadFunction
          */
         DslMutex m_ostreamMutex;
     };
@@ -2009,9 +2150,9 @@ namespace DSL
         bool m_forceFlush;
     
         /**
-         * @brief gnome thread id for the background thread to flush
+         * @brief idle source to flush the output stream
          */
-        uint m_flushThreadFunctionId;
+        MainContextSource m_flushThreadFunction;
 
         /**
          * @brief mutex to protect mutual access to comms data
@@ -2057,7 +2198,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
     
     };
@@ -2093,7 +2234,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
     
     };
@@ -2129,7 +2270,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
     
     };
@@ -2165,7 +2306,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -2196,10 +2337,11 @@ namespace DSL
         ~AddSinkOdeAction();
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
         
     private:
     
@@ -2239,10 +2381,11 @@ namespace DSL
         ~RemoveSinkOdeAction();
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
         
     private:
     
@@ -2282,10 +2425,11 @@ namespace DSL
         ~AddSourceOdeAction();
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -2325,10 +2469,11 @@ namespace DSL
         ~RemoveSourceOdeAction();
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
         
     private:
     
@@ -2375,7 +2520,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pBaseTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2418,7 +2563,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2461,7 +2606,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pBaseTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2504,7 +2649,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2547,7 +2692,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2591,7 +2736,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2639,7 +2784,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2689,7 +2834,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2748,7 +2893,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2794,7 +2939,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2853,7 +2998,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2897,7 +3042,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2945,10 +3090,11 @@ namespace DSL
         ~AddBranchOdeAction();
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
         
     private:
     
@@ -2991,23 +3137,11 @@ namespace DSL
         ~AddBranchToOdeAction();
 
         /**
-         * @brief Handles the ODE occurrence by adding a named Branch to a named Demuxer
-         * at the current stream-id, as indicated by the pFrameMeta.
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
-         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
-         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
-         * NULL if Frame level absence, total, min, max, etc. events.
-         */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-
-        /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
         
     private:
     
@@ -3020,11 +3154,6 @@ namespace DSL
          * @brief Branch to add to the Tee on ODE occurrence
          */ 
         std::string m_branch;
-        
-        /**
-         * @brief Destination stream-id to add the branch to
-         */ 
-        int m_destStreamId;
 
     };
     
@@ -3052,23 +3181,11 @@ namespace DSL
         ~MoveBranchToOdeAction();
 
         /**
-         * @brief Handles the ODE occurrence by moving a named Branch connected to a 
-         * named Demuxer to the current stream-id, as indicated by the pFrameMeta.
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
-         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
-         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
-         * NULL if Frame level absence, total, min, max, etc. events.
-         */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-        
-        /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -3081,11 +3198,6 @@ namespace DSL
          * @brief Branch to move on ODE occurrence
          */ 
         std::string m_branch;
-        
-        /**
-         * @brief Destination stream-id to move the branch to.
-         */
-        int m_destStreamId;
 
     };
     
@@ -3114,10 +3226,11 @@ namespace DSL
         ~RemoveBranchOdeAction();
 
         /**
-         * @brief Function to perform the Action asynchronously as a Timer callback.
-         * @return int return 1 always to execute only once.
+         * @brief Function to perform the Action asynchronously by an 
+         * Async Action Executor worker thread.
+         * @param[in] sourceId source-id of the frame that triggered the event.
          */
-        void DoAsyncAction();
+        void DoAsyncAction(uint sourceId);
 
     private:
     
@@ -36,6 +36,14 @@ namespace DSL
         , m_bboxTestPoint(bboxTestPoint)
     {
         LOG_FUNC();
+        
+        // Area Display Types are fixed once created. Static types are 
+        // compiled once and copied into each frame's meta.
+        if (m_show and m_pDisplayType->IsStatic())
+        {
+            m_pDisplayTemplate = DSL_DISPLAY_TEMPLATE_NEW();
+            m_pDisplayType->CompileMeta(*m_pDisplayTemplate);
+        }
     }
     
     OdeArea::~OdeArea()
@@ -43,30 +51,24 @@ namespace DSL
         LOG_FUNC();
     }
         
-    void OdeArea::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
+    void OdeArea::AddMeta(DisplayMetaBuilder& displayMetaData,  
         NvDsFrameMeta* pFrameMeta)
     {
         LOG_FUNC();
         
-        if (!m_show)
+        // Multiple Triggers can share a single Area. The Area is only added 
+        // once for each frame, on the first Trigger to add it.
+        if (!m_show or !displayMetaData.IsEnabled() or 
+            !displayMetaData.IsFirstAdd(this))
         {
             return;
         }
-        
-        // If this is the first time seeing a frame for the reported Source Id.
-        if (m_frameNumPerSource.find(pFrameMeta->source_id) == m_frameNumPerSource.end())
+        if (m_pDisplayTemplate)
         {
-            // Initial the frame number for the new source
-            m_frameNumPerSource[pFrameMeta->source_id] = 0;
+            displayMetaData.AddTemplate(*m_pDisplayTemplate);
         }
-
-        // If the last frame number for the reported source is different from the current frame
-        // This can be either greater than or less than depending on play direction.
-        if (m_frameNumPerSource[pFrameMeta->source_id] != pFrameMeta->frame_num)
+        else
         {
-            // Update the frame number so we only add the rectangle once
-            m_frameNumPerSource[pFrameMeta->source_id] = pFrameMeta->frame_num;
-
             m_pDisplayType->AddMeta(displayMetaData, pFrameMeta);
         }
     }
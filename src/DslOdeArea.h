@@ -86,7 +86,7 @@ namespace DSL
          * structures to add the Area's underliying Display Type to.
          * @param[in] pFrameMeta the Frame metadata for the current Frame
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
+        void AddMeta(DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -165,12 +165,10 @@ namespace DSL
         uint m_bboxTestPoint;
         
         /**
-         * @brief Updated for each source/frame-number. Allows multiple Triggers to share a single Area,
-         * And although each Trigger will call OverlayFrame() the Area can check to see if the overlay
-         * has occurred for the current source/frame-number. If not, the Area can do an actual Frame-Overlay 
-         * once-per-frame-per-source
+         * @brief Precompiled meta for the Area's Display Type if static and
+         * shown, NULL otherwise.
          */
-        std::map<uint, uint64_t> m_frameNumPerSource;
+        DSL_DISPLAY_TEMPLATE_PTR m_pDisplayTemplate;
 
     };
     
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslDisplayMetaBuilder.h"
 
 namespace DSL
 {
@@ -36,6 +37,8 @@ namespace DSL
      */
     #define DSL_ODE_BASE_PTR std::shared_ptr<OdeBase>
     
+    class OdeComponentStats;
+    
     // ********************************************************************
 
     class OdeBase : public Base
@@ -49,6 +52,7 @@ namespace DSL
         OdeBase(const char* name)
             : Base(name)
             , m_enabled(true)
+            , m_pOdeStats(NULL)
         {
             LOG_FUNC();
         };
@@ -142,6 +146,26 @@ namespace DSL
             return true;
         };
         
+        /**
+         * @brief Gets the stats this ODE component records its latencies to.
+         * @return stats resolved by the parent ODE Handler, NULL if none.
+         */
+        OdeComponentStats* GetOdeStats()
+        {
+            return m_pOdeStats.load(std::memory_order_acquire);
+        };
+        
+        /**
+         * @brief Sets the stats this ODE component records its latencies to. 
+         * Called by OdeStats when the component is added to, or removed from, 
+         * an ODE Handler.
+         * @param[in] pOdeStats stats to record to, NULL to stop recording.
+         */
+        void SetOdeStats(OdeComponentStats* pOdeStats)
+        {
+            m_pOdeStats.store(pOdeStats, std::memory_order_release);
+        };
+        
     protected:
 
         /**
@@ -150,9 +174,9 @@ namespace DSL
         DslMutex m_propertyMutex;
     
         /**
-         * @brief enabled flag.
+         * @brief enabled flag, read lock-free from the streaming thread.
          */
-        bool m_enabled;
+        std::atomic<bool> m_enabled;
 
     private:
     
@@ -163,6 +187,12 @@ namespace DSL
         std::map<dsl_ode_enabled_state_change_listener_cb, 
             void*>m_enabledStateChangeListeners;
         
+        /**
+         * @brief stats resolved for this component when it was added to an
+         * ODE Handler, read lock-free from the streaming thread.
+         */
+        std::atomic<OdeComponentStats*> m_pOdeStats;
+        
     };            
 
 }
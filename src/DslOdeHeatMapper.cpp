@@ -24,10 +24,217 @@ THE SOFTWARE.
 
 #include "DslOdeHeatMapper.h"
 
+#include <sys/mman.h>
+
 #define DATE_BUFF_LENGTH 40
 
 namespace DSL
 {
+    HeatMapGrid::HeatMapGrid(uint cols, uint rows)
+        : m_cols(cols)
+        , m_rows(rows)
+        , m_mapSize(cols*rows*sizeof(uint64_t))
+        , m_pCells(NULL)
+        , m_max(0)
+    {
+        LOG_FUNC();
+        
+        // anonymous mappings are zero-filled on first access.
+        void* pMap = mmap(NULL, m_mapSize, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pMap == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map " << m_mapSize 
+                << " bytes for Heat-Map grid");
+            throw std::exception();
+        }
+        m_pCells = (uint64_t*)pMap;
+    }
+    
+    HeatMapGrid::~HeatMapGrid()
+    {
+        LOG_FUNC();
+        
+        munmap(m_pCells, m_mapSize);
+    }
+    
+    uint64_t HeatMapGrid::Increment(uint col, uint row)
+    {
+        uint64_t count = ++m_pCells[row*m_cols + col];
+        
+        if (count > m_max)
+        {
+            m_max = count;
+        }
+        return count;
+    }
+    
+    uint64_t HeatMapGrid::GetCell(uint col, uint row)
+    {
+        return m_pCells[row*m_cols + col];
+    }
+    
+    uint64_t HeatMapGrid::GetMax()
+    {
+        return m_max;
+    }
+    
+    const uint64_t* HeatMapGrid::GetCells()
+    {
+        return m_pCells;
+    }
+    
+    uint HeatMapGrid::GetSize()
+    {
+        return m_cols*m_rows;
+    }
+    
+    void HeatMapGrid::Clear()
+    {
+        // Releasing the pages zero-fills them on next access, without 
+        // writing to every cell now.
+        if (madvise(m_pCells, m_mapSize, MADV_DONTNEED))
+        {
+            memset(m_pCells, 0, m_mapSize);
+        }
+        m_max = 0;
+    }
+    
+    void HeatMapGrid::Subtract(HeatMapGrid& grid)
+    {
+        m_max = 0;
+        for (uint i=0; i < m_cols*m_rows; i++)
+        {
+            m_pCells[i] -= std::min(m_pCells[i], grid.m_pCells[i]);
+            m_max = std::max(m_max, m_pCells[i]);
+        }
+    }
+    
+    void HeatMapGrid::Assign(const std::vector<double>& values)
+    {
+        m_max = 0;
+        for (uint i=0; i < m_cols*m_rows; i++)
+        {
+            m_pCells[i] = std::llround(values[i]);
+            m_max = std::max(m_max, m_pCells[i]);
+        }
+    }
+    
+    // ********************************************************************
+
+    HeatMap::HeatMap(uint cols, uint rows)
+        : m_cols(cols)
+        , m_rows(rows)
+        , m_mode(DSL_HEAT_MAP_MODE_ACCUMULATE)
+        , m_interval(0)
+        , m_intervalStart(0)
+        , m_grid(cols, rows)
+        , m_decayFactor(1.0)
+        , m_currentSubGrid(0)
+    {
+        LOG_FUNC();
+    }
+    
+    void HeatMap::SetMode(uint mode, gint64 interval, uint size)
+    {
+        LOG_FUNC();
+        
+        m_mode = mode;
+        m_interval = interval;
+        m_intervalStart = 0;
+        m_currentSubGrid = 0;
+        m_decayedCounts.clear();
+        m_subGrids.clear();
+        m_grid.Clear();
+        
+        if (m_mode == DSL_HEAT_MAP_MODE_DECAY)
+        {
+            m_decayedCounts.assign(m_cols*m_rows, 0.0);
+            
+            // counts halve after size intervals.
+            m_decayFactor = std::pow(0.5, 1.0/size);
+        }
+        else if (m_mode == DSL_HEAT_MAP_MODE_WINDOW)
+        {
+            for (uint i=0; i < size; i++)
+            {
+                m_subGrids.push_back(DSL_HEAT_MAP_GRID_NEW(m_cols, m_rows));
+            }
+        }
+    }
+    
+    uint64_t HeatMap::Increment(uint col, uint row)
+    {
+        if (m_mode == DSL_HEAT_MAP_MODE_DECAY)
+        {
+            m_decayedCounts[row*m_cols + col] += 1.0;
+        }
+        else if (m_mode == DSL_HEAT_MAP_MODE_WINDOW)
+        {
+            m_subGrids[m_currentSubGrid]->Increment(col, row);
+        }
+        return m_grid.Increment(col, row);
+    }
+    
+    bool HeatMap::Update(gint64 currentTime)
+    {
+        if (m_mode == DSL_HEAT_MAP_MODE_ACCUMULATE)
+        {
+            return false;
+        }
+        if (!m_intervalStart)
+        {
+            m_intervalStart = currentTime;
+            return false;
+        }
+        gint64 intervals = (currentTime - m_intervalStart) / m_interval;
+        if (intervals <= 0)
+        {
+            return false;
+        }
+        m_intervalStart += intervals*m_interval;
+        
+        if (m_mode == DSL_HEAT_MAP_MODE_DECAY)
+        {
+            double factor = std::pow(m_decayFactor, (double)intervals);
+            for (auto& count: m_decayedCounts)
+            {
+                count *= factor;
+            }
+            m_grid.Assign(m_decayedCounts);
+            return true;
+        }
+        
+        // Advance the ring one sub-grid for each completed interval, the
+        // sub-grid that falls out of the window is removed from the map
+        // and reused for the new interval. 
+        uint steps = std::min((gint64)m_subGrids.size(), intervals);
+        for (uint i=0; i < steps; i++)
+        {
+            m_currentSubGrid = (m_currentSubGrid + 1) % m_subGrids.size();
+            m_grid.Subtract(*m_subGrids[m_currentSubGrid]);
+            m_subGrids[m_currentSubGrid]->Clear();
+        }
+        return true;
+    }
+    
+    void HeatMap::Clear()
+    {
+        m_grid.Clear();
+        m_decayedCounts.assign(m_decayedCounts.size(), 0.0);
+        for (auto& pSubGrid: m_subGrids)
+        {
+            pSubGrid->Clear();
+        }
+    }
+    
+    HeatMapGrid& HeatMap::GetGrid()
+    {
+        return m_grid;
+    }
+    
+    // ********************************************************************
+
     OdeHeatMapper::OdeHeatMapper(const char* name, uint cols, uint rows,
         uint bboxTestPoint, DSL_RGBA_COLOR_PALETTE_PTR pColorPalette)
         : OdeBase(name)
@@ -37,8 +244,12 @@ namespace DSL
         , m_gridRectHeight(0)
         , m_bboxTestPoint(bboxTestPoint)
         , m_pColorPalette(pColorPalette)
-        , m_heatMap(rows, std::vector<uint64_t> (cols, 0))
-        , m_mostOccurrences(0)
+        , m_heatMap(cols, rows)
+        , m_outBuffer(cols*rows, 0)
+        , m_mode(DSL_HEAT_MAP_MODE_ACCUMULATE)
+        , m_modeInterval(0)
+        , m_modeSize(0)
+        , m_legendDirty(true)
         , m_legendEnabled(false)
         , m_legendLocation(0)
         , m_legendLeft(0)
@@ -48,7 +259,7 @@ namespace DSL
     {
         LOG_FUNC();
         
-        m_outBuffer = std::unique_ptr<uint64_t[]>(new uint64_t[cols*rows]);
+        updatePaletteColors();
     }
 
     OdeHeatMapper::~OdeHeatMapper()
@@ -70,6 +281,7 @@ namespace DSL
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
             m_pColorPalette = pColorPalette;
+            updatePaletteColors();
         }
         // need to recalculated legend settings.
         return SetLegendSettings(m_legendEnabled, m_legendLocation,
@@ -95,6 +307,7 @@ namespace DSL
         
         // disable untill all params are checked.
         m_legendEnabled = false;
+        m_legendDirty = true;
         
         // If client is disabling - done
         if (!enabled)
@@ -140,6 +353,48 @@ namespace DSL
         return true;
     }            
 
+    void OdeHeatMapper::GetMode(uint* mode, uint* interval, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *mode = m_mode;
+        *interval = m_modeInterval;
+        *size = m_modeSize;
+    }
+
+    bool OdeHeatMapper::SetMode(uint mode, uint interval, uint size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (mode > DSL_HEAT_MAP_MODE_WINDOW)
+        {
+            LOG_ERROR("Invalid mode = " << mode 
+                << " for Heat-Mapper '" << GetName() << "'");
+            return false;
+        }
+        if (mode != DSL_HEAT_MAP_MODE_ACCUMULATE and (!interval or !size))
+        {
+            LOG_ERROR("Interval and size must be greater than 0 for Heat-Mapper '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_mode = mode;
+        m_modeInterval = interval;
+        m_modeSize = size;
+
+        m_heatMap.SetMode(m_mode, 
+            (gint64)m_modeInterval*G_USEC_PER_SEC, m_modeSize);
+        for (auto const& imap: m_sourceHeatMaps)
+        {
+            imap.second->m_pHeatMap->SetMode(m_mode, 
+                (gint64)m_modeInterval*G_USEC_PER_SEC, m_modeSize);
+            imap.second->m_renderDirty = true;
+        }
+        return true;
+    }
+
     void OdeHeatMapper::HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
         NvDsObjectMeta* pObjectMeta)
     {
@@ -150,6 +405,7 @@ namespace DSL
         {
             m_gridRectWidth = pFrameMeta->source_frame_width/m_cols;
             m_gridRectHeight = pFrameMeta->source_frame_height/m_rows;
+            m_legendDirty = true;
         }
         
         // get the x,y map coordinates based on the bbox and test-point.
@@ -158,89 +414,98 @@ namespace DSL
 
         // determine the column and row that maps to the x, y coordinates
         // coordinates are 1-based, so subtract 1 pixel to keep within map.
-        uint colPosition((mapCoordinate.x-1)/m_gridRectWidth);
-        uint rowPosition((mapCoordinate.y-1)/m_gridRectHeight);
+        uint colPosition = std::min((std::max(mapCoordinate.x, 1u) - 1) / 
+            m_gridRectWidth, m_cols - 1);
+        uint rowPosition = std::min((std::max(mapCoordinate.y, 1u) - 1) / 
+            m_gridRectHeight, m_rows - 1);
 
+        gint64 currentTime = g_get_monotonic_time();
+        
         // increment the running count of occurrences at this poisition
-        m_heatMap[rowPosition][colPosition] += 1;
+        // for all sources and for the frame's source.
+        m_heatMap.Update(currentTime);
+        m_heatMap.Increment(colPosition, rowPosition);
         
-        // if the new total for this position is now the greatest  
-        if (m_heatMap[rowPosition][colPosition] > m_mostOccurrences)
+        std::unique_ptr<SourceHeatMap>& pSourceHeatMap = 
+            m_sourceHeatMaps[pFrameMeta->source_id];
+        if (!pSourceHeatMap)
         {
-            m_mostOccurrences = m_heatMap[rowPosition][colPosition];
+            pSourceHeatMap = std::unique_ptr<SourceHeatMap>(
+                new SourceHeatMap(m_cols, m_rows));
+            pSourceHeatMap->m_pHeatMap->SetMode(m_mode, 
+                (gint64)m_modeInterval*G_USEC_PER_SEC, m_modeSize);
+        }
+        if (pSourceHeatMap->m_pHeatMap->Update(currentTime))
+        {
+            pSourceHeatMap->m_renderDirty = true;
+        }
+        HeatMapGrid& sourceGrid = pSourceHeatMap->m_pHeatMap->GetGrid();
+        uint64_t maxCount = sourceGrid.GetMax();
+        uint64_t count = pSourceHeatMap->m_pHeatMap->Increment(
+            colPosition, rowPosition);
+            
+        // A new maximum can change the bucket of every cell, otherwise only
+        // the cell just incremented needs to be checked.
+        if (sourceGrid.GetMax() != maxCount or 
+            pSourceHeatMap->m_buckets[rowPosition*m_cols + colPosition] != 
+                getBucket(count, maxCount))
+        {
+            pSourceHeatMap->m_renderDirty = true;
         }
     }
   
-    void OdeHeatMapper::AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData)
+    void OdeHeatMapper::AddDisplayMeta(DisplayMetaBuilder& displayMetaData,
+        NvDsFrameMeta* pFrameMeta)
     {
+        // client can disable by setting the PPH ODE display meta alloc size to 0.
+        if (!displayMetaData.IsEnabled())
+        {
+            return;
+        }
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
+        // nothing to display until the grid dimensions are known.
+        if (!m_gridRectWidth)
+        {
+            return;
+        }
+        if (m_legendDirty)
+        {
+            renderLegend();
+        }
+        
+        auto imap = m_sourceHeatMaps.find(pFrameMeta->source_id);
+        
+        // decayed or expired counts need to be re-rendered even when
+        // there are no new occurrences for the source.
+        if (imap != m_sourceHeatMaps.end() and 
+            imap->second->m_pHeatMap->Update(g_get_monotonic_time()))
+        {
+            imap->second->m_renderDirty = true;
+        }
+        if (imap != m_sourceHeatMaps.end() and imap->second->m_renderDirty)
+        {
+            renderSourceHeatMap(*imap->second);
+        }
+        
+        // Use a dedicated builder, with no limit, when the batch meta is 
+        // available so the heat-map doesn't use up the shared display meta.
+        DisplayMetaBuilder heatMapMetaData(pFrameMeta->base_meta.batch_meta,
+            DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED);
+        DisplayMetaBuilder& builder = (heatMapMetaData.IsEnabled())
+            ? heatMapMetaData
+            : displayMetaData;
+        
         // Add legend first, just in case we run out of display-meta
         if (m_legendEnabled)
         {
-            // If the legend is added to a vertical axis
-            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
-                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
-            {
-                for (uint j=0; j < m_pColorPalette->GetSize(); j++)
-                {
-                    m_pColorPalette->SetIndex(j);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth + j*m_gridRectWidth*m_legendWidth, 
-                        m_legendTop*m_gridRectHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
-            }
-            // Else the legend is added to a horizontal axis
-            else
-            {
-                for (uint i=0; i < m_pColorPalette->GetSize(); i++)
-                {
-                    m_pColorPalette->SetIndex(i);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth, 
-                        m_legendTop*m_gridRectHeight + i*m_gridRectHeight*m_legendHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
-            }    
+            builder.AddTemplate(m_legend);
         }
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
+        if (imap != m_sourceHeatMaps.end())
         {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
-            {
-                // if we have at least one occurrence at the current iteration
-                if (m_heatMap[i][j])
-                {
-                    // Callculate the index into the color palette of size 10 as 
-                    // a ratio of occurrences for the current position vs. the 
-                    // position with the most occurrences. 
-                    
-                    // multiply the occurrence for the current position by 10 and 
-                    // divide by the most occurrences rouded up or down.
-                    m_pColorPalette->SetIndex(
-                        std::round((double)m_heatMap[i][j]*(m_pColorPalette->GetSize()-1) / 
-                            (double)(m_mostOccurrences)));
-                    
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW(
-                        "", j*m_gridRectWidth, i*m_gridRectHeight, m_gridRectWidth, 
-                        m_gridRectHeight, false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
-            }
+            builder.AddTemplate(imap->second->m_cells);
         }
+        heatMapMetaData.AddToFrame(pFrameMeta);
     }
 
     void OdeHeatMapper::ClearMetrics()
@@ -248,17 +513,13 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
+        m_heatMap.Clear();
+        
+        for (auto const& imap: m_sourceHeatMaps)
         {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
-            {
-                // clear data by resetting to 0
-                m_heatMap[i][j] = 0;
-            }
+            imap.second->m_pHeatMap->Clear();
+            imap.second->m_renderDirty = true;
         }
-        m_mostOccurrences = 0;
     }
 
     void OdeHeatMapper::GetMetrics(const uint64_t** buffer, uint* size)
@@ -266,16 +527,37 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        int i=0;
-        for (auto const& ivec: m_heatMap)
+        m_heatMap.Update(g_get_monotonic_time());
+        
+        const uint64_t* pCells = m_heatMap.GetGrid().GetCells();
+        m_outBuffer.assign(pCells, pCells + m_heatMap.GetGrid().GetSize());
+        
+        *buffer = m_outBuffer.data();
+        *size = m_outBuffer.size();
+    }
+
+    bool OdeHeatMapper::GetSourceMetrics(uint sourceId, 
+        const uint64_t** buffer, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        auto imap = m_sourceHeatMaps.find(sourceId);
+        if (imap == m_sourceHeatMaps.end())
         {
-            for (auto const& jvec: ivec)
-            {
-                m_outBuffer[i++] = jvec;
-            }
+            return false;
+        }
+        if (imap->second->m_pHeatMap->Update(g_get_monotonic_time()))
+        {
+            imap->second->m_renderDirty = true;
         }
-        *buffer = m_outBuffer.get();
-        *size = m_cols * m_rows;
+        HeatMapGrid& grid = imap->second->m_pHeatMap->GetGrid();
+        imap->second->m_outBuffer.assign(grid.GetCells(), 
+            grid.GetCells() + grid.GetSize());
+        
+        *buffer = imap->second->m_outBuffer.data();
+        *size = imap->second->m_outBuffer.size();
+        return true;
     }
 
     void OdeHeatMapper::PrintMetrics()
@@ -283,16 +565,20 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        m_heatMap.Update(g_get_monotonic_time());
+        HeatMapGrid& grid = m_heatMap.GetGrid();
+        
+        uint charwidth = (grid.GetMax())
+            ? floor(log10(grid.GetMax())) + 2
             : 2;
         
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << grid.GetCell(j, i);
             }
             std::cout << ss.str();
             std::cout << std::endl;
@@ -304,16 +590,20 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        m_heatMap.Update(g_get_monotonic_time());
+        HeatMapGrid& grid = m_heatMap.GetGrid();
+        
+        uint charwidth = (grid.GetMax())
+            ? floor(log10(grid.GetMax())) + 2
             : 2;
 
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << grid.GetCell(j, i);
             }
             LOG_INFO(ss.str());
         }
@@ -344,8 +634,11 @@ namespace DSL
             return false;
         }
 
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        m_heatMap.Update(g_get_monotonic_time());
+        HeatMapGrid& grid = m_heatMap.GetGrid();
+        
+        uint charwidth = (grid.GetMax())
+            ? floor(log10(grid.GetMax())) + 2
             : 2;
     
         if ( format == DSL_EVENT_FILE_FORMAT_TEXT)
@@ -363,22 +656,23 @@ namespace DSL
             ostream << " File opened: " << dateTimeStr.c_str() << "\n";
             ostream << "-------------------------------------------------------------------" << "\n";
             
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << std::setw(charwidth) << std::setfill(' ') << jvec;
+                    ostream << std::setw(charwidth) << std::setfill(' ') 
+                        << grid.GetCell(j, i);
                 }
                 ostream << std::endl;
             }
         }
         else
         {
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << jvec << ",";
+                    ostream << grid.GetCell(j, i) << ",";
                 }
                 ostream << std::endl;
             }
@@ -388,6 +682,100 @@ namespace DSL
         return true;
     }
 
+    uint OdeHeatMapper::getBucket(uint64_t count, uint64_t maxCount)
+    {
+        if (!count or !maxCount)
+        {
+            return 0;
+        }
+        // Index into the color palette as a ratio of occurrences for the 
+        // cell vs. the cell with the most occurrences, rounded up or down.
+        return 1 + std::round((double)count*(m_paletteColors.size()-1) / 
+            (double)maxCount);
+    }
+    
+    void OdeHeatMapper::renderSourceHeatMap(SourceHeatMap& sourceHeatMap)
+    {
+        sourceHeatMap.m_cells.Clear();
+        DisplayMetaBuilder recorder(sourceHeatMap.m_cells);
+        
+        HeatMapGrid& grid = sourceHeatMap.m_pHeatMap->GetGrid();
+        const uint64_t* pCells = grid.GetCells();
+        uint64_t maxCount = grid.GetMax();
+        
+        for (uint i=0; i < m_cols*m_rows; i++)
+        {
+            uint bucket = getBucket(pCells[i], maxCount);
+            sourceHeatMap.m_buckets[i] = bucket;
+            
+            // only cells with at least one occurrence are displayed.
+            if (bucket)
+            {
+                addRect(recorder, (i % m_cols)*m_gridRectWidth, 
+                    (i / m_cols)*m_gridRectHeight, m_gridRectWidth, 
+                    m_gridRectHeight, m_paletteColors[bucket-1]);
+            }
+        }
+        sourceHeatMap.m_renderDirty = false;
+    }
+    
+    void OdeHeatMapper::renderLegend()
+    {
+        m_legend.Clear();
+        DisplayMetaBuilder recorder(m_legend);
+        
+        for (uint i=0; i < m_paletteColors.size(); i++)
+        {
+            // If the legend is added to a horizontal axis
+            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
+                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+            {
+                addRect(recorder,
+                    m_legendLeft*m_gridRectWidth + i*m_gridRectWidth*m_legendWidth, 
+                    m_legendTop*m_gridRectHeight, 
+                    m_gridRectWidth*m_legendWidth, 
+                    m_gridRectHeight*m_legendHeight, m_paletteColors[i]);
+            }
+            // Else the legend is added to a vertical axis
+            else
+            {
+                addRect(recorder, m_legendLeft*m_gridRectWidth, 
+                    m_legendTop*m_gridRectHeight + i*m_gridRectHeight*m_legendHeight, 
+                    m_gridRectWidth*m_legendWidth, 
+                    m_gridRectHeight*m_legendHeight, m_paletteColors[i]);
+            }
+        }
+        m_legendDirty = false;
+    }
+    
+    void OdeHeatMapper::addRect(DisplayMetaBuilder& recorder, uint left, uint top,
+        uint width, uint height, const NvOSD_ColorParams& color)
+    {
+        NvOSD_RectParams* pRectParams = recorder.AddRect();
+        
+        *pRectParams = NvOSD_RectParams{(float)left, (float)top, 
+            (float)width, (float)height, 0, color, true, 0, color};
+    }
+    
+    void OdeHeatMapper::updatePaletteColors()
+    {
+        m_paletteColors.clear();
+        
+        for (uint i=0; i < m_pColorPalette->GetSize(); i++)
+        {
+            m_pColorPalette->SetIndex(i);
+            m_paletteColors.push_back(NvOSD_ColorParams{m_pColorPalette->red, 
+                m_pColorPalette->green, m_pColorPalette->blue, 
+                m_pColorPalette->alpha});
+        }
+        m_legendDirty = true;
+        
+        for (auto const& imap: m_sourceHeatMaps)
+        {
+            imap.second->m_renderDirty = true;
+        }
+    }
+
     void OdeHeatMapper::getCoordinate(NvDsObjectMeta* pObjectMeta, 
         dsl_coordinate& mapCoordinate)
     {
@@ -35,6 +35,14 @@ namespace DSL
     /**
      * @brief convenience macros for shared pointer abstraction
      */
+    #define DSL_HEAT_MAP_GRID_PTR std::shared_ptr<HeatMapGrid>
+    #define DSL_HEAT_MAP_GRID_NEW(cols, rows) \
+        std::shared_ptr<HeatMapGrid>(new HeatMapGrid(cols, rows))
+
+    #define DSL_HEAT_MAP_PTR std::shared_ptr<HeatMap>
+    #define DSL_HEAT_MAP_NEW(cols, rows) \
+        std::shared_ptr<HeatMap>(new HeatMap(cols, rows))
+
     #define DSL_ODE_HEAT_MAPPER_PTR std::shared_ptr<OdeHeatMapper>
     #define DSL_ODE_HEAT_MAPPER_NEW(name, rows, cols, bboxTestPoint, pColorPalette) \
         std::shared_ptr<OdeHeatMapper>(new OdeHeatMapper(name, \
@@ -42,6 +50,220 @@ namespace DSL
     
     // ********************************************************************
 
+    /**
+     * @class HeatMapGrid
+     * @brief Flat, row-major grid of occurrence counts with incremental 
+     * tracking of the most occurrences in any one cell. The cells are
+     * memory-mapped so that the grid can be exported without copying and 
+     * cleared by releasing its pages rather than writing every cell.
+     */
+    class HeatMapGrid
+    {
+    public:
+    
+        /**
+         * @brief ctor for the HeatMapGrid class
+         * @param[in] cols number of columns in the grid.
+         * @param[in] rows number of rows in the grid.
+         */
+        HeatMapGrid(uint cols, uint rows);
+        
+        /**
+         * @brief dtor for the HeatMapGrid class
+         */
+        ~HeatMapGrid();
+        
+        /**
+         * @brief Increments the count for a single cell.
+         * @param[in] col column of the cell to increment.
+         * @param[in] row row of the cell to increment.
+         * @return the new count for the cell.
+         */
+        uint64_t Increment(uint col, uint row);
+        
+        /**
+         * @brief Gets the count for a single cell.
+         * @param[in] col column of the cell to get.
+         * @param[in] row row of the cell to get.
+         * @return the current count for the cell.
+         */
+        uint64_t GetCell(uint col, uint row);
+        
+        /**
+         * @brief Gets the most occurrences in any one cell.
+         * @return the current maximum count.
+         */
+        uint64_t GetMax();
+        
+        /**
+         * @brief Gets the cells as a linear, row-major buffer.
+         * @return pointer to the first cell.
+         */
+        const uint64_t* GetCells();
+        
+        /**
+         * @brief Gets the number of cells in the grid.
+         * @return cols*rows.
+         */
+        uint GetSize();
+        
+        /**
+         * @brief Clears all counts and the maximum.
+         */
+        void Clear();
+        
+        /**
+         * @brief Subtracts the counts of another grid of the same size, 
+         * updating the maximum.
+         * @param[in] grid grid to subtract.
+         */
+        void Subtract(HeatMapGrid& grid);
+        
+        /**
+         * @brief Assigns rounded counts to all cells, updating the maximum.
+         * @param[in] values cols*rows values in row-major order.
+         */
+        void Assign(const std::vector<double>& values);
+        
+    private:
+    
+        // the grid owns its mapping, copying would double unmap.
+        HeatMapGrid(const HeatMapGrid&) = delete;
+        HeatMapGrid& operator=(const HeatMapGrid&) = delete;
+    
+        /**
+         * @brief number of columns in the grid.
+         */
+        uint m_cols;
+        
+        /**
+         * @brief number of rows in the grid.
+         */
+        uint m_rows;
+        
+        /**
+         * @brief size of the memory mapping in bytes.
+         */
+        size_t m_mapSize;
+        
+        /**
+         * @brief memory-mapped cells, cols*rows in row-major order.
+         */
+        uint64_t* m_pCells;
+        
+        /**
+         * @brief the most occurrences in any one cell.
+         */
+        uint64_t m_max;
+    };
+    
+    // ********************************************************************
+
+    /**
+     * @class HeatMap
+     * @brief Heat-Map grid with one of the DSL_HEAT_MAP_MODE_* accumulation
+     * modes. Decay mode keeps a fractional count for each cell that is scaled
+     * once every interval. Window mode keeps a ring of sub-grids, one for each
+     * interval. The oldest sub-grid is subtracted from the map and reused 
+     * each interval, so the window is maintained in O(cells).
+     */
+    class HeatMap
+    {
+    public:
+    
+        /**
+         * @brief ctor for the HeatMap class, in DSL_HEAT_MAP_MODE_ACCUMULATE
+         * @param[in] cols number of columns in the map.
+         * @param[in] rows number of rows in the map.
+         */
+        HeatMap(uint cols, uint rows);
+        
+        /**
+         * @brief Sets the accumulation mode, clearing all counts.
+         * @param[in] mode one of the DSL_HEAT_MAP_MODE_* constants.
+         * @param[in] interval update interval in microseconds.
+         * @param[in] size number of intervals for the half-life or window.
+         */
+        void SetMode(uint mode, gint64 interval, uint size);
+        
+        /**
+         * @brief Increments the count for a single cell.
+         * @param[in] col column of the cell to increment.
+         * @param[in] row row of the cell to increment.
+         * @return the new count for the cell.
+         */
+        uint64_t Increment(uint col, uint row);
+        
+        /**
+         * @brief Decays or advances the window for each interval that has
+         * completed since the last update.
+         * @param[in] currentTime current monotonic time in microseconds.
+         * @return true if the counts were updated, false otherwise.
+         */
+        bool Update(gint64 currentTime);
+        
+        /**
+         * @brief Clears all counts.
+         */
+        void Clear();
+        
+        /**
+         * @brief Gets the grid of current counts.
+         * @return the grid, which is exported without copying.
+         */
+        HeatMapGrid& GetGrid();
+        
+    private:
+    
+        /**
+         * @brief number of columns and rows in the map.
+         */
+        uint m_cols;
+        uint m_rows;
+    
+        /**
+         * @brief one of the DSL_HEAT_MAP_MODE_* constants.
+         */
+        uint m_mode;
+        
+        /**
+         * @brief update interval in microseconds.
+         */
+        gint64 m_interval;
+        
+        /**
+         * @brief start time of the current interval, 0 if not started.
+         */
+        gint64 m_intervalStart;
+        
+        /**
+         * @brief current counts, the sum of all sub-grids in window mode.
+         */
+        HeatMapGrid m_grid;
+        
+        /**
+         * @brief fractional counts for decay mode.
+         */
+        std::vector<double> m_decayedCounts;
+        
+        /**
+         * @brief factor to scale the fractional counts by each interval.
+         */
+        double m_decayFactor;
+        
+        /**
+         * @brief ring of sub-grids for window mode, one for each interval.
+         */
+        std::vector<DSL_HEAT_MAP_GRID_PTR> m_subGrids;
+        
+        /**
+         * @brief index of the sub-grid for the current interval.
+         */
+        uint m_currentSubGrid;
+    };
+    
+    // ********************************************************************
+
     class OdeHeatMapper : public OdeBase
     {
     public: 
@@ -96,6 +318,23 @@ namespace DSL
         bool SetLegendSettings(bool enabled, uint location, 
             uint width, uint height);
         
+        /**
+         * @brief Gets the current accumulation mode settings.
+         * @param[out] mode one of the DSL_HEAT_MAP_MODE_* constants.
+         * @param[out] interval update interval in seconds.
+         * @param[out] size number of intervals for the half-life or window.
+         */
+        void GetMode(uint* mode, uint* interval, uint* size);
+        
+        /**
+         * @brief Sets the accumulation mode, clearing all current metrics.
+         * @param[in] mode one of the DSL_HEAT_MAP_MODE_* constants.
+         * @param[in] interval update interval in seconds.
+         * @param[in] size number of intervals for the half-life or window.
+         * @return true on successful update, false otherwise
+         */
+        bool SetMode(uint mode, uint interval, uint size);
+        
         /**
          * @brief Handles the ODE occurrence by updating the heat-map with new 
          * the bounding box center point provided by pObjectMeta,  
@@ -105,25 +344,39 @@ namespace DSL
         void HandleOccurrence(NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
-         * @brief and adds the heat-map's display-metadata to displayMetaData for
-         * downstream display.
-         * @param[in] displayMetaData Vector of metadata structures to add the 
-         * heat-map's display-metadata to.
+         * @brief and adds the heat-map's display-metadata for the frame's 
+         * source to the frame for downstream display.
+         * @param[in] displayMetaData builder for the frame's display meta. The 
+         * heat-map uses its own Display Meta when the batch meta is available
+         * so that it does not compete with other display types for the PPH's
+         * display meta allocation.
+         * @param[in] pFrameMeta pointer to the Frame Meta for the current frame.
          */
-        void AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData);
+        void AddDisplayMeta(DisplayMetaBuilder& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
         
         /**
-         * @brief Resets the OdeHeatMapper which clears the 2D m_heatMap vector.
+         * @brief Resets the OdeHeatMapper which clears the heat-map of all
+         * sources and the heat-map of each individual source.
          */
         void ClearMetrics();
         
         /**
-         * @brief Gets the 2D m_heatMap vector as a linear buffer.
+         * @brief Gets the heat-map of all sources as a linear buffer.
          * @param[out] buffer pointer to the returned buffer
          * @param[out] size of the return buffer m_cols*m_rows
          */
         void GetMetrics(const uint64_t** buffer, uint* size); 
 
+        /**
+         * @brief Gets the heat-map of a single source as a linear buffer.
+         * @param[in] sourceId unique id of the source to query.
+         * @param[out] buffer pointer to the returned buffer
+         * @param[out] size of the return buffer m_cols*m_rows
+         * @return false if no occurrences have been mapped for sourceId.
+         */
+        bool GetSourceMetrics(uint sourceId, const uint64_t** buffer, uint* size); 
+
         /**
          * @brief Prints the 2D m_heatMap vector to the console.
          */
@@ -144,6 +397,83 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief heat-map and cached rendering for a single source.
+         */
+        struct SourceHeatMap
+        {
+            SourceHeatMap(uint cols, uint rows)
+                : m_pHeatMap(DSL_HEAT_MAP_NEW(cols, rows))
+                , m_buckets(cols*rows, 0)
+                , m_outBuffer(cols*rows, 0)
+                , m_renderDirty(true)
+            {};
+            
+            /**
+             * @brief occurrence counts for the source.
+             */
+            DSL_HEAT_MAP_PTR m_pHeatMap;
+            
+            /**
+             * @brief color bucket for each cell when last rendered, 0 for 
+             * empty cells and 1 + palette index for all others.
+             */
+            std::vector<uint> m_buckets;
+            
+            /**
+             * @brief cached cell rectangles from when last rendered.
+             */
+            DisplayTemplate m_cells;
+            
+            /**
+             * @brief linear array of the source's metrics updated on call 
+             * to get source metrics and returned to the caller.
+             */
+            std::vector<uint64_t> m_outBuffer;
+            
+            /**
+             * @brief true if a cell's color bucket has changed since rendered.
+             */
+            bool m_renderDirty;
+        };
+    
+        /**
+         * @brief Gets the color bucket for a cell count.
+         * @param[in] count occurrences in the cell.
+         * @param[in] maxCount most occurrences in any one cell.
+         * @return 0 if count is 0, 1 + the palette index otherwise.
+         */
+        uint getBucket(uint64_t count, uint64_t maxCount);
+        
+        /**
+         * @brief Rebuilds the cached cell rectangles for a source.
+         * @param[in] sourceHeatMap source heat-map to render.
+         */
+        void renderSourceHeatMap(SourceHeatMap& sourceHeatMap);
+        
+        /**
+         * @brief Rebuilds the cached legend rectangles.
+         */
+        void renderLegend();
+        
+        /**
+         * @brief Records a single filled rectangle.
+         * @param[in] recorder recording builder to add the rectangle to.
+         * @param[in] left left position in pixels.
+         * @param[in] top top position in pixels.
+         * @param[in] width width in pixels.
+         * @param[in] height height in pixels.
+         * @param[in] color border and background color.
+         */
+        void addRect(DisplayMetaBuilder& recorder, uint left, uint top,
+            uint width, uint height, const NvOSD_ColorParams& color);
+        
+        /**
+         * @brief Caches the colors of the current Color Palette, and marks
+         * all rendering as dirty.
+         */
+        void updatePaletteColors();
+    
         /**
          * @brief returs x,y coordinates from an Object's bbox coordinates
          * and size as determined by the bboxTextPoint
@@ -188,20 +518,50 @@ namespace DSL
         DSL_RGBA_COLOR_PALETTE_PTR m_pColorPalette;
         
         /**
-         * @brief two dimensional vector sized cols x rows
+         * @brief cached colors of the Color Palette, one for each bucket.
+         */
+        std::vector<NvOSD_ColorParams> m_paletteColors;
+        
+        /**
+         * @brief heat-map of all sources.
+         */
+        HeatMap m_heatMap;
+        
+        /**
+         * @brief linear array of heat-map metrics updated on call to get
+         * metrics and returned to the caller.
+         */
+        std::vector<uint64_t> m_outBuffer;
+        
+        /**
+         * @brief one of the DSL_HEAT_MAP_MODE_* constants.
+         */
+        uint m_mode;
+        
+        /**
+         * @brief update interval in seconds.
+         */
+        uint m_modeInterval;
+        
+        /**
+         * @brief number of intervals for the half-life or window.
+         */
+        uint m_modeSize;
+        
+        /**
+         * @brief heat-map for each source, mapped by source id.
          */
-        std::vector<std::vector<uint64_t>> m_heatMap;
+        std::map<uint, std::unique_ptr<SourceHeatMap>> m_sourceHeatMaps;
         
         /**
-         * @brief a linear array of heat-map metrics updated on
-         * on call to get metrics and returned to the caller.
+         * @brief cached legend rectangles.
          */
-        std::unique_ptr<uint64_t[]> m_outBuffer;
+        DisplayTemplate m_legend;
         
         /**
-         * @brief the most occurrences in any one map location..
+         * @brief true if the legend settings have changed since rendered.
          */
-        uint64_t m_mostOccurrences;
+        bool m_legendDirty;
         
         /**
          * @brief true if Legend display is enabled, false otherwise.
@@ -0,0 +1,166 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeStats.h"
+
+namespace DSL
+{
+    OdeComponentStats::OdeComponentStats()
+        : m_refCount(0)
+    {
+        for (auto& recorded: m_recorded)
+        {
+            recorded = false;
+        }
+    }
+    
+    bool OdeComponentStats::GetStats(uint phase, dsl_latency_stats* stats)
+    {
+        if (phase >= DSL_ODE_STATS_PHASES or !m_recorded[phase])
+        {
+            return false;
+        }
+        m_histograms[phase].GetStats(stats);
+        return true;
+    }
+    
+    void OdeComponentStats::Clear()
+    {
+        for (auto& histogram: m_histograms)
+        {
+            histogram.Clear();
+        }
+    }
+    
+    //--------------------------------------------------------------------------------
+
+    thread_local OdeStats* OdeStats::s_pCurrent(NULL);
+
+    OdeStats::OdeStats()
+    {
+        LOG_FUNC();
+    }
+    
+    OdeStats::~OdeStats()
+    {
+        LOG_FUNC();
+    }
+    
+    void OdeStats::AddComponent(OdeBase* pComponent)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        
+        auto imap = m_componentStats.find(pComponent);
+        if (imap != m_componentStats.end())
+        {
+            imap->second->m_refCount++;
+            return;
+        }
+        if (pComponent->GetOdeStats())
+        {
+            LOG_WARN("ODE component '" << pComponent->GetName() 
+                << "' is recording its stats to another ODE Handler");
+            return;
+        }
+        std::unique_ptr<OdeComponentStats> pComponentStats;
+        if (m_retiredStats.size())
+        {
+            pComponentStats = std::move(m_retiredStats.back());
+            m_retiredStats.pop_back();
+            pComponentStats->Clear();
+            for (auto& recorded: pComponentStats->m_recorded)
+            {
+                recorded = false;
+            }
+        }
+        else
+        {
+            pComponentStats = std::unique_ptr<OdeComponentStats>(
+                new OdeComponentStats());
+        }
+        pComponentStats->m_name = pComponent->GetName();
+        pComponentStats->m_refCount = 1;
+        
+        pComponent->SetOdeStats(pComponentStats.get());
+        m_componentStats[pComponent] = std::move(pComponentStats);
+    }
+    
+    void OdeStats::RemoveComponent(OdeBase* pComponent)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        
+        auto imap = m_componentStats.find(pComponent);
+        if (imap == m_componentStats.end() or --imap->second->m_refCount)
+        {
+            return;
+        }
+        pComponent->SetOdeStats(NULL);
+        
+        m_retiredStats.push_back(std::move(imap->second));
+        m_componentStats.erase(imap);
+    }
+    
+    void OdeStats::RecordFrame(uint64_t nanoseconds)
+    {
+        m_frameHistogram.Record(nanoseconds);
+    }
+    
+    bool OdeStats::GetStats(const char* name, uint phase, 
+        dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        
+        for (auto const& imap: m_componentStats)
+        {
+            if (imap.second->m_name == name)
+            {
+                return imap.second->GetStats(phase, stats);
+            }
+        }
+        return false;
+    }
+    
+    void OdeStats::GetFrameStats(dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        
+        m_frameHistogram.GetStats(stats);
+    }
+    
+    void OdeStats::Clear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        
+        for (auto const& imap: m_componentStats)
+        {
+            imap.second->Clear();
+        }
+        m_frameHistogram.Clear();
+    }
+}
@@ -0,0 +1,323 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_STATS_H
+#define _DSL_ODE_STATS_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslOdeBase.h"
+#include "DslLatencyHistogram.h"
+
+namespace DSL
+{
+    /**
+     * @brief phase used to record the latency of an ODE Action's 
+     * HandleOccurrence. Trigger phases are the DSL_PPH_ODE_STATS_PHASE_* 
+     * constants.
+     */
+    #define DSL_ODE_STATS_PHASE_ACTION          3
+    #define DSL_ODE_STATS_PHASES                4
+
+    /**
+     * @class OdeComponentStats
+     * @brief Latency histograms, one for each phase, for a single ODE Trigger
+     * or Action. Created by OdeStats when the component is added to an ODE
+     * Handler and stored on the component, so recording needs no lookup.
+     */
+    class OdeComponentStats
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeComponentStats class
+         */
+        OdeComponentStats();
+        
+        /**
+         * @brief Records the latency of a single call. Lock-free.
+         * @param[in] phase phase the call was made in.
+         * @param[in] nanoseconds latency of the call.
+         */
+        void Record(uint phase, uint64_t nanoseconds)
+        {
+            if (!m_recorded[phase].load(std::memory_order_relaxed))
+            {
+                m_recorded[phase].store(true, std::memory_order_relaxed);
+            }
+            m_histograms[phase].Record(nanoseconds);
+        };
+        
+        /**
+         * @brief Gets the latency stats for a single phase.
+         * @param[in] phase phase to get the stats for.
+         * @param[out] stats summary of the phase's histogram.
+         * @return true if a call has been recorded in the phase, false otherwise.
+         */
+        bool GetStats(uint phase, dsl_latency_stats* stats);
+        
+        /**
+         * @brief Clears the histograms of all phases.
+         */
+        void Clear();
+        
+    private:
+    
+        friend class OdeStats;
+    
+        /**
+         * @brief unique name of the Trigger or Action, guarded by the owning
+         * OdeStats' mutex.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief number of times the component has been added to the owning
+         * OdeStats - Actions can be shared by the Triggers of a Handler.
+         */
+        uint m_refCount;
+        
+        /**
+         * @brief true once a call has been recorded in the phase.
+         */
+        std::atomic<bool> m_recorded[DSL_ODE_STATS_PHASES];
+        
+        /**
+         * @brief latency histogram for each phase.
+         */
+        LatencyHistogram m_histograms[DSL_ODE_STATS_PHASES];
+    };
+
+    /**
+     * @class OdeStats
+     * @brief Call counts and latency histograms for the ODE Triggers and 
+     * Actions of an ODE Pad Probe Handler, and for each frame processed. 
+     * Histograms are resolved once, when a Trigger/Action is added to the
+     * Handler, and stored on the component.
+     */
+    class OdeStats
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeStats class
+         */
+        OdeStats();
+        
+        /**
+         * @brief dtor for the OdeStats class
+         */
+        ~OdeStats();
+        
+        /**
+         * @brief Adds an ODE Trigger or Action, creating the stats it records
+         * to and storing them on the component. A component already recording
+         * to another Handler's stats continues to do so.
+         * @param[in] pComponent ODE Trigger or Action to add.
+         */
+        void AddComponent(OdeBase* pComponent);
+        
+        /**
+         * @brief Removes an ODE Trigger or Action previously added, clearing
+         * the stats stored on the component once it has been removed as many
+         * times as it was added. All components must be removed before the 
+         * OdeStats are destroyed.
+         * @param[in] pComponent ODE Trigger or Action to remove.
+         */
+        void RemoveComponent(OdeBase* pComponent);
+        
+        /**
+         * @brief Records the latency of a single call to the stats stored on
+         * the component, if any. 
+         * @param[in] pComponent ODE Trigger or Action that was called.
+         * @param[in] phase one of the DSL_PPH_ODE_STATS_PHASE_* constants or
+         * DSL_ODE_STATS_PHASE_ACTION.
+         * @param[in] nanoseconds latency of the call.
+         */
+        void Record(OdeBase* pComponent, uint phase, uint64_t nanoseconds)
+        {
+            OdeComponentStats* pComponentStats = pComponent->GetOdeStats();
+            if (pComponentStats)
+            {
+                pComponentStats->Record(phase, nanoseconds);
+            }
+        };
+        
+        /**
+         * @brief Records the time taken to process a single frame.
+         * @param[in] nanoseconds latency of the frame.
+         */
+        void RecordFrame(uint64_t nanoseconds);
+        
+        /**
+         * @brief Gets the latency stats for a named ODE Trigger or Action.
+         * @param[in] name unique name of the Trigger or Action.
+         * @param[in] phase phase to get the stats for.
+         * @param[out] stats summary of the phase's histogram.
+         * @return true if the Trigger/Action has been called in the given 
+         * phase, false otherwise.
+         */
+        bool GetStats(const char* name, uint phase, dsl_latency_stats* stats);
+        
+        /**
+         * @brief Gets the latency stats for all frames processed.
+         * @param[out] stats summary of the frame histogram.
+         */
+        void GetFrameStats(dsl_latency_stats* stats);
+        
+        /**
+         * @brief Clears all stats.
+         */
+        void Clear();
+        
+        /**
+         * @brief Gets the stats installed for the calling thread.
+         * @return the installed stats, NULL if none.
+         */
+        static OdeStats* GetCurrent()
+        {
+            return s_pCurrent;
+        };
+        
+        /**
+         * @brief Installs stats for the calling thread.
+         * @param[in] pStats stats to install, NULL to uninstall.
+         */
+        static void SetCurrent(OdeStats* pStats)
+        {
+            s_pCurrent = pStats;
+        };
+
+    private:
+    
+        /**
+         * @brief mutex to guard the map of components. Never taken when
+         * recording.
+         */
+        DslMutex m_statsMutex;
+        
+        /**
+         * @brief map of stats indexed by their Trigger/Action.
+         */
+        std::unordered_map<OdeBase*, 
+            std::unique_ptr<OdeComponentStats>> m_componentStats;
+        
+        /**
+         * @brief stats of removed components. A streaming thread may still be
+         * recording to them, so they are kept for reuse rather than deleted.
+         */
+        std::vector<std::unique_ptr<OdeComponentStats>> m_retiredStats;
+        
+        /**
+         * @brief histogram of frame latencies.
+         */
+        LatencyHistogram m_frameHistogram;
+        
+        /**
+         * @brief stats installed for each thread.
+         */
+        static thread_local OdeStats* s_pCurrent;
+    };
+    
+    /**
+     * @class OdeStatsScope
+     * @brief Installs OdeStats for the calling thread for the lifetime of the
+     * scope, restoring the previous stats on exit.
+     */
+    class OdeStatsScope
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeStatsScope class
+         * @param[in] pStats stats to install, may be NULL.
+         */
+        OdeStatsScope(OdeStats* pStats)
+            : m_pPrevious(OdeStats::GetCurrent())
+        {
+            OdeStats::SetCurrent(pStats);
+        };
+        
+        /**
+         * @brief dtor for the OdeStatsScope class
+         */
+        ~OdeStatsScope()
+        {
+            OdeStats::SetCurrent(m_pPrevious);
+        };
+        
+    private:
+    
+        /**
+         * @brief stats installed before this scope.
+         */
+        OdeStats* m_pPrevious;
+    };
+    
+    /**
+     * @class OdeStatsTimer
+     * @brief Records the latency of the enclosing scope to the stats stored 
+     * on the component. Does nothing, other than a single check, when 
+     * constructed with NULL stats.
+     */
+    class OdeStatsTimer
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeStatsTimer class
+         * @param[in] pStats stats installed for the thread, NULL if disabled.
+         * @param[in] pComponent ODE Trigger or Action being timed.
+         * @param[in] phase phase being timed.
+         */
+        OdeStatsTimer(OdeStats* pStats, OdeBase* pComponent, uint phase)
+            : m_pComponentStats((pStats) ? pComponent->GetOdeStats() : NULL)
+            , m_phase(phase)
+            , m_start((m_pComponentStats) ? CycleCounter::Now() : 0)
+        {
+        };
+        
+        /**
+         * @brief dtor for the OdeStatsTimer class
+         */
+        ~OdeStatsTimer()
+        {
+            if (m_pComponentStats)
+            {
+                m_pComponentStats->Record(m_phase,
+                    CycleCounter::ToNanoseconds(CycleCounter::Now() - m_start));
+            }
+        };
+        
+    private:
+    
+        OdeComponentStats* m_pComponentStats;
+        
+        uint m_phase;
+        
+        uint64_t m_start;
+    };
+}
+
+#endif // _DSL_ODE_STATS_H
@@ -280,6 +280,12 @@ namespace DSL
         double GetCreationTime(NvDsFrameMeta* pFrameMeta, 
             NvDsObjectMeta* pObjectMeta);
         
+        /**
+         * @brief Gets the max history for all objects tracked
+         * @return current max history setting.
+         */
+        uint GetMaxHistory(){return m_maxHistory;};
+        
         /**
          * @brief Sets the max history for all objects tracked
          * @param maxHistory new max history setting.
@@ -33,42 +33,42 @@ namespace DSL
 {
 
     // Initialize static Event Counter
-    uint64_t OdeTrigger::s_eventCount = 0;
+    std::atomic<uint64_t> OdeTrigger::s_eventCount(0);
+
+    thread_local const OdeTriggerFrameSnapshot* 
+        OdeTriggerFrameScope::s_pCurrent(NULL);
+
+    OdeTriggerFrameView::OdeTriggerFrameView(OdeTrigger* pOdeTrigger, 
+        uint sourceId)
+        : m_pSnapshot(OdeTriggerFrameScope::GetCurrent())
+    {
+        if (!m_pSnapshot or m_pSnapshot->pOdeTrigger != pOdeTrigger or 
+            m_pSnapshot->sourceId != sourceId)
+        {
+            pOdeTrigger->LoadFrameSnapshot(m_loaded, sourceId);
+            m_pSnapshot = &m_loaded;
+        }
+    }
 
     OdeTrigger::OdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
         : OdeBase(name)
         , m_wName(m_name.begin(), m_name.end())
-        , m_source(source)
         , m_sourceId(-1)
         , m_inferId(-1)
-        , m_classId(classId)
         , m_triggered(0)
-        , m_eventLimit(limit)
         , m_frameCount(0)
-        , m_frameLimit(0)
-        , m_occurrences(0)
-        , m_occurrencesAccumulated(0)
-        , m_minConfidence(0)
-        , m_maxConfidence(0)
-        , m_minTrackerConfidence(0)
-        , m_maxTrackerConfidence(0)
-        , m_minWidth(0)
-        , m_minHeight(0)
-        , m_maxWidth(0)
-        , m_maxHeight(0)
-        , m_minFrameCountN(1)
-        , m_minFrameCountD(1)
-        , m_inferDoneOnly(false)
         , m_resetTimeout(0)
-        , m_resetTimerId(0)
-        , m_interval(0)
-        , m_intervalCounter(0)
-        , m_skipFrame(false)
         , m_nextAreaIndex(0)
         , m_nextActionIndex(0)
+        , m_pParentStats(NULL)
     {
         LOG_FUNC();
+        
+        std::atomic_store(&m_pConfig, DSL_ODE_TRIGGER_CONFIG_PTR(
+            new OdeTriggerConfig(source, classId, limit)));
+        std::atomic_store(&m_pSourceStates, DSL_ODE_TRIGGER_SOURCE_STATES_PTR(
+            new std::map<uint, DSL_ODE_TRIGGER_SOURCE_STATE_PTR>));
     }
 
     OdeTrigger::~OdeTrigger()
@@ -82,17 +82,16 @@ namespace DSL
             RemoveAccumulator();
         }
         
-        if (m_resetTimerId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
-            g_source_remove(m_resetTimerId);
+            m_resetTimer.Remove();
         }
     }
 
     bool OdeTrigger::AddAction(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeActions.find(pChild->GetName()) != m_pOdeActions.end())
         {
@@ -109,13 +108,19 @@ namespace DSL
         m_pOdeActions[pChild->GetName()] = pChild;
         m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
         
+        if (m_pParentStats)
+        {
+            m_pParentStats->AddComponent(
+                std::dynamic_pointer_cast<OdeBase>(pChild).get());
+        }
+        PublishChildren();
         return true;
     }
 
     bool OdeTrigger::RemoveAction(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeActions.find(pChild->GetName()) == m_pOdeActions.end())
         {
@@ -128,31 +133,76 @@ namespace DSL
         m_pOdeActions.erase(pChild->GetName());
         m_pOdeActionsIndexed.erase(pChild->GetIndex());
         
+        if (m_pParentStats)
+        {
+            m_pParentStats->RemoveComponent(
+                std::dynamic_pointer_cast<OdeBase>(pChild).get());
+        }
         // Clear the parent relationship and index
         pChild->ClearParentName();
         pChild->SetIndex(0);
+        
+        PublishChildren();
         return true;
     }
     
     void OdeTrigger::RemoveAllActions()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         for (auto &imap: m_pOdeActions)
         {
             LOG_DEBUG("Removing Action '" << imap.second->GetName() 
                 <<"' from Parent '" << GetName() << "'");
+            if (m_pParentStats)
+            {
+                m_pParentStats->RemoveComponent(
+                    std::dynamic_pointer_cast<OdeBase>(imap.second).get());
+            }
             imap.second->ClearParentName();
         }
         m_pOdeActions.clear();
         m_pOdeActionsIndexed.clear();
+        
+        PublishChildren();
+    }
+    
+    void OdeTrigger::SetParentStats(OdeStats* pParentStats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        if (m_pParentStats)
+        {
+            m_pParentStats->RemoveComponent(this);
+            for (auto &imap: m_pOdeActions)
+            {
+                m_pParentStats->RemoveComponent(
+                    std::dynamic_pointer_cast<OdeBase>(imap.second).get());
+            }
+        }
+        m_pParentStats = pParentStats;
+        if (m_pParentStats)
+        {
+            m_pParentStats->AddComponent(this);
+            for (auto &imap: m_pOdeActions)
+            {
+                m_pParentStats->AddComponent(
+                    std::dynamic_pointer_cast<OdeBase>(imap.second).get());
+            }
+        }
+        if (m_pAccumulator)
+        {
+            std::dynamic_pointer_cast<OdeAccumulator>(
+                m_pAccumulator)->SetParentStats(m_pParentStats);
+        }
     }
     
     bool OdeTrigger::AddArea(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeAreas.find(pChild->GetName()) != m_pOdeAreas.end())
         {
@@ -168,13 +218,14 @@ namespace DSL
         m_pOdeAreas[pChild->GetName()] = pChild;
         m_pOdeAreasIndexed[m_nextAreaIndex] = pChild;
         
+        PublishChildren();
         return true;
     }
 
     bool OdeTrigger::RemoveArea(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeAreas.find(pChild->GetName()) == m_pOdeAreas.end())
         {
@@ -191,13 +242,14 @@ namespace DSL
         pChild->ClearParentName();
         pChild->SetIndex(0);
         
+        PublishChildren();
         return true;
     }
     
     void OdeTrigger::RemoveAllAreas()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         for (auto &imap: m_pOdeAreas)
         {
@@ -207,12 +259,14 @@ namespace DSL
         }
         m_pOdeAreas.clear();
         m_pOdeAreasIndexed.clear();
+        
+        PublishChildren();
     }
 
     bool OdeTrigger::AddAccumulator(DSL_BASE_PTR pAccumulator)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
         if (m_pAccumulator)
         {
@@ -221,13 +275,19 @@ namespace DSL
             return false;
         }
         m_pAccumulator = pAccumulator;
+        if (m_pParentStats)
+        {
+            std::dynamic_pointer_cast<OdeAccumulator>(
+                m_pAccumulator)->SetParentStats(m_pParentStats);
+        }
+        PublishChildren();
         return true;
     }
     
     bool OdeTrigger::RemoveAccumulator()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
         if (!m_pAccumulator)
         {
@@ -235,14 +295,20 @@ namespace DSL
                 << "' does not have an Accumulator");
             return false;
         }
+        if (m_pParentStats)
+        {
+            std::dynamic_pointer_cast<OdeAccumulator>(
+                m_pAccumulator)->SetParentStats(NULL);
+        }
         m_pAccumulator = NULL;
+        PublishChildren();
         return true;
     }
         
     bool OdeTrigger::AddHeatMapper(DSL_BASE_PTR pHeatMapper)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
         if (m_pHeatMapper)
         {
@@ -251,13 +317,14 @@ namespace DSL
             return false;
         }
         m_pHeatMapper = pHeatMapper;
+        PublishChildren();
         return true;
     }
     
     bool OdeTrigger::RemoveHeatMapper()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
         if (!m_pHeatMapper)
         {
@@ -266,26 +333,73 @@ namespace DSL
             return false;
         }
         m_pHeatMapper = NULL;
+        PublishChildren();
         return true;
     }
+    
+    std::shared_ptr<OdeTriggerConfig> OdeTrigger::CloneConfig()
+    {
+        // internal do not lock m_configMutex
+        
+        return std::shared_ptr<OdeTriggerConfig>(
+            new OdeTriggerConfig(*GetConfig()));
+    }
+    
+    void OdeTrigger::PublishConfig(std::shared_ptr<OdeTriggerConfig> pConfig)
+    {
+        // internal do not lock m_configMutex
+        
+        std::atomic_store(&m_pConfig, DSL_ODE_TRIGGER_CONFIG_PTR(pConfig));
+    }
+    
+    void OdeTrigger::PublishChildren()
+    {
+        // internal do not lock m_configMutex
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        
+        // cast once here so the streaming thread never has to
+        pConfig->m_odeActions.clear();
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            pConfig->m_odeActions.push_back(
+                std::dynamic_pointer_cast<OdeAction>(imap.second));
+        }
+        pConfig->m_odeAreas.clear();
+        for (const auto &imap: m_pOdeAreasIndexed)
+        {
+            pConfig->m_odeAreas.push_back(
+                std::dynamic_pointer_cast<OdeArea>(imap.second));
+        }
+        pConfig->m_pAccumulator = 
+            std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
+        pConfig->m_pHeatMapper = 
+            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper);
+            
+        PublishConfig(pConfig);
+    }
         
     void OdeTrigger::Reset()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
         
         m_triggered = 0;
-        m_occurrencesAccumulated = 0;
+        for (const auto &imap: *std::atomic_load(&m_pSourceStates))
+        {
+            imap.second->m_occurrencesAccumulated = 0;
+        }
         
         m_frameCount = 0;
         
         // iterate through the map of limit-event-listeners calling each
-        for(auto const& imap: m_limitStateChangeListeners)
+        for(auto const& imap: pConfig->m_limitStateChangeListeners)
         {
             try
             {
                 imap.first(DSL_ODE_TRIGGER_LIMIT_COUNTS_RESET, 
-                    m_eventLimit, imap.second);
+                    pConfig->m_eventLimit, imap.second);
             }
             catch(...)
             {
@@ -294,22 +408,98 @@ namespace DSL
         }
     }
     
-    void OdeTrigger::IncrementAndCheckTriggerCount()
+    DSL_ODE_TRIGGER_SOURCE_STATE_PTR OdeTrigger::GetSourceState(uint sourceId)
+    {
+        // Lock free lookup for all sources seen before
+        DSL_ODE_TRIGGER_SOURCE_STATES_PTR pSourceStates = 
+            std::atomic_load(&m_pSourceStates);
+        
+        auto iter = pSourceStates->find(sourceId);
+        if (iter != pSourceStates->end())
+        {
+            return iter->second;
+        }
+        
+        // New source - copy, add, and publish a new map.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sourceStatesMutex);
+
+        // check again in case the state was added while waiting on the lock.
+        pSourceStates = std::atomic_load(&m_pSourceStates);
+        iter = pSourceStates->find(sourceId);
+        if (iter != pSourceStates->end())
+        {
+            return iter->second;
+        }
+        std::shared_ptr<std::map<uint, DSL_ODE_TRIGGER_SOURCE_STATE_PTR>> 
+            pNewSourceStates(new std::map<uint, DSL_ODE_TRIGGER_SOURCE_STATE_PTR>(
+                *pSourceStates));
+                
+        DSL_ODE_TRIGGER_SOURCE_STATE_PTR pSourceState(new OdeTriggerSourceState);
+        (*pNewSourceStates)[sourceId] = pSourceState;
+        
+        std::atomic_store(&m_pSourceStates, 
+            DSL_ODE_TRIGGER_SOURCE_STATES_PTR(pNewSourceStates));
+
+        return pSourceState;
+    }
+    
+    void OdeTrigger::LoadFrameSnapshot(OdeTriggerFrameSnapshot& snapshot, 
+        uint sourceId)
+    {
+        snapshot.pOdeTrigger = this;
+        snapshot.sourceId = sourceId;
+        snapshot.pConfig = GetConfig();
+        snapshot.pSourceState = GetSourceState(sourceId);
+    }
+    
+    uint64_t OdeTrigger::GetEventCount()
+    {
+        LOG_FUNC();
+        
+        return m_triggered;
+    }
+    
+    uint64_t OdeTrigger::GetFrameCount()
+    {
+        LOG_FUNC();
+        
+        return m_frameCount;
+    }
+    
+    uint64_t OdeTrigger::GetOccurrencesAccumulated()
+    {
+        uint64_t occurrencesAccumulated(0);
+        
+        for (const auto &imap: *std::atomic_load(&m_pSourceStates))
+        {
+            occurrencesAccumulated += imap.second->m_occurrencesAccumulated;
+        }
+        return occurrencesAccumulated;
+    }
+    
+    bool OdeTrigger::IsSourceSharded()
+    {
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
+        return (!pConfig->m_eventLimit and !pConfig->m_frameLimit and
+            !pConfig->m_pAccumulator and !pConfig->m_pHeatMapper);
+    }
+    
+    void OdeTrigger::IncrementAndCheckTriggerCount(const OdeTriggerConfig& config)
     {
         LOG_FUNC();
-        // internal do not lock m_propertyMutex
         
-        m_triggered++;
+        uint64_t triggered = ++m_triggered;
         
-        if (m_triggered >= m_eventLimit)
+        if (triggered >= config.m_eventLimit)
         {
             // iterate through the map of limit-event-listeners calling each
-            for(auto const& imap: m_limitStateChangeListeners)
+            for(auto const& imap: config.m_limitStateChangeListeners)
             {
                 try
                 {
                     imap.first(DSL_ODE_TRIGGER_LIMIT_EVENT_REACHED, 
-                        m_eventLimit, imap.second);
+                        config.m_eventLimit, imap.second);
                 }
                 catch(...)
                 {
@@ -318,8 +508,13 @@ namespace DSL
             }
             if (m_resetTimeout)
             {
-                m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                    TriggerResetTimeoutHandler, this);            
+                // Only taken once the limit has been reached.
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
+                if (!m_resetTimer)
+                {
+                    m_resetTimer.AddTimeout(NULL, 1000*m_resetTimeout, 
+                        TriggerResetTimeoutHandler, this);            
+                }
             }
         }
     }
@@ -335,7 +530,7 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
         
-        m_resetTimerId = 0;
+        m_resetTimer.Clear();
         Reset();
         
         // One shot - return false.
@@ -354,35 +549,38 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
         
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
         // If the timer is currently running and the new 
         // timeout value is zero (disabled), then kill the timer.
-        if (m_resetTimerId and !timeout)
+        if (m_resetTimer and !timeout)
         {
-            g_source_remove(m_resetTimerId);
-            m_resetTimerId = 0;
+            m_resetTimer.Remove();
         }
         
         // Else, if the Timer is currently running and the new
         // timeout value is non-zero, stop and restart the timer.
-        else if (m_resetTimerId and timeout)
+        else if (m_resetTimer and timeout)
         {
-            g_source_remove(m_resetTimerId);
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
+            m_resetTimer.Remove();
+            m_resetTimer.AddTimeout(NULL, 1000*m_resetTimeout, 
                 TriggerResetTimeoutHandler, this);            
         }
         
         // Else, if the Trigger has reached its limit and the 
         // client is setting a Timeout value, start the timer.
-        else if (m_eventLimit and (m_triggered >= m_eventLimit) and timeout)
+        else if (pConfig->m_eventLimit and 
+            (m_triggered >= pConfig->m_eventLimit) and timeout)
         {
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
+            m_resetTimer.AddTimeout(NULL, 1000*m_resetTimeout, 
                 TriggerResetTimeoutHandler, this);            
         } 
         // Else, if the Trigger has reached its frame limit and the 
         // client is setting a Timeout value, start the timer.
-        else if (m_frameLimit and (m_frameCount >= m_frameLimit) and timeout)
+        else if (pConfig->m_frameLimit and 
+            (m_frameCount >= pConfig->m_frameLimit) and timeout)
         {
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
+            m_resetTimer.AddTimeout(NULL, 1000*m_resetTimeout, 
                 TriggerResetTimeoutHandler, this);            
         } 
         
@@ -392,23 +590,26 @@ namespace DSL
     bool OdeTrigger::IsResetTimerRunning()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
 
-        return m_resetTimerId;
+        return static_cast<bool>(m_resetTimer);
     }
     
     bool OdeTrigger::AddLimitStateChangeListener(
         dsl_ode_trigger_limit_state_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (m_limitStateChangeListeners.find(listener) != 
-            m_limitStateChangeListeners.end())
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        if (pConfig->m_limitStateChangeListeners.find(listener) != 
+            pConfig->m_limitStateChangeListeners.end())
         {   
             LOG_ERROR("Limit state change listener is not unique");
             return false;
         }
-        m_limitStateChangeListeners[listener] = clientData;
+        pConfig->m_limitStateChangeListeners[listener] = clientData;
+        PublishConfig(pConfig);
 
         return true;
     }
@@ -417,15 +618,17 @@ namespace DSL
         dsl_ode_trigger_limit_state_change_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (m_limitStateChangeListeners.find(listener) == 
-            m_limitStateChangeListeners.end())
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        if (pConfig->m_limitStateChangeListeners.find(listener) == 
+            pConfig->m_limitStateChangeListeners.end())
         {   
             LOG_ERROR("Limit state change listener was not found");
             return false;
         }
-        m_limitStateChangeListeners.erase(listener);
+        pConfig->m_limitStateChangeListeners.erase(listener);
+        PublishConfig(pConfig);
 
         return true;
     }        
@@ -434,39 +637,46 @@ namespace DSL
     {
         LOG_FUNC();
         
-        return m_classId;
+        return GetConfig()->m_classId;
     }
     
     void OdeTrigger::SetClassId(uint classId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_classId = classId;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_classId = classId;
+        PublishConfig(pConfig);
     }
 
     uint OdeTrigger::GetEventLimit()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        return m_eventLimit;
+        return GetConfig()->m_eventLimit;
     }
     
     void OdeTrigger::SetEventLimit(uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        
-        m_eventLimit = limit;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+            
+            std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+            pConfig->m_eventLimit = limit;
+            PublishConfig(pConfig);
+        }
+        // config mutex unlocked - the client may call back into the Trigger.
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
         
         // iterate through the map of limit-event-listeners calling each
-        for(auto const& imap: m_limitStateChangeListeners)
+        for(auto const& imap: pConfig->m_limitStateChangeListeners)
         {
             try
             {
                 imap.first(DSL_ODE_TRIGGER_LIMIT_EVENT_CHANGED, 
-                    m_eventLimit, imap.second);
+                    limit, imap.second);
             }
             catch(...)
             {
@@ -478,25 +688,30 @@ namespace DSL
     uint OdeTrigger::GetFrameLimit()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        return m_frameLimit;
+        return GetConfig()->m_frameLimit;
     }
     
     void OdeTrigger::SetFrameLimit(uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        
-        m_frameLimit = limit;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+            
+            std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+            pConfig->m_frameLimit = limit;
+            PublishConfig(pConfig);
+        }
+        // config mutex unlocked - the client may call back into the Trigger.
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
         
         // iterate through the map of limit-event-listeners calling each
-        for(auto const& imap: m_limitStateChangeListeners)
+        for(auto const& imap: pConfig->m_limitStateChangeListeners)
         {
             try
             {
                 imap.first(DSL_ODE_TRIGGER_LIMIT_FRAME_CHANGED, 
-                    m_frameLimit, imap.second);
+                    limit, imap.second);
             }
             catch(...)
             {
@@ -508,10 +723,12 @@ namespace DSL
     const char* OdeTrigger::GetSource()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        if (m_source.size())
+        // m_pConfig can only be replaced while holding m_configMutex
+        if (m_pConfig->m_source.size())
         {
-            return m_source.c_str();
+            return m_pConfig->m_source.c_str();
         }
         return NULL;
     }
@@ -519,9 +736,11 @@ namespace DSL
     void OdeTrigger::SetSource(const char* source)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_source.assign(source);
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_source.assign(source);
+        PublishConfig(pConfig);
     }
 
     void OdeTrigger::_setSourceId(int id)
@@ -534,10 +753,12 @@ namespace DSL
     const char* OdeTrigger::GetInfer()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        if (m_infer.size())
+        // m_pConfig can only be replaced while holding m_configMutex
+        if (m_pConfig->m_infer.size())
         {
-            return m_infer.c_str();
+            return m_pConfig->m_infer.c_str();
         }
         return NULL;
     }
@@ -545,9 +766,11 @@ namespace DSL
     void OdeTrigger::SetInfer(const char* infer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_infer.assign(infer);
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_infer.assign(infer);
+        PublishConfig(pConfig);
     }
 
     void OdeTrigger::_setInferId(int id)
@@ -561,157 +784,186 @@ namespace DSL
     {
         LOG_FUNC();
         
-        return m_minConfidence;
+        return GetConfig()->m_minConfidence;
     }
     
     void OdeTrigger::SetMinConfidence(float minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minConfidence = minConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minConfidence = minConfidence;
+        PublishConfig(pConfig);
     }
     
     float OdeTrigger::GetMaxConfidence()
     {
         LOG_FUNC();
         
-        return m_maxConfidence;
+        return GetConfig()->m_maxConfidence;
     }
     
     void OdeTrigger::SetMaxConfidence(float maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_maxConfidence = maxConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_maxConfidence = maxConfidence;
+        PublishConfig(pConfig);
     }
     
     float OdeTrigger::GetMinTrackerConfidence()
     {
         LOG_FUNC();
         
-        return m_minTrackerConfidence;
+        return GetConfig()->m_minTrackerConfidence;
     }
     
     void OdeTrigger::SetMinTrackerConfidence(float minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minTrackerConfidence = minConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minTrackerConfidence = minConfidence;
+        PublishConfig(pConfig);
     }
     
     float OdeTrigger::GetMaxTrackerConfidence()
     {
         LOG_FUNC();
         
-        return m_maxTrackerConfidence;
+        return GetConfig()->m_maxTrackerConfidence;
     }
     
     void OdeTrigger::SetMaxTrackerConfidence(float maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_maxTrackerConfidence = maxConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_maxTrackerConfidence = maxConfidence;
+        PublishConfig(pConfig);
     }
     
     void OdeTrigger::GetMinDimensions(float* minWidth, float* minHeight)
     {
         LOG_FUNC();
         
-        *minWidth = m_minWidth;
-        *minHeight = m_minHeight;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minWidth = pConfig->m_minWidth;
+        *minHeight = pConfig->m_minHeight;
     }
 
     void OdeTrigger::SetMinDimensions(float minWidth, float minHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minWidth = minWidth;
-        m_minHeight = minHeight;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minWidth = minWidth;
+        pConfig->m_minHeight = minHeight;
+        PublishConfig(pConfig);
     }
     
     void OdeTrigger::GetMaxDimensions(float* maxWidth, float* maxHeight)
     {
         LOG_FUNC();
         
-        *maxWidth = m_maxWidth;
-        *maxHeight = m_maxHeight;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *maxWidth = pConfig->m_maxWidth;
+        *maxHeight = pConfig->m_maxHeight;
     }
 
     void OdeTrigger::SetMaxDimensions(float maxWidth, float maxHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_maxWidth = maxWidth;
-        m_maxHeight = maxHeight;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_maxWidth = maxWidth;
+        pConfig->m_maxHeight = maxHeight;
+        PublishConfig(pConfig);
     }
     
     bool OdeTrigger::GetInferDoneOnlySetting()
     {
         LOG_FUNC();
         
-        return m_inferDoneOnly;
+        return GetConfig()->m_inferDoneOnly;
     }
     
     void OdeTrigger::SetInferDoneOnlySetting(bool inferDoneOnly)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_inferDoneOnly = inferDoneOnly;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_inferDoneOnly = inferDoneOnly;
+        PublishConfig(pConfig);
     }
     
     void OdeTrigger::GetMinFrameCount(uint* minFrameCountN, uint* minFrameCountD)
     {
         LOG_FUNC();
         
-        *minFrameCountN = m_minFrameCountN;
-        *minFrameCountD = m_minFrameCountD;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minFrameCountN = pConfig->m_minFrameCountN;
+        *minFrameCountD = pConfig->m_minFrameCountD;
     }
 
     void OdeTrigger::SetMinFrameCount(uint minFrameCountN, uint minFrameCountD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minFrameCountN = minFrameCountN;
-        m_minFrameCountD = minFrameCountD;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minFrameCountN = minFrameCountN;
+        pConfig->m_minFrameCountD = minFrameCountD;
+        PublishConfig(pConfig);
     }
 
     uint OdeTrigger::GetInterval()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        return m_interval;
+        return GetConfig()->m_interval;
     }
     
     void OdeTrigger::SetInterval(uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        
-        m_interval = interval;
-        m_intervalCounter = 0;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+            
+            std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+            pConfig->m_interval = interval;
+            PublishConfig(pConfig);
+        }
+        // the interval counters are streaming state, not configuration
+        for (const auto &imap: *std::atomic_load(&m_pSourceStates))
+        {
+            imap.second->m_intervalCounter = 0;
+        }
     }
     
-    bool OdeTrigger::CheckForSourceId(int sourceId)
+    bool OdeTrigger::CheckForSourceId(const OdeTriggerConfig& config, 
+        int sourceId)
     {
         LOG_FUNC();
 
         // Filter on Source id if set
-        if (m_source.size())
+        if (config.m_source.size())
         {
             // a "one-time-get" of the source Id from the source name
             if (m_sourceId == -1)
             {
-                
-                Services::GetServices()->SourceUniqueIdGet(m_source.c_str(), 
-                    &m_sourceId);
+                int uniqueId(-1);
+                Services::GetServices()->SourceUniqueIdGet(
+                    config.m_source.c_str(), &uniqueId);
+                m_sourceId = uniqueId;
             }
             if (m_sourceId != sourceId)
             {
@@ -721,17 +973,21 @@ namespace DSL
         return true;
     }
 
-    bool OdeTrigger::CheckForInferId(int inferId)
+    bool OdeTrigger::CheckForInferId(const OdeTriggerConfig& config, 
+        int inferId)
     {
         LOG_FUNC();
 
         // Filter on Source id if set
-        if (m_infer.size())
+        if (config.m_infer.size())
         {
             // a "one-time-get" of the inference component Id from the name
             if (m_inferId == -1)
             {
-                Services::GetServices()->InferIdGet(m_infer.c_str(), &m_inferId);
+                int uniqueId(-1);
+                Services::GetServices()->InferIdGet(config.m_infer.c_str(), 
+                    &uniqueId);
+                m_inferId = uniqueId;
             }
             if (m_inferId != inferId)
             {
@@ -742,74 +998,83 @@ namespace DSL
     }
 
     void OdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+
         // Reset the occurrences from the last frame, even if disabled  
-        m_occurrences = 0;
+        pSourceState->m_occurrences = 0;
+        
+        // Re-bind the occurrence lists to the frame arena for this batch. 
+        // Memory from the last batch has already been reclaimed.
+        pSourceState->m_occurrenceMetaList = FrameArenaVector<NvDsObjectMeta*>();
+        pSourceState->m_occurrenceMetaListA = FrameArenaVector<NvDsObjectMeta*>();
+        pSourceState->m_occurrenceMetaListB = FrameArenaVector<NvDsObjectMeta*>();
 
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
+        if (!m_enabled or !CheckForSourceId(*pConfig, pFrameMeta->source_id))
         {
             return;
         }
 
         // Call on each of the Trigger's Areas to (optionally) display their Rectangle
-        for (const auto &imap: m_pOdeAreasIndexed)
+        for (const auto &pOdeArea: pConfig->m_odeAreas)
         {
-            DSL_ODE_AREA_PTR pOdeArea = 
-                std::dynamic_pointer_cast<OdeArea>(imap.second);
-            
             pOdeArea->AddMeta(displayMetaData, pFrameMeta);
         }
-        if (m_interval)
+        if (pConfig->m_interval)
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
-            if (m_intervalCounter != 0)
+            pSourceState->m_intervalCounter = 
+                (pSourceState->m_intervalCounter + 1) % pConfig->m_interval; 
+            if (pSourceState->m_intervalCounter != 0)
             {
-                m_skipFrame = true;
+                pSourceState->m_skipFrame = true;
                 return;
             }
         }
-        m_skipFrame = false;
+        pSourceState->m_skipFrame = false;
     }
 
     uint OdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // Lock free - client updates are published as a new config snapshot.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         // Filter on skip-frame interval
-        if (!m_enabled or m_skipFrame)
+        if (!m_enabled or pSourceState->m_skipFrame)
         {
             return 0;
         }
 
         // Don't start incrementing the frame-count until after the
         // first ODE occurrence. 
-        if (m_triggered)
-        {
-            m_frameCount++;
-        }
+        uint64_t frameCount = (m_triggered) ? ++m_frameCount : m_frameCount.load();
 
         // Check to see if frame limit is enabled and exceeded
-        if (m_frameLimit and (m_frameCount > m_frameLimit))
+        if (pConfig->m_frameLimit and (frameCount > pConfig->m_frameLimit))
         {
             return 0;
         }
 
         // Else, if frame limit is enabled and reached in this frame
-        if (m_frameLimit and (m_frameCount == m_frameLimit))
+        if (pConfig->m_frameLimit and (frameCount == pConfig->m_frameLimit))
         {
             // iterate through the map of limit-event-listeners calling each
-            for(auto const& imap: m_limitStateChangeListeners)
+            for(auto const& imap: pConfig->m_limitStateChangeListeners)
             {
                 try
                 {
                     imap.first(DSL_ODE_TRIGGER_LIMIT_FRAME_REACHED, 
-                        m_frameLimit, imap.second);
+                        pConfig->m_frameLimit, imap.second);
                 }
                 catch(...)
                 {
@@ -818,123 +1083,135 @@ namespace DSL
             }
             if (m_resetTimeout)
             {
-                m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                    TriggerResetTimeoutHandler, this);            
+                // Only taken once the limit has been reached.
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
+                if (!m_resetTimer)
+                {
+                    m_resetTimer.AddTimeout(NULL, 1000*m_resetTimeout, 
+                        TriggerResetTimeoutHandler, this);            
+                }
             }
         }
 
         // If the client has added an accumulator, 
-        if (m_pAccumulator)
+        if (pConfig->m_pAccumulator)
         {
-            m_occurrencesAccumulated += m_occurrences;
+            pSourceState->m_occurrencesAccumulated += pSourceState->m_occurrences;
             
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
                 DSL_FRAME_INFO_OCCURRENCES;
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
-                m_occurrencesAccumulated;
-                
-            DSL_ODE_ACCUMULATOR_PTR pOdeAccumulator = 
-                std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
+                GetOccurrencesAccumulated();
                 
-            pOdeAccumulator->HandleOccurrences(shared_from_this(),
+            pConfig->m_pAccumulator->HandleOccurrences(shared_from_this(),
                 pBuffer, displayMetaData, pFrameMeta);
         }
         
         // If the client has added a heat-mapper
-        if (m_pHeatMapper)
+        if (pConfig->m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+            pConfig->m_pHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
         }
         
-        return m_occurrences;
+        return pSourceState->m_occurrences;
     }        
     
-    bool OdeTrigger::CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
-        NvDsObjectMeta* pObjectMeta)
+    bool OdeTrigger::CheckForMinCriteria(const OdeTriggerConfig& config,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        return CheckForMinCriteria(config, config.m_classId, 
+            pFrameMeta, pObjectMeta);
+    }
+    
+    bool OdeTrigger::CheckForMinCriteria(const OdeTriggerConfig& config,
+        uint classId, NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Filter on enable and skip-frame interval
-        if (!m_enabled or m_skipFrame)
+        if (!m_enabled or OdeTriggerFrameView(this, 
+            pFrameMeta->source_id).GetSourceState()->m_skipFrame)
         {
             return false;
         }
         
         // Ensure that the event limit has not been exceeded
-        if (m_eventLimit and m_triggered >= m_eventLimit) 
+        if (config.m_eventLimit and m_triggered >= config.m_eventLimit) 
         {
             return false;
         }
         // Ensure that the frame limit has not been exceeded
-        if (m_frameLimit and m_frameCount >= m_frameLimit) 
+        if (config.m_frameLimit and m_frameCount >= config.m_frameLimit) 
         {
             return false;
         }
         // Filter on unique source-id and unique-inference-component-id
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForInferId(pObjectMeta->unique_component_id))
+        if (!CheckForSourceId(config, pFrameMeta->source_id) or 
+            !CheckForInferId(config, pObjectMeta->unique_component_id))
         {
             return false;
         }
         // Filter on Class id if set
-        if ((m_classId != DSL_ODE_ANY_CLASS) and 
-            (m_classId != pObjectMeta->class_id))
+        if ((classId != DSL_ODE_ANY_CLASS) and 
+            (classId != pObjectMeta->class_id))
         {
             return false;
         }
         // Ensure that the minimum Inference confidence has been reached
         if (pObjectMeta->confidence > 0 and 
-            pObjectMeta->confidence < m_minConfidence)
+            pObjectMeta->confidence < config.m_minConfidence)
         {
             return false;
         }
         // Ensure that the maximum Inference confidence has been reached
-        if (pObjectMeta->confidence > 0 and m_maxConfidence and
-            pObjectMeta->confidence > m_maxConfidence)
+        if (pObjectMeta->confidence > 0 and config.m_maxConfidence and
+            pObjectMeta->confidence > config.m_maxConfidence)
         {
             return false;
         }
         // Ensure that the minimum Tracker confidence has been reached
         if (pObjectMeta->tracker_confidence > 0 and 
-            pObjectMeta->tracker_confidence < m_minTrackerConfidence)
+            pObjectMeta->tracker_confidence < config.m_minTrackerConfidence)
         {
             return false;
         }
         // Ensure that the maximum Tracker confidence has been reached
-        if (pObjectMeta->tracker_confidence > 0 and m_maxTrackerConfidence and
-            pObjectMeta->tracker_confidence > m_maxTrackerConfidence)
+        if (pObjectMeta->tracker_confidence > 0 and config.m_maxTrackerConfidence and
+            pObjectMeta->tracker_confidence > config.m_maxTrackerConfidence)
         {
             return false;
         }
         // If defined, check for minimum dimensions
-        if ((m_minWidth > 0 and pObjectMeta->rect_params.width < m_minWidth) or
-            (m_minHeight > 0 and pObjectMeta->rect_params.height < m_minHeight))
+        if ((config.m_minWidth > 0 and 
+                pObjectMeta->rect_params.width < config.m_minWidth) or
+            (config.m_minHeight > 0 and 
+                pObjectMeta->rect_params.height < config.m_minHeight))
         {
             return false;
         }
         // If defined, check for maximum dimensions
-        if ((m_maxWidth > 0 and pObjectMeta->rect_params.width > m_maxWidth) or
-            (m_maxHeight > 0 and pObjectMeta->rect_params.height > m_maxHeight))
+        if ((config.m_maxWidth > 0 and 
+                pObjectMeta->rect_params.width > config.m_maxWidth) or
+            (config.m_maxHeight > 0 and 
+                pObjectMeta->rect_params.height > config.m_maxHeight))
         {
             return false;
         }
         // If define, check if Inference was done on the frame or not
-        if (m_inferDoneOnly and !pFrameMeta->bInferDone)
+        if (config.m_inferDoneOnly and !pFrameMeta->bInferDone)
         {
             return false;
         }
         return true;
     }
 
-    bool OdeTrigger::CheckForInside(NvDsObjectMeta* pObjectMeta)
+    bool OdeTrigger::CheckForInside(const OdeTriggerConfig& config,
+        NvDsObjectMeta* pObjectMeta)
     {
         // If areas are defined, check condition
 
-        if (m_pOdeAreasIndexed.size())
+        if (config.m_odeAreas.size())
         {
-            for (const auto &imap: m_pOdeAreasIndexed)
+            for (const auto &pOdeArea: config.m_odeAreas)
             {
-                DSL_ODE_AREA_PTR pOdeArea = 
-                    std::dynamic_pointer_cast<OdeArea>(imap.second);
                 if (pOdeArea->IsBboxInside(pObjectMeta->rect_params))
                 {
                     return pOdeArea->IsType(typeid(OdeInclusionArea));
@@ -964,57 +1241,61 @@ namespace DSL
     }
     
     void AlwaysOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        
+        if (!m_enabled or !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
             m_when != DSL_ODE_PRE_OCCURRENCE_CHECK)
         {
             return;
         }
-        if (m_interval)
+        if (pConfig->m_interval)
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
-            if (m_intervalCounter != 0)
+            pSourceState->m_intervalCounter = 
+                (pSourceState->m_intervalCounter + 1) % pConfig->m_interval; 
+            if (pSourceState->m_intervalCounter != 0)
             {
                 return;
             }
         }
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &pOdeAction: pConfig->m_odeActions)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
     }
 
     uint AlwaysOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
+        if (!m_enabled or !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
             m_when != DSL_ODE_POST_OCCURRENCE_CHECK)
         {
             return 0;
         }
-        if (m_interval)
+        if (pConfig->m_interval)
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
-            if (m_intervalCounter != 0)
+            pSourceState->m_intervalCounter = 
+                (pSourceState->m_intervalCounter + 1) % pConfig->m_interval; 
+            if (pSourceState->m_intervalCounter != 0)
             {
                 return 0;
             }
         }
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &pOdeAction: pConfig->m_odeActions)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
         return 1;
@@ -1035,46 +1316,46 @@ namespace DSL
     }
     
     bool OccurrenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        IncrementAndCheckTriggerCount();
-        m_occurrences++;
+        IncrementAndCheckTriggerCount(*pConfig);
+        pSourceState->m_occurrences++;
         
         // update the total event count static variable
-        s_eventCount++;
+        pSourceState->m_eventId = ++s_eventCount;
 
         // set the primary metric as the current occurrence for this frame
-        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
+        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+            pSourceState->m_occurrences;
 
 
-        if (m_pHeatMapper)
+        if (pConfig->m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+            pConfig->m_pHeatMapper->HandleOccurrence(
                 pFrameMeta, pObjectMeta);
         }
 
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &pOdeAction: pConfig->m_odeActions)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+            pOdeAction->InvokeOccurrence(shared_from_this(), pBuffer, 
                 displayMetaData, pFrameMeta, pObjectMeta);
             // try
             // {
-            //     pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+            //     pOdeAction->InvokeOccurrence(shared_from_this(), pBuffer, 
             //         displayMetaData, pFrameMeta, pObjectMeta);
             // }
             // catch(...)
@@ -1101,63 +1382,60 @@ namespace DSL
     }
     
     bool AbsenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         // Important **** we need to check for Criteria even if the Absence Trigger is disabled. 
         // This is case another Trigger enables This trigger, and it checks for the number of 
         // occurrences in the PostProcessFrame() . If the m_occurrences is not updated the Trigger 
         // will report Absence incorrectly
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrences++;
+        pSourceState->m_occurrences++;
 
         return true;
     }
     
     uint AbsenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData, NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        
+        if (!m_enabled or (pConfig->m_eventLimit and 
+            m_triggered >= pConfig->m_eventLimit) 
+            or pSourceState->m_occurrences) 
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or (m_eventLimit and m_triggered >= m_eventLimit) 
-                or m_occurrences) 
-            {
-                return 0;
-            }        
-            
-            // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
-            m_occurrences = 1;
-            
-            // event has been triggered 
-            IncrementAndCheckTriggerCount();
+            return 0;
+        }        
+        
+        // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
+        pSourceState->m_occurrences = 1;
+        
+        // event has been triggered 
+        IncrementAndCheckTriggerCount(*pConfig);
 
-            // update the total event count static variable
-            s_eventCount++;
+        // update the total event count static variable
+        pSourceState->m_eventId = ++s_eventCount;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        for (const auto &pOdeAction: pConfig->m_odeActions)
+        {
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutext unlocked - safe to call base class
+
         return OdeTrigger::PostProcessFrame(pBuffer, 
             displayMetaData, pFrameMeta);
     }
@@ -1167,8 +1445,6 @@ namespace DSL
     InstanceOdeTrigger::InstanceOdeTrigger(const char* name, 
         const char* source, uint classId, uint limit)
         : TrackingOdeTrigger(name, source, classId, limit, 0)
-        , m_instanceCount(1)
-        , m_suppressionCount(0)
     {
         LOG_FUNC();
     }
@@ -1183,43 +1459,36 @@ namespace DSL
     {
         LOG_FUNC();
         
-        *instanceCount = m_instanceCount;
-        *suppressionCount = m_suppressionCount;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *instanceCount = pConfig->m_instanceCount;
+        *suppressionCount = pConfig->m_suppressionCount;
     }
     
     void InstanceOdeTrigger::SetCountSettings(uint instanceCount, uint suppressionCount)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        m_instanceCount = instanceCount;
-        m_suppressionCount = suppressionCount;
-    }
-    
-    void InstanceOdeTrigger::Reset()
-    {
-        LOG_FUNC();
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_instances.clear();
-        }
-        // call the base class to complete the Reset
-        OdeTrigger::Reset();
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_instanceCount = instanceCount;
+        pConfig->m_suppressionCount = suppressionCount;
+        PublishConfig(pConfig);
     }
     
     bool InstanceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaBuilder& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
         
         if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
@@ -1227,16 +1496,16 @@ namespace DSL
         std::shared_ptr<TrackedObject> pTrackedObject;
         
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+        if (!pTrackedObjects->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id))
         {
             // Create a new Tracked object and return without occurence
-            pTrackedObject = m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+            pTrackedObject = pTrackedObjects->Track(pFrameMeta, 
                 pObjectMeta, nullptr);
         }
         else
         {
-            pTrackedObject = m_pTrackedObjectsPerSource->GetObject(
+            pTrackedObject = pTrackedObjects->GetObject(
                 pFrameMeta->source_id, pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
@@ -1248,64 +1517,59 @@ namespace DSL
             << pFrameMeta->source_id << " with frame-count = " 
             << pTrackedObject->frameCount);
 
-        if (pTrackedObject->frameCount <= m_instanceCount)
+        if (pTrackedObject->frameCount <= pConfig->m_instanceCount)
         {
             // event has been triggered
-            IncrementAndCheckTriggerCount();
-            m_occurrences++;
+            IncrementAndCheckTriggerCount(*pConfig);
+            pSourceState->m_occurrences++;
 
             // update the total event count static variable
-            s_eventCount++;
+            pSourceState->m_eventId = ++s_eventCount;
 
             // If the client has added a heat mapper, call to add the occurrence data
-            if (m_pHeatMapper)
+            if (pConfig->m_pHeatMapper)
             {
-                std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                pConfig->m_pHeatMapper->HandleOccurrence(
                     pFrameMeta, pObjectMeta);
             }
 
             // set the primary metric as the current occurrence for this frame
-            pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
+            pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                pSourceState->m_occurrences;
                 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &pOdeAction: pConfig->m_odeActions)
             {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
                     pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
             }
             return true;
         }
         // if suppressing and we've reached the total number of frames to supress 
-        if (m_suppressionCount and 
-            pTrackedObject->frameCount >= (m_instanceCount + m_suppressionCount))
+        if (pConfig->m_suppressionCount and pTrackedObject->frameCount >= 
+            (pConfig->m_instanceCount + pConfig->m_suppressionCount))
         {
             // delete the object so that the instance/suppression cycle can start again
             // of the object is detected in the next frame.
-            m_pTrackedObjectsPerSource->DeleteObject(pFrameMeta->source_id,
+            pTrackedObjects->DeleteObject(pFrameMeta->source_id,
                 pObjectMeta->object_id);
         }
         return false;
     }
 
     uint InstanceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
+        
+        if (!m_enabled or OdeTriggerFrameView(this, 
+            pFrameMeta->source_id).GetSourceState()->m_skipFrame or 
+            pTrackedObjects->IsEmpty())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
-            {
-                return 0;
-            }
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+            return 0;
         }
-        // mutext unlocked - safe to call base class
+        // purge all tracked objects, for all sources that are not in the current frame.
+        pTrackedObjects->Purge(pFrameMeta->frame_num);
+        
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -1326,58 +1590,56 @@ namespace DSL
     }
     
     bool SummationOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrences++;
+        pSourceState->m_occurrences++;
 
         return true;
     }
 
     uint SummationOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        
+        if (!m_enabled or pSourceState->m_skipFrame or (pConfig->m_eventLimit and 
+            m_triggered >= pConfig->m_eventLimit))
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or (m_eventLimit and m_triggered >= m_eventLimit))
-            {
-                return 0;
-            }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            return 0;
+        }
+        // event has been triggered
+        IncrementAndCheckTriggerCount(*pConfig);
 
-             // update the total event count static variable
-            s_eventCount++;
+         // update the total event count static variable
+        pSourceState->m_eventId = ++s_eventCount;
 
-            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
-                DSL_FRAME_INFO_OCCURRENCES;
-            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+            DSL_FRAME_INFO_OCCURRENCES;
+        pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
+            pSourceState->m_occurrences;
+        for (const auto &pOdeAction: pConfig->m_odeActions)
+        {
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutex unlocked safe to call base class
+
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -1401,19 +1663,20 @@ namespace DSL
     }
     
     bool CustomOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         // conditional execution
         if (!m_enabled or 
             !m_clientChecker or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
@@ -1431,72 +1694,63 @@ namespace DSL
             return false;
         }
 
-        IncrementAndCheckTriggerCount();
-        m_occurrences++;
+        IncrementAndCheckTriggerCount(*pConfig);
+        pSourceState->m_occurrences++;
         
         // update the total event count static variable
-        s_eventCount++;
+        pSourceState->m_eventId = ++s_eventCount;
 
-        if (m_pHeatMapper)
+        if (pConfig->m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+            pConfig->m_pHeatMapper->HandleOccurrence(
                 pFrameMeta, pObjectMeta);
         }
 
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &pOdeAction: pConfig->m_odeActions)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
                 pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
         }
         return true;
     }
     
     uint CustomOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        
+        // conditional execution
+        if (!m_enabled or m_clientPostProcessor == NULL)
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            // conditional execution
-            if (!m_enabled or m_clientPostProcessor == NULL)
-            {
-                return false;
-            }
-            try
-            {
-                if (!m_clientPostProcessor(pBuffer, pFrameMeta, m_clientData))
-                {
-                    return 0;
-                }
-            }
-            catch(...)
+            return false;
+        }
+        try
+        {
+            if (!m_clientPostProcessor(pBuffer, pFrameMeta, m_clientData))
             {
-                LOG_ERROR("Custon ODE Trigger '" << GetName() 
-                    << "' threw exception calling client callback");
-                return false;
+                return 0;
             }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Custon ODE Trigger '" << GetName() 
+                << "' threw exception calling client callback");
+            return false;
+        }
 
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+        // event has been triggered
+        IncrementAndCheckTriggerCount(*pConfig);
 
-             // update the total event count static variable
-            s_eventCount++;
+         // update the total event count static variable
+        frame.GetSourceState()->m_eventId = ++s_eventCount;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        for (const auto &pOdeAction: pConfig->m_odeActions)
+        {
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutex unlocked - safe to call base class
+
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -1506,10 +1760,10 @@ namespace DSL
     CountOdeTrigger::CountOdeTrigger(const char* name, const char* source,
         uint classId, uint limit, uint minimum, uint maximum)
         : OdeTrigger(name, source, classId, limit)
-        , m_minimum(minimum)
-        , m_maximum(maximum)
     {
         LOG_FUNC();
+        
+        SetRange(minimum, maximum);
     }
 
     CountOdeTrigger::~CountOdeTrigger()
@@ -1521,74 +1775,75 @@ namespace DSL
     {
         LOG_FUNC();
         
-        *minimum = m_minimum;
-        *maximum = m_maximum;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minimum = pConfig->m_minimum;
+        *maximum = pConfig->m_maximum;
     }
 
     void CountOdeTrigger::SetRange(uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minimum = minimum;
-        m_maximum = maximum;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minimum = minimum;
+        pConfig->m_maximum = maximum;
+        PublishConfig(pConfig);
     }
     
     bool CountOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrences++;
+        pSourceState->m_occurrences++;
         
-        if (m_pHeatMapper)
+        if (pConfig->m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+            pConfig->m_pHeatMapper->HandleOccurrence(
                 pFrameMeta, pObjectMeta);
         }
         return true;
     }
 
     uint CountOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        
+        if (!m_enabled or pSourceState->m_skipFrame or (pConfig->m_eventLimit and 
+            m_triggered >= pConfig->m_eventLimit) or
+            (pSourceState->m_occurrences < pConfig->m_minimum) or 
+            (pSourceState->m_occurrences > pConfig->m_maximum))
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or (m_eventLimit and m_triggered >= m_eventLimit) or
-                (m_occurrences < m_minimum) or (m_occurrences > m_maximum))
-            {
-                return 0;
-            }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            return 0;
+        }
+        // event has been triggered
+        IncrementAndCheckTriggerCount(*pConfig);
 
-             // update the total event count static variable
-            s_eventCount++;
+         // update the total event count static variable
+        pSourceState->m_eventId = ++s_eventCount;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        for (const auto &pOdeAction: pConfig->m_odeActions)
+        {
+            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutex unlocked - safe to call base class
+
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -1608,82 +1863,81 @@ namespace DSL
     }
     
     bool SmallestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaList = 
+            pSourceState->m_occurrenceMetaList;
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrenceMetaList.push_back(pObjectMeta);
+        occurrenceMetaList.push_back(pObjectMeta);
         
         return true;
     }
 
     uint SmallestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaList = 
+            pSourceState->m_occurrenceMetaList;
+        
+        pSourceState->m_occurrences = 0;
+        
+        // need at least one object for a Minimum event
+        if (m_enabled and occurrenceMetaList.size())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
+            // One occurrence to return and increment the accumulative Trigger count
+            pSourceState->m_occurrences = 1;
+            IncrementAndCheckTriggerCount(*pConfig);
+            // update the total event count static variable
+            pSourceState->m_eventId = ++s_eventCount;
+
+            uint smallestArea = UINT32_MAX;
+            NvDsObjectMeta* pSmallestObject(NULL);
             
-            // need at least one object for a Minimum event
-            if (m_enabled and m_occurrenceMetaList.size())
+            // iterate through the list of object occurrences that passed all min criteria
+            for (const auto &ivec: occurrenceMetaList) 
             {
-                // One occurrence to return and increment the accumulative Trigger count
-                m_occurrences = 1;
-                IncrementAndCheckTriggerCount();
-                // update the total event count static variable
-                s_eventCount++;
-
-                uint smallestArea = UINT32_MAX;
-                NvDsObjectMeta* pSmallestObject(NULL);
-                
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &ivec: m_occurrenceMetaList) 
-                {
-                    uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
-                    if (rectArea < smallestArea) 
-                    { 
-                        smallestArea = rectArea;
-                        pSmallestObject = ivec;    
-                    }
-                }
-                // conditionally add the 
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pSmallestObject);
-                }
-                // set the primary metric as the smallest bounding box by area
-                pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                    = smallestArea;
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
+                uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
+                if (rectArea < smallestArea) 
+                { 
+                    smallestArea = rectArea;
+                    pSmallestObject = ivec;    
                 }
-            }   
+            }
+            // conditionally add the 
+            if (pConfig->m_pHeatMapper)
+            {
+                pConfig->m_pHeatMapper->HandleOccurrence(
+                    pFrameMeta, pSmallestObject);
+            }
+            // set the primary metric as the smallest bounding box by area
+            pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                = smallestArea;
+            for (const auto &pOdeAction: pConfig->m_odeActions)
+            {
+                
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
+            }
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaList.clear();
-        }
-        // mutex unlocked - safe to call base class
+        // reset for next frame
+        occurrenceMetaList.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -1703,85 +1957,84 @@ namespace DSL
     }
     
     bool LargestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaList = 
+            pSourceState->m_occurrenceMetaList;
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrenceMetaList.push_back(pObjectMeta);
+        occurrenceMetaList.push_back(pObjectMeta);
         
         return true;
     }
 
     uint LargestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaList = 
+            pSourceState->m_occurrenceMetaList;
+        
+        pSourceState->m_occurrences = 0;
+        
+        // need at least one object for a Minimum event
+        if (m_enabled and occurrenceMetaList.size())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
+            // Once occurrence to return and increment the accumulative Trigger count
+            pSourceState->m_occurrences = 1;
+            IncrementAndCheckTriggerCount(*pConfig);
+            // update the total event count static variable
+            pSourceState->m_eventId = ++s_eventCount;
+
+            uint largestArea = 0;
+            NvDsObjectMeta* pLargestObject(NULL);
             
-            // need at least one object for a Minimum event
-            if (m_enabled and m_occurrenceMetaList.size())
+            // iterate through the list of object occurrences that passed all min criteria
+            for (const auto &ivec: occurrenceMetaList) 
             {
-                // Once occurrence to return and increment the accumulative Trigger count
-                m_occurrences = 1;
-                IncrementAndCheckTriggerCount();
-                // update the total event count static variable
-                s_eventCount++;
-
-                uint largestArea = 0;
-                NvDsObjectMeta* pLargestObject(NULL);
-                
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &ivec: m_occurrenceMetaList) 
-                {
-                    uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
-                    if (rectArea > largestArea) 
-                    { 
-                        largestArea = rectArea;
-                        pLargestObject = ivec;    
-                    }
+                uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
+                if (rectArea > largestArea) 
+                { 
+                    largestArea = rectArea;
+                    pLargestObject = ivec;    
                 }
+            }
 
-                // If the client has added a heat mapper, call to add-occurrence
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pLargestObject);
-                }
-                
-                // set the primary metric as the larget area
-                pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                    = largestArea;
+            // If the client has added a heat mapper, call to add-occurrence
+            if (pConfig->m_pHeatMapper)
+            {
+                pConfig->m_pHeatMapper->HandleOccurrence(
+                    pFrameMeta, pLargestObject);
+            }
+            
+            // set the primary metric as the larget area
+            pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                = largestArea;
+            
+            for (const auto &pOdeAction: pConfig->m_odeActions)
+            {
                 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, pLargestObject);
-                }
-            }   
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, pLargestObject);
+            }
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaList.clear();
-        }
-        // mutex unlocked  - safe to call base class
+        // reset for next frame
+        occurrenceMetaList.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -1806,84 +2059,78 @@ namespace DSL
     void NewLowOdeTrigger::Reset()
     {
         LOG_FUNC();
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_currentLow = m_preset;
-        }        
+        
+        m_currentLow = m_preset;
+        
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
     
     bool NewLowOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrences++;
+        pSourceState->m_occurrences++;
         
         return true;
     }
 
     uint NewLowOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        
+        if (!m_enabled or pSourceState->m_skipFrame)
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame)
-            {
-                return 0;
-            }
+            return 0;
+        }
+        
+        if (pSourceState->m_occurrences < m_currentLow)
+        {
+            // new low
+            m_currentLow = pSourceState->m_occurrences;
             
-            if (m_occurrences < m_currentLow)
-            {
-                // new low
-                m_currentLow = m_occurrences;
-                
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
+            // event has been triggered
+            IncrementAndCheckTriggerCount(*pConfig);
 
-                 // update the total event count static variable
-                s_eventCount++;
+             // update the total event count static variable
+            pSourceState->m_eventId = ++s_eventCount;
 
-                // Add the New High occurrences to the frame info
-                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
-                    DSL_FRAME_INFO_OCCURRENCES;
-                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
-                    m_occurrences;
+            // Add the New High occurrences to the frame info
+            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+                DSL_FRAME_INFO_OCCURRENCES;
+            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
+                pSourceState->m_occurrences;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, NULL);
-                }
-                // new high m_occurrences means ODE occurrence = 1
-                m_occurrences = 1;
-            }
-            else
+            for (const auto &pOdeAction: pConfig->m_odeActions)
             {
-                m_occurrences = 0;
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, NULL);
             }
+            // new high m_occurrences means ODE occurrence = 1
+            pSourceState->m_occurrences = 1;
+        }
+        else
+        {
+            pSourceState->m_occurrences = 0;
         }
-        // mutex unlocked - safe to call base class
+
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -1908,85 +2155,78 @@ namespace DSL
     void NewHighOdeTrigger::Reset()
     {
         LOG_FUNC();
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_currentHigh = m_preset;
-            m_occurrencesNewHighAccumulated = 0;
-        }        
+        
+        m_currentHigh = m_preset;
+        
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
     
     bool NewHighOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
         
         if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrences++;
+        pSourceState->m_occurrences++;
         
         return true;
     }
 
     uint NewHighOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        
+        if (!m_enabled or pSourceState->m_skipFrame)
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame)
-            {
-                return 0;
-            }
+            return 0;
+        }
+        
+        if (pSourceState->m_occurrences > m_currentHigh)
+        {
+            // new high
+            m_currentHigh = pSourceState->m_occurrences;
             
-            if (m_occurrences > m_currentHigh)
-            {
-                // new high
-                m_currentHigh = m_occurrences;
-                
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
+            // event has been triggered
+            IncrementAndCheckTriggerCount(*pConfig);
 
-                 // update the total event count static variable
-                s_eventCount++;
+             // update the total event count static variable
+            pSourceState->m_eventId = ++s_eventCount;
 
-                // Add the New High occurrences to the frame info
-                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
-                    DSL_FRAME_INFO_OCCURRENCES;
-                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
-                    m_occurrences;
+            // Add the New High occurrences to the frame info
+            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+                DSL_FRAME_INFO_OCCURRENCES;
+            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
+                pSourceState->m_occurrences;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, NULL);
-                }
-                // new high m_occurrences means ODE occurrence = 1
-                m_occurrences = 1;
-            }
-            else
+            for (const auto &pOdeAction: pConfig->m_odeActions)
             {
-                m_occurrences = 0;
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, NULL);
             }
+            // new high m_occurrences means ODE occurrence = 1
+            pSourceState->m_occurrences = 1;
+        }
+        else
+        {
+            pSourceState->m_occurrences = 0;
         }
-        // mutex unlocked - safe to call base class
+
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -2001,9 +2241,16 @@ namespace DSL
     {
         LOG_FUNC();
         
-        m_pTrackedObjectsPerSource = std::shared_ptr<TrackedObjects>(
-            new TrackedObjects(maxTracePoints, 
-                DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX));
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+            
+            std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+            pConfig->m_maxTracePoints = maxTracePoints;
+            PublishConfig(pConfig);
+        }
+        std::atomic_store(&m_pTrackedObjectsPerSource, 
+            std::shared_ptr<TrackedObjects>(new TrackedObjects(maxTracePoints, 
+                DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX)));
     }
 
     TrackingOdeTrigger::~TrackingOdeTrigger()
@@ -2014,11 +2261,14 @@ namespace DSL
     void TrackingOdeTrigger::Reset()
     {
         LOG_FUNC();
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_pTrackedObjectsPerSource->Clear();
-        }        
+        
+        // Replace rather than clear - the streaming thread may be holding the
+        // current set for the frame in progress.
+        std::atomic_store(&m_pTrackedObjectsPerSource, 
+            std::shared_ptr<TrackedObjects>(new TrackedObjects(
+                GetConfig()->m_maxTracePoints, 
+                DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX)));
+
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
@@ -2029,18 +2279,18 @@ namespace DSL
         uint classId, uint limit, uint minFrameCount, uint maxTracePoints, 
         uint testMethod, DSL_RGBA_COLOR_PTR pColor)
         : TrackingOdeTrigger(name, source, classId, limit, maxTracePoints)
-        , m_maxTracePoints(maxTracePoints)
-        , m_occurrencesIn(0)
-        , m_occurrencesOut(0)
         , m_occurrencesInAccumulated(0)
         , m_occurrencesOutAccumulated(0)
-        , m_minFrameCount(minFrameCount)
-        , m_traceEnabled(false)
-        , m_testMethod(testMethod)
-        , m_pTraceColor(pColor)
-        , m_traceLineWidth(0)
     {
         LOG_FUNC();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minCrossFrameCount = minFrameCount;
+        pConfig->m_testMethod = testMethod;
+        pConfig->m_pTraceColor = pColor;
+        PublishConfig(pConfig);
     }
 
     CrossOdeTrigger::~CrossOdeTrigger()
@@ -2049,14 +2299,16 @@ namespace DSL
     }
 
     bool CrossOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
         
-        if (!m_pOdeAreasIndexed.size())
+        if (!pConfig->m_odeAreas.size())
         {
             LOG_ERROR("At least one OdeArea is required for CrossOdeTrigger '" 
                 << GetName() << "'");
@@ -2064,40 +2316,37 @@ namespace DSL
         }
 
         // Check for minimum criteria - but not for within an Area. 
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta))
         {
             return false;
         }
 
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+        if (!pTrackedObjects->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id))
         {
             // Create a new Tracked object and return without occurence
-            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
-                pObjectMeta, m_pTraceColor);
+            pTrackedObjects->Track(pFrameMeta, 
+                pObjectMeta, pConfig->m_pTraceColor);
 
             // Update the color for the next tracked object to be created.
-            m_pTraceColor->SetNext();
+            pConfig->m_pTraceColor->SetNext();
             
             return false;
         }
 
         // Else, get the tracked object and update with current frame meta
         std::shared_ptr<TrackedObject> pTrackedObject = 
-            m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+            pTrackedObjects->GetObject(pFrameMeta->source_id,
                 pObjectMeta->object_id);
                 
         pTrackedObject->Update(pFrameMeta->frame_num, 
             (NvBbox_Coords*)&pObjectMeta->rect_params);
             
         // Iterate through the map of 1 or more Areas to test for line cross
-        for (const auto &imap: m_pOdeAreasIndexed)
+        for (const auto &pOdeArea: pConfig->m_odeAreas)
         {
-            DSL_ODE_AREA_PTR pOdeArea = 
-                std::dynamic_pointer_cast<OdeArea>(imap.second);
-                
             uint testPoint = pOdeArea->GetBboxTestPoint();
                 
             // get the first and last test-points to see if minimum requirments
@@ -2112,29 +2361,31 @@ namespace DSL
             // objects on the line with less than the minimim frame count
             if (pOdeArea->IsPointOnLine(firstCoordinate) or
                 (pOdeArea->IsPointOnLine(lastCoordinate) and
-                    pTrackedObject->preEventFrameCount < m_minFrameCount))
+                    pTrackedObject->preEventFrameCount < 
+                        pConfig->m_minCrossFrameCount))
             {
                 LOG_DEBUG("Online without sufficient pre-count " 
                     <<  pTrackedObject->preEventFrameCount << " - purging");
                     
-                m_pTrackedObjectsPerSource->DeleteObject(pFrameMeta->source_id,
+                pTrackedObjects->DeleteObject(pFrameMeta->source_id,
                     pObjectMeta->object_id);
                 return false;
             }
             
             // Get the trace vector for the testpoint defined for this Area
             DSL_RGBA_MULTI_LINE_PTR pTrace = 
-                pTrackedObject->GetTrace(testPoint, m_testMethod, m_traceLineWidth);
+                pTrackedObject->GetTrace(testPoint, pConfig->m_testMethod, 
+                    pConfig->m_traceLineWidth);
 
             // If the client has enabled object tracing
-            if (m_traceEnabled)
+            if (pConfig->m_traceEnabled)
             {
                 // If the object has a previous trace from a line cross event.
                 if (pTrackedObject->HasPreviousTrace())
                 {
                     DSL_RGBA_MULTI_LINE_PTR pPreviousTrace = 
-                        pTrackedObject->GetPreviousTrace(testPoint, m_testMethod, 
-                            m_traceLineWidth);
+                        pTrackedObject->GetPreviousTrace(testPoint, 
+                            pConfig->m_testMethod, pConfig->m_traceLineWidth);
 
                     // Add the multi-line metadata to the Frame's display-meta for 
                     // the previous trace
@@ -2154,40 +2405,42 @@ namespace DSL
                 pTrace->num_coordinates, direction))
             {
                 // If we've crosed before reaching the minimum frame count
-                if (pTrackedObject->preEventFrameCount < m_minFrameCount)
+                if (pTrackedObject->preEventFrameCount < 
+                    pConfig->m_minCrossFrameCount)
                 {
                     LOG_DEBUG("Crossed line without sufficient pre-count - purging");
                     
                     // delete the object - will be retracked in the next frame.
-                    m_pTrackedObjectsPerSource->DeleteObject(pFrameMeta->source_id,
+                    pTrackedObjects->DeleteObject(pFrameMeta->source_id,
                         pObjectMeta->object_id);
                     return false;
                 }
-                if (++pTrackedObject->onEventFrameCount < m_minFrameCount)
+                if (++pTrackedObject->onEventFrameCount < 
+                    pConfig->m_minCrossFrameCount)
                 {
                     return false;
                 }
                 
                 // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
+                IncrementAndCheckTriggerCount(*pConfig);
+                pSourceState->m_occurrences++;
                 
                 if (direction == DSL_AREA_CROSS_DIRECTION_IN)
                 {
-                    m_occurrencesIn++;
+                    pSourceState->m_occurrencesIn++;
                 }
                 else
                 {
-                    m_occurrencesOut++;
+                    pSourceState->m_occurrencesOut++;
                 }
 
                 // update the total event count static variable
-                s_eventCount++;
+                pSourceState->m_eventId = ++s_eventCount;
 
                 // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                if (pConfig->m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                    pConfig->m_pHeatMapper->HandleOccurrence(
                         pFrameMeta, pObjectMeta);
                 }
 
@@ -2200,11 +2453,9 @@ namespace DSL
                 pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
                     (uint64_t)(pTrackedObject->GetDurationMs());
                     
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: pConfig->m_odeActions)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
 
@@ -2220,31 +2471,39 @@ namespace DSL
     }
 
     uint CrossOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
 
         // Filter on skip-frame interval
-        if (!m_enabled or m_skipFrame)
+        if (!m_enabled or pSourceState->m_skipFrame)
         {
             return 0;
         }
 
+        // A new max-trace-point setting is applied here, on the streaming 
+        // thread, as the tracked objects are never updated by the client.
+        if (pTrackedObjects->GetMaxHistory() != pConfig->m_maxTracePoints)
+        {
+            pTrackedObjects->SetMaxHistory(pConfig->m_maxTracePoints);
+        }
+
         // If the client has added a heat-mapper, need to AddDisplayMeta here as
         // the base/super class PostProcessFrame is not called .
-        if (m_pHeatMapper)
+        if (pConfig->m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+            pConfig->m_pHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
         }
 
         // If the client has added an accumulator, 
-        if (m_pAccumulator)
+        if (pConfig->m_pAccumulator)
         {
-            m_occurrencesInAccumulated += m_occurrencesIn;
-            m_occurrencesOutAccumulated += m_occurrencesOut;
+            m_occurrencesInAccumulated += pSourceState->m_occurrencesIn;
+            m_occurrencesOutAccumulated += pSourceState->m_occurrencesOut;
             
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
                 DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN;
@@ -2257,20 +2516,17 @@ namespace DSL
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] = 
                 m_occurrencesOutAccumulated;
                 
-            DSL_ODE_ACCUMULATOR_PTR pOdeAccumulator = 
-                std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
-                
-            pOdeAccumulator->HandleOccurrences(shared_from_this(),
+            pConfig->m_pAccumulator->HandleOccurrences(shared_from_this(),
                 pBuffer, displayMetaData, pFrameMeta);
         }
         // clear the occurrence counters 
-        m_occurrencesIn = 0;
-        m_occurrencesOut = 0;
+        pSourceState->m_occurrencesIn = 0;
+        pSourceState->m_occurrencesOut = 0;
 
         // purge all tracked objects, for all sources that are not in the current frame.
-        m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+        pTrackedObjects->Purge(pFrameMeta->frame_num);
         
-        return m_occurrences;
+        return pSourceState->m_occurrences;
     }
 
     void CrossOdeTrigger::GetTestSettings(uint* minFrameCount, 
@@ -2278,21 +2534,23 @@ namespace DSL
     {
         LOG_FUNC();
 
-        *minFrameCount = m_minFrameCount;
-        *maxTracePoints = m_maxTracePoints;
-        *testMethod = m_testMethod;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minFrameCount = pConfig->m_minCrossFrameCount;
+        *maxTracePoints = pConfig->m_maxTracePoints;
+        *testMethod = pConfig->m_testMethod;
     }
     
     void CrossOdeTrigger::SetTestSettings(uint minFrameCount,
         uint maxTracePoints, uint testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        m_minFrameCount = minFrameCount;
-        m_maxTracePoints = maxTracePoints;
-        m_testMethod = testMethod;
-        m_pTrackedObjectsPerSource->SetMaxHistory(m_maxTracePoints);
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minCrossFrameCount = minFrameCount;
+        pConfig->m_maxTracePoints = maxTracePoints;
+        pConfig->m_testMethod = testMethod;
+        PublishConfig(pConfig);
     }
     
     void CrossOdeTrigger::GetViewSettings(bool* enabled, 
@@ -2300,33 +2558,32 @@ namespace DSL
     {
         LOG_FUNC();
 
-        *enabled = m_traceEnabled;
-        *color = m_pTraceColor->GetName().c_str();
-        *lineWidth = m_traceLineWidth;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *enabled = pConfig->m_traceEnabled;
+        *color = pConfig->m_pTraceColor->GetName().c_str();
+        *lineWidth = pConfig->m_traceLineWidth;
     }
     
     void CrossOdeTrigger::SetViewSettings(bool enabled, 
         DSL_RGBA_COLOR_PTR pColor, uint lineWidth)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_traceEnabled = enabled;
-        m_pTraceColor = pColor;
-        m_traceLineWidth = lineWidth;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_traceEnabled = enabled;
+        pConfig->m_pTraceColor = pColor;
+        pConfig->m_traceLineWidth = lineWidth;
+        PublishConfig(pConfig);
     }        
 
     void CrossOdeTrigger::Reset()
     {
         LOG_FUNC();
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrencesIn = 0;
-            m_occurrencesOut = 0;
-            m_occurrencesInAccumulated = 0;
-            m_occurrencesOutAccumulated = 0;
-        }        
+        
+        m_occurrencesInAccumulated = 0;
+        m_occurrencesOutAccumulated = 0;
+        
         // call the base class to complete the Reset
         TrackingOdeTrigger::Reset();
     }
@@ -2337,10 +2594,10 @@ namespace DSL
         const char* source, uint classId, uint limit, uint minimum, 
         uint maximum)
         : TrackingOdeTrigger(name, source, classId, limit, 0)
-        , m_minimumMs(minimum*1000.0)
-        , m_maximumMs(maximum*1000.0)
     {
         LOG_FUNC();
+        
+        SetRange(minimum, maximum);
     }
 
     PersistenceOdeTrigger::~PersistenceOdeTrigger()
@@ -2352,46 +2609,51 @@ namespace DSL
     {
         LOG_FUNC();
         
-        *minimum = m_minimumMs/1000;
-        *maximum = m_maximumMs/1000;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minimum = pConfig->m_minimum;
+        *maximum = pConfig->m_maximum;
     }
 
     void PersistenceOdeTrigger::SetRange(uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minimumMs = minimum*1000.0;
-        m_maximumMs = maximum*1000.0;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minimum = minimum;
+        pConfig->m_maximum = maximum;
+        PublishConfig(pConfig);
     }
     
     bool PersistenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
 
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+        if (!pTrackedObjects->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id))
         {
             // Create a new Tracked object and return without occurence
-            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+            pTrackedObjects->Track(pFrameMeta, 
                 pObjectMeta, nullptr);
         }
         else
         {
             std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                pTrackedObjects->GetObject(pFrameMeta->source_id,
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
@@ -2404,19 +2666,20 @@ namespace DSL
                 << pFrameMeta->source_id << ", = " << trackedTimeMs << " ms");
             
             // if the object's tracked time is within range. 
-            if (trackedTimeMs >= m_minimumMs and trackedTimeMs <= m_maximumMs)
+            if (trackedTimeMs >= pConfig->m_minimum*1000.0 and 
+                trackedTimeMs <= pConfig->m_maximum*1000.0)
             {
                 // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
+                IncrementAndCheckTriggerCount(*pConfig);
+                pSourceState->m_occurrences++;
 
                 // update the total event count static variable
-                s_eventCount++;
+                pSourceState->m_eventId = ++s_eventCount;
     
                 // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                if (pConfig->m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                    pConfig->m_pHeatMapper->HandleOccurrence(
                         pFrameMeta, pObjectMeta);
                 }
 
@@ -2426,11 +2689,9 @@ namespace DSL
                 pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
                     (uint64_t)(trackedTimeMs/1000);
                     
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: pConfig->m_odeActions)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(shared_from_this(), 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
             }
@@ -2439,23 +2700,19 @@ namespace DSL
     }
 
     uint PersistenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
+        
+        if (!m_enabled or OdeTriggerFrameView(this, 
+            pFrameMeta->source_id).GetSourceState()->m_skipFrame or 
+            pTrackedObjects->IsEmpty())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
-            {
-                return 0;
-            }
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+            return 0;
         }
-        // mutext unlocked - safe to call base class
+        // purge all tracked objects, for all sources that are not in the current frame.
+        pTrackedObjects->Purge(pFrameMeta->frame_num);
+        
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -2465,8 +2722,6 @@ namespace DSL
     LatestOdeTrigger::LatestOdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
         : TrackingOdeTrigger(name, source, classId, limit, 0)
-        , m_pLatestObjectMeta(NULL)
-        , m_latestTrackedTimeMs(0)
     {
         LOG_FUNC();
     }
@@ -2477,31 +2732,34 @@ namespace DSL
     }
 
     bool LatestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
 
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+        if (!pTrackedObjects->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id))
         {
             // Create a new Tracked object and return without occurence
-            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+            pTrackedObjects->Track(pFrameMeta, 
                 pObjectMeta, nullptr);
         }
         else
         {
             std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                pTrackedObjects->GetObject(pFrameMeta->source_id,
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
@@ -2509,69 +2767,66 @@ namespace DSL
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
             
-            if ((m_pLatestObjectMeta == NULL) or (trackedTimeMs < m_latestTrackedTimeMs))
+            if ((pSourceState->m_pSelectedObjectMeta == NULL) or (trackedTimeMs < pSourceState->m_selectedTrackedTimeMs))
             {
-                m_pLatestObjectMeta = pObjectMeta;
-                m_latestTrackedTimeMs = trackedTimeMs;
+                pSourceState->m_pSelectedObjectMeta = pObjectMeta;
+                pSourceState->m_selectedTrackedTimeMs = trackedTimeMs;
             }
         }
         return true;
     }
     
     uint LatestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
+        
+        if (!m_enabled or pSourceState->m_skipFrame or 
+            pTrackedObjects->IsEmpty())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
+            return 0;
+        }
+        
+        // If we a Latest Object ODE 
+        if (pSourceState->m_pSelectedObjectMeta != NULL)
+        {
+            // event has been triggered
+            IncrementAndCheckTriggerCount(*pConfig);
+            pSourceState->m_occurrences++;
+
+            // update the total event count static variable
+            pSourceState->m_eventId = ++s_eventCount;
+
+            // If the client has added a heat mapper, call to add the occurrence data
+            if (pConfig->m_pHeatMapper)
             {
-                return 0;
+                pConfig->m_pHeatMapper->HandleOccurrence(
+                    pFrameMeta, pSourceState->m_pSelectedObjectMeta);
             }
             
-            // If we a Latest Object ODE 
-            if (m_pLatestObjectMeta != NULL)
-            {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
-
-                // update the total event count static variable
-                s_eventCount++;
-
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pLatestObjectMeta);
-                }
-                
-                // add the persistence value to the array of misc_obj_info
-                // as both the Primary and Persistence specific indecies.
-                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
-                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
-                    (uint64_t)(m_latestTrackedTimeMs/1000);
+            // add the persistence value to the array of misc_obj_info
+            // as both the Primary and Persistence specific indecies.
+            pSourceState->m_pSelectedObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
+            pSourceState->m_pSelectedObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                (uint64_t)(pSourceState->m_selectedTrackedTimeMs/1000);
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, m_pLatestObjectMeta);
-                }
-            
-                // clear the Newest Object data for the next frame 
-                m_pLatestObjectMeta = NULL;
-                m_latestTrackedTimeMs = 0;
+            for (const auto &pOdeAction: pConfig->m_odeActions)
+            {
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, pSourceState->m_pSelectedObjectMeta);
             }
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+        
+            // clear the Newest Object data for the next frame 
+            pSourceState->m_pSelectedObjectMeta = NULL;
+            pSourceState->m_selectedTrackedTimeMs = 0;
         }
-        // mutex unlocked - safe to call base class
+        // purge all tracked objects, for all sources that are not in the current frame.
+        pTrackedObjects->Purge(pFrameMeta->frame_num);
+        
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -2581,8 +2836,6 @@ namespace DSL
     EarliestOdeTrigger::EarliestOdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
         : TrackingOdeTrigger(name, source, classId, limit, 0)
-        , m_pEarliestObjectMeta(NULL)
-        , m_earliestTrackedTimeMs(0)
     {
         LOG_FUNC();
     }
@@ -2593,32 +2846,34 @@ namespace DSL
     }
 
     bool EarliestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForSourceId(*pConfig, pFrameMeta->source_id) or 
+            !CheckForMinCriteria(*pConfig, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(*pConfig, pObjectMeta))
         {
             return false;
         }
 
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+        if (!pTrackedObjects->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id)) 
         {
             // Create a new Tracked object and return without occurence
-            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+            pTrackedObjects->Track(pFrameMeta, 
                 pObjectMeta, nullptr);
         }
         else
         {
             std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                pTrackedObjects->GetObject(pFrameMeta->source_id,
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
@@ -2626,11 +2881,11 @@ namespace DSL
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
                 
-            if ((m_pEarliestObjectMeta == NULL) or 
-                (trackedTimeMs > m_earliestTrackedTimeMs))
+            if ((pSourceState->m_pSelectedObjectMeta == NULL) or 
+                (trackedTimeMs > pSourceState->m_selectedTrackedTimeMs))
             {
-                m_pEarliestObjectMeta = pObjectMeta;
-                m_earliestTrackedTimeMs = trackedTimeMs;
+                pSourceState->m_pSelectedObjectMeta = pObjectMeta;
+                pSourceState->m_selectedTrackedTimeMs = trackedTimeMs;
                 
             }
         }
@@ -2638,59 +2893,56 @@ namespace DSL
     }
     
     uint EarliestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        std::shared_ptr<TrackedObjects> pTrackedObjects = GetTrackedObjects();
+        
+        if (!m_enabled or pSourceState->m_skipFrame or 
+            pTrackedObjects->IsEmpty())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
-            {
-                return 0;
-            }
-            
-            if (m_pEarliestObjectMeta != NULL)
-            {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
+            return 0;
+        }
+        
+        if (pSourceState->m_pSelectedObjectMeta != NULL)
+        {
+            // event has been triggered
+            IncrementAndCheckTriggerCount(*pConfig);
+            pSourceState->m_occurrences++;
 
-                // update the total event count static variable
-                s_eventCount++;
+            // update the total event count static variable
+            pSourceState->m_eventId = ++s_eventCount;
 
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pEarliestObjectMeta);
-                }
+            // If the client has added a heat mapper, call to add the occurrence data
+            if (pConfig->m_pHeatMapper)
+            {
+                pConfig->m_pHeatMapper->HandleOccurrence(
+                    pFrameMeta, pSourceState->m_pSelectedObjectMeta);
+            }
 
-                // add the persistence value to the array of misc_obj_info
-                // as both the Primary and Persistence specific indecies.
-                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
-                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
-                    (uint64_t)(m_earliestTrackedTimeMs/1000);
+            // add the persistence value to the array of misc_obj_info
+            // as both the Primary and Persistence specific indecies.
+            pSourceState->m_pSelectedObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
+            pSourceState->m_pSelectedObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                (uint64_t)(pSourceState->m_selectedTrackedTimeMs/1000);
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, m_pEarliestObjectMeta);
-                }
-            
-                // clear the Earliest Object data for the next frame 
-                m_pEarliestObjectMeta = NULL;
-                m_earliestTrackedTimeMs = 0;
+            for (const auto &pOdeAction: pConfig->m_odeActions)
+            {
+                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, pSourceState->m_pSelectedObjectMeta);
             }
-            
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+        
+            // clear the Earliest Object data for the next frame 
+            pSourceState->m_pSelectedObjectMeta = NULL;
+            pSourceState->m_selectedTrackedTimeMs = 0;
         }
-        // mutex unlocked - safe to call base class
+        
+        // purge all tracked objects, for all sources that are not in the current frame.
+        pTrackedObjects->Purge(pFrameMeta->frame_num);
+        
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -2702,12 +2954,10 @@ namespace DSL
     ABOdeTrigger::ABOdeTrigger(const char* name, 
         const char* source, uint classIdA, uint classIdB, uint limit)
         : OdeTrigger(name, source, classIdA, limit)
-        , m_classIdA(classIdA)
-        , m_classIdB(classIdB)
     {
         LOG_FUNC();
         
-        m_classIdAOnly = (m_classIdA == m_classIdB);
+        SetClassIdAB(classIdA, classIdB);
     }
 
     ABOdeTrigger::~ABOdeTrigger()
@@ -2719,49 +2969,55 @@ namespace DSL
     {
         LOG_FUNC();
         
-        *classIdA = m_classIdA;
-        *classIdB = m_classIdB;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *classIdA = pConfig->m_classIdA;
+        *classIdB = pConfig->m_classIdB;
     }
     
     void ABOdeTrigger::SetClassIdAB(uint classIdA, uint classIdB)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_classIdA = classIdA;
-        m_classIdB = classIdB;
-        m_classIdAOnly = (m_classIdA == m_classIdB);
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_classIdA = classIdA;
+        pConfig->m_classIdB = classIdB;
+        pConfig->m_classIdAOnly = (classIdA == classIdB);
+        PublishConfig(pConfig);
     }
     
     bool ABOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaBuilder& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListA = 
+            pSourceState->m_occurrenceMetaListA;
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListB = 
+            pSourceState->m_occurrenceMetaListB;
         
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
+        if (!m_enabled or !CheckForSourceId(*pConfig, pFrameMeta->source_id))
         {
             return false;
         }
         
         bool occurrenceAdded(false);
         
-        m_classId = m_classIdA;
-        if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
-            CheckForInside(pObjectMeta))
+        if (CheckForMinCriteria(*pConfig, pConfig->m_classIdA, pFrameMeta, pObjectMeta) and 
+            CheckForInside(*pConfig, pObjectMeta))
         {
-            m_occurrenceMetaListA.push_back(pObjectMeta);
+            occurrenceMetaListA.push_back(pObjectMeta);
             occurrenceAdded = true;
         }
-        else if (!m_classIdAOnly)
+        else if (!pConfig->m_classIdAOnly)
         {
-            m_classId = m_classIdB;
-            if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
-                CheckForInside(pObjectMeta))
+            if (CheckForMinCriteria(*pConfig, pConfig->m_classIdB, pFrameMeta, pObjectMeta) and 
+                CheckForInside(*pConfig, pObjectMeta))
             {
-                m_occurrenceMetaListB.push_back(pObjectMeta);
+                occurrenceMetaListB.push_back(pObjectMeta);
                 occurrenceAdded = true;
             }
         }
@@ -2770,9 +3026,10 @@ namespace DSL
     }
 
     uint ABOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        if (m_classIdAOnly)
+        if (OdeTriggerFrameView(this, 
+            pFrameMeta->source_id).GetConfig()->m_classIdAOnly)
         {
             return PostProcessFrameA(pBuffer, displayMetaData, pFrameMeta);
         }
@@ -2785,12 +3042,17 @@ namespace DSL
         uint classIdA, uint classIdB, uint limit, uint minimum, uint maximum, 
         uint testPoint, uint testMethod)
         : ABOdeTrigger(name, source, classIdA, classIdB, limit)
-        , m_minimum(minimum)
-        , m_maximum(maximum)
-        , m_testPoint(testPoint)
-        , m_testMethod(testMethod)
     {
         LOG_FUNC();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minimum = minimum;
+        pConfig->m_maximum = maximum;
+        pConfig->m_testPoint = testPoint;
+        pConfig->m_testMethod = testMethod;
+        PublishConfig(pConfig);
     }
 
     DistanceOdeTrigger::~DistanceOdeTrigger()
@@ -2802,182 +3064,184 @@ namespace DSL
     {
         LOG_FUNC();
         
-        *minimum = m_minimum;
-        *maximum = m_maximum;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minimum = pConfig->m_minimum;
+        *maximum = pConfig->m_maximum;
     }
 
     void DistanceOdeTrigger::SetRange(uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minimum = minimum;
-        m_maximum = maximum;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_minimum = minimum;
+        pConfig->m_maximum = maximum;
+        PublishConfig(pConfig);
     }
 
     void DistanceOdeTrigger::GetTestParams(uint* testPoint, uint* testMethod)
     {
         LOG_FUNC();
 
-        *testPoint = m_testPoint;
-        *testMethod = m_testMethod;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *testPoint = pConfig->m_testPoint;
+        *testMethod = pConfig->m_testMethod;
     }
 
     void DistanceOdeTrigger::SetTestParams(uint testPoint, uint testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_testPoint = testPoint;
-        m_testMethod = testMethod;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CloneConfig();
+        pConfig->m_testPoint = testPoint;
+        pConfig->m_testMethod = testMethod;
+        PublishConfig(pConfig);
     }
     
     
     uint DistanceOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListA = 
+            pSourceState->m_occurrenceMetaListA;
+        
+        pSourceState->m_occurrences = 0;
+        
+        // need at least two objects for intersection to occur
+        while (m_enabled and occurrenceMetaListA.size() > 1)
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
-            
-            // need at least two objects for intersection to occur
-            while (m_enabled and m_occurrenceMetaListA.size() > 1)
+            // iterate through the list of object occurrences that passed all min criteria
+            for (uint i = 0; i < occurrenceMetaListA.size()-1 ; i++) 
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (uint i = 0; i < m_occurrenceMetaListA.size()-1 ; i++) 
+                for (uint j = i+1; j < occurrenceMetaListA.size() ; j++) 
                 {
-                    for (uint j = i+1; j < m_occurrenceMetaListA.size() ; j++) 
+                    if (CheckDistance(*pConfig, occurrenceMetaListA[i], 
+                        occurrenceMetaListA[j]))
                     {
-                        if (CheckDistance(m_occurrenceMetaListA[i], 
-                            m_occurrenceMetaListA[j]))
+                        // event has been triggered
+                        pSourceState->m_occurrences++;
+                        IncrementAndCheckTriggerCount(*pConfig);
+                        
+                         // update the total event count static variable
+                        pSourceState->m_eventId = ++s_eventCount;
+
+                        // set the primary metric as the current occurrence for this frame
+                        occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                            = pSourceState->m_occurrences;
+                        occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                            = pSourceState->m_occurrences;
+
+                        for (const auto &pOdeAction: pConfig->m_odeActions)
                         {
-                            // event has been triggered
-                            m_occurrences++;
-                            IncrementAndCheckTriggerCount();
                             
-                             // update the total event count static variable
-                            s_eventCount++;
-
-                            // set the primary metric as the current occurrence for this frame
-                            m_occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-                            m_occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-
-                            for (const auto &imap: m_pOdeActionsIndexed)
-                            {
-                                DSL_ODE_ACTION_PTR pOdeAction = 
-                                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                
-                                // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
-                            }
-                            if (m_eventLimit and m_triggered >= m_eventLimit)
-                            {
-                                m_occurrenceMetaListA.clear();
-                                break;
-                            }
+                            // Invoke each action twice, once for each object in the tested pair
+                            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                pBuffer, displayMetaData, pFrameMeta, occurrenceMetaListA[i]);
+                            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                pBuffer, displayMetaData, pFrameMeta, occurrenceMetaListA[j]);
+                        }
+                        if (pConfig->m_eventLimit and 
+                            m_triggered >= pConfig->m_eventLimit)
+                        {
+                            occurrenceMetaListA.clear();
+                            break;
                         }
                     }
                 }
-                break;
-            }   
+            }
+            break;
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaListA.clear();
-        }
-        // mutext unlocked - safe to call base class
+        // reset for next frame
+        occurrenceMetaListA.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
    
     uint DistanceOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListA = 
+            pSourceState->m_occurrenceMetaListA;
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListB = 
+            pSourceState->m_occurrenceMetaListB;
+        
+        pSourceState->m_occurrences = 0;
+        
+        // need at least one object from each of the two Classes 
+        while (m_enabled and occurrenceMetaListA.size() and occurrenceMetaListB.size())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
-            
-            // need at least one object from each of the two Classes 
-            while (m_enabled and m_occurrenceMetaListA.size() and m_occurrenceMetaListB.size())
+            // iterate through the list of object occurrences that passed all min criteria
+            for (const auto &iterA: occurrenceMetaListA) 
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &iterA: m_occurrenceMetaListA) 
+                for (const auto &iterB: occurrenceMetaListB) 
                 {
-                    for (const auto &iterB: m_occurrenceMetaListB) 
+                    // ensure we are not testing the same object which can be in both vectors
+                    // if Class Id A and B are specified to be the same.
+                    if (iterA != iterB)
                     {
-                        // ensure we are not testing the same object which can be in both vectors
-                        // if Class Id A and B are specified to be the same.
-                        if (iterA != iterB)
+                        if (CheckDistance(*pConfig, iterA, iterB))
                         {
-                            if (CheckDistance(iterA, iterB))
+                            // event has been triggered
+                            pSourceState->m_occurrences++;
+                            IncrementAndCheckTriggerCount(*pConfig);
+                            
+                             // update the total event count static variable
+                            pSourceState->m_eventId = ++s_eventCount;
+
+                            // set the primary metric as the current occurrence 
+                            // for this frame
+                            iterA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                                = pSourceState->m_occurrences;
+                            iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                                = pSourceState->m_occurrences;
+
+                            for (const auto &pOdeAction: pConfig->m_odeActions)
                             {
-                                // event has been triggered
-                                m_occurrences++;
-                                IncrementAndCheckTriggerCount();
                                 
-                                 // update the total event count static variable
-                                s_eventCount++;
-
-                                // set the primary metric as the current occurrence 
-                                // for this frame
-                                iterA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-                                iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-
-                                for (const auto &imap: m_pOdeActionsIndexed)
-                                {
-                                    DSL_ODE_ACTION_PTR pOdeAction = 
-                                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                    
-                                    // Invoke each action twice, once for each object 
-                                    // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterB);
-                                }
-                                if (m_eventLimit and m_triggered >= m_eventLimit)
-                                {
-                                    m_occurrenceMetaListA.clear();
-                                    m_occurrenceMetaListB.clear();
-                                    break;
-                                }
+                                // Invoke each action twice, once for each object 
+                                // in the tested pair
+                                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                    pBuffer, displayMetaData, pFrameMeta, iterA);
+                                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                    pBuffer, displayMetaData, pFrameMeta, iterB);
+                            }
+                            if (pConfig->m_eventLimit and 
+                                m_triggered >= pConfig->m_eventLimit)
+                            {
+                                occurrenceMetaListA.clear();
+                                occurrenceMetaListB.clear();
+                                break;
                             }
                         }
                     }
                 }
-                break;
-            }   
+            }
+            break;
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaListA.clear();
-            m_occurrenceMetaListB.clear();
-        }
-        // mutext unlocked - safe to call base class
+        // reset for next frame
+        occurrenceMetaListA.clear();
+        occurrenceMetaListB.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
 
-    bool DistanceOdeTrigger::CheckDistance(NvDsObjectMeta* pObjectMetaA, 
-        NvDsObjectMeta* pObjectMetaB)
+    bool DistanceOdeTrigger::CheckDistance(const OdeTriggerConfig& config,
+        NvDsObjectMeta* pObjectMetaA, NvDsObjectMeta* pObjectMetaB)
     {
         uint distance(0);
-        if (m_testPoint == DSL_BBOX_POINT_ANY)
+        if (config.m_testPoint == DSL_BBOX_POINT_ANY)
         {
             GeosRectangle rectA(pObjectMetaA->rect_params);
             GeosRectangle rectB(pObjectMetaB->rect_params);
@@ -2985,7 +3249,7 @@ namespace DSL
         }
         else{
             uint xa(0), ya(0), xb(0), yb(0);
-            switch (m_testPoint)
+            switch (config.m_testPoint)
             {
             case DSL_BBOX_POINT_CENTER :
                 xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width/2);
@@ -3042,7 +3306,7 @@ namespace DSL
                 yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height/2);
                 break;
             default:
-                LOG_ERROR("Invalid DSL_BBOX_POINT = '" << m_testPoint 
+                LOG_ERROR("Invalid DSL_BBOX_POINT = '" << config.m_testPoint 
                     << "' for DistanceOdeTrigger Trigger '" << GetName() << "'");
                 throw;
             }
@@ -3053,27 +3317,27 @@ namespace DSL
         }
         
         uint minimum(0), maximum(0);
-        switch (m_testMethod)
+        switch (config.m_testMethod)
         {
         case DSL_DISTANCE_METHOD_FIXED_PIXELS :
-            minimum = m_minimum;
-            maximum = m_maximum;
+            minimum = config.m_minimum;
+            maximum = config.m_maximum;
             break;
         case DSL_DISTANCE_METHOD_PERCENT_WIDTH_A :
-            minimum = uint((m_minimum*pObjectMetaA->rect_params.width)/100);
-            maximum = uint((m_maximum*pObjectMetaA->rect_params.width)/100);
+            minimum = uint((config.m_minimum*pObjectMetaA->rect_params.width)/100);
+            maximum = uint((config.m_maximum*pObjectMetaA->rect_params.width)/100);
             break;
         case DSL_DISTANCE_METHOD_PERCENT_WIDTH_B :
-            minimum = uint((m_minimum*pObjectMetaB->rect_params.width)/100);
-            maximum = uint((m_maximum*pObjectMetaB->rect_params.width)/100);
+            minimum = uint((config.m_minimum*pObjectMetaB->rect_params.width)/100);
+            maximum = uint((config.m_maximum*pObjectMetaB->rect_params.width)/100);
             break;
         case DSL_DISTANCE_METHOD_PERCENT_HEIGHT_A :
-            minimum = uint((m_minimum*pObjectMetaA->rect_params.height)/100);
-            maximum = uint((m_maximum*pObjectMetaA->rect_params.height)/100);
+            minimum = uint((config.m_minimum*pObjectMetaA->rect_params.height)/100);
+            maximum = uint((config.m_maximum*pObjectMetaA->rect_params.height)/100);
             break;
         case DSL_DISTANCE_METHOD_PERCENT_HEIGHT_B :
-            minimum = uint((m_minimum*pObjectMetaB->rect_params.height)/100);
-            maximum = uint((m_maximum*pObjectMetaB->rect_params.height)/100);
+            minimum = uint((config.m_minimum*pObjectMetaB->rect_params.height)/100);
+            maximum = uint((config.m_maximum*pObjectMetaB->rect_params.height)/100);
             break;
         }    
         return (minimum > distance or maximum < distance);
@@ -3094,144 +3358,142 @@ namespace DSL
     }
     
     uint IntersectionOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListA = 
+            pSourceState->m_occurrenceMetaListA;
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListB = 
+            pSourceState->m_occurrenceMetaListB;
+        
+        pSourceState->m_occurrences = 0;
+        
+        // need at least two objects for intersection to occur
+        if (m_enabled and occurrenceMetaListA.size() > 1)
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
-            
-            // need at least two objects for intersection to occur
-            if (m_enabled and m_occurrenceMetaListA.size() > 1)
+            // iterate through the list of object occurrences that passed all min criteria
+            for (uint i = 0; i < occurrenceMetaListA.size()-1 ; i++) 
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (uint i = 0; i < m_occurrenceMetaListA.size()-1 ; i++) 
+                for (uint j = i+1; j < occurrenceMetaListA.size() ; j++) 
                 {
-                    for (uint j = i+1; j < m_occurrenceMetaListA.size() ; j++) 
+                    // check each in turn for any frame overlap
+                    GeosRectangle rectA(occurrenceMetaListA[i]->rect_params);
+                    GeosRectangle rectB(occurrenceMetaListA[j]->rect_params);
+                    if (rectA.Overlaps(rectB))
                     {
-                        // check each in turn for any frame overlap
-                        GeosRectangle rectA(m_occurrenceMetaListA[i]->rect_params);
-                        GeosRectangle rectB(m_occurrenceMetaListA[j]->rect_params);
-                        if (rectA.Overlaps(rectB))
+                        // event has been triggered
+                        pSourceState->m_occurrences++;
+                        IncrementAndCheckTriggerCount(*pConfig);
+                        
+                         // update the total event count static variable
+                        pSourceState->m_eventId = ++s_eventCount;
+
+                        // set the primary metric as the current occurrence for this frame
+                        occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                            = pSourceState->m_occurrences;
+                        occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                            = pSourceState->m_occurrences;
+
+                        for (const auto &pOdeAction: pConfig->m_odeActions)
                         {
-                            // event has been triggered
-                            m_occurrences++;
-                            IncrementAndCheckTriggerCount();
                             
-                             // update the total event count static variable
-                            s_eventCount++;
-
-                            // set the primary metric as the current occurrence for this frame
-                            m_occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-                            m_occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-
-                            for (const auto &imap: m_pOdeActionsIndexed)
-                            {
-                                DSL_ODE_ACTION_PTR pOdeAction = 
-                                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                
-                                // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
-                            }
-                            if (m_eventLimit and m_triggered >= m_eventLimit)
-                            {
-                                m_occurrenceMetaListA.clear();
-                                return m_occurrences;
-                            }
+                            // Invoke each action twice, once for each object in the tested pair
+                            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                pBuffer, displayMetaData, pFrameMeta, occurrenceMetaListA[i]);
+                            pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                pBuffer, displayMetaData, pFrameMeta, occurrenceMetaListA[j]);
+                        }
+                        if (pConfig->m_eventLimit and 
+                            m_triggered >= pConfig->m_eventLimit)
+                        {
+                            occurrenceMetaListA.clear();
+                            return pSourceState->m_occurrences;
                         }
                     }
                 }
-            }   
+            }
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaListA.clear();
-        }
-        // mutext unlocked - safe to call base class
+        // reset for next frame
+        occurrenceMetaListA.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
 
     uint IntersectionOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaBuilder& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        OdeTriggerFrameView frame(this, pFrameMeta->source_id);
+        const DSL_ODE_TRIGGER_CONFIG_PTR& pConfig = frame.GetConfig();
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& pSourceState = 
+            frame.GetSourceState();
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListA = 
+            pSourceState->m_occurrenceMetaListA;
+        FrameArenaVector<NvDsObjectMeta*>& occurrenceMetaListB = 
+            pSourceState->m_occurrenceMetaListB;
+        
+        pSourceState->m_occurrences = 0;
+        
+        // need at least one object from each of the two Classes 
+        if (m_enabled and occurrenceMetaListA.size() and occurrenceMetaListB.size())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
-            
-            // need at least one object from each of the two Classes 
-            if (m_enabled and m_occurrenceMetaListA.size() and m_occurrenceMetaListB.size())
+            // iterate through the list of object occurrences that passed all min criteria
+            for (const auto &iterA: occurrenceMetaListA) 
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &iterA: m_occurrenceMetaListA) 
+                for (const auto &iterB: occurrenceMetaListB) 
                 {
-                    for (const auto &iterB: m_occurrenceMetaListB) 
+                    // ensure we are not testing the same object which can be in both vectors
+                    // if Class Id A and B are specified to be the same.
+                    if (iterA != iterB)
                     {
-                        // ensure we are not testing the same object which can be in both vectors
-                        // if Class Id A and B are specified to be the same.
-                        if (iterA != iterB)
+                        // check each in turn for any frame overlap
+                        GeosRectangle rectA(iterA->rect_params);
+                        GeosRectangle rectB(iterB->rect_params);
+                        if (rectA.Overlaps(rectB))
                         {
-                            // check each in turn for any frame overlap
-                            GeosRectangle rectA(iterA->rect_params);
-                            GeosRectangle rectB(iterB->rect_params);
-                            if (rectA.Overlaps(rectB))
+                            // event has been triggered
+                            pSourceState->m_occurrences++;
+                            IncrementAndCheckTriggerCount(*pConfig);
+                            
+                             // update the total event count static variable
+                            pSourceState->m_eventId = ++s_eventCount;
+
+                            // set the primary metric as the current occurrence 
+                            // for this frame
+                            iterA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                                = pSourceState->m_occurrences;
+                            iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                                = pSourceState->m_occurrences;
+                            
+                            for (const auto &pOdeAction: pConfig->m_odeActions)
                             {
-                                // event has been triggered
-                                m_occurrences++;
-                                IncrementAndCheckTriggerCount();
                                 
-                                 // update the total event count static variable
-                                s_eventCount++;
-
-                                // set the primary metric as the current occurrence 
-                                // for this frame
-                                iterA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-                                iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-                                
-                                for (const auto &imap: m_pOdeActionsIndexed)
-                                {
-                                    DSL_ODE_ACTION_PTR pOdeAction = 
-                                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                    
-                                    // Invoke each action twice, once for each object 
-                                    // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterB);
-                                }
-                                if (m_eventLimit and m_triggered >= m_eventLimit)
-                                {
-                                    m_occurrenceMetaListA.clear();
-                                    m_occurrenceMetaListB.clear();
-                                    return m_occurrences;
-                                }
+                                // Invoke each action twice, once for each object 
+                                // in the tested pair
+                                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                    pBuffer, displayMetaData, pFrameMeta, iterA);
+                                pOdeAction->InvokeOccurrence(shared_from_this(), 
+                                    pBuffer, displayMetaData, pFrameMeta, iterB);
+                            }
+                            if (pConfig->m_eventLimit and 
+                                m_triggered >= pConfig->m_eventLimit)
+                            {
+                                occurrenceMetaListA.clear();
+                                occurrenceMetaListB.clear();
+                                return pSourceState->m_occurrences;
                             }
                         }
                     }
                 }
-            }   
+            }
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaListA.clear();
-            m_occurrenceMetaListB.clear();
-        }
-        // mutex unlocked - safe to call base class
+        // reset for next frame
+        occurrenceMetaListA.clear();
+        occurrenceMetaListB.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -28,8 +28,10 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslOdeBase.h"
+#include "DslOdeStats.h"
 #include "DslOdeTrackedObject.h"
 #include "DslDisplayTypes.h"
+#include "DslMainContext.h"
 
 namespace DSL
 {
@@ -136,6 +138,447 @@ namespace DSL
         std::shared_ptr<IntersectionOdeTrigger> \
             (new IntersectionOdeTrigger(name, source, classIdA, classIdB, limit))
 
+    #define DSL_ODE_TRIGGER_CONFIG_PTR std::shared_ptr<const OdeTriggerConfig>
+    
+    #define DSL_ODE_TRIGGER_SOURCE_STATE_PTR std::shared_ptr<OdeTriggerSourceState>
+    #define DSL_ODE_TRIGGER_SOURCE_STATES_PTR \
+        std::shared_ptr<const std::map<uint, DSL_ODE_TRIGGER_SOURCE_STATE_PTR>>
+
+    class OdeTrigger;
+    class OdeAction;
+    class OdeArea;
+    class OdeAccumulator;
+    class OdeHeatMapper;
+
+    // *****************************************************************************
+
+    /**
+     * @struct OdeTriggerConfig
+     * @brief Immutable snapshot of an ODE Trigger's criteria and children. 
+     * A new snapshot is built and published (atomic pointer swap) on every 
+     * client update. The streaming thread reads the current snapshot without 
+     * locking, and holds it for the duration of the frame or object check.
+     */
+    struct OdeTriggerConfig
+    {
+        /**
+         * @brief ctor for the OdeTriggerConfig struct
+         * @param[in] source unique source name filter, NULL to disable
+         * @param[in] classId class id filter
+         * @param[in] limit event limit, 0 = no limit
+         */
+        OdeTriggerConfig(const char* source, uint classId, uint limit)
+            : m_source(source ? source : "")
+            , m_classId(classId)
+            , m_eventLimit(limit)
+            , m_frameLimit(0)
+            , m_minConfidence(0)
+            , m_maxConfidence(0)
+            , m_minTrackerConfidence(0)
+            , m_maxTrackerConfidence(0)
+            , m_minWidth(0)
+            , m_minHeight(0)
+            , m_maxWidth(0)
+            , m_maxHeight(0)
+            , m_interval(0)
+            , m_minFrameCountN(1)
+            , m_minFrameCountD(1)
+            , m_inferDoneOnly(false)
+            , m_minimum(0)
+            , m_maximum(0)
+            , m_testPoint(0)
+            , m_testMethod(0)
+            , m_minCrossFrameCount(0)
+            , m_maxTracePoints(0)
+            , m_traceEnabled(false)
+            , m_traceLineWidth(0)
+            , m_instanceCount(1)
+            , m_suppressionCount(0)
+            , m_classIdA(classId)
+            , m_classIdB(classId)
+            , m_classIdAOnly(true)
+        {};
+
+        /**
+         * @brief unique source name filter for this event
+         * NULL indicates filter is disabled
+         */
+        std::string m_source;
+        
+        /**
+         * @brief unique inference component name filter for this event
+         * NULL indicates filter is disabled
+         */
+        std::string m_infer;
+        
+        /**
+         * @brief GIE Class Id filter for this event
+         */
+        uint m_classId;
+        
+        /**
+         * @brief trigger event limit, once reached, actions will no longer be invoked
+         */
+        uint m_eventLimit;
+
+        /**
+         * @brief trigger frame limit, once reached, actions will no longer be invoked
+         */
+        uint m_frameLimit;
+
+        /**
+         * Mininum inference confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_minConfidence;
+        
+        /**
+         * Maximum inference confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_maxConfidence;
+        
+        /**
+         * Mininum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_minTrackerConfidence;
+        
+        /**
+         * Maximum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_maxTrackerConfidence;
+        
+        /**
+         * @brief Minimum rectangle width to trigger an ODE occurrence
+         */
+        float m_minWidth;
+
+        /**
+         * @brief Minimum rectangle height to trigger an ODE occurrence
+         */
+        float m_minHeight;
+
+        /**
+         * @brief Maximum rectangle width to trigger an ODE occurrence
+         */
+        float m_maxWidth;
+
+        /**
+         * @brief Maximum rectangle height to trigger an ODE occurrence
+         */
+        float m_maxHeight;
+
+        /**
+         * @brief process interval, default = 0
+         */
+        uint m_interval;
+        
+        /**
+         * @brief Minimum frame count numerator to trigger an ODE occurrence
+         */
+        uint m_minFrameCountN;
+
+        /**
+         * @brief Minimum frame count denominator to trigger an ODE occurrence
+         */
+        uint m_minFrameCountD;
+        
+        /**
+         * @brief if set, the Frame meta value "bInferDone" must be set
+         * to trigger an occurrence
+         */
+        bool m_inferDoneOnly;
+
+        /**
+         * @brief child ODE Actions, pre-cast, in their add-order for execution
+         */
+        std::vector<std::shared_ptr<OdeAction>> m_odeActions;
+
+        /**
+         * @brief child ODE Areas, pre-cast, in their add-order for execution
+         */
+        std::vector<std::shared_ptr<OdeArea>> m_odeAreas;
+
+        /**
+         * @brief optional metric accumulator, pre-cast, NULL if not set.
+         */
+        std::shared_ptr<OdeAccumulator> m_pAccumulator;
+
+        /**
+         * @brief optional ODE Heat-Mapper, pre-cast, NULL if not set.
+         */
+        std::shared_ptr<OdeHeatMapper> m_pHeatMapper;
+
+        /**
+         * @brief map of all currently registered limit-state-change-listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_ode_trigger_limit_state_change_listener_cb, 
+            void*> m_limitStateChangeListeners;
+
+        // Subclass criteria - only used by the Trigger types noted.
+
+        /**
+         * @brief minimum object count (Count), distance (Distance), or 
+         * duration in seconds (Persistence) for ODE occurrence, 0 = no minimum.
+         */
+        uint m_minimum;
+
+        /**
+         * @brief maximum object count (Count), distance (Distance), or 
+         * duration in seconds (Persistence) for ODE occurrence, 0 = no maximum.
+         */
+        uint m_maximum;
+
+        /**
+         * @brief the bounding box point to measure distance (Distance).
+         */
+        uint m_testPoint;
+
+        /**
+         * @brief the method to use to measure distance between objects
+         * (Distance), or to test object trace line crossing (Cross).
+         */
+        uint m_testMethod;
+
+        /**
+         * @brief minimum number of consective frames required to trigger an 
+         * event on both sides of the line (Cross).
+         */
+        uint m_minCrossFrameCount;
+
+        /**
+         * @brief maximum number of trace points to maintain for each tracked
+         * object (Tracking Triggers).
+         */
+        uint m_maxTracePoints;
+
+        /**
+         * @brief true if object trace display is enabled, false otherwise (Cross).
+         */
+        bool m_traceEnabled;
+
+        /**
+         * @brief shared pointer to RGBA Color to use for the object trace
+         * display (Cross).
+         */
+        DSL_RGBA_COLOR_PTR m_pTraceColor;
+
+        /**
+         * @brief line width for the object trace in units of pixels (Cross).
+         */
+        uint m_traceLineWidth;
+
+        /**
+         * @brief the number of consecutive instances to trigger an ODE 
+         * occurrence before suppressing (Instance).
+         */
+        uint m_instanceCount;
+
+        /**
+         * @brief the number of consecutive instances to suppress ODE occurrence
+         * once m_instanceCount has been reached. 0 = suppress indefinitely (Instance).
+         */
+        uint m_suppressionCount;
+
+        /**
+         * @brief Class Id for the A objects (AB Triggers).
+         */
+        uint m_classIdA;
+
+        /**
+         * @brief Class Id for the B objects (AB Triggers).
+         */
+        uint m_classIdB;
+
+        /**
+         * @brief true if A-A testing, false if A-B testing (AB Triggers).
+         */
+        bool m_classIdAOnly;
+    };
+
+    /**
+     * @struct OdeTriggerSourceState
+     * @brief Streaming state of an ODE Trigger for a single source. Frames of 
+     * the same source are always processed in order, one at a time, so frames
+     * of different sources - or from different Pipelines - can be processed 
+     * concurrently without locking the Trigger's shared state. Members that
+     * are reset by the client, or read across sources, are atomic.
+     */
+    struct OdeTriggerSourceState
+    {
+        /**
+         * @brief ctor for the OdeTriggerSourceState struct
+         */
+        OdeTriggerSourceState()
+            : m_occurrences(0)
+            , m_occurrencesAccumulated(0)
+            , m_intervalCounter(0)
+            , m_skipFrame(false)
+            , m_eventId(0)
+            , m_occurrencesIn(0)
+            , m_occurrencesOut(0)
+            , m_pSelectedObjectMeta(NULL)
+            , m_selectedTrackedTimeMs(0)
+        {};
+        
+        /**
+         * @brief number of occurrences for the current frame, 
+         * reset on entry to PreProcessFrame
+         */
+        uint m_occurrences; 
+        
+        /**
+         * @brief number of occurrences in the accumlated over all frames, reset on
+         * Trigger reset. Only updated if/when the Trigger has an ODE Accumulator. 
+         */
+        std::atomic<uint> m_occurrencesAccumulated;
+        
+        /**
+         * @brief current number of frames in the current interval
+         */
+        std::atomic<uint> m_intervalCounter;
+        
+        /**
+         * @brief flag to identify frames that should be skipped, if m_interval > 0
+         */
+        bool m_skipFrame;
+        
+        /**
+         * @brief unique id of the last event triggered for this source.
+         */
+        uint64_t m_eventId;
+
+        /**
+         * @brief number of occurrences in the "in-direction" for the current 
+         * frame, reset on exit of PostProcessFrame. Used by the Cross Trigger.
+         */
+        uint m_occurrencesIn;
+
+        /**
+         * @brief number of occurrences in the "out-direction" for the current 
+         * frame, reset on exit of PostProcessFrame. Used by the Cross Trigger.
+         */
+        uint m_occurrencesOut;
+
+        /**
+         * @brief pointer to the Latest or Earliest object in the current frame, 
+         * cleared on exit of PostProcessFrame. Used by the Latest and Earliest
+         * Triggers.
+         */
+        NvDsObjectMeta* m_pSelectedObjectMeta;
+
+        /**
+         * @brief Tracked time for the m_pSelectedObjectMeta.
+         */
+        double m_selectedTrackedTimeMs;
+        
+        /**
+         * @brief list of pointers to NvDsObjectMeta data for the current frame.
+         * Used by Triggers that check all objects on PostProcessFrame. 
+         * The lists are re-bound to the current frame arena by PreProcessFrame.
+         */ 
+        FrameArenaVector<NvDsObjectMeta*> m_occurrenceMetaList;
+
+        /**
+         * @brief list of pointers to NvDsObjectMeta data for Class A for the 
+         * current frame. Used by the AB Triggers.
+         */ 
+        FrameArenaVector<NvDsObjectMeta*> m_occurrenceMetaListA;
+        
+        /**
+         * @brief list of pointers to NvDsObjectMeta data for Class B for the 
+         * current frame. Used by the AB Triggers.
+         */ 
+        FrameArenaVector<NvDsObjectMeta*> m_occurrenceMetaListB;
+    };
+
+    /**
+     * @struct OdeTriggerFrameSnapshot
+     * @brief Config and source-state snapshots of an ODE Trigger for the frame
+     * being processed. Loaded once per frame, before PreProcessFrame, so that 
+     * the frame's object checks and post-processing load neither.
+     */
+    struct OdeTriggerFrameSnapshot
+    {
+        /**
+         * @brief ctor for the OdeTriggerFrameSnapshot struct
+         */
+        OdeTriggerFrameSnapshot()
+            : pOdeTrigger(NULL)
+            , sourceId(0)
+        {};
+        
+        /**
+         * @brief Trigger the snapshots were loaded for, NULL if not loaded.
+         */
+        const OdeTrigger* pOdeTrigger;
+        
+        /**
+         * @brief source id of the frame the snapshots were loaded for.
+         */
+        uint sourceId;
+        
+        /**
+         * @brief the Trigger's configuration snapshot for the frame.
+         */
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig;
+        
+        /**
+         * @brief the Trigger's streaming state for the frame's source.
+         */
+        DSL_ODE_TRIGGER_SOURCE_STATE_PTR pSourceState;
+    };
+    
+    /**
+     * @class OdeTriggerFrameScope
+     * @brief Installs the frame snapshot of the Trigger being called for the 
+     * calling thread for the lifetime of the scope, restoring the previous
+     * snapshot on exit. Installed by the ODE Pad Probe Handler around each
+     * call to a Trigger.
+     */
+    class OdeTriggerFrameScope
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeTriggerFrameScope class
+         * @param[in] pSnapshot frame snapshot to install.
+         */
+        OdeTriggerFrameScope(const OdeTriggerFrameSnapshot* pSnapshot)
+            : m_pPrevious(s_pCurrent)
+        {
+            s_pCurrent = pSnapshot;
+        };
+        
+        /**
+         * @brief dtor for the OdeTriggerFrameScope class
+         */
+        ~OdeTriggerFrameScope()
+        {
+            s_pCurrent = m_pPrevious;
+        };
+        
+        /**
+         * @brief Gets the frame snapshot installed for the calling thread.
+         * @return installed snapshot, NULL if none.
+         */
+        static const OdeTriggerFrameSnapshot* GetCurrent()
+        {
+            return s_pCurrent;
+        };
+        
+    private:
+    
+        /**
+         * @brief snapshot installed when the scope was entered.
+         */
+        const OdeTriggerFrameSnapshot* m_pPrevious;
+        
+        /**
+         * @brief snapshot installed for each thread.
+         */
+        static thread_local const OdeTriggerFrameSnapshot* s_pCurrent;
+    };
+
     // *****************************************************************************
 
     /**
@@ -151,10 +594,20 @@ namespace DSL
         ~OdeTrigger();
 
         /**
-         * @brief total count of all events
+         * @brief total count of all events, used as the unique event id.
          */
-        static uint64_t s_eventCount;
+        static std::atomic<uint64_t> s_eventCount;
         
+        /**
+         * @brief Gets the Trigger's current configuration snapshot. Lock free,
+         * safe to call from the streaming thread.
+         * @return shared pointer to the current, immutable snapshot.
+         */
+        DSL_ODE_TRIGGER_CONFIG_PTR GetConfig() const
+        {
+            return std::atomic_load(&m_pConfig);
+        };
+
         /**
          * @brief Function to check a given Object Meta data structure for the 
          * occurence of an event and to invoke all Event Actions owned by the event
@@ -165,7 +618,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         virtual bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta){return false;};
 
         /**
@@ -176,7 +629,7 @@ namespace DSL
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre processing
          */
         virtual void PreProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -187,7 +640,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -209,6 +662,14 @@ namespace DSL
          */
         void RemoveAllActions();
         
+        /**
+         * @brief Sets the stats of the parent ODE Handler, adding this 
+         * OdeTrigger and its Actions to them. Called by the Handler when the
+         * OdeTrigger is added and removed.
+         * @param[in] pParentStats stats of the parent Handler, NULL on removal.
+         */
+        void SetParentStats(OdeStats* pParentStats);
+        
         /**
          * @brief Adds an ODE Area as a child to this OdeTrigger
          * @param[in] pChild pointer to ODE Area to add
@@ -259,6 +720,53 @@ namespace DSL
          */
         virtual void Reset();
         
+        /**
+         * @brief Gets the streaming state for a given source, created on first
+         * use. Lock free once the source has been seen.
+         * @param[in] sourceId unique source id of the frame being processed.
+         * @return shared pointer to the source's streaming state.
+         */
+        DSL_ODE_TRIGGER_SOURCE_STATE_PTR GetSourceState(uint sourceId);
+        
+        /**
+         * @brief Loads the config and source-state snapshots for a frame. 
+         * Called by the ODE Pad Probe Handler once per frame, before calling
+         * PreProcessFrame with the snapshot installed.
+         * @param[out] snapshot frame snapshot to load.
+         * @param[in] sourceId unique source id of the frame being processed.
+         */
+        void LoadFrameSnapshot(OdeTriggerFrameSnapshot& snapshot, uint sourceId);
+        
+        /**
+         * @brief Gets the aggregate number of events triggered over all sources
+         * since creation or last reset.
+         * @return current event count.
+         */
+        uint64_t GetEventCount();
+        
+        /**
+         * @brief Gets the aggregate number of frames processed over all sources
+         * since the first event, used for the frame limit.
+         * @return current frame count.
+         */
+        uint64_t GetFrameCount();
+        
+        /**
+         * @brief Gets the accumulated occurrences summed over all sources.
+         * @return current accumulated occurrences.
+         */
+        uint64_t GetOccurrencesAccumulated();
+        
+        /**
+         * @brief Determines if the Trigger can process frames of different 
+         * sources concurrently with identical results, i.e. all of its 
+         * streaming state is held per source. Triggers with an event or frame 
+         * limit, an ODE Accumulator or Heat-Mapper share state across sources.
+         * @return true if frames of different sources can be processed
+         * concurrently, false otherwise.
+         */
+        virtual bool IsSourceSharded();
+        
         /**
          * @brief Timer callback function to handle the Reset timer timeout
          * @return false always to destroy the one shot timer.
@@ -508,42 +1016,87 @@ namespace DSL
          * for min criteria
          * @return true if Min Criteria is met, false otherwise
          */
-        bool CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
-            NvDsObjectMeta* pObjectMeta);
+        bool CheckForMinCriteria(const OdeTriggerConfig& config,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Common function to check if an Object's meta data meets the 
+         * min criteria for ODE occurrence using a specific class id filter.
+         * @param[in] classId class id filter to use in place of the Trigger's.
+         */
+        bool CheckForMinCriteria(const OdeTriggerConfig& config, uint classId,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
          * @brief Common function to check if an Object's bbox fails within
          * one of the Triggers Areas
+         * @param[in] config current configuration snapshot to check against.
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
          * for within
          * @return true if the bbox is within one of the trigger's area, false otherwise
          */
-        bool CheckForInside(NvDsObjectMeta* pObjectMeta);
+        bool CheckForInside(const OdeTriggerConfig& config, 
+            NvDsObjectMeta* pObjectMeta);
         
         /**
          * @brief Common function to check if a Frame's source id meets the 
          * criteria for ODE occurrence.
+         * @param[in] config current configuration snapshot to check against.
          * @param sourceId a Frame's Source Id to check against the trigger's 
          * source filter if set.
          * @return true if Source Id criteria is met, false otherwise
          */
-        bool CheckForSourceId(int sourceId);
+        bool CheckForSourceId(const OdeTriggerConfig& config, int sourceId);
         
         /**
          * @brief Common function to check if an Objects's infer component id 
          * meets the criteria for ODE occurrence.
+         * @param[in] config current configuration snapshot to check against.
          * @param inferId an object's inference component Id to check against 
          * the trigger's infer filter if set.
          * @return true if Source Id criteria is met, false otherwise
          */
-        bool CheckForInferId(int inferId);
+        bool CheckForInferId(const OdeTriggerConfig& config, int inferId);
         
         /**
          * @brief Increments the Trigger Occurrence counter and checks to see
          * if the count has been exceeded. If so, starts the reset timer if a 
          * timeout value is set/enabled.
+         * @param[in] config current configuration snapshot to check against.
+         */
+        void IncrementAndCheckTriggerCount(const OdeTriggerConfig& config);
+
+        /**
+         * @brief Creates a mutable copy of the current configuration snapshot. 
+         * Caller must hold m_configMutex.
+         * @return new copy to update and then publish with PublishConfig.
+         */
+        std::shared_ptr<OdeTriggerConfig> CloneConfig();
+
+        /**
+         * @brief Publishes a new configuration snapshot for the streaming
+         * thread to pick up on its next read. Caller must hold m_configMutex.
+         * @param[in] pConfig new snapshot to publish.
+         */
+        void PublishConfig(std::shared_ptr<OdeTriggerConfig> pConfig);
+
+        /**
+         * @brief Rebuilds the pre-cast child vectors from the indexed maps and
+         * publishes a new snapshot. Caller must hold m_configMutex.
+         */
+        void PublishChildren();
+
+        /**
+         * @brief Mutex to serialize client updates of the configuration snapshot.
+         * Never held by the streaming thread.
+         */
+        DslMutex m_configMutex;
+
+        /**
+         * @brief current configuration snapshot, accessed with std::atomic_load
+         * and std::atomic_store only.
          */
-        void IncrementAndCheckTriggerCount();
+        DSL_ODE_TRIGGER_CONFIG_PTR m_pConfig;
 
         /**
          * @brief Index variable to incremment/assign on ODE Area add.
@@ -584,16 +1137,22 @@ namespace DSL
          * @brief optional ODE Heat-Mapper owned by the ODE Trigger.
          */
         DSL_BASE_PTR m_pHeatMapper;
+        
+        /**
+         * @brief stats of the parent ODE Handler, NULL if none.
+         */
+        OdeStats* m_pParentStats;
     
         /**
          * @brief auto-reset timeout in units of seconds
          */
-        uint m_resetTimeout;
+        std::atomic<uint> m_resetTimeout;
 
         /**
-         * @brief gnome timer Id for the auto-reset timeout
+         * @brief timer for the auto-reset timeout, attached to the main-context
+         * of the Pipeline that produced the limit event.
          */
-        uint m_resetTimerId;
+        MainContextSource m_resetTimer;
         
         /**
          * @brief Mutex for timer reset logic
@@ -601,21 +1160,15 @@ namespace DSL
         DslMutex m_resetTimerMutex;
 
         /**
-         * @brief map of all currently registered limit-state-change-listeners
-         * callback functions mapped with the user provided data
-         */
-        std::map<dsl_ode_trigger_limit_state_change_listener_cb, 
-            void*>m_limitStateChangeListeners;
-        
-        /**
-         * @brief current number of frames in the current interval
+         * @brief Mutex to serialize the creation of new source states.
          */
-        uint m_intervalCounter;
+        DslMutex m_sourceStatesMutex;
         
         /**
-         * @brief flag to identify frames that should be skipped, if m_skipFrameInterval > 0
+         * @brief map of streaming states by unique source id. Copy-on-write,
+         * accessed with std::atomic_load and std::atomic_store only.
          */
-         bool m_skipFrame;
+        DSL_ODE_TRIGGER_SOURCE_STATES_PTR m_pSourceStates;
          
     public:
     
@@ -627,128 +1180,74 @@ namespace DSL
         std::wstring m_wName;
         
         /**
-         * @brief trigger count, incremented on every event occurrence
+         * @brief trigger count over all sources, incremented on every event
          */
-        uint64_t m_triggered;    
+        std::atomic<uint64_t> m_triggered;    
     
         /**
-         * @brief trigger event limit, once reached, actions will no longer be invoked
-         */
-        uint m_eventLimit;
-
-        /**
-         * @brief number of Frames the trigger has processed.
-         */
-        uint64_t m_frameCount;
-        
-        /**
-         * @brief trigger frame limit, once reached, actions will no longer be invoked
-         */
-        uint m_frameLimit;
-
-        /**
-         * @brief number of occurrences for the current frame, 
-         * reset on exit of PostProcessFrame
-         */
-        uint m_occurrences; 
-        
-        /**
-         * @brief number of occurrences in the accumlated over all frames, reset on
-         * Trigger reset. Only updated if/when the Trigger has an ODE Accumulator. 
-         */
-        uint m_occurrencesAccumulated;
-        
-
-        /**
-         * @brief unique source name filter for this event
-         * NULL indicates filter is disabled
+         * @brief number of Frames the trigger has processed over all sources.
          */
-        std::string m_source;
+        std::atomic<uint64_t> m_frameCount;
         
         /**
          * @brief unique source id filter for this event
          * -1 indicates not set ... updated on first use.
          */
-        int m_sourceId;
-        
-        /**
-         * @brief unique inference component name filter for this event
-         * NULL indicates filter is disabled
-         */
-        std::string m_infer;
+        std::atomic<int> m_sourceId;
         
         /**
          * @brief unique inference component id filter for this event
          * -1 indicates not set ... updated on first use.
          */
-        int m_inferId;
-        
-        /**
-         * @brief GIE Class Id filter for this event
-         */
-        uint m_classId;
-        
-        /**
-         * Mininum inference confidence to trigger an ODE occurrence [0.0..1.0]
-         */
-        float m_minConfidence;
-        
-        /**
-         * Maximum inference confidence to trigger an ODE occurrence [0.0..1.0]
-         */
-        float m_maxConfidence;
-        
+        std::atomic<int> m_inferId;
+
+    };
+    
+    /**
+     * @class OdeTriggerFrameView
+     * @brief Config and source state of an ODE Trigger for the frame being 
+     * processed. Uses the frame snapshot installed for the calling thread if 
+     * loaded for the same Trigger and source, and loads its own otherwise,
+     * e.g. when the Trigger is called outside of an ODE Pad Probe Handler.
+     */
+    class OdeTriggerFrameView
+    {
+    public:
+    
         /**
-         * Mininum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         * @brief ctor for the OdeTriggerFrameView class
+         * @param[in] pOdeTrigger Trigger processing the frame.
+         * @param[in] sourceId unique source id of the frame being processed.
          */
-        float m_minTrackerConfidence;
+        OdeTriggerFrameView(OdeTrigger* pOdeTrigger, uint sourceId);
         
         /**
-         * Maximum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         * @brief Gets the Trigger's configuration snapshot for the frame.
          */
-        float m_maxTrackerConfidence;
+        const DSL_ODE_TRIGGER_CONFIG_PTR& GetConfig() const
+        {
+            return m_pSnapshot->pConfig;
+        };
         
         /**
-         * @brief Minimum rectangle width to trigger an ODE occurrence
-         */
-        float m_minWidth;
-
-        /**
-         * @brief Minimum rectangle height to trigger an ODE occurrence
-         */
-        float m_minHeight;
-
-        /**
-         * @brief Maximum rectangle width to trigger an ODE occurrence
-         */
-        float m_maxWidth;
-
-        /**
-         * @brief Maximum rectangle height to trigger an ODE occurrence
-         */
-        float m_maxHeight;
-
-        /**
-         * @brief process interval, default = 0
+         * @brief Gets the Trigger's streaming state for the frame's source.
          */
-        uint m_interval;
+        const DSL_ODE_TRIGGER_SOURCE_STATE_PTR& GetSourceState() const
+        {
+            return m_pSnapshot->pSourceState;
+        };
         
+    private:
+    
         /**
-         * @brief Minimum frame count numerator to trigger an ODE occurrence
-         */
-        uint m_minFrameCountN;
-
-        /**
-         * @brief Minimum frame count denominator to trigger an ODE occurrence
+         * @brief snapshot in use, either installed or m_loaded.
          */
-        uint m_minFrameCountD;
+        const OdeTriggerFrameSnapshot* m_pSnapshot;
         
         /**
-         * @brief if set, the Frame meta value "bInferDone" must be set
-         * to trigger an occurrence
+         * @brief snapshot loaded when none is installed for the frame.
          */
-        bool m_inferDoneOnly;
-
+        OdeTriggerFrameSnapshot m_loaded;
     };
     
     static int TriggerResetTimeoutHandler(gpointer pTrigger);
@@ -768,7 +1267,7 @@ namespace DSL
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre-processing
          */
         void PreProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -778,7 +1277,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+            DisplayMetaBuilder& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
         
     private:
     
@@ -807,7 +1307,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -830,7 +1330,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -840,7 +1340,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -857,14 +1357,33 @@ namespace DSL
         ~TrackingOdeTrigger();
         
         /**
-         * @brief Overrides the base Reset in order to clear m_trackedObjectsPerSource
+         * @brief Overrides the base Reset in order to replace 
+         * m_pTrackedObjectsPerSource with an empty set of tracked objects.
          */
         void Reset();
+        
+        /**
+         * @brief Frames of different sources can't be processed concurrently,
+         * tracked objects for all sources are purged on each frame.
+         * @return false always.
+         */
+        bool IsSourceSharded(){return false;};
 
     protected:
 
         /**
-         * @brief map of tracked objects per source - Key = source Id
+         * @brief Gets the current set of tracked objects. Lock free, the set
+         * is only replaced, never cleared, on client Reset.
+         * @return shared pointer to the current set of tracked objects.
+         */
+        std::shared_ptr<TrackedObjects> GetTrackedObjects()
+        {
+            return std::atomic_load(&m_pTrackedObjectsPerSource);
+        };
+
+        /**
+         * @brief map of tracked objects per source - Key = source Id. Accessed 
+         * with std::atomic_load and std::atomic_store only.
          */
         std::shared_ptr<TrackedObjects> m_pTrackedObjectsPerSource;
     
@@ -889,7 +1408,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -899,7 +1418,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+            DisplayMetaBuilder& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
 
         /**
          * @brief Gets the current max-trace-point setting for this CrossOdeTrigger.
@@ -936,69 +1456,26 @@ namespace DSL
         void SetViewSettings(bool enabled, DSL_RGBA_COLOR_PTR pColor, uint lineWidth);
 
         /**
-         * @brief Overrides the base Reset in order to clear m_occurrencesIn and
-         * m_occurrencesOut
+         * @brief Overrides the base Reset in order to clear 
+         * m_occurrencesInAccumulated and m_occurrencesOutAccumulated
          */
         void Reset();
             
     private:
 
-        /**
-         * @brief maximum number of trace points to use in cross detection
-         */
-        uint m_maxTracePoints;
-
-        /**
-         * @brief number of occurrences in the "in-direction" for the current frame, 
-         * reset on exit of PostProcessFrame
-         */
-        uint m_occurrencesIn;
-
-        /**
-         * @brief number of occurrences in the "out-direction" for the current frame, 
-         * reset on exit of PostProcessFrame
-         */
-        uint m_occurrencesOut;
-
         /**
          * @brief number of occurrences in the "in-direction" accumlated over 
          * all frames reset on Trigger reset. Only updated if/when the Trigger
          * has an ODE Accumulator. 
          */
-        uint m_occurrencesInAccumulated;
+        std::atomic<uint> m_occurrencesInAccumulated;
 
         /**
          * @brief number of occurrences in the "out-direction" accumulated over, 
          * all frames reset on Trigger reset. Only updated if/when the Trigger
          * has an ODE Accumulator. 
          */
-        uint m_occurrencesOutAccumulated;
-
-        /**
-         * @brief minimum number of consective frames required to trigger an event
-         * on both sides of the line. 
-         */
-        uint m_minFrameCount;
-
-        /**
-         * @brief method to test object trace line crossing. All-points or end-points.
-         */
-        uint m_testMethod;
-        
-        /**
-         * @brief true if object trace display is enabled, false otherwise.
-         */
-        bool m_traceEnabled;
-        
-        /**
-         * @brief shared pointer to RGBA Color to use for the object trace display.
-         */
-        DSL_RGBA_COLOR_PTR m_pTraceColor;
-        
-        /**
-         * @brief line width for the object trace in units of pixels.
-         */
-        uint m_traceLineWidth;
+        std::atomic<uint> m_occurrencesOutAccumulated;
     
     };
     
@@ -1033,11 +1510,6 @@ namespace DSL
          */
         void SetCountSettings(uint instanceCount, uint suppressionCount);
 
-        /**
-         * @brief Overrides the base Reset in order to clear m_instances
-         */
-        void Reset();
-
         /**
          * @brief Function to check a given Object Meta data structure for New Instances of a Class
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
@@ -1046,7 +1518,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
         /**
@@ -1057,27 +1529,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
-            
-    private:
-    
-        /**
-         * @brief map of last Tracking Ids per unique source_id-class_id combination
-         */
-        std::map <std::string, uint64_t> m_instances;
-        
-        /**
-         * @brief the number of consecutive instances to trigger an ODE occurrence
-         * before suppressing.
-         */
-        uint m_instanceCount;
-        
-        /**
-         * @brief the number of consecutive instances to suppressing ODE occurrence
-         * once instanceCount has been reached. Default = 0 = suppress indefinitely
-         */
-        uint m_suppressionCount;
     
     };
     
@@ -1099,7 +1552,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1109,7 +1562,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1126,6 +1579,13 @@ namespace DSL
         
         ~CustomOdeTrigger();
 
+        /**
+         * @brief Frames of different sources can't be processed concurrently,
+         * the client's checker and post-processor may hold state across sources.
+         * @return false always.
+         */
+        bool IsSourceSharded(){return false;};
+
         /**
          * @brief Function to check a given Object Meta data structure for an 
          * Occurrence that meets the min criteria and to inkoke the client provided 
@@ -1140,7 +1600,7 @@ namespace DSL
          */
 
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         /**
          * @brief Function to call the client provided callback to post process the frame 
@@ -1149,7 +1609,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -1190,7 +1650,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1201,7 +1661,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1232,7 +1692,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1243,7 +1703,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1290,7 +1750,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1302,20 +1762,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
-
-    private:
-
-        /**
-         * @brief minimum duration of object persistence - 0 = no minimum.
-         */
-        double m_minimumMs;
-    
-        /**
-         * @brief maximum duration of object persistence - 0 = no maximum
-         */
-        double m_maximumMs;
     };
 
     class CountOdeTrigger : public OdeTrigger
@@ -1354,7 +1802,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1365,20 +1813,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
-
-    private:
-    
-        /**
-         * @brief Minimum object count for ODE occurrence, 0 = no minimum
-         */
-        uint m_minimum;
-    
-        /**
-         * @brief Maximum object count for ODE occurrence, 0 = no maximum
-         */
-        uint m_maximum;
     
     };
 
@@ -1401,7 +1837,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1412,18 +1848,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
-
-    private:
-    
-        /**
-         * @brief list of pointers to NvDsObjectMeta data
-         * Each object occurrence that matches the min criteria will be added
-         * to list to be checked for Smallest object on PostProcessFrame
-         */ 
-        std::vector<NvDsObjectMeta*> m_occurrenceMetaList;
-    
     };
 
     class LargestOdeTrigger : public OdeTrigger
@@ -1445,7 +1871,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1456,18 +1882,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
-
-    private:
-    
-        /**
-         * @brief list of pointers to NvDsObjectMeta data
-         * Each object occurrence that matches the min criteria will be added
-         * to list to be checked for Largest object on PostProcessFrame
-         */ 
-        std::vector<NvDsObjectMeta*> m_occurrenceMetaList;
-    
     };
 
     class LatestOdeTrigger : public TrackingOdeTrigger
@@ -1489,7 +1905,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1500,20 +1916,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
-
-    private:
-    
-        /**
-         * @brief pointer to the Latest - least Persistent - object in the current frame
-         */
-        NvDsObjectMeta* m_pLatestObjectMeta;
-        
-        /**
-         * @brief Tracked time for the m_pLatestObjectMeta
-         */
-        double m_latestTrackedTimeMs;
     };
 
     class EarliestOdeTrigger : public TrackingOdeTrigger
@@ -1535,7 +1939,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1546,20 +1950,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaBuilder& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
-
-    private:
-    
-        /**
-         * @brief pointer to the Earliest - most Persistent - object in the current frame
-         */
-        NvDsObjectMeta* m_pEarliestObjectMeta;
-        
-        /**
-         * @brief Tracked time for the m_pOldestObjectMeta
-         */
-        double m_earliestTrackedTimeMs;
     };
     
     class NewLowOdeTrigger : public OdeTrigger
@@ -1571,6 +1963,13 @@ namespace DSL
         
         ~NewLowOdeTrigger();
 
+        /**
+         * @brief Frames of different sources can't be processed concurrently,
+         * the current low is shared by all sources.
+         * @return false always.
+         */
+        bool IsSourceSharded(){return false;};
+
         /**
          * @brief Overrides the base Reset to reset the m_currentLow to m_preset
          */
@@ -1586,7 +1985,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1597,7 +1996,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1611,7 +2010,7 @@ namespace DSL
          * @brief current lowest count value, updated on new low.
          * Set to m_preset on trigger create and reset.
          */
-        uint m_currentLow;
+        std::atomic<uint> m_currentLow;
     
     };
 
@@ -1624,6 +2023,13 @@ namespace DSL
         
         ~NewHighOdeTrigger();
 
+        /**
+         * @brief Frames of different sources can't be processed concurrently,
+         * the current high is shared by all sources.
+         * @return false always.
+         */
+        bool IsSourceSharded(){return false;};
+
         /**
          * @brief Overrides the base Reset to reset the m_currentHigh to m_preset
          */
@@ -1639,7 +2045,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1650,7 +2056,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1664,13 +2070,7 @@ namespace DSL
          * @brief current highest count value, updated on new high.
          * Set to m_preset on trigger create and reset.
          */
-        uint m_currentHigh;
-        
-        
-        /**
-         * @brief Accumlative count of new high events accross all frames.
-         */
-        uint64_t m_occurrencesNewHighAccumulated;
+        std::atomic<uint> m_currentHigh;
     
     };
 
@@ -1693,7 +2093,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaBuilder& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1703,7 +2103,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -1731,7 +2131,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta) = 0;
 
         /**
@@ -1741,37 +2141,8 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta) = 0;
-
-        /**
-         * @brief list of pointers to NvDsObjectMeta data for Class A
-         * Each object occurrence of Class A that matches the criteria will be added
-         * to list to be checked for distance on PostProcessFrame
-         */ 
-        std::vector<NvDsObjectMeta*> m_occurrenceMetaListA;
-
-        /**
-         * @brief list of pointers to NvDsObjectMeta data for Class B
-         * Each object occurrence of Class B that matches the min criteria will be added
-         * to list to be checked for distance on PostProcessFrame
-         */ 
-        std::vector<NvDsObjectMeta*> m_occurrenceMetaListB;
-        
-        /**
-         * @brief boolean flag to specify if A-A testing or A-B testing
-         */
-        bool m_classIdAOnly;
-    
-        /**
-         * @brief Class ID to for A objects for A-B distance calculation
-         */
-        uint m_classIdA;
-
-        /**
-         * @brief Class ID to for A objects for A-B distance calculation
-         */
-        uint m_classIdB;
     };
 
     class DistanceOdeTrigger : public ABOdeTrigger
@@ -1824,7 +2195,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -1834,41 +2205,21 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     
         /**
          * @brief Calculates the distance between two objects based on the current
-         * m_bboxTestPoint setting. Either point-to-point or edge-to-edge
+         * test-point setting. Either point-to-point or edge-to-edge
+         * @param config[in] current configuration snapshot with the test settings.
          * @param pObjectMetaA[in] pointer to Object A's meta data with location and dimension
          * @param pObjectMetaB[in] pointer to Object B's meta data with location and dimension
          * @return true if the objects are within minimum or beyond the maximum distance
          * as mesured by the DSL_DISTANCE_METHOD
          */
-        bool CheckDistance(NvDsObjectMeta* pObjectMetaA, 
-            NvDsObjectMeta* pObjectMetaB);
-    
-        
-        /**
-         * @brief minimum distance between objects to trigger ODE occurrence
-         */
-        uint m_minimum;
-        
-        /**
-         * @brief maximum distance between objects to trigger ODE occurrence
-         */
-        uint m_maximum;
-        
-        /**
-         * @brief the bounding box point to measure distance
-         */
-        uint m_testPoint;
-        
-        /**
-         * @brief the method to use to measure distance between objects.
-         */
-        uint m_testMethod;
+        bool CheckDistance(const OdeTriggerConfig& config, 
+            NvDsObjectMeta* pObjectMetaA, NvDsObjectMeta* pObjectMetaB);
     };
 
     class IntersectionOdeTrigger : public ABOdeTrigger
@@ -1889,7 +2240,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
     
         /**
@@ -1899,7 +2250,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaBuilder& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
     };
 
@@ -25,7 +25,9 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslPadProbeHandler.h"
 #include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
 #include "DslBintr.h"
+#include "DslDeadlineScheduler.h"
 #include <gst-nvevent.h>
 
 namespace DSL
@@ -194,8 +196,6 @@ namespace DSL
     GstPadProbeReturn SourceIdOffsetterPadProbeHandler::HandlePadData(
         GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-        
         if (!m_isEnabled)
         {
             return GST_PAD_PROBE_OK;
@@ -243,24 +243,20 @@ namespace DSL
     void FrameNumberAdderPadProbeBufferHandler::ResetFrameNumber()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
 
-        m_currentFrameNumber = 0;
+        m_currentFrameNumber.store(0, std::memory_order_relaxed);
     }
     
     uint64_t FrameNumberAdderPadProbeBufferHandler::GetFrameNumber()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
 
-        return m_currentFrameNumber;
+        return m_currentFrameNumber.load(std::memory_order_relaxed);
     }
 
     GstPadProbeReturn FrameNumberAdderPadProbeBufferHandler::HandlePadData(
         GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-        
         if (!m_isEnabled)
         {
             return GST_PAD_PROBE_OK;
@@ -278,7 +274,8 @@ namespace DSL
             if (pFrameMeta != NULL)
             {
                 // Incremeant and add the frame number
-                pFrameMeta->frame_num = ++m_currentFrameNumber;
+                pFrameMeta->frame_num = m_currentFrameNumber.fetch_add(1, 
+                    std::memory_order_relaxed) + 1;
             }
         }
         return GST_PAD_PROBE_OK;
@@ -289,7 +286,15 @@ namespace DSL
     OdePadProbeHandler::OdePadProbeHandler(const char* name)
         : PadProbeBufferHandler(name)
         , m_nextTriggerIndex(0)
-        , m_displayMetaAllocSize(1)
+        , m_displayMetaAllocSize(DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED)
+        , m_parallelEnabled(false)
+        , m_numWorkers(0)
+        , m_completedFrames(0)
+        , m_nextBatchFrame(0)
+        , m_statsEnabled(false)
+        , m_frameBudget(0)
+        , m_budgetOverrunHandler(NULL)
+        , m_budgetOverrunClientData(NULL)
     {
         LOG_FUNC();
         
@@ -303,6 +308,9 @@ namespace DSL
     OdePadProbeHandler::~OdePadProbeHandler()
     {
         LOG_FUNC();
+        
+        // Triggers must be removed from the stats before they are destroyed.
+        RemoveAllChildren();
     }
 
     bool OdePadProbeHandler::AddChild(DSL_BASE_PTR pChild)
@@ -321,6 +329,9 @@ namespace DSL
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextTriggerIndex] = pChild;
         
+        // Resolve the stats the Trigger and its Actions record to once, now.
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->SetParentStats(&m_stats);
+        
         return true;
     }
 
@@ -337,6 +348,8 @@ namespace DSL
         // Remove the the child from Indexed map
         m_pChildrenIndexed.erase(pChild->GetIndex());
         
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->SetParentStats(NULL);
+        
         return true;
     }
 
@@ -348,6 +361,11 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
         // Remove all children from Indexed map
+        for (auto const& imap: m_pChildrenIndexed)
+        {
+            std::dynamic_pointer_cast<OdeTrigger>(
+                imap.second)->SetParentStats(NULL);
+        }
         m_pChildrenIndexed.clear();
     }
 
@@ -366,6 +384,108 @@ namespace DSL
         m_displayMetaAllocSize = size;
     }
     
+    void OdePadProbeHandler::GetParallelMode(bool* enabled, uint* numWorkers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        *enabled = m_parallelEnabled;
+        *numWorkers = m_numWorkers;
+    }
+    
+    void OdePadProbeHandler::SetParallelMode(bool enabled, uint numWorkers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        if (!numWorkers)
+        {
+            // The streaming thread participates as an additional worker
+            numWorkers = std::max(1, (int)g_get_num_processors()-1);
+        }
+        m_parallelEnabled = enabled;
+        m_numWorkers = numWorkers;
+        
+        // Worker threads are only kept alive while parallel mode is enabled.
+        if (!m_parallelEnabled)
+        {
+            m_pWorkerPool = nullptr;
+        }
+        else if (!m_pWorkerPool or m_pWorkerPool->GetNumWorkers() != m_numWorkers)
+        {
+            m_pWorkerPool = nullptr;
+            m_pWorkerPool = DSL_WORK_STEALING_POOL_NEW(m_numWorkers);
+        }
+        LOG_INFO("ODE Pad Probe Handler '" << GetName() 
+            << "' parallel mode = " << m_parallelEnabled 
+            << " with " << m_numWorkers << " workers");
+    }
+    
+    bool OdePadProbeHandler::GetStatsEnabled()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        return m_statsEnabled;
+    }
+    
+    void OdePadProbeHandler::SetStatsEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        // calibrate the cycle counter, if not done already, from the 
+        // client's thread.
+        CycleCounter::GetNanosecondsPerCycle();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        m_statsEnabled = enabled;
+    }
+    
+    bool OdePadProbeHandler::GetStats(const char* name, uint phase, 
+        dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        
+        return m_stats.GetStats(name, phase, stats);
+    }
+    
+    void OdePadProbeHandler::GetFrameStats(dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        
+        m_stats.GetFrameStats(stats);
+    }
+    
+    void OdePadProbeHandler::ClearStats()
+    {
+        LOG_FUNC();
+        
+        m_stats.Clear();
+    }
+    
+    uint OdePadProbeHandler::GetFrameBudget()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        return m_frameBudget;
+    }
+    
+    void OdePadProbeHandler::SetFrameBudget(uint budget, 
+        dsl_pph_ode_budget_overrun_handler_cb handler, void* clientData)
+    {
+        LOG_FUNC();
+        
+        CycleCounter::GetNanosecondsPerCycle();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        m_frameBudget = budget;
+        m_budgetOverrunHandler = handler;
+        m_budgetOverrunClientData = clientData;
+    }
+    
     GstPadProbeReturn OdePadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
@@ -378,6 +498,25 @@ namespace DSL
         
         NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
         
+        // Scratch data for the batch is allocated from the frame arena,
+        // which is reset once the batch has been processed.
+        FrameArenaScope frameArenaScope(&m_frameArena, true);
+        
+        // Actions record their latency to the stats installed for the
+        // thread, if enabled.
+        OdeStats* pStats = (m_statsEnabled) ? &m_stats : NULL;
+        OdeStatsScope odeStatsScope(pStats);
+        bool timeFrames = (m_statsEnabled or m_frameBudget);
+        
+        if (m_parallelEnabled)
+        {
+            HandleBatchInParallel(pBuffer, pBatchMeta);
+            return GST_PAD_PROBE_OK;
+        }
+        
+        // Each trigger's config and source state are loaded once per frame.
+        m_frameSnapshots.resize(m_pChildrenIndexed.size());
+        
         // For each frame in the batched meta data
         for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
             pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
@@ -386,22 +525,26 @@ namespace DSL
             NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
             if (pFrameMeta != NULL)
             {
-                std::vector<NvDsDisplayMeta*> displayMetaData;
-                displayMetaData.reserve(m_displayMetaAllocSize);
+                uint64_t frameStart = (timeFrames) ? CycleCounter::Now() : 0;
+                
+                // Display meta for this frame is only acquired once a
+                // Trigger/Action(s) adds an element that needs it.
+                DisplayMetaBuilder displayMetaData(pBatchMeta, 
+                    m_displayMetaAllocSize);
                 
-                for (auto i=0; i<m_displayMetaAllocSize; i++)
-                {
-                    // Acquire new Display meta for this frame, with each 
-                    // Trigger/Action(s) adding meta as needed.
-                    NvDsDisplayMeta* pDisplayMeta = 
-                        nvds_acquire_display_meta_from_pool(pBatchMeta);
-                    displayMetaData.push_back(pDisplayMeta);
-                }
                 // Preprocess the frame
+                uint triggerIndex(0);
                 for (const auto &imap: m_pChildrenIndexed)
                 {
                     DSL_ODE_TRIGGER_PTR pOdeTrigger = 
                         std::dynamic_pointer_cast<OdeTrigger>(imap.second);
+                    OdeStatsTimer statsTimer(pStats, pOdeTrigger.get(),
+                        DSL_PPH_ODE_STATS_PHASE_PRE_PROCESS);
+                    OdeTriggerFrameSnapshot& frameSnapshot = 
+                        m_frameSnapshots[triggerIndex++];
+                    pOdeTrigger->LoadFrameSnapshot(frameSnapshot, 
+                        pFrameMeta->source_id);
+                    OdeTriggerFrameScope frameScope(&frameSnapshot);
                     pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
                 }
 
@@ -418,14 +561,20 @@ namespace DSL
                     pNextMeta = pNextMeta->next;
 
                     // For each ODE Trigger owned by this ODE Manager, check for ODE
+                    triggerIndex = 0;
                     for (const auto &imap: m_pChildrenIndexed)
                     {
+                        OdeTriggerFrameScope frameScope(
+                            &m_frameSnapshots[triggerIndex++]);
+                        
                         // check for valid object meta as it may have be nulled by
                         // a trigger with a remove action
                         if (pObjectMeta != NULL)
                         {
                             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
                                 std::dynamic_pointer_cast<OdeTrigger>(imap.second);
+                            OdeStatsTimer statsTimer(pStats, pOdeTrigger.get(),
+                                DSL_PPH_ODE_STATS_PHASE_CHECK);
                             try
                             {
                                 pOdeTrigger->CheckForOccurrence(pBuffer, 
@@ -443,23 +592,325 @@ namespace DSL
                 // After each detected object is checked for ODE individually, post 
                 // process each frame for Absence events, Limit events, etc. (i.e. frame 
                 // level events).
+                triggerIndex = 0;
                 for (const auto &imap: m_pChildrenIndexed)
                 {
                     DSL_ODE_TRIGGER_PTR pOdeTrigger = 
                         std::dynamic_pointer_cast<OdeTrigger>(imap.second);
+                    OdeStatsTimer statsTimer(pStats, pOdeTrigger.get(),
+                        DSL_PPH_ODE_STATS_PHASE_POST_PROCESS);
+                    OdeTriggerFrameScope frameScope(
+                        &m_frameSnapshots[triggerIndex++]);
                     pOdeTrigger->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
                 }
                 
-                for (const auto & ivec: displayMetaData)
+                // Add the display meta used, if any, to the frame
+                displayMetaData.AddToFrame(pFrameMeta);
+                
+                if (timeFrames)
                 {
-                    // Add the updated display data to the frame
-                    nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+                    HandleFrameTime(pFrameMeta, CycleCounter::Now() - frameStart);
                 }
             }
         }
         return GST_PAD_PROBE_OK;
     }
 
+    void OdePadProbeHandler::HandleBatchInParallel(GstBuffer* pBuffer, 
+        NvDsBatchMeta* pBatchMeta)
+    {
+        m_batchTriggers.clear();
+        m_batchTriggersSharded.clear();
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            m_batchTriggers.push_back(imap.second);
+            m_batchTriggersSharded.push_back(
+                std::dynamic_pointer_cast<OdeTrigger>(imap.second)->
+                    IsSourceSharded());
+        }
+        m_batchFrames.clear();
+        m_batchDisplayMeta.clear();
+        m_precedingFrames.clear();
+        m_precedingSourceFrames.clear();
+        
+        // Collect the frames, each with a Display Meta builder that acquires
+        // its meta from the pool once first needed.
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+            if (pFrameMeta != NULL)
+            {
+                m_batchDisplayMeta.push_back(
+                    DisplayMetaBuilder(pBatchMeta, m_displayMetaAllocSize));
+                
+                // Triggers that shard their state by source only need to wait
+                // on the preceding frame from the same source. All others
+                // must wait on the frame before it, trigger by trigger.
+                int precedingSourceFrame(-1);
+                for (int i = (int)m_batchFrames.size()-1; i >= 0; i--)
+                {
+                    if (m_batchFrames[i]->source_id == pFrameMeta->source_id)
+                    {
+                        precedingSourceFrame = i;
+                        break;
+                    }
+                }
+                m_precedingFrames.push_back((int)m_batchFrames.size()-1);
+                m_precedingSourceFrames.push_back(precedingSourceFrame);
+                m_batchFrames.push_back(pFrameMeta);
+            }
+        }
+        m_frameTickets.assign(m_batchFrames.size(), 0);
+        m_batchFrameCycles.assign(m_batchFrames.size(), 0);
+        m_batchFrameSnapshots.resize(
+            m_batchFrames.size()*m_batchTriggers.size());
+        m_completedFrames = 0;
+        m_nextBatchFrame = 0;
+        
+        // One task per frame. Each task claims the next frame in batch order
+        // - not a fixed frame - so the earliest unfinished frame is always
+        // being processed, whichever queue its task was stolen from.
+        std::vector<WorkStealingPool::Task> tasks;
+        GstObject* pMainContextOwner = MainContextSource::GetCurrentOwner();
+        for (uint i = 0; i < m_batchFrames.size(); i++)
+        {
+            tasks.push_back([this, pBuffer, pMainContextOwner]()
+            {
+                // Deferred work added by workers goes to the caller's context.
+                MainContextScope mainContextScope(pMainContextOwner);
+                HandleFrameInParallel(pBuffer, m_nextBatchFrame++);
+            });
+        }
+        m_pWorkerPool->Run(tasks);
+        
+        // Add the Display Meta to each frame in batch order.
+        for (uint i = 0; i < m_batchFrames.size(); i++)
+        {
+            m_batchDisplayMeta[i].AddToFrame(m_batchFrames[i]);
+        }
+        // Frame times are handled on the streaming thread so that the 
+        // client's budget-overrun handler is never called by a worker.
+        if (m_statsEnabled or m_frameBudget)
+        {
+            for (uint i = 0; i < m_batchFrames.size(); i++)
+            {
+                HandleFrameTime(m_batchFrames[i], m_batchFrameCycles[i]);
+            }
+        }
+        // Release the builders before the frame arena is reset.
+        m_batchDisplayMeta.clear();
+    }
+
+    /**
+     * @class OdeFrameActionGate
+     * @brief Action gate for a frame evaluated in parallel. The first Action
+     * invoked for the frame waits until all preceding frames of the batch 
+     * have been fully processed, so that Actions are invoked in the same 
+     * order as serial evaluation while criteria are checked in parallel.
+     */
+    class OdeFrameActionGate : public OdeActionGate
+    {
+    public:
+    
+        OdeFrameActionGate(OdePadProbeHandler* pHandler, uint frameIndex)
+            : m_pHandler(pHandler)
+            , m_frameIndex(frameIndex)
+            , m_entered(false)
+        {};
+        
+        void Enter()
+        {
+            if (!m_entered)
+            {
+                m_pHandler->WaitForActionTicket(m_frameIndex);
+                m_entered = true;
+            }
+        };
+        
+    private:
+    
+        OdePadProbeHandler* m_pHandler;
+        uint m_frameIndex;
+        
+        /**
+         * @brief true once all preceding frames have been processed.
+         */
+        bool m_entered;
+    };
+
+    void OdePadProbeHandler::HandleFrameInParallel(GstBuffer* pBuffer, 
+        uint frameIndex)
+    {
+        // Worker threads allocate from the same frame arena as the caller,
+        // and record to the same stats.
+        FrameArenaScope frameArenaScope(&m_frameArena);
+        OdeStats* pStats = (m_statsEnabled) ? &m_stats : NULL;
+        OdeStatsScope odeStatsScope(pStats);
+        
+        // Actions wait on the frames before them, in batch order.
+        OdeFrameActionGate actionGate(this, frameIndex);
+        OdeActionGateScope actionGateScope(&actionGate);
+        bool timeFrame = (m_statsEnabled or m_frameBudget);
+        uint64_t frameStart = (timeFrame) ? CycleCounter::Now() : 0;
+        
+        NvDsFrameMeta* pFrameMeta = m_batchFrames[frameIndex];
+        DisplayMetaBuilder& displayMetaData = 
+            m_batchDisplayMeta[frameIndex];
+        OdeTriggerFrameSnapshot* pFrameSnapshots = 
+            &m_batchFrameSnapshots[frameIndex*m_batchTriggers.size()];
+        
+        // Preprocess the frame, each trigger once it has finished with the
+        // preceding frame.
+        for (uint i = 0; i < m_batchTriggers.size(); i++)
+        {
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_batchTriggers[i]);
+            
+            WaitForFrameTicket(frameIndex, i);
+            OdeStatsTimer statsTimer(pStats, pOdeTrigger.get(),
+                DSL_PPH_ODE_STATS_PHASE_PRE_PROCESS);
+            OdeTriggerFrameScope frameScope(&pFrameSnapshots[i]);
+            try
+            {
+                pOdeTrigger->LoadFrameSnapshot(pFrameSnapshots[i], 
+                    pFrameMeta->source_id);
+                pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
+                    << "' threw exception");
+            }
+        }
+
+        NvDsMetaList* pNextMeta = pFrameMeta->obj_meta_list;
+        
+        // For each detected object in the frame.
+        while (pNextMeta != NULL)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pNextMeta->data);
+
+            // Advance now in case the object is removed by an action
+            pNextMeta = pNextMeta->next;
+
+            for (uint i = 0; i < m_batchTriggers.size(); i++)
+            {
+                if (pObjectMeta != NULL)
+                {
+                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                        std::dynamic_pointer_cast<OdeTrigger>(m_batchTriggers[i]);
+                    OdeStatsTimer statsTimer(pStats, pOdeTrigger.get(),
+                        DSL_PPH_ODE_STATS_PHASE_CHECK);
+                    OdeTriggerFrameScope frameScope(&pFrameSnapshots[i]);
+                    try
+                    {
+                        pOdeTrigger->CheckForOccurrence(pBuffer, 
+                            displayMetaData, pFrameMeta, pObjectMeta);
+                    }
+                    catch(...)
+                    {
+                        LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
+                            << "' threw exception");
+                    }
+                }
+            }
+        }
+        
+        // Post process the frame, releasing the next frame's ticket for 
+        // each trigger as soon as it is done.
+        for (uint i = 0; i < m_batchTriggers.size(); i++)
+        {
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_batchTriggers[i]);
+            {
+                OdeStatsTimer statsTimer(pStats, pOdeTrigger.get(),
+                    DSL_PPH_ODE_STATS_PHASE_POST_PROCESS);
+                OdeTriggerFrameScope frameScope(&pFrameSnapshots[i]);
+                try
+                {
+                    pOdeTrigger->PostProcessFrame(pBuffer, displayMetaData, 
+                        pFrameMeta);
+                }
+                catch(...)
+                {
+                    LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
+                        << "' threw exception");
+                }
+            }
+            ReleaseFrameTicket(frameIndex);
+        }
+        if (timeFrame)
+        {
+            m_batchFrameCycles[frameIndex] = CycleCounter::Now() - frameStart;
+        }
+    }
+    
+    void OdePadProbeHandler::WaitForFrameTicket(uint frameIndex, uint triggerIndex)
+    {
+        int precedingFrame = (m_batchTriggersSharded[triggerIndex])
+            ? m_precedingSourceFrames[frameIndex]
+            : m_precedingFrames[frameIndex];
+        if (precedingFrame < 0)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_frameTicketMutex);
+        while (m_frameTickets[precedingFrame] <= triggerIndex)
+        {
+            g_cond_wait(&m_frameTicketCond, &m_frameTicketMutex);
+        }
+    }
+    
+    void OdePadProbeHandler::ReleaseFrameTicket(uint frameIndex)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_frameTicketMutex);
+        m_frameTickets[frameIndex]++;
+        
+        // Advance past each leading frame now post-processed by all triggers.
+        while (m_completedFrames < m_frameTickets.size() and
+            m_frameTickets[m_completedFrames] == m_batchTriggers.size())
+        {
+            m_completedFrames++;
+        }
+        g_cond_broadcast(&m_frameTicketCond);
+    }
+    
+    void OdePadProbeHandler::WaitForActionTicket(uint frameIndex)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_frameTicketMutex);
+        while (m_completedFrames < frameIndex)
+        {
+            g_cond_wait(&m_frameTicketCond, &m_frameTicketMutex);
+        }
+    }
+
+    void OdePadProbeHandler::HandleFrameTime(NvDsFrameMeta* pFrameMeta, 
+        uint64_t cycles)
+    {
+        uint64_t nanoseconds = CycleCounter::ToNanoseconds(cycles);
+        
+        if (m_statsEnabled)
+        {
+            m_stats.RecordFrame(nanoseconds);
+        }
+        if (m_frameBudget and m_budgetOverrunHandler and
+            nanoseconds/1000 > m_frameBudget)
+        {
+            try
+            {
+                m_budgetOverrunHandler(pFrameMeta->source_id, 
+                    pFrameMeta->frame_num, nanoseconds/1000, m_frameBudget,
+                    m_budgetOverrunClientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("ODE Pad Probe Handler '" << GetName() 
+                    << "' threw exception calling client budget-overrun handler");
+            }
+        }
+    }
+
     //--------------------------------------------------------------------------------
 
     CustomPadProbeHandler::CustomPadProbeHandler(const char* name, 
@@ -484,7 +935,6 @@ namespace DSL
     
     GstPadProbeReturn CustomPadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         if (!m_isEnabled)
         {
             return GST_PAD_PROBE_OK;
@@ -509,9 +959,11 @@ namespace DSL
         uint interval, dsl_pph_meter_client_handler_cb clientHandler, void* clientData)
         : PadProbeBufferHandler(name)
         , m_interval(interval)
+        , m_timerStarted(false)
+        , m_stallThreshold((uint64_t)DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS*1000000)
         , m_clientHandler(clientHandler)
+        , m_statsHandler(NULL)
         , m_clientData(clientData)
-        , m_timerId(0)
     {
         LOG_FUNC();
 
@@ -522,15 +974,31 @@ namespace DSL
         }
     }
 
-    MeterPadProbeHandler::~MeterPadProbeHandler()
+    MeterPadProbeHandler::MeterPadProbeHandler(const char* name, 
+        uint interval, dsl_pph_meter_stats_handler_cb statsHandler, void* clientData)
+        : PadProbeBufferHandler(name)
+        , m_interval(interval)
+        , m_timerStarted(false)
+        , m_stallThreshold((uint64_t)DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS*1000000)
+        , m_clientHandler(NULL)
+        , m_statsHandler(statsHandler)
+        , m_clientData(clientData)
     {
         LOG_FUNC();
 
-        if (m_timerId)
+        // Enable now
+        if (!SetEnabled(true))
         {
-            g_source_remove(m_timerId);
+            throw;
         }
     }
+
+    MeterPadProbeHandler::~MeterPadProbeHandler()
+    {
+        LOG_FUNC();
+
+        m_timer.Remove();
+    }
     
     bool MeterPadProbeHandler::SetEnabled(bool enabled)
     {
@@ -551,24 +1019,20 @@ namespace DSL
                 << GetName() << "'");
 
             // if have Source Meters, i.e we are currently linked, reset each.
-            for (auto const &imap: m_sourceMeters)
+            for (auto const &ivec: m_sourceMeters)
             {
-                imap.second->SessionReset();
-                imap.second->IntervalReset();
+                if (ivec)
+                {
+                    ivec->SessionReset();
+                }
             }
-
             return true;
         }
         LOG_INFO("Disabling performance measurements for MeterPadProbeHandler '" 
             << GetName() << "'");
         
-        if (m_timerId and !g_source_remove(m_timerId))
-        {
-            LOG_ERROR("Interval-timer shutdown failed for MeterPadProbeHandler '" 
-                << GetName() << "' ");
-            return false;
-        }
-        m_timerId = 0;
+        m_timer.Remove();
+        m_timerStarted.store(false, std::memory_order_relaxed);
         
         return true;
     }
@@ -596,11 +1060,24 @@ namespace DSL
         return true;
     }
 
-    GstPadProbeReturn MeterPadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
+    uint MeterPadProbeHandler::GetStallThreshold()
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        LOG_FUNC();
+        
+        return m_stallThreshold.load(std::memory_order_relaxed)/1000000;
+    }
+    
+    void MeterPadProbeHandler::SetStallThreshold(uint threshold)
+    {
+        LOG_FUNC();
+        
+        m_stallThreshold.store((uint64_t)threshold*1000000, 
+            std::memory_order_relaxed);
+    }
 
-        if (!m_isEnabled)
+    GstPadProbeReturn MeterPadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
+    {
+        if (!m_isEnabled.load(std::memory_order_relaxed))
         {
             return GST_PAD_PROBE_OK;
         }
@@ -609,28 +1086,47 @@ namespace DSL
         NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
 
         // Don't start the report timer until we get the first buffer
-        if (!m_timerId)
+        if (!m_timerStarted.load(std::memory_order_relaxed))
         {    
-            LOG_INFO("Setting interval timer to " << m_interval*1000);
-            m_timerId = g_timeout_add(m_interval*1000, 
-                MeterIntervalTimeoutHandler, this);
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+            
+            if (m_isEnabled and !m_timer)
+            {
+                LOG_INFO("Setting interval timer to " << m_interval*1000);
+                m_timer.AddTimeout(NULL, m_interval*1000, 
+                    MeterIntervalTimeoutHandler, this);
+            }
+            m_timerStarted.store(true, std::memory_order_relaxed);
+        }
+        if (!pBatchMeta)
+        {
+            return GST_PAD_PROBE_OK;
         }
         try
         {
+            // single timestamp for all frames in the batch.
+            uint64_t now = SourceMeter::Now();
+            uint64_t stallThreshold = 
+                m_stallThreshold.load(std::memory_order_relaxed);
+            
             for (NvDsMetaList* pFrame = pBatchMeta->frame_meta_list; pFrame; 
                 pFrame = pFrame->next)
             {
                 NvDsFrameMeta *pFrameMeta = (NvDsFrameMeta*) pFrame->data;
-                if (m_sourceMeters.find(pFrameMeta->pad_index) == m_sourceMeters.end())
+                uint padIndex = pFrameMeta->pad_index;
+                
+                if (padIndex >= m_sourceMeters.size() or !m_sourceMeters[padIndex])
                 {
-                    m_sourceMeters[pFrameMeta->pad_index] = DSL_SOURCE_METER_NEW(
-                        pFrameMeta->pad_index);
+                    LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+                    
+                    if (padIndex >= m_sourceMeters.size())
+                    {
+                        m_sourceMeters.resize(padIndex+1);
+                    }
+                    m_sourceMeters[padIndex] = DSL_SOURCE_METER_NEW(padIndex);
                 }
-
-                m_sourceMeters[pFrameMeta->pad_index]->Timestamp();
-                // increment the frame counters, calculations will be made based on 
-                // last timestamp and frame counts.
-                m_sourceMeters[pFrameMeta->pad_index]->IncrementFrameCounts();
+                m_sourceMeters[padIndex]->Update(now, 
+                    pFrameMeta->frame_num, stallThreshold);
             }
         }
         catch(...)
@@ -648,21 +1144,36 @@ namespace DSL
         
         // TODO Handle dewarper serfaces
         
-        std::vector<double> sessionAverages;
-        std::vector<double> intervalAverages;
+        std::vector<dsl_meter_source_stats> sourceStats;
 
-        for (auto const &imap: m_sourceMeters)
+        for (auto const &ivec: m_sourceMeters)
         {
-            sessionAverages.push_back(imap.second->GetSessionFpsAvg());
-            intervalAverages.push_back(imap.second->GetIntervalFpsAvg());
-
-            imap.second->IntervalReset();
+            if (ivec)
+            {
+                dsl_meter_source_stats stats;
+                ivec->GetStats(&stats);
+                sourceStats.push_back(stats);
+            }
         }
         
         try
         {
-            return m_clientHandler((double*)&sessionAverages[0], 
-                (double*)&intervalAverages[0], (uint)m_sourceMeters.size(), 
+            if (m_statsHandler)
+            {
+                return m_statsHandler(sourceStats.data(), 
+                    (uint)sourceStats.size(), m_clientData);
+            }
+            
+            std::vector<double> sessionAverages;
+            std::vector<double> intervalAverages;
+
+            for (auto const &ivec: sourceStats)
+            {
+                sessionAverages.push_back(ivec.session_fps_avg);
+                intervalAverages.push_back(ivec.interval_fps_avg);
+            }
+            return m_clientHandler(sessionAverages.data(), 
+                intervalAverages.data(), (uint)sourceStats.size(), 
                 m_clientData);
         }
         catch(...)
@@ -701,31 +1212,37 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void TimestampPadProbeHandler::GetTime(struct timeval& timestamp)
+    uint64_t TimestampPadProbeHandler::GetTimestamp()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-        timestamp = m_timestamp;
+        
+        return m_timestamp.load(std::memory_order_acquire);
     }
     
-    void TimestampPadProbeHandler::SetTime(struct timeval& timestamp)
+    void TimestampPadProbeHandler::SetTimestamp(uint64_t timestamp)
+    {
+        LOG_FUNC();
+        
+        m_timestamp.store(timestamp, std::memory_order_release);
+    }
+    
+    const std::atomic<uint64_t>* TimestampPadProbeHandler::GetTimestampPtr()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
-        m_timestamp = timestamp;
+        return &m_timestamp;
     }
     
     GstPadProbeReturn TimestampPadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-
-        if (!m_isEnabled)
+        if (!m_isEnabled.load(std::memory_order_relaxed))
         {
             return GST_PAD_PROBE_OK;
         }
         
-        gettimeofday(&m_timestamp, NULL);
+        // Single store on the streaming thread. Timeouts are evaluated by the
+        // DeadlineScheduler only when a deadline expires.
+        m_timestamp.store(DeadlineScheduler::Now(), std::memory_order_release);
         return GST_PAD_PROBE_OK;
     }
 
@@ -762,7 +1279,7 @@ namespace DSL
         if (m_bufferTimerId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-            g_source_remove(m_bufferTimerId);
+            DeadlineScheduler::GetScheduler()->RemoveWatch(m_bufferTimerId);
         }
     }
     
@@ -777,14 +1294,16 @@ namespace DSL
 
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
 
-        if (m_isEnabled)
+        if (m_isEnabled and !m_bufferTimerId)
         {
-            m_bufferTimerId = g_timeout_add(10, 
-                buffer_timer_cb, this);
+            // The Handler is not bound to a Pipeline when enabled, so its
+            // timeouts are called on the default main-context.
+            m_bufferTimerId = DeadlineScheduler::GetScheduler()->AddWatch(
+                GetTimestampPtr(), m_timeout*1000, buffer_timer_cb, this, NULL);
         }
-        else if (m_bufferTimerId)
+        else if (!m_isEnabled and m_bufferTimerId)
         {
-            g_source_remove(m_bufferTimerId);
+            DeadlineScheduler::GetScheduler()->RemoveWatch(m_bufferTimerId);
             m_bufferTimerId = 0;
         }
         return true;
@@ -804,41 +1323,25 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
         m_timeout = timeout;
+        if (m_bufferTimerId)
+        {
+            DeadlineScheduler::GetScheduler()->SetWatchTimeout(m_bufferTimerId,
+                m_timeout*1000);
+        }
     }
     
     int BufferTimeoutPadProbeHandler::TimerHanlder()
     {
-        // Note - wait to lock the mutex as GetTime will lock it.
-        
-        // Get the last buffer time. This timer callback will not be called
-        // until after the timer is started on main-loop run after play 
-        // therefore the lastBufferTime should be non-zero once the first
-        // buffer is received
-        struct timeval lastBufferTime;
-        GetTime(lastBufferTime);
-
-        // Now ok to lock
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
 
-        struct timeval currentTime;
-        gettimeofday(&currentTime, NULL);
-
-        if (lastBufferTime.tv_sec == 0)
+        // Called by the DeadlineScheduler only once the timeout has elapsed
+        // since the later of the last buffer and the watch being armed.
+        if (!GetTimestamp())
         {
             LOG_DEBUG("Waiting for first buffer before checking for timeout \
 for Buffer Timer PPH '" << GetName() << "'");
             return true;
         }
-
-        double timeSinceLastBufferMs = 
-            1000.0*(currentTime.tv_sec - lastBufferTime.tv_sec) + 
-            (currentTime.tv_usec - lastBufferTime.tv_usec) / 1000.0;
-
-        if (timeSinceLastBufferMs < (double)m_timeout*1000)
-        {
-            // Timeout has not been exceeded, so return true to sleep again
-            return true;
-        }
         LOG_INFO("Buffer timeout of " << m_timeout << " seconds exceeded for PPH '" 
             << GetName() << "'");
 
@@ -857,7 +1360,7 @@ for Buffer Timer PPH '" << GetName() << "'");
         m_bufferTimerId = 0;
         m_isEnabled = false;
 
-        // return false to stop the timer.
+        // return false to remove the deadline watch.
         return false;
     }
 
@@ -892,8 +1395,6 @@ for Buffer Timer PPH '" << GetName() << "'");
     GstPadProbeReturn StreamEventPadProbeEventHandler::HandlePadData(
         GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-
         if (!m_isEnabled)
         {
             return GST_PAD_PROBE_OK;
@@ -966,8 +1467,6 @@ for Buffer Timer PPH '" << GetName() << "'");
     GstPadProbeReturn EosConsumerPadProbeEventHandler::HandlePadData(
         GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-
         if (!m_isEnabled)
         {
             return GST_PAD_PROBE_OK;
@@ -1043,6 +1542,8 @@ for Buffer Timer PPH '" << GetName() << "'");
         , m_padProbeType(padProbeType)
         , m_pStaticPad(NULL)
         , m_nextHanlderIndex(0)
+        , m_pHandlerChain(NULL)
+        , m_chainReaders(0)
     {
         LOG_FUNC();
     }
@@ -1063,6 +1564,11 @@ for Buffer Timer PPH '" << GetName() << "'");
             }
             gst_object_unref(m_pStaticPad);
         }
+        for (auto const& ivec: m_retiredHandlerChains)
+        {
+            delete ivec;
+        }
+        delete m_pHandlerChain.load();
     }
 
     bool PadProbetr::AddPadProbeHandler(DSL_BASE_PTR pPadProbeHandler)
@@ -1104,6 +1610,8 @@ for Buffer Timer PPH '" << GetName() << "'");
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextHanlderIndex] = pPadProbeHandler;
         
+        publishHandlerChain();
+        
         return true;
         
     }
@@ -1125,8 +1633,46 @@ for Buffer Timer PPH '" << GetName() << "'");
             return false;
         }
         m_pChildrenIndexed.erase(pPadProbeHandler->GetIndex());
+        
+        publishHandlerChain();
+        
         return true;
     }
+    
+    void PadProbetr::publishHandlerChain()
+    {
+        LOG_FUNC();
+        
+        // Handlers are cast once here rather than on every buffer.
+        std::vector<DSL_PPH_PTR> handlers;
+        for (auto const& imap: m_pChildrenIndexed)
+        {
+            handlers.push_back(
+                std::dynamic_pointer_cast<PadProbeHandler>(imap.second));
+        }
+        PadProbeHandlerChain* pNewChain = (handlers.size())
+            ? new PadProbeHandlerChain(std::move(handlers))
+            : NULL;
+        
+        PadProbeHandlerChain* pOldChain = 
+            m_pHandlerChain.exchange(pNewChain, std::memory_order_seq_cst);
+        if (pOldChain)
+        {
+            m_retiredHandlerChains.push_back(pOldChain);
+        }
+        
+        // A streaming thread that increments the reader count after this 
+        // point will load the new chain, so with no readers all retired
+        // chains can be freed.
+        if (m_chainReaders.load(std::memory_order_seq_cst) == 0)
+        {
+            for (auto const& ivec: m_retiredHandlerChains)
+            {
+                delete ivec;
+            }
+            m_retiredHandlerChains.clear();
+        }
+    }
 
     //--------------------------------------------------------------------------------
 
@@ -1145,61 +1691,70 @@ for Buffer Timer PPH '" << GetName() << "'");
     GstPadProbeReturn PadBufferProbetr::HandlePadProbe(GstPad* pPad, 
         GstPadProbeInfo* pInfo)
     {
-        if ((pInfo->type & GST_PAD_PROBE_TYPE_BUFFER))
+        if (!(pInfo->type & GST_PAD_PROBE_TYPE_BUFFER))
         {
-            // list of Pad Probe Handler names that need removal after processing.
-            std::vector <DSL_PPH_PTR> removalList;
-            {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
+            return GST_PAD_PROBE_OK;
+        }
+        if (!(GstBuffer*)pInfo->data)
+        {
+            LOG_WARN("Unable to get data buffer for PadProbetr '" 
+                << m_name << "'");
+            return GST_PAD_PROBE_OK;
+        }
+        
+        // list of Pad Probe Handlers that need removal after processing,
+        // only allocated when a Handler requests removal.
+        std::vector <DSL_PPH_PTR> removalList;
         
-                if (!(GstBuffer*)pInfo->data)
+        PadProbeHandlerChain* pChain = acquireHandlerChain();
+        if (pChain)
+        {
+            for (uint i = 0; i < pChain->pHandlers.size(); i++)
+            {
+                if (pChain->pRemoved[i].load(std::memory_order_relaxed))
                 {
-                    LOG_WARN("Unable to get data buffer for PadProbetr '" 
-                        << m_name << "'");
-                    return GST_PAD_PROBE_OK;
+                    continue;
                 }
-            
-                for (auto const& imap: m_pChildrenIndexed)
+                PadProbeHandler* pPadProbeHandler = pChain->pHandlers[i].get();
+                
+                GstPadProbeReturn retval;
+                try
                 {
-                    DSL_PPH_PTR pPadProbeHandler = 
-                        std::dynamic_pointer_cast<PadProbeHandler>(imap.second);
-                    
-                    GstPadProbeReturn retval;
-                    try
-                    {
-                        retval = pPadProbeHandler->HandlePadData(pInfo);
-                    }
-                    catch(...)
-                    {
-                        LOG_ERROR("Exception calling Pad Probe Handler '" 
-                            << pPadProbeHandler->GetName() 
-                            << "' removing from PadProbetr '" 
-                            << GetName() << "'");
-                        removalList.push_back(pPadProbeHandler);
-                    }
-                    if (retval > DSL_PAD_PROBE_REMOVE)
-                    {
-                        LOG_ERROR("Invalid return from Pad Probe Handler '"
-                            << pPadProbeHandler->GetName() 
-                            << "' removing from PadProbetr '" 
-                            << GetName() << "'");
-                        removalList.push_back(pPadProbeHandler);
-                    }
-                    if (retval == GST_PAD_PROBE_REMOVE)
-                    {
-                        LOG_INFO("Removing Pad Probe Handler '"
-                            << pPadProbeHandler->GetName() 
-                            << "' from PadProbetr '" 
-                            << GetName() << "'");
-                        removalList.push_back(pPadProbeHandler);
-                    }
+                    retval = pPadProbeHandler->HandlePadData(pInfo);
+                }
+                catch(...)
+                {
+                    LOG_ERROR("Exception calling Pad Probe Handler '" 
+                        << pPadProbeHandler->GetName() 
+                        << "' removing from PadProbetr '" 
+                        << GetName() << "'");
+                    retval = GST_PAD_PROBE_REMOVE;
+                }
+                if (retval > DSL_PAD_PROBE_REMOVE)
+                {
+                    LOG_ERROR("Invalid return from Pad Probe Handler '"
+                        << pPadProbeHandler->GetName() 
+                        << "' removing from PadProbetr '" 
+                        << GetName() << "'");
+                    retval = GST_PAD_PROBE_REMOVE;
+                }
+                if (retval == GST_PAD_PROBE_REMOVE and 
+                    flagHandlerForRemoval(pChain, i))
+                {
+                    LOG_INFO("Removing Pad Probe Handler '"
+                        << pPadProbeHandler->GetName() 
+                        << "' from PadProbetr '" 
+                        << GetName() << "'");
+                    removalList.push_back(pChain->pHandlers[i]);
                 }
-            }
-            for (auto const& ivec: removalList)
-            {
-                RemovePadProbeHandler(ivec);
             }
         }
+        releaseHandlerChain();
+        
+        for (auto const& ivec: removalList)
+        {
+            RemovePadProbeHandler(ivec);
+        }
         return GST_PAD_PROBE_OK;
     }
     
@@ -1221,59 +1776,75 @@ for Buffer Timer PPH '" << GetName() << "'");
     GstPadProbeReturn PadEventDownStreamProbetr::HandlePadProbe(GstPad* pPad, 
         GstPadProbeInfo* pInfo)   
     {
-        if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM)
+        if (!(pInfo->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM))
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        if (!(GstEvent*)pInfo->data)
         {
-            // list of Pad Probe Handler names that need removal after processing.
-            std::vector <DSL_PPH_PTR> removalList;
+            LOG_WARN("Unable to get event for PadProbetr '" << m_name << "'");
+            return GST_PAD_PROBE_OK;
+        }
+        
+        // list of Pad Probe Handlers that need removal after processing.
+        std::vector <DSL_PPH_PTR> removalList;
+        GstPadProbeReturn probeRetval(GST_PAD_PROBE_OK);
+        
+        PadProbeHandlerChain* pChain = acquireHandlerChain();
+        if (pChain)
+        {
+            for (uint i = 0; i < pChain->pHandlers.size(); i++)
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
-                if (!(GstEvent*)pInfo->data)
+                if (pChain->pRemoved[i].load(std::memory_order_relaxed))
                 {
-                    LOG_WARN("Unable to get event for PadProbetr '" << m_name << "'");
-                    return GST_PAD_PROBE_OK;
+                    continue;
                 }
+                PadProbeHandler* pPadProbeHandler = pChain->pHandlers[i].get();
                 
-                for (auto const& imap: m_pChildrenIndexed)
+                GstPadProbeReturn retval;
+                try
                 {
-                    DSL_PPH_PTR pPadProbeHandler = 
-                        std::dynamic_pointer_cast<PadProbeHandler>(imap.second);
-                    try
-                    {
-                        GstPadProbeReturn retval = 
-                            pPadProbeHandler->HandlePadData(pInfo);
-                        if (retval == GST_PAD_PROBE_REMOVE)
-                        {
-                            LOG_INFO("Removing Pad Probe Handler '"
-                                << pPadProbeHandler->GetName() 
-                                << "' from PadProbetr '" 
-                                << GetName() << "'");
-                            removalList.push_back(pPadProbeHandler);
-                        }
-                        else if (retval == GST_PAD_PROBE_DROP)
-                        {
-                            return retval;
-                        }
-                    }
-                    catch(...)
+                    retval = pPadProbeHandler->HandlePadData(pInfo);
+                }
+                catch(...)
+                {
+                    retval = GST_PAD_PROBE_REMOVE;
+                }
+                if (retval == GST_PAD_PROBE_REMOVE)
+                {
+                    if (flagHandlerForRemoval(pChain, i))
                     {
-                        LOG_INFO("Removing Pad Probe Handler for PadProbetr '" 
-                            << m_name << "'");
-                        removalList.push_back(pPadProbeHandler);
+                        LOG_INFO("Removing Pad Probe Handler '"
+                            << pPadProbeHandler->GetName() 
+                            << "' from PadProbetr '" 
+                            << GetName() << "'");
+                        removalList.push_back(pChain->pHandlers[i]);
                     }
                 }
-            }
-            for (auto const& ivec: removalList)
-            {
-                RemovePadProbeHandler(ivec);
+                else if (retval == GST_PAD_PROBE_DROP)
+                {
+                    probeRetval = retval;
+                    break;
+                }
             }
         }
-        return GST_PAD_PROBE_OK;        
+        releaseHandlerChain();
+        
+        for (auto const& ivec: removalList)
+        {
+            RemovePadProbeHandler(ivec);
+        }
+        return probeRetval;        
     }
 
     //--------------------------------------------------------------------------------
     static GstPadProbeReturn PadProbeCB(GstPad* pPad, 
         GstPadProbeInfo* pInfo, gpointer pPadProbetr)
     {
+        // Timers and deferred work added by the Handlers (and the ODE 
+        // Triggers and Actions they call) go to the Pad's Pipeline context.
+        MainContextScope mainContextScope(GST_OBJECT(pPad));
+        
         return static_cast<PadProbetr*>(pPadProbetr)->
             HandlePadProbe(pPad, pInfo);
     }
@@ -29,6 +29,11 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslBase.h"
 #include "DslSourceMeter.h"
+#include "DslWorkStealingPool.h"
+#include "DslFrameArena.h"
+#include "DslDisplayMetaBuilder.h"
+#include "DslOdeStats.h"
+#include "DslMainContext.h"
 
 
 namespace DSL
@@ -53,6 +58,9 @@ namespace DSL
     #define DSL_PPH_METER_NEW(name, interval, clientHandler, clientData) \
         std::shared_ptr<MeterPadProbeHandler>(new MeterPadProbeHandler(name, \
             interval, clientHandler, clientData))
+    #define DSL_PPH_METER_STATS_NEW(name, interval, statsHandler, clientData) \
+        std::shared_ptr<MeterPadProbeHandler>(new MeterPadProbeHandler(name, \
+            interval, statsHandler, clientData))
         
     #define DSL_PPH_ODE_PTR std::shared_ptr<OdePadProbeHandler>
     #define DSL_PPH_ODE_NEW(name) \
@@ -163,9 +171,10 @@ namespace DSL
     protected:
     
         /**
-         * @brief Handler enabled setting, default = true (enabled), 
+         * @brief Handler enabled setting, default = true (enabled). Atomic
+         * so that it can be read by the streaming thread without locking.
          */ 
-        bool m_isEnabled;
+        std::atomic<bool> m_isEnabled;
 
         /**
          * @brief mutex to protect mutual access to probe data
@@ -504,11 +513,14 @@ namespace DSL
          * @brief current frame number to increment and assign to each
          * frame within each batch-metadata received. 
          */
-        uint64_t m_currentFrameNumber;
+        std::atomic<uint64_t> m_currentFrameNumber;
     };
     
     //--------------------------------------------------------------------------------
 
+    struct OdeTriggerFrameSnapshot;
+    class OdeFrameActionGate;
+
     /**
      * @class OdePadProbeHandler
      * @brief Pad Probe Handler to Handle a collection ODE triggers
@@ -546,17 +558,86 @@ namespace DSL
         void RemoveAllChildren();
         
         /**
-         * @brief Gets the current Display Meta Allocation per frame size.
-         * @return the allocation size, default = 1
+         * @brief Gets the current maximum Display Meta Allocation per frame size.
+         * @return the allocation size, default = unlimited
          */
         uint GetDisplayMetaAllocSize();
         
         /**
-         * @brief Gets the current Display Meta Allocation per frame size.
-         * @return the allocation size, default = 1
+         * @brief Sets the maximum Display Meta Allocation per frame size.
+         * @param[in] count new allocation size, 0 to disable display meta.
          */
         void SetDisplayMetaAllocSize(uint count);
 
+        /**
+         * @brief Gets the current parallel-mode settings for this handler.
+         * @param[out] enabled true if the frames of each batch are evaluated
+         * in parallel, false if evaluated serially (default).
+         * @param[out] numWorkers number of worker threads used in parallel mode.
+         */
+        void GetParallelMode(bool* enabled, uint* numWorkers);
+
+        /**
+         * @brief Sets the parallel-mode settings for this handler.
+         * @param[in] enabled set to true to evaluate the frames of each batch
+         * in parallel, false to evaluate serially.
+         * @param[in] numWorkers number of worker threads to use in addition to
+         * the streaming thread. Set to 0 to use one less than the number of 
+         * available processors.
+         */
+        void SetParallelMode(bool enabled, uint numWorkers);
+
+        /**
+         * @brief Gets the current stats-enabled setting for this handler.
+         * @return true if stats are being recorded, false otherwise (default).
+         */
+        bool GetStatsEnabled();
+
+        /**
+         * @brief Sets the stats-enabled setting for this handler. When enabled,
+         * the latency of each Trigger phase, each Action, and each frame are
+         * recorded.
+         * @param[in] enabled set to true to enable stats, false to disable.
+         */
+        void SetStatsEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the latency stats for a named ODE Trigger or Action.
+         * @param[in] name unique name of the Trigger or Action.
+         * @param[in] phase one of the DSL_PPH_ODE_STATS_PHASE_* constants for
+         * a Trigger, DSL_ODE_STATS_PHASE_ACTION for an Action.
+         * @param[out] stats summary of the latencies recorded.
+         * @return true if stats were found, false otherwise.
+         */
+        bool GetStats(const char* name, uint phase, dsl_latency_stats* stats);
+        
+        /**
+         * @brief Gets the latency stats for all frames processed.
+         * @param[out] stats summary of the latencies recorded.
+         */
+        void GetFrameStats(dsl_latency_stats* stats);
+        
+        /**
+         * @brief Clears all stats recorded.
+         */
+        void ClearStats();
+        
+        /**
+         * @brief Gets the current frame budget for this handler.
+         * @return frame budget in microseconds, 0 if disabled (default).
+         */
+        uint GetFrameBudget();
+        
+        /**
+         * @brief Sets the frame budget for this handler. The client handler
+         * is called for each frame that takes longer than the budget.
+         * @param[in] budget frame budget in microseconds, 0 to disable.
+         * @param[in] handler client handler to call on budget overrun.
+         * @param[in] clientData opaque pointer to the client's data.
+         */
+        void SetFrameBudget(uint budget, 
+            dsl_pph_ode_budget_overrun_handler_cb handler, void* clientData);
+
         /**
          * @brief ODE Pad Probe Handler
          * @param[in] pBuffer Pad buffer
@@ -568,11 +649,186 @@ namespace DSL
         
     private:
     
+        friend class OdeFrameActionGate;
+    
+        /**
+         * @brief Evaluates all frames in a batch on the worker pool. Results 
+         * are identical to the serial path - each Trigger processes the frames
+         * in batch order, Actions are invoked in frame order, and Display Meta
+         * is added to each frame in order once all frames have been processed.
+         * @param[in] pBuffer pad buffer with the batch meta to process.
+         * @param[in] pBatchMeta batch meta from pBuffer.
+         */
+        void HandleBatchInParallel(GstBuffer* pBuffer, NvDsBatchMeta* pBatchMeta);
+        
+        /**
+         * @brief Evaluates all triggers for a single frame of a batch. Called
+         * by the worker pool's threads when in parallel mode.
+         * @param[in] pBuffer pad buffer with the batch meta to process.
+         * @param[in] frameIndex index of the frame in the current batch.
+         */
+        void HandleFrameInParallel(GstBuffer* pBuffer, uint frameIndex);
+        
+        /**
+         * @brief Blocks until the preceding frame of the same shard has been 
+         * post-processed by the trigger at the given index.
+         * @param[in] frameIndex index of the frame in the current batch.
+         * @param[in] triggerIndex index of the trigger in execution order.
+         */
+        void WaitForFrameTicket(uint frameIndex, uint triggerIndex);
+        
+        /**
+         * @brief Signals that the trigger at the next index has post-processed
+         * the frame at the given index.
+         * @param[in] frameIndex index of the frame in the current batch.
+         */
+        void ReleaseFrameTicket(uint frameIndex);
+        
+        /**
+         * @brief Blocks until all frames preceding the given frame have been
+         * post-processed by every trigger, i.e. all of their Actions have 
+         * been invoked. Called before the first Action invoked for a frame.
+         * @param[in] frameIndex index of the frame in the current batch.
+         */
+        void WaitForActionTicket(uint frameIndex);
+        
+        /**
+         * @brief Records the time taken to process a frame and calls the 
+         * client's budget-overrun handler if the frame budget was exceeded.
+         * @param[in] pFrameMeta frame that was processed.
+         * @param[in] cycles time taken in units of cycles.
+         */
+        void HandleFrameTime(NvDsFrameMeta* pFrameMeta, uint64_t cycles);
+    
         /**
-         * @brief specifies how many Display Meta structures are allocated for each frame
+         * @brief maximum number of Display Meta structures allocated for each 
+         * frame, acquired only as needed.
          */
         uint m_displayMetaAllocSize;
         
+        /**
+         * @brief arena for scratch data allocated while processing a batch,
+         * reset once the batch has been processed.
+         */
+        FrameArena m_frameArena;
+        
+        /**
+         * @brief true if the frames of each batch are evaluated in parallel.
+         */
+        bool m_parallelEnabled;
+        
+        /**
+         * @brief number of worker threads used when in parallel mode.
+         */
+        uint m_numWorkers;
+        
+        /**
+         * @brief worker pool used when in parallel mode, nullptr otherwise.
+         */
+        DSL_WORK_STEALING_POOL_PTR m_pWorkerPool;
+        
+        /**
+         * @brief ODE Triggers for the batch currently being processed in
+         * parallel, in execution order.
+         */
+        std::vector<DSL_BASE_PTR> m_batchTriggers;
+        
+        /**
+         * @brief true for each trigger in m_batchTriggers that shards its 
+         * streaming state by source.
+         */
+        std::vector<bool> m_batchTriggersSharded;
+        
+        /**
+         * @brief Config and source-state snapshots of each trigger for the 
+         * frame being processed serially, in execution order.
+         */
+        std::vector<OdeTriggerFrameSnapshot> m_frameSnapshots;
+        
+        /**
+         * @brief Config and source-state snapshots of each trigger for each
+         * frame of the current batch, indexed by frame * triggers + trigger.
+         */
+        std::vector<OdeTriggerFrameSnapshot> m_batchFrameSnapshots;
+        
+        /**
+         * @brief Frame meta for the batch currently being processed in parallel.
+         */
+        std::vector<NvDsFrameMeta*> m_batchFrames;
+        
+        /**
+         * @brief Display meta builders for each frame of the current batch.
+         */
+        std::vector<DisplayMetaBuilder> m_batchDisplayMeta;
+        
+        /**
+         * @brief Index of the preceding frame in batch order for each frame
+         * of the current batch, -1 if none.
+         */
+        std::vector<int> m_precedingFrames;
+        
+        /**
+         * @brief Index of the preceding frame from the same source as each 
+         * frame of the current batch, -1 if none. Used for source-sharded
+         * triggers.
+         */
+        std::vector<int> m_precedingSourceFrames;
+        
+        /**
+         * @brief Number of triggers that have post-processed each frame of 
+         * the current batch. Guarded by m_frameTicketMutex.
+         */
+        std::vector<uint> m_frameTickets;
+        
+        /**
+         * @brief Number of leading frames of the current batch that have been
+         * post-processed by every trigger. Guarded by m_frameTicketMutex.
+         */
+        uint m_completedFrames;
+        
+        /**
+         * @brief Next frame in the current batch to be claimed by a worker.
+         * Frames are always claimed in batch order.
+         */
+        std::atomic<uint> m_nextBatchFrame;
+        
+        /**
+         * @brief Mutex and condition guarding the frame tickets.
+         */
+        DslMutex m_frameTicketMutex;
+        DslCond m_frameTicketCond;
+        
+        /**
+         * @brief Time taken to process each frame of the current batch, in
+         * units of cycles.
+         */
+        std::vector<uint64_t> m_batchFrameCycles;
+        
+        /**
+         * @brief true if stats are being recorded.
+         */
+        bool m_statsEnabled;
+        
+        /**
+         * @brief Trigger, Action and frame latency stats.
+         */
+        OdeStats m_stats;
+        
+        /**
+         * @brief frame budget in microseconds, 0 if disabled.
+         */
+        uint m_frameBudget;
+        
+        /**
+         * @brief client handler to call on frame budget overrun.
+         */
+        dsl_pph_ode_budget_overrun_handler_cb m_budgetOverrunHandler;
+        
+        /**
+         * @brief opaque pointer to the client's data for the handler.
+         */
+        void* m_budgetOverrunClientData;
+        
         /**
          * @brief Index variable to incremment/assign on ODE Trigger add.
          */
@@ -589,17 +845,39 @@ namespace DSL
     
     /**
      * @class MeterPadProbeHandler
-     * @brief 
+     * @brief Pad Probe Handler to measure the frame-rate, inter-frame jitter,
+     * stalls and dropped frames of each source in a batched stream. Source 
+     * Meters are indexed by pad index and updated with relaxed atomics, the 
+     * handler's mutex is only taken when a new source is first seen.
      */
     class MeterPadProbeHandler : public PadProbeBufferHandler
     {
     public: 
 
-    
+        /**
+         * @brief ctor for the Meter Pad Probe Handler with an FPS client handler.
+         * @param[in] name unique name for the new Meter.
+         * @param[in] interval reporting interval in seconds.
+         * @param[in] clientHandler client callback to call with the session
+         * and interval FPS averages on each reporting interval.
+         * @param[in] clientData opaque pointer to client data.
+         */
         MeterPadProbeHandler(const char* name, 
             uint interval, dsl_pph_meter_client_handler_cb clientHandler, 
             void* clientData);
 
+        /**
+         * @brief ctor for the Meter Pad Probe Handler with a stats handler.
+         * @param[in] name unique name for the new Meter.
+         * @param[in] interval reporting interval in seconds.
+         * @param[in] statsHandler client callback to call with an array of 
+         * dsl_meter_source_stats on each reporting interval.
+         * @param[in] clientData opaque pointer to client data.
+         */
+        MeterPadProbeHandler(const char* name, 
+            uint interval, dsl_pph_meter_stats_handler_cb statsHandler, 
+            void* clientData);
+
         /**
          * @brief dtor for the Meter Consumer Pad Probe Handler
          */
@@ -635,6 +913,19 @@ namespace DSL
          */
         bool SetInterval(uint interval);
         
+        /**
+         * @brief gets the current stall threshold for the MeterPadProbeHandler
+         * @return the current stall threshold in milliseconds.
+         */
+        uint GetStallThreshold();
+
+        /**
+         * @brief sets the stall threshold for the MeterPadProbeHandler, may
+         * be called while the Pipeline is playing.
+         * @param[in] threshold the new stall threshold in milliseconds.
+         */
+        void SetStallThreshold(uint threshold);
+        
         /**
          * @brief Interval Timer experation handler
          * @return non-zero (true) to continue, 0 (false) otherwise 
@@ -649,24 +940,45 @@ namespace DSL
         uint m_interval;
         
         /**
-         * @brief gnome timer Id for peformance calculation interval timer
+         * @brief peformance calculation interval timer, attached to the
+         * main-context of the Pipeline being measured.
+         */
+        MainContextSource m_timer;
+        
+        /**
+         * @brief true once the interval timer has been started on the 
+         * first buffer, read without the mutex by the streaming thread.
          */
-        uint m_timerId;
+        std::atomic<bool> m_timerStarted;
+        
+        /**
+         * @brief time between two frames from the same source, in 
+         * nanoseconds, above which a stall is counted.
+         */
+        std::atomic<uint64_t> m_stallThreshold;
         
         /**
          * @brief client callback funtion, called on reporting interval
          */
         dsl_pph_meter_client_handler_cb m_clientHandler;
         
+        /**
+         * @brief client stats callback funtion, called on reporting interval
+         */
+        dsl_pph_meter_stats_handler_cb m_statsHandler;
+        
         /**
          * @brief opaue pointer to client data, returned on callback
          */
         void* m_clientData;
         
         /**
-         * @brief map of all current source meters, one per source_id
+         * @brief vector of all current source meters indexed by pad index, 
+         * NULL for pad indexes not yet seen. The vector is only resized by 
+         * the streaming thread while holding the mutex, so the streaming 
+         * thread can read it without locking.
          */
-        std::map<uint, DSL_SOURCE_METER_PTR> m_sourceMeters;
+        std::vector<DSL_SOURCE_METER_PTR> m_sourceMeters;
     };
 
     //--------------------------------------------------------------------------------
@@ -688,16 +1000,23 @@ namespace DSL
         ~TimestampPadProbeHandler();
 
         /**
-         * @brief returns the time of the last buffer
-         * @param[in] timestamp timestamp struct to fil in
+         * @brief returns the monotonic time of the last buffer
+         * @return timestamp in nanoseconds, 0 if no buffer has been received.
          */
-        void GetTime(struct timeval& timestamp);
+        uint64_t GetTimestamp();
         
         /**
-         * @brief sets the time of the last buffer
-         * @param[in] timestamp timevalue to set this Timestamp
+         * @brief sets the monotonic time of the last buffer
+         * @param[in] timestamp new timestamp in nanoseconds.
          */
-        void SetTime(struct timeval& timestamp);
+        void SetTimestamp(uint64_t timestamp);
+        
+        /**
+         * @brief returns a pointer to the atomic timestamp for a
+         * DeadlineScheduler watch.
+         * @return pointer to the timestamp owned by this handler.
+         */
+        const std::atomic<uint64_t>* GetTimestampPtr();
         
         /**
          * @brief Timestamp Pad Probe Handler. Updates the Timestamp to 
@@ -712,10 +1031,10 @@ namespace DSL
     private:
     
         /**
-         * @brief updated on each call to HandlePadData which provides a 
-         * time stamp for the last.
+         * @brief monotonic time in nanoseconds, updated on each call to 
+         * HandlePadData with a single atomic store - no lock required.
          */
-        timeval m_timestamp;
+        std::atomic<uint64_t> m_timestamp;
         
     };
     
@@ -766,7 +1085,8 @@ namespace DSL
         void SetTimeout(uint timeout);
         
         /**
-         * @brief handles the timer experation to check for new buffer timeout
+         * @brief handles a missed buffer deadline from the DeadlineScheduler.
+         * @return true to re-arm the watch, false to remove it.
          */
         int TimerHanlder();
         
@@ -785,19 +1105,49 @@ namespace DSL
         void* m_clientData;
         
         /**
-         * @brief gnome timer Id for buffer timeout management 
+         * @brief DeadlineScheduler watch Id for buffer timeout management 
          */
         uint m_bufferTimerId;
         
     };
 
     /**
-     * @brief Timer callback for the BufferTimeoutPadProbeHandler.
+     * @brief Missed deadline callback for the BufferTimeoutPadProbeHandler.
      * @param pPph shared pointer to BufferTimeoutPadProbeHandler.
-     * @return int true to continue, 0 to self remove
+     * @return int true to re-arm, 0 to self remove
      */
     static int buffer_timer_cb(gpointer pPph);
 
+    //--------------------------------------------------------------------------------
+    
+    /**
+     * @struct PadProbeHandlerChain
+     * @brief Immutable, add-ordered array of Pad Probe Handlers published by
+     * a PadProbetr for its streaming thread. A Handler that requests removal
+     * is flagged, and skipped, until the PadProbetr publishes a new chain.
+     */
+    struct PadProbeHandlerChain
+    {
+        /**
+         * @brief ctor for the PadProbeHandlerChain struct
+         * @param[in] handlers add-ordered Pad Probe Handlers for the chain.
+         */
+        PadProbeHandlerChain(std::vector<DSL_PPH_PTR>&& handlers)
+            : pHandlers(std::move(handlers))
+            , pRemoved(new std::atomic<bool>[pHandlers.size()]())
+        {};
+    
+        /**
+         * @brief Pad Probe Handlers in the order they are called.
+         */
+        const std::vector<DSL_PPH_PTR> pHandlers;
+        
+        /**
+         * @brief removal flags, one per Pad Probe Handler.
+         */
+        std::unique_ptr<std::atomic<bool>[]> pRemoved;
+    };
+
     //--------------------------------------------------------------------------------
     /**
      * @class PadProbetr
@@ -848,6 +1198,45 @@ namespace DSL
 
     protected:
     
+        /**
+         * @brief Builds and publishes a new Handler chain from the current
+         * children. Retired chains are freed once no streaming thread is
+         * reading a chain. Must be called with m_padProbeMutex locked.
+         */
+        void publishHandlerChain();
+        
+        /**
+         * @brief Gets the current Handler chain for the streaming thread. 
+         * Each call must be followed by a call to releaseHandlerChain.
+         * @return current Handler chain, NULL if no Handlers.
+         */
+        inline PadProbeHandlerChain* acquireHandlerChain()
+        {
+            m_chainReaders.fetch_add(1, std::memory_order_seq_cst);
+            return m_pHandlerChain.load(std::memory_order_seq_cst);
+        };
+        
+        /**
+         * @brief Releases the Handler chain acquired by the streaming thread.
+         */
+        inline void releaseHandlerChain()
+        {
+            m_chainReaders.fetch_sub(1, std::memory_order_seq_cst);
+        };
+        
+        /**
+         * @brief Flags a Handler in the chain for removal. The first thread to
+         * flag the Handler is responsible for removing it.
+         * @param[in] pChain chain that holds the Handler.
+         * @param[in] index index of the Handler in the chain.
+         * @return true if the Handler was flagged by this call.
+         */
+        inline bool flagHandlerForRemoval(PadProbeHandlerChain* pChain, uint index)
+        {
+            return !pChain->pRemoved[index].exchange(true, 
+                std::memory_order_relaxed);
+        };
+    
         /**
          * @brief unique name for this PadProbetr
          */
@@ -893,6 +1282,23 @@ namespace DSL
          * for execution
          */
         std::map <uint, DSL_BASE_PTR> m_pChildrenIndexed; 
+        
+        /**
+         * @brief current Handler chain read by the streaming thread without
+         * locking, rebuilt from m_pChildrenIndexed on each add and remove.
+         */
+        std::atomic<PadProbeHandlerChain*> m_pHandlerChain;
+        
+        /**
+         * @brief number of streaming threads currently reading a chain.
+         */
+        std::atomic<uint> m_chainReaders;
+        
+        /**
+         * @brief chains replaced while a streaming thread may still be 
+         * reading them, freed on a later publish or on destruction.
+         */
+        std::vector<PadProbeHandlerChain*> m_retiredHandlerChains;
 
     };
 
@@ -36,6 +36,7 @@ namespace DSL
         : BranchBintr(name, true)      // Pipeline = true
         , PipelineStateMgr(m_pGstObj)
         , PipelineBusSyncMgr(m_pGstObj)
+        , PipelineLatencyMgr(name, m_pGstObj)
     {
         LOG_FUNC();
 
@@ -78,12 +79,29 @@ namespace DSL
         LOG_FUNC();
 
         // Check if custom source bin is used 
-        m_pCustomSourcesBintr = std::dynamic_pointer_cast<CustomSourceBintr>(pSourceBintr);
-        if (m_pCustomSourcesBintr)
+        DSL_CUSTOM_SOURCE_PTR pCustomSourceBintr = 
+            std::dynamic_pointer_cast<CustomSourceBintr>(pSourceBintr);
+        if (pCustomSourceBintr)
         {
+            // A custom source replaces the Streammuxer as the head component 
+            // so there can only be one, and only without other sources.
+            if (m_pCustomSourcesBintr or m_pPipelineSourcesBintr->GetNumChildren())
+            {
+                LOG_ERROR("Custom Source '" << pCustomSourceBintr->GetName() 
+                    << "' must be the only Source of Pipeline '" 
+                    << GetName() << "'");
+                return false;
+            }
+            m_pCustomSourcesBintr = pCustomSourceBintr;
             GstNodetr::AddChild(m_pCustomSourcesBintr);
             return true;
         }
+        if (m_pCustomSourcesBintr)
+        {
+            LOG_ERROR("Pipeline '" << GetName() 
+                << "' has a Custom Source which must be its only Source");
+            return false;
+        }
 
         // Otherwise add source as child of default pipeline source bin
         if (!m_pPipelineSourcesBintr->
@@ -103,6 +121,10 @@ namespace DSL
     {
         LOG_FUNC();
 
+        if (m_pCustomSourcesBintr and m_pCustomSourcesBintr == pSourceBintr)
+        {
+            return true;
+        }
         return (m_pPipelineSourcesBintr->
             IsChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr)));
     }
@@ -111,6 +133,12 @@ namespace DSL
     {
         LOG_FUNC();
 
+        if (m_pCustomSourcesBintr and m_pCustomSourcesBintr == pSourceBintr)
+        {
+            GstNodetr::RemoveChild(m_pCustomSourcesBintr);
+            m_pCustomSourcesBintr = nullptr;
+            return true;
+        }
         // Must cast to SourceBintr first so that correct Instance of 
         // RemoveChild is called
         return m_pPipelineSourcesBintr->
@@ -338,6 +366,7 @@ namespace DSL
         
         // Start with an empty list of linked components
         m_linkedComponents.clear();
+        m_lastLinkTime = g_get_monotonic_time();
 
         //Link all Source Elementrs (required component), and all Sources to the Streammuxer
         //then add the PipelineSourcesBintr as the Source (head) component for this Pipeline.
@@ -345,7 +374,11 @@ namespace DSL
         //If a custom source was added to the pipeline, need to add that as the head component and
         //ignore the streammuxer. 
         if (m_pCustomSourcesBintr) {
-            m_linkedComponents.push_back(m_pCustomSourcesBintr);
+            if (!m_pCustomSourcesBintr->LinkAll())
+            {
+                return false;
+            }
+            AddLinkedComponent(m_pCustomSourcesBintr);
         }
         else
         {
@@ -354,7 +387,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pPipelineSourcesBintr);
+            AddLinkedComponent(m_pPipelineSourcesBintr);
         }        
 
         LOG_INFO("Pipeline '" << GetName() << "' Linked up all Source '" << 
@@ -372,7 +405,7 @@ namespace DSL
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pStreammuxTilerBintr);
+            AddLinkedComponent(m_pStreammuxTilerBintr);
             LOG_INFO("Pipeline '" << GetName() << "' Linked up Tiler '" << 
                 m_pStreammuxTilerBintr->GetName() 
                 << "' to the Streammuxer output successfully");
@@ -390,11 +423,17 @@ namespace DSL
         GetState(currentState, 0);
         if (currentState == GST_STATE_NULL or currentState == GST_STATE_READY)
         {
+            gint64 linkStartTime = g_get_monotonic_time();
             if (!LinkAll())
             {
                 LOG_ERROR("Unable to prepare Pipeline '" << GetName() << "' for Play");
                 return false;
             }
+            SetLinkTime(g_get_monotonic_time() - linkStartTime);
+            
+            // Time each component's first transition to PLAYING from here.
+            StartStateChangeTimer();
+
             // For non-live sources we Pause to preroll before we play
             if (!m_pPipelineSourcesBintr->StreammuxPlayTypeIsLiveGet())
             {
@@ -457,28 +496,27 @@ namespace DSL
         }
         
         // Need to check the context to see if we're running from either
-        // the XDisplay thread or the bus-watch fucntion
-        
-        // Try and lock the shared-client-mutex first
-        if (!g_mutex_trylock(&*m_pSharedClientCbMutex))
+        // the XDisplay thread or the bus-watch function. Both mark the calling
+        // thread while calling on client handlers. Any other thread, e.g. an
+        // ODE Action worker, is an application context - even while the 
+        // bus-watch function is running on another thread.
+        if (CallbackContextScope::IsCurrent(&*m_pSharedClientCbMutex))
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
-            // lock-failed which means we are already in the XWindow thread context
-            // calling on a client handler function for Key release or xWindow delete. 
+            // We are in the XWindow thread context calling on a client 
+            // handler function for Key release or xWindow delete. 
             // Safe to stop the Pipeline in this context.
             LOG_INFO("dsl_pipeline_stop called from client-callback context");
             HandleStop();
             return true;
         }
-        // Try the bus-watch mutex next
-        if (!g_mutex_trylock(&m_busWatchMutex))
+        if (CallbackContextScope::IsCurrent(&m_busWatchMutex))
         {
-            // lock-failed which means we're in the bus-watch function context
-            // calling on a client listener or handler function. Safe to stop 
-            // the Pipeline in this context. 
+            // We're in the bus-watch function context calling on a client 
+            // listener or handler function. Safe to stop the Pipeline in 
+            // this context. 
             LOG_INFO("dsl_pipeline_stop called from bus-watch-function thread context");
             HandleStop();
-            g_mutex_unlock(&*m_pSharedClientCbMutex);
             return true;
         }
         // If the main loop is running -- normal case -- then we can't change the 
@@ -493,9 +531,6 @@ namespace DSL
             gst_element_post_message(GetGstElement(),
                 gst_message_new_application(GetGstObject(),
                     gst_structure_new_empty("stop-pipline")));
-
-            g_mutex_unlock(&*m_pSharedClientCbMutex);
-            g_mutex_unlock(&m_busWatchMutex);
                     
             // We need a timeout in case the condition is never met/cleared
             gint64 endtime = g_get_monotonic_time () + 
@@ -512,16 +547,22 @@ namespace DSL
             }
         }
         // Else, client has stopped the main-loop or we are running under test 
-        // without the mainloop running - can't send a message so handle stop now.
-        else
-        {
-            HandleStop();
-        }
-        g_mutex_unlock(&*m_pSharedClientCbMutex);
-        g_mutex_unlock(&m_busWatchMutex);
+        // without the mainloop running - can't send a message so handle stop now,
+        // with the XWindow thread and bus-watch function held off.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
+        
+        HandleStop();
         return true;
     }
 
+    void PipelineBintr::HandleMainContextChange()
+    {
+        LOG_FUNC();
+        
+        ReattachLatencyReporters();
+    }
+
     void PipelineBintr::HandleStop()
     {
         LOG_FUNC();
@@ -569,6 +610,9 @@ namespace DSL
         m_eosFlag = false;
         UnlinkAll();
         
+        // no streaming threads remain to read removed Latency Points.
+        ReclaimRetiredLatencyPoints();
+        
         g_cond_signal(&m_asyncCommsCond);
     }
 
@@ -601,6 +645,53 @@ namespace DSL
             GST_DEBUG_GRAPH_SHOW_ALL, filename);
     }
 
+    void PipelineBintr::AddStartupProfileComponent(DSL_BASE_PTR pComponent, 
+        uint64_t constructTime)
+    {
+        LOG_FUNC();
+        
+        m_startupProfile.push_back(std::make_pair(
+            std::weak_ptr<Base>(pComponent), constructTime));
+    }
+    
+    const std::vector<dsl_component_startup_timing>& 
+        PipelineBintr::GetStartupTimings()
+    {
+        LOG_FUNC();
+        
+        m_startupTimingNames.clear();
+        m_startupTimings.clear();
+        
+        // reserve up front so the name pointers remain valid while filling
+        m_startupTimingNames.reserve(m_startupProfile.size());
+        
+        for (auto const& ivec: m_startupProfile)
+        {
+            DSL_BASE_PTR pComponent = ivec.first.lock();
+            if (!pComponent)
+            {
+                continue;
+            }
+            std::string cstrName(pComponent->GetName());
+            m_startupTimingNames.push_back(
+                std::wstring(cstrName.begin(), cstrName.end()));
+                
+            dsl_component_startup_timing timing{0};
+            timing.name = m_startupTimingNames.back().c_str();
+            timing.construct_us = ivec.second;
+            
+            // Pad Probe Handlers are profiled for construction only.
+            DSL_BINTR_PTR pBintr = std::dynamic_pointer_cast<Bintr>(pComponent);
+            if (pBintr)
+            {
+                timing.link_us = pBintr->GetLinkTime();
+                timing.state_change_us = GetFirstPlayingTime(cstrName.c_str());
+            }
+            m_startupTimings.push_back(timing);
+        }
+        return m_startupTimings;
+    }
+
     static int PipelineStop(gpointer pPipeline)
     {
         static_cast<PipelineBintr*>(pPipeline)->HandleStop();
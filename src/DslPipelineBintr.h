@@ -31,6 +31,7 @@ THE SOFTWARE.
 #include "DslBranchBintr.h"
 #include "DslPipelineStateMgr.h"
 #include "DslPipelineBusSyncMgr.h"
+#include "DslPipelineLatencyMgr.h"
 #include "DslSourceBintr.h"
 #include "DslDewarperBintr.h"
 #include "DslPipelineSourcesBintr.h"
@@ -49,7 +50,7 @@ namespace DSL
      * @brief 
      */
     class PipelineBintr : public BranchBintr, public PipelineStateMgr,
-        public PipelineBusSyncMgr
+        public PipelineBusSyncMgr, public PipelineLatencyMgr
     {
     public:
     
@@ -95,6 +96,12 @@ namespace DSL
          */
         void HandleStop();
         
+        /**
+         * @brief Re-attaches the Pipeline's latency report timers to its
+         * new main-context on creation or deletion of its own main-loop.
+         */
+        void HandleMainContextChange();
+        
         /**
          * @brief returns whether the Pipeline has all live sources or not.
          * @return true if all sources are live, false otherwise (default when no sources).
@@ -332,6 +339,24 @@ namespace DSL
          */ 
         void DumpToDotWithTs(char* filename);
         
+        /**
+         * @brief Adds a component to this Pipeline's startup profile.
+         * @param[in] pComponent shared pointer to the component to profile.
+         * @param[in] constructTime time in microseconds taken to construct
+         * the component.
+         */
+        void AddStartupProfileComponent(DSL_BASE_PTR pComponent, 
+            uint64_t constructTime);
+            
+        /**
+         * @brief Gets the startup timing - construction, link, and first 
+         * state change to PLAYING - for each component in the startup profile,
+         * in the order the components were added. Components deleted since
+         * being added are omitted.
+         * @return vector of timings, one per profiled component.
+         */
+        const std::vector<dsl_component_startup_timing>& GetStartupTimings();
+        
     private:
 
         /**
@@ -360,6 +385,22 @@ namespace DSL
          */
         DSL_TILER_PTR m_pStreammuxTilerBintr;
         
+        /**
+         * @brief vector of profiled components - held as weak pointers so
+         * as not to extend their lifetime - with their construction times.
+         */
+        std::vector<std::pair<std::weak_ptr<Base>, uint64_t>> m_startupProfile;
+        
+        /**
+         * @brief wide-string names for the current startup timings. 
+         * Owned here so the name pointers returned remain valid.
+         */
+        std::vector<std::wstring> m_startupTimingNames;
+        
+        /**
+         * @brief startup timings last returned by GetStartupTimings.
+         */
+        std::vector<dsl_component_startup_timing> m_startupTimings;
         
     }; // Pipeline
     
@@ -30,6 +30,7 @@ THE SOFTWARE.
 namespace DSL
 {
     PipelineBusSyncMgr::PipelineBusSyncMgr(const GstObject* pGstPipeline)
+        : m_stateChangeStartTime(0)
     {
         LOG_FUNC();
 
@@ -82,12 +83,55 @@ namespace DSL
                 return GST_BUS_DROP;
             }
             break;
+        case GST_MESSAGE_STATE_CHANGED:
+        
+            // Record the first transition to PLAYING for each child Bin.
+            // Every DSL component is a Bin named with the component's name.
+            if (m_stateChangeStartTime and GST_IS_BIN(GST_MESSAGE_SRC(pMessage)))
+            {
+                GstState oldState, newState;
+                gst_message_parse_state_changed(pMessage, 
+                    &oldState, &newState, NULL);
+                    
+                if (newState == GST_STATE_PLAYING)
+                {
+                    std::string binName(GST_OBJECT_NAME(GST_MESSAGE_SRC(pMessage)));
+                    if (m_firstPlayingTimes.find(binName) == 
+                        m_firstPlayingTimes.end())
+                    {
+                        m_firstPlayingTimes[binName] = 
+                            g_get_monotonic_time() - m_stateChangeStartTime;
+                    }
+                }
+            }
+            break;
         default:
             break;
         }
         return GST_BUS_PASS;
     }
 
+    void PipelineBusSyncMgr::StartStateChangeTimer()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busSyncMutex);
+        
+        if (!m_stateChangeStartTime)
+        {
+            m_stateChangeStartTime = g_get_monotonic_time();
+        }
+    }
+
+    uint64_t PipelineBusSyncMgr::GetFirstPlayingTime(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busSyncMutex);
+        
+        auto itime = m_firstPlayingTimes.find(name);
+        
+        return (itime == m_firstPlayingTimes.end()) ? 0 : itime->second;
+    }
+
     static GstBusSyncReply bus_sync_handler(GstBus* bus, 
         GstMessage* pMessage, gpointer pData)
     {
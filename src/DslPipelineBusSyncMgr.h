@@ -49,6 +49,21 @@ namespace DSL
          */
         GstBusSyncReply HandleBusSyncMessage(GstMessage* pMessage);
         
+        /**
+         * @brief Starts the clock used to time each child Bin's first transition
+         * to a state of PLAYING. Only the first call has any effect so that the
+         * times recorded are always those of the Pipeline's first Play.
+         */
+        void StartStateChangeTimer();
+        
+        /**
+         * @brief Gets the time taken by a named child Bin to first reach 
+         * a state of PLAYING, measured from the call to StartStateChangeTimer.
+         * @param[in] name name of the child Bin to query.
+         * @return time in microseconds, 0 if the Bin has yet to reach PLAYING.
+         */
+        uint64_t GetFirstPlayingTime(const char* name);
+        
     protected:
     
         /**
@@ -64,6 +79,18 @@ namespace DSL
          * @brief mutex to prevent callback reentry
          */
         DslMutex m_busSyncMutex;
+        
+        /**
+         * @brief monotonic time in microseconds when the state-change timer
+         * was started, 0 if not started.
+         */
+        gint64 m_stateChangeStartTime;
+        
+        /**
+         * @brief map of child Bin names to the time each took to first
+         * reach a state of PLAYING.
+         */
+        std::map<std::string, uint64_t> m_firstPlayingTimes;
     };
     
     /**
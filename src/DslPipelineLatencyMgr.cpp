@@ -0,0 +1,683 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslPipelineLatencyMgr.h"
+
+namespace DSL
+{
+    LatencyPointPadProbeHandler::LatencyPointPadProbeHandler(const char* name, 
+        PipelineLatencyMgr* pLatencyMgr, const char* component, 
+        DSL_BASE_PTR pParent, uint pad, bool terminal)
+        : PadProbeBufferHandler(name)
+        , m_pLatencyMgr(pLatencyMgr)
+        , m_componentName(component)
+        , m_pParent(pParent)
+        , m_pParentBintr(std::dynamic_pointer_cast<Bintr>(pParent))
+        , m_pad(pad)
+        , m_terminal(terminal)
+        , m_previousPad(DSL_PAD_SRC)
+        , m_pLinks(NULL)
+    {
+        LOG_FUNC();
+        
+        for (auto& slot: m_slots)
+        {
+            slot.sequence.store(0, std::memory_order_relaxed);
+            slot.key.store(0, std::memory_order_relaxed);
+            slot.firstCycles.store(0, std::memory_order_relaxed);
+            slot.cycles.store(0, std::memory_order_relaxed);
+        }
+        
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    LatencyPointPadProbeHandler::~LatencyPointPadProbeHandler()
+    {
+        LOG_FUNC();
+    }
+    
+    uint LatencyPointPadProbeHandler::GetSourceId()
+    {
+        // Sources are assigned their Streammuxer request pad id on link
+        if (m_pParentBintr and m_pParentBintr->GetRequestPadId() >= 0)
+        {
+            return m_pParentBintr->GetRequestPadId();
+        }
+        return 0;
+    }
+    
+    void LatencyPointPadProbeHandler::StoreStamp(uint64_t key, 
+        uint64_t firstCycles, uint64_t cycles)
+    {
+        uint set = getSlotSet(key);
+        
+        // Overwrite the key's own slot if in the set, else the older slot.
+        LatencySlot* pSlot = &m_slots[set];
+        if (m_slots[set+1].key.load(std::memory_order_relaxed) == key or
+            (pSlot->key.load(std::memory_order_relaxed) != key and 
+            m_slots[set+1].cycles.load(std::memory_order_relaxed) < 
+                pSlot->cycles.load(std::memory_order_relaxed)))
+        {
+            pSlot = &m_slots[set+1];
+        }
+        
+        // Single writer, so the sequence can be read relaxed. Readers 
+        // discard the slot while the sequence is odd, or has changed.
+        uint64_t sequence = pSlot->sequence.load(std::memory_order_relaxed);
+        pSlot->sequence.store(sequence+1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        pSlot->key.store(key, std::memory_order_relaxed);
+        pSlot->firstCycles.store(firstCycles, std::memory_order_relaxed);
+        pSlot->cycles.store(cycles, std::memory_order_relaxed);
+        pSlot->sequence.store(sequence+2, std::memory_order_release);
+    }
+    
+    bool LatencyPointPadProbeHandler::FindStamp(uint64_t key, 
+        uint64_t& firstCycles, uint64_t& cycles)
+    {
+        uint set = getSlotSet(key);
+        
+        for (uint i = set; i < set+2; i++)
+        {
+            LatencySlot& slot = m_slots[i];
+            
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (!sequence or (sequence & 1) or
+                slot.key.load(std::memory_order_relaxed) != key)
+            {
+                continue;
+            }
+            uint64_t slotFirstCycles = 
+                slot.firstCycles.load(std::memory_order_relaxed);
+            uint64_t slotCycles = slot.cycles.load(std::memory_order_relaxed);
+            
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence or
+                slot.key.load(std::memory_order_relaxed) != key)
+            {
+                continue;
+            }
+            firstCycles = slotFirstCycles;
+            cycles = slotCycles;
+            return true;
+        }
+        return false;
+    }
+    
+    GstPadProbeReturn LatencyPointPadProbeHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        if (m_isEnabled)
+        {
+            m_pLatencyMgr->HandleLatencyPoint(this, (GstBuffer*)pInfo->data);
+        }
+        return GST_PAD_PROBE_OK;
+    }
+    
+    //--------------------------------------------------------------------------------
+
+    PipelineLatencyMgr::PipelineLatencyMgr(const char* name, 
+        GstObject* pGstPipeline)
+        : m_pipelineName(name)
+        , m_pGstPipeline(pGstPipeline)
+        , m_latencyEnabled(true)
+        , m_latencyEpoch(0)
+    {
+        LOG_FUNC();
+    }
+
+    PipelineLatencyMgr::~PipelineLatencyMgr()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+
+        for (auto const& imap: m_latencyReporters)
+        {
+            imap.second->timer.Remove();
+        }
+        // Points hold their parent components, so they must be removed to
+        // release them.
+        for (auto const& ivec: m_latencyPoints)
+        {
+            ivec->RemoveFromParent(ivec->GetParent(), ivec->GetPad());
+        }
+    }
+    
+    bool PipelineLatencyMgr::GetLatencyEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_latencyEnabled;
+    }
+    
+    void PipelineLatencyMgr::SetLatencyEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        // stamps are meaningless once tracing has been interrupted.
+        m_latencyEpoch++;
+        m_latencyEnabled = enabled;
+    }
+    
+    bool PipelineLatencyMgr::AddLatencyPoint(const char* component, 
+        DSL_BASE_PTR pComponent, uint pad, bool terminal)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        for (auto const& ivec: m_latencyPoints)
+        {
+            if (ivec->GetComponentName() == component and ivec->GetPad() == pad)
+            {
+                LOG_ERROR("Latency Point for component '" << component
+                    << "' and pad = " << pad << " is not unique for Pipeline '"
+                    << m_pipelineName << "'");
+                return false;
+            }
+        }
+        std::string pointName = m_pipelineName + "-" + component 
+            + ((pad == DSL_PAD_SINK) ? "-sink" : "-src") + "-latency-point";
+            
+        DSL_PPH_LATENCY_POINT_PTR pLatencyPoint = DSL_PPH_LATENCY_POINT_NEW(
+            pointName.c_str(), this, component, pComponent, pad, terminal);
+        
+        // links must be published before the first buffer can cross the point.
+        m_latencyPoints.push_back(pLatencyPoint);
+        updateLatencyLinks();
+        
+        if (!pLatencyPoint->AddToParent(pComponent, pad))
+        {
+            LOG_ERROR("Failed to add Latency Point '" << pointName 
+                << "' to Pipeline '" << m_pipelineName << "'");
+            m_latencyPoints.pop_back();
+            m_retiredLatencyPoints.push_back(pLatencyPoint);
+            updateLatencyLinks();
+            return false;
+        }
+        
+        LOG_INFO("Latency Point '" << pointName 
+            << "' added to Pipeline '" << m_pipelineName << "' successfully");
+        return true;
+    }
+    
+    bool PipelineLatencyMgr::SetLatencyPointPrevious(const char* component, 
+        uint pad, const char* previous, uint previousPad)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        DSL_PPH_LATENCY_POINT_PTR pPreviousPoint(nullptr);
+        
+        for (auto const& ivec: m_latencyPoints)
+        {
+            if (ivec->GetComponentName() == previous and 
+                ivec->GetPad() == previousPad)
+            {
+                pPreviousPoint = ivec;
+            }
+            else if (ivec->GetComponentName() == component and 
+                ivec->GetPad() == pad)
+            {
+                if (!pPreviousPoint or pPreviousPoint->GetTerminal())
+                {
+                    LOG_ERROR("Latency Point for component '" << previous
+                        << "' and pad = " << previousPad 
+                        << " is not a non-terminal point added before '"
+                        << component << "' for Pipeline '" 
+                        << m_pipelineName << "'");
+                    return false;
+                }
+                ivec->SetPrevious(previous, previousPad);
+                updateLatencyLinks();
+                return true;
+            }
+        }
+        LOG_ERROR("Latency Point for component '" << component
+            << "' and pad = " << pad << " was not found for Pipeline '"
+            << m_pipelineName << "'");
+        return false;
+    }
+    
+    DSL_PPH_LATENCY_POINT_PTR PipelineLatencyMgr::GetLatencyPoint(
+        const char* component, uint pad)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        for (auto const& ivec: m_latencyPoints)
+        {
+            if (ivec->GetComponentName() == component and 
+                ivec->GetPad() == pad)
+            {
+                return ivec;
+            }
+        }
+        return nullptr;
+    }
+    
+    bool PipelineLatencyMgr::RemoveLatencyPoint(const char* component, uint pad)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        for (auto ivec = m_latencyPoints.begin(); 
+            ivec != m_latencyPoints.end(); ivec++)
+        {
+            if ((*ivec)->GetComponentName() == component and 
+                (*ivec)->GetPad() == pad)
+            {
+                (*ivec)->RemoveFromParent((*ivec)->GetParent(), pad);
+                
+                // The removed point may still be in use by a streaming 
+                // thread, or linked to by other points until relinked below.
+                m_retiredLatencyPoints.push_back(*ivec);
+                m_latencyPoints.erase(ivec);
+                
+                // points measuring from the removed point fall back to 
+                // the order points were added.
+                for (auto const& jvec: m_latencyPoints)
+                {
+                    std::string previous;
+                    uint previousPad(0);
+                    jvec->GetPrevious(previous, previousPad);
+                    if (previous == component and previousPad == pad)
+                    {
+                        jvec->SetPrevious("", DSL_PAD_SRC);
+                    }
+                }
+                updateLatencyLinks();
+                return true;
+            }
+        }
+        LOG_ERROR("Latency Point for component '" << component
+            << "' and pad = " << pad << " was not found for Pipeline '"
+            << m_pipelineName << "'");
+        return false;
+    }
+    
+    void PipelineLatencyMgr::updateLatencyLinks()
+    {
+        // If no point ends a branch explicitly, the last point ends the
+        // one and only branch.
+        bool anyTerminal(false);
+        for (auto const& ivec: m_latencyPoints)
+        {
+            anyTerminal |= ivec->GetTerminal();
+        }
+        
+        for (uint i = 0; i < m_latencyPoints.size(); i++)
+        {
+            std::unique_ptr<LatencyPointLinks> pLinks(new LatencyPointLinks);
+            pLinks->terminal = m_latencyPoints[i]->GetTerminal() or
+                (!anyTerminal and i == m_latencyPoints.size()-1);
+            
+            std::string previous;
+            uint previousPad(0);
+            m_latencyPoints[i]->GetPrevious(previous, previousPad);
+            
+            // Measure from the explicit previous point if set, else from
+            // the nearest earlier point that has not ended its branch.
+            for (int j = (int)i-1; j >= 0; j--)
+            {
+                if (m_latencyPoints[j]->GetTerminal())
+                {
+                    continue;
+                }
+                if (previous.size())
+                {
+                    if (m_latencyPoints[j]->GetComponentName() == previous and
+                        m_latencyPoints[j]->GetPad() == previousPad)
+                    {
+                        pLinks->previousPoints.push_back(
+                            m_latencyPoints[j].get());
+                        break;
+                    }
+                    continue;
+                }
+                pLinks->previousPoints.push_back(m_latencyPoints[j].get());
+            }
+            m_latencyPoints[i]->SetLinks(pLinks.get());
+            m_latencyLinks.push_back(std::move(pLinks));
+        }
+        
+        // stamps made with the old links will never be completed.
+        m_latencyEpoch++;
+        
+        // points updated while stopped need not wait for the next stop.
+        reclaimRetiredLatencyPoints();
+    }
+    
+    void PipelineLatencyMgr::ReclaimRetiredLatencyPoints()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        reclaimRetiredLatencyPoints();
+    }
+    
+    void PipelineLatencyMgr::reclaimRetiredLatencyPoints()
+    {
+        if (m_retiredLatencyPoints.empty() and 
+            m_latencyLinks.size() == m_latencyPoints.size())
+        {
+            return;
+        }
+        GstState currentState(GST_STATE_NULL);
+        GstState pendingState(GST_STATE_VOID_PENDING);
+        gst_element_get_state(GST_ELEMENT(m_pGstPipeline), 
+            &currentState, &pendingState, 0);
+        if (currentState > GST_STATE_READY or pendingState > GST_STATE_READY)
+        {
+            return;
+        }
+        
+        // Only the links currently published by the points are kept.
+        std::vector<const LatencyPointLinks*> publishedLinks;
+        for (auto const& ivec: m_latencyPoints)
+        {
+            publishedLinks.push_back(ivec->GetLinks());
+        }
+        m_latencyLinks.erase(std::remove_if(m_latencyLinks.begin(), 
+            m_latencyLinks.end(), 
+            [&publishedLinks](const std::unique_ptr<LatencyPointLinks>& pLinks)
+            {
+                return std::find(publishedLinks.begin(), publishedLinks.end(),
+                    pLinks.get()) == publishedLinks.end();
+            }), m_latencyLinks.end());
+        
+        // Releases the points, and with them their parent components.
+        m_retiredLatencyPoints.clear();
+    }
+    
+    bool PipelineLatencyMgr::GetLatencyPointStats(const char* component, 
+        uint pad, dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        for (auto const& ivec: m_latencyPoints)
+        {
+            if (ivec->GetComponentName() == component and 
+                ivec->GetPad() == pad)
+            {
+                ivec->GetHistogram().GetStats(stats);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void PipelineLatencyMgr::GetLatencyTotalStats(dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        
+        m_totalHistogram.GetStats(stats);
+    }
+    
+    void PipelineLatencyMgr::ClearLatencyStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        for (auto const& ivec: m_latencyPoints)
+        {
+            ivec->GetHistogram().Clear();
+        }
+        m_totalHistogram.Clear();
+        m_latencyEpoch++;
+    }
+    
+    bool PipelineLatencyMgr::AddLatencyReportHandler(
+        dsl_pipeline_latency_report_handler_cb handler, 
+        uint interval, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+        
+        if (m_latencyReporters.find(handler) != m_latencyReporters.end())
+        {   
+            LOG_ERROR("Latency report handler is not unique for Pipeline '"
+                << m_pipelineName << "'");
+            return false;
+        }
+        if (!interval)
+        {
+            LOG_ERROR("Invalid reporting interval of 0 for Pipeline '"
+                << m_pipelineName << "'");
+            return false;
+        }
+        std::unique_ptr<LatencyReporter> pReporter(new LatencyReporter{
+            this, handler, clientData, interval});
+            
+        pReporter->timer.AddTimeout(m_pGstPipeline, interval*1000, 
+            LatencyReportTimeoutHandler, pReporter.get());
+            
+        m_latencyReporters[handler] = std::move(pReporter);
+        return true;
+    }
+    
+    bool PipelineLatencyMgr::RemoveLatencyReportHandler(
+        dsl_pipeline_latency_report_handler_cb handler)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+
+        auto imap = m_latencyReporters.find(handler);
+        if (imap == m_latencyReporters.end())
+        {   
+            LOG_ERROR("Latency report handler was not found for Pipeline '"
+                << m_pipelineName << "'");
+            return false;
+        }
+        imap->second->timer.Remove();
+        m_latencyReporters.erase(imap);
+        return true;
+    }
+    
+    void PipelineLatencyMgr::ReattachLatencyReporters()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+
+        for (auto const& imap: m_latencyReporters)
+        {
+            imap.second->timer.Remove();
+            imap.second->timer.AddTimeout(m_pGstPipeline, 
+                imap.second->interval*1000, LatencyReportTimeoutHandler, 
+                imap.second.get());
+        }
+    }
+    
+    void PipelineLatencyMgr::HandleLatencyPoint(
+        LatencyPointPadProbeHandler* pPoint, GstBuffer* pBuffer)
+    {
+        uint64_t now = CycleCounter::Now();
+        
+        if (!m_latencyEnabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        const LatencyPointLinks* pLinks = pPoint->GetLinks();
+        if (!pLinks)
+        {
+            return;
+        }
+        uint64_t epoch = m_latencyEpoch.load(std::memory_order_acquire);
+        
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        
+        // Buffers upstream of the Streammuxer are stamped by source-id
+        if (!pBatchMeta)
+        {
+            uint64_t firstCycles(now);
+            stampLatencyKey(pPoint, *pLinks, makeLatencyKey(
+                pPoint->GetSourceId(), GST_BUFFER_PTS(pBuffer), epoch), 
+                now, true, firstCycles);
+            return;
+        }
+        uint64_t batchKey = makeLatencyKey(DSL_PIPELINE_LATENCY_BATCH_ID, 
+            GST_BUFFER_PTS(pBuffer), epoch);
+        
+        // New frames, i.e. those produced by the Tiler, start from when their
+        // batch was first stamped so that the end-to-end latency is unbroken. 
+        uint64_t batchFirstCycles(now), batchCycles(0);
+        if (!findPreviousStamp(pPoint, *pLinks, batchKey, 
+            batchFirstCycles, batchCycles))
+        {
+            batchFirstCycles = now;
+        }
+        
+        // Batched buffers are stamped per frame so that latencies can be 
+        // followed from the sources through to the sinks.
+        bool framesFound(false);
+        uint64_t framesFirstCycles(now);
+        for (NvDsMetaList* pFrame = pBatchMeta->frame_meta_list; pFrame; 
+            pFrame = pFrame->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrame->data);
+            uint64_t firstCycles(batchFirstCycles);
+            if (stampLatencyKey(pPoint, *pLinks, makeLatencyKey(
+                pFrameMeta->pad_index, pFrameMeta->buf_pts, epoch), 
+                now, true, firstCycles))
+            {
+                framesFound = true;
+                framesFirstCycles = std::min(framesFirstCycles, firstCycles);
+            }
+        }
+        
+        // And as a whole, so that latencies can be followed across components,
+        // i.e. the Tiler, that replace the frames in the batch.
+        stampLatencyKey(pPoint, *pLinks, batchKey, now, !framesFound, 
+            framesFirstCycles);
+    }
+    
+    bool PipelineLatencyMgr::findPreviousStamp(
+        LatencyPointPadProbeHandler* pPoint, const LatencyPointLinks& links, 
+        uint64_t key, uint64_t& firstCycles, uint64_t& cycles)
+    {
+        for (auto const& ivec: links.previousPoints)
+        {
+            if (!ivec->FindStamp(key, firstCycles, cycles))
+            {
+                continue;
+            }
+            // A stamp made here since, i.e. a repeated timestamp, means the
+            // upstream stamp has already been measured from.
+            uint64_t lastFirstCycles(0), lastCycles(0);
+            if (pPoint->FindStamp(key, lastFirstCycles, lastCycles) and
+                lastCycles >= cycles)
+            {
+                return false;
+            }
+            return true;
+        }
+        return false;
+    }
+    
+    bool PipelineLatencyMgr::stampLatencyKey(LatencyPointPadProbeHandler* pPoint, 
+        const LatencyPointLinks& links, uint64_t key, uint64_t now, 
+        bool record, uint64_t& firstCycles)
+    {
+        uint64_t previousFirstCycles(0), previousCycles(0);
+        bool found = findPreviousStamp(pPoint, links, key, 
+            previousFirstCycles, previousCycles);
+            
+        if (found)
+        {
+            firstCycles = previousFirstCycles;
+            if (record)
+            {
+                pPoint->GetHistogram().Record(
+                    CycleCounter::ToNanoseconds(now - previousCycles));
+                if (links.terminal)
+                {
+                    m_totalHistogram.Record(
+                        CycleCounter::ToNanoseconds(now - previousFirstCycles));
+                }
+            }
+        }
+        // Stamped even at terminal points so that repeated timestamps 
+        // are not measured twice.
+        pPoint->StoreStamp(key, firstCycles, now);
+        return found;
+    }
+    
+    int PipelineLatencyMgr::HandleLatencyReport(LatencyReporter* pReporter)
+    {
+        std::vector<std::wstring> components;
+        std::vector<const wchar_t*> componentPtrs;
+        std::vector<uint> pads;
+        std::vector<dsl_latency_stats> pointStats;
+        dsl_latency_stats totalStats;
+        dsl_pipeline_latency_report_handler_cb handler;
+        void* clientData;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_latencyMutex);
+            
+            for (auto const& ivec: m_latencyPoints)
+            {
+                std::string cstrName(ivec->GetComponentName());
+                components.push_back(
+                    std::wstring(cstrName.begin(), cstrName.end()));
+                pads.push_back(ivec->GetPad());
+                
+                dsl_latency_stats stats;
+                ivec->GetHistogram().GetStats(&stats);
+                pointStats.push_back(stats);
+            }
+            m_totalHistogram.GetStats(&totalStats);
+            handler = pReporter->handler;
+            clientData = pReporter->clientData;
+        }
+        for (auto const& ivec: components)
+        {
+            componentPtrs.push_back(ivec.c_str());
+        }
+        
+        // the client is called without the lock held so that it can 
+        // call back into the Latency services.
+        try
+        {
+            handler(componentPtrs.data(), pads.data(), pointStats.data(), 
+                (uint)pointStats.size(), &totalStats, clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << m_pipelineName 
+                << "' threw exception calling client latency report handler");
+        }
+        return true;
+    }
+
+    static int LatencyReportTimeoutHandler(gpointer pReporter)
+    {
+        return static_cast<LatencyReporter*>(pReporter)->pLatencyMgr->
+            HandleLatencyReport(static_cast<LatencyReporter*>(pReporter));
+    }
+}
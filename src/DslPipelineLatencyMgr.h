@@ -0,0 +1,583 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_PIPELINE_LATENCY_MGR_H
+#define _DSL_PIPELINE_LATENCY_MGR_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslBintr.h"
+#include "DslPadProbeHandler.h"
+#include "DslLatencyHistogram.h"
+#include "DslMainContext.h"
+
+namespace DSL
+{
+    /**
+     * @brief number of buffer stamps held by each Latency Point, as a power
+     * of two. Stamps are held in two-way sets and overwritten oldest first,
+     * so stamps for buffers that never reach the next Latency Point, i.e. 
+     * dropped frames, need no eviction.
+     */
+    #define DSL_PIPELINE_LATENCY_SLOT_BITS 10
+    #define DSL_PIPELINE_LATENCY_SLOTS (1 << DSL_PIPELINE_LATENCY_SLOT_BITS)
+    
+    /**
+     * @brief pseudo source-id used to stamp a batched-buffer as a whole.
+     */
+    #define DSL_PIPELINE_LATENCY_BATCH_ID UINT32_MAX
+
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_PPH_LATENCY_POINT_PTR std::shared_ptr<LatencyPointPadProbeHandler>
+    #define DSL_PPH_LATENCY_POINT_NEW(name, \
+        pLatencyMgr, component, pParent, pad, terminal) \
+        std::shared_ptr<LatencyPointPadProbeHandler>( \
+            new LatencyPointPadProbeHandler(name, \
+                pLatencyMgr, component, pParent, pad, terminal))
+
+    class PipelineLatencyMgr;
+    class LatencyPointPadProbeHandler;
+    
+    //--------------------------------------------------------------------------------
+    
+    /**
+     * @struct LatencySlot
+     * @brief stamp of a single frame or batch at a Latency Point. Written by
+     * the point's streaming thread only, and read lock-free by downstream 
+     * points; an odd sequence count marks the slot as being written.
+     */
+    struct LatencySlot
+    {
+        std::atomic<uint64_t> sequence;
+        std::atomic<uint64_t> key;
+        std::atomic<uint64_t> firstCycles;
+        std::atomic<uint64_t> cycles;
+    };
+    
+    /**
+     * @struct LatencyPointLinks
+     * @brief immutable links from a Latency Point to the points upstream of 
+     * it, published by the PipelineLatencyMgr on each change of points.
+     */
+    struct LatencyPointLinks
+    {
+        /**
+         * @brief points to find each buffer's previous stamp in, nearest first.
+         */
+        std::vector<LatencyPointPadProbeHandler*> previousPoints;
+        
+        /**
+         * @brief true if the point ends the end-to-end latency.
+         */
+        bool terminal;
+    };
+    
+    //--------------------------------------------------------------------------------
+    
+    /**
+     * @class LatencyPointPadProbeHandler
+     * @brief Pad Probe Handler added to the sink or src pad of a Pipeline 
+     * component to stamp each buffer that crosses it. The handler measures
+     * the latency from the previous Latency Point upstream of it. 
+     */
+    class LatencyPointPadProbeHandler : public PadProbeBufferHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the LatencyPointPadProbeHandler
+         * @param[in] name unique name for the new Handler.
+         * @param[in] pLatencyMgr latency manager to report each buffer to.
+         * @param[in] component client name for the component.
+         * @param[in] pParent component to add the Handler to.
+         * @param[in] pad pad to add the Handler to; DSL_PAD_SINK | DSL_PAD SRC
+         * @param[in] terminal true if the Handler ends the end-to-end latency.
+         */
+        LatencyPointPadProbeHandler(const char* name, 
+            PipelineLatencyMgr* pLatencyMgr, const char* component, 
+            DSL_BASE_PTR pParent, uint pad, bool terminal);
+
+        /**
+         * @brief dtor for the LatencyPointPadProbeHandler
+         */
+        ~LatencyPointPadProbeHandler();
+
+        /**
+         * @brief Gets the client name for the component this Latency Point
+         * is added to. The Pipeline's name is used for its Streammuxer.
+         * @return name of the component.
+         */
+        const std::string& GetComponentName(){return m_componentName;};
+        
+        /**
+         * @brief Gets the component this Latency Point is added to.
+         * @return shared pointer to the parent component.
+         */
+        DSL_BASE_PTR GetParent(){return m_pParent;};
+        
+        /**
+         * @brief Gets the pad this Latency Point is added to.
+         * @return one of DSL_PAD_SINK or DSL_PAD_SRC.
+         */
+        uint GetPad(){return m_pad;};
+        
+        /**
+         * @brief Gets the terminal setting for this Latency Point.
+         * @return true if the point ends a branch of the Pipeline.
+         */
+        bool GetTerminal(){return m_terminal;};
+        
+        /**
+         * @brief Gets the Latency Point set explicitly as the previous point.
+         * @param[out] component name of the previous point's component, empty 
+         * if the previous point is found from the order points were added.
+         * @param[out] pad pad of the previous point.
+         */
+        void GetPrevious(std::string& component, uint& pad)
+        {
+            component = m_previousComponent;
+            pad = m_previousPad;
+        };
+        
+        /**
+         * @brief Sets the Latency Point to measure from explicitly.
+         * @param[in] component name of the previous point's component, empty
+         * to use the order points were added.
+         * @param[in] pad pad of the previous point.
+         */
+        void SetPrevious(const std::string& component, uint pad)
+        {
+            m_previousComponent = component;
+            m_previousPad = pad;
+        };
+        
+        /**
+         * @brief Gets the links to the points upstream of this point.
+         * @return current links, NULL until published.
+         */
+        const LatencyPointLinks* GetLinks()
+        {
+            return m_pLinks.load(std::memory_order_acquire);
+        };
+        
+        /**
+         * @brief Publishes new links to the points upstream of this point.
+         * @param[in] pLinks new links, owned by the PipelineLatencyMgr.
+         */
+        void SetLinks(const LatencyPointLinks* pLinks)
+        {
+            m_pLinks.store(pLinks, std::memory_order_release);
+        };
+        
+        /**
+         * @brief Stores the stamp of a frame or batch crossing this point. 
+         * Called from this point's streaming thread only.
+         * @param[in] key key of the frame or batch.
+         * @param[in] firstCycles cycle count at the first Latency Point.
+         * @param[in] cycles cycle count at this Latency Point.
+         */
+        void StoreStamp(uint64_t key, uint64_t firstCycles, uint64_t cycles);
+        
+        /**
+         * @brief Finds the stamp of a frame or batch that crossed this point.
+         * May be called from any streaming thread.
+         * @param[in] key key of the frame or batch.
+         * @param[out] firstCycles cycle count at the first Latency Point.
+         * @param[out] cycles cycle count at this Latency Point.
+         * @return true if found, false otherwise.
+         */
+        bool FindStamp(uint64_t key, uint64_t& firstCycles, uint64_t& cycles);
+        
+        /**
+         * @brief Gets the source-id for buffers that are not yet batched, 
+         * i.e. for Latency Points upstream of the Streammuxer.
+         * @return streammuxer request pad id of the parent component or 0.
+         */
+        uint GetSourceId();
+        
+        /**
+         * @brief Gets the histogram of latencies measured from the previous
+         * Latency Point to this one.
+         * @return reference to this Latency Point's histogram.
+         */
+        LatencyHistogram& GetHistogram(){return m_histogram;};
+        
+        /**
+         * @brief Handler specific Pad Buffer Handler
+         * @param[in] pInfo pad probe info with the buffer to stamp.
+         * @return always GST_PAD_PROBE_OK.
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+        
+    private:
+    
+        /**
+         * @brief Gets the first slot of the two-way set for a key.
+         * @param[in] key key of the frame or batch.
+         * @return index of the set's first slot.
+         */
+        static uint getSlotSet(uint64_t key)
+        {
+            return (uint)((key * 0xBF58476D1CE4E5B9ULL) >> 
+                (64 - DSL_PIPELINE_LATENCY_SLOT_BITS)) & ~1u;
+        };
+    
+        /**
+         * @brief latency manager to report each buffer to.
+         */
+        PipelineLatencyMgr* m_pLatencyMgr;
+        
+        /**
+         * @brief client name for the component this Latency Point is added to.
+         */
+        std::string m_componentName;
+        
+        /**
+         * @brief component this Latency Point is added to.
+         */
+        DSL_BASE_PTR m_pParent;
+        
+        /**
+         * @brief parent component as a Bintr if it is one, NULL otherwise.
+         */
+        DSL_BINTR_PTR m_pParentBintr;
+        
+        /**
+         * @brief pad this Latency Point is added to.
+         */
+        uint m_pad;
+        
+        /**
+         * @brief true if this Latency Point ends the end-to-end latency.
+         */
+        bool m_terminal;
+        
+        /**
+         * @brief component and pad of the Latency Point set explicitly as 
+         * the previous point, guarded by the PipelineLatencyMgr's mutex.
+         */
+        std::string m_previousComponent;
+        uint m_previousPad;
+        
+        /**
+         * @brief links to the points upstream of this point.
+         */
+        std::atomic<const LatencyPointLinks*> m_pLinks;
+        
+        /**
+         * @brief stamps of the frames and batches crossing this point.
+         */
+        LatencySlot m_slots[DSL_PIPELINE_LATENCY_SLOTS];
+        
+        /**
+         * @brief latencies measured from the previous Latency Point.
+         */
+        LatencyHistogram m_histogram;
+    };
+
+    //--------------------------------------------------------------------------------
+
+    /**
+     * @struct LatencyReporter
+     * @brief client report handler with its own reporting interval timer.
+     */
+    struct LatencyReporter
+    {
+        PipelineLatencyMgr* pLatencyMgr;
+        dsl_pipeline_latency_report_handler_cb handler;
+        void* clientData;
+        uint interval;
+        MainContextSource timer;
+    };
+
+    //--------------------------------------------------------------------------------
+
+    /**
+     * @class PipelineLatencyMgr
+     * @brief Traces the latency of each buffer through an ordered list of 
+     * Latency Points; sink or src pads of components in the Pipeline. 
+     * Buffers are followed per frame by source-id and presentation timestamp,
+     * and per batch where a component (e.g. Tiler) replaces the batch. Each
+     * point stamps buffers in its own slots, so streaming threads never
+     * share a lock.
+     */
+    class PipelineLatencyMgr
+    {
+    public: 
+    
+        PipelineLatencyMgr(const char* name, GstObject* pGstPipeline);
+
+        ~PipelineLatencyMgr();
+        
+        /**
+         * @brief Gets the current latency tracing enabled setting.
+         * @return true if enabled, false otherwise. Default = true.
+         */
+        bool GetLatencyEnabled();
+        
+        /**
+         * @brief Sets the latency tracing enabled setting.
+         * @param[in] enabled set to false to stop stamping buffers.
+         */
+        void SetLatencyEnabled(bool enabled);
+        
+        /**
+         * @brief Adds a new Latency Point to the end of the Pipeline's 
+         * ordered list of points.
+         * @param[in] component client name for the component.
+         * @param[in] pComponent component to add the Latency Point to.
+         * @param[in] pad pad to add the point to; DSL_PAD_SINK | DSL_PAD SRC
+         * @param[in] terminal true if the point ends a branch of the Pipeline.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddLatencyPoint(const char* component, 
+            DSL_BASE_PTR pComponent, uint pad, bool terminal);
+        
+        /**
+         * @brief Sets the Latency Point that a Latency Point measures from,
+         * i.e. for the first point of a Tee's second and later branches. 
+         * @param[in] component client name for the point's component.
+         * @param[in] pad pad of the point.
+         * @param[in] previous client name for the previous point's component.
+         * @param[in] previousPad pad of the previous point.
+         * @return true on successful set, false if either point was not 
+         * found or the previous point is not a non-terminal point added
+         * before the point.
+         */
+        bool SetLatencyPointPrevious(const char* component, uint pad,
+            const char* previous, uint previousPad);
+        
+        /**
+         * @brief Gets a Latency Point previously added with AddLatencyPoint.
+         * @param[in] component client name for the component.
+         * @param[in] pad pad the point was added to.
+         * @return shared pointer to the point, nullptr if not found.
+         */
+        DSL_PPH_LATENCY_POINT_PTR GetLatencyPoint(const char* component, 
+            uint pad);
+
+        /**
+         * @brief Removes a Latency Point previously added with AddLatencyPoint.
+         * @param[in] component client name for the component.
+         * @param[in] pad pad to remove the point from.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveLatencyPoint(const char* component, uint pad);
+        
+        /**
+         * @brief Gets the latency statistics measured from the previous
+         * Latency Point to a named Latency Point.
+         * @param[in] component name of the component the point is added to.
+         * @param[in] pad pad the point is added to.
+         * @param[out] stats latency statistics in nanoseconds.
+         * @return true if the Latency Point was found, false otherwise.
+         */
+        bool GetLatencyPointStats(const char* component, uint pad, 
+            dsl_latency_stats* stats);
+        
+        /**
+         * @brief Gets the end-to-end latency statistics measured from the 
+         * first to the last Latency Point.
+         * @param[out] stats latency statistics in nanoseconds.
+         */
+        void GetLatencyTotalStats(dsl_latency_stats* stats);
+        
+        /**
+         * @brief Clears all latency statistics and in-flight buffer stamps.
+         */
+        void ClearLatencyStats();
+        
+        /**
+         * @brief Adds a client handler to be called periodically with the
+         * latency statistics for all Latency Points.
+         * @param[in] handler client handler function to add.
+         * @param[in] interval reporting interval in seconds.
+         * @param[in] clientData opaque pointer to client data.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddLatencyReportHandler(dsl_pipeline_latency_report_handler_cb handler,
+            uint interval, void* clientData);
+        
+        /**
+         * @brief Removes a client handler previously added with 
+         * AddLatencyReportHandler.
+         * @param[in] handler client handler function to remove.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveLatencyReportHandler(
+            dsl_pipeline_latency_report_handler_cb handler);
+        
+        /**
+         * @brief Re-attaches the interval timers of all report handlers to the
+         * Pipeline's current main-context, called on main-context change.
+         */
+        void ReattachLatencyReporters();
+        
+        /**
+         * @brief Frees all removed Latency Points and superseded links. Called
+         * by the Pipeline once stopped, when no streaming thread can be
+         * reading them. Does nothing while the Pipeline is PAUSED or PLAYING.
+         */
+        void ReclaimRetiredLatencyPoints();
+        
+        /**
+         * @brief Stamps a buffer at a Latency Point, called by the point's
+         * pad probe handler on the streaming thread.
+         * @param[in] pPoint the Latency Point the buffer is crossing.
+         * @param[in] pBuffer the buffer to stamp.
+         */
+        void HandleLatencyPoint(LatencyPointPadProbeHandler* pPoint, 
+            GstBuffer* pBuffer);
+        
+        /**
+         * @brief Calls a client report handler on its interval timeout.
+         * @param[in] pReporter the reporter whose interval has expired.
+         * @return true to continue reporting.
+         */
+        int HandleLatencyReport(LatencyReporter* pReporter);
+        
+    private:
+    
+        /**
+         * @brief Makes the stamp key for a frame or batch.
+         * @param[in] sourceId source-id of the frame, or 
+         * DSL_PIPELINE_LATENCY_BATCH_ID for the batch.
+         * @param[in] pts presentation timestamp of the frame or batch.
+         * @param[in] epoch current stamp epoch; stamps made in earlier epochs
+         * are never found.
+         * @return the stamp key.
+         */
+        static uint64_t makeLatencyKey(uint sourceId, uint64_t pts, 
+            uint64_t epoch)
+        {
+            return pts ^ (((uint64_t)sourceId + 1) * 0x9E3779B97F4A7C15ULL) ^
+                (epoch * 0xC2B2AE3D27D4EB4FULL);
+        };
+        
+        /**
+         * @brief Finds the stamp of a frame or batch at the nearest upstream
+         * Latency Point.
+         * @param[in] pPoint the Latency Point the buffer is crossing.
+         * @param[in] links links from pPoint to its upstream points.
+         * @param[in] key the key of the frame or batch.
+         * @param[out] firstCycles cycle count at the first Latency Point.
+         * @param[out] cycles cycle count at the upstream Latency Point.
+         * @return true if found and not already used by pPoint.
+         */
+        bool findPreviousStamp(LatencyPointPadProbeHandler* pPoint,
+            const LatencyPointLinks& links, uint64_t key, 
+            uint64_t& firstCycles, uint64_t& cycles);
+    
+        /**
+         * @brief Stamps a single frame or batch at a Latency Point.
+         * @param[in] pPoint the Latency Point the buffer is crossing.
+         * @param[in] links links from pPoint to its upstream points.
+         * @param[in] key the key of the frame or batch to stamp.
+         * @param[in] now the current cycle count.
+         * @param[in] record if true, record the latencies measured.
+         * @param[in,out] firstCycles in: first cycle count to use for a new 
+         * stamp, out: first cycle count of the upstream stamp if found.
+         * @return true if the frame or batch was stamped by an upstream point.
+         */
+        bool stampLatencyKey(LatencyPointPadProbeHandler* pPoint, 
+            const LatencyPointLinks& links, uint64_t key, uint64_t now, 
+            bool record, uint64_t& firstCycles);
+        
+        /**
+         * @brief Publishes new links for all Latency Points and starts a new
+         * stamp epoch. Called with the latency mutex held.
+         */
+        void updateLatencyLinks();
+        
+        /**
+         * @brief Frees all removed Latency Points and superseded links if the
+         * Pipeline is in the NULL or READY state with no state change pending,
+         * i.e. with no streaming threads. Called with the latency mutex held.
+         */
+        void reclaimRetiredLatencyPoints();
+        
+        /**
+         * @brief name of the Pipeline that owns this manager, for logging
+         * and naming of the Latency Points.
+         */
+        std::string m_pipelineName;
+        
+        /**
+         * @brief GST object of the Pipeline that owns this manager, 
+         * the owner of all report timers.
+         */
+        GstObject* m_pGstPipeline;
+        
+        /**
+         * @brief mutex to protect the points and reporters. Never taken on
+         * the streaming threads.
+         */
+        DslMutex m_latencyMutex;
+
+        /**
+         * @brief latency tracing enabled setting, default = true.
+         */
+        std::atomic<bool> m_latencyEnabled;
+        
+        /**
+         * @brief current stamp epoch, incremented to discard all stamps.
+         */
+        std::atomic<uint64_t> m_latencyEpoch;
+
+        /**
+         * @brief ordered list of Latency Points.
+         */
+        std::vector<DSL_PPH_LATENCY_POINT_PTR> m_latencyPoints;
+        
+        /**
+         * @brief removed Latency Points, and all links published. Streaming 
+         * threads may still be reading them, so they are kept until the 
+         * Pipeline is next stopped, or deleted.
+         */
+        std::vector<DSL_PPH_LATENCY_POINT_PTR> m_retiredLatencyPoints;
+        std::vector<std::unique_ptr<LatencyPointLinks>> m_latencyLinks;
+        
+        /**
+         * @brief end-to-end latencies from the first to the last point.
+         */
+        LatencyHistogram m_totalHistogram;
+        
+        /**
+         * @brief map of client report handlers to their reporters.
+         */
+        std::map<dsl_pipeline_latency_report_handler_cb, 
+            std::unique_ptr<LatencyReporter>> m_latencyReporters;
+    };
+
+    /**
+     * @brief Timer callback for each LatencyReporter.
+     * @param[in] pReporter pointer to the LatencyReporter.
+     * @return true to continue, 0 to self remove
+     */
+    static int LatencyReportTimeoutHandler(gpointer pReporter);
+}
+
+#endif // _DSL_PIPELINE_LATENCY_MGR_H
@@ -345,6 +345,7 @@ namespace DSL
             std::string sinkPadName = 
                 "sink_" + std::to_string(imap.second->GetRequestPadId());
             
+            gint64 linkStartTime = g_get_monotonic_time();
             if (!imap.second->LinkAll() or 
                 !imap.second->LinkToSinkMuxer(m_pStreammux,
                     sinkPadName.c_str()))
@@ -354,6 +355,7 @@ namespace DSL
                     << imap.second->GetName() << "'");
                 return false;
             }
+            imap.second->SetLinkTime(g_get_monotonic_time() - linkStartTime);
         }
         // Set the Batch size to the nuber of sources owned if not already set
         if (!m_batchSizeSetByClient)
@@ -25,16 +25,18 @@ THE SOFTWARE.
 
 #include "Dsl.h"
 #include "DslPipelineStateMgr.h"
+#include "DslCallbackDispatcher.h"
 
 namespace DSL
 {
+    thread_local CallbackContextScope* CallbackContextScope::s_pCurrent(NULL);
+    
     PipelineStateMgr::PipelineStateMgr(GstObject* pGstPipeline)
         : m_pGstPipeline(pGstPipeline)
         , m_pMainContext(NULL)
         , m_pMainLoop(NULL)
         , m_pBusWatch(NULL)
         , m_eosFlag(false)
-        , m_errorNotificationTimerId(0)
     {
         LOG_FUNC();
 
@@ -56,6 +58,8 @@ namespace DSL
         }
         gst_bus_remove_watch(m_pGstBus);
         gst_object_unref(m_pGstBus);
+        
+        CallbackDispatcher::GetDispatcher()->RemoveAllListeners(this);
     }
 
     bool PipelineStateMgr::NewMainLoop()
@@ -100,6 +104,11 @@ namespace DSL
         g_source_set_callback(m_pBusWatch, (GSourceFunc)bus_watch, this, NULL);
         g_source_attach(m_pBusWatch, m_pMainContext);
         
+        // All components within the Pipeline attach their timers and 
+        // deferred work to the Pipeline's main-context from here on.
+        MainContextSource::SetPipelineContext(m_pGstPipeline, m_pMainContext);
+        HandleMainContextChange();
+        
         return true;
     }
     
@@ -172,6 +181,10 @@ namespace DSL
         // destroy the bus-watch - which unattaches the bus-watch from the main-context
         g_source_destroy(m_pBusWatch);
         
+        // revert all components to the default main-context before the 
+        // Pipeline's main-context is released.
+        MainContextSource::SetPipelineContext(m_pGstPipeline, NULL);
+        
         g_main_loop_unref(m_pMainLoop);
         g_main_context_unref(m_pMainContext);
         m_pBusWatch = NULL;
@@ -182,6 +195,8 @@ namespace DSL
         // main-context - setting it back to its default state.
         m_busWatchId = gst_bus_add_watch(m_pGstBus, bus_watch, this);
         
+        HandleMainContextChange();
+        
         return true;
     }
 
@@ -272,13 +287,15 @@ namespace DSL
             return false;
         }
         m_errorMessageHandlers.erase(handler);
+        CallbackDispatcher::GetDispatcher()->RemoveListener(this,
+            reinterpret_cast<const void*>(handler));
         
         return true;
     }
     
     bool PipelineStateMgr::HandleBusWatchMessage(GstMessage* pMessage)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
+        LOCK_CALLBACK_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
 
         GstClockTime clockTime;
         GstStreamStatusType statusType;
@@ -508,32 +525,23 @@ namespace DSL
         m_lastErrorSource = source;
         m_lastErrorMessage = message;
         
-        if (m_errorMessageHandlers.size())
-        {
-            m_errorNotificationTimerId = g_timeout_add(1, ErrorMessageHandlersNotificationHandler, this);
-        }
-    }
-    
-    int PipelineStateMgr::NotifyErrorMessageHandlers()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_lastErrorMutex);
-
-        // iterate through the map of state-change-listeners calling each
-        for(auto const& imap: m_errorMessageHandlers)
+        // Notify each handler asynchronously with a copy of the error strings
+        // so that a slow handler can't block the bus-watch or other handlers.
+        std::string name(std::string(GST_OBJECT_NAME(m_pGstPipeline)) 
+            + ":error-message");
+            
+        for (auto const& imap: m_errorMessageHandlers)
         {
-            try
-            {
-                imap.first(m_lastErrorSource.c_str(), m_lastErrorMessage.c_str(), imap.second);
-            }
-            catch(...)
-            {
-                LOG_ERROR("PipelineStateMgr threw exception calling Client Error-Message-Handler");
-            }
+            dsl_error_message_handler_cb handler(imap.first);
+            void* clientData(imap.second);
+            
+            CallbackDispatcher::GetDispatcher()->Dispatch(this, 
+                reinterpret_cast<const void*>(handler), name,
+                [handler, source, message, clientData]()
+                {
+                    handler(source.c_str(), message.c_str(), clientData);
+                }, false);
         }
-        // clear the timer id and return false to self remove
-        m_errorNotificationTimerId = 0;
-        return false;
     }
 
     void PipelineStateMgr::_initMaps()
@@ -549,10 +557,4 @@ namespace DSL
         return static_cast<PipelineStateMgr*>(pPipeline)->HandleBusWatchMessage(pMessage);
     }    
     
-    static int ErrorMessageHandlersNotificationHandler(gpointer pPipeline)
-    {
-        return static_cast<PipelineStateMgr*>(pPipeline)->
-            NotifyErrorMessageHandlers();
-    }
-    
 } // DSL   
\ No newline at end of file
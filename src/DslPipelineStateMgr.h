@@ -30,9 +30,68 @@ THE SOFTWARE.
 #include "DslBintr.h"
 #include "DslSourceBintr.h"
 #include "DslSinkBintr.h"
+#include "DslMainContext.h"
 
 namespace DSL
 {
+    #define LOCK_CALLBACK_MUTEX_FOR_CURRENT_SCOPE(mutex) \
+        CallbackContextScope callbackContext(mutex)
+
+    /**
+     * @class CallbackContextScope
+     * @brief Locks a bus-watch or client-callback mutex for the current 
+     * scope {}, and marks the calling thread as running within it, so that
+     * a client calling back into the Pipeline (e.g. dsl_pipeline_stop) can
+     * be detected explicitly.
+     */
+    class CallbackContextScope
+    {
+    public:
+        CallbackContextScope(GMutex* mutex) 
+            : m_pMutex(mutex)
+            , m_pPrevious(s_pCurrent)
+        {
+            g_mutex_lock(m_pMutex);
+            s_pCurrent = this;
+        }
+        
+        ~CallbackContextScope()
+        {
+            s_pCurrent = m_pPrevious;
+            g_mutex_unlock(m_pMutex);
+        }
+        
+        /**
+         * @brief Checks if the calling thread is within a scope for a mutex.
+         * @param[in] mutex mutex to check for.
+         * @return true if the calling thread holds the mutex by scope.
+         */
+        static bool IsCurrent(GMutex* mutex)
+        {
+            for (CallbackContextScope* pScope = s_pCurrent; pScope; 
+                pScope = pScope->m_pPrevious)
+            {
+                if (pScope->m_pMutex == mutex)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+    private:
+        GMutex* m_pMutex; 
+        
+        /**
+         * @brief enclosing scope on the calling thread, NULL if none.
+         */
+        CallbackContextScope* m_pPrevious;
+        
+        /**
+         * @brief innermost scope for each thread.
+         */
+        static thread_local CallbackContextScope* s_pCurrent;
+    };
 
     class PipelineStateMgr
     {
@@ -69,6 +128,13 @@ namespace DSL
         
         virtual void HandleStop() = 0;
 
+        /**
+         * @brief Called after the Pipeline's main-context has been created or
+         * deleted, allowing long-running sources added beforehand to be 
+         * re-attached to the new main-context. 
+         */
+        virtual void HandleMainContextChange(){};
+
         /**
          * @brief Adds a callback to be notified on change of Pipeline state
          * @param[in] listener pointer to the client's function to call on state change
@@ -142,13 +208,6 @@ namespace DSL
          * @param[out] message error/warning message sent by the source
          */
         void SetLastErrorMessage(std::wstring& source, std::wstring& message);
-        
-        /**
-         * @brief Timer experation callback function to notify all error-message-handlers of a new error
-         * recieved by the bus-watch. Allows notifications to be sent out from the main-loop context.
-         * @return false always to destroy the one-shot timer calling this callback. 
-         */
-        int NotifyErrorMessageHandlers();
 
     protected:
 
@@ -276,11 +335,6 @@ namespace DSL
          */
         DslMutex m_lastErrorMutex;
         
-        /**
-         * @brief timer used to execute the error notification thread
-         */
-        uint m_errorNotificationTimerId;
-        
         /**
          * @brief name of the gst object that was the source of the last error message
          * Note: in wchar format for client handlers
@@ -313,16 +367,6 @@ namespace DSL
      */
     static gboolean bus_watch(
         GstBus* bus, GstMessage* pMessage, gpointer pPipeline);
-
-    /**
-     * @brief Timer thread Notification Handler to invoke a Pipelines 
-     * NotifyErrorMessageHandlers() function
-     * @param pPipeline shared pointer to the Pipeline that started the timer so that 
-     * clients can be notified in the timer's experation callback running from the 
-     * main the loop, instead of the bus-watch callback
-     * @return false always to self destroy the one-shot timer.
-     */
-    static int ErrorMessageHandlersNotificationHandler(gpointer pPipeline);
 }
 
 #endif //  DSL_PIPELINE_BUS_MGR_H
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "DslPlayerBintr.h"
 #include "DslSourceBintr.h"
 #include "DslSinkBintr.h"
+#include "DslCallbackDispatcher.h"
 
 namespace DSL
 {
@@ -101,6 +102,7 @@ namespace DSL
         {
             Stop();
         }
+        CallbackDispatcher::GetDispatcher()->RemoveAllListeners(this);
     }
 
     bool PlayerBintr::LinkAll()
@@ -345,28 +347,25 @@ namespace DSL
         PrepareForEos();
 
         // Need to check the context to see if we're running from either
-        // the XDisplay thread or the bus-watch fucntion
-        
-        // Try and lock the Display mutex first
-        if (!g_mutex_trylock(&*m_pSharedClientCbMutex))
+        // the XDisplay thread or the bus-watch function. Both mark the calling
+        // thread while calling on client handlers.
+        if (CallbackContextScope::IsCurrent(&*m_pSharedClientCbMutex))
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
-            // lock-failed which means we are already in the XWindow thread context
-            // calling on a client handler function for Key release or xWindow delete. 
+            // We are in the XWindow thread context calling on a client 
+            // handler function for Key release or xWindow delete. 
             // Safe to stop the Player in this context.
             LOG_INFO("dsl_player_stop called from XWindow display thread context");
             HandleStop();
             return true;
         }
-        // Try the bus-watch mutex next
-        if (!g_mutex_trylock(&m_busWatchMutex))
+        if (CallbackContextScope::IsCurrent(&m_busWatchMutex))
         {
-            // lock-failed which means we're in the bus-watch function context
-            // calling on a client listener or handler function. Safe to stop 
-            // the Player in this context. 
+            // We're in the bus-watch function context calling on a client 
+            // listener or handler function. Safe to stop the Player in 
+            // this context. 
             LOG_INFO("dsl_player_stop called from bus-watch-function thread context");
             HandleStop();
-            g_mutex_unlock(&*m_pSharedClientCbMutex);
             return true;
         }
 
@@ -381,9 +380,6 @@ namespace DSL
                 gst_message_new_application(GetGstObject(),
                     gst_structure_new_empty("stop-pipline")));
                     
-            g_mutex_unlock(&*m_pSharedClientCbMutex);
-            g_mutex_unlock(&m_busWatchMutex);
-                    
             // We need a timeout in case the condition is never met/cleared
             gint64 endtime = g_get_monotonic_time () + 2 * G_TIME_SPAN_SECOND;
             if (!g_cond_wait_until(&m_asyncCommsCond, &m_asyncCommsMutex, endtime))
@@ -398,13 +394,12 @@ namespace DSL
             }
         }
         // Else, client has stopped the main-loop or we are running under test 
-        // without the mainloop running - can't send a message so handle stop now.
-        else
-        {
-            HandleStop();
-        }
-        g_mutex_unlock(&*m_pSharedClientCbMutex);
-        g_mutex_unlock(&m_busWatchMutex);
+        // without the mainloop running - can't send a message so handle stop now,
+        // with the XWindow thread and bus-watch function held off.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
+        
+        HandleStop();
         return true;
     }
 
@@ -467,17 +462,19 @@ namespace DSL
         
         if (m_inTermination)
         {
-            // iterate through the map of Termination event listeners calling each
-            for(auto const& imap: m_terminationEventListeners)
+            // Notify each Termination event listener asynchronously 
+            for (auto const& imap: m_terminationEventListeners)
             {
-                try
-                {
-                    imap.first(imap.second);
-                }
-                catch(...)
-                {
-                    LOG_ERROR("Exception calling Client Termination event Listener");
-                }
+                dsl_player_termination_event_listener_cb listener(imap.first);
+                void* clientData(imap.second);
+                
+                CallbackDispatcher::GetDispatcher()->Dispatch(this, 
+                    reinterpret_cast<const void*>(listener), 
+                    GetName() + ":termination",
+                    [listener, clientData]()
+                    {
+                        listener(clientData);
+                    }, false);
             }
             m_inTermination = false;
         }
@@ -536,6 +533,8 @@ namespace DSL
             return false;
         }
         m_terminationEventListeners.erase(listener);
+        CallbackDispatcher::GetDispatcher()->RemoveListener(this,
+            reinterpret_cast<const void*>(listener));
         
         return true;
     }
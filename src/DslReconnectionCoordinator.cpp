@@ -0,0 +1,235 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslReconnectionCoordinator.h"
+#include "DslDeadlineScheduler.h"
+
+namespace DSL
+{
+    ReconnectionCoordinator* ReconnectionCoordinator::GetCoordinator()
+    {
+        // Created on first use and intentionally never destroyed, as sources 
+        // may still cancel their attempts during process exit.
+        static ReconnectionCoordinator* pInstance = new ReconnectionCoordinator();
+        
+        return pInstance;
+    }
+
+    ReconnectionCoordinator::ReconnectionCoordinator()
+        : m_maxConcurrent(DSL_RTSP_RECONNECTION_MAX_CONCURRENT)
+        , m_maxBackoff(DSL_RTSP_RECONNECTION_MAX_BACKOFF_S)
+        , m_peakActive(0)
+        , m_attempts(0)
+        , m_successes(0)
+        , m_failures(0)
+        , m_deferrals(0)
+        , m_randomGenerator(std::random_device{}())
+    {
+        LOG_FUNC();
+    }
+
+    bool ReconnectionCoordinator::HasPriority(const Waiter& a, const Waiter& b)
+    {
+        // Most recently healthy first, then first come first served.
+        if (a.lastHealthy != b.lastHealthy)
+        {
+            return a.lastHealthy > b.lastHealthy;
+        }
+        return a.requestTime < b.requestTime;
+    }
+
+    bool ReconnectionCoordinator::RequestAttempt(const std::string& name, 
+        uint64_t lastHealthy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        if (m_activeAttempts.find(name) != m_activeAttempts.end())
+        {
+            return true;
+        }
+        uint64_t now = DeadlineScheduler::Now();
+        
+        auto iter = m_waiters.find(name);
+        bool newWaiter(iter == m_waiters.end());
+        if (newWaiter)
+        {
+            iter = m_waiters.emplace(name, Waiter{lastHealthy, now, now}).first;
+        }
+        else
+        {
+            iter->second.lastHealthy = lastHealthy;
+            iter->second.lastPollTime = now;
+        }
+        
+        // Drop all waiters that have stopped polling so they can't block others.
+        for (auto imap = m_waiters.begin(); imap != m_waiters.end(); )
+        {
+            if ((now - imap->second.lastPollTime) > 
+                (uint64_t)DSL_RECONNECTION_COORDINATOR_STALE_WAITER_MS*1000000)
+            {
+                LOG_WARN("Dropping stale reconnection waiter '" << imap->first << "'");
+                imap = m_waiters.erase(imap);
+            }
+            else
+            {
+                imap++;
+            }
+        }
+        
+        uint freeSlots = (m_activeAttempts.size() < m_maxConcurrent)
+            ? m_maxConcurrent - m_activeAttempts.size()
+            : 0;
+            
+        // The request is granted only if fewer waiters with higher priority 
+        // exist than there are free slots.
+        uint rank(0);
+        for (auto const& imap: m_waiters)
+        {
+            if (imap.first != name and HasPriority(imap.second, iter->second))
+            {
+                rank++;
+            }
+        }
+        if (rank >= freeSlots)
+        {
+            if (newWaiter)
+            {
+                m_deferrals++;
+                LOG_INFO("Reconnection attempt for '" << name 
+                    << "' deferred with " << m_activeAttempts.size() 
+                    << " attempts in progress");
+            }
+            return false;
+        }
+        m_waiters.erase(iter);
+        m_activeAttempts.insert(name);
+        m_attempts++;
+        m_peakActive = std::max(m_peakActive, (uint)m_activeAttempts.size());
+        
+        return true;
+    }
+
+    void ReconnectionCoordinator::ReleaseAttempt(const std::string& name, 
+        bool success)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        if (!m_activeAttempts.erase(name))
+        {
+            LOG_WARN("Source '" << name << "' does not hold a reconnection slot");
+            return;
+        }
+        if (success)
+        {
+            m_successes++;
+        }
+        else
+        {
+            m_failures++;
+        }
+    }
+
+    void ReconnectionCoordinator::CancelAttempt(const std::string& name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        m_activeAttempts.erase(name);
+        m_waiters.erase(name);
+    }
+
+    uint64_t ReconnectionCoordinator::GetBackoff(uint baseSleep, uint failures)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        uint64_t maxBackoffMs = (uint64_t)m_maxBackoff*1000;
+        uint64_t backoffMs = std::min((uint64_t)baseSleep*1000, maxBackoffMs);
+        
+        for (uint i = 1; i < failures and backoffMs < maxBackoffMs; i++)
+        {
+            backoffMs = std::min(backoffMs*2, maxBackoffMs);
+        }
+        if (backoffMs < 2)
+        {
+            return backoffMs;
+        }
+        std::uniform_int_distribution<uint64_t> jitter(backoffMs/2, backoffMs);
+        
+        return jitter(m_randomGenerator);
+    }
+
+    void ReconnectionCoordinator::GetParams(uint* maxConcurrent, uint* maxBackoff)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        *maxConcurrent = m_maxConcurrent;
+        *maxBackoff = m_maxBackoff;
+    }
+
+    bool ReconnectionCoordinator::SetParams(uint maxConcurrent, uint maxBackoff)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        if (!maxConcurrent or !maxBackoff)
+        {
+            LOG_ERROR("Invalid reconnection coordinator params");
+            return false;
+        }
+        m_maxConcurrent = maxConcurrent;
+        m_maxBackoff = maxBackoff;
+        return true;
+    }
+
+    void ReconnectionCoordinator::GetStats(dsl_rtsp_reconnection_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        stats->active = m_activeAttempts.size();
+        stats->waiting = m_waiters.size();
+        stats->peak_active = m_peakActive;
+        stats->attempts = m_attempts;
+        stats->successes = m_successes;
+        stats->failures = m_failures;
+        stats->deferrals = m_deferrals;
+    }
+
+    void ReconnectionCoordinator::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_coordinatorMutex);
+        
+        m_peakActive = m_activeAttempts.size();
+        m_attempts = 0;
+        m_successes = 0;
+        m_failures = 0;
+        m_deferrals = 0;
+    }
+}
@@ -0,0 +1,185 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_RECONNECTION_COORDINATOR_H
+#define _DSL_RECONNECTION_COORDINATOR_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include <set>
+
+namespace DSL
+{
+    /**
+     * @brief time after which a waiting source that has stopped polling for 
+     * an attempt slot is no longer considered when ranking waiters.
+     */
+    #define DSL_RECONNECTION_COORDINATOR_STALE_WAITER_MS                5000
+
+    /**
+     * @class ReconnectionCoordinator
+     * @brief Process wide coordinator for RTSP Source reconnection attempts. 
+     * Caps the number of attempts in progress at any one time, grants free
+     * attempt slots to the most recently healthy sources first, and spreads
+     * retries after failure with exponential backoff and jitter so that 
+     * sources that lost their connection together do not retry in lockstep.
+     */
+    class ReconnectionCoordinator
+    {
+    public:
+
+        /**
+         * @brief Returns the process wide Reconnection Coordinator, creating
+         * it on first call.
+         * @return pointer to the Reconnection Coordinator singleton.
+         */
+        static ReconnectionCoordinator* GetCoordinator();
+
+        /**
+         * @brief Requests a slot to start a new reconnection attempt. A source
+         * that is denied is queued as a waiter and should request again later.
+         * @param[in] name unique name of the requesting source.
+         * @param[in] lastHealthy monotonic time of the source's last buffer in
+         * nanoseconds, 0 if never healthy. More recent is higher priority.
+         * @return true if a slot was granted, false if the attempt is deferred.
+         */
+        bool RequestAttempt(const std::string& name, uint64_t lastHealthy);
+
+        /**
+         * @brief Releases the slot held by a source on attempt completion.
+         * @param[in] name unique name of the source holding the slot.
+         * @param[in] success true if the source reconnected, false on failure.
+         */
+        void ReleaseAttempt(const std::string& name, bool success);
+
+        /**
+         * @brief Removes a source from the coordinator, releasing any slot
+         * held and removing it from the waiters, without updating the stats.
+         * @param[in] name unique name of the source to cancel.
+         */
+        void CancelAttempt(const std::string& name);
+
+        /**
+         * @brief Calculates the time to wait before the next attempt after 
+         * a number of consecutive failures: base*2^(failures-1) capped at the
+         * maximum backoff, with equal jitter applied - i.e. a random value
+         * between half and all of the exponential backoff.
+         * @param[in] baseSleep base sleep time after first failure in seconds.
+         * @param[in] failures number of consecutive failures, 1 or more.
+         * @return backoff time in milliseconds.
+         */
+        uint64_t GetBackoff(uint baseSleep, uint failures);
+
+        /**
+         * @brief Gets the current coordinator parameters.
+         * @param[out] maxConcurrent maximum number of attempts in progress.
+         * @param[out] maxBackoff maximum backoff between attempts in seconds.
+         */
+        void GetParams(uint* maxConcurrent, uint* maxBackoff);
+
+        /**
+         * @brief Sets the coordinator parameters.
+         * @param[in] maxConcurrent maximum number of attempts in progress.
+         * @param[in] maxBackoff maximum backoff between attempts in seconds.
+         * @return true if valid and set, false otherwise.
+         */
+        bool SetParams(uint maxConcurrent, uint maxBackoff);
+
+        /**
+         * @brief Gets the current coordinator statistics.
+         * @param[out] stats statistics structure to fill in.
+         */
+        void GetStats(dsl_rtsp_reconnection_stats* stats);
+
+        /**
+         * @brief Clears the accumulated coordinator statistics. The active 
+         * and waiting counts are unaffected and the peak is reset to active.
+         */
+        void ClearStats();
+
+    private:
+
+        /**
+         * @brief private ctor for this singleton class.
+         */
+        ReconnectionCoordinator();
+
+        /**
+         * @struct Waiter
+         * @brief a source waiting for an attempt slot.
+         */
+        struct Waiter
+        {
+            uint64_t lastHealthy;
+            uint64_t requestTime;
+            uint64_t lastPollTime;
+        };
+
+        /**
+         * @brief returns true if waiter a should be granted a slot before b.
+         */
+        static bool HasPriority(const Waiter& a, const Waiter& b);
+
+        /**
+         * @brief mutex protecting all members below.
+         */
+        DslMutex m_coordinatorMutex;
+
+        /**
+         * @brief maximum number of reconnection attempts in progress.
+         */
+        uint m_maxConcurrent;
+
+        /**
+         * @brief maximum backoff between attempts in seconds.
+         */
+        uint m_maxBackoff;
+
+        /**
+         * @brief names of all sources currently holding an attempt slot.
+         */
+        std::set<std::string> m_activeAttempts;
+
+        /**
+         * @brief map of all sources waiting for an attempt slot by name.
+         */
+        std::map<std::string, Waiter> m_waiters;
+
+        /**
+         * @brief accumulated statistics.
+         */
+        uint m_peakActive;
+        uint m_attempts;
+        uint m_successes;
+        uint m_failures;
+        uint m_deferrals;
+
+        /**
+         * @brief random number generator for backoff jitter.
+         */
+        std::mt19937 m_randomGenerator;
+    };
+}
+
+#endif // _DSL_RECONNECTION_COORDINATOR_H
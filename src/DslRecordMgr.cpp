@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslRecordMgr.h"
 #include "DslPlayerBintr.h"
+#include "DslCallbackDispatcher.h"
 
 namespace DSL
 {
@@ -34,8 +35,10 @@ namespace DSL
     //-------------------------------------------------------------------------
     
     RecordMgr::RecordMgr(const char* name, const char* outdir, uint gpuId,
-        uint container, dsl_record_client_listener_cb clientListener)
+        uint container, dsl_record_client_listener_cb clientListener, 
+        GstObject* pParentGstObj)
         : m_name(name)
+        , m_pParentGstObj(pParentGstObj)
         , m_outdir(outdir)
         , m_parentGpuId(gpuId)
         , m_pContext(NULL)
@@ -43,7 +46,6 @@ namespace DSL
         , m_clientListener(clientListener)
         , m_clientData(0)
         , m_currentSessionId(UINT32_MAX)
-        , m_listenerNotifierTimerId(0)
         , m_stopSessionInProgress(false)
     {
         LOG_FUNC();
@@ -85,6 +87,7 @@ namespace DSL
             LOG_INFO("Destroying context");
             DestroyContext();
         }
+        CallbackDispatcher::GetDispatcher()->RemoveAllListeners(this);
     }
     
     bool RecordMgr::CreateContext()
@@ -243,7 +246,7 @@ namespace DSL
                 << "' context has not been created");
             return false;
         }
-        if (IsOn() or m_listenerNotifierTimerId)
+        if (IsOn())
         {
             LOG_INFO("Unable to start NEW session for RecordMgr '" << m_name 
                 << "' a it's in a recording session, ");
@@ -263,37 +266,26 @@ namespace DSL
             return false;
         }
 
-        // Start timer for listener notification of sesssion start.
-        m_listenerNotifierTimerId = g_timeout_add(1, 
-            RecordMgrListenerNotificationHandler, this);
+        // Notify the client listener of session start asynchronously.
+        dsl_record_client_listener_cb clientListener(m_clientListener);
+        uint sessionId(m_currentSessionId);
+        
+        CallbackDispatcher::GetDispatcher()->Dispatch(this, 
+            reinterpret_cast<const void*>(clientListener), 
+            m_name + ":record-session",
+            [clientListener, sessionId, clientData]()
+            {
+                dsl_recording_info dslInfo{0};
+
+                dslInfo.session_id = sessionId;
+                dslInfo.recording_event = DSL_RECORDING_EVENT_START;
+                
+                clientListener(&dslInfo, clientData);
+            }, false);
             
         return true;
     }
     
-    int RecordMgr::NotifyClientListener()
-    {
-        LOG_FUNC();
-
-        dsl_recording_info dslInfo{0};
-
-        dslInfo.session_id = m_currentSessionId;
-        dslInfo.recording_event = DSL_RECORDING_EVENT_START;
-
-        try
-        {
-            m_clientListener(&dslInfo, m_clientData);
-        }
-        catch(...)
-        {
-            LOG_ERROR("Client Listener for RecordMgr '" << m_name << "' threw an exception");
-        }
-        
-        // clear the Timer id and return false - one-shot timer.
-        m_listenerNotifierTimerId = 0;
-        return false;
-        
-    }
-    
     bool RecordMgr::StopSession(bool sync)
     {
         LOG_FUNC();
@@ -582,12 +574,6 @@ namespace DSL
 
     //******************************************************************************************
 
-    static int RecordMgrListenerNotificationHandler(gpointer pRecordMgr)
-    {
-        return static_cast<RecordMgr*>(pRecordMgr)->
-            NotifyClientListener();
-    }
-
     static void* RecordCompleteCallback(NvDsSRRecordingInfo* pNvDsInfo, void* pRecordMgr)
     {
         return static_cast<RecordMgr*>(pRecordMgr)->
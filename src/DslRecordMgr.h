@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslBintr.h"
 #include "DslMailer.h"
+#include "DslMainContext.h"
 
 #include <gst-nvdssr.h>
 
@@ -41,7 +42,7 @@ namespace DSL
     public: 
     
         RecordMgr(const char* name, const char* outdir, uint gpuId, uint container, 
-            dsl_record_client_listener_cb clientListener);
+            dsl_record_client_listener_cb clientListener, GstObject* pParentGstObj);
 
         ~RecordMgr();
         
@@ -125,14 +126,6 @@ namespace DSL
          */
         bool StartSession(uint start, uint duration, void* clientData);
         
-        /**
-         * @brief implements a timer thread to notify the client listener 
-         * in the main loop context.
-         * @return false always to self remove timer once the client has 
-         * been notified. Timer/tread will be restarted on next call to StartSession()
-         */
-        int NotifyClientListener();
-        
         /**
          * @brief Stop recording to file
          * @param[in] sync if true the function will block until the asynchronous
@@ -202,6 +195,11 @@ protected:
          * @brief unique name for the RecordMgr
          */
         std::string m_name;
+        
+        /**
+         * @brief GST object of the parent Bintr, owner of the notification timer.
+         */
+        GstObject* m_pParentGstObj;
 
         /**
          * @brief absolute or relative path 
@@ -234,11 +232,6 @@ protected:
          */
         DslMutex m_recordMgrMutex;
         
-        /**
-         * @brief gnome timer Id for the asynchronous "start-session" client notification.
-         */
-        uint m_listenerNotifierTimerId;
-        
         /**
          * @brief boolean flag to specify whether an async stop recording session 
          * is in progress or not. 
@@ -267,8 +260,6 @@ protected:
 
     //******************************************************************************************
     
-    static int RecordMgrListenerNotificationHandler(gpointer pRecordMgr);
-
     static void* RecordCompleteCallback(NvDsSRRecordingInfo* pNvDsInfo, void* pRecordSinkBintr);
 }
 
@@ -368,6 +368,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PPH_ODE_TRIGGER_REMOVE_FAILED] = L"DSL_RESULT_PPH_ODE_TRIGGER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE] = L"DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE";
         m_returnValueToString[DSL_RESULT_PPH_METER_INVALID_INTERVAL] = L"DSL_RESULT_PPH_METER_INVALID_INTERVAL";
+        m_returnValueToString[DSL_RESULT_PPH_STATS_NOT_FOUND] = L"DSL_RESULT_PPH_STATS_NOT_FOUND";
 
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND";
@@ -433,6 +434,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_ODE_HEAT_MAPPER_ACTION_ADD_FAILED] = L"DSL_RESULT_ODE_HEAT_MAPPER_ACTION_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_ODE_HEAT_MAPPER_ACTION_REMOVE_FAILED] = L"DSL_RESULT_ODE_HEAT_MAPPER_ACTION_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_ODE_HEAT_MAPPER_ACTION_NOT_IN_USE] = L"DSL_RESULT_ODE_HEAT_MAPPER_ACTION_NOT_IN_USE";
+        m_returnValueToString[DSL_RESULT_ODE_HEAT_MAPPER_SOURCE_NOT_FOUND] = L"DSL_RESULT_ODE_HEAT_MAPPER_SOURCE_NOT_FOUND";
 
         m_returnValueToString[DSL_RESULT_SINK_NAME_NOT_UNIQUE] = L"DSL_RESULT_SINK_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_SINK_NAME_NOT_FOUND] = L"DSL_RESULT_SINK_NAME_NOT_FOUND";
@@ -550,6 +552,10 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_PAUSE] = L"DSL_RESULT_PIPELINE_FAILED_TO_PAUSE";
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_STOP] = L"DSL_RESULT_PIPELINE_FAILED_TO_STOP";
         m_returnValueToString[DSL_RESULT_PIPELINE_MAIN_LOOP_REQUEST_FAILED] = L"DSL_RESULT_PIPELINE_MAIN_LOOP_REQUEST_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_SPEC_INVALID] = L"DSL_RESULT_PIPELINE_SPEC_INVALID";
+        m_returnValueToString[DSL_RESULT_PIPELINE_LATENCY_POINT_ADD_FAILED] = L"DSL_RESULT_PIPELINE_LATENCY_POINT_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_LATENCY_POINT_REMOVE_FAILED] = L"DSL_RESULT_PIPELINE_LATENCY_POINT_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND] = L"DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_PIPELINE_GET_FAILED] = L"DSL_RESULT_PIPELINE_GET_FAILED";
         m_returnValueToString[DSL_RESULT_PIPELINE_SET_FAILED] = L"DSL_RESULT_PIPELINE_SET_FAILED";
 
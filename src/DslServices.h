@@ -347,6 +347,17 @@ namespace DSL {
         
         uint OdeActionListSize();
 
+        DslReturnType OdeActionExecutorParamsGet(uint* maxWorkers, 
+            uint* queueCapacity);
+
+        DslReturnType OdeActionExecutorParamsSet(uint maxWorkers, 
+            uint queueCapacity);
+
+        DslReturnType OdeActionExecutorStatsGet(
+            dsl_ode_action_executor_stats* stats);
+
+        DslReturnType OdeActionExecutorStatsClear();
+
         DslReturnType OdeAreaInclusionNew(const char* name, 
             const char* polygon, boolean display, uint bboxTestPoint);
 
@@ -463,6 +474,9 @@ namespace DSL {
         
         DslReturnType OdeTriggerReset(const char* name);
 
+        DslReturnType OdeTriggerCountsGet(const char* name, 
+            uint64_t* events, uint64_t* frames, uint64_t* accumulated);
+
         DslReturnType OdeTriggerResetTimeoutGet(const char* name, uint* timeout);
 
         DslReturnType OdeTriggerResetTimeoutSet(const char* name, uint timeout);
@@ -618,11 +632,20 @@ namespace DSL {
         DslReturnType OdeHeatMapperLegendSettingsSet(const char* name,
             boolean enabled, uint location, uint width, uint height);
 
+        DslReturnType OdeHeatMapperModeGet(const char* name,
+            uint* mode, uint* interval, uint* size);
+
+        DslReturnType OdeHeatMapperModeSet(const char* name,
+            uint mode, uint interval, uint size);
+
         DslReturnType OdeHeatMapperMetricsClear(const char* name);
 
         DslReturnType OdeHeatMapperMetricsGet(const char* name,
             const uint64_t** buffer, uint* size);
 
+        DslReturnType OdeHeatMapperSourceMetricsGet(const char* name,
+            uint sourceId, const uint64_t** buffer, uint* size);
+
         DslReturnType OdeHeatMapperMetricsPrint(const char* name);
 
         DslReturnType OdeHeatMapperMetricsLog(const char* name);
@@ -646,6 +669,13 @@ namespace DSL {
         
         DslReturnType PphMeterIntervalSet(const char* name, uint interval);
         
+        DslReturnType PphMeterStatsNew(const char* name, uint interval, 
+            dsl_pph_meter_stats_handler_cb statsHandler, void* clientData);
+            
+        DslReturnType PphMeterStallThresholdGet(const char* name, uint* threshold);
+        
+        DslReturnType PphMeterStallThresholdSet(const char* name, uint threshold);
+        
         DslReturnType PphOdeNew(const char* name);
 
         DslReturnType PphOdeTriggerAdd(const char* name, const char* trigger);
@@ -658,6 +688,32 @@ namespace DSL {
 
         DslReturnType PphOdeDisplayMetaAllocSizeSet(const char* name, uint size);
 
+        DslReturnType PphOdeParallelModeGet(const char* name, 
+            boolean* enabled, uint* workers);
+
+        DslReturnType PphOdeParallelModeSet(const char* name, 
+            boolean enabled, uint workers);
+
+        DslReturnType PphOdeStatsEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType PphOdeStatsEnabledSet(const char* name, boolean enabled);
+
+        DslReturnType PphOdeStatsTriggerGet(const char* name, 
+            const char* trigger, uint phase, dsl_latency_stats* stats);
+
+        DslReturnType PphOdeStatsActionGet(const char* name, 
+            const char* action, dsl_latency_stats* stats);
+
+        DslReturnType PphOdeStatsFrameGet(const char* name, 
+            dsl_latency_stats* stats);
+
+        DslReturnType PphOdeStatsClear(const char* name);
+
+        DslReturnType PphOdeStatsBudgetGet(const char* name, uint* budget);
+
+        DslReturnType PphOdeStatsBudgetSet(const char* name, uint budget,
+            dsl_pph_ode_budget_overrun_handler_cb handler, void* clientData);
+
         DslReturnType PphNmpNew(const char* name, const char* labelFile,
             uint processMethod, uint matchMethod, float matchThreshold);
             
@@ -776,6 +832,20 @@ namespace DSL {
 
         DslReturnType SourceAppSamplePush(const char* name, void* sample);
 
+        DslReturnType SourceAppBuffersPush(const char* name, 
+            void** buffers, uint numBuffers);
+
+        DslReturnType SourceAppBuffersPushWrapped(const char* name, 
+            const dsl_source_app_wrapped_buffer* buffers, uint numBuffers,
+            dsl_source_app_buffer_release_cb releaseCb);
+
+        DslReturnType SourceAppBufferPoolSizeGet(const char* name, uint* size);
+
+        DslReturnType SourceAppBufferPoolSizeSet(const char* name, uint size);
+
+        DslReturnType SourceAppBufferPoolAcquire(const char* name, 
+            void** buffer, void** data, uint64_t* size);
+
         DslReturnType SourceAppEos(const char* name);
         
         DslReturnType SourceAppStreamFormatGet(const char* name,
@@ -809,6 +879,23 @@ namespace DSL {
 //        DslReturnType SourceAppLeakyTypeSet(const char* name,
 //            uint leakyType);
 
+        DslReturnType SourceShmNew(const char* name, const char* shmName,
+            const char* bufferInFormat, uint width, uint height, 
+            uint fpsN, uint fpsD, uint numSlots);
+
+        DslReturnType SourceShmStatsGet(const char* name, 
+            dsl_shm_source_stats* stats);
+
+        DslReturnType SourceShmStatsClear(const char* name);
+
+        DslReturnType SourceMetaReplayNew(const char* name, const char* filePath,
+            double speed, uint surfaceType, uint width, uint height);
+
+        DslReturnType SourceMetaReplayStatsGet(const char* name, 
+            dsl_meta_replay_source_stats* stats);
+
+        DslReturnType SourceMetaReplayStatsClear(const char* name);
+
         DslReturnType SourceCsiNew(const char* name, 
             uint width, uint height, uint fpsN, uint fpsD);
             
@@ -983,6 +1070,17 @@ namespace DSL {
         
         DslReturnType SourceRtspConnectionStatsClear(const char* name);
 
+        DslReturnType SourceRtspReconnectionParamsGet(uint* maxConcurrent, 
+            uint* maxBackoff);
+
+        DslReturnType SourceRtspReconnectionParamsSet(uint maxConcurrent, 
+            uint maxBackoff);
+
+        DslReturnType SourceRtspReconnectionStatsGet(
+            dsl_rtsp_reconnection_stats* stats);
+
+        DslReturnType SourceRtspReconnectionStatsClear();
+
         DslReturnType SourceRtspLatencyGet(const char* name, 
             uint* latency);
 
@@ -1369,6 +1467,34 @@ namespace DSL {
 
         DslReturnType SinkAppDataTypeSet(const char* name, uint dataType);
 
+        DslReturnType SinkAppDeliverySettingsGet(const char* name, 
+            uint* queueSize, uint* policy, uint* batchSize);
+
+        DslReturnType SinkAppDeliverySettingsSet(const char* name, 
+            uint queueSize, uint policy, uint batchSize);
+
+        DslReturnType SinkAppDeliveryStatsGet(const char* name,
+            dsl_sink_app_delivery_stats* stats);
+
+        DslReturnType SinkAppDeliveryStatsClear(const char* name);
+
+        DslReturnType SinkShmNew(const char* name, const char* shmName,
+            uint dataType, const char* bufferOutFormat, uint width, uint height,
+            uint numSlots);
+
+        DslReturnType SinkShmStatsGet(const char* name, 
+            dsl_shm_sink_stats* stats);
+
+        DslReturnType SinkShmStatsClear(const char* name);
+
+        DslReturnType SinkMetaExportNew(const char* name, uint transport,
+            const char* location, uint compressionLevel, uint queueSize);
+
+        DslReturnType SinkMetaExportStatsGet(const char* name,
+            dsl_meta_export_sink_stats* stats);
+
+        DslReturnType SinkMetaExportStatsClear(const char* name);
+
         DslReturnType SinkFakeNew(const char* name);
 
         // ---------------------------------------------------------------------------
@@ -1739,6 +1865,11 @@ namespace DSL {
 
         DslReturnType PipelineComponentRemove(const char* name, const char* component);
 
+        DslReturnType PipelineNewFromSpec(const char* spec);
+
+        DslReturnType PipelineStartupTimingsGet(const char* name,
+            const dsl_component_startup_timing** timings, uint* size);
+
         //----------------------------------------------------------------------------
         // NEW STREAMMUX SERVICES - Start
         //----------------------------------------------------------------------------
@@ -1866,6 +1997,37 @@ namespace DSL {
         DslReturnType PipelineErrorMessageLastGet(const char* name,
             std::wstring& source, std::wstring& message);
                         
+        DslReturnType PipelineLatencyPointAdd(const char* name, 
+            const char* component, uint pad, boolean terminal);
+                        
+        DslReturnType PipelineLatencyPointPreviousSet(const char* name, 
+            const char* component, uint pad, 
+            const char* previous, uint previousPad);
+                        
+        DslReturnType PipelineLatencyPointRemove(const char* name, 
+            const char* component, uint pad);
+                        
+        DslReturnType PipelineLatencyEnabledGet(const char* name, 
+            boolean* enabled);
+                        
+        DslReturnType PipelineLatencyEnabledSet(const char* name, 
+            boolean enabled);
+                        
+        DslReturnType PipelineLatencyPointStatsGet(const char* name, 
+            const char* component, uint pad, dsl_latency_stats* stats);
+                        
+        DslReturnType PipelineLatencyTotalStatsGet(const char* name, 
+            dsl_latency_stats* stats);
+                        
+        DslReturnType PipelineLatencyStatsClear(const char* name);
+                        
+        DslReturnType PipelineLatencyReportHandlerAdd(const char* name, 
+            dsl_pipeline_latency_report_handler_cb handler, uint interval, 
+            void* clientData);
+                        
+        DslReturnType PipelineLatencyReportHandlerRemove(const char* name, 
+            dsl_pipeline_latency_report_handler_cb handler);
+                        
         DslReturnType PipelineMainLoopNew(const char* name);
 
         DslReturnType PipelineMainLoopRun(const char* name);
@@ -2043,6 +2205,17 @@ namespace DSL {
         
         DslReturnType InfoLogFunctionRestore();
         
+        DslReturnType InfoCallbackDispatcherParamsGet(uint* queueCapacity,
+            uint* slowThreshold);
+        
+        DslReturnType InfoCallbackDispatcherParamsSet(uint queueCapacity,
+            uint slowThreshold);
+        
+        DslReturnType InfoCallbackDispatcherStatsGet(
+            const dsl_callback_listener_stats** stats, uint* size);
+        
+        DslReturnType InfoCallbackDispatcherStatsClear();
+        
         FILE* InfoLogFileHandleGet();
 
         DslReturnType SetSpdLogger(spdlog::logger* logger);
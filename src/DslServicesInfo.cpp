@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslServices.h"
+#include "DslCallbackDispatcher.h"
 #include "spdlog/spdlog.h"
 
 namespace DSL
@@ -354,6 +355,103 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::InfoCallbackDispatcherParamsGet(uint* queueCapacity,
+        uint* slowThreshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            CallbackDispatcher::GetDispatcher()->GetParams(
+                queueCapacity, slowThreshold);
+
+            LOG_INFO("Callback dispatcher params returned Queue Capacity = " 
+                << *queueCapacity << " and Slow Threshold = " << *slowThreshold 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting callback dispatcher params");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoCallbackDispatcherParamsSet(uint queueCapacity,
+        uint slowThreshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            if (!CallbackDispatcher::GetDispatcher()->SetParams(
+                queueCapacity, slowThreshold))
+            {
+                LOG_ERROR("Failed to set callback dispatcher params");
+                return DSL_RESULT_FAILURE;
+            }
+            LOG_INFO("Callback dispatcher params set Queue Capacity = " 
+                << queueCapacity << " and Slow Threshold = " << slowThreshold 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception setting callback dispatcher params");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoCallbackDispatcherStatsGet(
+        const dsl_callback_listener_stats** stats, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            const std::vector<dsl_callback_listener_stats>& listenerStats = 
+                CallbackDispatcher::GetDispatcher()->GetStats();
+                
+            *stats = (listenerStats.size()) ? &listenerStats[0] : NULL;
+            *size = listenerStats.size();
+
+            LOG_INFO("Callback dispatcher stats returned for " << *size 
+                << " listeners successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting callback dispatcher stats");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoCallbackDispatcherStatsClear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            CallbackDispatcher::GetDispatcher()->ClearStats();
+
+            LOG_INFO("Callback dispatcher stats cleared successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception clearing callback dispatcher stats");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
     static void gst_to_spdlog_log_function(GstDebugCategory *category, GstDebugLevel level,
         const gchar *file, const gchar *function, gint line,
         GObject *object, GstDebugMessage *message, gpointer user_data)
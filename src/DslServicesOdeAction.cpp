@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslServicesValidate.h"
 #include "DslOdeAction.h"
+#include "DslAsyncActionExecutor.h"
 
 namespace DSL
 {
@@ -2326,4 +2327,96 @@ namespace DSL
         
         return m_odeActions.size();
     }
+
+    DslReturnType Services::OdeActionExecutorParamsGet(uint* maxWorkers, 
+        uint* queueCapacity)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            AsyncActionExecutor::GetExecutor()->GetParams(
+                maxWorkers, queueCapacity);
+
+            LOG_INFO("ODE Action executor params returned Max Workers = " 
+                << *maxWorkers << " and Queue Capacity = " << *queueCapacity 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action executor threw exception getting params");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionExecutorParamsSet(uint maxWorkers, 
+        uint queueCapacity)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            if (!AsyncActionExecutor::GetExecutor()->SetParams(
+                maxWorkers, queueCapacity))
+            {
+                LOG_ERROR("Failed to set ODE Action executor params");
+                return DSL_RESULT_ODE_ACTION_SET_FAILED;
+            }
+            LOG_INFO("ODE Action executor params set Max Workers = " 
+                << maxWorkers << " and Queue Capacity = " << queueCapacity 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action executor threw exception setting params");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionExecutorStatsGet(
+        dsl_ode_action_executor_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            AsyncActionExecutor::GetExecutor()->GetStats(stats);
+
+            LOG_INFO("ODE Action executor stats returned successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action executor threw exception getting stats");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionExecutorStatsClear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            AsyncActionExecutor::GetExecutor()->ClearStats();
+
+            LOG_INFO("ODE Action executor stats cleared successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action executor threw exception clearing stats");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
 }
\ No newline at end of file
@@ -192,6 +192,61 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeHeatMapperModeGet(const char* name,
+        uint* mode, uint* interval, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            m_odeHeatMappers[name]->GetMode(mode, interval, size);
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned Mode settings successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting Mode settings");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeHeatMapperModeSet(const char* name,
+        uint mode, uint interval, uint size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            if (!m_odeHeatMappers[name]->SetMode(mode, interval, size))
+            {
+                LOG_ERROR("ODE HeatMapper '" << name 
+                    << "' failed to set Mode settings");
+                return DSL_RESULT_ODE_HEAT_MAPPER_SET_FAILED;
+            }
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' set Mode settings successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception setting Mode settings");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeHeatMapperMetricsClear(const char* name)
     {
         LOG_FUNC();
@@ -241,6 +296,36 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeHeatMapperSourceMetricsGet(const char* name,
+        uint sourceId, const uint64_t** buffer, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            if (!m_odeHeatMappers[name]->GetSourceMetrics(sourceId, buffer, size))
+            {
+                LOG_ERROR("ODE Heat-Mapper '" << name 
+                    << "' has no metrics for source_id = " << sourceId);
+                return DSL_RESULT_ODE_HEAT_MAPPER_SOURCE_NOT_FOUND;
+            }
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned metrics for source_id = " << sourceId
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting source metrics");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeHeatMapperMetricsPrint(const char* name)
     {
         LOG_FUNC();
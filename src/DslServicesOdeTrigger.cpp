@@ -1035,6 +1035,37 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerCountsGet(const char* name, 
+        uint64_t* events, uint64_t* frames, uint64_t* accumulated)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            *events = pOdeTrigger->GetEventCount();
+            *frames = pOdeTrigger->GetFrameCount();
+            *accumulated = pOdeTrigger->GetOccurrencesAccumulated();
+            
+            LOG_INFO("ODE Trigger '" << name << "' returned events = " 
+                << *events << ", frames = " << *frames << ", accumulated = " 
+                << *accumulated << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting counts");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerResetTimeoutGet(const char* name, uint* timeout)
     {
         LOG_FUNC();
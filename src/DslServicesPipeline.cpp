@@ -28,8 +28,415 @@ THE SOFTWARE.
 #include "DslServicesValidate.h"
 #include "DslPipelineBintr.h"
 
+#include <json-glib/json-glib.h>
+#include <atomic>
+#include <functional>
+#include <set>
+#include <thread>
+
 namespace DSL
 {
+    /**
+     * @brief map of JSON spec component types to the GST Element Factories 
+     * each uses. Used to load the required plugins in parallel before 
+     * construction. Factories not registered on the platform are skipped.
+     */
+    static const std::map<std::string, std::vector<std::string>> specTypeFactories = 
+    {
+        {"source-uri", {"uridecodebin", "nvvideoconvert", "capsfilter", "queue"}},
+        {"source-file", {"uridecodebin", "nvvideoconvert", "capsfilter", "queue"}},
+        {"source-rtsp", {"rtspsrc", "rtph264depay", "rtph265depay", "h264parse", 
+            "h265parse", "nvv4l2decoder", "nvvideoconvert", "capsfilter", "queue"}},
+        {"infer-gie-primary", {"nvinfer", "queue", "tee", "fakesink"}},
+        {"infer-gie-secondary", {"nvinfer", "queue", "tee", "fakesink"}},
+        {"tracker", {"nvtracker", "queue"}},
+        {"tiler", {"nvmultistreamtiler", "queue"}},
+        {"osd", {"nvdsosd", "nvvideoconvert", "queue"}},
+        {"sink-fake", {"fakesink", "queue"}},
+        {"sink-window-egl", {"nveglglessink", "nvegltransform", "queue"}},
+        {"sink-file", {"nvvideoconvert", "capsfilter", "nvv4l2h264enc", 
+            "nvv4l2h265enc", "h264parse", "h265parse", "qtmux", "matroskamux", 
+            "filesink", "queue"}},
+        {"branch", {}},
+        {"tee-demuxer", {"nvstreamdemux", "queue"}},
+        {"tee-splitter", {"tee", "queue"}},
+        {"pph-ode", {}}
+    };
+
+    /**
+     * @brief Loads the plugins for a set of GST Element Factories in parallel. 
+     * Plugin loading is thread-safe in GStreamer and dominates the cost of the
+     * first construction of each element type. The (serial) component 
+     * construction that follows will then only create elements.
+     * @param[in] factoryNames unique set of factory names to load.
+     */
+    static void PreloadElementFactories(const std::set<std::string>& factoryNames)
+    {
+        LOG_FUNC();
+        
+        std::vector<std::string> names(factoryNames.begin(), factoryNames.end());
+        std::atomic<size_t> nextIndex(0);
+        
+        uint numWorkers = std::min<uint>(names.size(), 
+            std::max<uint>(1, std::thread::hardware_concurrency()));
+            
+        std::vector<std::thread> workers;
+        for (uint i = 0; i < numWorkers; i++)
+        {
+            workers.push_back(std::thread([&names, &nextIndex]()
+            {
+                for (size_t j = nextIndex++; j < names.size(); j = nextIndex++)
+                {
+                    GstElementFactory* pFactory = 
+                        Elementr::FindFactory(names[j].c_str());
+                    if (!pFactory)
+                    {
+                        continue;
+                    }
+                    GstPluginFeature* pLoaded = 
+                        gst_plugin_feature_load(GST_PLUGIN_FEATURE(pFactory));
+                    if (pLoaded)
+                    {
+                        gst_object_unref(pLoaded);
+                    }
+                }
+            }));
+        }
+        for (auto& worker: workers)
+        {
+            worker.join();
+        }
+    }
+
+    static const char* SpecStringGet(JsonObject* pObject, 
+        const char* member, const char* defaultValue)
+    {
+        return (json_object_has_member(pObject, member))
+            ? json_object_get_string_member(pObject, member)
+            : defaultValue;
+    }
+
+    static uint SpecUintGet(JsonObject* pObject, 
+        const char* member, uint defaultValue)
+    {
+        return (json_object_has_member(pObject, member))
+            ? (uint)json_object_get_int_member(pObject, member)
+            : defaultValue;
+    }
+
+    static boolean SpecBooleanGet(JsonObject* pObject, 
+        const char* member, boolean defaultValue)
+    {
+        return (json_object_has_member(pObject, member))
+            ? (boolean)json_object_get_boolean_member(pObject, member)
+            : defaultValue;
+    }
+
+    /**
+     * @brief Gets a JSON spec member that is a list of names.
+     * @return vector of names, empty if the member is not present.
+     */
+    static std::vector<std::string> SpecNamesGet(JsonObject* pObject,
+        const char* member)
+    {
+        std::vector<std::string> names;
+        
+        if (json_object_has_member(pObject, member))
+        {
+            JsonArray* pArray = json_object_get_array_member(pObject, member);
+            for (uint i = 0; pArray and i < json_array_get_length(pArray); i++)
+            {
+                const char* name = json_array_get_string_element(pArray, i);
+                if (name)
+                {
+                    names.push_back(name);
+                }
+            }
+        }
+        return names;
+    }
+
+    /**
+     * @brief map of all JSON spec component members to the type of value 
+     * each must hold. Members of type JSON_TYPE_ARRAY must be lists of names.
+     */
+    static const std::map<std::string, GType> specMemberTypes = 
+    {
+        {"name", G_TYPE_STRING},
+        {"type", G_TYPE_STRING},
+        {"uri", G_TYPE_STRING},
+        {"file-path", G_TYPE_STRING},
+        {"config-file", G_TYPE_STRING},
+        {"infer-config-file", G_TYPE_STRING},
+        {"infer-on-gie", G_TYPE_STRING},
+        {"model-engine-file", G_TYPE_STRING},
+        {"add-to", G_TYPE_STRING},
+        {"pad", G_TYPE_STRING},
+        {"is-live", G_TYPE_BOOLEAN},
+        {"repeat-enabled", G_TYPE_BOOLEAN},
+        {"text-enabled", G_TYPE_BOOLEAN},
+        {"clock-enabled", G_TYPE_BOOLEAN},
+        {"bbox-enabled", G_TYPE_BOOLEAN},
+        {"mask-enabled", G_TYPE_BOOLEAN},
+        {"skip-frames", G_TYPE_INT64},
+        {"drop-frame-interval", G_TYPE_INT64},
+        {"protocol", G_TYPE_INT64},
+        {"latency", G_TYPE_INT64},
+        {"timeout", G_TYPE_INT64},
+        {"interval", G_TYPE_INT64},
+        {"width", G_TYPE_INT64},
+        {"height", G_TYPE_INT64},
+        {"x-offset", G_TYPE_INT64},
+        {"y-offset", G_TYPE_INT64},
+        {"codec", G_TYPE_INT64},
+        {"container", G_TYPE_INT64},
+        {"bitrate", G_TYPE_INT64},
+        {"max-branches", G_TYPE_INT64},
+        {"components", JSON_TYPE_ARRAY},
+        {"branches", JSON_TYPE_ARRAY},
+        {"triggers", JSON_TYPE_ARRAY}
+    };
+
+    /**
+     * @brief Checks that a JSON spec member holds a value of the given type.
+     * Integer values must also be in the range of a uint.
+     * @return true if the member is valid, false otherwise.
+     */
+    static bool SpecMemberTypeCheck(JsonNode* pNode, GType type)
+    {
+        if (type == JSON_TYPE_ARRAY)
+        {
+            if (!JSON_NODE_HOLDS_ARRAY(pNode))
+            {
+                return false;
+            }
+            JsonArray* pArray = json_node_get_array(pNode);
+            for (uint i = 0; i < json_array_get_length(pArray); i++)
+            {
+                JsonNode* pElement = json_array_get_element(pArray, i);
+                if (!JSON_NODE_HOLDS_VALUE(pElement) or 
+                    json_node_get_value_type(pElement) != G_TYPE_STRING)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (!JSON_NODE_HOLDS_VALUE(pNode) or 
+            json_node_get_value_type(pNode) != type)
+        {
+            return false;
+        }
+        if (type == G_TYPE_INT64)
+        {
+            gint64 value = json_node_get_int(pNode);
+            return (value >= 0 and value <= G_MAXUINT);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Validates the type of every member of a JSON spec component.
+     * @param[in] pObject JSON object for the component.
+     * @param[in] index index of the component in the Pipeline spec.
+     * @return true if all members are valid, false otherwise.
+     */
+    static bool SpecMembersValidate(JsonObject* pObject, uint index)
+    {
+        std::unique_ptr<GList, void(*)(GList*)> pMembers(
+            json_object_get_members(pObject), g_list_free);
+            
+        for (GList* pMember = pMembers.get(); pMember; pMember = pMember->next)
+        {
+            const char* member = (const char*)pMember->data;
+            
+            auto imap = specMemberTypes.find(member);
+            if (imap != specMemberTypes.end() and !SpecMemberTypeCheck(
+                json_object_get_member(pObject, member), imap->second))
+            {
+                LOG_ERROR("Member '" << member << "' of component " << index 
+                    << " in Pipeline spec has an invalid value type");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Creates a new component - or Pad Probe Handler - of a given
+     * JSON spec type by calling on the type's constructor service.
+     * @return the constructor service's return value, or 
+     * DSL_RESULT_PIPELINE_SPEC_INVALID if the type is not supported.
+     */
+    static DslReturnType SpecComponentNew(Services* pServices, 
+        const std::string& type, const char* name, JsonObject* pObject)
+    {
+        if (type == "source-uri")
+        {
+            return pServices->SourceUriNew(name, 
+                SpecStringGet(pObject, "uri", ""),
+                SpecBooleanGet(pObject, "is-live", false),
+                SpecUintGet(pObject, "skip-frames", 0),
+                SpecUintGet(pObject, "drop-frame-interval", 0));
+        }
+        if (type == "source-file")
+        {
+            return pServices->SourceFileNew(name, 
+                SpecStringGet(pObject, "file-path", ""),
+                SpecBooleanGet(pObject, "repeat-enabled", false));
+        }
+        if (type == "source-rtsp")
+        {
+            return pServices->SourceRtspNew(name, 
+                SpecStringGet(pObject, "uri", ""),
+                SpecUintGet(pObject, "protocol", DSL_RTP_ALL),
+                SpecUintGet(pObject, "skip-frames", 0),
+                SpecUintGet(pObject, "drop-frame-interval", 0),
+                SpecUintGet(pObject, "latency", 100),
+                SpecUintGet(pObject, "timeout", 2));
+        }
+        if (type == "infer-gie-primary")
+        {
+            return pServices->InferPrimaryGieNew(name, 
+                SpecStringGet(pObject, "infer-config-file", ""),
+                SpecStringGet(pObject, "model-engine-file", ""),
+                SpecUintGet(pObject, "interval", 0));
+        }
+        if (type == "infer-gie-secondary")
+        {
+            return pServices->InferSecondaryGieNew(name, 
+                SpecStringGet(pObject, "infer-config-file", ""),
+                SpecStringGet(pObject, "model-engine-file", ""),
+                SpecStringGet(pObject, "infer-on-gie", ""),
+                SpecUintGet(pObject, "interval", 0));
+        }
+        if (type == "tracker")
+        {
+            return pServices->TrackerNew(name, 
+                SpecStringGet(pObject, "config-file", ""),
+                SpecUintGet(pObject, "width", 0),
+                SpecUintGet(pObject, "height", 0));
+        }
+        if (type == "tiler")
+        {
+            return pServices->TilerNew(name, 
+                SpecUintGet(pObject, "width", 0),
+                SpecUintGet(pObject, "height", 0));
+        }
+        if (type == "osd")
+        {
+            return pServices->OsdNew(name, 
+                SpecBooleanGet(pObject, "text-enabled", true),
+                SpecBooleanGet(pObject, "clock-enabled", false),
+                SpecBooleanGet(pObject, "bbox-enabled", true),
+                SpecBooleanGet(pObject, "mask-enabled", false));
+        }
+        if (type == "sink-fake")
+        {
+            return pServices->SinkFakeNew(name);
+        }
+        if (type == "sink-window-egl")
+        {
+            return pServices->SinkWindowEglNew(name, 
+                SpecUintGet(pObject, "x-offset", 0),
+                SpecUintGet(pObject, "y-offset", 0),
+                SpecUintGet(pObject, "width", 0),
+                SpecUintGet(pObject, "height", 0));
+        }
+        if (type == "sink-file")
+        {
+            return pServices->SinkFileNew(name, 
+                SpecStringGet(pObject, "file-path", ""),
+                SpecUintGet(pObject, "codec", DSL_CODEC_H264),
+                SpecUintGet(pObject, "container", DSL_CONTAINER_MP4),
+                SpecUintGet(pObject, "bitrate", 0),
+                SpecUintGet(pObject, "interval", 0));
+        }
+        if (type == "branch")
+        {
+            return pServices->BranchNew(name);
+        }
+        if (type == "tee-demuxer")
+        {
+            return pServices->TeeDemuxerNew(name, 
+                SpecUintGet(pObject, "max-branches", 1));
+        }
+        if (type == "tee-splitter")
+        {
+            return pServices->TeeSplitterNew(name);
+        }
+        if (type == "pph-ode")
+        {
+            return pServices->PphOdeNew(name);
+        }
+        LOG_ERROR("Unsupported component type '" << type << "' in Pipeline spec");
+        return DSL_RESULT_PIPELINE_SPEC_INVALID;
+    }
+    
+    /**
+     * @brief Adds or removes a Pad Probe Handler to/from a component of a 
+     * given JSON spec type by calling on the type's PPH service. An empty
+     * type specifies the Pipeline's Streammuxer.
+     * @return the PPH service's return value, or 
+     * DSL_RESULT_PIPELINE_SPEC_INVALID if the type does not support handlers.
+     */
+    static DslReturnType SpecPphAddRemove(Services* pServices, 
+        const std::string& type, const char* component, const char* handler, 
+        uint pad, bool add)
+    {
+        if (type.empty())
+        {
+            return (add)
+                ? pServices->PipelineStreammuxPphAdd(component, handler)
+                : pServices->PipelineStreammuxPphRemove(component, handler);
+        }
+        if (type.find("source-") == 0)
+        {
+            return (add)
+                ? pServices->SourcePphAdd(component, handler)
+                : pServices->SourcePphRemove(component, handler);
+        }
+        if (type.find("infer-") == 0)
+        {
+            return (add)
+                ? pServices->InferPphAdd(component, handler, pad)
+                : pServices->InferPphRemove(component, handler, pad);
+        }
+        if (type == "tracker")
+        {
+            return (add)
+                ? pServices->TrackerPphAdd(component, handler, pad)
+                : pServices->TrackerPphRemove(component, handler, pad);
+        }
+        if (type == "tiler")
+        {
+            return (add)
+                ? pServices->TilerPphAdd(component, handler, pad)
+                : pServices->TilerPphRemove(component, handler, pad);
+        }
+        if (type == "osd")
+        {
+            return (add)
+                ? pServices->OsdPphAdd(component, handler, pad)
+                : pServices->OsdPphRemove(component, handler, pad);
+        }
+        if (type.find("sink-") == 0)
+        {
+            return (add)
+                ? pServices->SinkPphAdd(component, handler)
+                : pServices->SinkPphRemove(component, handler);
+        }
+        if (type.find("tee-") == 0)
+        {
+            return (add)
+                ? pServices->TeePphAdd(component, handler)
+                : pServices->TeePphRemove(component, handler);
+        }
+        LOG_ERROR("Component '" << component << "' of type '" << type 
+            << "' does not support Pad Probe Handlers");
+        return DSL_RESULT_PIPELINE_SPEC_INVALID;
+    }
+
     DslReturnType Services::PipelineNew(const char* name)
     {
         LOG_FUNC();
@@ -182,6 +589,327 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::PipelineNewFromSpec(const char* spec)
+    {
+        LOG_FUNC();
+        
+        // IMPORTANT! the services mutex is not held here. The Pipeline is built
+        // by calling on the public services, each of which locks the mutex.
+
+        std::unique_ptr<JsonParser, void(*)(gpointer)> pParser(
+            json_parser_new(), g_object_unref);
+        GError* pError(NULL);
+        
+        if (!json_parser_load_from_data(pParser.get(), spec, -1, &pError))
+        {
+            LOG_ERROR("Failed to parse Pipeline spec: " << pError->message);
+            g_error_free(pError);
+            return DSL_RESULT_PIPELINE_SPEC_INVALID;
+        }
+        JsonNode* pRootNode = json_parser_get_root(pParser.get());
+        if (!pRootNode or !JSON_NODE_HOLDS_OBJECT(pRootNode))
+        {
+            LOG_ERROR("Pipeline spec must be a JSON object");
+            return DSL_RESULT_PIPELINE_SPEC_INVALID;
+        }
+        JsonObject* pRootObject = json_node_get_object(pRootNode);
+        
+        if (!json_object_has_member(pRootObject, "name") or
+            !json_object_has_member(pRootObject, "components"))
+        {
+            LOG_ERROR("Pipeline spec requires both 'name' and 'components' members");
+            return DSL_RESULT_PIPELINE_SPEC_INVALID;
+        }
+        if (!SpecMemberTypeCheck(json_object_get_member(pRootObject, "name"),
+            G_TYPE_STRING))
+        {
+            LOG_ERROR("Pipeline spec member 'name' must be a string");
+            return DSL_RESULT_PIPELINE_SPEC_INVALID;
+        }
+        const char* pipelineName = SpecStringGet(pRootObject, "name", NULL);
+        
+        JsonNode* pComponentsNode = 
+            json_object_get_member(pRootObject, "components");
+        if (!JSON_NODE_HOLDS_ARRAY(pComponentsNode))
+        {
+            LOG_ERROR("Pipeline spec member 'components' must be an array");
+            return DSL_RESULT_PIPELINE_SPEC_INVALID;
+        }
+        JsonArray* pComponents = json_node_get_array(pComponentsNode);
+        
+        // First pass: validate each component spec, collecting the component
+        // types by name, the set of factories to preload, and the names of all
+        // components that are children of a Branch or Tee in this spec.
+        std::vector<std::pair<std::string, JsonObject*>> componentSpecs;
+        std::map<std::string, std::string> componentTypes;
+        std::set<std::string> factoryNames;
+        std::set<std::string> childNames;
+
+        for (uint i = 0; i < json_array_get_length(pComponents); i++)
+        {
+            JsonNode* pNode = json_array_get_element(pComponents, i);
+            if (!JSON_NODE_HOLDS_OBJECT(pNode))
+            {
+                LOG_ERROR("Component " << i 
+                    << " in Pipeline spec must be a JSON object");
+                return DSL_RESULT_PIPELINE_SPEC_INVALID;
+            }
+            JsonObject* pObject = json_node_get_object(pNode);
+            if (!SpecMembersValidate(pObject, i))
+            {
+                return DSL_RESULT_PIPELINE_SPEC_INVALID;
+            }
+            const char* name = (pObject) 
+                ? SpecStringGet(pObject, "name", NULL) : NULL;
+            const char* type = (pObject) 
+                ? SpecStringGet(pObject, "type", NULL) : NULL;
+            if (!name or !type)
+            {
+                LOG_ERROR("Component " << i 
+                    << " in Pipeline spec requires both 'name' and 'type' members");
+                return DSL_RESULT_PIPELINE_SPEC_INVALID;
+            }
+            if (specTypeFactories.find(type) == specTypeFactories.end())
+            {
+                LOG_ERROR("Component '" << name << "' in Pipeline spec has "
+                    << "unsupported type '" << type << "'");
+                return DSL_RESULT_PIPELINE_SPEC_INVALID;
+            }
+            if (componentTypes.find(name) != componentTypes.end())
+            {
+                LOG_ERROR("Component name '" << name 
+                    << "' is not unique in Pipeline spec");
+                return DSL_RESULT_PIPELINE_SPEC_INVALID;
+            }
+            componentSpecs.push_back(std::make_pair(std::string(name), pObject));
+            componentTypes[name] = type;
+            
+            for (auto const& factoryName: specTypeFactories.at(type))
+            {
+                factoryNames.insert(factoryName);
+            }
+            for (auto const& childName: SpecNamesGet(pObject, 
+                (std::string(type) == "branch") ? "components" : "branches"))
+            {
+                childNames.insert(childName);
+            }
+        }
+        
+        // Pipelines always include the Streammuxer in the PipelineSourcesBintr.
+        factoryNames.insert("nvstreammux");
+        
+        gint64 preloadStartTime = g_get_monotonic_time();
+        PreloadElementFactories(factoryNames);
+        LOG_INFO("Preloaded " << factoryNames.size() << " element factories in "
+            << g_get_monotonic_time() - preloadStartTime << " us");
+
+        // Every step below that succeeds pushes its undo operation. On failure
+        // the undo operations are called in reverse order leaving no trace.
+        std::vector<std::function<void()>> undoOperations;
+        auto undoAll = [&undoOperations](DslReturnType retval)
+        {
+            for (auto iundo = undoOperations.rbegin(); 
+                iundo != undoOperations.rend(); iundo++)
+            {
+                (*iundo)();
+            }
+            return retval;
+        };
+        std::string pipeline(pipelineName);
+        std::vector<uint64_t> constructTimes;
+        
+        gint64 constructStartTime = g_get_monotonic_time();
+        DslReturnType retval = PipelineNew(pipeline.c_str());
+        if (retval != DSL_RESULT_SUCCESS)
+        {
+            return retval;
+        }
+        constructTimes.push_back(g_get_monotonic_time() - constructStartTime);
+        undoOperations.push_back([this, pipeline]()
+            {PipelineDelete(pipeline.c_str());});
+        
+        // Second pass: construct each component in spec order.
+        for (auto const& ivec: componentSpecs)
+        {
+            std::string name(ivec.first);
+            const std::string& type(componentTypes[name]);
+            
+            constructStartTime = g_get_monotonic_time();
+            retval = SpecComponentNew(this, type, name.c_str(), ivec.second);
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                LOG_ERROR("Failed to create component '" << name 
+                    << "' for Pipeline '" << pipeline << "'");
+                return undoAll(retval);
+            }
+            constructTimes.push_back(g_get_monotonic_time() - constructStartTime);
+            
+            if (type.find("pph-") == 0)
+            {
+                undoOperations.push_back([this, name]()
+                    {PphDelete(name.c_str());});
+            }
+            else
+            {
+                undoOperations.push_back([this, name]()
+                    {ComponentDelete(name.c_str());});
+            }
+        }
+        
+        // Third pass: add children to their Branches and Tees, and add 
+        // Triggers and Pad Probe Handlers to their parents.
+        for (auto const& ivec: componentSpecs)
+        {
+            std::string name(ivec.first);
+            const std::string& type(componentTypes[name]);
+            
+            if (type == "branch")
+            {
+                for (auto const& child: SpecNamesGet(ivec.second, "components"))
+                {
+                    retval = BranchComponentAdd(name.c_str(), child.c_str());
+                    if (retval != DSL_RESULT_SUCCESS)
+                    {
+                        return undoAll(retval);
+                    }
+                    undoOperations.push_back([this, name, child]()
+                        {BranchComponentRemove(name.c_str(), child.c_str());});
+                }
+            }
+            else if (type.find("tee-") == 0)
+            {
+                for (auto const& branch: SpecNamesGet(ivec.second, "branches"))
+                {
+                    retval = TeeBranchAdd(name.c_str(), branch.c_str());
+                    if (retval != DSL_RESULT_SUCCESS)
+                    {
+                        return undoAll(retval);
+                    }
+                    undoOperations.push_back([this, name, branch]()
+                        {TeeBranchRemove(name.c_str(), branch.c_str());});
+                }
+            }
+            else if (type == "pph-ode")
+            {
+                for (auto const& trigger: SpecNamesGet(ivec.second, "triggers"))
+                {
+                    retval = PphOdeTriggerAdd(name.c_str(), trigger.c_str());
+                    if (retval != DSL_RESULT_SUCCESS)
+                    {
+                        return undoAll(retval);
+                    }
+                    undoOperations.push_back([this, name, trigger]()
+                        {PphOdeTriggerRemove(name.c_str(), trigger.c_str());});
+                }
+            }
+            if (type.find("pph-") == 0 and 
+                json_object_has_member(ivec.second, "add-to"))
+            {
+                std::string parent(SpecStringGet(ivec.second, "add-to", ""));
+                std::string padName(SpecStringGet(ivec.second, "pad", "src"));
+                uint pad = (padName == "sink") ? DSL_PAD_SINK : DSL_PAD_SRC;
+                
+                // The Pipeline's own name specifies its Streammuxer 
+                std::string parentType;
+                if (parent != pipeline)
+                {
+                    if (componentTypes.find(parent) == componentTypes.end())
+                    {
+                        LOG_ERROR("Pad Probe Handler '" << name 
+                            << "' must be added to a component in the Pipeline spec");
+                        return undoAll(DSL_RESULT_PIPELINE_SPEC_INVALID);
+                    }
+                    parentType = componentTypes[parent];
+                }
+                retval = SpecPphAddRemove(this, parentType, 
+                    parent.c_str(), name.c_str(), pad, true);
+                if (retval != DSL_RESULT_SUCCESS)
+                {
+                    return undoAll(retval);
+                }
+                undoOperations.push_back([this, parentType, parent, name, pad]()
+                    {SpecPphAddRemove(this, parentType, 
+                        parent.c_str(), name.c_str(), pad, false);});
+            }
+        }
+        
+        // Fourth pass: add all remaining components to the Pipeline in 
+        // spec order.
+        for (auto const& ivec: componentSpecs)
+        {
+            std::string name(ivec.first);
+            if (componentTypes[name].find("pph-") == 0 or childNames.count(name))
+            {
+                continue;
+            }
+            retval = PipelineComponentAdd(pipeline.c_str(), name.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return undoAll(retval);
+            }
+            undoOperations.push_back([this, pipeline, name]()
+                {PipelineComponentRemove(pipeline.c_str(), name.c_str());});
+        }
+        
+        // Finally, add all components to the Pipeline's startup profile.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_PIPELINE_PTR pPipeline = m_pipelines[pipeline];
+            pPipeline->AddStartupProfileComponent(pPipeline, constructTimes[0]);
+            
+            for (uint i = 0; i < componentSpecs.size(); i++)
+            {
+                const std::string& name(componentSpecs[i].first);
+                DSL_BASE_PTR pComponent = 
+                    (componentTypes[name].find("pph-") == 0)
+                    ? std::dynamic_pointer_cast<Base>(m_padProbeHandlers[name])
+                    : std::dynamic_pointer_cast<Base>(m_components[name]);
+                    
+                pPipeline->AddStartupProfileComponent(pComponent, 
+                    constructTimes[i+1]);
+            }
+            LOG_INFO("New PIPELINE '" << pipeline << "' with " 
+                << componentSpecs.size() 
+                << " components created from spec successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw exception creating startup profile");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineStartupTimingsGet(const char* name,
+        const dsl_component_startup_timing** timings, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            const std::vector<dsl_component_startup_timing>& startupTimings = 
+                m_pipelines[name]->GetStartupTimings();
+                
+            *timings = (startupTimings.size()) ? &startupTimings[0] : NULL;
+            *size = startupTimings.size();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting startup timings");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
     //----------------------------------------------------------------------------
     // NEW STREAMMUX SERVICES - Start
     //----------------------------------------------------------------------------
@@ -1352,6 +2080,310 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::PipelineLatencyPointAdd(const char* name, 
+        const char* component, uint pad, boolean terminal)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad 
+                    << " for Latency Point on Pipeline '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
+            
+            // The Pipeline's own name is used for the src pad of its Streammuxer
+            DSL_BASE_PTR pComponent;
+            if (std::string(name) == component and pad == DSL_PAD_SRC)
+            {
+                pComponent = m_pipelines[name]->GetPipelineSourcesBintr();
+            }
+            else
+            {
+                DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+                pComponent = m_components[component];
+            }
+            if (!m_pipelines[name]->AddLatencyPoint(component, 
+                pComponent, pad, terminal))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to add a Latency Point to component '" 
+                    << component << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_POINT_ADD_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' added a Latency Point to component '" << component 
+                << "' successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception adding a Latency Point");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyPointPreviousSet(const char* name, 
+        const char* component, uint pad, const char* previous, uint previousPad)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            if (!m_pipelines[name]->GetLatencyPoint(component, pad))
+            {
+                LOG_ERROR("Latency Point for component '" << component
+                    << "' was not found for Pipeline '" << name << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND;
+            }
+            if (!m_pipelines[name]->SetLatencyPointPrevious(component, pad,
+                previous, previousPad))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to set the previous Latency Point for component '" 
+                    << component << "'");
+                return DSL_RESULT_PIPELINE_SET_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' set the previous Latency Point for component '" 
+                << component << "' to component '" << previous 
+                << "' successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception setting a previous Latency Point");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyPointRemove(const char* name, 
+        const char* component, uint pad)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            if (!m_pipelines[name]->RemoveLatencyPoint(component, pad))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to remove a Latency Point from component '" 
+                    << component << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_POINT_REMOVE_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' removed a Latency Point from component '" << component 
+                << "' successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception removing a Latency Point");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyEnabledGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            *enabled = m_pipelines[name]->GetLatencyEnabled();
+
+            LOG_INFO("Pipeline '" << name 
+                << "' returned Latency Enabled = " << *enabled 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting Latency Enabled");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyEnabledSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            m_pipelines[name]->SetLatencyEnabled(enabled);
+
+            LOG_INFO("Pipeline '" << name 
+                << "' set Latency Enabled = " << enabled << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception setting Latency Enabled");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyPointStatsGet(const char* name, 
+        const char* component, uint pad, dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            if (!m_pipelines[name]->GetLatencyPointStats(component, pad, stats))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' has no Latency Point for component '" << component 
+                    << "' and pad = " << pad);
+                return DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting Latency Point stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyTotalStatsGet(const char* name, 
+        dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            m_pipelines[name]->GetLatencyTotalStats(stats);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception getting total Latency stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            m_pipelines[name]->ClearLatencyStats();
+
+            LOG_INFO("Pipeline '" << name 
+                << "' cleared its Latency stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception clearing Latency stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyReportHandlerAdd(const char* name, 
+        dsl_pipeline_latency_report_handler_cb handler, uint interval, 
+        void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            if (!m_pipelines[name]->AddLatencyReportHandler(handler, 
+                interval, clientData))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to add a Latency Report Handler");
+                return DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' added Latency Report Handler successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception adding a Latency Report Handler");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::PipelineLatencyReportHandlerRemove(const char* name, 
+        dsl_pipeline_latency_report_handler_cb handler)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            DSL_RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, name);
+
+            if (!m_pipelines[name]->RemoveLatencyReportHandler(handler))
+            {
+                LOG_ERROR("Pipeline '" << name 
+                    << "' failed to remove a Latency Report Handler");
+                return DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED;
+            }
+            LOG_INFO("Pipeline '" << name 
+                << "' removed Latency Report Handler successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << name 
+                << "' threw an exception removing a Latency Report Handler");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::PipelineMainLoopNew(const char* name)
     {
         LOG_FUNC();
@@ -169,6 +169,113 @@ namespace DSL
             return DSL_RESULT_PPH_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::PphMeterStatsNew(const char* name, uint interval, 
+        dsl_pph_meter_stats_handler_cb statsHandler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Meter Pad Probe Handler name '" << name 
+                    << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            if (!interval)
+            {
+                LOG_ERROR("Meter Pad Probe Handler '" << name 
+                    << "' failed to set property, interval must be greater than 0");
+                return DSL_RESULT_PPH_METER_INVALID_INTERVAL;
+            }
+            m_padProbeHandlers[name] = DSL_PPH_METER_STATS_NEW(name, 
+                interval, statsHandler, clientData);
+
+            LOG_INFO("New Meter Pad Probe Handler '" << name 
+                << "' with stats handler created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Meter Pad Probe Handler '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMeterStallThresholdGet(const char* name, 
+        uint* threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MeterPadProbeHandler);
+
+            DSL_PPH_METER_PTR pMeter = 
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            *threshold = pMeter->GetStallThreshold();
+
+            LOG_INFO("Meter Pad Probe Handler '" << name 
+                << "' returned Stall Threshold = " << *threshold 
+                << "ms successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meter Pad Probe Handler '" << name 
+                << "' threw an exception getting stall threshold");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMeterStallThresholdSet(const char* name, 
+        uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                MeterPadProbeHandler);
+            
+            if (!threshold)
+            {
+                LOG_ERROR("Meter Pad Probe Handler '" << name 
+                    << "' failed to set property, stall threshold must be greater than 0");
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+
+            DSL_PPH_METER_PTR pMeter = 
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(
+                    m_padProbeHandlers[name]);
+
+            pMeter->SetStallThreshold(threshold);
+
+            LOG_INFO("Meter Pad Probe Handler '" << name 
+                << "' set Stall Threshold = " << threshold << "ms successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meter Pad Probe Handler '" << name 
+                << "' threw an exception setting stall threshold");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
     
     DslReturnType Services::PphOdeNew(const char* name)
     {
@@ -372,6 +479,332 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PphOdeParallelModeGet(const char* name, 
+        boolean* enabled, uint* workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            bool bEnabled(false);
+            pOde->GetParallelMode(&bEnabled, workers);
+            *enabled = bEnabled;
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned parallel mode = " << *enabled 
+                << " with " << *workers << " workers successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting parallel mode");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeParallelModeSet(const char* name, 
+        boolean enabled, uint workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+            
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]); 
+
+            pOde->SetParallelMode(enabled, workers);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set parallel mode = " << enabled 
+                << " with " << workers << " workers successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting parallel mode");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsEnabledGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            *enabled = pOde->GetStatsEnabled();
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned stats enabled = " << *enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting stats enabled");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsEnabledSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            pOde->SetStatsEnabled(enabled);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set stats enabled = " << enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting stats enabled");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsTriggerGet(const char* name, 
+        const char* trigger, uint phase, dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            if (phase > DSL_PPH_ODE_STATS_PHASE_POST_PROCESS or
+                !pOde->GetStats(trigger, phase, stats))
+            {
+                LOG_ERROR("ODE Pad Probe Handler '" << name 
+                    << "' has no stats for Trigger '" << trigger 
+                    << "' and phase = " << phase);
+                return DSL_RESULT_PPH_STATS_NOT_FOUND;
+            }
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned stats for Trigger '" << trigger << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting Trigger stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsActionGet(const char* name, 
+        const char* action, dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            if (!pOde->GetStats(action, DSL_ODE_STATS_PHASE_ACTION, stats))
+            {
+                LOG_ERROR("ODE Pad Probe Handler '" << name 
+                    << "' has no stats for Action '" << action << "'");
+                return DSL_RESULT_PPH_STATS_NOT_FOUND;
+            }
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned stats for Action '" << action << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting Action stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsFrameGet(const char* name, 
+        dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            pOde->GetFrameStats(stats);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned frame stats successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting frame stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            pOde->ClearStats();
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' cleared stats successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception clearing stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsBudgetGet(const char* name, 
+        uint* budget)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            *budget = pOde->GetFrameBudget();
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned frame budget = " << *budget << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting frame budget");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsBudgetSet(const char* name, 
+        uint budget, dsl_pph_ode_budget_overrun_handler_cb handler, 
+        void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            pOde->SetFrameBudget(budget, handler, clientData);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set frame budget = " << budget << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting frame budget");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphBufferTimeoutNew(const char* name,
         uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* clientData)
     {
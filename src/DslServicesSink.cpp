@@ -128,6 +128,343 @@ namespace DSL
             return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::SinkAppDeliverySettingsGet(const char* name, 
+        uint* queueSize, uint* policy, uint* batchSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            pAppSinkBintr->GetDeliverySettings(queueSize, policy, batchSize);
+            
+            LOG_INFO("App Sink '" << name << "' returned queue-size = " 
+                << *queueSize << ", policy = " << *policy 
+                << ", and batch-size = " << *batchSize << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception getting delivery settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppDeliverySettingsSet(const char* name, 
+        uint queueSize, uint policy, uint batchSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            if (policy > DSL_SINK_APP_DELIVERY_POLICY_BLOCK or !batchSize or
+                (!queueSize and batchSize > 1))
+            {
+                LOG_ERROR("Invalid delivery settings: queue-size = " << queueSize
+                    << ", policy = " << policy << ", batch-size = " << batchSize
+                    << " specified for App Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pAppSinkBintr->SetDeliverySettings(queueSize, policy, batchSize))
+            {
+                LOG_ERROR("App Sink '" << name 
+                    << "' failed to set delivery settings");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            LOG_INFO("App Sink '" << name << "' set queue-size = " 
+                << queueSize << ", policy = " << policy 
+                << ", and batch-size = " << batchSize << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception setting delivery settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppDeliveryStatsGet(const char* name,
+        dsl_sink_app_delivery_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            pAppSinkBintr->GetDeliveryStats(stats);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception getting delivery stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppDeliveryStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            pAppSinkBintr->ClearDeliveryStats();
+
+            LOG_INFO("App Sink '" << name 
+                << "' cleared delivery stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception clearing delivery stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+        
+    DslReturnType Services::SinkShmNew(const char* name, const char* shmName,
+        uint dataType, const char* bufferOutFormat, uint width, uint height,
+        uint numSlots)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (dataType > DSL_SINK_SHM_DATA_TYPE_FRAMES)
+            {
+                LOG_ERROR("Invalid data-type = " << dataType 
+                    << " specified for Shared Memory Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            if (!numSlots)
+            {
+                LOG_ERROR("Invalid num-slots = 0 for new Shared Memory Sink '" 
+                    << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            m_components[name] = DSL_SHM_SINK_NEW(name, shmName, dataType,
+                bufferOutFormat, width, height, numSlots);
+
+            LOG_INFO("New Shared Memory Sink '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Shared Memory Sink '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkShmStatsGet(const char* name,
+        dsl_shm_sink_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                ShmSinkBintr);
+
+            DSL_SHM_SINK_PTR pShmSinkBintr = 
+                std::dynamic_pointer_cast<ShmSinkBintr>(m_components[name]);
+
+            pShmSinkBintr->GetStats(stats);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Memory Sink'" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkShmStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                ShmSinkBintr);
+
+            DSL_SHM_SINK_PTR pShmSinkBintr = 
+                std::dynamic_pointer_cast<ShmSinkBintr>(m_components[name]);
+
+            pShmSinkBintr->ClearStats();
+
+            LOG_INFO("Shared Memory Sink '" << name 
+                << "' cleared stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Memory Sink'" << name 
+                << "' threw an exception clearing stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkMetaExportNew(const char* name, uint transport,
+        const char* location, uint compressionLevel, uint queueSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (transport > DSL_SINK_META_EXPORT_TRANSPORT_TCP)
+            {
+                LOG_ERROR("Invalid transport = " << transport 
+                    << " specified for Metadata Export Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            if (!queueSize or 
+                compressionLevel > DSL_META_EXPORT_MAX_COMPRESSION_LEVEL)
+            {
+                LOG_ERROR("Invalid queue-size = " << queueSize 
+                    << " or compression-level = " << compressionLevel
+                    << " for new Metadata Export Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+#if BUILD_WITH_ZSTD != true
+            if (compressionLevel)
+            {
+                LOG_ERROR("To use compression, set BUILD_WITH_ZSTD=true in the Makefile");
+                return DSL_RESULT_API_NOT_SUPPORTED;
+            }
+#endif
+            m_components[name] = DSL_META_EXPORT_SINK_NEW(name, transport, 
+                location, compressionLevel, queueSize);
+
+            LOG_INFO("New Metadata Export Sink '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Metadata Export Sink '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkMetaExportStatsGet(const char* name,
+        dsl_meta_export_sink_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                MetaExportSinkBintr);
+
+            DSL_META_EXPORT_SINK_PTR pMetaExportSinkBintr = 
+                std::dynamic_pointer_cast<MetaExportSinkBintr>(m_components[name]);
+
+            pMetaExportSinkBintr->GetStats(stats);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metadata Export Sink'" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkMetaExportStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                MetaExportSinkBintr);
+
+            DSL_META_EXPORT_SINK_PTR pMetaExportSinkBintr = 
+                std::dynamic_pointer_cast<MetaExportSinkBintr>(m_components[name]);
+
+            pMetaExportSinkBintr->ClearStats();
+
+            LOG_INFO("Metadata Export Sink '" << name 
+                << "' cleared stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metadata Export Sink'" << name 
+                << "' threw an exception clearing stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
         
     DslReturnType Services::SinkFakeNew(const char* name)
     {
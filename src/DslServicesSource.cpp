@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslServicesValidate.h"
 #include "DslSourceBintr.h"
+#include "DslReconnectionCoordinator.h"
 
 namespace DSL
 {
@@ -220,6 +221,173 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SourceAppBuffersPush(const char* name, 
+        void** buffers, uint numBuffers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->PushBuffers(buffers, numBuffers))
+            {
+                LOG_ERROR("Failed to push " << numBuffers 
+                    << " buffers to App Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            // don't log successful case for performance reasons
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception on push buffers");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBuffersPushWrapped(const char* name, 
+        const dsl_source_app_wrapped_buffer* buffers, uint numBuffers,
+        dsl_source_app_buffer_release_cb releaseCb)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->PushWrappedBuffers(buffers, numBuffers, 
+                releaseCb))
+            {
+                LOG_ERROR("Failed to push " << numBuffers 
+                    << " wrapped buffers to App Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            // don't log successful case for performance reasons
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception on push wrapped buffers");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferPoolSizeGet(const char* name, 
+        uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            *size = pSourceBintr->GetBufferPoolSize();
+            
+            LOG_INFO("App Source '" << name 
+                << "' returned buffer-pool-size = "
+                << *size << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception getting buffer-pool-size");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferPoolSizeSet(const char* name, 
+        uint size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetBufferPoolSize(size))
+            {
+                LOG_ERROR("App Source '" << name 
+                    << "' failed to set buffer-pool-size = " << size);
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+
+            LOG_INFO("App Source '" << name << "' set buffer-pool-size = "
+                << size << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception setting buffer-pool-size");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferPoolAcquire(const char* name, 
+        void** buffer, void** data, uint64_t* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->AcquireBuffer(buffer, data, size))
+            {
+                LOG_ERROR("Failed to acquire buffer from App Source '" 
+                    << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            // don't log successful case for performance reasons
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception acquiring buffer");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::SourceAppEos(const char* name)
     {
         LOG_FUNC();
@@ -610,6 +778,207 @@ namespace DSL
 //        }
 //    }
     
+    DslReturnType Services::SourceShmNew(const char* name, const char* shmName,
+        const char* bufferInFormat, uint width, uint height, 
+        uint fpsN, uint fpsD, uint numSlots)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Source name '" << name << "' is not unique");
+                return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            }
+            if (!numSlots)
+            {
+                LOG_ERROR("Invalid num-slots = 0 for new Shared Memory Source '" 
+                    << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            m_components[name] = DSL_SHM_SOURCE_NEW(name, shmName, 
+                bufferInFormat, width, height, fpsN, fpsD, numSlots);
+
+            LOG_INFO("New Shared Memory Source '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Shared Memory Source '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceShmStatsGet(const char* name, 
+        dsl_shm_source_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                ShmSourceBintr);
+
+            DSL_SHM_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<ShmSourceBintr>(m_components[name]);
+
+            pSourceBintr->GetStats(stats);
+            
+            LOG_INFO("Shared Memory Source '" << name 
+                << "' returned stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Memory Source '" << name 
+                << "' threw exception getting stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceShmStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                ShmSourceBintr);
+
+            DSL_SHM_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<ShmSourceBintr>(m_components[name]);
+
+            pSourceBintr->ClearStats();
+            
+            LOG_INFO("Shared Memory Source '" << name 
+                << "' cleared stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Memory Source '" << name 
+                << "' threw exception clearing stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceMetaReplayNew(const char* name, 
+        const char* filePath, double speed, uint surfaceType, 
+        uint width, uint height)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Source name '" << name << "' is not unique");
+                return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            }
+            if (speed < 0 or 
+                surfaceType > DSL_SOURCE_META_REPLAY_SURFACE_TEST_PATTERN or
+                (surfaceType != DSL_SOURCE_META_REPLAY_SURFACE_NONE and 
+                    (!width or !height)))
+            {
+                LOG_ERROR("Invalid speed, surface-type, or dimensions for new "
+                    << "Metadata Replay Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            std::ifstream metaStreamFile(filePath);
+            if (!metaStreamFile.good())
+            {
+                LOG_ERROR("Metadata stream '" << filePath << "' Not found");
+                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+            }
+            m_components[name] = DSL_META_REPLAY_SOURCE_NEW(name, filePath, 
+                speed, surfaceType, width, height);
+
+            LOG_INFO("New Metadata Replay Source '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Metadata Replay Source '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceMetaReplayStatsGet(const char* name, 
+        dsl_meta_replay_source_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                MetaReplaySourceBintr);
+
+            DSL_META_REPLAY_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<MetaReplaySourceBintr>(m_components[name]);
+
+            pSourceBintr->GetStats(stats);
+            
+            LOG_INFO("Metadata Replay Source '" << name 
+                << "' returned stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metadata Replay Source '" << name 
+                << "' threw exception getting stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceMetaReplayStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                MetaReplaySourceBintr);
+
+            DSL_META_REPLAY_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<MetaReplaySourceBintr>(m_components[name]);
+
+            pSourceBintr->ClearStats();
+            
+            LOG_INFO("Metadata Replay Source '" << name 
+                << "' cleared stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metadata Replay Source '" << name 
+                << "' threw exception clearing stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::SourceCsiNew(const char* name,
         uint width, uint height, uint fpsN, uint fpsD)
     {
@@ -2785,6 +3154,98 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SourceRtspReconnectionParamsGet(uint* maxConcurrent, 
+        uint* maxBackoff)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            ReconnectionCoordinator::GetCoordinator()->GetParams(
+                maxConcurrent, maxBackoff);
+
+            LOG_INFO("RTSP reconnection params returned Max Concurrent = " 
+                << *maxConcurrent << " and Max Backoff = " << *maxBackoff 
+                << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Reconnection Coordinator threw exception getting params");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SourceRtspReconnectionParamsSet(uint maxConcurrent, 
+        uint maxBackoff)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            if (!ReconnectionCoordinator::GetCoordinator()->SetParams(
+                maxConcurrent, maxBackoff))
+            {
+                LOG_ERROR("Failed to set RTSP reconnection params");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            LOG_INFO("RTSP reconnection params set Max Concurrent = " 
+                << maxConcurrent << " and Max Backoff = " << maxBackoff 
+                << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Reconnection Coordinator threw exception setting params");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SourceRtspReconnectionStatsGet(
+        dsl_rtsp_reconnection_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            ReconnectionCoordinator::GetCoordinator()->GetStats(stats);
+
+            LOG_INFO("RTSP reconnection stats returned successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Reconnection Coordinator threw exception getting stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SourceRtspReconnectionStatsClear()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            ReconnectionCoordinator::GetCoordinator()->ClearStats();
+
+            LOG_INFO("RTSP reconnection stats cleared successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Reconnection Coordinator threw exception clearing stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::SourceRtspLatencyGet(const char* name, 
         uint* latency)
     {
@@ -187,6 +187,8 @@ THE SOFTWARE.
 #define DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(components, name) do \
 { \
     if (!components[name]->IsType(typeid(AppSourceBintr)) and  \
+        !components[name]->IsType(typeid(ShmSourceBintr)) and  \
+        !components[name]->IsType(typeid(MetaReplaySourceBintr)) and  \
         !components[name]->IsType(typeid(CsiSourceBintr)) and  \
         !components[name]->IsType(typeid(V4l2SourceBintr)) and  \
         !components[name]->IsType(typeid(UriSourceBintr)) and  \
@@ -313,6 +315,8 @@ THE SOFTWARE.
 { \
     if (!components[name]->IsType(typeid(AppSinkBintr)) and  \
         !components[name]->IsType(typeid(FrameCaptureSinkBintr)) and  \
+        !components[name]->IsType(typeid(ShmSinkBintr)) and  \
+        !components[name]->IsType(typeid(MetaExportSinkBintr)) and  \
         !components[name]->IsType(typeid(FakeSinkBintr)) and  \
         !components[name]->IsType(typeid(ThreeDSinkBintr)) and  \
         !components[name]->IsType(typeid(EglSinkBintr)) and  \
@@ -353,6 +357,8 @@ THE SOFTWARE.
 { \
     if (!components[name]->IsType(typeid(AppSinkBintr)) and  \
         !components[name]->IsType(typeid(FrameCaptureSinkBintr)) and  \
+        !components[name]->IsType(typeid(ShmSinkBintr)) and  \
+        !components[name]->IsType(typeid(MetaExportSinkBintr)) and  \
         !components[name]->IsType(typeid(FakeSinkBintr)) and  \
         !components[name]->IsType(typeid(ThreeDSinkBintr)) and  \
         !components[name]->IsType(typeid(EglSinkBintr)) and  \
@@ -376,6 +382,8 @@ THE SOFTWARE.
 { \
     if (!components[name]->IsType(typeid(AppSinkBintr)) and  \
         !components[name]->IsType(typeid(FrameCaptureSinkBintr)) and  \
+        !components[name]->IsType(typeid(ShmSinkBintr)) and  \
+        !components[name]->IsType(typeid(MetaExportSinkBintr)) and  \
         !components[name]->IsType(typeid(FakeSinkBintr)) and  \
         !components[name]->IsType(typeid(ThreeDSinkBintr)) and  \
         !components[name]->IsType(typeid(EglSinkBintr)) and  \
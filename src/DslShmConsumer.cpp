@@ -0,0 +1,342 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// Intentionally free of Dsl.h, GLib and GStreamer so that reader processes
+// can compile this file directly.
+
+#include "DslShmConsumer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+struct _dsl_shm_consumer
+{
+    /**
+     * @brief file descriptor for the shared-memory segment.
+     */
+    int fd;
+
+    /**
+     * @brief ring header at the start of the mapped segment.
+     */
+    dsl_shm_egress_ring_header* header;
+
+    /**
+     * @brief size of the mapped segment in bytes.
+     */
+    uint64_t mapSize;
+
+    /**
+     * @brief this reader's entry in the ring's reader table.
+     */
+    dsl_shm_egress_reader* reader;
+
+    /**
+     * @brief number of the next frame to read.
+     */
+    uint64_t cursor;
+
+    /**
+     * @brief frame descriptor of the acquired frame, NULL when none.
+     */
+    dsl_shm_egress_frame* acquired;
+};
+
+static uint64_t dsl_shm_consumer_now_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec;
+}
+
+static bool dsl_shm_consumer_is_alive(int32_t pid)
+{
+    return pid and (kill(pid, 0) == 0 or errno == EPERM);
+}
+
+static void dsl_shm_consumer_skip(dsl_shm_consumer* consumer, uint64_t frames)
+{
+    __atomic_add_fetch(&consumer->reader->frames_skipped, frames, 
+        __ATOMIC_RELAXED);
+    __atomic_add_fetch(&consumer->header->skips, frames, __ATOMIC_RELAXED);
+}
+
+int dsl_shm_consumer_open(const char* shm_name, dsl_shm_consumer** consumer)
+{
+    if (!shm_name or !consumer)
+    {
+        return DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM;
+    }
+    int fd = shm_open(shm_name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        return (errno == ENOENT)
+            ? DSL_SHM_CONSUMER_RESULT_RING_NOT_FOUND
+            : DSL_SHM_CONSUMER_RESULT_SYSTEM_ERROR;
+    }
+    struct stat status;
+    if (fstat(fd, &status) or status.st_size < DSL_SHM_RING_HEADER_SIZE)
+    {
+        close(fd);
+        return DSL_SHM_CONSUMER_RESULT_RING_INVALID;
+    }
+    void* pMap = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, 
+        MAP_SHARED, fd, 0);
+    if (pMap == MAP_FAILED)
+    {
+        close(fd);
+        return DSL_SHM_CONSUMER_RESULT_SYSTEM_ERROR;
+    }
+    dsl_shm_egress_ring_header* pHeader = (dsl_shm_egress_ring_header*)pMap;
+    dsl_shm_egress_reader* pReader(NULL);
+    
+    int result(DSL_SHM_CONSUMER_RESULT_SUCCESS);
+
+    if (__atomic_load_n(&pHeader->magic, __ATOMIC_ACQUIRE) 
+            != DSL_SHM_EGRESS_RING_MAGIC or 
+        pHeader->version != DSL_SHM_EGRESS_RING_VERSION or
+        pHeader->total_size != (uint64_t)status.st_size)
+    {
+        result = DSL_SHM_CONSUMER_RESULT_RING_INVALID;
+    }
+    else if (__atomic_load_n(&pHeader->writer_closed, __ATOMIC_ACQUIRE))
+    {
+        result = DSL_SHM_CONSUMER_RESULT_RING_CLOSED;
+    }
+    else
+    {
+        // Claim a free reader entry, or one left by a reader that exited
+        // (or crashed) without closing.
+        int32_t self = getpid();
+        for (int i = 0; i < DSL_SHM_EGRESS_RING_MAX_READERS and !pReader; i++)
+        {
+            int32_t current = __atomic_load_n(&pHeader->readers[i].pid, 
+                __ATOMIC_ACQUIRE);
+            if (dsl_shm_consumer_is_alive(current))
+            {
+                continue;
+            }
+            if (__atomic_compare_exchange_n(&pHeader->readers[i].pid, 
+                &current, self, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                pReader = &pHeader->readers[i];
+            }
+        }
+        if (!pReader)
+        {
+            result = DSL_SHM_CONSUMER_RESULT_RING_BUSY;
+        }
+    }
+    if (result != DSL_SHM_CONSUMER_RESULT_SUCCESS)
+    {
+        munmap(pMap, status.st_size);
+        close(fd);
+        return result;
+    }
+    uint64_t writeSeq = __atomic_load_n(&pHeader->write_seq, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&pReader->frames_read, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&pReader->frames_skipped, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&pReader->cursor, writeSeq, __ATOMIC_RELEASE);
+    
+    dsl_shm_consumer* pConsumer = 
+        (dsl_shm_consumer*)calloc(1, sizeof(dsl_shm_consumer));
+    pConsumer->fd = fd;
+    pConsumer->header = pHeader;
+    pConsumer->mapSize = status.st_size;
+    pConsumer->reader = pReader;
+    pConsumer->cursor = writeSeq + 1;
+    pConsumer->acquired = NULL;
+    
+    *consumer = pConsumer;
+    
+    return DSL_SHM_CONSUMER_RESULT_SUCCESS;
+}
+
+int dsl_shm_consumer_close(dsl_shm_consumer* consumer)
+{
+    if (!consumer)
+    {
+        return DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM;
+    }
+    int32_t self = getpid();
+    __atomic_compare_exchange_n(&consumer->reader->pid, &self,
+        0, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+        
+    munmap(consumer->header, consumer->mapSize);
+    close(consumer->fd);
+    free(consumer);
+    
+    return DSL_SHM_CONSUMER_RESULT_SUCCESS;
+}
+
+int dsl_shm_consumer_format_get(dsl_shm_consumer* consumer, 
+    uint32_t* data_type, const char** format, uint32_t* width, uint32_t* height)
+{
+    if (!consumer or !data_type or !format or !width or !height)
+    {
+        return DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM;
+    }
+    *data_type = consumer->header->data_type;
+    *format = consumer->header->format;
+    *width = consumer->header->width;
+    *height = consumer->header->height;
+    
+    return DSL_SHM_CONSUMER_RESULT_SUCCESS;
+}
+
+int dsl_shm_consumer_frame_acquire(dsl_shm_consumer* consumer, 
+    uint32_t timeout_ms, const dsl_shm_egress_frame** frame, 
+    const dsl_shm_egress_object** objects, const void** data)
+{
+    if (!consumer or !frame or !objects or !data)
+    {
+        return DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM;
+    }
+    if (consumer->acquired)
+    {
+        dsl_shm_consumer_frame_release(consumer);
+    }
+    dsl_shm_egress_ring_header* pHeader = consumer->header;
+    uint64_t deadline = dsl_shm_consumer_now_ns() + timeout_ms*1000000ULL;
+    
+    while (true)
+    {
+        if (__atomic_load_n(&pHeader->writer_closed, __ATOMIC_ACQUIRE))
+        {
+            return DSL_SHM_CONSUMER_RESULT_RING_CLOSED;
+        }
+        uint64_t writeSeq = __atomic_load_n(&pHeader->write_seq, 
+            __ATOMIC_SEQ_CST);
+            
+        if (consumer->cursor <= writeSeq)
+        {
+            // The writer never waits - skip ahead to the newest frame once
+            // the next frame to read has been overwritten.
+            if (writeSeq - consumer->cursor >= pHeader->num_slots)
+            {
+                dsl_shm_consumer_skip(consumer, writeSeq - consumer->cursor);
+                consumer->cursor = writeSeq;
+            }
+            dsl_shm_egress_frame* pFrame = 
+                dsl_shm_egress_ring_frame_get(pHeader, consumer->cursor);
+                
+            // The slot is being rewritten if it changed since write_seq was
+            // read - skip the frame rather than wait for the writer.
+            if (__atomic_load_n(&pFrame->seq, __ATOMIC_ACQUIRE) 
+                != consumer->cursor)
+            {
+                dsl_shm_consumer_skip(consumer, 1);
+                consumer->cursor++;
+                continue;
+            }
+            consumer->acquired = pFrame;
+            
+            *frame = pFrame;
+            *objects = dsl_shm_egress_ring_objects_get(pFrame);
+            *data = (pHeader->data_type == DSL_SHM_EGRESS_RING_DATA_TYPE_FRAMES)
+                ? dsl_shm_egress_ring_data_get(pHeader, pFrame)
+                : NULL;
+                
+            return DSL_SHM_CONSUMER_RESULT_SUCCESS;
+        }
+        
+        // Register as a waiter before reading the doorbell and re-checking
+        // write_seq, so the writer either sees the waiter or the re-check
+        // sees the new frame.
+        __atomic_add_fetch(&pHeader->waiters, 1, __ATOMIC_SEQ_CST);
+        uint32_t doorbell = __atomic_load_n(&pHeader->write_doorbell, 
+            __ATOMIC_SEQ_CST);
+        bool ready = consumer->cursor <= __atomic_load_n(&pHeader->write_seq, 
+            __ATOMIC_SEQ_CST);
+            
+        uint64_t now = dsl_shm_consumer_now_ns();
+        if (!ready and now < deadline)
+        {
+            dsl_shm_ring_doorbell_wait(&pHeader->write_doorbell, doorbell,
+                (deadline - now + 999999)/1000000);
+        }
+        __atomic_sub_fetch(&pHeader->waiters, 1, __ATOMIC_SEQ_CST);
+        
+        if (!ready and now >= deadline)
+        {
+            // A ring orphaned by a writer that exited without closing will
+            // never be written - report it as closed so the reader reopens.
+            if (!dsl_shm_consumer_is_alive(pHeader->writer_pid))
+            {
+                return DSL_SHM_CONSUMER_RESULT_RING_CLOSED;
+            }
+            return DSL_SHM_CONSUMER_RESULT_TIMEOUT;
+        }
+    }
+}
+
+int dsl_shm_consumer_frame_release(dsl_shm_consumer* consumer)
+{
+    if (!consumer)
+    {
+        return DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM;
+    }
+    if (!consumer->acquired)
+    {
+        return DSL_SHM_CONSUMER_RESULT_FRAME_NOT_ACQUIRED;
+    }
+    // All reads of the slot must complete before the sequence lock is 
+    // re-checked.
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    bool intact = __atomic_load_n(&consumer->acquired->seq, __ATOMIC_RELAXED)
+        == consumer->cursor;
+    consumer->acquired = NULL;
+    
+    __atomic_store_n(&consumer->reader->cursor, consumer->cursor, 
+        __ATOMIC_RELEASE);
+    consumer->cursor++;
+    
+    if (!intact)
+    {
+        dsl_shm_consumer_skip(consumer, 1);
+        return DSL_SHM_CONSUMER_RESULT_FRAME_OVERWRITTEN;
+    }
+    __atomic_add_fetch(&consumer->reader->frames_read, 1, __ATOMIC_RELAXED);
+    
+    return DSL_SHM_CONSUMER_RESULT_SUCCESS;
+}
+
+int dsl_shm_consumer_stats_get(dsl_shm_consumer* consumer, 
+    uint64_t* frames_read, uint64_t* frames_skipped)
+{
+    if (!consumer or !frames_read or !frames_skipped)
+    {
+        return DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM;
+    }
+    *frames_read = __atomic_load_n(&consumer->reader->frames_read, 
+        __ATOMIC_RELAXED);
+    *frames_skipped = __atomic_load_n(&consumer->reader->frames_skipped, 
+        __ATOMIC_RELAXED);
+    
+    return DSL_SHM_CONSUMER_RESULT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SHM_CONSUMER_H
+#define _DSL_SHM_CONSUMER_H
+
+/**
+ * DSL Shared Memory Consumer library - a small C library for reader 
+ * processes that read frames and object metadata from the ring of a DSL 
+ * Shared Memory Sink. The library depends only on libc and DslShmEgressRing.h
+ * and can be compiled directly into the reader (e.g. g++ -c DslShmConsumer.cpp)
+ * or used from libdsl.
+ *
+ * Frames are read in place. The writer never waits for readers, so a frame 
+ * can be overwritten while in use - dsl_shm_consumer_frame_release reports 
+ * whether it was, in which case any results from the frame must be discarded.
+ *
+ * Typical use
+ *   dsl_shm_consumer_open("/my-ring", &consumer);
+ *   while (running)
+ *   {
+ *       if (dsl_shm_consumer_frame_acquire(consumer, 100, 
+ *           &frame, &objects, &data) == DSL_SHM_CONSUMER_RESULT_SUCCESS)
+ *       {
+ *           // ... process the frame in place ...
+ *           if (dsl_shm_consumer_frame_release(consumer) 
+ *               == DSL_SHM_CONSUMER_RESULT_SUCCESS)
+ *           {
+ *               // ... use the results ...
+ *           }
+ *       }
+ *   }
+ *   dsl_shm_consumer_close(consumer);
+ */
+
+#include "DslShmEgressRing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DSL_SHM_CONSUMER_RESULT_SUCCESS                             0
+#define DSL_SHM_CONSUMER_RESULT_INVALID_INPUT_PARAM                 1
+#define DSL_SHM_CONSUMER_RESULT_RING_NOT_FOUND                      2
+#define DSL_SHM_CONSUMER_RESULT_RING_INVALID                        3
+#define DSL_SHM_CONSUMER_RESULT_RING_BUSY                           4
+#define DSL_SHM_CONSUMER_RESULT_TIMEOUT                             5
+#define DSL_SHM_CONSUMER_RESULT_RING_CLOSED                         6
+#define DSL_SHM_CONSUMER_RESULT_FRAME_OVERWRITTEN                   7
+#define DSL_SHM_CONSUMER_RESULT_FRAME_NOT_ACQUIRED                  8
+#define DSL_SHM_CONSUMER_RESULT_SYSTEM_ERROR                        9
+
+/**
+ * @brief opaque handle to a reader attached to a ring.
+ */
+typedef struct _dsl_shm_consumer dsl_shm_consumer;
+
+/**
+ * @brief Opens the named shared-memory ring created by a DSL Shared Memory 
+ * Sink and attaches to it as a new reader. Up to 
+ * DSL_SHM_EGRESS_RING_MAX_READERS readers can be attached at a time; the
+ * entries of readers that exited without closing are reused. The new reader 
+ * starts with the next frame written.
+ * @param[in] shm_name name of the POSIX shared-memory ring, e.g. "/analytics".
+ * @param[out] consumer handle to the new reader on success.
+ * @return DSL_SHM_CONSUMER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_CONSUMER_RESULT values otherwise.
+ */
+int dsl_shm_consumer_open(const char* shm_name, dsl_shm_consumer** consumer);
+
+/**
+ * @brief Detaches from and unmaps the ring, and frees the reader handle.
+ * @param[in] consumer handle returned by dsl_shm_consumer_open.
+ * @return DSL_SHM_CONSUMER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_CONSUMER_RESULT values otherwise.
+ */
+int dsl_shm_consumer_close(dsl_shm_consumer* consumer);
+
+/**
+ * @brief Gets the data type and video format the ring was created with.
+ * @param[in] consumer handle returned by dsl_shm_consumer_open.
+ * @param[out] data_type one of the DSL_SHM_EGRESS_RING_DATA_TYPE values.
+ * @param[out] format video format string, e.g. "RGBA". The string is owned
+ * by the ring and is valid until the reader is closed.
+ * @param[out] width frame width in pixels.
+ * @param[out] height frame height in pixels.
+ * @return DSL_SHM_CONSUMER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_CONSUMER_RESULT values otherwise.
+ */
+int dsl_shm_consumer_format_get(dsl_shm_consumer* consumer, 
+    uint32_t* data_type, const char** format, uint32_t* width, uint32_t* height);
+
+/**
+ * @brief Acquires the next frame in the ring, waiting up to timeout_ms for 
+ * the writer if there is none. If the reader has fallen too far behind, the
+ * frames it missed are counted as skipped and the newest frame is returned.
+ * A frame that is still acquired is released first.
+ * @param[in] consumer handle returned by dsl_shm_consumer_open.
+ * @param[in] timeout_ms maximum time to wait for a new frame, 0 = no wait.
+ * @param[out] frame frame descriptor in the ring.
+ * @param[out] objects the frame's frame->num_objects object records in the ring.
+ * @param[out] data the frame's frame->data_size bytes of frame data in the ring.
+ * @return DSL_SHM_CONSUMER_RESULT_SUCCESS on success, 
+ * DSL_SHM_CONSUMER_RESULT_TIMEOUT on timeout, DSL_SHM_CONSUMER_RESULT_RING_CLOSED
+ * if the writer has closed the ring and it must be reopened.
+ */
+int dsl_shm_consumer_frame_acquire(dsl_shm_consumer* consumer, 
+    uint32_t timeout_ms, const dsl_shm_egress_frame** frame, 
+    const dsl_shm_egress_object** objects, const void** data);
+
+/**
+ * @brief Releases the previously acquired frame and checks that it was not 
+ * overwritten by the writer while in use.
+ * @param[in] consumer handle returned by dsl_shm_consumer_open.
+ * @return DSL_SHM_CONSUMER_RESULT_SUCCESS if the frame was intact, 
+ * DSL_SHM_CONSUMER_RESULT_FRAME_OVERWRITTEN if it was overwritten while in 
+ * use and must be discarded.
+ */
+int dsl_shm_consumer_frame_release(dsl_shm_consumer* consumer);
+
+/**
+ * @brief Gets the reader's frame counters since it was opened.
+ * @param[in] consumer handle returned by dsl_shm_consumer_open.
+ * @param[out] frames_read number of frames read intact.
+ * @param[out] frames_skipped number of frames skipped or overwritten.
+ * @return DSL_SHM_CONSUMER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_CONSUMER_RESULT values otherwise.
+ */
+int dsl_shm_consumer_stats_get(dsl_shm_consumer* consumer, 
+    uint64_t* frames_read, uint64_t* frames_skipped);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _DSL_SHM_CONSUMER_H
@@ -0,0 +1,280 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SHM_EGRESS_RING_H
+#define _DSL_SHM_EGRESS_RING_H
+
+/**
+ * Shared-memory broadcast ring used to move frames and/or object metadata 
+ * from a DSL Shared Memory Sink to any number of reader processes. Like 
+ * DslShmRing.h, this header has no dependencies other than libc and Linux
+ * headers so that it can be compiled into reader processes with the DSL 
+ * Shared Memory Consumer library (DslShmConsumer.h).
+ *
+ * Memory layout of the named POSIX shared-memory segment
+ *   [0, DSL_SHM_RING_HEADER_SIZE)        dsl_shm_egress_ring_header
+ *   [DSL_SHM_RING_HEADER_SIZE, ...)      num_slots slots of slot_stride bytes
+ *
+ * Memory layout of each slot
+ *   [0, ...)                             dsl_shm_egress_frame
+ *   [DSL_SHM_EGRESS_RING_OBJECTS_OFFSET, ...)  dsl_shm_egress_object[max_objects]
+ *   [frame_data_offset, ...)             slot_size bytes of frame data
+ *
+ * The ring is single-writer, multi-reader, and the writer never waits for
+ * readers. Frames are numbered from 1 by write_seq and frame n is written to
+ * slot n % num_slots, overwriting frame n - num_slots. Each slot's seq is
+ * used as a sequence lock: the writer sets it to 0 before rewriting the slot
+ * and to the new frame number once the slot is complete. A reader reads the
+ * slot in place and then re-checks seq to find whether the slot was rewritten
+ * while in use. A reader that falls num_slots or more frames behind skips
+ * ahead to the newest frame. Each reader registers in the header's reader
+ * table to report its cursor and skip count to the writer.
+ */
+
+#include "DslShmRing.h"
+
+#define DSL_SHM_EGRESS_RING_MAGIC                                   0x44534C45
+#define DSL_SHM_EGRESS_RING_VERSION                                 1
+
+/**
+ * @brief data-type values for the ring. Metadata-only rings have no frame data.
+ */
+#define DSL_SHM_EGRESS_RING_DATA_TYPE_METADATA                      0
+#define DSL_SHM_EGRESS_RING_DATA_TYPE_FRAMES                        1
+
+/**
+ * @brief maximum number of readers that can be attached at once.
+ */
+#define DSL_SHM_EGRESS_RING_MAX_READERS                             16
+
+/**
+ * @brief maximum number of object records per slot; additional objects
+ * are dropped by the writer.
+ */
+#define DSL_SHM_EGRESS_RING_MAX_OBJECTS                             256
+
+/**
+ * @brief offset of the object records from the start of the slot.
+ */
+#define DSL_SHM_EGRESS_RING_OBJECTS_OFFSET                          64
+
+/**
+ * @struct dsl_shm_egress_object
+ * @brief Object record for each object detected in a frame.
+ */
+typedef struct _dsl_shm_egress_object
+{
+    /**
+     * @brief unique tracking id for the object, UINT64_MAX if untracked.
+     */
+    uint64_t object_id;
+
+    /**
+     * @brief class id of the object.
+     */
+    uint32_t class_id;
+
+    /**
+     * @brief source id of the frame the object was detected in.
+     */
+    uint32_t source_id;
+
+    /**
+     * @brief detection confidence for the object.
+     */
+    float confidence;
+
+    /**
+     * @brief bounding box of the object in pixels.
+     */
+    float left;
+    float top;
+    float width;
+    float height;
+
+    uint32_t reserved;
+
+} dsl_shm_egress_object;
+
+/**
+ * @struct dsl_shm_egress_frame
+ * @brief Per-slot frame descriptor written by the writer.
+ */
+typedef struct _dsl_shm_egress_frame
+{
+    /**
+     * @brief sequence lock - number of the frame in the slot, 0 while the 
+     * slot is being rewritten.
+     */
+    uint64_t seq;
+
+    /**
+     * @brief presentation timestamp of the buffer in nanoseconds.
+     */
+    uint64_t timestamp;
+
+    /**
+     * @brief frame number of the first frame in the buffer.
+     */
+    uint64_t frame_number;
+
+    /**
+     * @brief source id of the first frame in the buffer.
+     */
+    uint32_t source_id;
+
+    /**
+     * @brief number of object records in the slot.
+     */
+    uint32_t num_objects;
+
+    /**
+     * @brief number of bytes of frame data in the slot, 0 for metadata-only.
+     */
+    uint64_t data_size;
+
+} dsl_shm_egress_frame;
+
+/**
+ * @struct dsl_shm_egress_reader
+ * @brief Reader table entry owned by an attached reader.
+ */
+typedef struct _dsl_shm_egress_reader
+{
+    /**
+     * @brief process-id of the reader, 0 when the entry is free.
+     */
+    int32_t pid;
+
+    uint32_t reserved;
+
+    /**
+     * @brief number of the last frame read.
+     */
+    uint64_t cursor;
+
+    /**
+     * @brief number of frames read since the reader attached.
+     */
+    uint64_t frames_read;
+
+    /**
+     * @brief number of frames skipped since the reader attached.
+     */
+    uint64_t frames_skipped;
+
+} dsl_shm_egress_reader;
+
+/**
+ * @struct dsl_shm_egress_ring_header
+ * @brief Fixed header at the start of the shared-memory segment. Fields below 
+ * the "dynamic" marker are updated concurrently and must only be accessed
+ * with the __atomic builtins.
+ */
+typedef struct _dsl_shm_egress_ring_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t data_type;
+    uint32_t num_slots;
+    uint32_t max_objects;
+    uint32_t slot_size;
+    uint64_t slot_stride;
+    uint64_t frame_data_offset;
+    uint64_t total_size;
+    uint32_t width;
+    uint32_t height;
+    char format[DSL_SHM_RING_FORMAT_SIZE];
+
+    // dynamic
+
+    /**
+     * @brief set to 1 by the writer when the ring is closed. Attached 
+     * readers must close and reopen the ring.
+     */
+    uint32_t writer_closed;
+
+    /**
+     * @brief process-id of the writer that created the ring.
+     */
+    int32_t writer_pid;
+
+    /**
+     * @brief futex word bumped by the writer on every commit.
+     */
+    uint32_t write_doorbell;
+
+    /**
+     * @brief number of readers waiting on the write doorbell. The writer
+     * only wakes the doorbell when there are waiters.
+     */
+    uint32_t waiters;
+
+    /**
+     * @brief number of the last frame committed by the writer.
+     */
+    uint64_t write_seq;
+
+    /**
+     * @brief number of frames skipped by all readers.
+     */
+    uint64_t skips;
+
+    /**
+     * @brief reader table.
+     */
+    dsl_shm_egress_reader readers[DSL_SHM_EGRESS_RING_MAX_READERS];
+
+} dsl_shm_egress_ring_header;
+
+/**
+ * @brief Returns the frame descriptor at the start of a ring slot.
+ */
+static inline dsl_shm_egress_frame* dsl_shm_egress_ring_frame_get(
+    dsl_shm_egress_ring_header* header, uint64_t seq)
+{
+    return (dsl_shm_egress_frame*)((char*)header + DSL_SHM_RING_HEADER_SIZE
+        + (seq % header->num_slots) * header->slot_stride);
+}
+
+/**
+ * @brief Returns the object records for a ring slot.
+ */
+static inline dsl_shm_egress_object* dsl_shm_egress_ring_objects_get(
+    dsl_shm_egress_frame* frame)
+{
+    return (dsl_shm_egress_object*)((char*)frame 
+        + DSL_SHM_EGRESS_RING_OBJECTS_OFFSET);
+}
+
+/**
+ * @brief Returns a pointer to the frame data for a ring slot.
+ */
+static inline void* dsl_shm_egress_ring_data_get(
+    dsl_shm_egress_ring_header* header, dsl_shm_egress_frame* frame)
+{
+    return (char*)frame + header->frame_data_offset;
+}
+
+#endif // _DSL_SHM_EGRESS_RING_H
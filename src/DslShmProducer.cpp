@@ -0,0 +1,266 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// Intentionally free of Dsl.h, GLib and GStreamer so that producer processes
+// can compile this file directly.
+
+#include "DslShmProducer.h"
+#include "DslShmRing.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+struct _dsl_shm_producer
+{
+    /**
+     * @brief file descriptor for the shared-memory segment.
+     */
+    int fd;
+
+    /**
+     * @brief ring header at the start of the mapped segment.
+     */
+    dsl_shm_ring_header* header;
+
+    /**
+     * @brief size of the mapped segment in bytes.
+     */
+    uint64_t mapSize;
+
+    /**
+     * @brief true while a slot is acquired and not yet committed.
+     */
+    bool acquired;
+};
+
+static uint64_t dsl_shm_producer_now_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec;
+}
+
+static bool dsl_shm_producer_is_alive(int32_t pid)
+{
+    return pid and (kill(pid, 0) == 0 or errno == EPERM);
+}
+
+int dsl_shm_producer_open(const char* shm_name, dsl_shm_producer** producer)
+{
+    if (!shm_name or !producer)
+    {
+        return DSL_SHM_PRODUCER_RESULT_INVALID_INPUT_PARAM;
+    }
+    int fd = shm_open(shm_name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        return (errno == ENOENT)
+            ? DSL_SHM_PRODUCER_RESULT_RING_NOT_FOUND
+            : DSL_SHM_PRODUCER_RESULT_SYSTEM_ERROR;
+    }
+    struct stat status;
+    if (fstat(fd, &status) or status.st_size < DSL_SHM_RING_HEADER_SIZE)
+    {
+        close(fd);
+        return DSL_SHM_PRODUCER_RESULT_RING_INVALID;
+    }
+    void* pMap = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, 
+        MAP_SHARED, fd, 0);
+    if (pMap == MAP_FAILED)
+    {
+        close(fd);
+        return DSL_SHM_PRODUCER_RESULT_SYSTEM_ERROR;
+    }
+    dsl_shm_ring_header* pHeader = (dsl_shm_ring_header*)pMap;
+    
+    int result(DSL_SHM_PRODUCER_RESULT_SUCCESS);
+
+    if (pHeader->magic != DSL_SHM_RING_MAGIC or 
+        pHeader->version != DSL_SHM_RING_VERSION or
+        pHeader->total_size != (uint64_t)status.st_size)
+    {
+        result = DSL_SHM_PRODUCER_RESULT_RING_INVALID;
+    }
+    else if (__atomic_load_n(&pHeader->consumer_closed, __ATOMIC_ACQUIRE))
+    {
+        result = DSL_SHM_PRODUCER_RESULT_RING_CLOSED;
+    }
+    else
+    {
+        // Attach as the producer, taking over from a previous producer
+        // that exited (or crashed) without closing.
+        int32_t self = getpid();
+        int32_t current = __atomic_load_n(&pHeader->producer_pid, 
+            __ATOMIC_ACQUIRE);
+        while (true)
+        {
+            if (current != self and dsl_shm_producer_is_alive(current))
+            {
+                result = DSL_SHM_PRODUCER_RESULT_RING_BUSY;
+                break;
+            }
+            if (__atomic_compare_exchange_n(&pHeader->producer_pid, &current,
+                self, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                __atomic_add_fetch(&pHeader->producer_session, 1, 
+                    __ATOMIC_RELEASE);
+                break;
+            }
+        }
+    }
+    if (result != DSL_SHM_PRODUCER_RESULT_SUCCESS)
+    {
+        munmap(pMap, status.st_size);
+        close(fd);
+        return result;
+    }
+    dsl_shm_producer* pProducer = 
+        (dsl_shm_producer*)calloc(1, sizeof(dsl_shm_producer));
+    pProducer->fd = fd;
+    pProducer->header = pHeader;
+    pProducer->mapSize = status.st_size;
+    pProducer->acquired = false;
+    
+    *producer = pProducer;
+    
+    return DSL_SHM_PRODUCER_RESULT_SUCCESS;
+}
+
+int dsl_shm_producer_close(dsl_shm_producer* producer)
+{
+    if (!producer)
+    {
+        return DSL_SHM_PRODUCER_RESULT_INVALID_INPUT_PARAM;
+    }
+    int32_t self = getpid();
+    __atomic_compare_exchange_n(&producer->header->producer_pid, &self,
+        0, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+        
+    munmap(producer->header, producer->mapSize);
+    close(producer->fd);
+    free(producer);
+    
+    return DSL_SHM_PRODUCER_RESULT_SUCCESS;
+}
+
+int dsl_shm_producer_format_get(dsl_shm_producer* producer, 
+    const char** format, uint32_t* width, uint32_t* height, uint32_t* slot_size)
+{
+    if (!producer or !format or !width or !height or !slot_size)
+    {
+        return DSL_SHM_PRODUCER_RESULT_INVALID_INPUT_PARAM;
+    }
+    *format = producer->header->format;
+    *width = producer->header->width;
+    *height = producer->header->height;
+    *slot_size = producer->header->slot_size;
+    
+    return DSL_SHM_PRODUCER_RESULT_SUCCESS;
+}
+
+int dsl_shm_producer_frame_acquire(dsl_shm_producer* producer, 
+    uint32_t timeout_ms, void** data, uint64_t* size)
+{
+    if (!producer or !data or !size)
+    {
+        return DSL_SHM_PRODUCER_RESULT_INVALID_INPUT_PARAM;
+    }
+    dsl_shm_ring_header* pHeader = producer->header;
+    
+    // write_seq is only ever updated by the producer.
+    uint64_t seq = __atomic_load_n(&pHeader->write_seq, __ATOMIC_RELAXED);
+    uint64_t deadline = dsl_shm_producer_now_ns() + timeout_ms*1000000ULL;
+    
+    while (true)
+    {
+        // read the doorbell before checking so a release between the 
+        // check and the wait is not missed.
+        uint32_t doorbell = __atomic_load_n(&pHeader->read_doorbell, 
+            __ATOMIC_ACQUIRE);
+            
+        if (__atomic_load_n(&pHeader->consumer_closed, __ATOMIC_ACQUIRE))
+        {
+            return DSL_SHM_PRODUCER_RESULT_RING_CLOSED;
+        }
+        if (seq - __atomic_load_n(&pHeader->read_seq, __ATOMIC_ACQUIRE) 
+            < pHeader->num_slots)
+        {
+            break;
+        }
+        uint64_t now = dsl_shm_producer_now_ns();
+        if (now >= deadline)
+        {
+            // A ring orphaned by a consumer that exited without closing 
+            // will never drain - report it as closed so the producer reopens.
+            if (!dsl_shm_producer_is_alive(pHeader->consumer_pid))
+            {
+                return DSL_SHM_PRODUCER_RESULT_RING_CLOSED;
+            }
+            __atomic_add_fetch(&pHeader->overruns, 1, __ATOMIC_RELAXED);
+            return DSL_SHM_PRODUCER_RESULT_RING_FULL;
+        }
+        dsl_shm_ring_doorbell_wait(&pHeader->read_doorbell, doorbell,
+            (deadline - now + 999999)/1000000);
+    }
+    producer->acquired = true;
+    
+    *data = dsl_shm_ring_slot_data_get(pHeader, seq);
+    *size = pHeader->slot_size;
+    
+    return DSL_SHM_PRODUCER_RESULT_SUCCESS;
+}
+
+int dsl_shm_producer_frame_commit(dsl_shm_producer* producer, 
+    uint64_t size, uint64_t timestamp)
+{
+    if (!producer or size > producer->header->slot_size)
+    {
+        return DSL_SHM_PRODUCER_RESULT_INVALID_INPUT_PARAM;
+    }
+    if (!producer->acquired)
+    {
+        return DSL_SHM_PRODUCER_RESULT_FRAME_NOT_ACQUIRED;
+    }
+    dsl_shm_ring_header* pHeader = producer->header;
+    
+    uint64_t seq = __atomic_load_n(&pHeader->write_seq, __ATOMIC_RELAXED);
+    
+    dsl_shm_ring_slot* pSlot = dsl_shm_ring_slot_get(pHeader, seq);
+    pSlot->seq = seq;
+    pSlot->size = size;
+    pSlot->timestamp = timestamp;
+    
+    // publish the slot - the descriptor and frame data must be visible
+    // to the consumer before the new write_seq.
+    __atomic_store_n(&pHeader->write_seq, seq+1, __ATOMIC_RELEASE);
+    dsl_shm_ring_doorbell_ring(&pHeader->write_doorbell);
+    
+    producer->acquired = false;
+    
+    return DSL_SHM_PRODUCER_RESULT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SHM_PRODUCER_H
+#define _DSL_SHM_PRODUCER_H
+
+/**
+ * DSL Shared Memory Producer library - a small C library for producer 
+ * processes that write frames into the ring of a DSL Shared Memory Source.
+ * The library depends only on libc and DslShmRing.h and can be compiled
+ * directly into the producer (e.g. g++ -c DslShmProducer.cpp) or used
+ * from libdsl.
+ *
+ * Typical use
+ *   dsl_shm_producer_open("/my-ring", &producer);
+ *   while (running)
+ *   {
+ *       dsl_shm_producer_frame_acquire(producer, 100, &data, &size);
+ *       // ... write the frame into data in place ...
+ *       dsl_shm_producer_frame_commit(producer, frame_size, timestamp);
+ *   }
+ *   dsl_shm_producer_close(producer);
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DSL_SHM_PRODUCER_RESULT_SUCCESS                             0
+#define DSL_SHM_PRODUCER_RESULT_INVALID_INPUT_PARAM                 1
+#define DSL_SHM_PRODUCER_RESULT_RING_NOT_FOUND                      2
+#define DSL_SHM_PRODUCER_RESULT_RING_INVALID                        3
+#define DSL_SHM_PRODUCER_RESULT_RING_BUSY                           4
+#define DSL_SHM_PRODUCER_RESULT_RING_FULL                           5
+#define DSL_SHM_PRODUCER_RESULT_RING_CLOSED                         6
+#define DSL_SHM_PRODUCER_RESULT_FRAME_NOT_ACQUIRED                  7
+#define DSL_SHM_PRODUCER_RESULT_SYSTEM_ERROR                        8
+
+/**
+ * @brief opaque handle to a producer attached to a ring.
+ */
+typedef struct _dsl_shm_producer dsl_shm_producer;
+
+/**
+ * @brief Opens the named shared-memory ring created by a DSL Shared Memory 
+ * Source and attaches to it as the ring's producer. Only one live producer can 
+ * be attached at a time; the attachment of a producer that exited without
+ * closing is taken over. 
+ * @param[in] shm_name name of the POSIX shared-memory ring, e.g. "/camera-1".
+ * @param[out] producer handle to the new producer on success.
+ * @return DSL_SHM_PRODUCER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_PRODUCER_RESULT values otherwise.
+ */
+int dsl_shm_producer_open(const char* shm_name, dsl_shm_producer** producer);
+
+/**
+ * @brief Detaches from and unmaps the ring, and frees the producer handle.
+ * A frame acquired but not committed is discarded.
+ * @param[in] producer handle returned by dsl_shm_producer_open.
+ * @return DSL_SHM_PRODUCER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_PRODUCER_RESULT values otherwise.
+ */
+int dsl_shm_producer_close(dsl_shm_producer* producer);
+
+/**
+ * @brief Gets the video format and frame size the ring was created with.
+ * @param[in] producer handle returned by dsl_shm_producer_open.
+ * @param[out] format video format string, e.g. "I420". The string is owned
+ * by the ring and is valid until the producer is closed.
+ * @param[out] width frame width in pixels.
+ * @param[out] height frame height in pixels.
+ * @param[out] slot_size maximum size of a frame in bytes.
+ * @return DSL_SHM_PRODUCER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_PRODUCER_RESULT values otherwise.
+ */
+int dsl_shm_producer_format_get(dsl_shm_producer* producer, 
+    const char** format, uint32_t* width, uint32_t* height, uint32_t* slot_size);
+
+/**
+ * @brief Acquires the next free slot in the ring to write a frame into.
+ * If the ring is full, the call waits up to timeout_ms for the consumer to
+ * release a slot. On timeout, the frame is counted as a ring overrun.
+ * @param[in] producer handle returned by dsl_shm_producer_open.
+ * @param[in] timeout_ms maximum time to wait for a free slot, 0 = no wait.
+ * @param[out] data writable pointer to the slot's frame data.
+ * @param[out] size size of the slot in bytes.
+ * @return DSL_SHM_PRODUCER_RESULT_SUCCESS on success, 
+ * DSL_SHM_PRODUCER_RESULT_RING_FULL on timeout, DSL_SHM_PRODUCER_RESULT_RING_CLOSED
+ * if the consumer has closed the ring and it must be reopened.
+ */
+int dsl_shm_producer_frame_acquire(dsl_shm_producer* producer, 
+    uint32_t timeout_ms, void** data, uint64_t* size);
+
+/**
+ * @brief Commits the previously acquired slot, making the frame available
+ * to the consumer, and rings the consumer's doorbell.
+ * @param[in] producer handle returned by dsl_shm_producer_open.
+ * @param[in] size number of bytes written to the slot.
+ * @param[in] timestamp producer timestamp for the frame in nanoseconds, 
+ * or DSL_SHM_RING_TIMESTAMP_NONE.
+ * @return DSL_SHM_PRODUCER_RESULT_SUCCESS on success, one of the 
+ * DSL_SHM_PRODUCER_RESULT values otherwise.
+ */
+int dsl_shm_producer_frame_commit(dsl_shm_producer* producer, 
+    uint64_t size, uint64_t timestamp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _DSL_SHM_PRODUCER_H
@@ -0,0 +1,266 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SHM_RING_H
+#define _DSL_SHM_RING_H
+
+/**
+ * Shared-memory frame ring used to move frames between a producer process and
+ * a DSL Shared Memory Source without copying. This header has no dependencies
+ * other than libc and Linux headers so that it can be compiled into producer
+ * processes with the DSL Shared Memory Producer library (DslShmProducer.h).
+ *
+ * Memory layout of the named POSIX shared-memory segment
+ *   [0, DSL_SHM_RING_HEADER_SIZE)        dsl_shm_ring_header
+ *   [DSL_SHM_RING_HEADER_SIZE, ...)      dsl_shm_ring_slot[num_slots]
+ *   [data_offset, total_size)            num_slots frames of slot_stride bytes
+ *
+ * The ring is single-producer, single-consumer. The producer owns write_seq
+ * and the consumer owns read_seq. Both are free-running frame counters; the 
+ * slot for a frame is seq % num_slots. A slot is free to write while
+ * write_seq - read_seq < num_slots. The write and read doorbells are futex
+ * words bumped, and woken, after every commit and release respectively.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define DSL_SHM_RING_MAGIC                                          0x44534C52
+#define DSL_SHM_RING_VERSION                                        1
+#define DSL_SHM_RING_HEADER_SIZE                                    4096
+#define DSL_SHM_RING_ALIGNMENT                                      4096
+
+/**
+ * @brief timestamp value to use when the producer has no timestamp for a frame.
+ */
+#define DSL_SHM_RING_TIMESTAMP_NONE                                 UINT64_MAX
+
+/**
+ * @brief size of the video-format string in the ring header, e.g. "I420".
+ */
+#define DSL_SHM_RING_FORMAT_SIZE                                    16
+
+/**
+ * @struct dsl_shm_ring_slot
+ * @brief Per-slot descriptor written by the producer on commit.
+ */
+typedef struct _dsl_shm_ring_slot
+{
+    /**
+     * @brief sequence number of the frame currently in the slot.
+     */
+    uint64_t seq;
+
+    /**
+     * @brief number of bytes of frame data committed to the slot.
+     */
+    uint64_t size;
+
+    /**
+     * @brief producer timestamp for the frame in nanoseconds, or 
+     * DSL_SHM_RING_TIMESTAMP_NONE.
+     */
+    uint64_t timestamp;
+
+} dsl_shm_ring_slot;
+
+/**
+ * @struct dsl_shm_ring_header
+ * @brief Fixed header at the start of the shared-memory segment. Fields below 
+ * the "dynamic" marker are updated concurrently and must only be accessed
+ * with the __atomic builtins.
+ */
+typedef struct _dsl_shm_ring_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_slots;
+    uint32_t slot_size;
+    uint64_t slot_stride;
+    uint64_t data_offset;
+    uint64_t total_size;
+    uint32_t width;
+    uint32_t height;
+    uint32_t fps_n;
+    uint32_t fps_d;
+    char format[DSL_SHM_RING_FORMAT_SIZE];
+
+    // dynamic
+
+    /**
+     * @brief set to 1 by the consumer when the ring is closed. An attached
+     * producer must close and reopen the ring.
+     */
+    uint32_t consumer_closed;
+
+    /**
+     * @brief process-id of the attached producer, 0 when no producer.
+     */
+    int32_t producer_pid;
+
+    /**
+     * @brief incremented each time a producer attaches to the ring.
+     */
+    uint32_t producer_session;
+
+    /**
+     * @brief futex word bumped by the producer on every commit.
+     */
+    uint32_t write_doorbell;
+
+    /**
+     * @brief futex word bumped by the consumer on every release.
+     */
+    uint32_t read_doorbell;
+
+    /**
+     * @brief process-id of the consumer that created the ring.
+     */
+    int32_t consumer_pid;
+
+    /**
+     * @brief number of frames committed by the producer.
+     */
+    uint64_t write_seq;
+
+    /**
+     * @brief number of frames released by the consumer.
+     */
+    uint64_t read_seq;
+
+    /**
+     * @brief number of frames the producer failed to write because 
+     * the ring was full.
+     */
+    uint64_t overruns;
+
+} dsl_shm_ring_header;
+
+/**
+ * @brief Returns the descriptor for a ring slot.
+ */
+static inline dsl_shm_ring_slot* dsl_shm_ring_slot_get(
+    dsl_shm_ring_header* header, uint64_t seq)
+{
+    return (dsl_shm_ring_slot*)((char*)header + DSL_SHM_RING_HEADER_SIZE) 
+        + (seq % header->num_slots);
+}
+
+/**
+ * @brief Returns a pointer to the frame data for a ring slot.
+ */
+static inline void* dsl_shm_ring_slot_data_get(
+    dsl_shm_ring_header* header, uint64_t seq)
+{
+    return (char*)header + header->data_offset 
+        + (seq % header->num_slots) * header->slot_stride;
+}
+
+/**
+ * @brief Rounds a size up to the ring alignment.
+ */
+static inline uint64_t dsl_shm_ring_align(uint64_t size)
+{
+    return (size + DSL_SHM_RING_ALIGNMENT - 1) 
+        & ~((uint64_t)DSL_SHM_RING_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Bumps a doorbell and wakes all processes waiting on it.
+ */
+static inline void dsl_shm_ring_doorbell_ring(uint32_t* doorbell)
+{
+    __atomic_add_fetch(doorbell, 1, __ATOMIC_RELEASE);
+    syscall(SYS_futex, doorbell, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+ * @brief Waits for a doorbell to change from a previously read value.
+ * Spurious wakeups are possible; the caller must re-check its condition.
+ * @param[in] doorbell futex word to wait on.
+ * @param[in] value value of the doorbell read before checking the condition.
+ * @param[in] timeout_ms maximum time to wait in milliseconds.
+ */
+static inline void dsl_shm_ring_doorbell_wait(uint32_t* doorbell, 
+    uint32_t value, unsigned int timeout_ms)
+{
+    struct timespec timeout;
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_nsec = (long)(timeout_ms % 1000) * 1000000L;
+    syscall(SYS_futex, doorbell, FUTEX_WAIT, value, &timeout, NULL, 0);
+}
+
+/**
+ * @brief Checks if an existing named segment was left by a process that did
+ * not exit cleanly. A segment that can't be read, is still being created, or 
+ * does not start with the expected magic number, is never stale. Shared by 
+ * the frame ring and the egress ring, whose headers both start with a 32-bit
+ * magic number and record the creating process-id.
+ * @param[in] shm_name name of the existing segment.
+ * @param[in] magic magic number expected at the start of the header.
+ * @param[in] header_size size of the segment's header structure.
+ * @param[in] pid_offset offset of the creator's int32_t process-id 
+ * within the header, e.g. offsetof(dsl_shm_ring_header, consumer_pid).
+ * @return non-zero if the segment's creating process is no longer running.
+ */
+static inline int dsl_shm_ring_is_stale(const char* shm_name, 
+    uint32_t magic, size_t header_size, size_t pid_offset)
+{
+    int fd = shm_open(shm_name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return 0;
+    }
+    struct stat shm_stat;
+    void* map = MAP_FAILED;
+    if (fstat(fd, &shm_stat) == 0 && shm_stat.st_size >= (off_t)header_size)
+    {
+        map = mmap(NULL, header_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return 0;
+    }
+    int is_stale = 0;
+    if (__atomic_load_n((uint32_t*)map, __ATOMIC_ACQUIRE) == magic)
+    {
+        int32_t pid = *(int32_t*)((char*)map + pid_offset);
+        is_stale = pid && kill(pid, 0) && errno == ESRCH;
+    }
+    munmap(map, header_size);
+    return is_stale;
+}
+
+#endif // _DSL_SHM_RING_H
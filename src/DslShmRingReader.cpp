@@ -0,0 +1,274 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslShmRingReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace DSL
+{
+    static_assert(sizeof(dsl_shm_ring_header) <= DSL_SHM_RING_HEADER_SIZE,
+        "Shared-memory ring header exceeds its reserved size");
+    static_assert(offsetof(dsl_shm_ring_header, magic) == 0,
+        "Shared-memory ring magic must start the header");
+
+    ShmRingReader::ShmRingReader(const char* shmName, const char* format, 
+        uint width, uint height, uint fpsN, uint fpsD, 
+        uint slotSize, uint numSlots)
+        : m_shmName(shmName)
+        , m_fd(-1)
+        , m_pHeader(NULL)
+        , m_nextSeq(0)
+        , m_readSeq(0)
+        , m_released(numSlots, false)
+        , m_producerSession(0)
+        , m_producerRestarts(0)
+        , m_framesReceived(0)
+        , m_peakOccupied(0)
+        , m_overrunsBase(0)
+    {
+        LOG_FUNC();
+        
+        if (!numSlots or !slotSize or 
+            strlen(format) >= DSL_SHM_RING_FORMAT_SIZE)
+        {
+            LOG_ERROR("Invalid parameters for shared-memory ring '" 
+                << shmName << "'");
+            throw std::exception();
+        }
+        uint64_t slotStride = dsl_shm_ring_align(slotSize);
+        uint64_t dataOffset = dsl_shm_ring_align(DSL_SHM_RING_HEADER_SIZE 
+            + numSlots*sizeof(dsl_shm_ring_slot));
+        uint64_t totalSize = dataOffset + numSlots*slotStride;
+        
+        m_fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0660);
+        
+        // Replace a stale segment left by a consumer that did not exit cleanly,
+        // but never take over a segment that is still in use.
+        if (m_fd < 0 and errno == EEXIST)
+        {
+            if (!dsl_shm_ring_is_stale(shmName, DSL_SHM_RING_MAGIC,
+                sizeof(dsl_shm_ring_header), 
+                offsetof(dsl_shm_ring_header, consumer_pid)))
+            {
+                LOG_ERROR("Failed to create shared-memory ring '" << shmName 
+                    << "' as it is in use by another consumer");
+                throw std::exception();
+            }
+            LOG_WARN("Replacing stale shared-memory ring '" << shmName << "'");
+            shm_unlink(shmName);
+            m_fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0660);
+        }
+        if (m_fd < 0)
+        {
+            LOG_ERROR("Failed to create shared-memory ring '" << shmName 
+                << "' with errno = " << errno);
+            throw std::exception();
+        }
+        void* pMap(MAP_FAILED);
+        if (ftruncate(m_fd, totalSize) == 0)
+        {
+            pMap = mmap(NULL, totalSize, PROT_READ | PROT_WRITE, 
+                MAP_SHARED, m_fd, 0);
+        }
+        if (pMap == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map shared-memory ring '" << shmName 
+                << "' of size = " << totalSize << " with errno = " << errno);
+            close(m_fd);
+            shm_unlink(shmName);
+            throw std::exception();
+        }
+        
+        // The new segment is zero-filled, so only the static fields need 
+        // to be set. The magic is stored last so that a producer never 
+        // attaches to a partially initialized ring.
+        m_pHeader = (dsl_shm_ring_header*)pMap;
+        m_pHeader->version = DSL_SHM_RING_VERSION;
+        m_pHeader->num_slots = numSlots;
+        m_pHeader->slot_size = slotSize;
+        m_pHeader->slot_stride = slotStride;
+        m_pHeader->data_offset = dataOffset;
+        m_pHeader->total_size = totalSize;
+        m_pHeader->width = width;
+        m_pHeader->height = height;
+        m_pHeader->fps_n = fpsN;
+        m_pHeader->fps_d = fpsD;
+        strncpy(m_pHeader->format, format, DSL_SHM_RING_FORMAT_SIZE-1);
+        m_pHeader->consumer_pid = getpid();
+        __atomic_store_n(&m_pHeader->magic, DSL_SHM_RING_MAGIC, __ATOMIC_RELEASE);
+        
+        LOG_INFO("Created shared-memory ring '" << shmName << "' with " 
+            << numSlots << " slots of " << slotSize << " bytes");
+    }
+    
+    ShmRingReader::~ShmRingReader()
+    {
+        LOG_FUNC();
+        
+        // Wake a producer blocked waiting for a free slot so that it 
+        // finds the ring closed.
+        __atomic_store_n(&m_pHeader->consumer_closed, 1, __ATOMIC_RELEASE);
+        dsl_shm_ring_doorbell_ring(&m_pHeader->read_doorbell);
+        
+        munmap(m_pHeader, m_pHeader->total_size);
+        close(m_fd);
+        shm_unlink(m_shmName.c_str());
+    }
+    
+    const char* ShmRingReader::GetShmName()
+    {
+        LOG_FUNC();
+        
+        return m_shmName.c_str();
+    }
+    
+    void ShmRingReader::Reset()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readerMutex);
+        
+        m_nextSeq = m_readSeq = 
+            __atomic_load_n(&m_pHeader->write_seq, __ATOMIC_ACQUIRE);
+        std::fill(m_released.begin(), m_released.end(), false);
+        
+        __atomic_store_n(&m_pHeader->read_seq, m_readSeq, __ATOMIC_RELEASE);
+        dsl_shm_ring_doorbell_ring(&m_pHeader->read_doorbell);
+    }
+    
+    bool ShmRingReader::WaitForFrame(uint timeoutMs, uint64_t* seq, 
+        void** data, uint64_t* size, uint64_t* timestamp)
+    {
+        // Do not log function entry/exit for performance
+        
+        // read the doorbell before checking so a commit between the 
+        // check and the wait is not missed.
+        uint32_t doorbell = __atomic_load_n(&m_pHeader->write_doorbell, 
+            __ATOMIC_ACQUIRE);
+        uint64_t writeSeq = __atomic_load_n(&m_pHeader->write_seq, 
+            __ATOMIC_ACQUIRE);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readerMutex);
+            
+            uint producerSession = __atomic_load_n(
+                &m_pHeader->producer_session, __ATOMIC_ACQUIRE);
+            if (producerSession != m_producerSession)
+            {
+                if (m_producerSession)
+                {
+                    LOG_WARN("Producer re-attached to shared-memory ring '" 
+                        << m_shmName << "'");
+                    m_producerRestarts++;
+                }
+                m_producerSession = producerSession;
+            }
+            
+            if (m_nextSeq < writeSeq)
+            {
+                dsl_shm_ring_slot* pSlot = 
+                    dsl_shm_ring_slot_get(m_pHeader, m_nextSeq);
+                
+                *seq = m_nextSeq++;
+                *data = dsl_shm_ring_slot_data_get(m_pHeader, *seq);
+                *size = std::min(pSlot->size, (uint64_t)m_pHeader->slot_size);
+                *timestamp = pSlot->timestamp;
+                
+                m_framesReceived++;
+                m_peakOccupied = std::max(m_peakOccupied, 
+                    (uint)(writeSeq - m_readSeq));
+                return true;
+            }
+        }
+        dsl_shm_ring_doorbell_wait(&m_pHeader->write_doorbell, doorbell, 
+            timeoutMs);
+        return false;
+    }
+    
+    void ShmRingReader::ReleaseFrame(uint64_t seq)
+    {
+        // Do not log function entry/exit for performance
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readerMutex);
+        
+        // ignore frames from before the last Reset.
+        if (seq < m_readSeq or seq >= m_nextSeq)
+        {
+            return;
+        }
+        m_released[seq % m_released.size()] = true;
+        
+        if (seq != m_readSeq)
+        {
+            return;
+        }
+        while (m_readSeq < m_nextSeq and m_released[m_readSeq % m_released.size()])
+        {
+            m_released[m_readSeq % m_released.size()] = false;
+            m_readSeq++;
+        }
+        __atomic_store_n(&m_pHeader->read_seq, m_readSeq, __ATOMIC_RELEASE);
+        dsl_shm_ring_doorbell_ring(&m_pHeader->read_doorbell);
+    }
+    
+    void ShmRingReader::Wake()
+    {
+        LOG_FUNC();
+        
+        dsl_shm_ring_doorbell_ring(&m_pHeader->write_doorbell);
+    }
+    
+    void ShmRingReader::GetStats(dsl_shm_source_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readerMutex);
+        
+        int32_t producerPid = __atomic_load_n(&m_pHeader->producer_pid, 
+            __ATOMIC_ACQUIRE);
+        
+        stats->num_slots = m_pHeader->num_slots;
+        stats->occupied = __atomic_load_n(&m_pHeader->write_seq, 
+            __ATOMIC_ACQUIRE) - m_readSeq;
+        stats->peak_occupied = std::max(m_peakOccupied, stats->occupied);
+        stats->producer_attached = producerPid and 
+            (kill(producerPid, 0) == 0 or errno == EPERM);
+        stats->producer_restarts = m_producerRestarts;
+        stats->frames_received = m_framesReceived;
+        stats->overruns = __atomic_load_n(&m_pHeader->overruns, 
+            __ATOMIC_RELAXED) - m_overrunsBase;
+    }
+    
+    void ShmRingReader::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readerMutex);
+        
+        m_producerRestarts = 0;
+        m_framesReceived = 0;
+        m_peakOccupied = 0;
+        m_overrunsBase = __atomic_load_n(&m_pHeader->overruns, 
+            __ATOMIC_RELAXED);
+    }
+}
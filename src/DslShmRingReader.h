@@ -0,0 +1,190 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SHM_RING_READER_H
+#define _DSL_SHM_RING_READER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslShmRing.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_SHM_RING_READER_PTR std::shared_ptr<ShmRingReader>
+    #define DSL_SHM_RING_READER_NEW(shmName, format, width, height, \
+        fpsN, fpsD, slotSize, numSlots) \
+        std::shared_ptr<ShmRingReader>(new ShmRingReader(shmName, format, \
+            width, height, fpsN, fpsD, slotSize, numSlots))
+
+    /**
+     * @class ShmRingReader
+     * @brief Creates and owns a named shared-memory frame ring (DslShmRing.h),
+     * and reads the frames committed to it by a producer process. Frames are 
+     * returned in place; each must be released once it is no longer in use 
+     * so that its slot can be rewritten.
+     */
+    class ShmRingReader
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ShmRingReader class. Throws on failure to 
+         * create and map the shared-memory segment.
+         * @param[in] shmName name of the POSIX shared-memory segment to create.
+         * A stale segment with the same name is replaced.
+         * @param[in] format video format of the frames, e.g. "I420".
+         * @param[in] width width of the frames in pixels.
+         * @param[in] height height of the frames in pixels.
+         * @param[in] fpsN frames/second fraction numerator.
+         * @param[in] fpsD frames/second fraction denominator.
+         * @param[in] slotSize size of each frame slot in bytes.
+         * @param[in] numSlots number of frame slots in the ring.
+         */
+        ShmRingReader(const char* shmName, const char* format, 
+            uint width, uint height, uint fpsN, uint fpsD, 
+            uint slotSize, uint numSlots);
+
+        /**
+         * @brief dtor for the ShmRingReader class. Marks the ring closed,
+         * wakes any waiting producer, and removes the segment.
+         */
+        ~ShmRingReader();
+        
+        /**
+         * @brief Gets the name of the shared-memory segment.
+         * @return name of the segment.
+         */
+        const char* GetShmName();
+        
+        /**
+         * @brief Skips all frames committed but not yet read, making their
+         * slots free. Must only be called when no frames are in use.
+         */
+        void Reset();
+        
+        /**
+         * @brief Returns the next frame committed by the producer, waiting 
+         * up to timeoutMs for the producer's doorbell if there is none.
+         * @param[in] timeoutMs maximum time to wait in milliseconds.
+         * @param[out] seq sequence number of the frame, to release with.
+         * @param[out] data pointer to the frame data in the ring.
+         * @param[out] size size of the frame data in bytes.
+         * @param[out] timestamp producer timestamp for the frame in 
+         * nanoseconds, or DSL_SHM_RING_TIMESTAMP_NONE.
+         * @return true if a frame was returned, false on timeout or wakeup.
+         */
+        bool WaitForFrame(uint timeoutMs, uint64_t* seq, void** data, 
+            uint64_t* size, uint64_t* timestamp);
+            
+        /**
+         * @brief Releases a frame previously returned by WaitForFrame. Frames 
+         * may be released in any order; slots are freed in ring order.
+         * @param[in] seq sequence number of the frame to release.
+         */
+        void ReleaseFrame(uint64_t seq);
+        
+        /**
+         * @brief Wakes a thread blocked in WaitForFrame.
+         */
+        void Wake();
+        
+        /**
+         * @brief Gets the current stats for the ring.
+         * @param[out] stats current stats.
+         */
+        void GetStats(dsl_shm_source_stats* stats);
+        
+        /**
+         * @brief Clears the current stats for the ring.
+         */
+        void ClearStats();
+        
+    private:
+    
+        /**
+         * @brief name of the shared-memory segment.
+         */
+        std::string m_shmName;
+        
+        /**
+         * @brief file descriptor for the shared-memory segment.
+         */
+        int m_fd;
+        
+        /**
+         * @brief ring header at the start of the mapped segment.
+         */
+        dsl_shm_ring_header* m_pHeader;
+        
+        /**
+         * @brief sequence number of the next frame to read.
+         */
+        uint64_t m_nextSeq;
+        
+        /**
+         * @brief sequence number of the oldest frame not yet released.
+         */
+        uint64_t m_readSeq;
+        
+        /**
+         * @brief per-slot released flags for frames released out of order.
+         */
+        std::vector<bool> m_released;
+        
+        /**
+         * @brief last producer-session seen, used to detect producer restarts.
+         */
+        uint m_producerSession;
+        
+        /**
+         * @brief number of producer re-attaches since the stats were cleared.
+         */
+        uint m_producerRestarts;
+        
+        /**
+         * @brief number of frames read since the stats were cleared.
+         */
+        uint64_t m_framesReceived;
+        
+        /**
+         * @brief peak occupied slots since the stats were cleared.
+         */
+        uint m_peakOccupied;
+        
+        /**
+         * @brief value of the ring's overrun counter when the stats were cleared.
+         */
+        uint64_t m_overrunsBase;
+        
+        /**
+         * @brief mutex to protect mutual access to the read state and stats.
+         */
+        DslMutex m_readerMutex;
+    };
+}
+
+#endif // _DSL_SHM_RING_READER_H
@@ -0,0 +1,260 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslShmRingWriter.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace DSL
+{
+    static_assert(sizeof(dsl_shm_egress_ring_header) <= DSL_SHM_RING_HEADER_SIZE,
+        "Shared-memory egress ring header exceeds its reserved size");
+    static_assert(offsetof(dsl_shm_egress_ring_header, magic) == 0,
+        "Shared-memory egress ring magic must start the header");
+    static_assert(sizeof(dsl_shm_egress_frame) <= DSL_SHM_EGRESS_RING_OBJECTS_OFFSET,
+        "Shared-memory egress frame descriptor exceeds its reserved size");
+
+    ShmRingWriter::ShmRingWriter(const char* shmName, uint dataType, 
+        const char* format, uint width, uint height, uint slotSize, uint numSlots)
+        : m_shmName(shmName)
+        , m_fd(-1)
+        , m_pHeader(NULL)
+        , m_writeSeq(0)
+        , m_framesWritten(0)
+        , m_objectsDropped(0)
+        , m_skipsBase(0)
+    {
+        LOG_FUNC();
+        
+        if (!numSlots or strlen(format) >= DSL_SHM_RING_FORMAT_SIZE or
+            (dataType == DSL_SHM_EGRESS_RING_DATA_TYPE_FRAMES and !slotSize))
+        {
+            LOG_ERROR("Invalid parameters for shared-memory egress ring '" 
+                << shmName << "'");
+            throw std::exception();
+        }
+        // frame data starts on a cache line after the object records.
+        uint64_t frameDataOffset = (DSL_SHM_EGRESS_RING_OBJECTS_OFFSET 
+            + DSL_SHM_EGRESS_RING_MAX_OBJECTS*sizeof(dsl_shm_egress_object) 
+            + 63) & ~(uint64_t)63;
+        uint64_t slotStride = dsl_shm_ring_align(frameDataOffset + slotSize);
+        uint64_t totalSize = DSL_SHM_RING_HEADER_SIZE + numSlots*slotStride;
+        
+        m_fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0660);
+        
+        // Replace a stale segment left by a writer that did not exit cleanly,
+        // but never take over a segment that is still in use.
+        if (m_fd < 0 and errno == EEXIST)
+        {
+            if (!dsl_shm_ring_is_stale(shmName, DSL_SHM_EGRESS_RING_MAGIC,
+                sizeof(dsl_shm_egress_ring_header), 
+                offsetof(dsl_shm_egress_ring_header, writer_pid)))
+            {
+                LOG_ERROR("Failed to create shared-memory egress ring '" << shmName 
+                    << "' as it is in use by another writer");
+                throw std::exception();
+            }
+            LOG_WARN("Replacing stale shared-memory egress ring '" << shmName << "'");
+            shm_unlink(shmName);
+            m_fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0660);
+        }
+        if (m_fd < 0)
+        {
+            LOG_ERROR("Failed to create shared-memory egress ring '" << shmName 
+                << "' with errno = " << errno);
+            throw std::exception();
+        }
+        void* pMap(MAP_FAILED);
+        if (ftruncate(m_fd, totalSize) == 0)
+        {
+            pMap = mmap(NULL, totalSize, PROT_READ | PROT_WRITE, 
+                MAP_SHARED, m_fd, 0);
+        }
+        if (pMap == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map shared-memory egress ring '" << shmName 
+                << "' of size = " << totalSize << " with errno = " << errno);
+            close(m_fd);
+            shm_unlink(shmName);
+            throw std::exception();
+        }
+        
+        // The new segment is zero-filled, so only the static fields need 
+        // to be set. The magic is stored last so that a reader never 
+        // attaches to a partially initialized ring.
+        m_pHeader = (dsl_shm_egress_ring_header*)pMap;
+        m_pHeader->version = DSL_SHM_EGRESS_RING_VERSION;
+        m_pHeader->data_type = dataType;
+        m_pHeader->num_slots = numSlots;
+        m_pHeader->max_objects = DSL_SHM_EGRESS_RING_MAX_OBJECTS;
+        m_pHeader->slot_size = slotSize;
+        m_pHeader->slot_stride = slotStride;
+        m_pHeader->frame_data_offset = frameDataOffset;
+        m_pHeader->total_size = totalSize;
+        m_pHeader->width = width;
+        m_pHeader->height = height;
+        strncpy(m_pHeader->format, format, DSL_SHM_RING_FORMAT_SIZE-1);
+        m_pHeader->writer_pid = getpid();
+        __atomic_store_n(&m_pHeader->magic, DSL_SHM_EGRESS_RING_MAGIC, 
+            __ATOMIC_RELEASE);
+        
+        LOG_INFO("Created shared-memory egress ring '" << shmName << "' with " 
+            << numSlots << " slots of " << slotStride << " bytes");
+    }
+    
+    ShmRingWriter::~ShmRingWriter()
+    {
+        LOG_FUNC();
+        
+        // Wake all waiting readers so that they find the ring closed.
+        __atomic_store_n(&m_pHeader->writer_closed, 1, __ATOMIC_RELEASE);
+        dsl_shm_ring_doorbell_ring(&m_pHeader->write_doorbell);
+        
+        munmap(m_pHeader, m_pHeader->total_size);
+        close(m_fd);
+        shm_unlink(m_shmName.c_str());
+    }
+    
+    const char* ShmRingWriter::GetShmName()
+    {
+        LOG_FUNC();
+        
+        return m_shmName.c_str();
+    }
+    
+    dsl_shm_egress_frame* ShmRingWriter::BeginFrame()
+    {
+        // Do not log function entry/exit for performance
+        
+        dsl_shm_egress_frame* pFrame = 
+            dsl_shm_egress_ring_frame_get(m_pHeader, m_writeSeq+1);
+        
+        // invalidate the slot before any of its contents are rewritten.
+        __atomic_store_n(&pFrame->seq, 0, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        
+        return pFrame;
+    }
+    
+    dsl_shm_egress_object* ShmRingWriter::GetObjects(
+        dsl_shm_egress_frame* pFrame)
+    {
+        // Do not log function entry/exit for performance
+        
+        return dsl_shm_egress_ring_objects_get(pFrame);
+    }
+    
+    void* ShmRingWriter::GetData(dsl_shm_egress_frame* pFrame)
+    {
+        // Do not log function entry/exit for performance
+        
+        return dsl_shm_egress_ring_data_get(m_pHeader, pFrame);
+    }
+    
+    uint ShmRingWriter::GetMaxObjects()
+    {
+        // Do not log function entry/exit for performance
+        
+        return m_pHeader->max_objects;
+    }
+    
+    uint ShmRingWriter::GetSlotSize()
+    {
+        // Do not log function entry/exit for performance
+        
+        return m_pHeader->slot_size;
+    }
+    
+    void ShmRingWriter::CommitFrame(dsl_shm_egress_frame* pFrame, 
+        uint numObjects)
+    {
+        // Do not log function entry/exit for performance
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        pFrame->num_objects = std::min(numObjects, m_pHeader->max_objects);
+        m_objectsDropped += numObjects - pFrame->num_objects;
+        m_framesWritten++;
+        
+        // publish the slot, then the new write_seq. 
+        __atomic_store_n(&pFrame->seq, ++m_writeSeq, __ATOMIC_RELEASE);
+        __atomic_store_n(&m_pHeader->write_seq, m_writeSeq, __ATOMIC_SEQ_CST);
+        
+        // Readers register as waiters before re-checking write_seq, so the
+        // futex syscall is only needed when a reader is waiting.
+        __atomic_add_fetch(&m_pHeader->write_doorbell, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&m_pHeader->waiters, __ATOMIC_SEQ_CST))
+        {
+            syscall(SYS_futex, &m_pHeader->write_doorbell, FUTEX_WAKE, 
+                INT_MAX, NULL, NULL, 0);
+        }
+    }
+    
+    void ShmRingWriter::GetStats(dsl_shm_sink_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        stats->num_slots = m_pHeader->num_slots;
+        stats->readers = 0;
+        stats->slow_readers = 0;
+        
+        for (auto i = 0; i < DSL_SHM_EGRESS_RING_MAX_READERS; i++)
+        {
+            dsl_shm_egress_reader* pReader = &m_pHeader->readers[i];
+            
+            int32_t pid = __atomic_load_n(&pReader->pid, __ATOMIC_ACQUIRE);
+            if (!pid or (kill(pid, 0) and errno != EPERM))
+            {
+                continue;
+            }
+            stats->readers++;
+            
+            // a reader is slow once the frame after its cursor is overwritten.
+            uint64_t cursor = __atomic_load_n(&pReader->cursor, 
+                __ATOMIC_ACQUIRE);
+            if (cursor < m_writeSeq and 
+                m_writeSeq - cursor > m_pHeader->num_slots)
+            {
+                stats->slow_readers++;
+            }
+        }
+        stats->frames_written = m_framesWritten;
+        stats->objects_dropped = m_objectsDropped;
+        stats->reader_skips = __atomic_load_n(&m_pHeader->skips, 
+            __ATOMIC_RELAXED) - m_skipsBase;
+    }
+    
+    void ShmRingWriter::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        m_framesWritten = 0;
+        m_objectsDropped = 0;
+        m_skipsBase = __atomic_load_n(&m_pHeader->skips, __ATOMIC_RELAXED);
+    }
+}
@@ -0,0 +1,180 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SHM_RING_WRITER_H
+#define _DSL_SHM_RING_WRITER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslShmEgressRing.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_SHM_RING_WRITER_PTR std::shared_ptr<ShmRingWriter>
+    #define DSL_SHM_RING_WRITER_NEW(shmName, dataType, format, \
+        width, height, slotSize, numSlots) \
+        std::shared_ptr<ShmRingWriter>(new ShmRingWriter(shmName, dataType, \
+            format, width, height, slotSize, numSlots))
+
+    /**
+     * @class ShmRingWriter
+     * @brief Creates and owns a named shared-memory broadcast ring 
+     * (DslShmEgressRing.h), and writes frames and/or object metadata to it
+     * for any number of reader processes. The writer never waits for readers;
+     * readers that fall behind skip ahead.
+     */
+    class ShmRingWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ShmRingWriter class. Throws on failure to 
+         * create and map the shared-memory segment.
+         * @param[in] shmName name of the POSIX shared-memory segment to create.
+         * A stale segment with the same name is replaced.
+         * @param[in] dataType one of the DSL_SHM_EGRESS_RING_DATA_TYPE values.
+         * @param[in] format video format of the frames, e.g. "RGBA".
+         * @param[in] width width of the frames in pixels.
+         * @param[in] height height of the frames in pixels.
+         * @param[in] slotSize size of the frame data in each slot in bytes,
+         * 0 for metadata-only.
+         * @param[in] numSlots number of slots in the ring.
+         */
+        ShmRingWriter(const char* shmName, uint dataType, const char* format, 
+            uint width, uint height, uint slotSize, uint numSlots);
+
+        /**
+         * @brief dtor for the ShmRingWriter class. Marks the ring closed,
+         * wakes all waiting readers, and removes the segment.
+         */
+        ~ShmRingWriter();
+        
+        /**
+         * @brief Gets the name of the shared-memory segment.
+         * @return name of the segment.
+         */
+        const char* GetShmName();
+        
+        /**
+         * @brief Begins writing the next frame, invalidating the oldest slot 
+         * in the ring for all readers. Must be followed by CommitFrame.
+         * @return frame descriptor for the slot to write. The caller sets all 
+         * fields other than seq and num_objects.
+         */
+        dsl_shm_egress_frame* BeginFrame();
+        
+        /**
+         * @brief Gets the object records for a slot returned by BeginFrame.
+         * @param[in] pFrame frame descriptor returned by BeginFrame.
+         * @return array of GetMaxObjects() object records.
+         */
+        dsl_shm_egress_object* GetObjects(dsl_shm_egress_frame* pFrame);
+        
+        /**
+         * @brief Gets the frame data for a slot returned by BeginFrame.
+         * @param[in] pFrame frame descriptor returned by BeginFrame.
+         * @return pointer to GetSlotSize() bytes of frame data.
+         */
+        void* GetData(dsl_shm_egress_frame* pFrame);
+        
+        /**
+         * @brief Gets the maximum number of object records per slot.
+         * @return maximum number of object records.
+         */
+        uint GetMaxObjects();
+        
+        /**
+         * @brief Gets the size of the frame data in each slot.
+         * @return size of the frame data in bytes.
+         */
+        uint GetSlotSize();
+        
+        /**
+         * @brief Publishes the slot returned by BeginFrame to all readers and 
+         * wakes any waiting readers.
+         * @param[in] pFrame frame descriptor returned by BeginFrame.
+         * @param[in] numObjects number of objects in the frame. Objects beyond 
+         * GetMaxObjects() are counted as dropped.
+         */
+        void CommitFrame(dsl_shm_egress_frame* pFrame, uint numObjects);
+        
+        /**
+         * @brief Gets the current stats for the ring.
+         * @param[out] stats current stats.
+         */
+        void GetStats(dsl_shm_sink_stats* stats);
+        
+        /**
+         * @brief Clears the current stats for the ring.
+         */
+        void ClearStats();
+        
+    private:
+    
+        /**
+         * @brief name of the shared-memory segment.
+         */
+        std::string m_shmName;
+        
+        /**
+         * @brief file descriptor for the shared-memory segment.
+         */
+        int m_fd;
+        
+        /**
+         * @brief ring header at the start of the mapped segment.
+         */
+        dsl_shm_egress_ring_header* m_pHeader;
+        
+        /**
+         * @brief number of the last frame committed.
+         */
+        uint64_t m_writeSeq;
+        
+        /**
+         * @brief number of frames written since the stats were cleared.
+         */
+        uint64_t m_framesWritten;
+        
+        /**
+         * @brief number of objects dropped since the stats were cleared.
+         */
+        uint64_t m_objectsDropped;
+        
+        /**
+         * @brief value of the ring's skip counter when the stats were cleared.
+         */
+        uint64_t m_skipsBase;
+        
+        /**
+         * @brief mutex to protect mutual access to the write state and stats.
+         */
+        DslMutex m_writerMutex;
+    };
+}
+
+#endif // _DSL_SHM_RING_WRITER_H
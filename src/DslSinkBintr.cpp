@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslBranchBintr.h"
 #include "DslOdeAction.h"
 #include "DslServices.h"
+#include "DslPipelineStateMgr.h"
 
 #include <gst-nvdssr.h>
 #include <gst/app/gstappsink.h>
@@ -211,6 +212,18 @@ namespace DSL
         , m_dataType(dataType)
         , m_clientHandler(clientHandler)
         , m_clientData(clientData)
+        , m_deliveryQueueSize(0)
+        , m_deliveryPolicy(DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST)
+        , m_deliveryBatchSize(1)
+        , m_pDeliveryThread(NULL)
+        , m_stopDelivery(true)
+        , m_deliverySession(0)
+        , m_pStoppedDeliveryThread(NULL)
+        , m_deliveryFlowReturn(GST_FLOW_OK)
+        , m_peakDeliveryQueueDepth(0)
+        , m_samplesReceived(0)
+        , m_samplesDelivered(0)
+        , m_samplesDropped(0)
     {
         LOG_FUNC();
 
@@ -258,6 +271,17 @@ namespace DSL
         {
             UnlinkAll();
         }
+        if (m_pStoppedDeliveryThread)
+        {
+            if (g_thread_self() == m_pStoppedDeliveryThread)
+            {
+                g_thread_unref(m_pStoppedDeliveryThread);
+            }
+            else
+            {
+                g_thread_join(m_pStoppedDeliveryThread);
+            }
+        }
     }
 
     bool AppSinkBintr::LinkAll()
@@ -273,6 +297,8 @@ namespace DSL
         {
             return false;
         }
+        StartDelivery();
+        
         m_isLinked = true;
         return true;
     }
@@ -286,6 +312,8 @@ namespace DSL
             LOG_ERROR("AppSinkBintr '" << GetName() << "' is not linked");
             return;
         }
+        StopDelivery();
+        
         m_pQueue->UnlinkFromSink();
         m_isLinked = false;
     }
@@ -305,10 +333,149 @@ namespace DSL
         m_dataType = dataType;
     }
 
+    void AppSinkBintr::GetDeliverySettings(uint* queueSize, 
+        uint* policy, uint* batchSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+
+        *queueSize = m_deliveryQueueSize;
+        *policy = m_deliveryPolicy;
+        *batchSize = m_deliveryBatchSize;
+    }
+
+    bool AppSinkBintr::SetDeliverySettings(uint queueSize, 
+        uint policy, uint batchSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Unable to set delivery settings for AppSinkBintr '" 
+                << GetName() << "' as it's currently linked");
+            return false;
+        }
+        m_deliveryQueueSize = queueSize;
+        m_deliveryPolicy = policy;
+        m_deliveryBatchSize = batchSize;
+        
+        return true;
+    }
+
+    void AppSinkBintr::GetDeliveryStats(dsl_sink_app_delivery_stats* pStats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+
+        pStats->queue_depth = m_deliveryQueue.size();
+        pStats->peak_queue_depth = m_peakDeliveryQueueDepth;
+        pStats->received = m_samplesReceived;
+        pStats->delivered = m_samplesDelivered;
+        pStats->dropped = m_samplesDropped;
+        m_deliveryLag.GetStats(&pStats->lag);
+    }
+
+    void AppSinkBintr::ClearDeliveryStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+
+        m_peakDeliveryQueueDepth = m_deliveryQueue.size();
+        m_samplesReceived = 0;
+        m_samplesDelivered = 0;
+        m_samplesDropped = 0;
+        m_deliveryLag.Clear();
+    }
+
+    void AppSinkBintr::StartDelivery()
+    {
+        LOG_FUNC();
+        
+        // A thread stopped from its own client handler has ended its session,
+        // so it exits once its handler returns. Join it now, unless it is 
+        // the thread restarting delivery.
+        if (m_pStoppedDeliveryThread)
+        {
+            if (g_thread_self() == m_pStoppedDeliveryThread)
+            {
+                g_thread_unref(m_pStoppedDeliveryThread);
+            }
+            else
+            {
+                g_thread_join(m_pStoppedDeliveryThread);
+            }
+            m_pStoppedDeliveryThread = NULL;
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+        
+        if (!m_deliveryQueueSize)
+        {
+            return;
+        }
+        m_stopDelivery = false;
+        m_deliveryFlowReturn = GST_FLOW_OK;
+        m_pDeliveryThread = g_thread_new("dsl-app-sink", 
+            app_sink_delivery_thread, new std::pair<AppSinkBintr*, uint64_t>(
+                this, m_deliverySession));
+    }
+
+    void AppSinkBintr::StopDelivery()
+    {
+        LOG_FUNC();
+        
+        if (!m_pDeliveryThread)
+        {
+            return;
+        }
+        g_mutex_lock(&m_deliveryMutex);
+        m_stopDelivery = true;
+        m_deliverySession++;
+        g_cond_broadcast(&m_deliveryCond);
+        g_cond_broadcast(&m_deliverySpaceCond);
+        g_mutex_unlock(&m_deliveryMutex);
+        
+        // The client handler may stop the Pipeline from the delivery thread
+        // itself, in which case the thread exits once the handler returns,
+        // and is joined on the next start.
+        if (g_thread_self() == m_pDeliveryThread)
+        {
+            m_pStoppedDeliveryThread = m_pDeliveryThread;
+        }
+        else
+        {
+            g_thread_join(m_pDeliveryThread);
+        }
+        m_pDeliveryThread = NULL;
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+        while (m_deliveryQueue.size())
+        {
+            gst_sample_unref(m_deliveryQueue.front().first);
+            m_deliveryQueue.pop_front();
+        }
+    }
+
     GstFlowReturn AppSinkBintr::HandleNewSample()
     {
         // don't log function for performance
 
+        // The queue-size can only be changed while unlinked.
+        if (m_deliveryQueueSize)
+        {
+            GstSample* pSample = gst_app_sink_pull_sample(
+                GST_APP_SINK(m_pSink->GetGstElement()));
+                
+            if (!pSample)
+            {
+                LOG_INFO("AppSinkBintr '" << GetName()
+                    << "' pulled NULL data. Exiting with EOS");
+                return GST_FLOW_EOS;
+            }
+            return QueueSample(pSample);
+        }
+
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dataHandlerMutex);
 
         void* pData(NULL);
@@ -334,49 +501,202 @@ namespace DSL
         }
         else
         {
-            uint clientRetVal(DSL_FLOW_ERROR);
+            dslRetVal = CallClientHandler(m_dataType, pData);
+        }
+        gst_sample_unref(pSample);
+
+        return dslRetVal;
+    }
+
+    GstFlowReturn AppSinkBintr::CallClientHandler(uint dataType, void* pData)
+    {
+        // don't log function for performance
+
+        GstFlowReturn dslRetVal(GST_FLOW_ERROR);
+        uint clientRetVal(DSL_FLOW_ERROR);
+
+        try
+        {
+            // call the client handler with the buffer and process.
+            clientRetVal = m_clientHandler(dataType, pData, m_clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("AppSinkBintr '" << GetName()
+                                       << "' threw exception calling client handler function");
+            m_clientHandler = NULL;
+            dslRetVal = GST_FLOW_EOS;
+        }
+        // Normal case - continue execution
+        if (clientRetVal == DSL_FLOW_OK)
+        {
+            dslRetVal = GST_FLOW_OK;
+        }
+        // EOS case - exiting with End-of-Stream
+        else if (clientRetVal == DSL_FLOW_EOS)
+        {
+            dslRetVal = GST_FLOW_EOS;
+        }
+        // Error case - client should report error as well.
+        else if (clientRetVal == DSL_FLOW_ERROR)
+        {
+            LOG_ERROR("Client handler function for AppSinkBintr '"
+                      << GetName() << "' returned DSL_FLOW_ERROR");
+            dslRetVal = GST_FLOW_ERROR;
+        }
+        else
+        {
+            // Invalid return value from client
+            LOG_ERROR("Client handler function for AppSinkBintr '"
+                      << GetName() << "' returned an invalid DSL_FLOW value = "
+                      << clientRetVal);
+            dslRetVal = GST_FLOW_ERROR;
+        }
+        return dslRetVal;
+    }
+
+    GstFlowReturn AppSinkBintr::QueueSample(GstSample* pSample)
+    {
+        // don't log function for performance
 
-            try
+        uint64_t receivedCycles = CycleCounter::Now();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_deliveryMutex);
+        
+        // Once the client has ended the stream, all new samples are refused.
+        if (m_deliveryFlowReturn != GST_FLOW_OK)
+        {
+            gst_sample_unref(pSample);
+            return m_deliveryFlowReturn;
+        }
+        m_samplesReceived++;
+        
+        while (m_stopDelivery or m_deliveryQueue.size() >= m_deliveryQueueSize)
+        {
+            if (m_deliveryPolicy == DSL_SINK_APP_DELIVERY_POLICY_DROP_NEWEST or
+                m_stopDelivery)
             {
-                // call the client handler with the buffer and process.
-                clientRetVal = m_clientHandler(m_dataType, pData, m_clientData);
+                m_samplesDropped++;
+                gst_sample_unref(pSample);
+                return GST_FLOW_OK;
             }
-            catch(...)
+            if (m_deliveryPolicy == DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST)
             {
-                LOG_ERROR("AppSinkBintr '" << GetName()
-                                           << "' threw exception calling client handler function");
-                m_clientHandler = NULL;
-                dslRetVal = GST_FLOW_EOS;
+                m_samplesDropped++;
+                gst_sample_unref(m_deliveryQueue.front().first);
+                m_deliveryQueue.pop_front();
             }
-            // Normal case - continue execution
-            if (clientRetVal == DSL_FLOW_OK)
+            else
             {
-                dslRetVal = GST_FLOW_OK;
+                g_cond_wait(&m_deliverySpaceCond, &m_deliveryMutex);
+                
+                if (m_deliveryFlowReturn != GST_FLOW_OK)
+                {
+                    gst_sample_unref(pSample);
+                    return m_deliveryFlowReturn;
+                }
             }
-            // EOS case - exiting with End-of-Stream
-            else if (clientRetVal == DSL_FLOW_EOS)
+        }
+        m_deliveryQueue.push_back(std::make_pair(pSample, receivedCycles));
+        m_peakDeliveryQueueDepth = std::max(m_peakDeliveryQueueDepth,
+            (uint)m_deliveryQueue.size());
+            
+        g_cond_signal(&m_deliveryCond);
+        return GST_FLOW_OK;
+    }
+
+    void AppSinkBintr::HandleDelivery(uint64_t session)
+    {
+        LOG_FUNC();
+        
+        std::vector<GstSample*> samples;
+        
+        g_mutex_lock(&m_deliveryMutex);
+        
+        while (session == m_deliverySession)
+        {
+            if (m_deliveryQueue.empty())
             {
-                dslRetVal = GST_FLOW_EOS;
+                g_cond_wait(&m_deliveryCond, &m_deliveryMutex);
+                continue;
             }
-            // Error case - client should report error as well.
-            else if (clientRetVal == DSL_FLOW_ERROR)
+            // Take up to batch-size samples - a lagging consumer is delivered 
+            // larger batches without waiting for a batch to fill.
+            uint64_t startCycles = CycleCounter::Now();
+            while (m_deliveryQueue.size() and 
+                samples.size() < m_deliveryBatchSize)
             {
-                LOG_ERROR("Client handler function for AppSinkBintr '"
-                          << GetName() << "' returned DSL_FLOW_ERROR");
-                dslRetVal = GST_FLOW_ERROR;
+                m_deliveryLag.Record(CycleCounter::ToNanoseconds(
+                    startCycles - m_deliveryQueue.front().second));
+                samples.push_back(m_deliveryQueue.front().first);
+                m_deliveryQueue.pop_front();
             }
-            else
+            g_cond_signal(&m_deliverySpaceCond);
+            g_mutex_unlock(&m_deliveryMutex);
+            
+            GstFlowReturn flowReturn(GST_FLOW_OK);
             {
-                // Invalid return value from client
-                LOG_ERROR("Client handler function for AppSinkBintr '"
-                          << GetName() << "' returned an invalid DSL_FLOW value = "
-                          << clientRetVal);
-                dslRetVal = GST_FLOW_ERROR;
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dataHandlerMutex);
+                
+                if (m_deliveryBatchSize > 1)
+                {
+                    GstBufferList* pBufferList = 
+                        gst_buffer_list_new_sized(samples.size());
+                    for (auto const& ivec: samples)
+                    {
+                        GstBuffer* pBuffer = gst_sample_get_buffer(ivec);
+                        if (pBuffer)
+                        {
+                            gst_buffer_list_add(pBufferList, 
+                                gst_buffer_ref(pBuffer));
+                        }
+                    }
+                    flowReturn = CallClientHandler(
+                        DSL_SINK_APP_DATA_TYPE_BUFFER_LIST, pBufferList);
+                    gst_buffer_list_unref(pBufferList);
+                }
+                else if (m_dataType == DSL_SINK_APP_DATA_TYPE_SAMPLE)
+                {
+                    flowReturn = CallClientHandler(m_dataType, samples[0]);
+                }
+                else
+                {
+                    flowReturn = CallClientHandler(m_dataType, 
+                        gst_sample_get_buffer(samples[0]));
+                }
+            }
+            for (auto const& ivec: samples)
+            {
+                gst_sample_unref(ivec);
+            }
+            
+            g_mutex_lock(&m_deliveryMutex);
+            
+            m_samplesDelivered += samples.size();
+            samples.clear();
+            
+            // Delivery was stopped, and possibly restarted, by the client
+            // handler. The flow-return and queue belong to the new session.
+            if (session != m_deliverySession)
+            {
+                break;
+            }
+            
+            // The client has ended the stream - drop all queued samples and 
+            // return the client's flow-return to the streaming thread.
+            if (flowReturn != GST_FLOW_OK)
+            {
+                m_deliveryFlowReturn = flowReturn;
+                while (m_deliveryQueue.size())
+                {
+                    m_samplesDropped++;
+                    gst_sample_unref(m_deliveryQueue.front().first);
+                    m_deliveryQueue.pop_front();
+                }
+                g_cond_broadcast(&m_deliverySpaceCond);
             }
         }
-        gst_sample_unref(pSample);
-
-        return dslRetVal;
+        g_mutex_unlock(&m_deliveryMutex);
     }
 
     static GstFlowReturn on_new_sample_cb(GstElement* pSinkElement,
@@ -386,6 +706,16 @@ namespace DSL
             HandleNewSample();
     }
 
+    static gpointer app_sink_delivery_thread(gpointer pSession)
+    {
+        std::unique_ptr<std::pair<AppSinkBintr*, uint64_t>> pAppSinkSession(
+            static_cast<std::pair<AppSinkBintr*, uint64_t>*>(pSession));
+            
+        pAppSinkSession->first->HandleDelivery(pAppSinkSession->second);
+        
+        return NULL;
+    }
+
     //-------------------------------------------------------------------------
 
     FrameCaptureSinkBintr::FrameCaptureSinkBintr(const char* name,
@@ -517,6 +847,455 @@ namespace DSL
             HandleNewBuffer(data);
     }
 
+    //-------------------------------------------------------------------------
+
+    ShmSinkBintr::ShmSinkBintr(const char* name, const char* shmName, 
+        uint dataType, const char* bufferOutFormat, uint width, uint height, 
+        uint numSlots)
+        : AppSinkBintr(name, DSL_SINK_APP_DATA_TYPE_BUFFER,
+            on_new_shm_buffer_cb, NULL)
+        , m_shmDataType(dataType)
+        , m_bufferOutFormat(bufferOutFormat)
+    {
+        LOG_FUNC();
+        
+        uint slotSize(0);
+        gst_video_info_init(&m_videoInfo);
+        
+        if (m_shmDataType == DSL_SINK_SHM_DATA_TYPE_FRAMES)
+        {
+            // Each ring slot holds exactly one frame in the buffer-out-format.
+            if (!gst_video_info_set_format(&m_videoInfo, 
+                gst_video_format_from_string(bufferOutFormat), width, height))
+            {
+                LOG_ERROR("Invalid buffer-out-format or dimensions for ShmSinkBintr '"
+                    << name << "'");
+                throw std::exception();
+            }
+            slotSize = GST_VIDEO_INFO_SIZE(&m_videoInfo);
+            
+            m_pTransform = DSL_ELEMENT_NEW("nvvideoconvert", name);
+            m_pCapsFilter = DSL_ELEMENT_NEW("capsfilter", name);
+
+            // Scale and convert to system memory for the reader processes.
+            GstCaps* pCaps = gst_caps_new_simple("video/x-raw",
+                "format", G_TYPE_STRING, bufferOutFormat,
+                "width", G_TYPE_INT, width,
+                "height", G_TYPE_INT, height, NULL);
+            if (!pCaps)
+            {
+                LOG_ERROR("Failed to create new Simple Capabilities for '" 
+                    << name << "'");
+                throw std::exception();
+            }
+            m_pCapsFilter->SetAttribute("caps", pCaps);
+            gst_caps_unref(pCaps);
+            
+            m_pTransform->SetAttribute("gpu-id", m_gpuId);
+
+            AddChild(m_pTransform);
+            AddChild(m_pCapsFilter);
+        }
+        
+        // Create the ring now so that readers can attach before the 
+        // Pipeline is played. Throws on failure.
+        m_pRingWriter = DSL_SHM_RING_WRITER_NEW(shmName, dataType, 
+            bufferOutFormat, width, height, slotSize, numSlots);
+
+        LOG_INFO("");
+        LOG_INFO("Initial property values for ShmSinkBintr '" << name << "'");
+        LOG_INFO("  shm-name           : " << shmName);
+        LOG_INFO("  data-type          : " << m_shmDataType);
+        LOG_INFO("  num-slots          : " << numSlots);
+        LOG_INFO("  buffer-out         : ");
+        LOG_INFO("    format           : " << m_bufferOutFormat);
+        LOG_INFO("    width            : " << width);
+        LOG_INFO("    height           : " << height);
+        LOG_INFO("  sync               : " << m_sync);
+        LOG_INFO("  async              : " << m_async);
+        LOG_INFO("  max-lateness       : " << m_maxLateness);
+        LOG_INFO("  qos                : " << m_qos);
+        LOG_INFO("  enable-last-sample : " << m_enableLastSample);
+
+        // override the client data (set to NULL above) to this pointer.
+        m_clientData = this;
+    }
+
+    ShmSinkBintr::~ShmSinkBintr()
+    {
+        LOG_FUNC();
+
+        if (IsLinked())
+        {
+            UnlinkAll();
+        }
+    }
+
+    bool ShmSinkBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("ShmSinkBintr '" << GetName() << "' is already linked");
+            return false;
+        }
+        if (m_shmDataType == DSL_SINK_SHM_DATA_TYPE_FRAMES)
+        {
+            if (!m_pQueue->LinkToSink(m_pTransform) or
+                !m_pTransform->LinkToSink(m_pCapsFilter) or
+                !m_pCapsFilter->LinkToSink(m_pSink))
+            {
+                return false;
+            }
+        }
+        else if (!m_pQueue->LinkToSink(m_pSink))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        return true;
+    }
+
+    void ShmSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("ShmSinkBintr '" << GetName() << "' is not linked");
+            return;
+        }
+        m_pQueue->UnlinkFromSink();
+        if (m_shmDataType == DSL_SINK_SHM_DATA_TYPE_FRAMES)
+        {
+            m_pTransform->UnlinkFromSink();
+            m_pCapsFilter->UnlinkFromSink();
+        }
+        m_isLinked = false;
+    }
+    
+    const char* ShmSinkBintr::GetShmName()
+    {
+        LOG_FUNC();
+        
+        return m_pRingWriter->GetShmName();
+    }
+    
+    void ShmSinkBintr::GetStats(dsl_shm_sink_stats* stats)
+    {
+        LOG_FUNC();
+        
+        m_pRingWriter->GetStats(stats);
+    }
+    
+    void ShmSinkBintr::ClearStats()
+    {
+        LOG_FUNC();
+        
+        m_pRingWriter->ClearStats();
+    }
+
+    uint ShmSinkBintr::HandleNewBuffer(void* buffer)
+    {
+        // don't log function
+        
+        GstBuffer* pBuffer = (GstBuffer*)buffer;
+        
+        dsl_shm_egress_frame* pFrame = m_pRingWriter->BeginFrame();
+        dsl_shm_egress_object* pObjects = m_pRingWriter->GetObjects(pFrame);
+        uint maxObjects = m_pRingWriter->GetMaxObjects();
+        uint numObjects(0);
+        
+        pFrame->timestamp = GST_BUFFER_PTS(pBuffer);
+        pFrame->frame_number = 0;
+        pFrame->source_id = 0;
+        pFrame->data_size = 0;
+
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (pBatchMeta)
+        {
+            for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+                pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+            {
+                NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+                if (pFrameMetaList == pBatchMeta->frame_meta_list)
+                {
+                    pFrame->frame_number = pFrameMeta->frame_num;
+                    pFrame->source_id = pFrameMeta->source_id;
+                }
+                for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                    pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+                {
+                    NvDsObjectMeta* pObjectMeta = 
+                        (NvDsObjectMeta*)(pObjectMetaList->data);
+                        
+                    // count all objects, but only write those that fit.
+                    if (numObjects < maxObjects)
+                    {
+                        dsl_shm_egress_object* pObject = &pObjects[numObjects];
+                        pObject->object_id = pObjectMeta->object_id;
+                        pObject->class_id = pObjectMeta->class_id;
+                        pObject->source_id = pFrameMeta->source_id;
+                        pObject->confidence = pObjectMeta->confidence;
+                        pObject->left = pObjectMeta->rect_params.left;
+                        pObject->top = pObjectMeta->rect_params.top;
+                        pObject->width = pObjectMeta->rect_params.width;
+                        pObject->height = pObjectMeta->rect_params.height;
+                    }
+                    numObjects++;
+                }
+            }
+        }
+        
+        if (m_shmDataType == DSL_SINK_SHM_DATA_TYPE_FRAMES)
+        {
+            void* pData = m_pRingWriter->GetData(pFrame);
+            uint slotSize = m_pRingWriter->GetSlotSize();
+            
+            // Buffers with default strides and offsets are copied directly,
+            // others are repacked plane by plane into the slot's layout.
+            if (!gst_buffer_get_video_meta(pBuffer))
+            {
+                pFrame->data_size = gst_buffer_extract(pBuffer, 0, 
+                    pData, slotSize);
+            }
+            else
+            {
+                GstBuffer* pSlotBuffer = gst_buffer_new_wrapped_full(
+                    (GstMemoryFlags)0, pData, slotSize, 0, slotSize, NULL, NULL);
+                GstVideoFrame srcFrame, dstFrame;
+                
+                if (gst_video_frame_map(&srcFrame, &m_videoInfo, pBuffer, 
+                    GST_MAP_READ))
+                {
+                    if (gst_video_frame_map(&dstFrame, &m_videoInfo, 
+                        pSlotBuffer, GST_MAP_WRITE))
+                    {
+                        if (gst_video_frame_copy(&dstFrame, &srcFrame))
+                        {
+                            pFrame->data_size = slotSize;
+                        }
+                        gst_video_frame_unmap(&dstFrame);
+                    }
+                    gst_video_frame_unmap(&srcFrame);
+                }
+                gst_buffer_unref(pSlotBuffer);
+            }
+            if (!pFrame->data_size)
+            {
+                LOG_ERROR("ShmSinkBintr '" << GetName() 
+                    << "' failed to copy frame to shared-memory ring");
+            }
+        }
+        m_pRingWriter->CommitFrame(pFrame, numObjects);
+        
+        return DSL_FLOW_OK;
+    }
+
+    static uint on_new_shm_buffer_cb(uint data_type,
+        void* data, void* client_data)
+    {
+        return static_cast<ShmSinkBintr*>(client_data)->
+            HandleNewBuffer(data);
+    }
+
+    //-------------------------------------------------------------------------
+
+    static_assert(DSL_META_EXPORT_MISC_INFO_SIZE == MAX_USER_FIELDS,
+        "Metadata export misc-info size does not match MAX_USER_FIELDS");
+
+    MetaExportSinkBintr::MetaExportSinkBintr(const char* name, uint transport, 
+        const char* location, uint compressionLevel, uint queueSize)
+        : AppSinkBintr(name, DSL_SINK_APP_DATA_TYPE_BUFFER,
+            on_new_meta_export_buffer_cb, NULL)
+        , m_lastRecordSize(0)
+    {
+        LOG_FUNC();
+        
+        // Opens the file now so that a bad path fails on create. 
+        // Throws on failure.
+        m_pMetaExportWriter = DSL_META_EXPORT_WRITER_NEW(name, transport, 
+            location, compressionLevel, queueSize);
+
+        LOG_INFO("");
+        LOG_INFO("Initial property values for MetaExportSinkBintr '" << name << "'");
+        LOG_INFO("  transport          : " << transport);
+        LOG_INFO("  location           : " << location);
+        LOG_INFO("  compression-level  : " << compressionLevel);
+        LOG_INFO("  queue-size         : " << queueSize);
+        LOG_INFO("  sync               : " << m_sync);
+        LOG_INFO("  async              : " << m_async);
+        LOG_INFO("  max-lateness       : " << m_maxLateness);
+        LOG_INFO("  qos                : " << m_qos);
+        LOG_INFO("  enable-last-sample : " << m_enableLastSample);
+
+        // override the client data (set to NULL above) to this pointer.
+        m_clientData = this;
+    }
+
+    MetaExportSinkBintr::~MetaExportSinkBintr()
+    {
+        LOG_FUNC();
+    }
+    
+    void MetaExportSinkBintr::GetStats(dsl_meta_export_sink_stats* stats)
+    {
+        LOG_FUNC();
+        
+        m_pMetaExportWriter->GetStats(stats);
+    }
+    
+    void MetaExportSinkBintr::ClearStats()
+    {
+        LOG_FUNC();
+        
+        m_pMetaExportWriter->ClearStats();
+    }
+
+    size_t MetaExportSinkBintr::Append(const void* pData, size_t size)
+    {
+        // don't log function for performance
+
+        size_t offset = m_record.size();
+        m_record.insert(m_record.end(), (const uint8_t*)pData, 
+            (const uint8_t*)pData + size);
+        return offset;
+    }
+
+    uint8_t MetaExportSinkBintr::AppendLabel(const char* label)
+    {
+        // don't log function for performance
+
+        uint8_t length = (label) ? strnlen(label, UINT8_MAX) : 0;
+        Append(label, length);
+        return length;
+    }
+
+    uint MetaExportSinkBintr::HandleNewBuffer(void* buffer)
+    {
+        // don't log function
+        
+        GstBuffer* pBuffer = (GstBuffer*)buffer;
+        
+        // Counts are patched into each record once the variable length
+        // records that follow it have been appended.
+        m_record.clear();
+        m_record.reserve(m_lastRecordSize);
+        
+        dsl_meta_export_batch batch{0, DSL_META_EXPORT_RECORD_TYPE_BATCH, 0,
+            GST_BUFFER_PTS(pBuffer)};
+        Append(&batch, sizeof(batch));
+
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (pBatchMeta)
+        {
+            for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+                pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+            {
+                NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+                
+                dsl_meta_export_frame frame{0};
+                frame.source_id = pFrameMeta->source_id;
+                frame.batch_id = pFrameMeta->batch_id;
+                frame.frame_num = pFrameMeta->frame_num;
+                frame.ntp_timestamp = pFrameMeta->ntp_timestamp;
+                frame.source_frame_width = pFrameMeta->source_frame_width;
+                frame.source_frame_height = pFrameMeta->source_frame_height;
+                memcpy(frame.misc_frame_info, pFrameMeta->misc_frame_info,
+                    sizeof(frame.misc_frame_info));
+                
+                for (NvDsMetaList* pDisplayMetaList = 
+                    pFrameMeta->display_meta_list; pDisplayMetaList; 
+                    pDisplayMetaList = pDisplayMetaList->next)
+                {
+                    NvDsDisplayMeta* pDisplayMeta = 
+                        (NvDsDisplayMeta*)(pDisplayMetaList->data);
+                    frame.num_display_meta++;
+                    frame.num_rects += pDisplayMeta->num_rects;
+                    frame.num_labels += pDisplayMeta->num_labels;
+                    frame.num_lines += pDisplayMeta->num_lines;
+                    frame.num_arrows += pDisplayMeta->num_arrows;
+                    frame.num_circles += pDisplayMeta->num_circles;
+                }
+                size_t frameOffset = Append(&frame, sizeof(frame));
+                
+                for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                    pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+                {
+                    NvDsObjectMeta* pObjectMeta = 
+                        (NvDsObjectMeta*)(pObjectMetaList->data);
+                        
+                    dsl_meta_export_object object{0};
+                    object.object_id = pObjectMeta->object_id;
+                    object.class_id = pObjectMeta->class_id;
+                    object.unique_component_id = 
+                        pObjectMeta->unique_component_id;
+                    object.confidence = pObjectMeta->confidence;
+                    object.tracker_confidence = pObjectMeta->tracker_confidence;
+                    object.left = pObjectMeta->rect_params.left;
+                    object.top = pObjectMeta->rect_params.top;
+                    object.width = pObjectMeta->rect_params.width;
+                    object.height = pObjectMeta->rect_params.height;
+                    memcpy(object.misc_obj_info, pObjectMeta->misc_obj_info,
+                        sizeof(object.misc_obj_info));
+                    
+                    size_t objectOffset = Append(&object, sizeof(object));
+                    object.label_length = AppendLabel(pObjectMeta->obj_label);
+                    
+                    for (NvDsMetaList* pClassifierMetaList = 
+                        pObjectMeta->classifier_meta_list; pClassifierMetaList; 
+                        pClassifierMetaList = pClassifierMetaList->next)
+                    {
+                        NvDsClassifierMeta* pClassifierMeta = 
+                            (NvDsClassifierMeta*)(pClassifierMetaList->data);
+                            
+                        for (NvDsMetaList* pLabelInfoList = 
+                            pClassifierMeta->label_info_list; pLabelInfoList; 
+                            pLabelInfoList = pLabelInfoList->next)
+                        {
+                            NvDsLabelInfo* pLabelInfo = 
+                                (NvDsLabelInfo*)(pLabelInfoList->data);
+                                
+                            dsl_meta_export_label label{
+                                pClassifierMeta->unique_component_id,
+                                (int32_t)pLabelInfo->result_class_id, 
+                                pLabelInfo->result_prob, 0};
+                                
+                            size_t labelOffset = Append(&label, sizeof(label));
+                            label.label_length = AppendLabel(
+                                (pLabelInfo->pResult_label) 
+                                    ? pLabelInfo->pResult_label
+                                    : pLabelInfo->result_label);
+                            memcpy(&m_record[labelOffset], &label, sizeof(label));
+                            object.num_classifier_labels++;
+                        }
+                    }
+                    memcpy(&m_record[objectOffset], &object, sizeof(object));
+                    frame.num_objects++;
+                }
+                memcpy(&m_record[frameOffset], &frame, sizeof(frame));
+                batch.num_frames++;
+            }
+        }
+        batch.record_size = m_record.size();
+        memcpy(&m_record[0], &batch, sizeof(batch));
+        
+        m_lastRecordSize = m_record.size();
+        
+        // Never blocks - the record is dropped if the queue is full.
+        m_pMetaExportWriter->QueueRecord(m_record);
+        
+        return DSL_FLOW_OK;
+    }
+
+    static uint on_new_meta_export_buffer_cb(uint data_type,
+        void* data, void* client_data)
+    {
+        return static_cast<MetaExportSinkBintr*>(client_data)->
+            HandleNewBuffer(data);
+    }
+
     //-------------------------------------------------------------------------
     FakeSinkBintr::FakeSinkBintr(const char* name)
         : SinkBintr(name)
@@ -1006,7 +1785,8 @@ namespace DSL
                         // calling each one
                         for(auto const& imap: m_xWindowButtonEventHandlers)
                         {
-                            LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
+                            LOCK_CALLBACK_MUTEX_FOR_CURRENT_SCOPE(
+                                &*m_pSharedClientCbMutex);
 
                             imap.first(buttonEvent.button,
                                        buttonEvent.x, buttonEvent.y, imap.second);
@@ -1028,7 +1808,8 @@ namespace DSL
                             // calling each one
                             for(auto const& imap: m_xWindowKeyEventHandlers)
                             {
-                                LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
+                                LOCK_CALLBACK_MUTEX_FOR_CURRENT_SCOPE(
+                                    &*m_pSharedClientCbMutex);
 
                                 imap.first(wstrKeyString.c_str(), imap.second);
                             }
@@ -1045,7 +1826,8 @@ namespace DSL
                             // calling each one
                             for(auto const& imap: m_xWindowDeleteEventHandlers)
                             {
-                                LOCK_MUTEX_FOR_CURRENT_SCOPE(&*m_pSharedClientCbMutex);
+                                LOCK_CALLBACK_MUTEX_FOR_CURRENT_SCOPE(
+                                    &*m_pSharedClientCbMutex);
                                 imap.first(imap.second);
                             }
                         }
@@ -1987,7 +2769,7 @@ namespace DSL
                                      uint codec, uint container, uint bitrate, uint interval,
                                      dsl_record_client_listener_cb clientListener)
         : EncodeSinkBintr(name, codec, bitrate, interval)
-        , RecordMgr(name, outdir, m_gpuId, container, clientListener)
+        , RecordMgr(name, outdir, m_gpuId, container, clientListener, m_pGstObj)
     {
         LOG_FUNC();
 
@@ -31,6 +31,9 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslRecordMgr.h"
 #include "DslSourceMeter.h"
+#include "DslLatencyHistogram.h"
+#include "DslShmRingWriter.h"
+#include "DslMetaExportWriter.h"
 
 namespace DSL
 {
@@ -46,6 +49,20 @@ namespace DSL
     std::shared_ptr<FrameCaptureSinkBintr>( \
         new FrameCaptureSinkBintr(name, pFrameCaptureAction))
 
+#define DSL_SHM_SINK_PTR std::shared_ptr<ShmSinkBintr>
+#define DSL_SHM_SINK_NEW(name, shmName, dataType, bufferOutFormat, \
+    width, height, numSlots) \
+    std::shared_ptr<ShmSinkBintr>( \
+        new ShmSinkBintr(name, shmName, dataType, bufferOutFormat, \
+            width, height, numSlots))
+
+#define DSL_META_EXPORT_SINK_PTR std::shared_ptr<MetaExportSinkBintr>
+#define DSL_META_EXPORT_SINK_NEW(name, transport, location, \
+    compressionLevel, queueSize) \
+    std::shared_ptr<MetaExportSinkBintr>( \
+        new MetaExportSinkBintr(name, transport, location, \
+            compressionLevel, queueSize))
+
 #define DSL_FAKE_SINK_PTR std::shared_ptr<FakeSinkBintr>
 #define DSL_FAKE_SINK_NEW(name) \
     std::shared_ptr<FakeSinkBintr>( \
@@ -305,6 +322,55 @@ namespace DSL
          */
         void SetDataType(uint dataType);
 
+        /**
+         * @brief Gets the current delivery settings in use by this AppSinkBintr.
+         * @param[out] queueSize maximum number of samples queued for delivery.
+         * 0 = synchronous delivery on the streaming thread.
+         * @param[out] policy one of the DSL_SINK_APP_DELIVERY_POLICY constants.
+         * @param[out] batchSize maximum number of buffers per client callback.
+         */
+        void GetDeliverySettings(uint* queueSize, uint* policy, uint* batchSize);
+
+        /**
+         * @brief Sets the delivery settings for this AppSinkBintr to use.
+         * @param[in] queueSize maximum number of samples queued for delivery.
+         * 0 = synchronous delivery on the streaming thread.
+         * @param[in] policy one of the DSL_SINK_APP_DELIVERY_POLICY constants.
+         * @param[in] batchSize maximum number of buffers per client callback.
+         * @return false if the AppSinkBintr is currently linked, true otherwise.
+         */
+        bool SetDeliverySettings(uint queueSize, uint policy, uint batchSize);
+
+        /**
+         * @brief Gets the current delivery stats for this AppSinkBintr.
+         * @param[out] pStats delivery stats structure to fill in.
+         */
+        void GetDeliveryStats(dsl_sink_app_delivery_stats* pStats);
+
+        /**
+         * @brief Clears the delivery stats for this AppSinkBintr.
+         */
+        void ClearDeliveryStats();
+
+        /**
+         * @brief Queues a new sample for the delivery thread applying the 
+         * current policy if the queue is full. The sample is owned by the
+         * AppSinkBintr from this point on. Public to allow unit testing.
+         * @param[in] pSample new sample to queue for delivery.
+         * @return GST_FLOW_OK, or the flow-return of the last delivery if the
+         * client handler has returned DSL_FLOW_EOS or DSL_FLOW_ERROR.
+         */
+        GstFlowReturn QueueSample(GstSample* pSample);
+
+        /**
+         * @brief Delivery thread function to deliver the queued samples to the
+         * client handler until the delivery thread is stopped.
+         * @param[in] session delivery session the thread was started for. 
+         * The thread exits once the session has ended, even if a new session
+         * has since been started.
+         */
+        void HandleDelivery(uint64_t session);
+
     protected:
     
         /**
@@ -315,6 +381,26 @@ namespace DSL
 
     private:
     
+        /**
+         * @brief Calls the client handler and converts its DSL_FLOW return
+         * value to a GstFlowReturn. m_dataHandlerMutex must be held.
+         * @param[in] dataType the type of data to deliver.
+         * @param[in] pData the sample, buffer, or buffer-list to deliver.
+         * @return the GstFlowReturn for the client's DSL_FLOW return value.
+         */
+        GstFlowReturn CallClientHandler(uint dataType, void* pData);
+
+        /**
+         * @brief Starts the delivery thread if asynchronous delivery is enabled.
+         */
+        void StartDelivery();
+
+        /**
+         * @brief Stops the delivery thread, if running, and unrefs all 
+         * samples that remain queued.
+         */
+        void StopDelivery();
+
         /**
          * @brief either DSL_SINK_APP_DATA_TYPE_SAMPLE or
          * DSL_SINK_APP_DATA_TYPE_BUFFER
@@ -331,7 +417,81 @@ namespace DSL
          * buffer available.
          */
         dsl_sink_app_new_data_handler_cb m_clientHandler;
+
+        /**
+         * @brief maximum number of samples queued for the delivery thread.
+         * 0 = synchronous delivery on the streaming thread.
+         */
+        uint m_deliveryQueueSize;
+
+        /**
+         * @brief one of the DSL_SINK_APP_DELIVERY_POLICY constants.
+         */
+        uint m_deliveryPolicy;
+
+        /**
+         * @brief maximum number of buffers delivered per client callback.
+         */
+        uint m_deliveryBatchSize;
+
+        /**
+         * @brief mutex to protect the delivery queue and stats.
+         */
+        DslMutex m_deliveryMutex;
+
+        /**
+         * @brief condition to signal the delivery thread of a new sample,
+         * or to stop.
+         */
+        DslCond m_deliveryCond;
+
+        /**
+         * @brief condition to signal a blocked streaming thread that there
+         * is space in the delivery queue.
+         */
+        DslCond m_deliverySpaceCond;
+
+        /**
+         * @brief queue of samples, with their receive time in cycles, 
+         * waiting to be delivered.
+         */
+        std::deque<std::pair<GstSample*, uint64_t>> m_deliveryQueue;
+
+        /**
+         * @brief delivery thread, NULL when not running.
+         */
+        GThread* m_pDeliveryThread;
+
+        /**
+         * @brief set to true to refuse new samples while stopped.
+         */
+        bool m_stopDelivery;
         
+        /**
+         * @brief current delivery session, incremented on each stop.
+         */
+        uint64_t m_deliverySession;
+        
+        /**
+         * @brief delivery thread stopped from within its own client handler,
+         * joined on the next start or on destruction. NULL if none.
+         */
+        GThread* m_pStoppedDeliveryThread;
+
+        /**
+         * @brief flow-return of the last delivery returned to the streaming
+         * thread once the client handler returns DSL_FLOW_EOS or DSL_FLOW_ERROR.
+         */
+        GstFlowReturn m_deliveryFlowReturn;
+
+        /**
+         * @brief delivery stats, updated in asynchronous delivery mode only.
+         */
+        uint m_peakDeliveryQueueDepth;
+        uint64_t m_samplesReceived;
+        uint64_t m_samplesDelivered;
+        uint64_t m_samplesDropped;
+        LatencyHistogram m_deliveryLag;
     };
 
     /**
@@ -345,6 +505,14 @@ namespace DSL
     static GstFlowReturn on_new_sample_cb(GstElement* pSinkElement,
                                           gpointer pAppSinkBintr);
 
+    /**
+     * @brief thread function to run the AppSinkBintr's delivery thread.
+     * @param pSession pointer to a new pair of the AppSinkBintr that started 
+     * the thread and the thread's delivery session, freed by the thread.
+     * @return NULL always.
+     */
+    static gpointer app_sink_delivery_thread(gpointer pSession);
+
     //-------------------------------------------------------------------------
 
     /**
@@ -430,6 +598,209 @@ namespace DSL
 
     //-------------------------------------------------------------------------
 
+    /**
+     * @class ShmSinkBintr
+     * @brief Implements a Shared Memory Sink to write frames and/or object 
+     * metadata to a shared-memory broadcast ring for reader processes.
+     */
+    class ShmSinkBintr : public AppSinkBintr
+    {
+    public:
+        
+        /**
+         * @brief ctor for the ShmSinkBintr. Throws on failure to create
+         * the shared-memory ring.
+         * @param[in] name unique name for the ShmSinkBintr
+         * @param[in] shmName name of the POSIX shared-memory ring to create.
+         * @param[in] dataType either DSL_SINK_SHM_DATA_TYPE_METADATA or
+         * DSL_SINK_SHM_DATA_TYPE_FRAMES.
+         * @param[in] bufferOutFormat video format to write frames in.
+         * @param[in] width width to scale the frames to in pixels.
+         * @param[in] height height to scale the frames to in pixels.
+         * @param[in] numSlots number of slots in the ring.
+         */
+        ShmSinkBintr(const char* name, const char* shmName, uint dataType,
+            const char* bufferOutFormat, uint width, uint height, uint numSlots);
+
+        /**
+         * @brief dtor for the ShmSinkBintr
+         */
+        ~ShmSinkBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief Gets the name of the shared-memory ring.
+         * @return name of the ring.
+         */
+        const char* GetShmName();
+        
+        /**
+         * @brief Gets the current stats for the shared-memory ring.
+         * @param[out] stats current stats.
+         */
+        void GetStats(dsl_shm_sink_stats* stats);
+        
+        /**
+         * @brief Clears the current stats for the shared-memory ring.
+         */
+        void ClearStats();
+
+        /**
+         * @brief Function to handle each new buffer provided by the AppSinkBintr.
+         * Writes the buffer's object metadata, and its frame for 
+         * DSL_SINK_SHM_DATA_TYPE_FRAMES, to the next slot in the ring.
+         * @param[in] buffer new buffer to write.
+         * @return DSL_FLOW_OK always.
+         */
+        uint HandleNewBuffer(void* buffer);
+
+    private:
+    
+        /**
+         * @brief either DSL_SINK_SHM_DATA_TYPE_METADATA or 
+         * DSL_SINK_SHM_DATA_TYPE_FRAMES.
+         */
+        uint m_shmDataType;
+        
+        /**
+         * @brief video format to write frames in.
+         */
+        std::string m_bufferOutFormat;
+        
+        /**
+         * @brief video info for the frames written to the ring.
+         */
+        GstVideoInfo m_videoInfo;
+
+        /**
+         * @brief Video converter to scale and convert frames to system memory
+         * for DSL_SINK_SHM_DATA_TYPE_FRAMES.
+         */
+        DSL_ELEMENT_PTR m_pTransform;
+
+        /**
+         * @brief Caps filter for the Video converter.
+         */
+        DSL_ELEMENT_PTR m_pCapsFilter;
+        
+        /**
+         * @brief Shared-memory ring writer for this ShmSinkBintr.
+         */
+        DSL_SHM_RING_WRITER_PTR m_pRingWriter;
+    };
+
+    /**
+     * @brief callback function registered with with the base AppSinkBintr.
+     * The callback wraps the ShmSinkBintr's HandleNewBuffer function.
+     * @param[in] buffer new GstBuffer with metadata to process.
+     * @param[in] client_data this pointer to the ShmSinkBintr instance.
+     * @return DSL_FLOW_OK always.
+     */
+    static uint on_new_shm_buffer_cb(uint data_type,
+        void* buffer, void* client_data);
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class MetaExportSinkBintr
+     * @brief Implements a Metadata Export Sink to serialize the batch metadata 
+     * of each buffer into a binary record (DslMetaExportFormat.h) and queue
+     * it for a MetaExportWriter to write to a file or socket.
+     */
+    class MetaExportSinkBintr : public AppSinkBintr
+    {
+    public:
+        
+        /**
+         * @brief ctor for the MetaExportSinkBintr
+         * @param[in] name unique name for the MetaExportSinkBintr
+         * @param[in] transport one of the DSL_SINK_META_EXPORT_TRANSPORT values.
+         * @param[in] location file path, socket path, or "host:port".
+         * @param[in] compressionLevel zstd compression level, 0 to disable.
+         * @param[in] queueSize maximum number of records to queue.
+         */
+        MetaExportSinkBintr(const char* name, uint transport, 
+            const char* location, uint compressionLevel, uint queueSize);
+
+        /**
+         * @brief dtor for the MetaExportSinkBintr
+         */
+        ~MetaExportSinkBintr();
+
+        /**
+         * @brief Gets the current stats for the MetaExportSinkBintr.
+         * @param[out] stats current stats.
+         */
+        void GetStats(dsl_meta_export_sink_stats* stats);
+
+        /**
+         * @brief Clears the stats for the MetaExportSinkBintr.
+         */
+        void ClearStats();
+
+        /**
+         * @brief Function to handle each new buffer provided by the AppSinkBintr.
+         * Serializes the buffer's batch metadata and queues the record.
+         * @param[in] buffer new buffer to serialize.
+         * @return DSL_FLOW_OK always.
+         */
+        uint HandleNewBuffer(void* buffer);
+
+    private:
+
+        /**
+         * @brief Appends a fixed-size record to the current record.
+         * @param[in] pData record to append.
+         * @param[in] size size of the record in bytes.
+         * @return offset of the appended record in the current record.
+         */
+        size_t Append(const void* pData, size_t size);
+        
+        /**
+         * @brief Appends a label to the current record, truncated to 255 bytes.
+         * @param[in] label null terminated label to append, may be NULL.
+         * @return length of the appended label.
+         */
+        uint8_t AppendLabel(const char* label);
+
+        /**
+         * @brief record being serialized by HandleNewBuffer.
+         */
+        std::vector<uint8_t> m_record;
+        
+        /**
+         * @brief size of the last record, used to reserve the next.
+         */
+        size_t m_lastRecordSize;
+
+        /**
+         * @brief writer for the records serialized by this MetaExportSinkBintr.
+         */
+        DSL_META_EXPORT_WRITER_PTR m_pMetaExportWriter;
+    };
+
+    /**
+     * @brief callback function registered with with the base AppSinkBintr.
+     * The callback wraps the MetaExportSinkBintr's HandleNewBuffer function.
+     * @param[in] buffer new GstBuffer with metadata to process.
+     * @param[in] client_data this pointer to the MetaExportSinkBintr instance.
+     * @return DSL_FLOW_OK always.
+     */
+    static uint on_new_meta_export_buffer_cb(uint data_type,
+        void* buffer, void* client_data);
+
+    //-------------------------------------------------------------------------
+
     class FakeSinkBintr : public SinkBintr
     {
     public:
@@ -29,6 +29,9 @@ THE SOFTWARE.
 #include "DslSourceBintr.h"
 #include "DslPipelineBintr.h"
 #include "DslSurfaceTransform.h"
+#include "DslDeadlineScheduler.h"
+#include "DslReconnectionCoordinator.h"
+#include "DslCallbackDispatcher.h"
 #include <nvdsgstutils.h>
 #include <gst/app/gstappsrc.h>
 
@@ -144,12 +147,11 @@ namespace DSL
     {
         LOG_FUNC();
         m_pCustomSourceElement = DSL_ELEMENT_NEW(factoryName, elementName);
-        *element = m_pCustomSourceElement.get()->GetGstElement();
-        
+        if (element)
+        {
+            *element = m_pCustomSourceElement.get()->GetGstElement();
+        }
         AddChild(m_pCustomSourceElement);
-        
-        // Source (output) queue is "src" ghost-pad for all SourceBintrs
-        m_pCustomSourceElement->AddGhostPadToParent("src");        
     }
 
     /**
@@ -163,13 +165,32 @@ namespace DSL
     bool CustomSourceBintr::LinkAll()
     {
         LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("CustomSourceBintr '" << GetName() 
+                << "' is already in a linked state");
+            return false;
+        }
+        // The custom source element is the "src" ghost-pad for the Bintr. 
+        // Added on link so that it can be removed and re-added on relink.
+        m_pCustomSourceElement->AddGhostPadToParent("src");
+        m_isLinked = true;
+        
         return true;
     }
 
     void CustomSourceBintr::UnlinkAll()
     {
-        m_pCustomSourceElement->RemoveGhostPadFromParent("src");
         LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("CustomSourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return;
+        }
+        m_pCustomSourceElement->RemoveGhostPadFromParent("src");
         m_isLinked = false;
     }
 
@@ -1022,6 +1043,8 @@ namespace DSL
         , m_enoughDataHandler(NULL)
         , m_clientData(NULL)
         , m_maxBytes(0)
+        , m_bufferPoolSize(0)
+        , m_pBufferPool(NULL)
 // TODO support GST 1.20 properties        
 //        , m_maxBuffers(0)
 //        , m_maxTime(0)
@@ -1108,6 +1131,12 @@ namespace DSL
     AppSourceBintr::~AppSourceBintr()
     {
         LOG_FUNC();
+        
+        if (m_pBufferPool)
+        {
+            gst_buffer_pool_set_active(m_pBufferPool, FALSE);
+            gst_object_unref(m_pBufferPool);
+        }
     }
     
     bool AppSourceBintr::LinkAll()
@@ -1121,6 +1150,47 @@ namespace DSL
             return false;
         }
         
+        if (m_bufferPoolSize)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_bufferPoolMutex);
+
+            // Size the pool buffers from the current caps so that each buffer
+            // holds exactly one frame in the buffer-in-format.
+            GstCaps* pCaps = gst_app_src_get_caps(
+                (GstAppSrc*)m_pSourceElement->GetGObject());
+            GstVideoInfo videoInfo;
+            
+            if (!pCaps or !gst_video_info_from_caps(&videoInfo, pCaps))
+            {
+                LOG_ERROR("AppSourceBintr '" << GetName() 
+                    << "' failed to get video-info for its buffer-pool");
+                if (pCaps)
+                {
+                    gst_caps_unref(pCaps);
+                }
+                return false;
+            }
+            m_pBufferPool = gst_buffer_pool_new();
+            
+            GstStructure* pConfig = gst_buffer_pool_get_config(m_pBufferPool);
+            gst_buffer_pool_config_set_params(pConfig, pCaps, 
+                GST_VIDEO_INFO_SIZE(&videoInfo), m_bufferPoolSize, m_bufferPoolSize);
+            gst_caps_unref(pCaps);
+            
+            if (!gst_buffer_pool_set_config(m_pBufferPool, pConfig) or
+                !gst_buffer_pool_set_active(m_pBufferPool, TRUE))
+            {
+                LOG_ERROR("AppSourceBintr '" << GetName() 
+                    << "' failed to activate its buffer-pool");
+                gst_object_unref(m_pBufferPool);
+                m_pBufferPool = NULL;
+                return false;
+            }
+            LOG_INFO("AppSourceBintr '" << GetName() 
+                << "' allocated " << m_bufferPoolSize << " pool buffers of "
+                << GST_VIDEO_INFO_SIZE(&videoInfo) << " bytes");
+        }
+        
         if (!LinkToCommon(m_pSourceElement))
         {
             return false;
@@ -1144,6 +1214,23 @@ namespace DSL
         m_pSourceElement->UnlinkFromSink();
         UnlinkCommon();
         m_isLinked = false;
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_bufferPoolMutex);
+        
+        if (m_pBufferPool)
+        {
+            // Buffers still held by the client can no longer be pushed.
+            for (auto& imap: m_mappedPoolBuffers)
+            {
+                gst_buffer_unmap(imap.first, &imap.second);
+            }
+            m_mappedPoolBuffers.clear();
+            
+            // Buffers still in the Pipeline are freed as they are released.
+            gst_buffer_pool_set_active(m_pBufferPool, FALSE);
+            gst_object_unref(m_pBufferPool);
+            m_pBufferPool = NULL;
+        }
     }
 
     bool AppSourceBintr::AddDataHandlers(
@@ -1193,6 +1280,7 @@ namespace DSL
                 << "' is not in a linked state");
             return false;
         }
+        UnmapPoolBuffer((GstBuffer*)buffer);
         
         // Push the buffer to the App Source element.
         
@@ -1233,6 +1321,194 @@ namespace DSL
         return true;
     }
 
+    bool AppSourceBintr::PushBuffers(void** buffers, uint numBuffers)
+    {
+        // Do not log function entry/exit for performance
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return false;
+        }
+        if (!numBuffers or std::find(buffers, buffers+numBuffers, nullptr) 
+            != buffers+numBuffers)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' received an empty or invalid batch of buffers");
+            return false;
+        }
+        GstBufferList* pBufferList = gst_buffer_list_new_sized(numBuffers);
+        
+        for (uint i = 0; i < numBuffers; i++)
+        {
+            UnmapPoolBuffer((GstBuffer*)buffers[i]);
+            gst_buffer_list_add(pBufferList, (GstBuffer*)buffers[i]);
+        }
+        return PushBufferList(pBufferList);
+    }
+
+    bool AppSourceBintr::PushWrappedBuffers(
+        const dsl_source_app_wrapped_buffer* buffers, uint numBuffers, 
+        dsl_source_app_buffer_release_cb releaseCb)
+    {
+        // Do not log function entry/exit for performance
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return false;
+        }
+        if (!numBuffers)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' received an empty batch of wrapped buffers");
+            return false;
+        }
+        for (uint i = 0; i < numBuffers; i++)
+        {
+            if (!buffers[i].data or !buffers[i].size)
+            {
+                LOG_ERROR("AppSourceBintr '" << GetName() 
+                    << "' received an invalid wrapped buffer at index " << i);
+                return false;
+            }
+        }
+        GstBufferList* pBufferList = gst_buffer_list_new_sized(numBuffers);
+        
+        for (uint i = 0; i < numBuffers; i++)
+        {
+            // The client's memory is wrapped, not copied, and the client is
+            // notified through the destroy-notify once the memory is released.
+            AppSourceWrappedRelease* pRelease = new AppSourceWrappedRelease{
+                releaseCb, buffers[i].data, buffers[i].client_data};
+                
+            gst_buffer_list_add(pBufferList, 
+                gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, 
+                    buffers[i].data, buffers[i].size, 0, buffers[i].size, 
+                    pRelease, on_wrapped_buffer_release_cb));
+        }
+        return PushBufferList(pBufferList);
+    }
+    
+    bool AppSourceBintr::PushBufferList(GstBufferList* pBufferList)
+    {
+        GstAppSrc* pAppSrc = (GstAppSrc*)m_pSourceElement->GetGObject();
+        GstFlowReturn retVal(GST_FLOW_OK);
+        
+        // When timestamping is done by the appsrc, the buffers are queued one 
+        // at a time so that each is stamped with its own running-time. 
+        // Otherwise, the batch is queued with a single push.
+        if (m_doTimestamp)
+        {
+            uint length = gst_buffer_list_length(pBufferList);
+            
+            for (uint i = 0; i < length and retVal == GST_FLOW_OK; i++)
+            {
+                retVal = gst_app_src_push_buffer(pAppSrc, 
+                    gst_buffer_ref(gst_buffer_list_get(pBufferList, i)));
+            }
+            gst_buffer_list_unref(pBufferList);
+        }
+        else
+        {
+            retVal = gst_app_src_push_buffer_list(pAppSrc, pBufferList);
+        }
+        if (retVal != GST_FLOW_OK)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' returned " << retVal << " on push-buffer-list");
+            return false;
+        }
+        return true;
+    }
+
+    uint AppSourceBintr::GetBufferPoolSize()
+    {
+        LOG_FUNC();
+        
+        return m_bufferPoolSize;
+    }
+    
+    bool AppSourceBintr::SetBufferPoolSize(uint size)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set buffer-pool-size for AppSourceBintr '" 
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+        m_bufferPoolSize = size;
+        
+        return true;
+    }
+    
+    bool AppSourceBintr::AcquireBuffer(void** buffer, void** data, uint64_t* size)
+    {
+        // Do not log function entry/exit for performance
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_bufferPoolMutex);
+        
+        if (!m_pBufferPool)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' does not have an active buffer-pool");
+            return false;
+        }
+        
+        // Never block the caller - the Services mutex is held for the call.
+        GstBufferPoolAcquireParams params = {};
+        params.flags = GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT;
+        
+        GstBuffer* pBuffer(NULL);
+        GstFlowReturn retVal = gst_buffer_pool_acquire_buffer(m_pBufferPool, 
+            &pBuffer, &params);
+            
+        if (retVal == GST_FLOW_EOS)
+        {
+            // all buffers are currently in use
+            *buffer = NULL;
+            *data = NULL;
+            *size = 0;
+            return true;
+        }
+        if (retVal != GST_FLOW_OK)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' returned " << retVal << " on buffer-pool acquire");
+            return false;
+        }
+        GstMapInfo mapInfo;
+        if (!gst_buffer_map(pBuffer, &mapInfo, GST_MAP_WRITE))
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' failed to map buffer-pool buffer");
+            gst_buffer_unref(pBuffer);
+            return false;
+        }
+        m_mappedPoolBuffers[pBuffer] = mapInfo;
+        
+        *buffer = pBuffer;
+        *data = mapInfo.data;
+        *size = mapInfo.size;
+        
+        return true;
+    }
+    
+    void AppSourceBintr::UnmapPoolBuffer(GstBuffer* pBuffer)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_bufferPoolMutex);
+        
+        auto ipos = m_mappedPoolBuffers.find(pBuffer);
+        if (ipos != m_mappedPoolBuffers.end())
+        {
+            gst_buffer_unmap(pBuffer, &ipos->second);
+            m_mappedPoolBuffers.erase(ipos);
+        }
+    }
+
     bool AppSourceBintr::Eos()
     {
         LOG_FUNC();
@@ -1295,176 +1571,857 @@ namespace DSL
         }
     }
 
-    bool AppSourceBintr::SetDimensions(uint width, uint height)
+    bool AppSourceBintr::SetDimensions(uint width, uint height)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set dimensions for AppSourceBintr '" 
+
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+        
+        m_width = width;
+        m_height = height;
+
+        // Set the full capabilities (format, dimensions, and framerate)
+        // NVIDIA plugin = false... this is a GStreamer plugin
+        if (!set_full_caps(m_pSourceElement, m_mediaType.c_str(), 
+            m_bufferInFormat.c_str(), m_width, m_height, m_fpsN, m_fpsD, false))
+        {
+            return false;
+        }
+        return true;
+    }
+
+    boolean AppSourceBintr::GetDoTimestamp()
+    {
+        LOG_FUNC();
+        
+        return m_doTimestamp;
+    }
+
+    bool AppSourceBintr::SetDoTimestamp(boolean doTimestamp)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set block-enabled for AppSourceBintr '" 
+
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+
+        m_doTimestamp = doTimestamp;
+        m_pSourceElement->SetAttribute("do-timestamp", m_doTimestamp);
+        return true;
+    }
+
+
+    boolean AppSourceBintr::GetBlockEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_blockEnabled;
+    }
+    
+    bool AppSourceBintr::SetBlockEnabled(boolean enabled)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set block-enabled for AppSourceBintr '" 
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+
+        m_blockEnabled = enabled;
+        m_pSourceElement->SetAttribute("block", m_blockEnabled);
+        return true;
+    }
+    
+    uint AppSourceBintr::GetStreamFormat()
+    {
+        LOG_FUNC();
+        
+        return m_streamFormat;
+    }
+    
+    bool AppSourceBintr::SetStreamFormat(uint streamFormat)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set stream-format for AppSourceBintr '" 
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+
+        m_streamFormat = streamFormat;
+        m_pSourceElement->SetAttribute("format", m_streamFormat);
+        return true;
+    }
+    
+    uint64_t AppSourceBintr::GetCurrentLevelBytes()
+    {
+        // do not log function entry/exit for performance reasons
+        
+        uint64_t currentLevel(0);
+        
+        m_pSourceElement->GetAttribute("current-level-bytes", 
+            &currentLevel);
+
+        return currentLevel;
+    }
+    
+    uint64_t AppSourceBintr::GetMaxLevelBytes()
+    {
+        LOG_FUNC();
+
+        m_pSourceElement->GetAttribute("max-bytes", 
+            &m_maxBytes);
+
+        return m_maxBytes;
+    }
+    
+    bool AppSourceBintr::SetMaxLevelBytes(uint64_t level)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set max-level for AppSourceBintr '" 
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+        m_maxBytes = level;
+        m_pSourceElement->SetAttribute("max-bytes", m_maxBytes);
+
+        return true;
+    }
+    
+//    uint AppSourceBintr::GetLeakyType()
+//    {
+//        LOG_FUNC();
+//        
+//        return m_leakyType;
+//    }
+//    
+//    bool AppSourceBintr::SetLeakyType(uint leakyType)
+//    {
+//        LOG_FUNC();
+//
+//        if (m_isLinked)
+//        {
+//            LOG_ERROR("Can't set leaky-type for AppSourceBintr '" 
+//                << GetName() << "' as it's currently in a linked state");
+//            return false;
+//        }
+//
+//        m_leakyType = leakyType;
+//        m_pSourceElement->SetAttribute("leaky-type", m_leakyType);
+//        return true;
+//    }
+
+
+    static void on_need_data_cb(GstElement* source, uint length,
+        gpointer pAppSrcBintr)
+    {
+        static_cast<AppSourceBintr*>(pAppSrcBintr)->
+            HandleNeedData(length);
+    }
+        
+    static void on_enough_data_cb(GstElement* source, 
+        gpointer pAppSrcBintr)
+    {
+        static_cast<AppSourceBintr*>(pAppSrcBintr)->
+            HandleEnoughData();
+    }
+
+    static void on_wrapped_buffer_release_cb(gpointer pRelease)
+    {
+        AppSourceWrappedRelease* pWrappedRelease = 
+            static_cast<AppSourceWrappedRelease*>(pRelease);
+        try
+        {
+            pWrappedRelease->releaseCb(pWrappedRelease->data, 
+                pWrappedRelease->clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Exception calling Client buffer-release callback");
+        }
+        delete pWrappedRelease;
+    }
+
+    //*********************************************************************************
+
+    ShmSourceBintr::ShmSourceBintr(const char* name, const char* shmName,
+        const char* bufferInFormat, uint width, uint height, 
+        uint fpsN, uint fpsD, uint numSlots)
+        : VideoSourceBintr(name) 
+        , m_bufferInFormat(bufferInFormat)
+        , m_pTimestampCaps(NULL)
+        , m_pReadThread(NULL)
+        , m_stopReading(true)
+    {
+        LOG_FUNC();
+        
+        m_isLive = true;
+        m_width = width;
+        m_height = height;
+        m_fpsN = fpsN;
+        m_fpsD = fpsD;
+        
+        // Each ring slot holds exactly one frame in the buffer-in-format.
+        GstVideoInfo videoInfo;
+        if (!gst_video_info_set_format(&videoInfo, 
+            gst_video_format_from_string(bufferInFormat), width, height))
+        {
+            LOG_ERROR("Invalid buffer-in-format or dimensions for ShmSourceBintr '"
+                << name << "'");
+            throw std::exception();
+        }
+        
+        // ---- Source Element Setup
+
+        m_pSourceElement = DSL_ELEMENT_NEW("appsrc", name);
+
+        // Set the full capabilities (format, dimensions, and framerate)
+        // NVIDIA plugin = false... this is a GStreamer plugin
+        if (!set_full_caps(m_pSourceElement, m_mediaType.c_str(), 
+            m_bufferInFormat.c_str(), m_width, m_height, m_fpsN, m_fpsD, false))
+        {
+            throw std::exception();
+        }
+        m_pSourceElement->SetAttribute("is-live", true);
+        m_pSourceElement->SetAttribute("format", GST_FORMAT_TIME);
+        m_pSourceElement->SetAttribute("do-timestamp", true);
+        
+        // The producer's own timestamps are carried as reference-timestamp meta.
+        m_pTimestampCaps = gst_caps_new_empty_simple(
+            "timestamp/x-dsl-shm-producer");
+        
+        // Create the ring now so that producers can attach before the 
+        // Pipeline is played. Throws on failure.
+        m_pRingReader = DSL_SHM_RING_READER_NEW(shmName, bufferInFormat,
+            width, height, fpsN, fpsD, GST_VIDEO_INFO_SIZE(&videoInfo), numSlots);
+
+        LOG_INFO("");
+        LOG_INFO("Initial property values for ShmSourceBintr '" << name << "'");
+        LOG_INFO("  shm-name          : " << shmName);
+        LOG_INFO("  num-slots         : " << numSlots);
+        LOG_INFO("  slot-size         : " << GST_VIDEO_INFO_SIZE(&videoInfo));
+        LOG_INFO("  buffer-in-format  : " << m_bufferInFormat);
+        LOG_INFO("  is-live           : " << m_isLive);
+        LOG_INFO("  width             : " << m_width);
+        LOG_INFO("  height            : " << m_height);
+        LOG_INFO("  fps-n             : " << m_fpsN);
+        LOG_INFO("  fps-d             : " << m_fpsD);
+        LOG_INFO("  media-out         : " << m_mediaType << "(memory:NVMM)");
+        LOG_INFO("  buffer-out        : ");
+        LOG_INFO("    format          : " << m_bufferOutFormat);
+        LOG_INFO("    width           : " << m_bufferOutWidth);
+        LOG_INFO("    height          : " << m_bufferOutHeight);
+        LOG_INFO("    fps-n           : " << m_bufferOutFpsN);
+        LOG_INFO("    fps-d           : " << m_bufferOutFpsD);
+        LOG_INFO("    crop-pre-conv   : 0:0:0:0" );
+        LOG_INFO("    crop-post-conv  : 0:0:0:0" );
+        LOG_INFO("    orientation     : " << m_bufferOutOrientation);
+
+        // add all elementrs as childer to this Bintr
+        AddChild(m_pSourceElement);
+    }
+
+    ShmSourceBintr::~ShmSourceBintr()
+    {
+        LOG_FUNC();
+        
+        // the read-thread holds a pointer to this Bintr and must be stopped.
+        if (m_pReadThread)
+        {
+            m_stopReading = true;
+            m_pRingReader->Wake();
+            g_thread_join(m_pReadThread);
+        }
+        if (m_pTimestampCaps)
+        {
+            gst_caps_unref(m_pTimestampCaps);
+        }
+    }
+    
+    bool ShmSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("ShmSourceBintr '" << GetName() 
+                << "' is already in a linked state");
+            return false;
+        }
+        if (!LinkToCommon(m_pSourceElement))
+        {
+            return false;
+        }
+        
+        // Frames committed while the Source was stopped are stale.
+        m_pRingReader->Reset();
+        
+        m_stopReading = false;
+        m_pReadThread = g_thread_new("dsl-shm-source", 
+            shm_source_read_thread, this);
+        
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void ShmSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("ShmSourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return;
+        }
+        m_stopReading = true;
+        m_pRingReader->Wake();
+        g_thread_join(m_pReadThread);
+        m_pReadThread = NULL;
+        
+        m_pSourceElement->UnlinkFromSink();
+        UnlinkCommon();
+        m_isLinked = false;
+    }
+    
+    const char* ShmSourceBintr::GetShmName()
+    {
+        LOG_FUNC();
+        
+        return m_pRingReader->GetShmName();
+    }
+    
+    void ShmSourceBintr::GetStats(dsl_shm_source_stats* stats)
+    {
+        LOG_FUNC();
+        
+        m_pRingReader->GetStats(stats);
+    }
+    
+    void ShmSourceBintr::ClearStats()
+    {
+        LOG_FUNC();
+        
+        m_pRingReader->ClearStats();
+    }
+    
+    void ShmSourceBintr::HandleRead()
+    {
+        LOG_FUNC();
+        
+        GstAppSrc* pAppSrc = (GstAppSrc*)m_pSourceElement->GetGObject();
+        uint64_t seq(0), size(0), timestamp(0);
+        void* data(NULL);
+        
+        while (!m_stopReading)
+        {
+            if (!m_pRingReader->WaitForFrame(100, 
+                &seq, &data, &size, &timestamp))
+            {
+                continue;
+            }
+            
+            // The frame is wrapped in place; its slot is released back to 
+            // the producer once the Pipeline has released the buffer.
+            ShmSourceFrameRelease* pRelease = new ShmSourceFrameRelease{this, seq};
+            
+            GstBuffer* pBuffer = gst_buffer_new_wrapped_full(
+                GST_MEMORY_FLAG_READONLY, data, size, 0, size, 
+                pRelease, on_shm_frame_release_cb);
+                
+            if (timestamp != DSL_SHM_RING_TIMESTAMP_NONE)
+            {
+                gst_buffer_add_reference_timestamp_meta(pBuffer, 
+                    m_pTimestampCaps, timestamp, GST_CLOCK_TIME_NONE);
+            }
+            GstFlowReturn retVal = gst_app_src_push_buffer(pAppSrc, pBuffer);
+            if (retVal != GST_FLOW_OK and retVal != GST_FLOW_FLUSHING)
+            {
+                LOG_WARN("ShmSourceBintr '" << GetName() 
+                    << "' returned " << retVal << " on push-buffer");
+            }
+        }
+    }
+    
+    void ShmSourceBintr::ReleaseFrame(uint64_t seq)
+    {
+        // Do not log function entry/exit for performance
+        
+        m_pRingReader->ReleaseFrame(seq);
+    }
+    
+    static gpointer shm_source_read_thread(gpointer pShmSourceBintr)
+    {
+        static_cast<ShmSourceBintr*>(pShmSourceBintr)->HandleRead();
+        return NULL;
+    }
+    
+    static void on_shm_frame_release_cb(gpointer pRelease)
+    {
+        ShmSourceFrameRelease* pFrameRelease = 
+            static_cast<ShmSourceFrameRelease*>(pRelease);
+            
+        pFrameRelease->pSource->ReleaseFrame(pFrameRelease->seq);
+        delete pFrameRelease;
+    }
+        
+    //*********************************************************************************
+
+    MetaReplaySourceBintr::MetaReplaySourceBintr(const char* name, 
+        const char* filePath, double speed, uint surfaceType, 
+        uint width, uint height)
+        : CustomSourceBintr(name, name, "appsrc")
+        , m_filePath(filePath)
+        , m_speed(speed)
+        , m_surfaceType(surfaceType)
+        , m_width(width)
+        , m_height(height)
+        , m_pSurfaceMemory(NULL)
+        , m_pReplayThread(NULL)
+        , m_stopReplay(true)
+        , m_needData(false)
+        , m_batchesReplayed(0)
+        , m_framesReplayed(0)
+        , m_objectsReplayed(0)
+        , m_lateBatches(0)
+        , m_recordsSkipped(0)
+        , m_bytesRead(0)
+    {
+        LOG_FUNC();
+        
+        // Recorded streams are replayed from file, never live.
+        m_isLive = false;
+        
+        // Opens the stream and validates its header now so that a bad 
+        // file fails on create. Throws on failure.
+        m_pMetaExportReader = DSL_META_EXPORT_READER_NEW(name, filePath);
+        
+        m_pCustomSourceElement->SetAttribute("is-live", false);
+        m_pCustomSourceElement->SetAttribute("format", GST_FORMAT_TIME);
+        
+        // Block the replay thread, rather than queue without bound, when 
+        // replaying faster than the Pipeline can process.
+        m_pCustomSourceElement->SetAttribute("block", true);
+#if GST_CHECK_VERSION(1,20,0)
+        m_pCustomSourceElement->SetAttribute("max-buffers", 
+            (uint64_t)DSL_META_REPLAY_MAX_QUEUED_BUFFERS);
+#endif
+
+        if (m_surfaceType != DSL_SOURCE_META_REPLAY_SURFACE_NONE)
+        {
+            // Variable framerate - buffers are paced by the recorded timestamps.
+            if (!set_full_caps(m_pCustomSourceElement, "video/x-raw", "RGBA",
+                m_width, m_height, 0, 1, false))
+            {
+                throw std::exception();
+            }
+            gsize size = (gsize)m_width*m_height*4;
+            m_pCustomSourceElement->SetAttribute("max-bytes", 
+                (uint64_t)size*DSL_META_REPLAY_MAX_QUEUED_BUFFERS);
+            
+            // The surface is generated once and shared, read-only, by 
+            // every buffer pushed.
+            m_pSurfaceMemory = gst_allocator_alloc(NULL, size, NULL);
+            GstMapInfo info;
+            if (!m_pSurfaceMemory or 
+                !gst_memory_map(m_pSurfaceMemory, &info, GST_MAP_WRITE))
+            {
+                LOG_ERROR("Failed to allocate surface for MetaReplaySourceBintr '"
+                    << name << "'");
+                throw std::exception();
+            }
+            // 75% color bars - white, yellow, cyan, green, magenta, red, 
+            // blue and black - or opaque black for a blank surface.
+            static const uint8_t colorBars[8][4] = {
+                {191,191,191,255}, {191,191,0,255}, {0,191,191,255}, 
+                {0,191,0,255}, {191,0,191,255}, {191,0,0,255}, 
+                {0,0,191,255}, {0,0,0,255}};
+                
+            for (uint x = 0; x < m_width; x++)
+            {
+                const uint8_t* pColor = 
+                    (m_surfaceType == DSL_SOURCE_META_REPLAY_SURFACE_BLANK)
+                    ? colorBars[7] : colorBars[x*8/m_width];
+                memcpy(info.data + x*4, pColor, 4);
+            }
+            for (uint y = 1; y < m_height; y++)
+            {
+                memcpy(info.data + (gsize)y*m_width*4, info.data, m_width*4);
+            }
+            gst_memory_unmap(m_pSurfaceMemory, &info);
+        }
+        
+        g_signal_connect(m_pCustomSourceElement->GetGObject(), "need-data", 
+            G_CALLBACK(on_meta_replay_need_data_cb), this);
+        
+        LOG_INFO("");
+        LOG_INFO("Initial property values for MetaReplaySourceBintr '" 
+            << name << "'");
+        LOG_INFO("  file-path         : " << m_filePath);
+        LOG_INFO("  speed             : " << m_speed);
+        LOG_INFO("  surface-type      : " << m_surfaceType);
+        LOG_INFO("  width             : " << m_width);
+        LOG_INFO("  height            : " << m_height);
+        LOG_INFO("  is-live           : " << m_isLive);
+    }
+
+    MetaReplaySourceBintr::~MetaReplaySourceBintr()
     {
         LOG_FUNC();
-
-        if (m_isLinked)
+        
+        // the replay-thread holds a pointer to this Bintr and must be stopped.
+        if (m_pReplayThread)
         {
-            LOG_ERROR("Can't set dimensions for AppSourceBintr '" 
-
-                << GetName() << "' as it's currently in a linked state");
-            return false;
+            g_mutex_lock(&m_replayMutex);
+            m_stopReplay.store(true, std::memory_order_release);
+            g_cond_signal(&m_replayCond);
+            g_mutex_unlock(&m_replayMutex);
+            
+            g_thread_join(m_pReplayThread);
         }
-        
-        m_width = width;
-        m_height = height;
-
-        // Set the full capabilities (format, dimensions, and framerate)
-        // NVIDIA plugin = false... this is a GStreamer plugin
-        if (!set_full_caps(m_pSourceElement, m_mediaType.c_str(), 
-            m_bufferInFormat.c_str(), m_width, m_height, m_fpsN, m_fpsD, false))
+        if (m_pSurfaceMemory)
         {
-            return false;
+            gst_memory_unref(m_pSurfaceMemory);
         }
-        return true;
-    }
-
-    boolean AppSourceBintr::GetDoTimestamp()
-    {
-        LOG_FUNC();
-        
-        return m_doTimestamp;
     }
-
-    bool AppSourceBintr::SetDoTimestamp(boolean doTimestamp)
+    
+    bool MetaReplaySourceBintr::LinkAll()
     {
         LOG_FUNC();
 
-        if (m_isLinked)
+        if (!CustomSourceBintr::LinkAll())
         {
-            LOG_ERROR("Can't set block-enabled for AppSourceBintr '" 
-
-                << GetName() << "' as it's currently in a linked state");
             return false;
         }
-
-        m_doTimestamp = doTimestamp;
-        m_pSourceElement->SetAttribute("do-timestamp", m_doTimestamp);
+        // Each play of the Pipeline replays the stream from the start.
+        if (!m_pMetaExportReader->Rewind())
+        {
+            CustomSourceBintr::UnlinkAll();
+            return false;
+        }
+        m_needData = false;
+        m_stopReplay.store(false, std::memory_order_release);
+        m_pReplayThread = g_thread_new("dsl-meta-replay", 
+            meta_replay_source_thread, this);
+        
         return true;
     }
 
-
-    boolean AppSourceBintr::GetBlockEnabled()
+    void MetaReplaySourceBintr::UnlinkAll()
     {
         LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("MetaReplaySourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return;
+        }
+        g_mutex_lock(&m_replayMutex);
+        m_stopReplay.store(true, std::memory_order_release);
+        g_cond_signal(&m_replayCond);
+        g_mutex_unlock(&m_replayMutex);
         
-        return m_blockEnabled;
+        g_thread_join(m_pReplayThread);
+        m_pReplayThread = NULL;
+        
+        CustomSourceBintr::UnlinkAll();
     }
     
-    bool AppSourceBintr::SetBlockEnabled(boolean enabled)
+    void MetaReplaySourceBintr::GetStats(dsl_meta_replay_source_stats* stats)
     {
         LOG_FUNC();
-
-        if (m_isLinked)
-        {
-            LOG_ERROR("Can't set block-enabled for AppSourceBintr '" 
-                << GetName() << "' as it's currently in a linked state");
-            return false;
-        }
-
-        m_blockEnabled = enabled;
-        m_pSourceElement->SetAttribute("block", m_blockEnabled);
-        return true;
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_replayMutex);
+        
+        stats->batches_replayed = m_batchesReplayed;
+        stats->frames_replayed = m_framesReplayed;
+        stats->objects_replayed = m_objectsReplayed;
+        stats->late_batches = m_lateBatches;
+        stats->records_skipped = m_recordsSkipped;
+        stats->bytes_read = m_bytesRead;
     }
     
-    uint AppSourceBintr::GetStreamFormat()
+    void MetaReplaySourceBintr::ClearStats()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_replayMutex);
         
-        return m_streamFormat;
+        m_batchesReplayed = 0;
+        m_framesReplayed = 0;
+        m_objectsReplayed = 0;
+        m_lateBatches = 0;
+        m_recordsSkipped = 0;
+        m_bytesRead = 0;
     }
     
-    bool AppSourceBintr::SetStreamFormat(uint streamFormat)
+    void MetaReplaySourceBintr::HandleNeedData()
     {
-        LOG_FUNC();
-
-        if (m_isLinked)
+        // don't log function for performance
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_replayMutex);
+        
+        if (!m_needData)
         {
-            LOG_ERROR("Can't set stream-format for AppSourceBintr '" 
-                << GetName() << "' as it's currently in a linked state");
-            return false;
+            m_needData = true;
+            g_cond_signal(&m_replayCond);
         }
-
-        m_streamFormat = streamFormat;
-        m_pSourceElement->SetAttribute("format", m_streamFormat);
-        return true;
     }
     
-    uint64_t AppSourceBintr::GetCurrentLevelBytes()
+    void MetaReplaySourceBintr::HandleReplay()
     {
-        // do not log function entry/exit for performance reasons
+        LOG_FUNC();
         
-        uint64_t currentLevel(0);
+        GstAppSrc* pAppSrc = (GstAppSrc*)m_pCustomSourceElement->GetGObject();
         
-        m_pSourceElement->GetAttribute("current-level-bytes", 
-            &currentLevel);
-
-        return currentLevel;
+        // Buffers pushed before the appsrc has started are flushed, so wait
+        // for its first request for data.
+        g_mutex_lock(&m_replayMutex);
+        while (!m_needData and !m_stopReplay)
+        {
+            g_cond_wait(&m_replayCond, &m_replayMutex);
+        }
+        g_mutex_unlock(&m_replayMutex);
+        
+        gint64 startTime = g_get_monotonic_time();
+        gint64 baseTime(startTime);
+        uint64_t basePts(GST_CLOCK_TIME_NONE);
+        uint64_t lastBytesRead(m_pMetaExportReader->GetBytesRead());
+        uint64_t lastRecordsSkipped(m_pMetaExportReader->GetRecordsSkipped());
+        
+        while (!m_stopReplay.load(std::memory_order_acquire))
+        {
+            const dsl_meta_export_batch* pRecord = 
+                m_pMetaExportReader->ReadRecord();
+            if (!pRecord)
+            {
+                LOG_INFO("MetaReplaySourceBintr '" << GetName() 
+                    << "' reached the end of stream '" << m_filePath << "'");
+                gst_app_src_end_of_stream(pAppSrc);
+                return;
+            }
+            bool late(false);
+            gint64 targetTime = g_get_monotonic_time();
+            
+            if (m_speed > 0 and pRecord->pts != GST_CLOCK_TIME_NONE)
+            {
+                // Rebase on the first record, and on timestamps that go back
+                // as in a stream recorded across Pipeline restarts.
+                if (basePts == GST_CLOCK_TIME_NONE or pRecord->pts < basePts)
+                {
+                    basePts = pRecord->pts;
+                    baseTime = targetTime;
+                }
+                targetTime = baseTime + 
+                    (gint64)((pRecord->pts - basePts)/(GST_USECOND*m_speed));
+                    
+                late = (g_get_monotonic_time() > 
+                    targetTime + DSL_META_REPLAY_LATE_THRESHOLD_US);
+                if (!WaitUntil(targetTime))
+                {
+                    return;
+                }
+            }
+            uint numObjects(0);
+            GstBuffer* pBuffer = NewBatchBuffer(pRecord, &numObjects);
+            
+            // Buffers replayed at maximum speed are not timestamped so that
+            // synchronized sinks don't throttle the replay.
+            if (m_speed > 0)
+            {
+                GST_BUFFER_PTS(pBuffer) = (targetTime - startTime)*GST_USECOND;
+            }
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_replayMutex);
+                
+                m_batchesReplayed++;
+                m_framesReplayed += pRecord->num_frames;
+                m_objectsReplayed += numObjects;
+                m_lateBatches += late;
+                m_bytesRead += 
+                    m_pMetaExportReader->GetBytesRead() - lastBytesRead;
+                m_recordsSkipped += 
+                    m_pMetaExportReader->GetRecordsSkipped() - lastRecordsSkipped;
+            }
+            lastBytesRead = m_pMetaExportReader->GetBytesRead();
+            lastRecordsSkipped = m_pMetaExportReader->GetRecordsSkipped();
+            
+            GstFlowReturn retVal = gst_app_src_push_buffer(pAppSrc, pBuffer);
+            if (retVal != GST_FLOW_OK)
+            {
+                // Flushing once the Pipeline is stopping.
+                if (retVal != GST_FLOW_FLUSHING)
+                {
+                    LOG_WARN("MetaReplaySourceBintr '" << GetName() 
+                        << "' returned " << retVal << " on push-buffer");
+                }
+                return;
+            }
+        }
     }
     
-    uint64_t AppSourceBintr::GetMaxLevelBytes()
+    GstBuffer* MetaReplaySourceBintr::NewBatchBuffer(
+        const dsl_meta_export_batch* pRecord, uint* numObjects)
     {
-        LOG_FUNC();
-
-        m_pSourceElement->GetAttribute("max-bytes", 
-            &m_maxBytes);
-
-        return m_maxBytes;
+        // don't log function for performance
+        
+        GstBuffer* pBuffer = gst_buffer_new();
+        if (m_pSurfaceMemory)
+        {
+            gst_buffer_append_memory(pBuffer, gst_memory_ref(m_pSurfaceMemory));
+        }
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(
+            std::max((uint)pRecord->num_frames, (uint)1));
+        
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        pBatchMeta->base_meta.batch_meta = pBatchMeta;
+        pBatchMeta->base_meta.copy_func = nvds_batch_meta_copy_func;
+        pBatchMeta->base_meta.release_func = nvds_batch_meta_release_func;
+        
+        // The record has been validated by the reader, so it can be walked
+        // without bounds checks.
+        const uint8_t* pBytes = (const uint8_t*)pRecord 
+            + sizeof(dsl_meta_export_batch);
+        
+        for (uint frameNum = 0; frameNum < pRecord->num_frames; frameNum++)
+        {
+            const dsl_meta_export_frame* pFrame = 
+                (const dsl_meta_export_frame*)pBytes;
+            pBytes += sizeof(dsl_meta_export_frame);
+            
+            NvDsFrameMeta* pFrameMeta = 
+                nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = pFrame->source_id;
+            pFrameMeta->pad_index = pFrame->source_id;
+            pFrameMeta->batch_id = pFrame->batch_id;
+            pFrameMeta->frame_num = pFrame->frame_num;
+            pFrameMeta->buf_pts = pRecord->pts;
+            pFrameMeta->ntp_timestamp = pFrame->ntp_timestamp;
+            pFrameMeta->source_frame_width = pFrame->source_frame_width;
+            pFrameMeta->source_frame_height = pFrame->source_frame_height;
+            pFrameMeta->bInferDone = true;
+            memcpy(pFrameMeta->misc_frame_info, pFrame->misc_frame_info,
+                sizeof(pFrameMeta->misc_frame_info));
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+            
+            for (uint objectNum = 0; objectNum < pFrame->num_objects; objectNum++)
+            {
+                const dsl_meta_export_object* pObject = 
+                    (const dsl_meta_export_object*)pBytes;
+                pBytes += sizeof(dsl_meta_export_object);
+                
+                NvDsObjectMeta* pObjectMeta = 
+                    nvds_acquire_obj_meta_from_pool(pBatchMeta);
+                pObjectMeta->object_id = pObject->object_id;
+                pObjectMeta->class_id = pObject->class_id;
+                pObjectMeta->unique_component_id = pObject->unique_component_id;
+                pObjectMeta->confidence = pObject->confidence;
+                pObjectMeta->tracker_confidence = pObject->tracker_confidence;
+                pObjectMeta->rect_params.left = pObject->left;
+                pObjectMeta->rect_params.top = pObject->top;
+                pObjectMeta->rect_params.width = pObject->width;
+                pObjectMeta->rect_params.height = pObject->height;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.left = pObject->left;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.top = pObject->top;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.width = pObject->width;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.height = pObject->height;
+                memcpy(pObjectMeta->misc_obj_info, pObject->misc_obj_info,
+                    sizeof(pObjectMeta->misc_obj_info));
+                    
+                uint labelLength = std::min((uint)pObject->label_length, 
+                    (uint)MAX_LABEL_SIZE-1);
+                memcpy(pObjectMeta->obj_label, pBytes, labelLength);
+                pObjectMeta->obj_label[labelLength] = 0;
+                pBytes += pObject->label_length;
+                
+                nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+                (*numObjects)++;
+                
+                // Consecutive labels from the same classifier are regrouped 
+                // under one classifier meta.
+                NvDsClassifierMeta* pClassifierMeta(NULL);
+                for (uint labelNum = 0; 
+                    labelNum < pObject->num_classifier_labels; labelNum++)
+                {
+                    const dsl_meta_export_label* pLabel = 
+                        (const dsl_meta_export_label*)pBytes;
+                    pBytes += sizeof(dsl_meta_export_label);
+                    
+                    if (!pClassifierMeta or pClassifierMeta->unique_component_id 
+                        != (gint)pLabel->unique_component_id)
+                    {
+                        pClassifierMeta = 
+                            nvds_acquire_classifier_meta_from_pool(pBatchMeta);
+                        pClassifierMeta->unique_component_id = 
+                            pLabel->unique_component_id;
+                        nvds_add_classifier_meta_to_object(pObjectMeta, 
+                            pClassifierMeta);
+                    }
+                    NvDsLabelInfo* pLabelInfo = 
+                        nvds_acquire_label_info_meta_from_pool(pBatchMeta);
+                    pLabelInfo->result_class_id = pLabel->result_class_id;
+                    pLabelInfo->result_prob = pLabel->result_prob;
+                    
+                    labelLength = std::min((uint)pLabel->label_length, 
+                        (uint)MAX_LABEL_SIZE-1);
+                    memcpy(pLabelInfo->result_label, pBytes, labelLength);
+                    pLabelInfo->result_label[labelLength] = 0;
+                    pLabelInfo->pResult_label = NULL;
+                    pBytes += pLabel->label_length;
+                    
+                    nvds_add_label_info_meta_to_classifier(pClassifierMeta, 
+                        pLabelInfo);
+                    pClassifierMeta->num_labels++;
+                }
+            }
+        }
+        return pBuffer;
     }
     
-    bool AppSourceBintr::SetMaxLevelBytes(uint64_t level)
+    bool MetaReplaySourceBintr::WaitUntil(gint64 endTime)
     {
-        LOG_FUNC();
-
-        if (m_isLinked)
+        // don't log function for performance
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_replayMutex);
+        
+        while (!m_stopReplay and g_get_monotonic_time() < endTime)
         {
-            LOG_ERROR("Can't set max-level for AppSourceBintr '" 
-                << GetName() << "' as it's currently in a linked state");
-            return false;
+            g_cond_wait_until(&m_replayCond, &m_replayMutex, endTime);
         }
-        m_maxBytes = level;
-        m_pSourceElement->SetAttribute("max-bytes", m_maxBytes);
-
-        return true;
+        return !m_stopReplay;
     }
     
-//    uint AppSourceBintr::GetLeakyType()
-//    {
-//        LOG_FUNC();
-//        
-//        return m_leakyType;
-//    }
-//    
-//    bool AppSourceBintr::SetLeakyType(uint leakyType)
-//    {
-//        LOG_FUNC();
-//
-//        if (m_isLinked)
-//        {
-//            LOG_ERROR("Can't set leaky-type for AppSourceBintr '" 
-//                << GetName() << "' as it's currently in a linked state");
-//            return false;
-//        }
-//
-//        m_leakyType = leakyType;
-//        m_pSourceElement->SetAttribute("leaky-type", m_leakyType);
-//        return true;
-//    }
-
-
-    static void on_need_data_cb(GstElement* source, uint length,
-        gpointer pAppSrcBintr)
+    static gpointer meta_replay_source_thread(gpointer pMetaReplaySourceBintr)
     {
-        static_cast<AppSourceBintr*>(pAppSrcBintr)->
-            HandleNeedData(length);
+        static_cast<MetaReplaySourceBintr*>(pMetaReplaySourceBintr)->
+            HandleReplay();
+        return NULL;
     }
-        
-    static void on_enough_data_cb(GstElement* source, 
-        gpointer pAppSrcBintr)
+    
+    static void on_meta_replay_need_data_cb(GstElement* pSourceElement, 
+        uint length, gpointer pMetaReplaySourceBintr)
     {
-        static_cast<AppSourceBintr*>(pAppSrcBintr)->
-            HandleEnoughData();
+        static_cast<MetaReplaySourceBintr*>(pMetaReplaySourceBintr)->
+            HandleNeedData();
     }
         
     //*********************************************************************************
@@ -2210,7 +3167,8 @@ namespace DSL
         {
             if (GST_EVENT_TYPE(event) == GST_EVENT_EOS)
             {
-                g_timeout_add(1, StreamBufferSeekCB, this);
+                m_streamBufferSeekTimer.AddTimeout(GetGstObject(), 1, 
+                    StreamBufferSeekCB, this);
             }
             if (GST_EVENT_TYPE(event) == GST_EVENT_SEGMENT)
             {
@@ -2748,7 +3706,6 @@ namespace DSL
         const char* uri, bool isLive, uint fpsN, uint fpsD, uint timeout)
         : ResourceSourceBintr(name, uri)
         , m_timeout(timeout)
-        , m_timeoutTimerId(0)
     {
         LOG_FUNC();
         
@@ -2889,7 +3846,7 @@ namespace DSL
         
         if (m_timeout)
         {
-            m_timeoutTimerId = g_timeout_add(m_timeout*1000, 
+            m_timeoutTimer.AddTimeout(GetGstObject(), m_timeout*1000, 
                 ImageSourceDisplayTimeoutHandler, this);
         }
         
@@ -2905,11 +3862,10 @@ namespace DSL
             LOG_ERROR("ImageStreamSourceBintr '" << GetName() << "' is not in a linked state");
             return;
         }
-        if (m_timeoutTimerId)
+        if (m_timeoutTimer)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_timeoutTimerMutex);
-            g_source_remove(m_timeoutTimerId);
-            m_timeoutTimerId = 0;
+            m_timeoutTimer.Remove();
         }
         
         m_pSourceElement->UnlinkFromSink();
@@ -2927,7 +3883,7 @@ namespace DSL
 
         // Send the EOS event to end the Image display
         SendEos();
-        m_timeoutTimerId = 0;
+        m_timeoutTimer.Clear();
         
         // Single shot - so don't restart
         return 0;
@@ -3104,17 +4060,16 @@ namespace DSL
         , m_numExtraSurfaces(DSL_DEFAULT_NUM_EXTRA_SURFACES)
         , m_rtpProtocols(protocol)
         , m_latency(latency)
-        , m_firstConnectTime(0)
+        , m_firstConnectStartTime(0)
         , m_bufferTimeout(timeout)
         , m_streamManagerTimerId(0)
-        , m_reconnectionManagerTimerId(0)
         , m_connectionData{0}
-        , m_reconnectionFailed(false)
-        , m_reconnectionSleep(0)
+        , m_reconnectionPending(false)
+        , m_reconnectionFailures(0)
+        , m_reconnectionNotBefore(0)
         , m_reconnectionStartTime{0}
         , m_currentState(GST_STATE_NULL)
         , m_previousState(GST_STATE_NULL)
-        , m_listenerNotifierTimerId(0)
     {
         // ---------------------------------------------------------------------------
         // The RTSP Source is linked in one of two ways depending on whether
@@ -3235,13 +4190,22 @@ namespace DSL
     {
         LOG_FUNC();
         
-        if (m_reconnectionManagerTimerId)
+        // The stream-manager watch must be removed while the Bintr's GST object,
+        // the watch's owner, is still valid.
+        if (m_streamManagerTimerId)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
+            DeadlineScheduler::GetScheduler()->RemoveWatch(m_streamManagerTimerId);
+        }
+        if (m_reconnectionManagerTimer)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
-            g_source_remove(m_reconnectionManagerTimerId);
+            m_reconnectionManagerTimer.Remove();
         }
+        ReconnectionCoordinator::GetCoordinator()->CancelAttempt(GetName());
 
-        // Note: don't need t worry about stopping the one-shot m_listenerNotifierTimerId
+        // Drop any state-change notifications still queued
+        CallbackDispatcher::GetDispatcher()->RemoveAllListeners(this);
         
         m_pSrcPadBufferProbe->RemovePadProbeHandler(m_TimestampPph);
     }
@@ -3259,16 +4223,21 @@ namespace DSL
 
         // Note: all elements are linked in the select-stream and pad-added callbacks.
 
-        // Start the Stream mangement timer, only if timeout is enable and 
+        // Start the Stream mangement watch, only if timeout is enable and 
         if (m_bufferTimeout)
         {
-            // reset the first connect counter in case the pipeline is relinking 
-            // and playing after a previous play and stop.
-            m_firstConnectTime = 0;
+            // reset the last buffer time and first connect start time in case 
+            // the pipeline is relinking and playing after a previous play and stop.
+            m_TimestampPph->SetTimestamp(0);
+            m_firstConnectStartTime = DeadlineScheduler::Now();
             
-            m_streamManagerTimerId = g_timeout_add(
-                DSL_RTSP_TEST_FOR_BUFFER_TIMEOUT_PERIOD_MS, 
-                RtspStreamManagerHandler, this);
+            // The Deadline Scheduler calls the Stream Manager only when no buffer
+            // has been received within the timeout. Use the earlier of the buffer
+            // and first-connection timeouts, the Stream Manager adjusts as needed.
+            m_streamManagerTimerId = DeadlineScheduler::GetScheduler()->AddWatch(
+                m_TimestampPph->GetTimestampPtr(), 
+                std::min(m_bufferTimeout, m_connectionData.timeout)*1000,
+                RtspStreamManagerHandler, this, GetGstObject());
             LOG_INFO("Starting stream management for RTSP Source '" 
                 << GetName() << "'");
         }
@@ -3292,20 +4261,21 @@ namespace DSL
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
             
-            g_source_remove(m_streamManagerTimerId);
+            DeadlineScheduler::GetScheduler()->RemoveWatch(m_streamManagerTimerId);
             m_streamManagerTimerId = 0;
             LOG_INFO("Stream management disabled for RTSP Source '" 
                 << GetName() << "'");
         }
-        if (m_reconnectionManagerTimerId)
+        if (m_reconnectionManagerTimer)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
 
-            g_source_remove(m_reconnectionManagerTimerId);
-            m_reconnectionManagerTimerId = 0;
+            m_reconnectionManagerTimer.Remove();
             LOG_INFO("Reconnection management disabled for RTSP Source '" 
                 << GetName() << "'");
         }
+        // Free any reconnection slot held, or waited for, with the coordinator.
+        ReconnectionCoordinator::GetCoordinator()->CancelAttempt(GetName());
         
         if (m_isFullyLinked)
         {
@@ -3377,7 +4347,7 @@ namespace DSL
             if (m_streamManagerTimerId)
             {
                 // shutdown the current session
-                g_source_remove(m_streamManagerTimerId);
+                DeadlineScheduler::GetScheduler()->RemoveWatch(m_streamManagerTimerId);
                 m_streamManagerTimerId = 0;
                 LOG_INFO("Stream management disabled for RTSP Source '" << GetName() << "'");
             }
@@ -3385,19 +4355,20 @@ namespace DSL
             if (timeout)
             {
                 // Start up stream mangement
-                m_streamManagerTimerId = g_timeout_add(timeout, 
-                    RtspReconnectionMangerHandler, this);
+                m_streamManagerTimerId = DeadlineScheduler::GetScheduler()->AddWatch(
+                    m_TimestampPph->GetTimestampPtr(), timeout*1000, 
+                    RtspStreamManagerHandler, this, GetGstObject());
                 LOG_INFO("Stream management enabled for RTSP Source '" 
                     << GetName() << "' with timeout = " << timeout);
             }
             // Else, the client is disabling stream mangagement. Shut down the 
             // reconnection cycle if running. 
-            else if (m_reconnectionManagerTimerId)
+            else if (m_reconnectionManagerTimer)
             {
                 LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
                 // shutdown the current reconnection cycle
-                g_source_remove(m_reconnectionManagerTimerId);
-                m_reconnectionManagerTimerId = 0;
+                m_reconnectionManagerTimer.Remove();
+                ReconnectionCoordinator::GetCoordinator()->CancelAttempt(GetName());
                 LOG_INFO("Reconnection management disabled for RTSP Source '" << GetName() << "'");
             }
         }
@@ -3554,6 +4525,8 @@ namespace DSL
             return false;
         }
         m_stateChangeListeners.erase(listener);
+        CallbackDispatcher::GetDispatcher()->RemoveListener(this,
+            reinterpret_cast<const void*>(listener));
         
         return true;
     }
@@ -3795,44 +4768,64 @@ namespace DSL
             return true;
         }
 
-        struct timeval currentTime;
-        gettimeofday(&currentTime, NULL);
+        uint64_t currentTime = DeadlineScheduler::Now();
 
         GstState currentState;
         uint stateResult = GetState(currentState, 0);
         SetCurrentState(currentState);
         
         // Get the last buffer-time so we can determine if connection is nominal
-        struct timeval lastBufferTime;
-        m_TimestampPph->GetTime(lastBufferTime);
+        uint64_t lastBufferTime = m_TimestampPph->GetTimestamp();
         
         // If we still haven't received our first buffer... we're waiting for the
         // the first connection attemp to complete
-        if (lastBufferTime.tv_sec == 0)
+        if (!lastBufferTime)
         {
-            // Increment the total time we've been waiting for connection.
-            m_firstConnectTime += DSL_RTSP_TEST_FOR_BUFFER_TIMEOUT_PERIOD_MS;
+            // Start the first connection wait if called before being linked.
+            if (!m_firstConnectStartTime)
+            {
+                m_firstConnectStartTime = currentTime;
+            }
+            uint64_t firstConnectTimeMs = 
+                (currentTime - m_firstConnectStartTime) / 1000000;
             
             // If we haven't exceeded our first connection wait time.
-            if (m_firstConnectTime < (m_connectionData.timeout*1000))
+            if (firstConnectTimeMs < (uint64_t)m_connectionData.timeout*1000)
             {
                 LOG_DEBUG("RtspSourceBintr '" << GetName() 
                     << "' is waiting for first connection" );
+                    
+                // Wake again no later than the end of the first connection wait.
+                if (m_streamManagerTimerId)
+                {
+                    DeadlineScheduler::GetScheduler()->SetWatchTimeout(
+                        m_streamManagerTimerId, std::min(
+                            (uint64_t)m_bufferTimeout*1000, 
+                            (uint64_t)m_connectionData.timeout*1000 - firstConnectTimeMs));
+                }
                 return true;
             }
 
             LOG_ERROR("First connection timeout for RtspSourceBintr '" 
                 << GetName() << "' " );
-            m_firstConnectTime = 0;
+            m_firstConnectStartTime = 0;
         }
         else
         {
-            double timeSinceLastBufferMs = 1000.0*(currentTime.tv_sec - lastBufferTime.tv_sec) + 
-                (currentTime.tv_usec - lastBufferTime.tv_usec) / 1000.0;
+            // The buffer timestamp can be marginally newer than currentTime.
+            uint64_t timeSinceLastBufferMs = (currentTime > lastBufferTime)
+                ? (currentTime - lastBufferTime) / 1000000
+                : 0;
 
-            if (timeSinceLastBufferMs < m_bufferTimeout*1000)
+            if (timeSinceLastBufferMs < (uint64_t)m_bufferTimeout*1000)
             {
-                // Timeout has not been exceeded, so return true to sleep again
+                // Timeout has not been exceeded. The watch's timeout may have been
+                // shortened while waiting for the first connection, so restore.
+                if (m_streamManagerTimerId)
+                {
+                    DeadlineScheduler::GetScheduler()->SetWatchTimeout(
+                        m_streamManagerTimerId, m_bufferTimeout*1000);
+                }
                 return true;
             }
             LOG_INFO("Buffer timeout of " << m_bufferTimeout << " seconds exceeded for source '" 
@@ -3847,11 +4840,15 @@ namespace DSL
             if (!ReconnectionManager())
             {
                 LOG_INFO("Unable to start re-connection manager for '" << GetName() << "'");
+                
+                // the watch will be removed on return
+                m_streamManagerTimerId = 0;
                 return false;
             }
         }
         LOG_INFO("Starting Re-connection Manager for source '" << GetName() << "'");
-        m_reconnectionManagerTimerId = g_timeout_add(1000, RtspReconnectionMangerHandler, this);
+        m_reconnectionManagerTimer.AddTimeout(GetGstObject(), 1000, 
+            RtspReconnectionMangerHandler, this);
 
         return true;
     }
@@ -3863,30 +4860,44 @@ namespace DSL
         {
             timeval currentTime;
             gettimeofday(&currentTime, NULL);
+            uint64_t now = DeadlineScheduler::Now();
             
             uint stateResult(0);
             GstState currentState;
             
-            if (!m_connectionData.is_in_reconnect or m_reconnectionFailed or 
+            // set the reset-state on entry to a new reconnection cycle.
+            if (!m_connectionData.is_in_reconnect)
+            {
+                m_connectionData.is_connected = false;
+                m_connectionData.retries = 0;
+                m_connectionData.is_in_reconnect = true;
+                m_reconnectionPending = true;
+                m_reconnectionFailures = 0;
+                m_reconnectionNotBefore = 0;
+            }
+            // else, if the current attempt has failed to complete in time.
+            else if (!m_reconnectionPending and 
                 (currentTime.tv_sec - m_reconnectionStartTime.tv_sec) > m_connectionData.timeout)
             {
-                // set the reset-state,
-                if (!m_connectionData.is_in_reconnect)
+                LOG_INFO("Re-connection attempt timed out for RTSP Source '" 
+                    << GetName() << "'");
+                failReconnectionAttempt();
+            }
+            
+            if (m_reconnectionPending)
+            {
+                // Sleeping after a failed attempt.
+                if (now < m_reconnectionNotBefore)
                 {
-                    m_connectionData.is_connected = false;
-                    m_connectionData.retries = 0;
-                    m_connectionData.is_in_reconnect = true;
+                    return true;
                 }
-                // if the previous attempt failed
-                else if (m_reconnectionFailed == true)
+                // Wait for a free slot, most recently healthy sources first.
+                if (!ReconnectionCoordinator::GetCoordinator()->RequestAttempt(
+                    GetName(), m_TimestampPph->GetTimestamp()))
                 {
-                    m_reconnectionSleep-=1;
-                    if (m_reconnectionSleep)
-                    {
-                        return true;
-                    }
-                    m_reconnectionFailed = false;    
+                    return true;
                 }
+                m_reconnectionPending = false;
                 m_connectionData.retries++;
 
                 LOG_INFO("Resetting RTSP Source '" << GetName() 
@@ -3897,6 +4908,8 @@ namespace DSL
                 if (SetState(GST_STATE_NULL, 0) != GST_STATE_CHANGE_SUCCESS)
                 {
                     LOG_ERROR("Failed to set RTSP Source '" << GetName() << "' to GST_STATE_NULL");
+                    ReconnectionCoordinator::GetCoordinator()->ReleaseAttempt(
+                        GetName(), false);
                     return false;
                 }
                 // update the internal state variable to notify all client listeners 
@@ -3928,10 +4941,13 @@ namespace DSL
                     {
                         LOG_INFO("Re-connection complete for RTSP Source'" << GetName() << "'");
                         m_connectionData.is_in_reconnect = false;
+                        m_reconnectionFailures = 0;
+                        ReconnectionCoordinator::GetCoordinator()->ReleaseAttempt(
+                            GetName(), true);
 
                         // update the current buffer timestamp to the current reset time
-                        m_TimestampPph->SetTime(currentTime);
-                        m_reconnectionManagerTimerId = 0;
+                        m_TimestampPph->SetTimestamp(DeadlineScheduler::Now());
+                        m_reconnectionManagerTimer.Clear();
                         return false;
                     }
                     
@@ -3948,9 +4964,7 @@ namespace DSL
                 case GST_STATE_CHANGE_FAILURE:
                     LOG_ERROR("FAILURE occured when trying to sync state for RTSP Source '" 
                         << GetName() << "'");
-                    m_reconnectionFailed = true;
-                    m_reconnectionSleep = m_connectionData.sleep;
-                    LOG_INFO("Sleeping after failed connection");
+                    failReconnectionAttempt();
                     return true;
 
                 default:
@@ -3961,6 +4975,25 @@ namespace DSL
         }while(true);
     }
     
+    void RtspSourceBintr::failReconnectionAttempt()
+    {
+        // Note: m_reconnectionManagerMutex must be held by the caller.
+        ReconnectionCoordinator* pCoordinator = 
+            ReconnectionCoordinator::GetCoordinator();
+            
+        pCoordinator->ReleaseAttempt(GetName(), false);
+        
+        m_reconnectionFailures++;
+        m_reconnectionPending = true;
+        
+        uint64_t backoff = pCoordinator->GetBackoff(m_connectionData.sleep, 
+            m_reconnectionFailures);
+        m_reconnectionNotBefore = DeadlineScheduler::Now() + backoff*1000000;
+        
+        LOG_INFO("Sleeping for " << backoff << " ms after " << m_reconnectionFailures 
+            << " failed connection attempt(s) for RTSP Source '" << GetName() << "'");
+    }
+    
     GstState RtspSourceBintr::GetCurrentState()
     {
         LOG_FUNC();
@@ -4009,51 +5042,23 @@ namespace DSL
                 m_connectionData.count++;
             }                    
             
-            if (m_stateChangeListeners.size())
+            // Notify each listener asynchronously. State changes are coalesced
+            // so that a slow listener receives the latest change only.
+            uint previousState(m_previousState), currentState(m_currentState);
+            for (auto const& imap: m_stateChangeListeners)
             {
-                std::shared_ptr<DslStateChange> pStateChange = 
-                    std::shared_ptr<DslStateChange>(new DslStateChange(m_previousState, m_currentState));
-                    
-                m_stateChanges.push(pStateChange);
+                dsl_state_change_listener_cb listener(imap.first);
+                void* clientData(imap.second);
                 
-                // start the asynchronous notification timer if not currently running
-                if (!m_listenerNotifierTimerId)
-                {
-                    m_listenerNotifierTimerId = g_timeout_add(1, RtspListenerNotificationHandler, this);
-                }
-            }
-        }
-    }
-    
-    int RtspSourceBintr::NotifyClientListeners()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_stateChangeMutex);
-        
-        while (m_stateChanges.size())
-        {
-            std::shared_ptr<DslStateChange> pStateChange = m_stateChanges.front();
-            m_stateChanges.pop();
-            
-            // iterate through the map of state-change-listeners calling each
-            for(auto const& imap: m_stateChangeListeners)
-            {
-                try
-                {
-                    imap.first((uint)pStateChange->m_previousState, 
-                        (uint)pStateChange->m_newState, imap.second);
-                }
-                catch(...)
-                {
-                    LOG_ERROR("RTSP Source '" << GetName() 
-                        << "' threw exception calling Client State-Change-Lister");
-                }
+                CallbackDispatcher::GetDispatcher()->Dispatch(this, 
+                    reinterpret_cast<const void*>(listener), 
+                    GetName() + ":state-change", 
+                    [listener, previousState, currentState, clientData]()
+                    {
+                        listener(previousState, currentState, clientData);
+                    }, true);
             }
-            
         }
-        // clear the timer id and return false to self remove
-        m_listenerNotifierTimerId = 0;
-        return false;
     }
     
     // --------------------------------------------------------------------------------------
@@ -4115,11 +5120,5 @@ namespace DSL
         return static_cast<RtspSourceBintr*>(pSource)->
             ReconnectionManager();
     }
-
-    static int RtspListenerNotificationHandler(gpointer pSource)
-    {
-        return static_cast<RtspSourceBintr*>(pSource)->
-            NotifyClientListeners();
-    }
     
 } // SDL namespace
@@ -31,7 +31,9 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslDewarperBintr.h"
 #include "DslTapBintr.h"
-#include "DslStateChange.h"
+#include "DslMainContext.h"
+#include "DslShmRingReader.h"
+#include "DslMetaExportReader.h"
 
 namespace DSL
 {
@@ -51,6 +53,18 @@ namespace DSL
         std::shared_ptr<AppSourceBintr>(new AppSourceBintr(name, isLive, \
             bufferInFormat, width, height, fpsN, fpsD))
         
+    #define DSL_META_REPLAY_SOURCE_PTR std::shared_ptr<MetaReplaySourceBintr>
+    #define DSL_META_REPLAY_SOURCE_NEW(name, filePath, speed, surfaceType, \
+        width, height) \
+        std::shared_ptr<MetaReplaySourceBintr>(new MetaReplaySourceBintr(name, \
+            filePath, speed, surfaceType, width, height))
+        
+    #define DSL_SHM_SOURCE_PTR std::shared_ptr<ShmSourceBintr>
+    #define DSL_SHM_SOURCE_NEW(name, shmName, bufferInFormat, width, height, \
+        fpsN, fpsD, numSlots) \
+        std::shared_ptr<ShmSourceBintr>(new ShmSourceBintr(name, shmName, \
+            bufferInFormat, width, height, fpsN, fpsD, numSlots))
+        
     #define DSL_CSI_SOURCE_PTR std::shared_ptr<CsiSourceBintr>
     #define DSL_CSI_SOURCE_NEW(name, width, height, fpsN, fpsD) \
         std::shared_ptr<CsiSourceBintr>(new CsiSourceBintr(name, width, height, fpsN, fpsD))
@@ -274,7 +288,7 @@ namespace DSL
          * @param[in] name unique name for the new CustomSourceBintr
          */
         CustomSourceBintr(const char* name, const char* elementName, const char* factoryName,
-                          void** element);
+                          void** element = NULL);
 
         /**
          * @brief dtor for the CustomSourceBintr class
@@ -282,14 +296,15 @@ namespace DSL
         ~CustomSourceBintr();
 
         /**
-         * @brief virtual function for derived classes to implement
-         * a bintr type specific function to link all children.
+         * @brief Adds the "src" ghost pad for the custom source element.
+         * Derived classes must call this base function first.
+         * @return true on success, false otherwise.
          */
         virtual bool LinkAll();
 
         /**
-         * @brief virtual function for derived classes to implement
-         * a bintr type specific function to unlink all child elements.
+         * @brief Removes the "src" ghost pad for the custom source element.
+         * Derived classes must call this base function last.
          */
         virtual void UnlinkAll();
 
@@ -681,6 +696,28 @@ namespace DSL
     };
 
     //*********************************************************************************
+    /**
+     * @struct AppSourceWrappedRelease
+     * @brief release data for client memory wrapped by an AppSourceBintr.
+     */
+    struct AppSourceWrappedRelease
+    {
+        /**
+         * @brief client callback to call once the memory is released.
+         */
+        dsl_source_app_buffer_release_cb releaseCb;
+        
+        /**
+         * @brief pointer to the wrapped client memory.
+         */
+        void* data;
+        
+        /**
+         * @brief opaque pointer to client data to return with the callback.
+         */
+        void* clientData;
+    };
+
     /**
      * @class AppSourceBintr
      * @brief 
@@ -739,6 +776,51 @@ namespace DSL
          */
         bool PushSample(void* sample);
         
+        /**
+         * @brief Pushes a batch of new buffers to this AppSourceBintr as a single
+         * buffer-list. Ownership of each buffer is transferred to the appsrc.
+         * @param[in] buffers array of buffers to push to this AppSourceBintr.
+         * @param[in] numBuffers number of buffers in the array.
+         * @return true on successful push, false otherwise.
+         */
+        bool PushBuffers(void** buffers, uint numBuffers);
+        
+        /**
+         * @brief Wraps a batch of client memory blocks in new buffers, without 
+         * copying, and pushes them to this AppSourceBintr as a single buffer-list.
+         * @param[in] buffers array of client memory blocks to wrap and push.
+         * @param[in] numBuffers number of memory blocks in the array.
+         * @param[in] releaseCb client callback to call when each block is 
+         * released by the Pipeline.
+         * @return true on successful push, false otherwise.
+         */
+        bool PushWrappedBuffers(const dsl_source_app_wrapped_buffer* buffers, 
+            uint numBuffers, dsl_source_app_buffer_release_cb releaseCb);
+        
+        /**
+         * @brief Gets the current buffer-pool size for this AppSourceBintr.
+         * @return number of buffers to pre-allocate when linked, 0 = no pool.
+         */
+        uint GetBufferPoolSize();
+        
+        /**
+         * @brief Sets the buffer-pool size for this AppSourceBintr.
+         * @param[in] size number of frame-sized buffers to pre-allocate when 
+         * linked, 0 to disable.
+         * @return true on successful set, false otherwise.
+         */
+        bool SetBufferPoolSize(uint size);
+        
+        /**
+         * @brief Acquires a free buffer from this AppSourceBintr's buffer-pool,
+         * mapped for writing. The buffer is unmapped when it is pushed. 
+         * @param[out] buffer acquired buffer or NULL if all are in use.
+         * @param[out] data writable pointer to the buffer's data.
+         * @param[out] size size of the buffer's data in bytes.
+         * @return true on success, false if the buffer-pool is not active.
+         */
+        bool AcquireBuffer(void** buffer, void** data, uint64_t* size);
+        
         /**
          * @brief Notifies this AppSourceBintr that there are no more buffers 
          * for processing.
@@ -900,6 +982,43 @@ namespace DSL
          */
         uint64_t m_maxBytes;
         
+        /**
+         * @brief Pushes a list of buffers to the appsrc, individually if 
+         * do-timestamp is enabled, as a single buffer-list otherwise.
+         * @param[in] pBufferList buffer-list to push, ownership is transferred.
+         * @return true on successful push, false otherwise.
+         */
+        bool PushBufferList(GstBufferList* pBufferList);
+        
+        /**
+         * @brief Unmaps a buffer acquired from the buffer-pool, if mapped, 
+         * prior to pushing it to the appsrc.
+         * @param[in] pBuffer buffer about to be pushed.
+         */
+        void UnmapPoolBuffer(GstBuffer* pBuffer);
+        
+        /**
+         * @brief number of buffers to pre-allocate on LinkAll, 0 = no pool.
+         */
+        uint m_bufferPoolSize;
+        
+        /**
+         * @brief buffer-pool created and activated on LinkAll, NULL otherwise.
+         */
+        GstBufferPool* m_pBufferPool;
+        
+        /**
+         * @brief map of acquired pool buffers to their current write-mapping,
+         * held until the client pushes the buffer.
+         */
+        std::map<GstBuffer*, GstMapInfo> m_mappedPoolBuffers;
+        
+        /**
+         * @brief mutex to protect mutual access to the buffer-pool and 
+         * the map of mapped pool buffers.
+         */
+        DslMutex m_bufferPoolMutex;
+        
         /**
          * @brief The maximum amount of buffers that can be queued internally. 
          * After the maximum amount of buffers are queued, appsrc will emit 
@@ -941,6 +1060,347 @@ namespace DSL
      */
     static void on_enough_data_cb(GstElement* pSourceElement, 
         gpointer pAppSrcBintr);
+
+    /**
+     * @brief Destroy-notify function for client memory wrapped by 
+     * AppSourceBintr::PushWrappedBuffers. Calls the client's release callback.
+     * @param pRelease pointer to the wrapped buffer's release data.
+     */
+    static void on_wrapped_buffer_release_cb(gpointer pRelease);
+        
+    //*********************************************************************************
+    class ShmSourceBintr;
+    
+    /**
+     * @struct ShmSourceFrameRelease
+     * @brief release data for a ring frame wrapped by a ShmSourceBintr.
+     */
+    struct ShmSourceFrameRelease
+    {
+        /**
+         * @brief Shared Memory Source that read the frame.
+         */
+        ShmSourceBintr* pSource;
+        
+        /**
+         * @brief sequence number of the frame in the ring.
+         */
+        uint64_t seq;
+    };
+
+    /**
+     * @class ShmSourceBintr
+     * @brief Implements a live Video Source that reads raw frames, in place, 
+     * from a shared-memory ring written by a producer process using the 
+     * DSL Shared Memory Producer library (DslShmProducer.h).
+     */
+    class ShmSourceBintr : public VideoSourceBintr
+    {
+    public: 
+    
+        ShmSourceBintr(const char* name, const char* shmName,
+            const char* bufferInFormat, uint width, uint height, 
+            uint fpsN, uint fpsD, uint numSlots);
+
+        ~ShmSourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this ShmSourceBintr
+         * and starts reading frames from the ring.
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Stops reading frames from the ring and unlinks all Child 
+         * Elementrs owned by this ShmSourceBintr
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief Gets the name of the shared-memory ring for this ShmSourceBintr.
+         * @return name of the shared-memory ring.
+         */
+        const char* GetShmName();
+        
+        /**
+         * @brief Gets the current ring stats for this ShmSourceBintr.
+         * @param[out] stats current ring stats.
+         */
+        void GetStats(dsl_shm_source_stats* stats);
+        
+        /**
+         * @brief Clears the current ring stats for this ShmSourceBintr.
+         */
+        void ClearStats();
+        
+        /**
+         * @brief Reads frames from the ring and pushes them, wrapped in place,
+         * to the appsrc until stopped. Called by the read thread.
+         */
+        void HandleRead();
+        
+        /**
+         * @brief Releases a frame's ring slot once the Pipeline has released
+         * its buffer.
+         * @param[in] seq sequence number of the frame to release.
+         */
+        void ReleaseFrame(uint64_t seq);
+        
+    private:
+    
+        /**
+         * @brief buffer-in format for the ShmSourceBintr - on of the 
+         * DSL_VIDEO_FORMAT constants.
+         */
+        std::string m_bufferInFormat;
+        
+        /**
+         * @brief reader for the shared-memory ring, created with this Bintr.
+         */
+        DSL_SHM_RING_READER_PTR m_pRingReader;
+        
+        /**
+         * @brief caps identifying the producer timestamp meta attached to
+         * each buffer.
+         */
+        GstCaps* m_pTimestampCaps;
+        
+        /**
+         * @brief thread reading frames from the ring while linked.
+         */
+        GThread* m_pReadThread;
+        
+        /**
+         * @brief set to stop the read thread.
+         */
+        std::atomic<bool> m_stopReading;
+    };
+    
+    /**
+     * @brief Read-thread function for the ShmSourceBintr.
+     * @param pShmSourceBintr pointer to the ShmSourceBintr to read for.
+     * @return NULL
+     */
+    static gpointer shm_source_read_thread(gpointer pShmSourceBintr);
+    
+    /**
+     * @brief Destroy-notify function for frames wrapped by the ShmSourceBintr.
+     * @param pRelease pointer to the frame's release data.
+     */
+    static void on_shm_frame_release_cb(gpointer pRelease);
+        
+    //*********************************************************************************
+    /**
+     * @brief maximum number of replayed buffers queued by the appsrc of a 
+     * MetaReplaySourceBintr before the replay thread is blocked.
+     */
+    #define DSL_META_REPLAY_MAX_QUEUED_BUFFERS                      4
+    
+    /**
+     * @brief time after its scheduled time that a paced batch is counted
+     * as late.
+     */
+    #define DSL_META_REPLAY_LATE_THRESHOLD_US                       5000
+
+    /**
+     * @class MetaReplaySourceBintr
+     * @brief Implements a Source that replays a metadata stream recorded by 
+     * the Metadata Export Sink. Each batch record is pushed as a buffer 
+     * carrying a reconstructed NvDsBatchMeta, optionally with a blank or 
+     * test-pattern RGBA surface. The Source is a CustomSourceBintr so that
+     * the Pipeline's Streammuxer, which would replace the batch meta, is 
+     * bypassed.
+     */
+    class MetaReplaySourceBintr : public CustomSourceBintr
+    {
+    public: 
+    
+        MetaReplaySourceBintr(const char* name, const char* filePath,
+            double speed, uint surfaceType, uint width, uint height);
+
+        ~MetaReplaySourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this MetaReplaySourceBintr
+         * and starts replaying from the first record of the stream.
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Stops replaying and unlinks all Child Elementrs owned by 
+         * this MetaReplaySourceBintr
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief Gets the path to the recorded stream.
+         * @return path to the recorded stream.
+         */
+        const char* GetFilePath()
+        {
+            LOG_FUNC();
+            
+            return m_filePath.c_str();
+        };
+        
+        /**
+         * @brief Gets the current replay stats for this MetaReplaySourceBintr.
+         * @param[out] stats current replay stats.
+         */
+        void GetStats(dsl_meta_replay_source_stats* stats);
+        
+        /**
+         * @brief Clears the current replay stats for this MetaReplaySourceBintr.
+         */
+        void ClearStats();
+        
+        /**
+         * @brief Handles the appsrc "need-data" signal. Releases the replay 
+         * thread once the appsrc has started.
+         */
+        void HandleNeedData();
+        
+        /**
+         * @brief Reads records from the stream and pushes them, paced by 
+         * their recorded timestamps, to the appsrc until stopped or the end
+         * of the stream. Called by the replay thread.
+         */
+        void HandleReplay();
+        
+    private:
+    
+        /**
+         * @brief Creates a new buffer with a batch meta reconstructed from 
+         * a batch record.
+         * @param[in] pRecord validated batch record.
+         * @param[out] numObjects number of objects added to the batch meta.
+         * @return new buffer.
+         */
+        GstBuffer* NewBatchBuffer(const dsl_meta_export_batch* pRecord,
+            uint* numObjects);
+        
+        /**
+         * @brief Waits until a monotonic time or until stopped.
+         * @param[in] endTime monotonic time to wait until in microseconds.
+         * @return false if stopped, true otherwise.
+         */
+        bool WaitUntil(gint64 endTime);
+    
+        /**
+         * @brief path to the recorded stream.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief replay speed relative to the recorded timestamps. 
+         * 0 to replay at maximum speed.
+         */
+        double m_speed;
+        
+        /**
+         * @brief one of the DSL_SOURCE_META_REPLAY_SURFACE constants.
+         */
+        uint m_surfaceType;
+        
+        /**
+         * @brief width of the attached surface in pixels.
+         */
+        uint m_width;
+        
+        /**
+         * @brief height of the attached surface in pixels.
+         */
+        uint m_height;
+        
+        /**
+         * @brief reader for the recorded stream, created with this Bintr.
+         */
+        DSL_META_EXPORT_READER_PTR m_pMetaExportReader;
+        
+        /**
+         * @brief surface memory shared by all buffers, NULL if none.
+         */
+        GstMemory* m_pSurfaceMemory;
+        
+        /**
+         * @brief thread replaying the stream while linked.
+         */
+        GThread* m_pReplayThread;
+        
+        /**
+         * @brief set to stop the replay thread. Written with m_replayMutex 
+         * held so that waits on m_replayCond are woken, and read lock-free
+         * by the replay thread between records.
+         */
+        std::atomic<bool> m_stopReplay;
+        
+        /**
+         * @brief set once the appsrc has requested data.
+         */
+        bool m_needData;
+        
+        /**
+         * @brief mutex to protect the replay state and stats.
+         */
+        DslMutex m_replayMutex;
+        
+        /**
+         * @brief condition to wake the replay thread on need-data and stop.
+         */
+        DslCond m_replayCond;
+        
+        /**
+         * @brief number of batches pushed since the stats were cleared.
+         */
+        uint64_t m_batchesReplayed;
+        
+        /**
+         * @brief number of frames pushed since the stats were cleared.
+         */
+        uint64_t m_framesReplayed;
+        
+        /**
+         * @brief number of objects pushed since the stats were cleared.
+         */
+        uint64_t m_objectsReplayed;
+        
+        /**
+         * @brief number of paced batches pushed late since the stats were 
+         * cleared.
+         */
+        uint64_t m_lateBatches;
+        
+        /**
+         * @brief number of records skipped since the stats were cleared.
+         */
+        uint64_t m_recordsSkipped;
+        
+        /**
+         * @brief number of bytes read since the stats were cleared.
+         */
+        uint64_t m_bytesRead;
+    };
+    
+    /**
+     * @brief Replay-thread function for the MetaReplaySourceBintr.
+     * @param pMetaReplaySourceBintr pointer to the MetaReplaySourceBintr 
+     * to replay for.
+     * @return NULL
+     */
+    static gpointer meta_replay_source_thread(gpointer pMetaReplaySourceBintr);
+    
+    /**
+     * @brief Callback function for the appsrc "need-data" signal of the 
+     * MetaReplaySourceBintr.
+     * @param pSourceElement "appsrc" plugin/element that invoked the signal (unused)
+     * @param length the amount of bytes needed (unused).
+     * @param pMetaReplaySourceBintr pointer to the MetaReplaySourceBintr that
+     * registered for the "need-data" signal.
+     */
+    static void on_meta_replay_need_data_cb(GstElement* pSourceElement, 
+        uint length, gpointer pMetaReplaySourceBintr);
         
     //*********************************************************************************
     /**
@@ -1347,6 +1807,11 @@ namespace DSL
          * @brief mutual exclusion of the repeat enabled setting.
          */
         DslMutex m_repeatEnabledMutex;
+        
+        /**
+         * @brief one-shot timer to seek to the start of the stream on EOS.
+         */
+        MainContextSource m_streamBufferSeekTimer;
     };
 
     //*********************************************************************************
@@ -1638,9 +2103,9 @@ namespace DSL
         uint m_timeout;
 
         /**
-         * @brief gnome timer Id for the display timeout
+         * @brief timer for the display timeout
          */
-        uint m_timeoutTimerId;
+        MainContextSource m_timeoutTimer;
         
         /**
          * @brief mutux to guard the display timeout callback.
@@ -1853,8 +2318,9 @@ namespace DSL
         bool RemoveStateChangeListener(dsl_state_change_listener_cb listener);
 
         /**
-         * @brief Called periodically on timer experation to Check the status of the RTSP stream
-         * and to initiate a reconnection cycle when the last buffer time execeeds timeout
+         * @brief Called by the DeadlineScheduler on missed buffer deadline to check the 
+         * status of the RTSP stream and to initiate a reconnection cycle when the last 
+         * buffer time execeeds timeout
          */
         int StreamManager();
         
@@ -1879,13 +2345,6 @@ namespace DSL
          */
         void SetCurrentState(GstState newState);
         
-        /**
-         * @brief implements a timer thread to notify all client listeners in the main loop context.
-         * @return false always to self remove timer once clients have been notified. Timer/tread will
-         * be restarted on next call to SetCurrentState() that changes the current state.
-         */
-        int NotifyClientListeners();
-        
         /**
          * @brief NOTE: Used for test purposes only, allows access to the 
          * Source's Timestamp PPH which 
@@ -1961,6 +2420,12 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief releases the current reconnection attempt as failed and
+         * starts the backoff sleep before the next attempt.
+         */
+        void failReconnectionAttempt();
+    
         /**
          * @brief The common elements are not linked until after the rtspsrc
          * has called the select-stream callback. We don't want to try and 
@@ -2056,9 +2521,10 @@ namespace DSL
         DSL_PPH_TIMESTAMP_PTR m_TimestampPph;
 
         /**
-         * @brief time incremented while waiting for first connection in ms.
+         * @brief monotonic time the wait for first connection started in ns, 
+         * 0 when not waiting.
          */
-        uint m_firstConnectTime;
+        uint64_t m_firstConnectStartTime;
         
         /**
          * @brief maximim time between successive buffers before determining the 
@@ -2067,7 +2533,8 @@ namespace DSL
         uint m_bufferTimeout;
         
         /**
-         * @brief gnome timer Id for RTSP stream-status and reconnect management 
+         * @brief DeadlineScheduler watch Id for RTSP stream-status and 
+         * reconnect management 
          */
         uint m_streamManagerTimerId;
         
@@ -2082,9 +2549,9 @@ namespace DSL
         dsl_rtsp_connection_data m_connectionData;
         
         /**
-         * @brief gnome timer Id for the RTSP reconnection manager
+         * @brief timer for the RTSP reconnection manager
          */
-        uint m_reconnectionManagerTimerId;
+        MainContextSource m_reconnectionManagerTimer;
 
         /**
          * @brief mutux to guard the reconnection managment read/write attributes.
@@ -2092,14 +2559,21 @@ namespace DSL
         DslMutex m_reconnectionManagerMutex;
         
         /**
-         * @brief will be set to true on reconnection failure to force a mew reconnection cycle
+         * @brief true while waiting to start the next reconnection attempt, 
+         * either sleeping after failure or waiting for a coordinator slot.
+         */
+        bool m_reconnectionPending;
+        
+        /**
+         * @brief number of consecutive failed reconnection attempts.
          */
-        bool m_reconnectionFailed;
+        uint m_reconnectionFailures;
         
         /**
-         * @brief remaining time to sleep after a failed reconnection attemp, in seconds. 
+         * @brief monotonic time in ns before which the next reconnection attempt 
+         * must not start - exponential backoff with jitter after failure. 
          */
-        uint m_reconnectionSleep;
+        uint64_t m_reconnectionNotBefore;
         
         /**
          * @brief start time of the most recent reconnection cycle, used for maximum timeout 
@@ -2122,21 +2596,11 @@ namespace DSL
          */
         DslMutex m_stateChangeMutex;
 
-        /**
-         * @brief gnome timer Id for the RTSP reconnection manager
-         */
-        uint m_listenerNotifierTimerId;
-        
         /**
          * @brief map of all currently registered state-change-listeners
          * callback functions mapped with the user provided data
          */
         std::map<dsl_state_change_listener_cb, void*>m_stateChangeListeners;
-        
-        /**
-         * @brief a queue of state changes to process and notify clients asynchronously
-         */
-        std::queue<std::shared_ptr<DslStateChange>> m_stateChanges;
     };
     
     /**
@@ -2210,9 +2674,9 @@ namespace DSL
     static gboolean StreamBufferSeekCB(gpointer pSource);
     
     /**
-     * @brief Timer callback handler to invoke the RTSP Source's Stream manager.
+     * @brief Missed deadline handler to invoke the RTSP Source's Stream manager.
      * @param pSource shared pointer to RTSP Source component to check/manage.
-     * @return int true to continue, 0 to self remove
+     * @return int true to re-arm, 0 to self remove
      */
     static int RtspStreamManagerHandler(gpointer pSource);
     
@@ -2222,13 +2686,6 @@ namespace DSL
      * @return int true to continue, 0 to self remove
      */
     static int RtspReconnectionMangerHandler(gpointer pSource);
-    
-    /**
-     * @brief Timer callback handler to invoke the RTSP Source's Listerner notification.
-     * @param[in] pSource shared pointer to RTSP Source component to invoke.
-     * @return int true to continue, 0 to self remove
-     */
-    static int RtspListenerNotificationHandler(gpointer pSource);
 
 
 } // DSL
@@ -26,16 +26,22 @@ THE SOFTWARE.
 #define _DSL_SOURCE_METER_H
 
 #include "Dsl.h"
+#include "DslApi.h"
+#include "DslLatencyHistogram.h"
 
 namespace DSL
 {
     #define DSL_SOURCE_METER_PTR std::shared_ptr<SourceMeter>
-    #define DSL_SOURCE_METER_NEW(name) \
-        std::shared_ptr<SourceMeter>(new SourceMeter(name))
+    #define DSL_SOURCE_METER_NEW(sourceId) \
+        std::shared_ptr<SourceMeter>(new SourceMeter(sourceId))
 
     /**
      * @class SourceMeter
-     * @brief Implements a Meter to measure FPS over two seperate epics, one session, the other interval.
+     * @brief Implements a Meter to measure FPS, inter-frame jitter, stalls and 
+     * dropped frames for a single source. Frames are timestamped with the 
+     * monotonic clock in nanoseconds. The Meter is updated by a single 
+     * streaming thread with relaxed atomics and read by the reporting thread,
+     * which keeps its own snapshot of the last report to measure each interval.
      */
     class SourceMeter
     {
@@ -47,127 +53,215 @@ namespace DSL
          */
         SourceMeter(uint sourceId)
             : m_sourceId(sourceId)
-            , m_timeStamp{0}
-            , m_sessionStartTime{0}
-            , m_intervalStartTime{0}
-            , m_sessionFrameCount(0)
-            , m_intervalFrameCount(0)
+            , m_resetPending(false)
+            , m_session(0)
+            , m_sessionStartTime(0)
+            , m_lastTimestamp(0)
+            , m_frameCount(0)
+            , m_stallCount(0)
+            , m_dropCount(0)
+            , m_lastInterval(0)
+            , m_lastFrameNum(-1)
+            , m_reportSession(0)
+            , m_reportTimestamp(0)
+            , m_reportFrameCount(0)
             {};
+            
+        /**
+         * @brief Gets the current time from the monotonic clock.
+         * @return current time in nanoseconds.
+         */
+        static inline uint64_t Now()
+        {
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+        };
 
         /**
-         * @brief Updates the Timestamp for the Source meter
+         * @brief Updates the Meter with a new frame. Must only be called from 
+         * the streaming thread.
+         * @param[in] now monotonic timestamp for the frame in nanoseconds.
+         * @param[in] frameNum the source's frame number from the frame meta.
+         * @param[in] stallThreshold inter-frame interval in nanoseconds above 
+         * which a stall is counted.
          */
-        void Timestamp()
+        void Update(uint64_t now, int frameNum, uint64_t stallThreshold)
         {
-            gettimeofday(&m_timeStamp, NULL);
+            if (m_resetPending.exchange(false, std::memory_order_relaxed))
+            {
+                m_frameCount.store(0, std::memory_order_relaxed);
+                m_stallCount.store(0, std::memory_order_relaxed);
+                m_dropCount.store(0, std::memory_order_relaxed);
+                m_lastInterval = 0;
+                m_lastFrameNum = -1;
+                m_session.fetch_add(1, std::memory_order_relaxed);
+            }
+            uint64_t frameCount = m_frameCount.load(std::memory_order_relaxed);
             
-            // one-time initialization of start times after creation.
-            if (!m_sessionStartTime.tv_sec)
+            if (!frameCount)
             {
-                m_sessionStartTime = m_timeStamp;
-                m_intervalStartTime = m_timeStamp;
+                m_sessionStartTime.store(now, std::memory_order_relaxed);
             }
+            else
+            {
+                uint64_t interval = 
+                    now - m_lastTimestamp.load(std::memory_order_relaxed);
+
+                if (interval > stallThreshold)
+                {
+                    m_stallCount.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (m_lastInterval)
+                {
+                    m_jitter.Record((interval > m_lastInterval)
+                        ? interval - m_lastInterval
+                        : m_lastInterval - interval);
+                }
+                m_lastInterval = interval;
+            }
+            
+            // frame numbers that go backwards are a restarted stream, not drops.
+            if (m_lastFrameNum >= 0 and frameNum > m_lastFrameNum+1)
+            {
+                m_dropCount.fetch_add(frameNum - m_lastFrameNum - 1,
+                    std::memory_order_relaxed);
+            }
+            m_lastFrameNum = frameNum;
+            
+            m_lastTimestamp.store(now, std::memory_order_relaxed);
+            m_frameCount.store(frameCount+1, std::memory_order_release);
         }
         
         /**
-         * @brief Increments both frame counters. must be called on each buffer
-         */
-        void IncrementFrameCounts()
-        {
-            m_sessionFrameCount++;
-            m_intervalFrameCount++;
-        }
-        
-        /**
-         * @brief Resets the Session parameters only
+         * @brief Requests that the streaming thread restart the session on
+         * its next update.
          */
         void SessionReset()
         {
-            m_sessionStartTime = m_timeStamp;
-            m_sessionFrameCount = 0;
+            m_resetPending.store(true, std::memory_order_relaxed);
         };
         
         /**
-         * @brief Resets the Interval parameters only
+         * @brief Gets the current measurements and starts a new reporting 
+         * interval. Must only be called from the reporting thread.
+         * @param[out] stats current measurements for the source.
          */
-        void IntervalReset()
+        void GetStats(dsl_meter_source_stats* stats)
         {
-            m_intervalStartTime = m_timeStamp;
-            m_intervalFrameCount = 0;
-        };
-        
-        /**
-         * @brief Calculates the Average frames-per-second over a full session
-         * @return Average Session FPS
-         */
-        double GetSessionFpsAvg()
-        {
-            if (!m_sessionFrameCount)
+            // the frame count is read first, with acquire, so that the 
+            // timestamps are at least as recent as the count.
+            uint64_t frameCount = m_frameCount.load(std::memory_order_acquire);
+            uint session = m_session.load(std::memory_order_relaxed);
+            uint64_t sessionStartTime = 
+                m_sessionStartTime.load(std::memory_order_relaxed);
+            uint64_t lastTimestamp = m_lastTimestamp.load(std::memory_order_relaxed);
+            
+            // first report of a new session, the interval starts with the 
+            // session's first frame.
+            if (session != m_reportSession or !m_reportFrameCount or
+                frameCount < m_reportFrameCount)
             {
-                return 0;
+                m_reportSession = session;
+                m_reportTimestamp = sessionStartTime;
+                m_reportFrameCount = (frameCount) ? 1 : 0;
             }
-            // convert both secconds and micro-seconds to milli-seconds and add to greate single number
-            uint64_t sessionTime =             
-                (uint64_t)(m_timeStamp.tv_sec*1000 + m_timeStamp.tv_usec/1000) - 
-                (uint64_t)(m_sessionStartTime.tv_sec*1000 + m_sessionStartTime.tv_usec/1000);
 
-            double sessionFpsAvg = (double)m_sessionFrameCount / ((double)sessionTime/1000);        
+            dsl_latency_stats jitterStats;
+            m_jitter.GetStats(&jitterStats);
+            m_jitter.Clear();
+            
+            stats->source_id = m_sourceId;
+            stats->frame_count = frameCount;
+            stats->session_fps_avg = (frameCount) 
+                ? getFpsAvg(frameCount-1, lastTimestamp - sessionStartTime) : 0;
+            stats->interval_fps_avg = getFpsAvg(frameCount - m_reportFrameCount, 
+                lastTimestamp - m_reportTimestamp);
+            stats->jitter_p50 = jitterStats.p50;
+            stats->jitter_p90 = jitterStats.p90;
+            stats->jitter_p99 = jitterStats.p99;
+            stats->jitter_max = jitterStats.max;
+            stats->stall_count = m_stallCount.load(std::memory_order_relaxed);
+            stats->drop_count = m_dropCount.load(std::memory_order_relaxed);
             
-            LOG_INFO("Source '" << m_sourceId << "' session FPS avg = " << sessionFpsAvg);
-            return sessionFpsAvg;
+            m_reportTimestamp = lastTimestamp;
+            m_reportFrameCount = frameCount;
         }
-        
+    
+    private:
+    
         /**
-         * @brief Calculates the Average frames-per-second over a single interval
-         * @return Average interval FPS
+         * @brief Calculates an average frames-per-second.
+         * @param[in] frames number of frame intervals measured.
+         * @param[in] duration total duration of the intervals in nanoseconds.
+         * @return average FPS, 0 if nothing was measured.
          */
-        double GetIntervalFpsAvg()
+        static double getFpsAvg(uint64_t frames, uint64_t duration)
         {
-            if (!m_intervalFrameCount)
+            if (!frames or !duration)
             {
                 return 0;
             }
-            uint64_t intervalTime =             
-                (uint64_t)(m_timeStamp.tv_sec*1000 + m_timeStamp.tv_usec/1000) - 
-                (uint64_t)(m_intervalStartTime.tv_sec*1000 + m_intervalStartTime.tv_usec/1000);
-
-            double intervalFpsAvg = (double)m_intervalFrameCount / ((double)intervalTime/1000);
-
-            LOG_INFO("Source '" << m_sourceId << "' interval FPS avg = " << intervalFpsAvg);
-            return intervalFpsAvg;
+            return (double)frames*1000000000 / (double)duration;
         }
-    
-    private:
-    
+        
         /**
          * @brief unique source Id for the soure being metered
          */
-        int m_sourceId;
+        uint m_sourceId;
         
         /**
-         * @brief timestamp updated on each buffer with frame meta for the unique source
+         * @brief set by the reporting thread to have the streaming thread
+         * restart the session.
          */
-        struct timeval m_timeStamp;
+        std::atomic<bool> m_resetPending;
         
         /**
-         * @brief timestamp for the start of the current session
+         * @brief session count, incremented by the streaming thread on reset.
          */
-        struct timeval m_sessionStartTime;
+        std::atomic<uint> m_session;
+        
+        /**
+         * @brief timestamp of the first frame of the current session.
+         */
+        std::atomic<uint64_t> m_sessionStartTime;
+
+        /**
+         * @brief timestamp of the last frame received.
+         */
+        std::atomic<uint64_t> m_lastTimestamp;
+        
+        /**
+         * @brief number of frames received since the start of the session.
+         */
+        std::atomic<uint64_t> m_frameCount;
 
         /**
-         * @brief timestamp for the start of the current session
+         * @brief number of stalls and dropped frames since the start of the 
+         * session.
+         */
+        std::atomic<uint64_t> m_stallCount;
+        std::atomic<uint64_t> m_dropCount;
+        
+        /**
+         * @brief inter-frame jitter for the current reporting interval.
          */
-        struct timeval m_intervalStartTime;
+        LatencyHistogram m_jitter;
         
         /**
-         * @brief Frame count since the start of the current session
+         * @brief streaming thread only - last inter-frame interval and last 
+         * frame number.
          */
-        uint m_intervalFrameCount;
+        uint64_t m_lastInterval;
+        int m_lastFrameNum;
 
         /**
-         * @brief Frame count since the start of the current interval
+         * @brief reporting thread only - session, timestamp and frame count 
+         * at the end of the last reporting interval.
          */
-        uint m_sessionFrameCount;
+        uint m_reportSession;
+        uint64_t m_reportTimestamp;
+        uint64_t m_reportFrameCount;
     };
 }
 #endif // _DSL_SOURCE_METER_H
@@ -49,7 +49,7 @@ namespace DSL
     RecordTapBintr::RecordTapBintr(const char* name, const char* outdir, 
         uint container, dsl_record_client_listener_cb clientListener)
         : TapBintr(name)
-        , RecordMgr(name, outdir, m_gpuId, container, clientListener)
+        , RecordMgr(name, outdir, m_gpuId, container, clientListener, m_pGstObj)
     {
         LOG_FUNC();
         
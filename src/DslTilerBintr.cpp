@@ -38,7 +38,6 @@ namespace DSL
         , m_frameNumberingEnabled(false)
         , m_showSourceTimeout(0)
         , m_showSourceCounter(0)
-        , m_showSourceTimerId(0)
         , m_showSourceCycle(false)
     {
         LOG_FUNC();
@@ -97,11 +96,11 @@ namespace DSL
         {    
             UnlinkAll();
         }
-        if (m_showSourceTimerId)
+        if (m_showSourceTimer)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
             
-            g_source_remove(m_showSourceTimerId);
+            m_showSourceTimer.Remove();
         }
     }
 
@@ -246,7 +245,7 @@ namespace DSL
         m_showSourceCycle = false;
         if (sourceId != m_showSourceId)
         {
-            if (m_showSourceTimerId and !hasPrecedence)
+            if (m_showSourceTimer and !hasPrecedence)
             {
                 // don't log error as this may be common with ODE Triggers and Actions calling
                 LOG_DEBUG("Show source Timer is running for Source '" << m_showSourceId << 
@@ -259,10 +258,13 @@ namespace DSL
             m_pTiler->SetAttribute("show-source", m_showSourceId);
 
             m_showSourceCounter = m_showSourceTimeout*10;
+            // stop any timer running without precedence before adding new.
+            m_showSourceTimer.Remove();
             if (m_showSourceCounter)
             {
                 LOG_INFO("Adding show-source timer with timeout = " << timeout << "' for TilerBintr '" << GetName());
-                m_showSourceTimerId = g_timeout_add(100, ShowSourceTimerHandler, this);
+                m_showSourceTimer.AddTimeout(GetGstObject(), 100, 
+                    ShowSourceTimerHandler, this);
             }
             return true;
         }
@@ -271,10 +273,11 @@ namespace DSL
         
         m_showSourceTimeout = timeout;
         m_showSourceCounter = timeout*10;
-        if (!m_showSourceTimerId and m_showSourceCounter)
+        if (!m_showSourceTimer and m_showSourceCounter)
         {
             LOG_INFO("Adding show-source timer with timeout = " << timeout << "' for TilerBintr '" << GetName());
-            m_showSourceTimerId = g_timeout_add(100, ShowSourceTimerHandler, this);
+            m_showSourceTimer.AddTimeout(GetGstObject(), 100, 
+                ShowSourceTimerHandler, this);
         }
         return true;
     }
@@ -290,10 +293,9 @@ namespace DSL
             return false;
         }
         // if the timer is currently running, stop and remove first.
-        if (m_showSourceTimerId)
+        if (m_showSourceTimer)
         {
-            g_source_remove(m_showSourceTimerId);
-            m_showSourceTimerId = 0;
+            m_showSourceTimer.Remove();
         }
 
         m_showSourceCycle = true;
@@ -303,10 +305,11 @@ namespace DSL
 
         m_showSourceCounter = m_showSourceTimeout*10;
             
-        if (!m_showSourceTimerId and m_showSourceCounter)
+        if (!m_showSourceTimer and m_showSourceCounter)
         {
             LOG_INFO("Adding show-source timer with timeout = " << timeout << "' for TilerBintr '" << GetName());
-            m_showSourceTimerId = g_timeout_add(100, ShowSourceTimerHandler, this);
+            m_showSourceTimer.AddTimeout(GetGstObject(), 100, 
+                ShowSourceTimerHandler, this);
         }
         return true;
     }
@@ -316,10 +319,9 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
         
-        if (m_showSourceTimerId)
+        if (m_showSourceTimer)
         {
-            g_source_remove(m_showSourceTimerId);
-            m_showSourceTimerId = 0;
+            m_showSourceTimer.Remove();
             // call has Precendence over source cycling 
             m_showSourceCycle = false;
         }
@@ -353,7 +355,7 @@ namespace DSL
                 return true;
             }
             // otherwise, reset the timer Id, show all sources, and return false to destroy the timer
-            m_showSourceTimerId = 0;
+            m_showSourceTimer.Clear();
             m_showSourceId = -1;
             m_pTiler->SetAttribute("show-source", m_showSourceId);
             return false;
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslElementr.h"
 #include "DslBintr.h"
+#include "DslMainContext.h"
 
 namespace DSL
 {
@@ -235,9 +236,9 @@ namespace DSL
         uint m_showSourceCounter;
 
         /**
-         * @brief show-source timer-id, non-zero == currently running
+         * @brief show-source timer, held == currently running
          */
-        uint m_showSourceTimerId;
+        MainContextSource m_showSourceTimer;
         
         /**
          * @brief true if source cycling is enabled, false otherwise
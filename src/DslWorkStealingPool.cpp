@@ -0,0 +1,220 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslWorkStealingPool.h"
+
+namespace DSL
+{
+    /**
+     * @struct WorkStealingPoolWorker
+     * @brief context passed to each worker thread on creation.
+     */
+    struct WorkStealingPoolWorker
+    {
+        WorkStealingPool* pPool;
+        uint queueIndex;
+    };
+
+    static gpointer WorkStealingPoolWorkerThread(gpointer pWorker)
+    {
+        WorkStealingPoolWorker* pContext = 
+            static_cast<WorkStealingPoolWorker*>(pWorker);
+        
+        pContext->pPool->HandleWork(pContext->queueIndex);
+        
+        delete pContext;
+        return NULL;
+    }
+
+    WorkStealingPool::WorkStealingPool(uint numWorkers)
+        : m_queuedTasks(0)
+        , m_pendingTasks(0)
+        , m_stealCount(0)
+        , m_stopping(false)
+    {
+        LOG_FUNC();
+        
+        // One queue for each worker plus one for the calling thread of Run
+        for (uint i = 0; i <= numWorkers; i++)
+        {
+            m_taskQueues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue));
+        }
+        for (uint i = 0; i < numWorkers; i++)
+        {
+            WorkStealingPoolWorker* pContext = new WorkStealingPoolWorker{this, i};
+            m_workerThreads.push_back(g_thread_new(NULL, 
+                WorkStealingPoolWorkerThread, pContext));
+        }
+        LOG_INFO("Work stealing pool created with " << numWorkers << " workers");
+    }
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            m_stopping = true;
+            g_cond_broadcast(&m_workQueuedCond);
+        }
+        for (auto &ivec: m_workerThreads)
+        {
+            g_thread_join(ivec);
+        }
+    }
+
+    uint WorkStealingPool::GetNumWorkers()
+    {
+        LOG_FUNC();
+        
+        return m_workerThreads.size();
+    }
+
+    uint64_t WorkStealingPool::GetStealCount()
+    {
+        LOG_FUNC();
+        
+        return m_stealCount;
+    }
+
+    void WorkStealingPool::Run(std::vector<Task>& tasks)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_runMutex);
+        
+        if (tasks.empty())
+        {
+            return;
+        }
+        {
+            LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            m_pendingTasks = tasks.size();
+        }
+        // Distribute the tasks over all queues, round-robin
+        for (uint i = 0; i < tasks.size(); i++)
+        {
+            TaskQueue& taskQueue = *m_taskQueues[i % m_taskQueues.size()];
+            
+            LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&taskQueue.mutex);
+            taskQueue.tasks.push_back(std::move(tasks[i]));
+            m_queuedTasks++;
+        }
+        {
+            LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            g_cond_broadcast(&m_workQueuedCond);
+        }
+        
+        // The calling thread always owns the last queue.
+        uint ownQueue = m_taskQueues.size()-1;
+        Task task;
+        while (PopTask(ownQueue, task))
+        {
+            ExecuteTask(task);
+        }
+        
+        // All queues are empty, wait for the tasks still in progress.
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+        while (m_pendingTasks)
+        {
+            g_cond_wait(&m_workDoneCond, &m_poolMutex);
+        }
+    }
+
+    void WorkStealingPool::HandleWork(uint queueIndex)
+    {
+        LOG_FUNC();
+        
+        while (true)
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+                while (!m_stopping and !m_queuedTasks)
+                {
+                    g_cond_wait(&m_workQueuedCond, &m_poolMutex);
+                }
+                if (m_stopping)
+                {
+                    return;
+                }
+            }
+            Task task;
+            while (PopTask(queueIndex, task))
+            {
+                ExecuteTask(task);
+            }
+        }
+    }
+
+    bool WorkStealingPool::PopTask(uint queueIndex, Task& task)
+    {
+        // Pop from the back of our own queue first, LIFO for locality.
+        {
+            TaskQueue& ownQueue = *m_taskQueues[queueIndex];
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&ownQueue.mutex);
+            if (!ownQueue.tasks.empty())
+            {
+                task = std::move(ownQueue.tasks.back());
+                ownQueue.tasks.pop_back();
+                m_queuedTasks--;
+                return true;
+            }
+        }
+        // Then steal from the front of each of our siblings' queues.
+        for (uint i = 1; i < m_taskQueues.size(); i++)
+        {
+            TaskQueue& siblingQueue = 
+                *m_taskQueues[(queueIndex + i) % m_taskQueues.size()];
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&siblingQueue.mutex);
+            if (!siblingQueue.tasks.empty())
+            {
+                task = std::move(siblingQueue.tasks.front());
+                siblingQueue.tasks.pop_front();
+                m_queuedTasks--;
+                m_stealCount++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingPool::ExecuteTask(Task& task)
+    {
+        try
+        {
+            task();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Work stealing pool task threw exception");
+        }
+        task = nullptr;
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+        if (--m_pendingTasks == 0)
+        {
+            g_cond_broadcast(&m_workDoneCond);
+        }
+    }
+}
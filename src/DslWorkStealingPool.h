@@ -0,0 +1,179 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_WORK_STEALING_POOL_H
+#define _DSL_WORK_STEALING_POOL_H
+
+#include "Dsl.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_WORK_STEALING_POOL_PTR std::shared_ptr<WorkStealingPool>
+    #define DSL_WORK_STEALING_POOL_NEW(numWorkers) \
+        std::shared_ptr<WorkStealingPool>(new WorkStealingPool(numWorkers))
+
+    /**
+     * @class WorkStealingPool
+     * @brief Fixed size pool of worker threads, each with its own task queue.
+     * Tasks are distributed over the queues in a round-robin fashion. An idle
+     * worker pops from the back of its own queue first and then steals from
+     * the front of its siblings' queues. The thread calling Run participates
+     * as an additional worker and returns only once every task has completed.
+     */
+    class WorkStealingPool
+    {
+    public:
+
+        /**
+         * @brief Task type executed by the pool's workers.
+         */
+        typedef std::function<void()> Task;
+
+        /**
+         * @brief ctor for the WorkStealingPool class
+         * @param[in] numWorkers number of worker threads to start. The calling
+         * thread of Run is not included in this count.
+         */
+        WorkStealingPool(uint numWorkers);
+
+        /**
+         * @brief dtor for the WorkStealingPool class. Stops and joins all workers.
+         */
+        ~WorkStealingPool();
+
+        /**
+         * @brief Gets the number of worker threads owned by this pool.
+         * @return number of worker threads.
+         */
+        uint GetNumWorkers();
+
+        /**
+         * @brief Runs a set of tasks to completion. The calling thread executes
+         * tasks along with the workers. Calls to Run are serialized.
+         * @param[in] tasks set of tasks to execute. Any exception thrown by a 
+         * task is caught and logged.
+         */
+        void Run(std::vector<Task>& tasks);
+
+        /**
+         * @brief Gets the total number of tasks that were executed after being
+         * stolen from a sibling's queue, for diagnostics and testing.
+         * @return accumulated steal count.
+         */
+        uint64_t GetStealCount();
+
+        /**
+         * @brief Worker thread function, loops executing tasks until stopped.
+         * @param[in] queueIndex index of the worker's own queue.
+         */
+        void HandleWork(uint queueIndex);
+
+    private:
+
+        /**
+         * @brief pops the next task for the given queue, from the back of its
+         * own queue first and then from the front of all other queues.
+         * @param[in] queueIndex index of the calling worker's own queue.
+         * @param[out] task the popped task on success.
+         * @return true if a task was popped, false if all queues are empty.
+         */
+        bool PopTask(uint queueIndex, Task& task);
+
+        /**
+         * @brief executes a single task and signals completion if it was the
+         * last outstanding task of the current Run.
+         * @param[in] task task to execute.
+         */
+        void ExecuteTask(Task& task);
+
+        /**
+         * @struct TaskQueue
+         * @brief a single worker's queue and the mutex guarding it.
+         */
+        struct TaskQueue
+        {
+            DslMutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /**
+         * @brief one queue per worker thread, plus one for the calling thread
+         * of Run, which always owns the last queue.
+         */
+        std::vector<std::unique_ptr<TaskQueue>> m_taskQueues;
+
+        /**
+         * @brief worker threads created with g_thread_new.
+         */
+        std::vector<GThread*> m_workerThreads;
+
+        /**
+         * @brief mutex to serialize calls to Run.
+         */
+        DslMutex m_runMutex;
+
+        /**
+         * @brief mutex protecting the pool's wait/signal state below.
+         */
+        DslMutex m_poolMutex;
+
+        /**
+         * @brief condition signaled when new tasks are queued, or on stop.
+         */
+        DslCond m_workQueuedCond;
+
+        /**
+         * @brief condition signaled when all tasks of the current Run are done.
+         */
+        DslCond m_workDoneCond;
+
+        /**
+         * @brief number of tasks queued but not yet popped.
+         */
+        std::atomic<uint> m_queuedTasks;
+
+        /**
+         * @brief number of tasks for the current Run not yet completed.
+         */
+        uint m_pendingTasks;
+
+        /**
+         * @brief accumulated count of stolen tasks.
+         */
+        std::atomic<uint64_t> m_stealCount;
+
+        /**
+         * @brief set on destruction to stop all worker threads.
+         */
+        bool m_stopping;
+    };
+}
+
+#endif // _DSL_WORK_STEALING_POOL_H
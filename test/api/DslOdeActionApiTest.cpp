@@ -2568,9 +2568,61 @@ SCENARIO( "The ODE Action API checks for NULL input parameters", "[ode-action-ap
                 REQUIRE( dsl_ode_action_delete_many(NULL) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                uint max_workers(0), queue_capacity(0);
+                REQUIRE( dsl_ode_action_executor_params_get(NULL, 
+                    &queue_capacity) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_executor_params_get(&max_workers, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_executor_stats_get(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_component_list_size() == 0 );
             }
         }
     }
 }
 
+SCENARIO( "The ODE Action executor params can be updated", "[ode-action-api]" )
+{
+    GIVEN( "The default executor params" ) 
+    {
+        uint max_workers(0), queue_capacity(0);
+        REQUIRE( dsl_ode_action_executor_params_get(&max_workers, 
+            &queue_capacity) == DSL_RESULT_SUCCESS );
+        REQUIRE( max_workers == DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS );
+        REQUIRE( queue_capacity == DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY );
+
+        WHEN( "The executor params are set" )
+        {
+            REQUIRE( dsl_ode_action_executor_params_set(4, 
+                16) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct params are returned on get" )
+            {
+                REQUIRE( dsl_ode_action_executor_params_get(&max_workers, 
+                    &queue_capacity) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_workers == 4 );
+                REQUIRE( queue_capacity == 16 );
+
+                // zero workers or capacity is invalid
+                REQUIRE( dsl_ode_action_executor_params_set(0, 
+                    16) == DSL_RESULT_ODE_ACTION_SET_FAILED );
+                REQUIRE( dsl_ode_action_executor_params_set(4, 
+                    0) == DSL_RESULT_ODE_ACTION_SET_FAILED );
+
+                dsl_ode_action_executor_stats stats{0};
+                REQUIRE( dsl_ode_action_executor_stats_clear() 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_executor_stats_get(&stats) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.submitted == 0 );
+                REQUIRE( stats.rejected == 0 );
+
+                REQUIRE( dsl_ode_action_executor_params_set(
+                    DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS, 
+                    DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY) 
+                        == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
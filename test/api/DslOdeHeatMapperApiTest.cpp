@@ -134,6 +134,19 @@ SCENARIO( "A new Heat-Mapper can handle calls to its Metrics services",
             
             THEN( "The Heat-Mapper can be deleted successfully" ) 
             {
+                const uint64_t* buffer(NULL);
+                uint size(0);
+                
+                REQUIRE( dsl_ode_heat_mapper_metrics_get(
+                    ode_heat_mapper_name.c_str(), &buffer, &size) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( size == 16*9 );
+                
+                // No occurrences have been mapped, so no source maps exist yet.
+                REQUIRE( dsl_ode_heat_mapper_source_metrics_get(
+                    ode_heat_mapper_name.c_str(), 0, &buffer, &size) == 
+                    DSL_RESULT_ODE_HEAT_MAPPER_SOURCE_NOT_FOUND );
+
                 REQUIRE( dsl_ode_heat_mapper_delete(ode_heat_mapper_name.c_str()) == 
                     DSL_RESULT_SUCCESS );
                     
@@ -144,6 +157,53 @@ SCENARIO( "A new Heat-Mapper can handle calls to its Metrics services",
     }
 }    
 
+SCENARIO( "A new Heat-Mapper can Set and Get its mode correctly", 
+    "[ode-heat-mapper-api]" )
+{
+    GIVEN( "A new Heat-Mapper" ) 
+    {
+        REQUIRE( dsl_display_type_rgba_color_palette_predefined_new(
+            color_palette_name.c_str(), DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL, 
+            0.5) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_ode_heat_mapper_new(ode_heat_mapper_name.c_str(),
+            16, 9, DSL_BBOX_POINT_SOUTH, color_palette_name.c_str()) == 
+                DSL_RESULT_SUCCESS );
+
+        uint mode(99), interval(99), size(99);
+        REQUIRE( dsl_ode_heat_mapper_mode_get(ode_heat_mapper_name.c_str(),
+            &mode, &interval, &size) == DSL_RESULT_SUCCESS );
+        REQUIRE( mode == DSL_HEAT_MAP_MODE_ACCUMULATE );
+        REQUIRE( interval == 0 );
+        REQUIRE( size == 0 );
+
+        WHEN( "When the Heat-Mapper's mode is set" )
+        {
+            REQUIRE( dsl_ode_heat_mapper_mode_set(ode_heat_mapper_name.c_str(),
+                DSL_HEAT_MAP_MODE_DECAY, 30, 4) == DSL_RESULT_SUCCESS );
+            
+            // invalid settings must fail
+            REQUIRE( dsl_ode_heat_mapper_mode_set(ode_heat_mapper_name.c_str(),
+                DSL_HEAT_MAP_MODE_WINDOW, 0, 4) == 
+                    DSL_RESULT_ODE_HEAT_MAPPER_SET_FAILED );
+            
+            THEN( "The correct mode is returned on get" ) 
+            {
+                REQUIRE( dsl_ode_heat_mapper_mode_get(ode_heat_mapper_name.c_str(),
+                    &mode, &interval, &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_HEAT_MAP_MODE_DECAY );
+                REQUIRE( interval == 30 );
+                REQUIRE( size == 4 );
+
+                REQUIRE( dsl_ode_heat_mapper_delete(ode_heat_mapper_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_heat_mapper_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The ODE Heat-Mapper API checks for NULL input parameters", "[ode-heat-mapper-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -176,10 +236,22 @@ SCENARIO( "The ODE Heat-Mapper API checks for NULL input parameters", "[ode-heat
                 REQUIRE( dsl_ode_heat_mapper_legend_settings_get(NULL, 
                     0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
                     
+                REQUIRE( dsl_ode_heat_mapper_mode_get(NULL, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_mode_get(ode_heat_mapper_name.c_str(), 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_mode_set(NULL, 
+                    0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                    
                 REQUIRE( dsl_ode_heat_mapper_metrics_get(ode_heat_mapper_name.c_str(), 
                     NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_heat_mapper_metrics_get(NULL,
                     NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_source_metrics_get(
+                    ode_heat_mapper_name.c_str(), 0, NULL, NULL ) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_source_metrics_get(NULL,
+                    0, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_heat_mapper_metrics_clear(NULL) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
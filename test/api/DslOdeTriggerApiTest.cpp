@@ -312,6 +312,37 @@ SCENARIO( "An ODE Trigger's Auto-Reset Timeout setting can be set/get", "[ode-tr
     }
 }    
 
+SCENARIO( "An ODE Trigger's aggregate counts can be queried", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint class_id(9);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The ODE Trigger is reset" )         
+        {
+            REQUIRE( dsl_ode_trigger_reset(odeTriggerName.c_str()) == 
+                DSL_RESULT_SUCCESS );
+            
+            THEN( "All counts are returned as 0" ) 
+            {
+                uint64_t events(99), frames(99), accumulated(99);
+                REQUIRE( dsl_ode_trigger_counts_get(odeTriggerName.c_str(), 
+                    &events, &frames, &accumulated) == DSL_RESULT_SUCCESS );
+                REQUIRE( events == 0 );
+                REQUIRE( frames == 0 );
+                REQUIRE( accumulated == 0 );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "An ODE Trigger's Inference Name can be set/get", "[ode-trigger-api]" )
 {
     GIVEN( "An ODE Trigger" ) 
@@ -1887,6 +1918,8 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                 REQUIRE( dsl_ode_trigger_new_high_new(NULL, NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_trigger_reset(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_counts_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_counts_get(triggerName.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_limit_state_change_listener_add(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_limit_state_change_listener_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
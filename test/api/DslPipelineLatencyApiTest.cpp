@@ -0,0 +1,303 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+static void latency_report_handler_cb(const wchar_t** components,
+    uint* pads, dsl_latency_stats* point_stats, uint point_count, 
+    dsl_latency_stats* total_stats, void* client_data)
+{
+}
+
+static const std::wstring pipelineName(L"test-pipeline");
+static const std::wstring sinkName(L"fake-sink");
+static const std::wstring otherName(L"other-sink");
+
+SCENARIO( "A Latency Point can be added to and removed from a Pipeline", 
+    "[pipeline-latency-api]" )
+{
+    GIVEN( "A Pipeline and a component" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        dsl_latency_stats stats;
+        REQUIRE( dsl_pipeline_latency_point_stats_get(pipelineName.c_str(),
+            sinkName.c_str(), DSL_PAD_SINK, &stats) == 
+            DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND );
+
+        WHEN( "A Latency Point is added to the component" )
+        {
+            REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+                sinkName.c_str(), DSL_PAD_SINK, false) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same Latency Point can't be added twice and can be removed" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+                    sinkName.c_str(), DSL_PAD_SINK, false) == 
+                    DSL_RESULT_PIPELINE_LATENCY_POINT_ADD_FAILED );
+
+                REQUIRE( dsl_pipeline_latency_point_stats_get(pipelineName.c_str(),
+                    sinkName.c_str(), DSL_PAD_SINK, &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.count == 0 );
+
+                REQUIRE( dsl_pipeline_latency_point_remove(pipelineName.c_str(),
+                    sinkName.c_str(), DSL_PAD_SINK) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_latency_point_remove(pipelineName.c_str(),
+                    sinkName.c_str(), DSL_PAD_SINK) == 
+                    DSL_RESULT_PIPELINE_LATENCY_POINT_REMOVE_FAILED );
+                    
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An invalid pad is used" )
+        {
+            THEN( "The Latency Point can't be added" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+                    sinkName.c_str(), DSL_PAD_SRC+1, false) == 
+                    DSL_RESULT_PPH_PAD_TYPE_INVALID );
+                REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+                    otherName.c_str(), DSL_PAD_SINK, false) == 
+                    DSL_RESULT_COMPONENT_NAME_NOT_FOUND );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Latency Point can measure from an explicit previous Latency Point", 
+    "[pipeline-latency-api]" )
+{
+    GIVEN( "A Pipeline with two branches of Latency Points" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(otherName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+            pipelineName.c_str(), DSL_PAD_SRC, false) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+            sinkName.c_str(), DSL_PAD_SINK, true) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(),
+            otherName.c_str(), DSL_PAD_SINK, true) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The second branch measures from the Streammuxer" )
+        {
+            REQUIRE( dsl_pipeline_latency_point_previous_set(
+                pipelineName.c_str(), otherName.c_str(), DSL_PAD_SINK,
+                pipelineName.c_str(), DSL_PAD_SRC) == DSL_RESULT_SUCCESS );
+
+            THEN( "Terminal and later points can't be used as the previous point" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_point_previous_set(
+                    pipelineName.c_str(), otherName.c_str(), DSL_PAD_SINK,
+                    sinkName.c_str(), DSL_PAD_SINK) == 
+                    DSL_RESULT_PIPELINE_SET_FAILED );
+                REQUIRE( dsl_pipeline_latency_point_previous_set(
+                    pipelineName.c_str(), pipelineName.c_str(), DSL_PAD_SRC,
+                    otherName.c_str(), DSL_PAD_SINK) == 
+                    DSL_RESULT_PIPELINE_SET_FAILED );
+                REQUIRE( dsl_pipeline_latency_point_previous_set(
+                    pipelineName.c_str(), otherName.c_str(), DSL_PAD_SRC,
+                    pipelineName.c_str(), DSL_PAD_SRC) == 
+                    DSL_RESULT_PIPELINE_LATENCY_POINT_NOT_FOUND );
+                    
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The previous Latency Point is removed" )
+        {
+            REQUIRE( dsl_pipeline_latency_point_previous_set(
+                pipelineName.c_str(), otherName.c_str(), DSL_PAD_SINK,
+                pipelineName.c_str(), DSL_PAD_SRC) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_latency_point_remove(pipelineName.c_str(),
+                pipelineName.c_str(), DSL_PAD_SRC) == DSL_RESULT_SUCCESS );
+
+            THEN( "The previous Latency Point can't be set to it" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_point_previous_set(
+                    pipelineName.c_str(), otherName.c_str(), DSL_PAD_SINK,
+                    pipelineName.c_str(), DSL_PAD_SRC) == 
+                    DSL_RESULT_PIPELINE_SET_FAILED );
+                    
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's Latency settings and stats can be updated", 
+    "[pipeline-latency-api]" )
+{
+    GIVEN( "A Pipeline with latency tracing enabled by default" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(false);
+        REQUIRE( dsl_pipeline_latency_enabled_get(pipelineName.c_str(),
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == true );
+
+        WHEN( "Latency tracing is disabled" )
+        {
+            REQUIRE( dsl_pipeline_latency_enabled_set(pipelineName.c_str(),
+                false) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct settings and stats are returned" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_enabled_get(pipelineName.c_str(),
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                dsl_latency_stats stats;
+                REQUIRE( dsl_pipeline_latency_total_stats_get(pipelineName.c_str(),
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.count == 0 );
+                REQUIRE( dsl_pipeline_latency_stats_clear(pipelineName.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Latency report handler can be added and removed", 
+    "[pipeline-latency-api]" )
+{
+    GIVEN( "A Pipeline in memory" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A Latency report handler is added" )
+        {
+            REQUIRE( dsl_pipeline_latency_report_handler_add(pipelineName.c_str(),
+                latency_report_handler_cb, 1, NULL) == DSL_RESULT_SUCCESS );
+
+            // calling a second time must fail
+            REQUIRE( dsl_pipeline_latency_report_handler_add(pipelineName.c_str(),
+                latency_report_handler_cb, 1, NULL) == 
+                DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+
+            THEN( "The same handler can be removed" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_report_handler_remove(
+                    pipelineName.c_str(), latency_report_handler_cb) == 
+                    DSL_RESULT_SUCCESS );
+                
+                // second call must fail
+                REQUIRE( dsl_pipeline_latency_report_handler_remove(
+                    pipelineName.c_str(), latency_report_handler_cb) == 
+                    DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED );
+                    
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A reporting interval of 0 is used" )
+        {
+            THEN( "The handler can't be added" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_report_handler_add(
+                    pipelineName.c_str(), latency_report_handler_cb, 0, NULL) == 
+                    DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+                    
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline Latency API checks for NULL input parameters", 
+    "[pipeline-latency-api]" )
+{
+    GIVEN( "An empty list of Pipelines" ) 
+    {
+        boolean enabled(0);
+        dsl_latency_stats stats;
+        
+        REQUIRE( dsl_pipeline_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_point_add(NULL, 
+                    sinkName.c_str(), DSL_PAD_SINK, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_add(pipelineName.c_str(), 
+                    NULL, DSL_PAD_SINK, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_previous_set(NULL, 
+                    sinkName.c_str(), DSL_PAD_SINK, otherName.c_str(), 
+                    DSL_PAD_SINK) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_previous_set(
+                    pipelineName.c_str(), NULL, DSL_PAD_SINK, otherName.c_str(), 
+                    DSL_PAD_SINK) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_previous_set(
+                    pipelineName.c_str(), sinkName.c_str(), DSL_PAD_SINK, NULL, 
+                    DSL_PAD_SINK) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_remove(NULL, 
+                    sinkName.c_str(), DSL_PAD_SINK) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_remove(pipelineName.c_str(), 
+                    NULL, DSL_PAD_SINK) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_enabled_get(NULL, 
+                    &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_enabled_get(pipelineName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_enabled_set(NULL, 
+                    true) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_stats_get(NULL, 
+                    sinkName.c_str(), DSL_PAD_SINK, &stats) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_stats_get(pipelineName.c_str(), 
+                    NULL, DSL_PAD_SINK, &stats) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_point_stats_get(pipelineName.c_str(), 
+                    sinkName.c_str(), DSL_PAD_SINK, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_total_stats_get(NULL, 
+                    &stats) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_total_stats_get(pipelineName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_stats_clear(NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_report_handler_add(NULL, 
+                    latency_report_handler_cb, 1, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_report_handler_add(pipelineName.c_str(), 
+                    NULL, 1, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_report_handler_remove(NULL, 
+                    latency_report_handler_cb) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_latency_report_handler_remove(
+                    pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
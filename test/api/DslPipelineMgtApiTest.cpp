@@ -144,3 +144,144 @@ SCENARIO( "A non-unique Pipeline name fails when creating Many Pipelines", "[Pip
         REQUIRE( dsl_pipeline_list_size() == 0 );
     }
 }
+
+static const std::wstring pipelineSpec(
+    L"{"
+    L"  \"name\": \"test-pipeline\","
+    L"  \"components\": ["
+    L"    {\"name\": \"file-source\", \"type\": \"source-file\","
+    L"      \"file-path\": \"/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4\"},"
+    L"    {\"name\": \"tiler\", \"type\": \"tiler\", \"width\": 1280, \"height\": 720},"
+    L"    {\"name\": \"osd\", \"type\": \"osd\", \"clock-enabled\": true},"
+    L"    {\"name\": \"fake-sink\", \"type\": \"sink-fake\"},"
+    L"    {\"name\": \"ode-handler\", \"type\": \"pph-ode\", \"add-to\": \"osd\", \"pad\": \"sink\"}"
+    L"  ]"
+    L"}");
+
+SCENARIO( "A Pipeline is created from a JSON spec correctly", "[PipelineMgt]" )
+{
+    GIVEN( "A valid Pipeline spec" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+
+        REQUIRE( dsl_pipeline_list_size() == 0 );
+        REQUIRE( dsl_component_list_size() == 0 );
+        REQUIRE( dsl_pph_list_size() == 0 );
+
+        WHEN( "A new Pipeline is created from the spec" ) 
+        {
+            REQUIRE( dsl_pipeline_new_from_spec(pipelineSpec.c_str()) == 
+                DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline, its components, and startup timings are created" ) 
+            {
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                REQUIRE( dsl_component_list_size() == 4 );
+                REQUIRE( dsl_pph_list_size() == 1 );
+
+                const dsl_component_startup_timing* timings(NULL);
+                uint size(0);
+                REQUIRE( dsl_pipeline_startup_timings_get(pipelineName.c_str(), 
+                    &timings, &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( size == 6 );
+                REQUIRE( std::wstring(timings[0].name) == pipelineName );
+                REQUIRE( std::wstring(timings[5].name) == L"ode-handler" );
+                
+                // Not linked or played yet.
+                for (uint i = 0; i < size; i++)
+                {
+                    REQUIRE( timings[i].link_us == 0 );
+                    REQUIRE( timings[i].state_change_us == 0 );
+                }
+            }
+        }
+        REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+    }
+}
+
+SCENARIO( "An invalid JSON spec fails to create a Pipeline", "[PipelineMgt]" )
+{
+    GIVEN( "A set of invalid Pipeline specs" ) 
+    {
+        std::wstring notJson(L"{\"name\": \"test-pipeline\", ");
+        std::wstring noComponents(L"{\"name\": \"test-pipeline\"}");
+        std::wstring badType(
+            L"{\"name\": \"test-pipeline\", \"components\": ["
+            L"{\"name\": \"fake-sink\", \"type\": \"sink-unknown\"}]}");
+        std::wstring badNameType(
+            L"{\"name\": 1, \"components\": []}");
+        std::wstring badComponentsType(
+            L"{\"name\": \"test-pipeline\", \"components\": \"fake-sink\"}");
+        std::wstring badUintType(
+            L"{\"name\": \"test-pipeline\", \"components\": ["
+            L"{\"name\": \"tiler\", \"type\": \"tiler\", "
+            L"\"width\": \"1280\", \"height\": 720}]}");
+        std::wstring negativeUint(
+            L"{\"name\": \"test-pipeline\", \"components\": ["
+            L"{\"name\": \"tiler\", \"type\": \"tiler\", "
+            L"\"width\": -1280, \"height\": 720}]}");
+        std::wstring badBooleanType(
+            L"{\"name\": \"test-pipeline\", \"components\": ["
+            L"{\"name\": \"uri-source\", \"type\": \"source-uri\", "
+            L"\"uri\": \"./test/streams/sample_1080p_h264.mp4\", "
+            L"\"is-live\": \"false\"}]}");
+        std::wstring badNamesType(
+            L"{\"name\": \"test-pipeline\", \"components\": ["
+            L"{\"name\": \"branch\", \"type\": \"branch\", "
+            L"\"components\": [1, 2]}]}");
+
+        WHEN( "Each invalid spec is used to create a Pipeline" ) 
+        {
+            REQUIRE( dsl_pipeline_new_from_spec(notJson.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(noComponents.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(badType.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(badNameType.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(badComponentsType.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(badUintType.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(negativeUint.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(badBooleanType.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+            REQUIRE( dsl_pipeline_new_from_spec(badNamesType.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+
+            THEN( "No Pipeline or components are created" ) 
+            {
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A failed component add from a JSON spec deletes all components", "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline spec with a Pad Probe Handler added to a missing component" ) 
+    {
+        std::wstring spec(
+            L"{\"name\": \"test-pipeline\", \"components\": ["
+            L"{\"name\": \"fake-sink\", \"type\": \"sink-fake\"},"
+            L"{\"name\": \"ode-handler\", \"type\": \"pph-ode\", \"add-to\": \"osd\"}]}");
+
+        WHEN( "The spec is used to create a Pipeline" ) 
+        {
+            REQUIRE( dsl_pipeline_new_from_spec(spec.c_str()) == 
+                DSL_RESULT_PIPELINE_SPEC_INVALID );
+
+            THEN( "All components created from the spec are deleted" ) 
+            {
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -108,6 +108,114 @@ SCENARIO( "A ODE Handler's Enabled Setting can be disabled and re-enabled", "[pp
     }
 }
 
+SCENARIO( "A ODE Handler's Parallel Mode can be enabled and disabled", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with Parallel Mode disabled by default" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        uint workers(99);
+        REQUIRE( dsl_pph_ode_parallel_mode_get(odePphName.c_str(), 
+            &enabled, &workers) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        
+        WHEN( "The ODE Handler's Parallel Mode is enabled" ) 
+        {
+            REQUIRE( dsl_pph_ode_parallel_mode_set(odePphName.c_str(), 
+                true, 3) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct settings are returned" ) 
+            {
+                REQUIRE( dsl_pph_ode_parallel_mode_get(odePphName.c_str(), 
+                    &enabled, &workers) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( workers == 3 );
+
+                REQUIRE( dsl_pph_ode_parallel_mode_set(odePphName.c_str(), 
+                    false, 3) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(odePphName.c_str(), 
+                    &enabled, &workers) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+static void budget_overrun_handler_cb(uint source_id, uint frame_num,
+    uint64_t duration, uint budget, void* client_data)
+{
+}
+
+SCENARIO( "A ODE Handler's Stats can be enabled and queried", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with Stats disabled by default" ) 
+    {
+        std::wstring odePphName(L"pph");
+        std::wstring triggerName(L"occurrence");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pph_ode_stats_enabled_get(odePphName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        
+        uint budget(99);
+        REQUIRE( dsl_pph_ode_stats_budget_get(odePphName.c_str(), 
+            &budget) == DSL_RESULT_SUCCESS );
+        REQUIRE( budget == 0 );
+        
+        WHEN( "The ODE Handler's Stats are enabled" ) 
+        {
+            REQUIRE( dsl_pph_ode_stats_enabled_set(odePphName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The stats can be queried and cleared" ) 
+            {
+                REQUIRE( dsl_pph_ode_stats_enabled_get(odePphName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+
+                dsl_latency_stats stats;
+                REQUIRE( dsl_pph_ode_stats_frame_get(odePphName.c_str(), 
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.count == 0 );
+                
+                // nothing recorded until the Trigger is called.
+                REQUIRE( dsl_pph_ode_stats_trigger_get(odePphName.c_str(), 
+                    triggerName.c_str(), DSL_PPH_ODE_STATS_PHASE_CHECK, 
+                    &stats) == DSL_RESULT_PPH_STATS_NOT_FOUND );
+                REQUIRE( dsl_pph_ode_stats_action_get(odePphName.c_str(), 
+                    L"action", &stats) == DSL_RESULT_PPH_STATS_NOT_FOUND );
+                
+                REQUIRE( dsl_pph_ode_stats_clear(odePphName.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The ODE Handler's frame budget is set" ) 
+        {
+            REQUIRE( dsl_pph_ode_stats_budget_set(odePphName.c_str(), 
+                5000, budget_overrun_handler_cb, NULL) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct budget is returned" ) 
+            {
+                REQUIRE( dsl_pph_ode_stats_budget_get(odePphName.c_str(), 
+                    &budget) == DSL_RESULT_SUCCESS );
+                REQUIRE( budget == 5000 );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new ODE Handler can Add and Remove a ODE Trigger", "[pph-api]" )
 {
     GIVEN( "A new ODE Handler and new ODE Trigger" ) 
@@ -217,6 +325,100 @@ SCENARIO( "A Buffer Timeout Pad Probe Handler can be created and deleted", "[pph
     }
 }
 
+static boolean meter_stats_handler_cb(dsl_meter_source_stats* stats, 
+    uint source_count, void* client_data)
+{
+    return true;
+}
+
+SCENARIO( "A Meter Pad Probe Handler with Stats Handler can be created and deleted", 
+    "[pph-api]" )
+{
+    GIVEN( "Atributes for a new Meter Pad Probe Handler" ) 
+    {
+        std::wstring meterPphName(L"meter-pph");
+        uint interval(1);
+
+        REQUIRE( dsl_pph_list_size() == 0 );
+
+        WHEN( "The PPH is created" ) 
+        {
+            REQUIRE( dsl_pph_meter_stats_new(meterPphName.c_str(),
+                interval, meter_stats_handler_cb, NULL) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pph_list_size() == 1 );
+
+            // second call must fail
+            REQUIRE( dsl_pph_meter_stats_new(meterPphName.c_str(),
+                interval, meter_stats_handler_cb, NULL) == 
+                DSL_RESULT_PPH_NAME_NOT_UNIQUE );
+            
+            uint retInterval(0);
+            REQUIRE( dsl_pph_meter_interval_get(meterPphName.c_str(), 
+                &retInterval) == DSL_RESULT_SUCCESS );
+            REQUIRE( retInterval == interval );
+            
+            THEN( "The PPH can then be deleted" )
+            {
+                REQUIRE( dsl_pph_delete(meterPphName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+        WHEN( "The PPH is created with an interval of 0" ) 
+        {
+            THEN( "The constructor fails" )
+            {
+                REQUIRE( dsl_pph_meter_stats_new(meterPphName.c_str(),
+                    0, meter_stats_handler_cb, NULL) == 
+                    DSL_RESULT_PPH_METER_INVALID_INTERVAL );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Meter Pad Probe Handler's Stall Threshold can be updated", "[pph-api]" )
+{
+    GIVEN( "A new Meter Pad Probe Handler" ) 
+    {
+        std::wstring meterPphName(L"meter-pph");
+
+        REQUIRE( dsl_pph_meter_stats_new(meterPphName.c_str(),
+            1, meter_stats_handler_cb, NULL) == DSL_RESULT_SUCCESS );
+
+        uint threshold(0);
+        REQUIRE( dsl_pph_meter_stall_threshold_get(meterPphName.c_str(), 
+            &threshold) == DSL_RESULT_SUCCESS );
+        REQUIRE( threshold == DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS );
+
+        WHEN( "The Stall Threshold is updated" ) 
+        {
+            REQUIRE( dsl_pph_meter_stall_threshold_set(meterPphName.c_str(), 
+                250) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( dsl_pph_meter_stall_threshold_get(meterPphName.c_str(), 
+                    &threshold) == DSL_RESULT_SUCCESS );
+                REQUIRE( threshold == 250 );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The Stall Threshold is set to 0" ) 
+        {
+            REQUIRE( dsl_pph_meter_stall_threshold_set(meterPphName.c_str(), 
+                0) == DSL_RESULT_PPH_SET_FAILED );
+
+            THEN( "The threshold is unchanged" )
+            {
+                REQUIRE( dsl_pph_meter_stall_threshold_get(meterPphName.c_str(), 
+                    &threshold) == DSL_RESULT_SUCCESS );
+                REQUIRE( threshold == DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 static uint eos_handler_cb(void* client_data)
 {
     return DSL_PAD_PROBE_DROP;
@@ -370,6 +572,32 @@ SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-ap
                 REQUIRE( dsl_pph_ode_trigger_remove_many(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_many(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_all(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(NULL, 
+                    &enabled, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(pphName.c_str(), 
+                    NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(pphName.c_str(), 
+                    &enabled, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_set(NULL, 
+                    true, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_enabled_get(NULL, 
+                    &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_enabled_get(pphName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_enabled_set(NULL, 
+                    true) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_trigger_get(pphName.c_str(), 
+                    NULL, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_action_get(pphName.c_str(), 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_frame_get(pphName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_clear(NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_budget_get(pphName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_budget_set(pphName.c_str(), 
+                    5000, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_pph_custom_new(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_custom_new(pphName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -378,6 +606,11 @@ SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-ap
 
                 REQUIRE( dsl_pph_meter_interval_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_meter_interval_set(NULL, interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stats_new(NULL, 1, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stats_new(pphName.c_str(), 1, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stall_threshold_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stall_threshold_get(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stall_threshold_set(NULL, 1) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_pph_buffer_timeout_new(NULL, 1, NULL, NULL) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
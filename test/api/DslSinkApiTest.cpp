@@ -163,6 +163,238 @@ SCENARIO( "An App Sink can update its data-type setting correctly", "[sink-api]"
     }
 }    
 
+SCENARIO( "An App Sink can update its delivery settings correctly", "[sink-api]" )
+{
+    GIVEN( "A new App Sink Component" ) 
+    {
+        std::wstring sink_name = L"app-sink";
+        uint queue_size(99), policy(99), batch_size(99);
+        
+        REQUIRE( dsl_sink_app_new(sink_name.c_str(), DSL_SINK_APP_DATA_TYPE_BUFFER, 
+            new_buffer_cb, NULL) == DSL_RESULT_SUCCESS );
+
+        // Check the intial values - synchronous delivery
+        REQUIRE( dsl_sink_app_delivery_settings_get(sink_name.c_str(), 
+            &queue_size, &policy, &batch_size) == DSL_RESULT_SUCCESS );
+        REQUIRE( queue_size == 0 );
+        REQUIRE( policy == DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST );
+        REQUIRE( batch_size == 1 );
+
+        WHEN( "The App Sink's delivery settings are updated" ) 
+        {
+            REQUIRE( dsl_sink_app_delivery_settings_set(sink_name.c_str(), 
+                16, DSL_SINK_APP_DELIVERY_POLICY_DROP_NEWEST, 4) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_sink_app_delivery_settings_get(sink_name.c_str(), 
+                    &queue_size, &policy, &batch_size) == DSL_RESULT_SUCCESS );
+                REQUIRE( queue_size == 16 );
+                REQUIRE( policy == DSL_SINK_APP_DELIVERY_POLICY_DROP_NEWEST );
+                REQUIRE( batch_size == 4 );
+                
+                dsl_sink_app_delivery_stats stats{0};
+                REQUIRE( dsl_sink_app_delivery_stats_get(sink_name.c_str(), 
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.received == 0 );
+                REQUIRE( stats.dropped == 0 );
+                REQUIRE( dsl_sink_app_delivery_stats_clear(
+                    sink_name.c_str()) == DSL_RESULT_SUCCESS );
+                    
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "Invalid delivery settings are provided" ) 
+        {
+            THEN( "The set delivery settings service must fail" ) 
+            {
+                REQUIRE( dsl_sink_app_delivery_settings_set(sink_name.c_str(), 
+                    16, DSL_SINK_APP_DELIVERY_POLICY_BLOCK+1, 1) 
+                        == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_app_delivery_settings_set(sink_name.c_str(), 
+                    16, DSL_SINK_APP_DELIVERY_POLICY_BLOCK, 0) 
+                        == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_app_delivery_settings_set(sink_name.c_str(), 
+                    0, DSL_SINK_APP_DELIVERY_POLICY_BLOCK, 4) 
+                        == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "The Components container is updated correctly on new and delete Shared Memory Sink", 
+    "[sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sink_name(L"shm-sink");
+        std::wstring shm_name(L"/dsl-test-shm-sink");
+        std::wstring buffer_out_format(L"RGBA");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Shared Memory Sink is created" ) 
+        {
+            REQUIRE( dsl_sink_shm_new(sink_name.c_str(), shm_name.c_str(),
+                DSL_SINK_SHM_DATA_TYPE_FRAMES, buffer_out_format.c_str(),
+                320, 240, 4) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size is updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                
+                // second call with the same name must fail
+                REQUIRE( dsl_sink_shm_new(sink_name.c_str(), shm_name.c_str(),
+                    DSL_SINK_SHM_DATA_TYPE_FRAMES, buffer_out_format.c_str(),
+                    320, 240, 4) == DSL_RESULT_SINK_NAME_NOT_UNIQUE );
+                
+                dsl_shm_sink_stats stats{0};
+                REQUIRE( dsl_sink_shm_stats_get(sink_name.c_str(), 
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.num_slots == 4 );
+                REQUIRE( stats.readers == 0 );
+                REQUIRE( stats.frames_written == 0 );
+                REQUIRE( dsl_sink_shm_stats_clear(
+                    sink_name.c_str()) == DSL_RESULT_SUCCESS );
+                    
+                REQUIRE( dsl_component_delete(sink_name.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "A second Shared Memory Sink uses the same shared-memory name" ) 
+        {
+            REQUIRE( dsl_sink_shm_new(sink_name.c_str(), shm_name.c_str(),
+                DSL_SINK_SHM_DATA_TYPE_FRAMES, buffer_out_format.c_str(),
+                320, 240, 4) == DSL_RESULT_SUCCESS );
+
+            THEN( "The in-use ring is not taken over" ) 
+            {
+                REQUIRE( dsl_sink_shm_new(L"other-shm-sink", shm_name.c_str(),
+                    DSL_SINK_SHM_DATA_TYPE_FRAMES, buffer_out_format.c_str(),
+                    320, 240, 4) == DSL_RESULT_SINK_THREW_EXCEPTION );
+                REQUIRE( dsl_component_list_size() == 1 );
+                
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "Invalid Shared Memory Sink attributes are provided" ) 
+        {
+            THEN( "The new Shared Memory Sink service must fail" ) 
+            {
+                REQUIRE( dsl_sink_shm_new(sink_name.c_str(), shm_name.c_str(),
+                    DSL_SINK_SHM_DATA_TYPE_FRAMES+1, buffer_out_format.c_str(),
+                    320, 240, 4) == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_shm_new(sink_name.c_str(), shm_name.c_str(),
+                    DSL_SINK_SHM_DATA_TYPE_FRAMES, buffer_out_format.c_str(),
+                    320, 240, 0) == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "The Shared Memory Sink stats services are called on another Sink" ) 
+        {
+            REQUIRE( dsl_sink_fake_new(sink_name.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "The services must fail" ) 
+            {
+                dsl_shm_sink_stats stats{0};
+                REQUIRE( dsl_sink_shm_stats_get(sink_name.c_str(), 
+                    &stats) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_sink_shm_stats_clear(
+                    sink_name.c_str()) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "The Components container is updated correctly on new and delete Metadata Export Sink", 
+    "[sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sink_name(L"meta-export-sink");
+        std::wstring location(L"./meta-export-sink.bin");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Metadata Export Sink is created" ) 
+        {
+            REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                DSL_SINK_META_EXPORT_TRANSPORT_FILE, location.c_str(),
+                0, 16) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size is updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                
+                // second call with the same name must fail
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, location.c_str(),
+                    0, 16) == DSL_RESULT_SINK_NAME_NOT_UNIQUE );
+                
+                dsl_meta_export_sink_stats stats{0};
+                REQUIRE( dsl_sink_meta_export_stats_get(sink_name.c_str(), 
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.queue_depth == 0 );
+                REQUIRE( stats.records_written == 0 );
+                REQUIRE( dsl_sink_meta_export_stats_clear(
+                    sink_name.c_str()) == DSL_RESULT_SUCCESS );
+                    
+                REQUIRE( dsl_component_delete(sink_name.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "Invalid Metadata Export Sink attributes are provided" ) 
+        {
+            THEN( "The new Metadata Export Sink service must fail" ) 
+            {
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_TCP+1, location.c_str(),
+                    0, 16) == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, location.c_str(),
+                    0, 0) == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, location.c_str(),
+                    DSL_META_EXPORT_MAX_COMPRESSION_LEVEL+1, 16) 
+                        == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+                    L"./non-existent-dir/meta-export-sink.bin",
+                    0, 16) == DSL_RESULT_SINK_THREW_EXCEPTION );
+#if BUILD_WITH_ZSTD != true
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, location.c_str(),
+                    3, 16) == DSL_RESULT_API_NOT_SUPPORTED );
+#endif
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "The Metadata Export Sink stats services are called on another Sink" ) 
+        {
+            REQUIRE( dsl_sink_fake_new(sink_name.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "The services must fail" ) 
+            {
+                dsl_meta_export_sink_stats stats{0};
+                REQUIRE( dsl_sink_meta_export_stats_get(sink_name.c_str(), 
+                    &stats) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_sink_meta_export_stats_clear(
+                    sink_name.c_str()) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The Components container is updated correctly on new and delete Frame-Capture Sink", "[sink-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -2854,6 +3086,42 @@ SCENARIO( "The Sink API checks for NULL input parameters", "[sink-api]" )
                     == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_app_new(sink_name.c_str(), 0, NULL, NULL) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_delivery_settings_get(NULL, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_delivery_settings_get(sink_name.c_str(), 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_delivery_settings_set(NULL, 
+                    0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_delivery_stats_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_delivery_stats_get(sink_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_delivery_stats_clear(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_sink_shm_new(NULL, NULL, 0, NULL, 0, 0, 0) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shm_new(sink_name.c_str(), NULL, 0, NULL, 
+                    0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shm_new(sink_name.c_str(), otherName.c_str(), 
+                    0, NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shm_stats_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shm_stats_get(sink_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shm_stats_clear(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_sink_meta_export_new(NULL, 0, NULL, 0, 0) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 0, NULL, 
+                    0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_export_stats_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_export_stats_get(sink_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_export_stats_clear(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_sink_fake_new(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 
@@ -532,6 +532,22 @@ SCENARIO( "An App Source can update its settings correctly", "[source-api]" )
                     &ret_max_bytes) == DSL_RESULT_SUCCESS );
                 REQUIRE( ret_max_bytes == max_bytes ); 
 
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The App Source's buffer-pool-size setting is set" ) 
+        {
+            uint pool_size(8);
+            REQUIRE( dsl_source_app_buffer_pool_size_set(source_name.c_str(),
+                pool_size) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                uint ret_pool_size(0);
+                REQUIRE( dsl_source_app_buffer_pool_size_get(source_name.c_str(),
+                    &ret_pool_size) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_pool_size == pool_size ); 
+
                 REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
             }
         }
@@ -718,7 +734,243 @@ SCENARIO( "A new App Source fails to push-buffer and EOS when in a unlinked stat
                 REQUIRE( dsl_source_app_eos(source_name.c_str()) 
                     == DSL_RESULT_SOURCE_SET_FAILED );
 
+                void* buffers[1] = {(void*)fake_buffer.c_str()};
+                REQUIRE( dsl_source_app_buffers_push(source_name.c_str(),
+                    buffers, 1) == DSL_RESULT_SOURCE_SET_FAILED );
+
+                void* buffer(NULL);
+                void* data(NULL);
+                uint64_t size(0);
+                REQUIRE( dsl_source_app_buffer_pool_acquire(source_name.c_str(),
+                    &buffer, &data, &size) == DSL_RESULT_SOURCE_SET_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A new Shared Memory Source returns the correct attribute values",
+    "[source-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        REQUIRE( dsl_component_list_size() == 0 );
+        
+        std::wstring shm_name(L"/dsl-test-shm-source");
+        uint num_slots(4);
+
+        WHEN( "A new Shared Memory Source is created" ) 
+        {
+            REQUIRE( dsl_source_shm_new(source_name.c_str(), shm_name.c_str(),
+                buffer_in_format.c_str(), width, height, fps_n, fps_d,
+                num_slots) == DSL_RESULT_SUCCESS );
+
+            // second call with the same name must fail
+            REQUIRE( dsl_source_shm_new(source_name.c_str(), shm_name.c_str(),
+                buffer_in_format.c_str(), width, height, fps_n, fps_d,
+                num_slots) == DSL_RESULT_SOURCE_NAME_NOT_UNIQUE );
+
+            THEN( "All default attributes are returned correctly" ) 
+            {
+                uint ret_width(0), ret_height(0);
+                REQUIRE( dsl_source_video_dimensions_get(source_name.c_str(), 
+                    &ret_width, &ret_height) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_width == width );
+                REQUIRE( ret_height == height );
+                REQUIRE( dsl_source_is_live(source_name.c_str()) == TRUE );
+
+                dsl_shm_source_stats stats{0};
+                REQUIRE( dsl_source_shm_stats_get(source_name.c_str(),
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.num_slots == num_slots );
+                REQUIRE( stats.occupied == 0 );
+                REQUIRE( stats.producer_attached == FALSE );
+                REQUIRE( stats.frames_received == 0 );
+                REQUIRE( dsl_source_shm_stats_clear(
+                    source_name.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "A second Shared Memory Source uses the same shared-memory name" ) 
+        {
+            REQUIRE( dsl_source_shm_new(source_name.c_str(), shm_name.c_str(),
+                buffer_in_format.c_str(), width, height, fps_n, fps_d,
+                num_slots) == DSL_RESULT_SUCCESS );
+
+            THEN( "The in-use ring is not taken over" ) 
+            {
+                REQUIRE( dsl_source_shm_new(source_name1.c_str(), 
+                    shm_name.c_str(), buffer_in_format.c_str(), width, height, 
+                    fps_n, fps_d, num_slots) == DSL_RESULT_SOURCE_THREW_EXCEPTION );
+                REQUIRE( dsl_component_list_size() == 1 );
+
+                dsl_shm_source_stats stats{0};
+                REQUIRE( dsl_source_shm_stats_get(source_name.c_str(),
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.num_slots == num_slots );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A new Shared Memory Source is created with zero slots" ) 
+        {
+            REQUIRE( dsl_source_shm_new(source_name.c_str(), shm_name.c_str(),
+                buffer_in_format.c_str(), width, height, fps_n, fps_d,
+                0) == DSL_RESULT_SOURCE_SET_FAILED );
+
+            THEN( "The Source is not created" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "The stats services are called with the wrong Source type" ) 
+        {
+            REQUIRE( dsl_source_app_new(source_name.c_str(), is_live, 
+                buffer_in_format.c_str(), width, height, 
+                fps_n, fps_d) == DSL_RESULT_SUCCESS );
+
+            THEN( "The services fail" ) 
+            {
+                dsl_shm_source_stats stats{0};
+                REQUIRE( dsl_source_shm_stats_get(source_name.c_str(),
+                    &stats) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_source_shm_stats_clear(source_name.c_str())
+                    == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A new Shared Memory Source can be added to and removed from a Pipeline",
+    "[source-api]" )
+{
+    GIVEN( "A new Shared Memory Source and a new Pipeline" ) 
+    {
+        std::wstring shm_name(L"/dsl-test-shm-source");
+        
+        REQUIRE( dsl_source_shm_new(source_name.c_str(), shm_name.c_str(),
+            buffer_in_format.c_str(), width, height, fps_n, fps_d,
+            4) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipeline_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Source is added to the Pipeline" ) 
+        {
+            REQUIRE( dsl_pipeline_component_add(pipeline_name.c_str(), 
+                source_name.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_delete(source_name.c_str()) 
+                == DSL_RESULT_COMPONENT_IN_USE );
+
+            THEN( "The Source can be removed and deleted" ) 
+            {
+                REQUIRE( dsl_pipeline_component_remove(pipeline_name.c_str(), 
+                    source_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete(source_name.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A new Metadata Replay Source returns the correct attribute values",
+    "[source-api]" )
+{
+    GIVEN( "A metadata stream recorded to file by a Metadata Export Sink" ) 
+    {
+        std::wstring sink_name(L"meta-export-sink");
+        std::wstring replay_file_path(L"./meta-replay-api-test.bin");
+        
+        // The stream header is written on create of the Sink.
+        REQUIRE( dsl_sink_meta_export_new(sink_name.c_str(), 
+            DSL_SINK_META_EXPORT_TRANSPORT_FILE, replay_file_path.c_str(), 
+            0, 16) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_delete(sink_name.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Metadata Replay Source is created" ) 
+        {
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                replay_file_path.c_str(), 1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_BLANK, width, height) 
+                == DSL_RESULT_SUCCESS );
+
+            // second call with the same name must fail
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                replay_file_path.c_str(), 1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_BLANK, width, height) 
+                == DSL_RESULT_SOURCE_NAME_NOT_UNIQUE );
+
+            THEN( "All default attributes are returned correctly" ) 
+            {
+                REQUIRE( dsl_source_is_live(source_name.c_str()) == FALSE );
+
+                dsl_meta_replay_source_stats stats{0};
+                REQUIRE( dsl_source_meta_replay_stats_get(source_name.c_str(),
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.batches_replayed == 0 );
+                REQUIRE( stats.frames_replayed == 0 );
+                REQUIRE( stats.objects_replayed == 0 );
+                REQUIRE( stats.late_batches == 0 );
+                REQUIRE( dsl_source_meta_replay_stats_clear(
+                    source_name.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+                std::remove("./meta-replay-api-test.bin");
+            }
+        }
+        WHEN( "A new Metadata Replay Source is created with invalid parameters" ) 
+        {
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                replay_file_path.c_str(), -1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_NONE, 0, 0) 
+                == DSL_RESULT_SOURCE_SET_FAILED );
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                replay_file_path.c_str(), 1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_TEST_PATTERN+1, width, height) 
+                == DSL_RESULT_SOURCE_SET_FAILED );
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                replay_file_path.c_str(), 1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_TEST_PATTERN, 0, 0) 
+                == DSL_RESULT_SOURCE_SET_FAILED );
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                L"./non-existent-meta-replay.bin", 1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_NONE, 0, 0) 
+                == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+            REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), 
+                uri.c_str(), 1.0, DSL_SOURCE_META_REPLAY_SURFACE_NONE, 0, 0) 
+                == DSL_RESULT_SOURCE_THREW_EXCEPTION );
+
+            THEN( "The Source is not created" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 0 );
+                std::remove("./meta-replay-api-test.bin");
+            }
+        }
+        WHEN( "The stats services are called with the wrong Source type" ) 
+        {
+            REQUIRE( dsl_source_app_new(source_name.c_str(), is_live, 
+                buffer_in_format.c_str(), width, height, 
+                fps_n, fps_d) == DSL_RESULT_SUCCESS );
+
+            THEN( "The services fail" ) 
+            {
+                dsl_meta_replay_source_stats stats{0};
+                REQUIRE( dsl_source_meta_replay_stats_get(source_name.c_str(),
+                    &stats) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_source_meta_replay_stats_clear(source_name.c_str())
+                    == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
                 REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                std::remove("./meta-replay-api-test.bin");
             }
         }
     }
@@ -1149,6 +1401,79 @@ SCENARIO( "An RTSP Source's Reconnect Stats can gotten and cleared", "[source-ap
     }
 }
 
+SCENARIO( "The RTSP reconnection params can be updated correctly", "[source-api]" )
+{
+    GIVEN( "The default RTSP reconnection params" )
+    {
+        uint max_concurrent(0), max_backoff(0);
+        REQUIRE( dsl_source_rtsp_reconnection_params_get(&max_concurrent,
+            &max_backoff) == DSL_RESULT_SUCCESS );
+        REQUIRE( max_concurrent == DSL_RTSP_RECONNECTION_MAX_CONCURRENT );
+        REQUIRE( max_backoff == DSL_RTSP_RECONNECTION_MAX_BACKOFF_S );
+            
+        WHEN( "The reconnection params are updated" ) 
+        {
+            uint new_max_concurrent(2), new_max_backoff(30);
+            REQUIRE( dsl_source_rtsp_reconnection_params_set(new_max_concurrent,
+                new_max_backoff) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" )
+            {
+                REQUIRE( dsl_source_rtsp_reconnection_params_get(&max_concurrent,
+                    &max_backoff) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_concurrent == new_max_concurrent );
+                REQUIRE( max_backoff == new_max_backoff );
+
+                REQUIRE( dsl_source_rtsp_reconnection_params_set(
+                    DSL_RTSP_RECONNECTION_MAX_CONCURRENT,
+                    DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "Invalid reconnection params are used" ) 
+        {
+            THEN( "The update fails and the params are unchanged" )
+            {
+                REQUIRE( dsl_source_rtsp_reconnection_params_set(0,
+                    10) == DSL_RESULT_SOURCE_SET_FAILED );
+                REQUIRE( dsl_source_rtsp_reconnection_params_set(2,
+                    0) == DSL_RESULT_SOURCE_SET_FAILED );
+                REQUIRE( dsl_source_rtsp_reconnection_params_get(&max_concurrent,
+                    &max_backoff) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_concurrent == DSL_RTSP_RECONNECTION_MAX_CONCURRENT );
+                REQUIRE( max_backoff == DSL_RTSP_RECONNECTION_MAX_BACKOFF_S );
+            }
+        }
+    }
+}
+
+SCENARIO( "The RTSP reconnection stats can be gotten and cleared", "[source-api]" )
+{
+    GIVEN( "No RTSP Sources in a reconnection cycle" )
+    {
+        REQUIRE( dsl_source_rtsp_reconnection_stats_clear() == DSL_RESULT_SUCCESS );
+            
+        WHEN( "A client gets the reconnection stats" ) 
+        {
+            dsl_rtsp_reconnection_stats stats{0};
+            stats.attempts = 123;
+            stats.deferrals = 456;
+            REQUIRE( dsl_source_rtsp_reconnection_stats_get(
+                &stats) == DSL_RESULT_SUCCESS );
+
+            THEN( "The cleared values are returned" )
+            {
+                REQUIRE( stats.active == 0 );
+                REQUIRE( stats.waiting == 0 );
+                REQUIRE( stats.peak_active == 0 );
+                REQUIRE( stats.attempts == 0 );
+                REQUIRE( stats.successes == 0 );
+                REQUIRE( stats.failures == 0 );
+                REQUIRE( stats.deferrals == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "An RTSP Source's latency setting can be updated correctly", 
     "[source-api]" )
 {
@@ -1658,6 +1983,53 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_app_max_level_bytes_set(NULL,
                     0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffers_push(NULL,
+                    NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffers_push(source_name.c_str(),
+                    NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_push_wrapped(NULL,
+                    NULL, 0, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_push_wrapped(source_name.c_str(),
+                    NULL, 0, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffers_push_wrapped(NULL,
+                    NULL, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffers_push_wrapped(source_name.c_str(),
+                    NULL, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_size_get(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_size_get(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_size_set(NULL,
+                    0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_acquire(NULL,
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_acquire(source_name.c_str(),
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_source_shm_new(NULL, NULL, NULL,
+                    0, 0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shm_new(source_name.c_str(), NULL, NULL,
+                    0, 0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shm_new(source_name.c_str(), 
+                    source_name.c_str(), NULL,
+                    0, 0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shm_stats_get(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shm_stats_get(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_shm_stats_clear(
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_source_meta_replay_new(NULL, NULL, 0, 
+                    0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_meta_replay_new(source_name.c_str(), NULL, 
+                    0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_meta_replay_stats_get(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_meta_replay_stats_get(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_meta_replay_stats_clear(
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                     
                     
                 REQUIRE( dsl_source_csi_new(NULL, 0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -1719,6 +2091,11 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                 REQUIRE( dsl_source_rtsp_tap_remove(NULL) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_source_rtsp_reconnection_params_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_reconnection_stats_get(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_source_image_multi_new(NULL, 
                     NULL, fps_n, fps_d) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_image_multi_new(source_name.c_str(), 
@@ -0,0 +1,179 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+// ---------------------------------------------------------------------------
+// Shared Test Inputs 
+
+static const std::wstring server_pipeline_name(L"server-pipeline");
+static const std::wstring client_pipeline_name(L"client-pipeline");
+
+static const std::wstring uri_source_name(L"uri-source");
+static const std::wstring uri(L"/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
+
+// Local RTSP Server Sink - serves rtsp://localhost:8554/rtsp-server 
+static const std::wstring rtsp_server_name(L"rtsp-server");
+static const std::wstring host(L"localhost");
+static const uint udp_port(5400);
+static const uint rtsp_port(8554);
+static const uint codec(DSL_CODEC_H264);
+static const uint bitrate(2000000);
+static const uint interval(0);
+
+static const std::wstring rtsp_uri(L"rtsp://localhost:8554/rtsp-server");
+static const uint num_rtsp_sources(6);
+static const uint latency(100);
+static const uint buffer_timeout(2);
+static const uint connection_sleep(1);
+static const uint connection_timeout(5);
+
+static const uint max_concurrent(2);
+static const uint max_backoff(8);
+
+static const std::wstring fake_sink_name(L"fake-sink");
+
+static GThread* main_loop_thread(NULL);
+
+static void* main_loop_thread_func(void *data)
+{
+    dsl_main_loop_run();
+    
+    return NULL;
+}
+
+SCENARIO( "Reconnection attempts are coordinated on a mass disconnect of RTSP Sources", 
+    "[rtsp-behavior]" )
+{
+    GIVEN( "A server Pipeline with an RTSP Server Sink and a client Pipeline \
+with multiple RTSP Sources connected to the server" ) 
+    {
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(uri_source_name.c_str(), uri.c_str(), 
+            false, 0, 0) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_rtsp_server_new(rtsp_server_name.c_str(), host.c_str(),
+            udp_port, rtsp_port, codec, bitrate, interval) == DSL_RESULT_SUCCESS );
+
+        const wchar_t* server_components[] = {L"uri-source", L"rtsp-server", NULL};
+
+        REQUIRE( dsl_pipeline_new_component_add_many(server_pipeline_name.c_str(), 
+            server_components) == DSL_RESULT_SUCCESS );
+
+        std::vector<std::wstring> source_names;
+        std::vector<const wchar_t*> client_components;
+        for (uint i = 0; i < num_rtsp_sources; i++)
+        {
+            source_names.push_back(L"rtsp-source-" + std::to_wstring(i));
+        }
+        for (auto& ivec: source_names)
+        {
+            REQUIRE( dsl_source_rtsp_new(ivec.c_str(), rtsp_uri.c_str(), 
+                DSL_RTP_ALL, 0, 0, latency, buffer_timeout) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_source_rtsp_connection_params_set(ivec.c_str(),
+                connection_sleep, connection_timeout) == DSL_RESULT_SUCCESS );
+            client_components.push_back(ivec.c_str());
+        }
+        REQUIRE( dsl_sink_fake_new(fake_sink_name.c_str()) == DSL_RESULT_SUCCESS );
+        client_components.push_back(fake_sink_name.c_str());
+        client_components.push_back(NULL);
+
+        REQUIRE( dsl_pipeline_new_component_add_many(client_pipeline_name.c_str(), 
+            &client_components[0]) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_source_rtsp_reconnection_params_set(max_concurrent,
+            max_backoff) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The server Pipeline is stopped while all RTSP Sources are connected" ) 
+        {
+            REQUIRE( dsl_pipeline_play(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            
+            main_loop_thread = g_thread_new("main-loop", 
+                main_loop_thread_func, NULL);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+            REQUIRE( dsl_pipeline_play(client_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(std::chrono::milliseconds(8000));
+
+            REQUIRE( dsl_source_rtsp_reconnection_stats_clear() 
+                == DSL_RESULT_SUCCESS );
+
+            // Simulate a mass disconnect 
+            REQUIRE( dsl_pipeline_stop(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(std::chrono::milliseconds(20000));
+
+            dsl_rtsp_reconnection_stats disconnectedStats{0};
+            REQUIRE( dsl_source_rtsp_reconnection_stats_get(
+                &disconnectedStats) == DSL_RESULT_SUCCESS );
+
+            // Restore the server, all sources should reconnect.
+            REQUIRE( dsl_pipeline_play(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(std::chrono::milliseconds(40000));
+
+            dsl_rtsp_reconnection_stats reconnectedStats{0};
+            REQUIRE( dsl_source_rtsp_reconnection_stats_get(
+                &reconnectedStats) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_stop(client_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_stop(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+
+            dsl_main_loop_quit();
+            g_thread_join(main_loop_thread);
+
+            THEN( "The number of concurrent attempts never exceeds the maximum" )
+            {
+                // Note: this test requires additional manual/visual confirmation 
+                // of the backoff times in the console log output
+                REQUIRE( disconnectedStats.attempts >= max_concurrent );
+                REQUIRE( disconnectedStats.peak_active <= max_concurrent );
+                REQUIRE( disconnectedStats.deferrals > 0 );
+                REQUIRE( disconnectedStats.failures > 0 );
+                REQUIRE( disconnectedStats.successes == 0 );
+                
+                REQUIRE( reconnectedStats.peak_active <= max_concurrent );
+                REQUIRE( reconnectedStats.successes == num_rtsp_sources );
+                REQUIRE( reconnectedStats.active == 0 );
+                REQUIRE( reconnectedStats.waiting == 0 );
+
+                REQUIRE( dsl_source_rtsp_reconnection_params_set(
+                    DSL_RTSP_RECONNECTION_MAX_CONCURRENT,
+                    DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,218 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeBenchScene.h"
+
+namespace DSL
+{
+    /**
+     * @brief limits on the size and speed of synthetic objects in pixels.
+     */
+    #define DSL_ODE_BENCH_MIN_OBJECT_SIZE                               32
+    #define DSL_ODE_BENCH_MAX_OBJECT_SIZE                               128
+    #define DSL_ODE_BENCH_MAX_OBJECT_SPEED                              12
+
+    OdeBenchScene::OdeBenchScene(const OdeBenchSceneParams& params)
+        : m_params(params)
+        , m_random(params.seed)
+        , m_frameNumber(0)
+        , m_lastTrackerId(0)
+    {
+        m_params.numClasses = std::max(m_params.numClasses, (uint)1);
+        
+        m_objects.resize(m_params.numSources);
+        for (auto& sourceObjects: m_objects)
+        {
+            sourceObjects.resize(m_params.objectsPerFrame);
+            for (auto& object: sourceObjects)
+            {
+                Spawn(object);
+            }
+        }
+    }
+    
+    OdeBenchScene::~OdeBenchScene()
+    {
+    }
+    
+    GstBuffer* OdeBenchScene::NewBatchBuffer(uint* numObjects)
+    {
+        // The first batch is created with the objects as spawned.
+        if (m_frameNumber++)
+        {
+            std::uniform_real_distribution<double> churn(0.0, 1.0);
+            
+            for (auto& sourceObjects: m_objects)
+            {
+                for (auto& object: sourceObjects)
+                {
+                    if (m_params.churnRate > 0 and 
+                        churn(m_random) < m_params.churnRate)
+                    {
+                        Spawn(object);
+                    }
+                    else
+                    {
+                        Move(object);
+                    }
+                }
+            }
+        }
+        
+        GstBuffer* pBuffer = gst_buffer_new();
+        
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(
+            std::max(m_params.numSources, (uint)1));
+        
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        pBatchMeta->base_meta.batch_meta = pBatchMeta;
+        pBatchMeta->base_meta.copy_func = nvds_batch_meta_copy_func;
+        pBatchMeta->base_meta.release_func = nvds_batch_meta_release_func;
+        
+        uint64_t timestamp = m_frameNumber*DSL_ODE_BENCH_FRAME_DURATION_NS;
+        
+        *numObjects = 0;
+        for (uint sourceId = 0; sourceId < m_params.numSources; sourceId++)
+        {
+            NvDsFrameMeta* pFrameMeta = 
+                nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = sourceId;
+            pFrameMeta->pad_index = sourceId;
+            pFrameMeta->batch_id = sourceId;
+            pFrameMeta->frame_num = m_frameNumber;
+            pFrameMeta->buf_pts = timestamp;
+            pFrameMeta->ntp_timestamp = timestamp;
+            pFrameMeta->source_frame_width = m_params.frameWidth;
+            pFrameMeta->source_frame_height = m_params.frameHeight;
+            pFrameMeta->bInferDone = true;
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+            
+            for (const auto& object: m_objects[sourceId])
+            {
+                NvDsObjectMeta* pObjectMeta = 
+                    nvds_acquire_obj_meta_from_pool(pBatchMeta);
+                pObjectMeta->object_id = object.trackerId;
+                pObjectMeta->class_id = object.classId;
+                pObjectMeta->unique_component_id = 1;
+                pObjectMeta->confidence = 0.9;
+                pObjectMeta->tracker_confidence = 0.9;
+                pObjectMeta->rect_params.left = object.left;
+                pObjectMeta->rect_params.top = object.top;
+                pObjectMeta->rect_params.width = object.width;
+                pObjectMeta->rect_params.height = object.height;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.left = object.left;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.top = object.top;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.width = object.width;
+                pObjectMeta->detector_bbox_info.org_bbox_coords.height = object.height;
+                snprintf(pObjectMeta->obj_label, MAX_LABEL_SIZE, 
+                    "class-%u", object.classId);
+                    
+                nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+                (*numObjects)++;
+            }
+        }
+        return pBuffer;
+    }
+    
+    uint64_t OdeBenchScene::GetFrameNumber()
+    {
+        return m_frameNumber;
+    }
+    
+    uint64_t OdeBenchScene::GetTrackerIdsIssued()
+    {
+        return m_lastTrackerId;
+    }
+    
+    void OdeBenchScene::Spawn(SceneObject& object)
+    {
+        std::uniform_int_distribution<uint> classId(0, m_params.numClasses-1);
+        std::uniform_real_distribution<float> size(
+            DSL_ODE_BENCH_MIN_OBJECT_SIZE, DSL_ODE_BENCH_MAX_OBJECT_SIZE);
+        std::uniform_real_distribution<float> speed(
+            -DSL_ODE_BENCH_MAX_OBJECT_SPEED, DSL_ODE_BENCH_MAX_OBJECT_SPEED);
+        
+        object.trackerId = ++m_lastTrackerId;
+        object.classId = classId(m_random);
+        object.width = size(m_random);
+        object.height = size(m_random);
+        
+        std::uniform_real_distribution<float> left(0, 
+            std::max((float)m_params.frameWidth - object.width, (float)0));
+        std::uniform_real_distribution<float> top(0, 
+            std::max((float)m_params.frameHeight - object.height, (float)0));
+            
+        object.left = left(m_random);
+        object.top = top(m_random);
+        
+        if (m_params.motionModel == DSL_ODE_BENCH_MOTION_STATIC)
+        {
+            object.dx = object.dy = 0;
+        }
+        else
+        {
+            object.dx = speed(m_random);
+            object.dy = speed(m_random);
+        }
+    }
+    
+    void OdeBenchScene::Move(SceneObject& object)
+    {
+        if (m_params.motionModel == DSL_ODE_BENCH_MOTION_STATIC)
+        {
+            return;
+        }
+        if (m_params.motionModel == DSL_ODE_BENCH_MOTION_RANDOM_WALK)
+        {
+            std::uniform_real_distribution<float> jitter(-1.0, 1.0);
+            
+            object.dx = std::min(std::max(object.dx + jitter(m_random), 
+                (float)-DSL_ODE_BENCH_MAX_OBJECT_SPEED), 
+                (float)DSL_ODE_BENCH_MAX_OBJECT_SPEED);
+            object.dy = std::min(std::max(object.dy + jitter(m_random), 
+                (float)-DSL_ODE_BENCH_MAX_OBJECT_SPEED), 
+                (float)DSL_ODE_BENCH_MAX_OBJECT_SPEED);
+        }
+        float maxLeft = std::max((float)m_params.frameWidth - object.width, 
+            (float)0);
+        float maxTop = std::max((float)m_params.frameHeight - object.height, 
+            (float)0);
+        
+        object.left += object.dx;
+        if (object.left < 0 or object.left > maxLeft)
+        {
+            object.dx = -object.dx;
+            object.left = std::min(std::max(object.left, (float)0), maxLeft);
+        }
+        object.top += object.dy;
+        if (object.top < 0 or object.top > maxTop)
+        {
+            object.dy = -object.dy;
+            object.top = std::min(std::max(object.top, (float)0), maxTop);
+        }
+    }
+}
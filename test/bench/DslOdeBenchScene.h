@@ -0,0 +1,188 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_BENCH_SCENE_H
+#define _DSL_ODE_BENCH_SCENE_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief Motion models for the objects of a synthetic scene.
+     */
+    #define DSL_ODE_BENCH_MOTION_STATIC                                 0
+    #define DSL_ODE_BENCH_MOTION_LINEAR                                 1
+    #define DSL_ODE_BENCH_MOTION_RANDOM_WALK                            2
+
+    /**
+     * @brief Duration of each synthetic frame, 30 frames/sec.
+     */
+    #define DSL_ODE_BENCH_FRAME_DURATION_NS                             33333333
+
+    /**
+     * @struct OdeBenchSceneParams
+     * @brief Parameters for a synthetic ODE benchmark scene.
+     */
+    struct OdeBenchSceneParams
+    {
+        /**
+         * @brief number of sources, one frame from each in every batch.
+         */
+        uint numSources;
+        
+        /**
+         * @brief number of objects in each frame.
+         */
+        uint objectsPerFrame;
+        
+        /**
+         * @brief number of object classes, class ids are 0..numClasses-1.
+         */
+        uint numClasses;
+        
+        /**
+         * @brief one of the DSL_ODE_BENCH_MOTION_* constants.
+         */
+        uint motionModel;
+        
+        /**
+         * @brief probability, 0.0 to 1.0, that an object leaves the scene
+         * on each frame and is replaced by one with a new tracker id.
+         */
+        double churnRate;
+        
+        /**
+         * @brief dimensions of each frame in pixels.
+         */
+        uint frameWidth = 1920;
+        uint frameHeight = 1080;
+        
+        /**
+         * @brief seed for the scene's random generator. Scenes with the
+         * same parameters and seed produce the same sequence of batches.
+         */
+        uint seed = 1;
+    };
+
+    /**
+     * @class OdeBenchScene
+     * @brief Generates batches of synthetic Frame and Object meta for 
+     * benchmarking the ODE Pad Probe Handler. Each object has a tracker id,
+     * class id and bounding box that moves from frame to frame according 
+     * to the scene's motion model.
+     */
+    class OdeBenchScene
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeBenchScene class
+         * @param[in] params parameters for the new scene.
+         */
+        OdeBenchScene(const OdeBenchSceneParams& params);
+        
+        ~OdeBenchScene();
+        
+        /**
+         * @brief Advances the scene by one frame and creates a new buffer 
+         * with batch meta for the new frame from each source.
+         * @param[out] numObjects number of objects added to the batch.
+         * @return new buffer, the caller takes ownership.
+         */
+        GstBuffer* NewBatchBuffer(uint* numObjects);
+        
+        /**
+         * @brief Gets the frame number of the last batch created.
+         * @return the current frame number.
+         */
+        uint64_t GetFrameNumber();
+        
+        /**
+         * @brief Gets the number of tracker ids issued since creation.
+         * @return number of unique objects that have entered the scene.
+         */
+        uint64_t GetTrackerIdsIssued();
+        
+    private:
+    
+        /**
+         * @struct SceneObject
+         * @brief Synthetic object tracked by the scene.
+         */
+        struct SceneObject
+        {
+            uint64_t trackerId;
+            uint classId;
+            float left;
+            float top;
+            float width;
+            float height;
+            float dx;
+            float dy;
+        };
+    
+        /**
+         * @brief Gives an object a new tracker id, class, bounding box and
+         * velocity.
+         * @param[out] object object to spawn.
+         */
+        void Spawn(SceneObject& object);
+        
+        /**
+         * @brief Moves an object according to the scene's motion model. 
+         * Objects bounce off the edges of the frame.
+         * @param[in,out] object object to move.
+         */
+        void Move(SceneObject& object);
+    
+        /**
+         * @brief parameters for this scene.
+         */
+        OdeBenchSceneParams m_params;
+        
+        /**
+         * @brief random generator for all scene parameters.
+         */
+        std::mt19937 m_random;
+        
+        /**
+         * @brief objects in the scene for each source.
+         */
+        std::vector<std::vector<SceneObject>> m_objects;
+        
+        /**
+         * @brief frame number of the last batch created.
+         */
+        uint64_t m_frameNumber;
+        
+        /**
+         * @brief last tracker id issued.
+         */
+        uint64_t m_lastTrackerId;
+    };
+}
+
+#endif // _DSL_ODE_BENCH_SCENE_H
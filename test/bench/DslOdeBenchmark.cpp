@@ -0,0 +1,368 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeBenchmark.h"
+#include "DslLatencyHistogram.h"
+
+#include <json-glib/json-glib.h>
+
+/**
+ * @brief The global operator new and delete are replaced so that the heap 
+ * allocations made while the handler is measured can be counted. Memory 
+ * allocated from the NvDs meta pools and with g_malloc is not counted.
+ */
+static std::atomic<bool> s_countAllocations(false);
+static std::atomic<uint64_t> s_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    if (s_countAllocations.load(std::memory_order_relaxed))
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* pMemory = malloc((size) ? size : 1);
+    if (!pMemory)
+    {
+        throw std::bad_alloc();
+    }
+    return pMemory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* pMemory) noexcept
+{
+    free(pMemory);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+    free(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t size) noexcept
+{
+    free(pMemory);
+}
+
+void operator delete[](void* pMemory, std::size_t size) noexcept
+{
+    free(pMemory);
+}
+
+namespace DSL
+{
+    static uint64_t ResultIntGet(JsonObject* pObject, 
+        const char* member, uint64_t defaultValue)
+    {
+        return (json_object_has_member(pObject, member))
+            ? (uint64_t)json_object_get_int_member(pObject, member)
+            : defaultValue;
+    }
+
+    static double ResultDoubleGet(JsonObject* pObject, 
+        const char* member, double defaultValue)
+    {
+        return (json_object_has_member(pObject, member))
+            ? json_object_get_double_member(pObject, member)
+            : defaultValue;
+    }
+
+    OdeBenchmark::OdeBenchmark(const char* name, 
+        const OdeBenchSceneParams& sceneParams, uint warmupBatches, uint batches)
+        : m_name(name)
+        , m_sceneParams(sceneParams)
+        , m_warmupBatches(warmupBatches)
+        , m_batches(batches)
+    {
+    }
+    
+    OdeBenchmark::~OdeBenchmark()
+    {
+    }
+    
+    OdeBenchResult OdeBenchmark::Run(DSL_PPH_ODE_PTR pOdeHandler)
+    {
+        OdeBenchResult result = {m_name};
+        
+        OdeBenchScene scene(m_sceneParams);
+        LatencyHistogram histogram;
+        
+        // Calibrate the cycle counter before the first measurement.
+        CycleCounter::GetNanosecondsPerCycle();
+        
+        uint64_t totalCycles(0), totalAllocations(0);
+        
+        GstPadProbeInfo info = {(GstPadProbeType)0};
+        
+        for (uint batch = 0; batch < m_warmupBatches + m_batches; batch++)
+        {
+            uint numObjects(0);
+            GstBuffer* pBuffer = scene.NewBatchBuffer(&numObjects);
+            info.data = pBuffer;
+            
+            StartAllocationCount();
+            uint64_t start = CycleCounter::Now();
+            
+            pOdeHandler->HandlePadData(&info);
+            
+            uint64_t cycles = CycleCounter::Now() - start;
+            uint64_t allocations = StopAllocationCount();
+            
+            gst_buffer_unref(pBuffer);
+            
+            if (batch < m_warmupBatches)
+            {
+                continue;
+            }
+            totalCycles += cycles;
+            totalAllocations += allocations;
+            histogram.Record(CycleCounter::ToNanoseconds(cycles));
+            
+            result.batches++;
+            result.frames += m_sceneParams.numSources;
+            result.objects += numObjects;
+        }
+        
+        double totalNs = CycleCounter::ToNanoseconds(totalCycles);
+        
+        result.nsPerObject = (result.objects) 
+            ? totalNs/result.objects : 0;
+        result.nsPerFrame = (result.frames)
+            ? totalNs/result.frames : 0;
+        result.allocsPerFrame = (result.frames)
+            ? (double)totalAllocations/result.frames : 0;
+            
+        dsl_latency_stats stats = {0};
+        histogram.GetStats(&stats);
+        result.batchP50Ns = stats.p50;
+        result.batchP99Ns = stats.p99;
+        result.batchMaxNs = stats.max;
+        
+        return result;
+    }
+    
+    void OdeBenchmark::StartAllocationCount()
+    {
+        s_allocations.store(0);
+        s_countAllocations.store(true);
+    }
+    
+    uint64_t OdeBenchmark::StopAllocationCount()
+    {
+        s_countAllocations.store(false);
+        return s_allocations.load();
+    }
+    
+    // ------------------------------------------------------------------------
+    
+    void OdeBenchReport::AddResult(const OdeBenchResult& result)
+    {
+        m_results.push_back(result);
+    }
+    
+    const std::vector<OdeBenchResult>& OdeBenchReport::GetResults()
+    {
+        return m_results;
+    }
+    
+    bool OdeBenchReport::WriteFile(const char* filePath)
+    {
+        std::unique_ptr<JsonBuilder, void(*)(gpointer)> pBuilder(
+            json_builder_new(), g_object_unref);
+        JsonBuilder* pB = pBuilder.get();
+        
+        json_builder_begin_object(pB);
+        json_builder_set_member_name(pB, "version");
+        json_builder_add_int_value(pB, DSL_ODE_BENCH_RESULTS_VERSION);
+        json_builder_set_member_name(pB, "results");
+        json_builder_begin_array(pB);
+        
+        for (const auto& result: m_results)
+        {
+            json_builder_begin_object(pB);
+            json_builder_set_member_name(pB, "name");
+            json_builder_add_string_value(pB, result.name.c_str());
+            json_builder_set_member_name(pB, "batches");
+            json_builder_add_int_value(pB, result.batches);
+            json_builder_set_member_name(pB, "frames");
+            json_builder_add_int_value(pB, result.frames);
+            json_builder_set_member_name(pB, "objects");
+            json_builder_add_int_value(pB, result.objects);
+            json_builder_set_member_name(pB, "ns_per_object");
+            json_builder_add_double_value(pB, result.nsPerObject);
+            json_builder_set_member_name(pB, "ns_per_frame");
+            json_builder_add_double_value(pB, result.nsPerFrame);
+            json_builder_set_member_name(pB, "allocs_per_frame");
+            json_builder_add_double_value(pB, result.allocsPerFrame);
+            json_builder_set_member_name(pB, "batch_p50_ns");
+            json_builder_add_int_value(pB, result.batchP50Ns);
+            json_builder_set_member_name(pB, "batch_p99_ns");
+            json_builder_add_int_value(pB, result.batchP99Ns);
+            json_builder_set_member_name(pB, "batch_max_ns");
+            json_builder_add_int_value(pB, result.batchMaxNs);
+            json_builder_end_object(pB);
+        }
+        json_builder_end_array(pB);
+        json_builder_end_object(pB);
+        
+        JsonNode* pRootNode = json_builder_get_root(pB);
+        
+        std::unique_ptr<JsonGenerator, void(*)(gpointer)> pGenerator(
+            json_generator_new(), g_object_unref);
+        json_generator_set_root(pGenerator.get(), pRootNode);
+        json_generator_set_pretty(pGenerator.get(), true);
+        
+        GError* pError(NULL);
+        bool written = json_generator_to_file(pGenerator.get(), 
+            filePath, &pError);
+        json_node_free(pRootNode);
+        
+        if (!written)
+        {
+            LOG_ERROR("Failed to write ODE benchmark results to '" << filePath 
+                << "': " << pError->message);
+            g_error_free(pError);
+            return false;
+        }
+        return true;
+    }
+    
+    bool OdeBenchReport::LoadBaseline(const char* filePath)
+    {
+        m_baseline.clear();
+        
+        std::unique_ptr<JsonParser, void(*)(gpointer)> pParser(
+            json_parser_new(), g_object_unref);
+        GError* pError(NULL);
+        
+        if (!json_parser_load_from_file(pParser.get(), filePath, &pError))
+        {
+            LOG_ERROR("Failed to load ODE benchmark baseline '" << filePath 
+                << "': " << pError->message);
+            g_error_free(pError);
+            return false;
+        }
+        JsonNode* pRootNode = json_parser_get_root(pParser.get());
+        if (!pRootNode or !JSON_NODE_HOLDS_OBJECT(pRootNode))
+        {
+            LOG_ERROR("ODE benchmark baseline must be a JSON object");
+            return false;
+        }
+        JsonObject* pRootObject = json_node_get_object(pRootNode);
+        
+        if (!json_object_has_member(pRootObject, "version") or
+            json_object_get_int_member(pRootObject, "version") > 
+                DSL_ODE_BENCH_RESULTS_VERSION or
+            !json_object_has_member(pRootObject, "results"))
+        {
+            LOG_ERROR("ODE benchmark baseline '" << filePath 
+                << "' has an unsupported version or no results");
+            return false;
+        }
+        JsonArray* pResults = json_object_get_array_member(pRootObject, 
+            "results");
+        if (!pResults)
+        {
+            LOG_ERROR("ODE benchmark baseline member 'results' must be an array");
+            return false;
+        }
+        for (uint i = 0; i < json_array_get_length(pResults); i++)
+        {
+            JsonObject* pResult = json_array_get_object_element(pResults, i);
+            if (!pResult or !json_object_has_member(pResult, "name"))
+            {
+                LOG_ERROR("ODE benchmark baseline result " << i 
+                    << " is missing its name");
+                m_baseline.clear();
+                return false;
+            }
+            OdeBenchResult result = 
+                {json_object_get_string_member(pResult, "name")};
+                
+            result.batches = ResultIntGet(pResult, "batches", 0);
+            result.frames = ResultIntGet(pResult, "frames", 0);
+            result.objects = ResultIntGet(pResult, "objects", 0);
+            result.nsPerObject = ResultDoubleGet(pResult, "ns_per_object", 0);
+            result.nsPerFrame = ResultDoubleGet(pResult, "ns_per_frame", 0);
+            result.allocsPerFrame = ResultDoubleGet(pResult, 
+                "allocs_per_frame", 0);
+            result.batchP50Ns = ResultIntGet(pResult, "batch_p50_ns", 0);
+            result.batchP99Ns = ResultIntGet(pResult, "batch_p99_ns", 0);
+            result.batchMaxNs = ResultIntGet(pResult, "batch_max_ns", 0);
+                
+            m_baseline[result.name] = result;
+        }
+        return true;
+    }
+    
+    uint OdeBenchReport::Compare(double tolerance, 
+        std::vector<std::string>& regressions)
+    {
+        uint compared(0);
+        
+        for (const auto& result: m_results)
+        {
+            if (m_baseline.find(result.name) == m_baseline.end())
+            {
+                continue;
+            }
+            const OdeBenchResult& baseline = m_baseline[result.name];
+            compared++;
+            
+            if (baseline.nsPerFrame > 0 and 
+                result.nsPerFrame > baseline.nsPerFrame*(1.0 + tolerance))
+            {
+                std::ostringstream regression;
+                regression << result.name << ": ns/frame " 
+                    << result.nsPerFrame << " exceeds baseline " 
+                    << baseline.nsPerFrame;
+                regressions.push_back(regression.str());
+            }
+            if (baseline.batchP99Ns > 0 and 
+                result.batchP99Ns > baseline.batchP99Ns*(1.0 + tolerance))
+            {
+                std::ostringstream regression;
+                regression << result.name << ": p99 batch latency " 
+                    << result.batchP99Ns << " ns exceeds baseline " 
+                    << baseline.batchP99Ns << " ns";
+                regressions.push_back(regression.str());
+            }
+            if (result.allocsPerFrame > 
+                baseline.allocsPerFrame + DSL_ODE_BENCH_ALLOC_TOLERANCE)
+            {
+                std::ostringstream regression;
+                regression << result.name << ": allocations/frame " 
+                    << result.allocsPerFrame << " exceeds baseline " 
+                    << baseline.allocsPerFrame;
+                regressions.push_back(regression.str());
+            }
+        }
+        return compared;
+    }
+}
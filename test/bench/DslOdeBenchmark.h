@@ -0,0 +1,210 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_BENCHMARK_H
+#define _DSL_ODE_BENCHMARK_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslPadProbeHandler.h"
+#include "DslOdeBenchScene.h"
+
+namespace DSL
+{
+    /**
+     * @brief version of the benchmark results file format.
+     */
+    #define DSL_ODE_BENCH_RESULTS_VERSION                               1
+    
+    /**
+     * @brief allocations per frame allowed above the baseline before a 
+     * result is reported as a regression. Allocation counts are not subject
+     * to timing noise, so the tolerance is absolute.
+     */
+    #define DSL_ODE_BENCH_ALLOC_TOLERANCE                               0.5
+
+    /**
+     * @struct OdeBenchResult
+     * @brief Results of a single ODE benchmark run.
+     */
+    struct OdeBenchResult
+    {
+        /**
+         * @brief unique name of the benchmark.
+         */
+        std::string name;
+        
+        /**
+         * @brief number of batches, frames and objects measured.
+         */
+        uint64_t batches;
+        uint64_t frames;
+        uint64_t objects;
+        
+        /**
+         * @brief mean handler time per object and per frame in nanoseconds.
+         */
+        double nsPerObject;
+        double nsPerFrame;
+        
+        /**
+         * @brief mean number of heap allocations per frame.
+         */
+        double allocsPerFrame;
+        
+        /**
+         * @brief handler latency percentiles, and maximum, for each batch
+         * in nanoseconds.
+         */
+        uint64_t batchP50Ns;
+        uint64_t batchP99Ns;
+        uint64_t batchMaxNs;
+    };
+
+    /**
+     * @class OdeBenchmark
+     * @brief Drives an ODE Pad Probe Handler with batches from a synthetic 
+     * scene and measures the time and heap allocations for each batch. 
+     * Only the handler is measured, the batches are created outside of the
+     * measured interval.
+     */
+    class OdeBenchmark
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeBenchmark class
+         * @param[in] name unique name for the benchmark.
+         * @param[in] sceneParams parameters for the synthetic scene.
+         * @param[in] warmupBatches number of batches to process before 
+         * measuring.
+         * @param[in] batches number of batches to measure.
+         */
+        OdeBenchmark(const char* name, const OdeBenchSceneParams& sceneParams,
+            uint warmupBatches, uint batches);
+            
+        ~OdeBenchmark();
+        
+        /**
+         * @brief Runs the benchmark against an ODE Pad Probe Handler.
+         * @param[in] pOdeHandler handler, with all Triggers added, to run.
+         * @return results of the run.
+         */
+        OdeBenchResult Run(DSL_PPH_ODE_PTR pOdeHandler);
+        
+        /**
+         * @brief Starts counting heap allocations made by all threads.
+         */
+        static void StartAllocationCount();
+        
+        /**
+         * @brief Stops counting heap allocations.
+         * @return number of allocations made since the count was started.
+         */
+        static uint64_t StopAllocationCount();
+        
+    private:
+    
+        /**
+         * @brief unique name for this benchmark.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief parameters for the synthetic scene.
+         */
+        OdeBenchSceneParams m_sceneParams;
+        
+        /**
+         * @brief number of batches to process before measuring.
+         */
+        uint m_warmupBatches;
+        
+        /**
+         * @brief number of batches to measure.
+         */
+        uint m_batches;
+    };
+    
+    /**
+     * @class OdeBenchReport
+     * @brief Collects benchmark results, writes them to a JSON file, and 
+     * compares them against the results of a stored baseline.
+     */
+    class OdeBenchReport
+    {
+    public:
+    
+        /**
+         * @brief Adds the results of a benchmark run to this report.
+         * @param[in] result results to add.
+         */
+        void AddResult(const OdeBenchResult& result);
+        
+        /**
+         * @brief Gets all results added to this report.
+         * @return results in the order added.
+         */
+        const std::vector<OdeBenchResult>& GetResults();
+        
+        /**
+         * @brief Writes all results to a JSON file.
+         * @param[in] filePath path to the file to write.
+         * @return true on successful write, false otherwise.
+         */
+        bool WriteFile(const char* filePath);
+        
+        /**
+         * @brief Loads the baseline results to compare against from a JSON
+         * file written by WriteFile.
+         * @param[in] filePath path to the baseline file.
+         * @return true on successful load, false otherwise.
+         */
+        bool LoadBaseline(const char* filePath);
+        
+        /**
+         * @brief Compares all results against the loaded baseline. Results 
+         * without a baseline of the same name are not compared.
+         * @param[in] tolerance relative increase in time per frame and 
+         * p99 latency allowed, e.g. 0.1 for 10%.
+         * @param[out] regressions description of each regression found.
+         * @return number of results compared.
+         */
+        uint Compare(double tolerance, std::vector<std::string>& regressions);
+        
+    private:
+    
+        /**
+         * @brief results added to this report.
+         */
+        std::vector<OdeBenchResult> m_results;
+        
+        /**
+         * @brief baseline results mapped by name.
+         */
+        std::map<std::string, OdeBenchResult> m_baseline;
+    };
+}
+
+#endif // _DSL_ODE_BENCHMARK_H
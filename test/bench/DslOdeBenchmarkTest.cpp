@@ -0,0 +1,567 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
+#include "DslOdeArea.h"
+#include "DslDisplayTypes.h"
+#include "DslOdeBenchScene.h"
+#include "DslOdeBenchmark.h"
+
+using namespace DSL;
+
+/**
+ * @brief The benchmarks are configured with the following environment 
+ * variables, each of which is optional.
+ *  - DSL_ODE_BENCH_RESULTS   path to write the results to.
+ *  - DSL_ODE_BENCH_BASELINE  path to the stored baseline to compare against.
+ *  - DSL_ODE_BENCH_TOLERANCE allowed increase over the baseline in percent.
+ *  - DSL_ODE_BENCH_BATCHES   number of batches to measure for each benchmark.
+ *  - DSL_ODE_BENCH_RECORD    if non-zero, the results are recorded as the new
+ *                            baseline rather than compared against it.
+ */
+static const char* DEFAULT_RESULTS_FILE("./ode-bench-results.json");
+static const char* DEFAULT_BASELINE_FILE("./test/bench/ode-bench-baseline.json");
+static const uint DEFAULT_TOLERANCE(10);
+static const uint DEFAULT_BATCHES(500);
+static const uint DEFAULT_WARMUP_BATCHES(50);
+
+static const char* env_string_get(const char* name, const char* defaultValue)
+{
+    const char* value = getenv(name);
+    return (value and *value) ? value : defaultValue;
+}
+
+static uint env_uint_get(const char* name, uint defaultValue)
+{
+    const char* value = getenv(name);
+    return (value and *value) ? (uint)strtoul(value, NULL, 10) : defaultValue;
+}
+
+static std::atomic<uint64_t> s_occurrences(0);
+
+static void ode_bench_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, 
+    void* client_data)
+{
+    s_occurrences++;
+}    
+
+static DSL_ODE_ACTION_PTR ode_bench_custom_action_new(const char* name)
+{
+    return DSL_ODE_ACTION_CUSTOM_NEW(name, ode_bench_occurrence_handler_cb, NULL);
+}
+
+/**
+ * @brief Function type for adding a set of Triggers, with their Areas and
+ * Actions, to an ODE Pad Probe Handler under test.
+ */
+typedef void (*ode_bench_triggers_add_cb)(DSL_PPH_ODE_PTR pOdeHandler, 
+    uint numClasses);
+
+static void occurrence_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, 
+    uint numClasses)
+{
+    DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+        DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+    REQUIRE( pOdeTrigger->AddAction(
+        ode_bench_custom_action_new("custom")) == true );
+    REQUIRE( pOdeHandler->AddChild(pOdeTrigger) == true );
+}
+
+static void occurrence_per_class_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, 
+    uint numClasses)
+{
+    for (uint classId = 0; classId < numClasses; classId++)
+    {
+        std::string triggerName("occurrence-" + std::to_string(classId));
+        std::string actionName("custom-" + std::to_string(classId));
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(triggerName.c_str(), 
+                DSL_ODE_ANY_SOURCE, classId, DSL_ODE_TRIGGER_LIMIT_NONE);
+        REQUIRE( pOdeTrigger->AddAction(
+            ode_bench_custom_action_new(actionName.c_str())) == true );
+        REQUIRE( pOdeHandler->AddChild(pOdeTrigger) == true );
+    }
+}
+
+static void occurrence_area_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, 
+    uint numClasses)
+{
+    DSL_RGBA_PREDEFINED_COLOR_PTR pColor = 
+        DSL_RGBA_PREDEFINED_COLOR_NEW("color", DSL_COLOR_PREDEFINED_BLACK, 1.0);
+    
+    dsl_coordinate coordinates[] = 
+        {{480,270}, {1440,270}, {1600,540}, {1440,810}, {480,810}, {320,540}};
+    DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW("polygon", 
+        coordinates, 6, 2, pColor);
+    DSL_ODE_AREA_INCLUSION_PTR pOdeArea = DSL_ODE_AREA_INCLUSION_NEW(
+        "inclusion-area", pPolygon, true, DSL_BBOX_POINT_SOUTH);
+        
+    DSL_ODE_ACTION_BBOX_FORMAT_PTR pFormatAction = 
+        DSL_ODE_ACTION_BBOX_FORMAT_NEW("format-bbox", 4, pColor, false, pColor);
+
+    DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+        DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence-in-area", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+    REQUIRE( pOdeTrigger->AddArea(pOdeArea) == true );
+    REQUIRE( pOdeTrigger->AddAction(pFormatAction) == true );
+    REQUIRE( pOdeTrigger->AddAction(
+        ode_bench_custom_action_new("custom")) == true );
+    REQUIRE( pOdeHandler->AddChild(pOdeTrigger) == true );
+}
+
+static void cross_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, uint numClasses)
+{
+    DSL_RGBA_PREDEFINED_COLOR_PTR pColor = 
+        DSL_RGBA_PREDEFINED_COLOR_NEW("color", DSL_COLOR_PREDEFINED_BLACK, 1.0);
+
+    DSL_RGBA_LINE_PTR pLine = 
+        DSL_RGBA_LINE_NEW("line", 0, 540, 1920, 540, 2, pColor);
+    DSL_ODE_AREA_LINE_PTR pOdeArea = DSL_ODE_AREA_LINE_NEW("line-area", 
+        pLine, true, DSL_BBOX_POINT_SOUTH);
+
+    DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+        DSL_ODE_TRIGGER_CROSS_NEW("cross", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE, 2, 10,
+            DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, pColor);
+    REQUIRE( pOdeTrigger->AddArea(pOdeArea) == true );
+    REQUIRE( pOdeTrigger->AddAction(
+        ode_bench_custom_action_new("custom")) == true );
+    REQUIRE( pOdeHandler->AddChild(pOdeTrigger) == true );
+}
+
+static void distance_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, uint numClasses)
+{
+    // Objects of class 0 within 0 to 200 pixels of objects of class 1
+    DSL_ODE_TRIGGER_DISTANCE_PTR pOdeTrigger = 
+        DSL_ODE_TRIGGER_DISTANCE_NEW("distance", DSL_ODE_ANY_SOURCE, 0, 1,
+            DSL_ODE_TRIGGER_LIMIT_NONE, 0, 200, DSL_BBOX_POINT_CENTER,
+            DSL_DISTANCE_METHOD_FIXED_PIXELS);
+    REQUIRE( pOdeTrigger->AddAction(
+        ode_bench_custom_action_new("custom")) == true );
+    REQUIRE( pOdeHandler->AddChild(pOdeTrigger) == true );
+}
+
+static void persistence_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, 
+    uint numClasses)
+{
+    DSL_ODE_TRIGGER_PERSISTENCE_PTR pOdeTrigger = 
+        DSL_ODE_TRIGGER_PERSISTENCE_NEW("persistence", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE, 0, 3600);
+    REQUIRE( pOdeTrigger->AddAction(
+        ode_bench_custom_action_new("custom")) == true );
+    REQUIRE( pOdeHandler->AddChild(pOdeTrigger) == true );
+}
+
+static void frame_level_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, 
+    uint numClasses)
+{
+    DSL_ODE_TRIGGER_COUNT_PTR pCountTrigger = 
+        DSL_ODE_TRIGGER_COUNT_NEW("count", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE, 0, UINT32_MAX);
+    REQUIRE( pCountTrigger->AddAction(
+        ode_bench_custom_action_new("custom-count")) == true );
+    REQUIRE( pOdeHandler->AddChild(pCountTrigger) == true );
+        
+    DSL_ODE_TRIGGER_SUMMATION_PTR pSummationTrigger = 
+        DSL_ODE_TRIGGER_SUMMATION_NEW("summation", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+    REQUIRE( pSummationTrigger->AddAction(
+        ode_bench_custom_action_new("custom-summation")) == true );
+    REQUIRE( pOdeHandler->AddChild(pSummationTrigger) == true );
+
+    // No objects of class numClasses are ever generated
+    DSL_ODE_TRIGGER_ABSENCE_PTR pAbsenceTrigger = 
+        DSL_ODE_TRIGGER_ABSENCE_NEW("absence", DSL_ODE_ANY_SOURCE, 
+            numClasses, DSL_ODE_TRIGGER_LIMIT_NONE);
+    REQUIRE( pAbsenceTrigger->AddAction(
+        ode_bench_custom_action_new("custom-absence")) == true );
+    REQUIRE( pOdeHandler->AddChild(pAbsenceTrigger) == true );
+}
+
+static void mixed_triggers_add(DSL_PPH_ODE_PTR pOdeHandler, uint numClasses)
+{
+    occurrence_per_class_triggers_add(pOdeHandler, numClasses);
+    
+    DSL_RGBA_PREDEFINED_COLOR_PTR pColor = 
+        DSL_RGBA_PREDEFINED_COLOR_NEW("color", DSL_COLOR_PREDEFINED_BLACK, 1.0);
+    DSL_RGBA_LINE_PTR pLine = 
+        DSL_RGBA_LINE_NEW("line", 0, 540, 1920, 540, 2, pColor);
+    DSL_ODE_AREA_LINE_PTR pOdeArea = DSL_ODE_AREA_LINE_NEW("line-area", 
+        pLine, true, DSL_BBOX_POINT_SOUTH);
+
+    DSL_ODE_TRIGGER_CROSS_PTR pCrossTrigger = 
+        DSL_ODE_TRIGGER_CROSS_NEW("cross", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE, 2, 10,
+            DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, pColor);
+    REQUIRE( pCrossTrigger->AddArea(pOdeArea) == true );
+    REQUIRE( pCrossTrigger->AddAction(
+        ode_bench_custom_action_new("custom-cross")) == true );
+    REQUIRE( pOdeHandler->AddChild(pCrossTrigger) == true );
+    
+    DSL_ODE_TRIGGER_PERSISTENCE_PTR pPersistenceTrigger = 
+        DSL_ODE_TRIGGER_PERSISTENCE_NEW("persistence", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE, 0, 3600);
+    REQUIRE( pPersistenceTrigger->AddAction(
+        ode_bench_custom_action_new("custom-persistence")) == true );
+    REQUIRE( pOdeHandler->AddChild(pPersistenceTrigger) == true );
+
+    DSL_ODE_TRIGGER_COUNT_PTR pCountTrigger = 
+        DSL_ODE_TRIGGER_COUNT_NEW("count", DSL_ODE_ANY_SOURCE, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE, 0, UINT32_MAX);
+    REQUIRE( pCountTrigger->AddAction(
+        ode_bench_custom_action_new("custom-count")) == true );
+    REQUIRE( pOdeHandler->AddChild(pCountTrigger) == true );
+}
+
+/**
+ * @struct OdeBenchCase
+ * @brief A named benchmark - a synthetic scene and the set of Triggers to
+ * run against it.
+ */
+struct OdeBenchCase
+{
+    const char* name;
+    OdeBenchSceneParams sceneParams;
+    bool parallel;
+    ode_bench_triggers_add_cb triggersAdd;
+};
+
+static const OdeBenchCase odeBenchCases[] = 
+{
+    {"occurrence-4x10-static", 
+        {4, 10, 4, DSL_ODE_BENCH_MOTION_STATIC, 0.0}, 
+        false, occurrence_triggers_add},
+    {"occurrence-4x100-static", 
+        {4, 100, 4, DSL_ODE_BENCH_MOTION_STATIC, 0.0}, 
+        false, occurrence_triggers_add},
+    {"occurrence-per-class-4x100-static", 
+        {4, 100, 8, DSL_ODE_BENCH_MOTION_STATIC, 0.0}, 
+        false, occurrence_per_class_triggers_add},
+    {"occurrence-area-4x100-linear", 
+        {4, 100, 4, DSL_ODE_BENCH_MOTION_LINEAR, 0.0}, 
+        false, occurrence_area_triggers_add},
+    {"cross-4x50-linear", 
+        {4, 50, 4, DSL_ODE_BENCH_MOTION_LINEAR, 0.0}, 
+        false, cross_triggers_add},
+    {"cross-4x50-random-walk-churn", 
+        {4, 50, 4, DSL_ODE_BENCH_MOTION_RANDOM_WALK, 0.05}, 
+        false, cross_triggers_add},
+    {"distance-4x50-random-walk", 
+        {4, 50, 2, DSL_ODE_BENCH_MOTION_RANDOM_WALK, 0.0}, 
+        false, distance_triggers_add},
+    {"persistence-4x100-linear-churn", 
+        {4, 100, 4, DSL_ODE_BENCH_MOTION_LINEAR, 0.02}, 
+        false, persistence_triggers_add},
+    {"frame-level-4x100-static", 
+        {4, 100, 4, DSL_ODE_BENCH_MOTION_STATIC, 0.0}, 
+        false, frame_level_triggers_add},
+    {"mixed-4x100-random-walk-churn", 
+        {4, 100, 4, DSL_ODE_BENCH_MOTION_RANDOM_WALK, 0.05}, 
+        false, mixed_triggers_add},
+    {"mixed-16x100-random-walk-churn-parallel", 
+        {16, 100, 4, DSL_ODE_BENCH_MOTION_RANDOM_WALK, 0.05}, 
+        true, mixed_triggers_add},
+};
+
+SCENARIO( "An OdeBenchScene generates repeatable batches of synthetic meta", 
+    "[OdeBench]" )
+{
+    GIVEN( "Two OdeBenchScenes with the same parameters" ) 
+    {
+        OdeBenchSceneParams params = 
+            {2, 20, 4, DSL_ODE_BENCH_MOTION_RANDOM_WALK, 0.1};
+            
+        OdeBenchScene scene1(params);
+        OdeBenchScene scene2(params);
+        
+        WHEN( "A number of batches are created from each" )
+        {
+            bool identical(true);
+            uint numObjects1(0), numObjects2(0);
+            
+            for (uint batch = 0; batch < 20; batch++)
+            {
+                GstBuffer* pBuffer1 = scene1.NewBatchBuffer(&numObjects1);
+                GstBuffer* pBuffer2 = scene2.NewBatchBuffer(&numObjects2);
+                
+                NvDsBatchMeta* pBatchMeta1 = 
+                    gst_buffer_get_nvds_batch_meta(pBuffer1);
+                NvDsBatchMeta* pBatchMeta2 = 
+                    gst_buffer_get_nvds_batch_meta(pBuffer2);
+                REQUIRE( pBatchMeta1->num_frames_in_batch == 2 );
+                
+                for (NvDsMetaList *pFrame1 = pBatchMeta1->frame_meta_list, 
+                    *pFrame2 = pBatchMeta2->frame_meta_list; pFrame1 and pFrame2;
+                    pFrame1 = pFrame1->next, pFrame2 = pFrame2->next)
+                {
+                    NvDsFrameMeta* pFrameMeta1 = (NvDsFrameMeta*)pFrame1->data;
+                    NvDsFrameMeta* pFrameMeta2 = (NvDsFrameMeta*)pFrame2->data;
+                    REQUIRE( pFrameMeta1->frame_num == batch+1 );
+                    REQUIRE( pFrameMeta1->num_obj_meta == 20 );
+                    
+                    for (NvDsMetaList *pObject1 = pFrameMeta1->obj_meta_list,
+                        *pObject2 = pFrameMeta2->obj_meta_list; 
+                        pObject1 and pObject2;
+                        pObject1 = pObject1->next, pObject2 = pObject2->next)
+                    {
+                        NvDsObjectMeta* pObjectMeta1 = 
+                            (NvDsObjectMeta*)pObject1->data;
+                        NvDsObjectMeta* pObjectMeta2 = 
+                            (NvDsObjectMeta*)pObject2->data;
+                        identical &= 
+                            (pObjectMeta1->object_id == pObjectMeta2->object_id and
+                            pObjectMeta1->class_id == pObjectMeta2->class_id and
+                            pObjectMeta1->rect_params.left == 
+                                pObjectMeta2->rect_params.left and
+                            pObjectMeta1->rect_params.top == 
+                                pObjectMeta2->rect_params.top);
+                    }
+                }
+                gst_buffer_unref(pBuffer1);
+                gst_buffer_unref(pBuffer2);
+            }
+            THEN( "The batches are identical and churn issues new tracker ids" )
+            {
+                REQUIRE( identical == true );
+                REQUIRE( numObjects1 == 40 );
+                REQUIRE( scene1.GetFrameNumber() == 20 );
+                REQUIRE( scene1.GetTrackerIdsIssued() > 40 );
+                REQUIRE( scene1.GetTrackerIdsIssued() == 
+                    scene2.GetTrackerIdsIssued() );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeBenchReport detects regressions against a stored baseline", 
+    "[OdeBench]" )
+{
+    GIVEN( "A baseline written by an OdeBenchReport" ) 
+    {
+        std::string baselineFile("/tmp/ode-bench-baseline-test.json");
+        
+        OdeBenchResult baseline1 = {"bench-1", 100, 400, 4000, 
+            50.0, 500.0, 2.0, 1800, 2500, 3000};
+        OdeBenchResult baseline2 = {"bench-2", 100, 400, 4000, 
+            50.0, 500.0, 2.0, 1800, 2500, 3000};
+            
+        OdeBenchReport baselineReport;
+        baselineReport.AddResult(baseline1);
+        baselineReport.AddResult(baseline2);
+        REQUIRE( baselineReport.WriteFile(baselineFile.c_str()) == true );
+        
+        WHEN( "New results are compared against the baseline" )
+        {
+            OdeBenchResult result1 = baseline1;
+            result1.nsPerFrame = 540.0;
+            
+            OdeBenchResult result2 = baseline2;
+            result2.nsPerFrame = 600.0;
+            result2.batchP99Ns = 3000;
+            result2.allocsPerFrame = 3.0;
+            
+            OdeBenchResult result3 = baseline1;
+            result3.name = "bench-3";
+            
+            OdeBenchReport report;
+            report.AddResult(result1);
+            report.AddResult(result2);
+            report.AddResult(result3);
+            REQUIRE( report.LoadBaseline(baselineFile.c_str()) == true );
+            
+            std::vector<std::string> regressions;
+            uint compared = report.Compare(0.1, regressions);
+            
+            THEN( "Only the results over tolerance are reported" )
+            {
+                REQUIRE( compared == 2 );
+                REQUIRE( regressions.size() == 3 );
+                for (const auto& regression: regressions)
+                {
+                    REQUIRE( regression.find("bench-2") == 0 );
+                }
+            }
+        }
+        WHEN( "The baseline file does not exist" )
+        {
+            OdeBenchReport report;
+            
+            THEN( "The baseline fails to load" )
+            {
+                REQUIRE( report.LoadBaseline(
+                    "/tmp/ode-bench-no-such-baseline.json") == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "The ODE Pad Probe Handler makes no heap allocations once warmed up",
+    "[OdeBench]" )
+{
+    GIVEN( "An OdePadProbeHandler with Triggers and Actions that use scratch data" )
+    {
+        DSL_PPH_ODE_PTR pOdeHandler = DSL_PPH_ODE_NEW("ode-handler");
+
+        DSL_RGBA_PREDEFINED_COLOR_PTR pColor =
+            DSL_RGBA_PREDEFINED_COLOR_NEW("color", DSL_COLOR_PREDEFINED_BLACK, 1.0);
+        DSL_RGBA_FONT_PTR pFont = DSL_RGBA_FONT_NEW("font", "arial", 12, pColor);
+
+        std::vector<uint> contentTypes = {DSL_METRIC_OBJECT_CLASS,
+            DSL_METRIC_OBJECT_TRACKING_ID, DSL_METRIC_OBJECT_LOCATION,
+            DSL_METRIC_OBJECT_DIMENSIONS, DSL_METRIC_OBJECT_CONFIDENCE_INFERENCE,
+            DSL_METRIC_OBJECT_PERSISTENCE};
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger =
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", DSL_ODE_ANY_SOURCE,
+                DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+        REQUIRE( pOccurrenceTrigger->AddAction(DSL_ODE_ACTION_DISPLAY_NEW(
+            "display", "%0 %1 at %2 size %3 conf %4", 10, 10, pFont,
+            false, pColor)) == true );
+        REQUIRE( pOccurrenceTrigger->AddAction(
+            DSL_ODE_ACTION_LABEL_CUSTOMIZE_NEW("customize-label",
+                contentTypes)) == true );
+        REQUIRE( pOccurrenceTrigger->AddAction(
+            DSL_ODE_ACTION_LABEL_FORMAT_NEW("format-label", pFont,
+                true, pColor)) == true );
+        REQUIRE( pOccurrenceTrigger->AddAction(
+            DSL_ODE_ACTION_FILL_SURROUNDINGS_NEW("fill-surroundings",
+                pColor)) == true );
+        REQUIRE( pOccurrenceTrigger->AddAction(
+            ode_bench_custom_action_new("custom")) == true );
+        REQUIRE( pOdeHandler->AddChild(pOccurrenceTrigger) == true );
+
+        // Collects its occurrences in the per-source occurrence list.
+        DSL_ODE_TRIGGER_SMALLEST_PTR pSmallestTrigger =
+            DSL_ODE_TRIGGER_SMALLEST_NEW("smallest", DSL_ODE_ANY_SOURCE,
+                DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+        REQUIRE( pSmallestTrigger->AddAction(DSL_ODE_ACTION_DISPLAY_NEW(
+            "display-smallest", "%0 is the smallest", 10, 40, pFont,
+            false, pColor)) == true );
+        REQUIRE( pOdeHandler->AddChild(pSmallestTrigger) == true );
+
+        WHEN( "The handler is run against a static scene" )
+        {
+            OdeBenchSceneParams sceneParams =
+                {4, 20, 4, DSL_ODE_BENCH_MOTION_STATIC, 0.0};
+            OdeBenchmark benchmark("zero-allocations", sceneParams,
+                DEFAULT_WARMUP_BATCHES, 100);
+
+            s_occurrences = 0;
+            OdeBenchResult result = benchmark.Run(pOdeHandler);
+
+            THEN( "No heap allocations are made after the warm-up batches" )
+            {
+                REQUIRE( s_occurrences > 0 );
+                REQUIRE( result.allocsPerFrame == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The ODE Pad Probe Handler performs within its stored baseline", 
+    "[OdeBench]" )
+{
+    GIVEN( "A set of benchmarks and an OdeBenchReport" ) 
+    {
+        const char* resultsFile = env_string_get("DSL_ODE_BENCH_RESULTS",
+            DEFAULT_RESULTS_FILE);
+        const char* baselineFile = env_string_get("DSL_ODE_BENCH_BASELINE",
+            DEFAULT_BASELINE_FILE);
+        uint tolerance = env_uint_get("DSL_ODE_BENCH_TOLERANCE", 
+            DEFAULT_TOLERANCE);
+        uint batches = std::max(env_uint_get("DSL_ODE_BENCH_BATCHES", 
+            DEFAULT_BATCHES), (uint)1);
+        bool recordBaseline = env_uint_get("DSL_ODE_BENCH_RECORD", 0);
+        
+        OdeBenchReport report;
+
+        WHEN( "Each benchmark is run against a new OdePadProbeHandler" )
+        {
+            for (const auto& benchCase: odeBenchCases)
+            {
+                DSL_PPH_ODE_PTR pOdeHandler = DSL_PPH_ODE_NEW("ode-handler");
+                if (benchCase.parallel)
+                {
+                    pOdeHandler->SetParallelMode(true, 0);
+                }
+                benchCase.triggersAdd(pOdeHandler, 
+                    benchCase.sceneParams.numClasses);
+                
+                OdeBenchmark benchmark(benchCase.name, benchCase.sceneParams,
+                    DEFAULT_WARMUP_BATCHES, batches);
+                
+                s_occurrences = 0;
+                OdeBenchResult result = benchmark.Run(pOdeHandler);
+                
+                // Each benchmark must exercise its Trigger's Actions.
+                REQUIRE( s_occurrences > 0 );
+                
+                std::cout << std::left << std::setw(44) << result.name 
+                    << std::right << std::fixed << std::setprecision(1)
+                    << std::setw(10) << result.nsPerObject << " ns/object"
+                    << std::setw(12) << result.nsPerFrame << " ns/frame"
+                    << std::setw(8) << result.allocsPerFrame << " allocs/frame"
+                    << std::setw(10) << result.batchP99Ns << " ns p99\n";
+                    
+                report.AddResult(result);
+            }
+            THEN( "The results are written and compared to the baseline" )
+            {
+                REQUIRE( report.WriteFile(resultsFile) == true );
+                
+                if (recordBaseline)
+                {
+                    REQUIRE( report.WriteFile(baselineFile) == true );
+                    WARN( "ODE benchmark baseline recorded to '" 
+                        << baselineFile << "'" );
+                }
+                else
+                {
+                    std::ifstream baselineStream(baselineFile);
+                    if (!baselineStream.good())
+                    {
+                        FAIL( "No ODE benchmark baseline found at '" 
+                            << baselineFile << "' - run with "
+                            << "DSL_ODE_BENCH_RECORD=1 to record one" );
+                    }
+                    REQUIRE( report.LoadBaseline(baselineFile) == true );
+                    
+                    std::vector<std::string> regressions;
+                    report.Compare(tolerance/100.0, regressions);
+                    
+                    for (const auto& regression: regressions)
+                    {
+                        UNSCOPED_INFO( regression );
+                    }
+                    REQUIRE( regressions.size() == 0 );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,192 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslAsyncActionExecutor.h"
+
+using namespace DSL;
+
+static void wait_for_completed(AsyncActionExecutor* pExecutor, uint64_t completed)
+{
+    dsl_ode_action_executor_stats stats{0};
+    for (uint i = 0; i < 500; i++)
+    {
+        pExecutor->GetStats(&stats);
+        if (stats.completed >= completed and !stats.queue_depth)
+        {
+            return;
+        }
+        g_usleep(10000);
+    }
+}
+
+static void wait_for_queue_empty(AsyncActionExecutor* pExecutor)
+{
+    dsl_ode_action_executor_stats stats{0};
+    for (uint i = 0; i < 500; i++)
+    {
+        pExecutor->GetStats(&stats);
+        if (!stats.queue_depth)
+        {
+            return;
+        }
+        g_usleep(1000);
+    }
+}
+
+SCENARIO( "The AsyncActionExecutor executes the tasks of a strand in order", 
+    "[AsyncActionExecutor]" )
+{
+    GIVEN( "The AsyncActionExecutor with multiple workers" ) 
+    {
+        AsyncActionExecutor* pExecutor = AsyncActionExecutor::GetExecutor();
+        REQUIRE( pExecutor->SetParams(4, 
+            DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY) == true );
+        pExecutor->ClearStats();
+        
+        int key1(0), key2(0);
+        std::vector<uint> results1, results2;
+        std::atomic<uint> running1(0), maxRunning1(0);
+
+        WHEN( "Tasks are submitted for two strands" )
+        {
+            for (uint i = 0; i < 50; i++)
+            {
+                REQUIRE( pExecutor->Submit(&key1, [&, i]()
+                {
+                    uint running = ++running1;
+                    if (running > maxRunning1)
+                    {
+                        maxRunning1 = running;
+                    }
+                    results1.push_back(i);
+                    running1--;
+                }) == true );
+                REQUIRE( pExecutor->Submit(&key2, 
+                    [&, i](){results2.push_back(i);}) == true );
+            }
+            wait_for_completed(pExecutor, 100);
+
+            THEN( "The tasks of each strand execute one at a time, in order" )
+            {
+                REQUIRE( maxRunning1 == 1 );
+                REQUIRE( results1.size() == 50 );
+                REQUIRE( results2.size() == 50 );
+                for (uint i = 0; i < 50; i++)
+                {
+                    REQUIRE( results1[i] == i );
+                    REQUIRE( results2[i] == i );
+                }
+                dsl_ode_action_executor_stats stats{0};
+                pExecutor->GetStats(&stats);
+                REQUIRE( stats.submitted == 100 );
+                REQUIRE( stats.completed == 100 );
+                REQUIRE( stats.rejected == 0 );
+                REQUIRE( stats.queue_depth == 0 );
+                REQUIRE( stats.workers <= 4 );
+                REQUIRE( stats.queue_latency.count == 100 );
+                REQUIRE( stats.run_latency.count == 100 );
+            }
+        }
+        REQUIRE( pExecutor->SetParams(DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS, 
+            DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY) == true );
+    }
+}
+
+SCENARIO( "The AsyncActionExecutor rejects tasks when the queue is full", 
+    "[AsyncActionExecutor]" )
+{
+    GIVEN( "The AsyncActionExecutor with a single worker and a small queue" ) 
+    {
+        AsyncActionExecutor* pExecutor = AsyncActionExecutor::GetExecutor();
+        REQUIRE( pExecutor->SetParams(1, 2) == true );
+        pExecutor->ClearStats();
+        
+        int key(0);
+        std::atomic<bool> released(false);
+        std::atomic<uint> executed(0);
+
+        WHEN( "More tasks are submitted than can be queued" )
+        {
+            // First task blocks the only worker until released.
+            REQUIRE( pExecutor->Submit(&key, [&]()
+            {
+                while (!released)
+                {
+                    g_usleep(1000);
+                }
+                executed++;
+            }) == true );
+            
+            wait_for_queue_empty(pExecutor);
+            
+            REQUIRE( pExecutor->Submit(&key, [&](){executed++;}) == true );
+            REQUIRE( pExecutor->Submit(&key, [&](){executed++;}) == true );
+            REQUIRE( pExecutor->Submit(&key, [&](){executed++;}) == false );
+            
+            THEN( "The rejected task is counted and never executed" )
+            {
+                dsl_ode_action_executor_stats stats{0};
+                pExecutor->GetStats(&stats);
+                REQUIRE( stats.queue_depth == 2 );
+                REQUIRE( stats.peak_queue_depth == 2 );
+                REQUIRE( stats.rejected == 1 );
+                
+                released = true;
+                wait_for_completed(pExecutor, 3);
+                REQUIRE( executed == 3 );
+            }
+        }
+        WHEN( "The queued tasks of a strand are cancelled" )
+        {
+            REQUIRE( pExecutor->Submit(&key, [&]()
+            {
+                while (!released)
+                {
+                    g_usleep(1000);
+                }
+                executed++;
+            }) == true );
+            wait_for_queue_empty(pExecutor);
+            
+            REQUIRE( pExecutor->Submit(&key, [&](){executed++;}) == true );
+            pExecutor->Cancel(&key);
+            
+            THEN( "Only the running task completes" )
+            {
+                released = true;
+                wait_for_completed(pExecutor, 1);
+                REQUIRE( executed == 1 );
+                
+                dsl_ode_action_executor_stats stats{0};
+                pExecutor->GetStats(&stats);
+                REQUIRE( stats.queue_depth == 0 );
+            }
+        }
+        REQUIRE( pExecutor->SetParams(1, 0) == false );
+        REQUIRE( pExecutor->SetParams(0, 2) == false );
+        REQUIRE( pExecutor->SetParams(DSL_ODE_ACTION_EXECUTOR_DEFAULT_MAX_WORKERS, 
+            DSL_ODE_ACTION_EXECUTOR_DEFAULT_QUEUE_CAPACITY) == true );
+    }
+}
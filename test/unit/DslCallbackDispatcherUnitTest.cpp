@@ -0,0 +1,284 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslCallbackDispatcher.h"
+
+using namespace DSL;
+
+static const dsl_callback_listener_stats* find_listener_stats(
+    CallbackDispatcher* pDispatcher, const std::wstring& name)
+{
+    const std::vector<dsl_callback_listener_stats>& stats = 
+        pDispatcher->GetStats();
+    for (auto const& ivec: stats)
+    {
+        if (name == ivec.name)
+        {
+            return &ivec;
+        }
+    }
+    return NULL;
+}
+
+static void wait_for_queue_empty(CallbackDispatcher* pDispatcher, 
+    const std::wstring& name)
+{
+    for (uint i = 0; i < 500; i++)
+    {
+        const dsl_callback_listener_stats* pStats = 
+            find_listener_stats(pDispatcher, name);
+        if (!pStats or !pStats->queue_depth)
+        {
+            return;
+        }
+        g_usleep(1000);
+    }
+}
+
+SCENARIO( "The CallbackDispatcher notifies each listener in order", 
+    "[CallbackDispatcher]" )
+{
+    GIVEN( "The CallbackDispatcher and two listeners of the same owner" ) 
+    {
+        CallbackDispatcher* pDispatcher = CallbackDispatcher::GetDispatcher();
+        REQUIRE( pDispatcher->SetParams(
+            DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY,
+            DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS) == true );
+        pDispatcher->ClearStats();
+        
+        int owner(0), listener1(0), listener2(0);
+        std::vector<uint> results1, results2;
+        
+        WHEN( "Notifications are dispatched to both listeners" )
+        {
+            for (uint i = 0; i < 20; i++)
+            {
+                REQUIRE( pDispatcher->Dispatch(&owner, &listener1, 
+                    "order-listener-1", [&results1, i](){results1.push_back(i);},
+                    false) == true );
+                REQUIRE( pDispatcher->Dispatch(&owner, &listener2, 
+                    "order-listener-2", [&results2, i](){results2.push_back(i);},
+                    false) == true );
+            }
+            wait_for_queue_empty(pDispatcher, L"order-listener-1");
+            wait_for_queue_empty(pDispatcher, L"order-listener-2");
+
+            // Remove and drop any notification that may still be running
+            g_usleep(10000);
+            pDispatcher->RemoveAllListeners(&owner);
+            
+            THEN( "Each listener is called in the order dispatched" )
+            {
+                REQUIRE( results1.size() == 20 );
+                REQUIRE( results2.size() == 20 );
+                for (uint i = 0; i < 20; i++)
+                {
+                    REQUIRE( results1[i] == i );
+                    REQUIRE( results2[i] == i );
+                }
+                REQUIRE( find_listener_stats(pDispatcher, 
+                    L"order-listener-1") == NULL );
+            }
+        }
+    }
+}
+
+SCENARIO( "The CallbackDispatcher isolates, coalesces, and bounds a slow listener", 
+    "[CallbackDispatcher]" )
+{
+    GIVEN( "The CallbackDispatcher with a small queue and a blocked listener" ) 
+    {
+        CallbackDispatcher* pDispatcher = CallbackDispatcher::GetDispatcher();
+        REQUIRE( pDispatcher->SetParams(4, 1) == true );
+        pDispatcher->ClearStats();
+        
+        int owner(0), slowListener(0), fastListener(0);
+        std::atomic<bool> release(false);
+        std::atomic<uint> fastCount(0);
+        std::vector<uint> slowResults;
+        
+        // Block the slow listener's worker on its first notification
+        REQUIRE( pDispatcher->Dispatch(&owner, &slowListener, "slow-listener",
+            [&]()
+            {
+                while (!release)
+                {
+                    g_usleep(1000);
+                }
+            }, false) == true );
+        wait_for_queue_empty(pDispatcher, L"slow-listener");
+        
+        WHEN( "Coalescable notifications are dispatched to the slow listener" )
+        {
+            for (uint i = 0; i < 10; i++)
+            {
+                REQUIRE( pDispatcher->Dispatch(&owner, &slowListener, 
+                    "slow-listener", [&slowResults, i](){slowResults.push_back(i);}, 
+                    true) == true );
+            }
+            REQUIRE( pDispatcher->Dispatch(&owner, &fastListener, 
+                "fast-listener", [&fastCount](){fastCount++;}, false) == true );
+            
+            THEN( "Only the latest is queued and other listeners are not blocked" )
+            {
+                for (uint i = 0; i < 500 and !fastCount; i++)
+                {
+                    g_usleep(1000);
+                }
+                REQUIRE( fastCount == 1 );
+                
+                const dsl_callback_listener_stats* pStats = 
+                    find_listener_stats(pDispatcher, L"slow-listener");
+                REQUIRE( pStats != NULL );
+                REQUIRE( pStats->queue_depth == 1 );
+                REQUIRE( pStats->coalesced == 9 );
+                REQUIRE( pStats->overflows == 0 );
+                
+                release = true;
+                wait_for_queue_empty(pDispatcher, L"slow-listener");
+                g_usleep(10000);
+                
+                pStats = find_listener_stats(pDispatcher, L"slow-listener");
+                REQUIRE( pStats->slow_count >= 1 );
+                REQUIRE( slowResults.size() == 1 );
+                REQUIRE( slowResults[0] == 9 );
+                
+                pDispatcher->RemoveAllListeners(&owner);
+            }
+        }
+        WHEN( "More notifications than the queue capacity are dispatched" )
+        {
+            for (uint i = 0; i < 4; i++)
+            {
+                REQUIRE( pDispatcher->Dispatch(&owner, &slowListener, 
+                    "slow-listener", [&slowResults, i](){slowResults.push_back(i);}, 
+                    false) == true );
+            }
+            REQUIRE( pDispatcher->Dispatch(&owner, &slowListener, 
+                "slow-listener", [&slowResults](){slowResults.push_back(4);}, 
+                false) == false );
+            
+            THEN( "The overflow is counted and the queued notifications are dropped on removal" )
+            {
+                const dsl_callback_listener_stats* pStats = 
+                    find_listener_stats(pDispatcher, L"slow-listener");
+                REQUIRE( pStats != NULL );
+                REQUIRE( pStats->queue_depth == 4 );
+                REQUIRE( pStats->peak_queue_depth == 4 );
+                REQUIRE( pStats->overflows == 1 );
+                
+                // Release the blocked callback only once removal is waiting
+                std::thread releaser([&release]()
+                {
+                    g_usleep(20000);
+                    release = true;
+                });
+                pDispatcher->RemoveListener(&owner, &slowListener);
+                
+                // Removal returns only once the callback in progress has
+                REQUIRE( release == true );
+                releaser.join();
+                g_usleep(10000);
+                
+                REQUIRE( slowResults.size() == 0 );
+                REQUIRE( find_listener_stats(pDispatcher, 
+                    L"slow-listener") == NULL );
+                
+                pDispatcher->RemoveAllListeners(&owner);
+            }
+        }
+        // Restore the defaults for all other test cases
+        release = true;
+        REQUIRE( pDispatcher->SetParams(
+            DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY,
+            DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS) == true );
+    }
+}
+
+SCENARIO( "The CallbackDispatcher rejects invalid params", "[CallbackDispatcher]" )
+{
+    GIVEN( "The CallbackDispatcher" ) 
+    {
+        CallbackDispatcher* pDispatcher = CallbackDispatcher::GetDispatcher();
+        uint queueCapacity(0), slowThreshold(0);
+
+        WHEN( "Invalid params are set" )
+        {
+            REQUIRE( pDispatcher->SetParams(0, 
+                DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS) == false );
+            REQUIRE( pDispatcher->SetParams(
+                DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY, 0) == false );
+            
+            THEN( "The current params are unchanged" )
+            {
+                pDispatcher->GetParams(&queueCapacity, &slowThreshold);
+                REQUIRE( queueCapacity == 
+                    DSL_CALLBACK_DISPATCHER_DEFAULT_QUEUE_CAPACITY );
+                REQUIRE( slowThreshold == 
+                    DSL_CALLBACK_DISPATCHER_DEFAULT_SLOW_THRESHOLD_MS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A CallbackDispatcher listener can remove itself from its callback", 
+    "[CallbackDispatcher]" )
+{
+    GIVEN( "The CallbackDispatcher and a listener" ) 
+    {
+        CallbackDispatcher* pDispatcher = CallbackDispatcher::GetDispatcher();
+        
+        int owner(0), listener(0);
+        std::atomic<bool> removed(false);
+        std::atomic<uint> count(0);
+        
+        WHEN( "The listener removes itself from its callback" )
+        {
+            for (uint i = 0; i < 2; i++)
+            {
+                REQUIRE( pDispatcher->Dispatch(&owner, &listener, 
+                    "self-remove-listener", [&]()
+                    {
+                        count++;
+                        pDispatcher->RemoveListener(&owner, &listener);
+                        removed = true;
+                    }, false) == true );
+            }
+            for (uint i = 0; i < 500 and !removed; i++)
+            {
+                g_usleep(1000);
+            }
+            g_usleep(10000);
+            
+            THEN( "The removal does not wait and its queued notifications are dropped" )
+            {
+                REQUIRE( removed == true );
+                REQUIRE( count == 1 );
+                REQUIRE( find_listener_stats(pDispatcher, 
+                    L"self-remove-listener") == NULL );
+            }
+        }
+    }
+}
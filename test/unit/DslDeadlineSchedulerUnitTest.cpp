@@ -0,0 +1,188 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslDeadlineScheduler.h"
+
+using namespace DSL;
+
+static int deadline_missed_cb(gpointer pCount)
+{
+    (*(uint*)pCount)++;
+    
+    // single shot
+    return false;
+}
+
+static int deadline_rearm_cb(gpointer pCount)
+{
+    (*(uint*)pCount)++;
+    
+    // re-arm
+    return true;
+}
+
+/**
+ * @brief iterates the default main-context until the missed count is 
+ * reached or until timeout.
+ */
+static void iterate_until(uint& count, uint expected, uint timeoutMs)
+{
+    uint64_t endTime = DeadlineScheduler::Now() + (uint64_t)timeoutMs*1000000;
+    while (count < expected and DeadlineScheduler::Now() < endTime)
+    {
+        g_main_context_iteration(NULL, FALSE);
+        g_usleep(1000);
+    }
+}
+
+SCENARIO( "The DeadlineScheduler adds and removes watches correctly", "[DeadlineScheduler]" )
+{
+    GIVEN( "The DeadlineScheduler and a timestamp to watch" ) 
+    {
+        DeadlineScheduler* pScheduler = DeadlineScheduler::GetScheduler();
+        std::atomic<uint64_t> timestamp(0);
+        uint count(0);
+        
+        uint numWatches = pScheduler->GetNumWatches();
+
+        WHEN( "A new watch is added" )
+        {
+            uint watchId = pScheduler->AddWatch(&timestamp, 10000, 
+                deadline_missed_cb, &count, NULL);
+            REQUIRE( watchId != 0 );
+            REQUIRE( pScheduler->GetNumWatches() == numWatches+1 );
+
+            THEN( "The same watch can be updated and removed only once" )
+            {
+                REQUIRE( pScheduler->SetWatchTimeout(watchId, 20000) == true );
+                REQUIRE( pScheduler->RemoveWatch(watchId) == true );
+                REQUIRE( pScheduler->GetNumWatches() == numWatches );
+                REQUIRE( pScheduler->RemoveWatch(watchId) == false );
+                REQUIRE( pScheduler->SetWatchTimeout(watchId, 10000) == false );
+                REQUIRE( count == 0 );
+            }
+        }
+        WHEN( "A watch is added with invalid parameters" )
+        {
+            THEN( "The watch is rejected" )
+            {
+                REQUIRE( pScheduler->AddWatch(NULL, 100, 
+                    deadline_missed_cb, &count, NULL) == 0 );
+                REQUIRE( pScheduler->AddWatch(&timestamp, 100, 
+                    NULL, &count, NULL) == 0 );
+                REQUIRE( pScheduler->GetNumWatches() == numWatches );
+            }
+        }
+    }
+}
+
+SCENARIO( "The DeadlineScheduler calls the handler on missed deadline", "[DeadlineScheduler]" )
+{
+    GIVEN( "The DeadlineScheduler and a timestamp that is never updated" ) 
+    {
+        DeadlineScheduler* pScheduler = DeadlineScheduler::GetScheduler();
+        std::atomic<uint64_t> timestamp(0);
+        uint count(0);
+        
+        uint numWatches = pScheduler->GetNumWatches();
+        uint64_t missedCount = pScheduler->GetMissedCount();
+
+        WHEN( "A single shot watch is added" )
+        {
+            uint64_t startTime = DeadlineScheduler::Now();
+            uint watchId = pScheduler->AddWatch(&timestamp, 50, 
+                deadline_missed_cb, &count, NULL);
+            
+            iterate_until(count, 1, 1000);
+
+            THEN( "The handler is called once, no sooner than the timeout" )
+            {
+                REQUIRE( count == 1 );
+                REQUIRE( DeadlineScheduler::Now() - startTime >= 50000000 );
+                REQUIRE( pScheduler->GetMissedCount() == missedCount+1 );
+                
+                // the watch is removed on handler return of false
+                REQUIRE( pScheduler->GetNumWatches() == numWatches );
+                REQUIRE( pScheduler->RemoveWatch(watchId) == false );
+            }
+        }
+        WHEN( "A re-arming watch is added" )
+        {
+            uint watchId = pScheduler->AddWatch(&timestamp, 20, 
+                deadline_rearm_cb, &count, NULL);
+            
+            iterate_until(count, 3, 1000);
+
+            THEN( "The handler is called on each missed deadline until removed" )
+            {
+                REQUIRE( count >= 3 );
+                REQUIRE( pScheduler->RemoveWatch(watchId) == true );
+                REQUIRE( pScheduler->GetNumWatches() == numWatches );
+            }
+        }
+    }
+}
+
+SCENARIO( "The DeadlineScheduler does not call the handler while activity is recorded", 
+    "[DeadlineScheduler]" )
+{
+    GIVEN( "The DeadlineScheduler and a timestamp to watch" ) 
+    {
+        DeadlineScheduler* pScheduler = DeadlineScheduler::GetScheduler();
+        std::atomic<uint64_t> timestamp(0);
+        uint count(0);
+
+        uint watchId = pScheduler->AddWatch(&timestamp, 50, 
+            deadline_missed_cb, &count, NULL);
+
+        WHEN( "The timestamp is updated more frequently than the timeout" )
+        {
+            uint64_t endTime = DeadlineScheduler::Now() + 300000000;
+            while (DeadlineScheduler::Now() < endTime)
+            {
+                timestamp.store(DeadlineScheduler::Now());
+                g_main_context_iteration(NULL, FALSE);
+                g_usleep(5000);
+            }
+
+            THEN( "The deadline is never missed" )
+            {
+                REQUIRE( count == 0 );
+            }
+            AND_WHEN( "The timestamp updates stop" )
+            {
+                iterate_until(count, 1, 1000);
+                
+                THEN( "The deadline is missed and the handler called" )
+                {
+                    REQUIRE( count == 1 );
+                    REQUIRE( pScheduler->RemoveWatch(watchId) == false );
+                }
+            }
+        }
+        pScheduler->RemoveWatch(watchId);
+    }
+}
@@ -0,0 +1,260 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslDisplayMetaBuilder.h"
+
+using namespace DSL;
+
+SCENARIO( "A disabled DisplayMetaBuilder adds no elements", "[DisplayMetaBuilder]" )
+{
+    GIVEN( "A DisplayMetaBuilder with no batch meta" ) 
+    {
+        DisplayMetaBuilder displayMetaBuilder;
+
+        WHEN( "Elements are added" )
+        {
+            THEN( "No elements or Display Meta are returned" )
+            {
+                REQUIRE( displayMetaBuilder.IsEnabled() == false );
+                REQUIRE( displayMetaBuilder.AddRect() == NULL );
+                REQUIRE( displayMetaBuilder.AddText() == NULL );
+                REQUIRE( displayMetaBuilder.GetDisplayMeta() == NULL );
+                REQUIRE( displayMetaBuilder.GetAcquiredCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A DisplayMetaBuilder acquires Display Meta only when needed", 
+    "[DisplayMetaBuilder]" )
+{
+    GIVEN( "A DisplayMetaBuilder for a new batch" ) 
+    {
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        
+        DisplayMetaBuilder displayMetaBuilder(pBatchMeta, 
+            DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED);
+            
+        REQUIRE( displayMetaBuilder.IsEnabled() == true );
+        REQUIRE( displayMetaBuilder.GetAcquiredCount() == 0 );
+
+        WHEN( "A single element of each kind is added" )
+        {
+            REQUIRE( displayMetaBuilder.AddRect() != NULL );
+            REQUIRE( displayMetaBuilder.AddText() != NULL );
+            REQUIRE( displayMetaBuilder.AddLine() != NULL );
+            REQUIRE( displayMetaBuilder.AddArrow() != NULL );
+            REQUIRE( displayMetaBuilder.AddCircle() != NULL );
+
+            THEN( "All elements share a single Display Meta" )
+            {
+                REQUIRE( displayMetaBuilder.GetAcquiredCount() == 1 );
+                
+                NvDsDisplayMeta* pDisplayMeta = displayMetaBuilder.GetDisplayMeta();
+                REQUIRE( pDisplayMeta->num_rects == 1 );
+                REQUIRE( pDisplayMeta->num_labels == 1 );
+                REQUIRE( pDisplayMeta->num_lines == 1 );
+                REQUIRE( pDisplayMeta->num_arrows == 1 );
+                REQUIRE( pDisplayMeta->num_circles == 1 );
+            }
+        }
+        WHEN( "More rectangles are added than fit in a single Display Meta" )
+        {
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META*3 + 1; i++)
+            {
+                REQUIRE( displayMetaBuilder.AddRect() != NULL );
+            }
+            // followed by a single line
+            REQUIRE( displayMetaBuilder.AddLine() != NULL );
+
+            THEN( "Display Meta is acquired as needed and shared by kind" )
+            {
+                REQUIRE( displayMetaBuilder.GetAcquiredCount() == 4 );
+                
+                // the line is added to the first Display Meta.
+                REQUIRE( displayMetaBuilder.GetDisplayMeta()->num_lines == 1 );
+            }
+        }
+        WHEN( "The maximum number of Display Meta is limited" )
+        {
+            DisplayMetaBuilder limitedBuilder(pBatchMeta, 1);
+            
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META; i++)
+            {
+                REQUIRE( limitedBuilder.AddRect() != NULL );
+            }
+
+            THEN( "No more elements of the same kind can be added" )
+            {
+                REQUIRE( limitedBuilder.AddRect() == NULL );
+                REQUIRE( limitedBuilder.AddText() != NULL );
+                REQUIRE( limitedBuilder.GetAcquiredCount() == 1 );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
+
+SCENARIO( "A DisplayMetaBuilder with a size of 0 is disabled", "[DisplayMetaBuilder]" )
+{
+    GIVEN( "A DisplayMetaBuilder for a new batch with a size of 0" ) 
+    {
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        
+        DisplayMetaBuilder displayMetaBuilder(pBatchMeta, 0);
+
+        WHEN( "Elements are added" )
+        {
+            THEN( "No elements or Display Meta are returned" )
+            {
+                REQUIRE( displayMetaBuilder.IsEnabled() == false );
+                REQUIRE( displayMetaBuilder.AddRect() == NULL );
+                REQUIRE( displayMetaBuilder.GetDisplayMeta() == NULL );
+                REQUIRE( displayMetaBuilder.GetAcquiredCount() == 0 );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
+
+SCENARIO( "A recording DisplayMetaBuilder records elements in a DisplayTemplate", 
+    "[DisplayMetaBuilder]" )
+{
+    GIVEN( "A recording DisplayMetaBuilder for a new DisplayTemplate" ) 
+    {
+        DisplayTemplate displayTemplate;
+        
+        DisplayMetaBuilder recorder(displayTemplate);
+        
+        REQUIRE( recorder.IsEnabled() == true );
+
+        WHEN( "A single element of each kind is added" )
+        {
+            REQUIRE( recorder.AddRect() != NULL );
+            REQUIRE( recorder.AddText() != NULL );
+            REQUIRE( recorder.AddLine() != NULL );
+            REQUIRE( recorder.AddArrow() != NULL );
+            REQUIRE( recorder.AddCircle() != NULL );
+
+            THEN( "All elements are recorded and no Display Meta is acquired" )
+            {
+                REQUIRE( displayTemplate.GetElementCount() == 5 );
+                REQUIRE( recorder.GetDisplayMeta() == NULL );
+                REQUIRE( recorder.GetAcquiredCount() == 0 );
+                
+                displayTemplate.Clear();
+                REQUIRE( displayTemplate.GetElementCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A DisplayMetaBuilder adds a DisplayTemplate correctly", 
+    "[DisplayMetaBuilder]" )
+{
+    GIVEN( "A DisplayTemplate with recorded lines and text" ) 
+    {
+        DisplayTemplate displayTemplate;
+        DisplayMetaBuilder recorder(displayTemplate);
+        
+        uint numLines(MAX_ELEMENTS_IN_DISPLAY_META + 2);
+        
+        for (uint i = 0; i < numLines; i++)
+        {
+            recorder.AddLine()->x1 = i;
+        }
+        NvOSD_TextParams* pTextParams = recorder.AddText();
+        pTextParams->display_text = g_strdup("static-text");
+        pTextParams->font_params.font_name = g_strdup("arial");
+        
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        
+        WHEN( "The DisplayTemplate is added" )
+        {
+            DisplayMetaBuilder displayMetaBuilder(pBatchMeta, 
+                DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED);
+                
+            // single line added first to offset the copied block
+            REQUIRE( displayMetaBuilder.AddLine() != NULL );
+            
+            REQUIRE( displayMetaBuilder.AddTemplate(displayTemplate) == true );
+
+            THEN( "The elements are copied in order across Display Meta" )
+            {
+                REQUIRE( displayMetaBuilder.GetAcquiredCount() == 2 );
+                
+                NvDsDisplayMeta* pDisplayMeta = displayMetaBuilder.GetDisplayMeta();
+                REQUIRE( pDisplayMeta->num_lines == MAX_ELEMENTS_IN_DISPLAY_META );
+                REQUIRE( pDisplayMeta->line_params[1].x1 == 0 );
+                REQUIRE( pDisplayMeta->line_params[
+                    MAX_ELEMENTS_IN_DISPLAY_META-1].x1 == 
+                        MAX_ELEMENTS_IN_DISPLAY_META-2 );
+                    
+                // the text strings are copied, not shared with the template
+                REQUIRE( pDisplayMeta->num_labels == 1 );
+                REQUIRE( std::string(pDisplayMeta->text_params[0].display_text) ==
+                    "static-text" );
+                REQUIRE( pDisplayMeta->text_params[0].display_text != 
+                    pTextParams->display_text );
+            }
+        }
+        WHEN( "The DisplayTemplate is added with a limited Display Meta size" )
+        {
+            DisplayMetaBuilder limitedBuilder(pBatchMeta, 1);
+            
+            THEN( "The elements that do not fit are not added" )
+            {
+                REQUIRE( limitedBuilder.AddTemplate(displayTemplate) == false );
+                REQUIRE( limitedBuilder.GetAcquiredCount() == 1 );
+                REQUIRE( limitedBuilder.GetDisplayMeta()->num_lines == 
+                    MAX_ELEMENTS_IN_DISPLAY_META );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
+
+SCENARIO( "A DisplayMetaBuilder tracks the first add for each owner", 
+    "[DisplayMetaBuilder]" )
+{
+    GIVEN( "A DisplayMetaBuilder and two owners" ) 
+    {
+        DisplayTemplate displayTemplate;
+        DisplayMetaBuilder displayMetaBuilder(displayTemplate);
+        
+        int owner1(0), owner2(0);
+
+        WHEN( "Each owner adds more than once" )
+        {
+            THEN( "Only the first add for each owner is reported" )
+            {
+                REQUIRE( displayMetaBuilder.IsFirstAdd(&owner1) == true );
+                REQUIRE( displayMetaBuilder.IsFirstAdd(&owner2) == true );
+                REQUIRE( displayMetaBuilder.IsFirstAdd(&owner1) == false );
+                REQUIRE( displayMetaBuilder.IsFirstAdd(&owner2) == false );
+            }
+        }
+    }
+}
@@ -351,6 +351,90 @@ SCENARIO( "A RGBA Polygon is constructed correctly", "[DisplayTypes]" )
     }
 }
 
+SCENARIO( "A static RGBA Polygon can be compiled into a DisplayTemplate", 
+    "[DisplayTypes]" )
+{
+    GIVEN( "A new RGBA Polygon with a static color" )
+    {
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        std::string colorName  = "my-custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), 
+            red, green, blue, alpha);
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+            
+        REQUIRE( pPolygon->IsStatic() == true );
+        
+        WHEN( "The RGBA Polygon is compiled" )
+        {
+            DisplayTemplate displayTemplate;
+            pPolygon->CompileMeta(displayTemplate);
+            
+            THEN( "One line is recorded for each side" )
+            {
+                REQUIRE( displayTemplate.GetElementCount() == numCoordinates );
+            }
+        }
+    }
+}
+
+SCENARIO( "Display Types with dynamic colors are not static", "[DisplayTypes]" )
+{
+    GIVEN( "A new RGBA Random Color" )
+    {
+        DSL_RGBA_RANDOM_COLOR_PTR pColor = DSL_RGBA_RANDOM_COLOR_NEW(
+            "my-random-color", DSL_COLOR_HUE_RANDOM, 
+            DSL_COLOR_LUMINOSITY_RANDOM, 1.0, 123);
+        
+        REQUIRE( pColor->IsStatic() == false );
+        
+        WHEN( "A RGBA Line is created with the Random Color" )
+        {
+            DSL_RGBA_LINE_PTR pLine = DSL_RGBA_LINE_NEW("my-line", 
+                10, 10, 100, 100, 4, pColor);
+            
+            THEN( "The RGBA Line is not static" )
+            {
+                REQUIRE( pLine->IsStatic() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "Adding a shadow to RGBA Text increments its version", "[DisplayTypes]" )
+{
+    GIVEN( "A new RGBA Text with static colors" )
+    {
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-color", 
+            0.1, 0.2, 0.3, 1.0);
+        DSL_RGBA_FONT_PTR pFont = DSL_RGBA_FONT_NEW("my-font", 
+            "arial", 12, pColor);
+        DSL_RGBA_TEXT_PTR pText = DSL_RGBA_TEXT_NEW("my-text", 
+            "some-text", 10, 10, pFont, false, pColor);
+            
+        REQUIRE( pText->IsStatic() == true );
+        
+        uint version = pText->GetVersion();
+        
+        WHEN( "A shadow is added" )
+        {
+            REQUIRE( pText->AddShadow(2, 2, pColor) == true );
+            
+            THEN( "The version is incremented" )
+            {
+                REQUIRE( pText->GetVersion() == version + 1 );
+                REQUIRE( pText->IsStatic() == true );
+            }
+        }
+    }
+}
+
 SCENARIO( "A RGBA Multi-Line is constructed correctly", "[DisplayTypes]" )
 {
     GIVEN( "Attrubutes for a new RGBA Multi-Line" )
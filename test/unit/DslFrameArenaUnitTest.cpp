@@ -0,0 +1,238 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslFrameArena.h"
+
+using namespace DSL;
+
+SCENARIO( "A new FrameArena is created correctly", "[FrameArena]" )
+{
+    GIVEN( "Attributes for a new FrameArena" ) 
+    {
+        size_t blockSize(1024);
+
+        WHEN( "A new FrameArena is created" )
+        {
+            FrameArena frameArena(blockSize);
+
+            THEN( "The FrameArena's counters are setup and returned correctly" )
+            {
+                REQUIRE( frameArena.GetCapacity() == blockSize );
+                REQUIRE( frameArena.GetAllocationCount() == 0 );
+                REQUIRE( frameArena.GetBlockAllocationCount() == 1 );
+                REQUIRE( frameArena.GetResetCount() == 0 );
+                REQUIRE( frameArena.GetBytesInUse() == 0 );
+                REQUIRE( frameArena.GetPeakBytesInUse() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FrameArena allocates aligned memory", "[FrameArena]" )
+{
+    GIVEN( "A new FrameArena" ) 
+    {
+        FrameArena frameArena(1024);
+
+        WHEN( "Allocations with different alignments are made" )
+        {
+            void* p1 = frameArena.Allocate(3, 1);
+            void* p2 = frameArena.Allocate(8, 8);
+            void* p3 = frameArena.Allocate(16, 16);
+
+            THEN( "Each allocation is correctly aligned and counted" )
+            {
+                REQUIRE( p1 != NULL );
+                REQUIRE( ((uintptr_t)p2 % 8) == 0 );
+                REQUIRE( ((uintptr_t)p3 % 16) == 0 );
+                REQUIRE( p1 != p2 );
+                REQUIRE( p2 != p3 );
+                REQUIRE( frameArena.GetAllocationCount() == 3 );
+                REQUIRE( frameArena.GetBlockAllocationCount() == 1 );
+                REQUIRE( frameArena.GetBytesInUse() > 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FrameArena coalesces its blocks on Reset", "[FrameArena]" )
+{
+    GIVEN( "A new FrameArena with a small initial block" ) 
+    {
+        FrameArena frameArena(256);
+
+        WHEN( "A batch overflows the initial block" )
+        {
+            for (uint i = 0; i < 64; i++)
+            {
+                frameArena.Allocate(64, 8);
+            }
+            uint64_t blockAllocations = frameArena.GetBlockAllocationCount();
+            REQUIRE( blockAllocations > 1 );
+            
+            frameArena.Reset();
+
+            THEN( "Subsequent batches of the same size allocate no new blocks" )
+            {
+                // One more block allocation for the coalesced block.
+                REQUIRE( frameArena.GetBlockAllocationCount() == 
+                    blockAllocations + 1 );
+                REQUIRE( frameArena.GetPeakBytesInUse() >= 64*64 );
+                
+                for (uint j = 0; j < 10; j++)
+                {
+                    for (uint i = 0; i < 64; i++)
+                    {
+                        frameArena.Allocate(64, 8);
+                    }
+                    frameArena.Reset();
+                }
+                REQUIRE( frameArena.GetBlockAllocationCount() == 
+                    blockAllocations + 1 );
+                REQUIRE( frameArena.GetResetCount() == 11 );
+                REQUIRE( frameArena.GetAllocationCount() == 64*11 );
+                REQUIRE( frameArena.GetBytesInUse() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FrameArenaScope installs and restores the current FrameArena", 
+    "[FrameArena]" )
+{
+    GIVEN( "Two new FrameArenas" ) 
+    {
+        FrameArena outerArena, innerArena;
+        
+        REQUIRE( FrameArena::GetCurrent() == NULL );
+
+        WHEN( "The FrameArenas are installed with nested scopes" )
+        {
+            THEN( "The innermost FrameArena is current and restored on exit" )
+            {
+                {
+                    FrameArenaScope outerScope(&outerArena);
+                    REQUIRE( FrameArena::GetCurrent() == &outerArena );
+                    {
+                        FrameArenaScope innerScope(&innerArena, true);
+                        REQUIRE( FrameArena::GetCurrent() == &innerArena );
+                        innerArena.Allocate(8, 8);
+                    }
+                    REQUIRE( FrameArena::GetCurrent() == &outerArena );
+                    REQUIRE( innerArena.GetResetCount() == 1 );
+                    REQUIRE( outerArena.GetResetCount() == 0 );
+                }
+                REQUIRE( FrameArena::GetCurrent() == NULL );
+            }
+        }
+    }
+}
+
+SCENARIO( "FrameArena containers allocate from the current FrameArena", 
+    "[FrameArena]" )
+{
+    GIVEN( "A new FrameArena" ) 
+    {
+        FrameArena frameArena;
+
+        WHEN( "Containers are created within a FrameArenaScope" )
+        {
+            FrameArenaScope frameArenaScope(&frameArena);
+            
+            FrameArenaVector<uint> values;
+            for (uint i = 0; i < 100; i++)
+            {
+                values.push_back(i);
+            }
+            FrameArenaString text;
+            text.append(std::string(64, 'x'));
+
+            THEN( "Their memory is served by the FrameArena" )
+            {
+                REQUIRE( values.size() == 100 );
+                REQUIRE( values[99] == 99 );
+                REQUIRE( text.size() == 64 );
+                REQUIRE( values.get_allocator().GetArena() == &frameArena );
+                REQUIRE( frameArena.GetAllocationCount() > 0 );
+                REQUIRE( frameArena.GetBlockAllocationCount() == 1 );
+            }
+        }
+        WHEN( "Containers are created outside of a FrameArenaScope" )
+        {
+            FrameArenaVector<uint> values;
+            values.push_back(1);
+
+            THEN( "Their memory is served by the heap" )
+            {
+                REQUIRE( values.get_allocator().GetArena() == NULL );
+                REQUIRE( frameArena.GetAllocationCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FrameArena can be allocated from by multiple threads", "[FrameArena]" )
+{
+    GIVEN( "A new FrameArena with a small initial block" ) 
+    {
+        FrameArena frameArena(256);
+
+        WHEN( "Multiple threads allocate concurrently" )
+        {
+            std::vector<std::thread> threads;
+            std::vector<std::vector<uint64_t*>> results(4);
+            
+            for (uint t = 0; t < 4; t++)
+            {
+                threads.push_back(std::thread([&frameArena, &results, t]()
+                {
+                    for (uint i = 0; i < 1000; i++)
+                    {
+                        uint64_t* pValue = (uint64_t*)frameArena.Allocate(
+                            sizeof(uint64_t), alignof(uint64_t));
+                        *pValue = t*1000 + i;
+                        results[t].push_back(pValue);
+                    }
+                }));
+            }
+            for (auto& ivec: threads)
+            {
+                ivec.join();
+            }
+
+            THEN( "Every allocation is distinct and intact" )
+            {
+                for (uint t = 0; t < 4; t++)
+                {
+                    for (uint i = 0; i < 1000; i++)
+                    {
+                        REQUIRE( *results[t][i] == t*1000 + i );
+                    }
+                }
+                REQUIRE( frameArena.GetAllocationCount() == 4000 );
+            }
+        }
+    }
+}
@@ -0,0 +1,179 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslLatencyHistogram.h"
+
+using namespace DSL;
+
+SCENARIO( "A new LatencyHistogram is created correctly", "[LatencyHistogram]" )
+{
+    GIVEN( "A new LatencyHistogram" ) 
+    {
+        LatencyHistogram histogram;
+
+        WHEN( "No values have been recorded" )
+        {
+            dsl_latency_stats stats = {99, 99, 99, 99, 99, 99, 99};
+            histogram.GetStats(&stats);
+
+            THEN( "All stats are 0" )
+            {
+                REQUIRE( histogram.GetCount() == 0 );
+                REQUIRE( stats.count == 0 );
+                REQUIRE( stats.min == 0 );
+                REQUIRE( stats.max == 0 );
+                REQUIRE( stats.mean == 0 );
+                REQUIRE( stats.p50 == 0 );
+                REQUIRE( stats.p99 == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LatencyHistogram records small values exactly", "[LatencyHistogram]" )
+{
+    GIVEN( "A new LatencyHistogram" ) 
+    {
+        LatencyHistogram histogram;
+
+        WHEN( "Values below the sub-bucket count are recorded" )
+        {
+            for (uint64_t i = 1; i <= 10; i++)
+            {
+                histogram.Record(i);
+            }
+            dsl_latency_stats stats;
+            histogram.GetStats(&stats);
+
+            THEN( "The stats are exact" )
+            {
+                REQUIRE( stats.count == 10 );
+                REQUIRE( stats.min == 1 );
+                REQUIRE( stats.max == 10 );
+                REQUIRE( stats.mean == 5 );
+                REQUIRE( stats.p50 == 5 );
+                REQUIRE( stats.p90 == 9 );
+                REQUIRE( stats.p99 == 10 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LatencyHistogram records large values within its precision", 
+    "[LatencyHistogram]" )
+{
+    GIVEN( "A new LatencyHistogram" ) 
+    {
+        LatencyHistogram histogram;
+
+        WHEN( "A wide range of values is recorded" )
+        {
+            // 1 us to 1000 us in steps of 1 us
+            for (uint64_t i = 1; i <= 1000; i++)
+            {
+                histogram.Record(i*1000);
+            }
+            
+            THEN( "The percentiles are within 1/16th of the exact values" )
+            {
+                REQUIRE( histogram.GetCount() == 1000 );
+                
+                uint64_t p50 = histogram.GetPercentile(50.0);
+                uint64_t p90 = histogram.GetPercentile(90.0);
+                uint64_t p99 = histogram.GetPercentile(99.0);
+                
+                REQUIRE( p50 >= 500000 - 500000/16 );
+                REQUIRE( p50 <= 500000 + 500000/16 );
+                REQUIRE( p90 >= 900000 - 900000/16 );
+                REQUIRE( p90 <= 900000 + 900000/16 );
+                REQUIRE( p99 >= 990000 - 990000/16 );
+                REQUIRE( p99 <= 1000000 );
+                REQUIRE( histogram.GetPercentile(100.0) >= 1000000 - 1000000/16 );
+                REQUIRE( histogram.GetPercentile(100.0) <= 1000000 );
+            }
+        }
+        WHEN( "A value beyond the highest bucket is recorded" )
+        {
+            histogram.Record(UINT64_MAX/2);
+            
+            THEN( "The value is counted and returned as the maximum" )
+            {
+                REQUIRE( histogram.GetCount() == 1 );
+                REQUIRE( histogram.GetPercentile(50.0) == UINT64_MAX/2 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LatencyHistogram can be cleared", "[LatencyHistogram]" )
+{
+    GIVEN( "A LatencyHistogram with recorded values" ) 
+    {
+        LatencyHistogram histogram;
+        histogram.Record(100);
+        histogram.Record(200);
+
+        WHEN( "The LatencyHistogram is cleared" )
+        {
+            histogram.Clear();
+            
+            THEN( "All stats are reset" )
+            {
+                dsl_latency_stats stats;
+                histogram.GetStats(&stats);
+                REQUIRE( stats.count == 0 );
+                REQUIRE( stats.min == 0 );
+                REQUIRE( stats.max == 0 );
+                
+                histogram.Record(50);
+                histogram.GetStats(&stats);
+                REQUIRE( stats.min == 50 );
+                REQUIRE( stats.max == 50 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The CycleCounter measures elapsed time", "[LatencyHistogram]" )
+{
+    GIVEN( "A calibrated CycleCounter" ) 
+    {
+        REQUIRE( CycleCounter::GetNanosecondsPerCycle() > 0.0 );
+
+        WHEN( "The calling thread sleeps" )
+        {
+            uint64_t start = CycleCounter::Now();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            uint64_t elapsed = CycleCounter::ToNanoseconds(
+                CycleCounter::Now() - start);
+            
+            THEN( "The elapsed time is at least the time slept" )
+            {
+                REQUIRE( elapsed >= 9000000 );
+                REQUIRE( elapsed < 1000000000 );
+            }
+        }
+    }
+}
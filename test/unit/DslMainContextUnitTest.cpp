@@ -0,0 +1,153 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslMainContext.h"
+
+using namespace DSL;
+
+static int source_cb(gpointer pCount)
+{
+    (*(uint*)pCount)++;
+    
+    // single shot
+    return false;
+}
+
+/**
+ * @brief iterates a main-context, without blocking, until the count 
+ * is reached or until timeout.
+ */
+static void iterate_until(GMainContext* pMainContext, 
+    uint& count, uint expected, uint timeoutMs)
+{
+    gint64 endTime = g_get_monotonic_time() + (gint64)timeoutMs*1000;
+    while (count < expected and g_get_monotonic_time() < endTime)
+    {
+        g_main_context_iteration(pMainContext, FALSE);
+        g_usleep(1000);
+    }
+}
+
+SCENARIO( "A MainContextSource without an owner attaches to the default main-context", 
+    "[MainContext]" )
+{
+    GIVEN( "A new MainContextSource" ) 
+    {
+        MainContextSource source;
+        uint count(0);
+        
+        REQUIRE( !source );
+        
+        WHEN( "An idle source is added without an owner" )
+        {
+            REQUIRE( source.AddIdle(NULL, source_cb, &count) == true );
+            REQUIRE( source );
+            
+            THEN( "The source is called on the default main-context" )
+            {
+                iterate_until(NULL, count, 1, 1000);
+                REQUIRE( count == 1 );
+                
+                source.Clear();
+                REQUIRE( !source );
+            }
+        }
+        WHEN( "A timeout source is added and then removed" )
+        {
+            REQUIRE( source.AddTimeout(NULL, 10, source_cb, &count) == true );
+            REQUIRE( source.Remove() == true );
+            REQUIRE( !source );
+            
+            THEN( "The source is never called" )
+            {
+                iterate_until(NULL, count, 1, 50);
+                REQUIRE( count == 0 );
+                REQUIRE( source.Remove() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MainContextSource attaches to its owning Pipeline's main-context", 
+    "[MainContext]" )
+{
+    GIVEN( "A Pipeline with its own main-context and a child bin" ) 
+    {
+        GstElement* pPipeline = gst_pipeline_new("test-pipeline");
+        GstElement* pBin = gst_bin_new("test-bin");
+        gst_bin_add(GST_BIN(pPipeline), pBin);
+        
+        GMainContext* pMainContext = g_main_context_new();
+        MainContextSource::SetPipelineContext(GST_OBJECT(pPipeline), 
+            pMainContext);
+        
+        MainContextSource source;
+        uint count(0);
+        
+        WHEN( "An idle source is added with the child bin as owner" )
+        {
+            REQUIRE( source.AddIdle(GST_OBJECT(pBin), source_cb, &count) == true );
+            
+            THEN( "The source is called on the Pipeline's main-context only" )
+            {
+                iterate_until(NULL, count, 1, 50);
+                REQUIRE( count == 0 );
+                iterate_until(pMainContext, count, 1, 1000);
+                REQUIRE( count == 1 );
+            }
+        }
+        WHEN( "An idle source is added without an owner within a scope" )
+        {
+            {
+                MainContextScope mainContextScope(GST_OBJECT(pBin));
+                REQUIRE( source.AddIdle(NULL, source_cb, &count) == true );
+            }
+            REQUIRE( MainContextSource::GetCurrentOwner() == NULL );
+            
+            THEN( "The source is called on the Pipeline's main-context" )
+            {
+                iterate_until(pMainContext, count, 1, 1000);
+                REQUIRE( count == 1 );
+            }
+        }
+        WHEN( "The Pipeline's main-context is cleared" )
+        {
+            MainContextSource::SetPipelineContext(GST_OBJECT(pPipeline), NULL);
+            REQUIRE( source.AddIdle(GST_OBJECT(pBin), source_cb, &count) == true );
+            
+            THEN( "The source is called on the default main-context" )
+            {
+                iterate_until(pMainContext, count, 1, 50);
+                REQUIRE( count == 0 );
+                iterate_until(NULL, count, 1, 1000);
+                REQUIRE( count == 1 );
+            }
+        }
+        source.Remove();
+        gst_object_unref(pPipeline);
+        g_main_context_unref(pMainContext);
+    }
+}
@@ -0,0 +1,326 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslMetaExportReader.h"
+#include "DslMetaExportWriter.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace DSL;
+
+static const std::string readerName("meta-export-reader");
+static const std::string filePath("./meta-replay-test.bin");
+
+// Builds a batch record with numFrames frames, each with one labeled object
+// and one classifier label.
+static std::vector<uint8_t> new_test_record(uint64_t pts, uint16_t numFrames)
+{
+    std::vector<uint8_t> record(sizeof(dsl_meta_export_batch));
+    
+    for (uint16_t i = 0; i < numFrames; i++)
+    {
+        dsl_meta_export_frame frame{0};
+        frame.source_id = i;
+        frame.frame_num = pts;
+        frame.num_objects = 1;
+        
+        dsl_meta_export_object object{0};
+        object.object_id = pts;
+        object.class_id = i;
+        object.left = 10;
+        object.num_classifier_labels = 1;
+        object.label_length = 6;
+        
+        dsl_meta_export_label label{2, 3, 0.5, 3};
+        
+        const uint8_t* pBytes = (const uint8_t*)&frame;
+        record.insert(record.end(), pBytes, pBytes + sizeof(frame));
+        pBytes = (const uint8_t*)&object;
+        record.insert(record.end(), pBytes, pBytes + sizeof(object));
+        pBytes = (const uint8_t*)"person";
+        record.insert(record.end(), pBytes, pBytes + 6);
+        pBytes = (const uint8_t*)&label;
+        record.insert(record.end(), pBytes, pBytes + sizeof(label));
+        pBytes = (const uint8_t*)"red";
+        record.insert(record.end(), pBytes, pBytes + 3);
+    }
+    dsl_meta_export_batch batch{(uint32_t)record.size(), 
+        DSL_META_EXPORT_RECORD_TYPE_BATCH, numFrames, pts};
+    memcpy(&record[0], &batch, sizeof(batch));
+    
+    return record;
+}
+
+static void append_stream_header(std::vector<uint8_t>& stream)
+{
+    dsl_meta_export_stream_header header{DSL_META_EXPORT_STREAM_MAGIC,
+        DSL_META_EXPORT_VERSION, 0, 1234};
+    const uint8_t* pBytes = (const uint8_t*)&header;
+    stream.insert(stream.end(), pBytes, pBytes + sizeof(header));
+}
+
+static void append_block(std::vector<uint8_t>& stream, 
+    const std::vector<uint8_t>& payload, uint numRecords)
+{
+    dsl_meta_export_block_header header{DSL_META_EXPORT_BLOCK_MAGIC,
+        DSL_META_EXPORT_CODEC_NONE, 0, numRecords, 
+        (uint32_t)payload.size(), (uint32_t)payload.size()};
+    const uint8_t* pBytes = (const uint8_t*)&header;
+    stream.insert(stream.end(), pBytes, pBytes + sizeof(header));
+    stream.insert(stream.end(), payload.begin(), payload.end());
+}
+
+static void write_file(const std::vector<uint8_t>& stream)
+{
+    int fd = open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    REQUIRE( fd >= 0 );
+    REQUIRE( write(fd, stream.data(), stream.size()) == (ssize_t)stream.size() );
+    close(fd);
+}
+
+static void write_records_with_writer(uint compressionLevel, uint numRecords,
+    std::vector<uint8_t>& expected)
+{
+    DSL_META_EXPORT_WRITER_PTR pWriter = DSL_META_EXPORT_WRITER_NEW(
+        readerName.c_str(), DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+        filePath.c_str(), compressionLevel, numRecords);
+        
+    for (uint i = 0; i < numRecords; i++)
+    {
+        std::vector<uint8_t> record = new_test_record(i*1000, i%4);
+        expected.insert(expected.end(), record.begin(), record.end());
+        REQUIRE( pWriter->QueueRecord(record) == true );
+    }
+    // all queued records are written before the writer is destroyed.
+}
+
+static std::vector<uint8_t> read_all_records(DSL_META_EXPORT_READER_PTR pReader,
+    uint* numRecords)
+{
+    std::vector<uint8_t> records;
+    *numRecords = 0;
+    
+    const dsl_meta_export_batch* pRecord(NULL);
+    while ((pRecord = pReader->ReadRecord()))
+    {
+        const uint8_t* pBytes = (const uint8_t*)pRecord;
+        records.insert(records.end(), pBytes, pBytes + pRecord->record_size);
+        (*numRecords)++;
+    }
+    return records;
+}
+
+SCENARIO( "A MetaExportReader reads back the records of a MetaExportWriter", 
+    "[MetaExportReader]" )
+{
+    GIVEN( "A stream file written by a MetaExportWriter" ) 
+    {
+        std::vector<uint8_t> expected;
+        write_records_with_writer(0, 16, expected);
+        
+        WHEN( "A new MetaExportReader is created for the file" )
+        {
+            DSL_META_EXPORT_READER_PTR pReader = DSL_META_EXPORT_READER_NEW(
+                readerName.c_str(), filePath.c_str());
+            REQUIRE( pReader->GetStartTime() > 0 );
+            
+            THEN( "Every record is read in order, and again after a rewind" )
+            {
+                uint numRecords(0);
+                REQUIRE( read_all_records(pReader, &numRecords) == expected );
+                REQUIRE( numRecords == 16 );
+                REQUIRE( pReader->ReadRecord() == NULL );
+                REQUIRE( pReader->GetRecordsSkipped() == 0 );
+                
+                REQUIRE( pReader->Rewind() == true );
+                REQUIRE( pReader->GetBytesRead() == 
+                    sizeof(dsl_meta_export_stream_header) );
+                REQUIRE( read_all_records(pReader, &numRecords) == expected );
+                REQUIRE( numRecords == 16 );
+                
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaExportReader skips stream headers between blocks", 
+    "[MetaExportReader]" )
+{
+    GIVEN( "A stream file with a stream header before each block" ) 
+    {
+        std::vector<uint8_t> record1 = new_test_record(1, 1);
+        std::vector<uint8_t> record2 = new_test_record(2, 2);
+        
+        std::vector<uint8_t> stream;
+        append_stream_header(stream);
+        append_block(stream, record1, 1);
+        append_stream_header(stream);
+        append_block(stream, record2, 1);
+        write_file(stream);
+        
+        WHEN( "A new MetaExportReader is created for the file" )
+        {
+            DSL_META_EXPORT_READER_PTR pReader = DSL_META_EXPORT_READER_NEW(
+                readerName.c_str(), filePath.c_str());
+            REQUIRE( pReader->GetStartTime() == 1234 );
+            
+            THEN( "Both records are read" )
+            {
+                uint numRecords(0);
+                std::vector<uint8_t> expected(record1);
+                expected.insert(expected.end(), record2.begin(), record2.end());
+                REQUIRE( read_all_records(pReader, &numRecords) == expected );
+                REQUIRE( numRecords == 2 );
+                REQUIRE( pReader->GetBytesRead() == stream.size() );
+                
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaExportReader skips records that fail validation", 
+    "[MetaExportReader]" )
+{
+    GIVEN( "A stream file with a truncated record between two valid records" ) 
+    {
+        std::vector<uint8_t> record1 = new_test_record(1, 1);
+        std::vector<uint8_t> record2 = new_test_record(2, 2);
+        std::vector<uint8_t> record3 = new_test_record(3, 1);
+        
+        // Drop the last byte of record2's final label, keeping its 
+        // record_size consistent with the bytes in the block.
+        record2.pop_back();
+        ((dsl_meta_export_batch*)record2.data())->record_size = record2.size();
+        REQUIRE( MetaExportReader::ValidateRecord(
+            (dsl_meta_export_batch*)record2.data(), record2.size()) == false );
+        REQUIRE( MetaExportReader::ValidateRecord(
+            (dsl_meta_export_batch*)record1.data(), record1.size()) == true );
+        
+        std::vector<uint8_t> payload(record1);
+        payload.insert(payload.end(), record2.begin(), record2.end());
+        payload.insert(payload.end(), record3.begin(), record3.end());
+        
+        std::vector<uint8_t> stream;
+        append_stream_header(stream);
+        append_block(stream, payload, 3);
+        write_file(stream);
+        
+        WHEN( "A new MetaExportReader is created for the file" )
+        {
+            DSL_META_EXPORT_READER_PTR pReader = DSL_META_EXPORT_READER_NEW(
+                readerName.c_str(), filePath.c_str());
+            
+            THEN( "Only the valid records are read" )
+            {
+                uint numRecords(0);
+                std::vector<uint8_t> expected(record1);
+                expected.insert(expected.end(), record3.begin(), record3.end());
+                REQUIRE( read_all_records(pReader, &numRecords) == expected );
+                REQUIRE( numRecords == 2 );
+                REQUIRE( pReader->GetRecordsSkipped() == 1 );
+                
+                remove(filePath.c_str());
+            }
+        }
+    }
+    GIVEN( "A stream file with a truncated block" ) 
+    {
+        std::vector<uint8_t> record1 = new_test_record(1, 1);
+        
+        std::vector<uint8_t> stream;
+        append_stream_header(stream);
+        append_block(stream, record1, 1);
+        append_block(stream, record1, 1);
+        stream.resize(stream.size() - 8);
+        write_file(stream);
+        
+        WHEN( "A new MetaExportReader is created for the file" )
+        {
+            DSL_META_EXPORT_READER_PTR pReader = DSL_META_EXPORT_READER_NEW(
+                readerName.c_str(), filePath.c_str());
+            
+            THEN( "Only the records of the complete block are read" )
+            {
+                uint numRecords(0);
+                REQUIRE( read_all_records(pReader, &numRecords) == record1 );
+                REQUIRE( numRecords == 1 );
+                
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaExportReader fails to create for an invalid file", 
+    "[MetaExportReader]" )
+{
+    GIVEN( "A file that is not a metadata export stream" ) 
+    {
+        std::vector<uint8_t> stream(64, 0);
+        write_file(stream);
+        
+        WHEN( "A new MetaExportReader is created" )
+        {
+            THEN( "The MetaExportReader throws an exception" )
+            {
+                REQUIRE_THROWS( DSL_META_EXPORT_READER_NEW(readerName.c_str(), 
+                    filePath.c_str()) );
+                REQUIRE_THROWS( DSL_META_EXPORT_READER_NEW(readerName.c_str(), 
+                    "./non-existent-dir/meta-replay-test.bin") );
+                    
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+
+#if BUILD_WITH_ZSTD == true
+SCENARIO( "A MetaExportReader decompresses zstd blocks", "[MetaExportReader]" )
+{
+    GIVEN( "A stream file written by a MetaExportWriter with compression" ) 
+    {
+        std::vector<uint8_t> expected;
+        write_records_with_writer(3, 32, expected);
+        
+        WHEN( "A new MetaExportReader is created for the file" )
+        {
+            DSL_META_EXPORT_READER_PTR pReader = DSL_META_EXPORT_READER_NEW(
+                readerName.c_str(), filePath.c_str());
+            
+            THEN( "Every record is read in order" )
+            {
+                uint numRecords(0);
+                REQUIRE( read_all_records(pReader, &numRecords) == expected );
+                REQUIRE( numRecords == 32 );
+                
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,331 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslMetaExportWriter.h"
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if BUILD_WITH_ZSTD == true
+    #include <zstd.h>
+#endif
+
+using namespace DSL;
+
+static const std::string writerName("meta-export-writer");
+static const std::string filePath("./meta-export-test.bin");
+static const std::string socketPath("/tmp/dsl-meta-export-test.sock");
+
+static std::vector<uint8_t> new_test_record(uint64_t pts, uint16_t numFrames)
+{
+    std::vector<uint8_t> record(sizeof(dsl_meta_export_batch) 
+        + numFrames*sizeof(dsl_meta_export_frame));
+    dsl_meta_export_batch batch{(uint32_t)record.size(), 
+        DSL_META_EXPORT_RECORD_TYPE_BATCH, numFrames, pts};
+    memcpy(&record[0], &batch, sizeof(batch));
+    
+    for (uint16_t i = 0; i < numFrames; i++)
+    {
+        dsl_meta_export_frame frame{0};
+        frame.source_id = i;
+        frame.frame_num = pts;
+        memcpy(&record[sizeof(batch) + i*sizeof(frame)], &frame, sizeof(frame));
+    }
+    return record;
+}
+
+static void wait_for_queue_written(DSL_META_EXPORT_WRITER_PTR pWriter,
+    uint64_t numRecords)
+{
+    dsl_meta_export_sink_stats stats{0};
+    for (uint i = 0; i < 500; i++)
+    {
+        pWriter->GetStats(&stats);
+        if (stats.records_written + stats.records_dropped >= numRecords)
+        {
+            return;
+        }
+        g_usleep(1000);
+    }
+}
+
+static bool read_all(int fd, void* pData, size_t size)
+{
+    uint8_t* pBytes = (uint8_t*)pData;
+    while (size)
+    {
+        ssize_t bytesRead = read(fd, pBytes, size);
+        if (bytesRead <= 0)
+        {
+            return false;
+        }
+        pBytes += bytesRead;
+        size -= bytesRead;
+    }
+    return true;
+}
+
+// Reads the stream header, and all blocks up to numRecords, returning the 
+// concatenated block payloads after decompression.
+static std::vector<uint8_t> read_stream(int fd, uint numRecords, 
+    uint16_t expectedCodec)
+{
+    std::vector<uint8_t> records;
+    
+    dsl_meta_export_stream_header streamHeader{0};
+    REQUIRE( read_all(fd, &streamHeader, sizeof(streamHeader)) == true );
+    REQUIRE( streamHeader.magic == DSL_META_EXPORT_STREAM_MAGIC );
+    REQUIRE( streamHeader.version == DSL_META_EXPORT_VERSION );
+    REQUIRE( streamHeader.start_time > 0 );
+    
+    uint recordsRead(0);
+    while (recordsRead < numRecords)
+    {
+        dsl_meta_export_block_header blockHeader{0};
+        REQUIRE( read_all(fd, &blockHeader, sizeof(blockHeader)) == true );
+        REQUIRE( blockHeader.magic == DSL_META_EXPORT_BLOCK_MAGIC );
+        REQUIRE( blockHeader.codec == expectedCodec );
+        
+        std::vector<uint8_t> payload(blockHeader.stored_size);
+        REQUIRE( read_all(fd, payload.data(), payload.size()) == true );
+        
+        if (blockHeader.codec == DSL_META_EXPORT_CODEC_NONE)
+        {
+            REQUIRE( blockHeader.raw_size == blockHeader.stored_size );
+            records.insert(records.end(), payload.begin(), payload.end());
+        }
+#if BUILD_WITH_ZSTD == true
+        else
+        {
+            std::vector<uint8_t> raw(blockHeader.raw_size);
+            REQUIRE( ZSTD_decompress(raw.data(), raw.size(), 
+                payload.data(), payload.size()) == blockHeader.raw_size );
+            records.insert(records.end(), raw.begin(), raw.end());
+        }
+#endif
+        recordsRead += blockHeader.num_records;
+    }
+    return records;
+}
+
+SCENARIO( "A MetaExportWriter writes queued records to a file", 
+    "[MetaExportWriter]" )
+{
+    GIVEN( "A new MetaExportWriter with a file transport" ) 
+    {
+        DSL_META_EXPORT_WRITER_PTR pWriter = DSL_META_EXPORT_WRITER_NEW(
+            writerName.c_str(), DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+            filePath.c_str(), 0, 16);
+            
+        std::vector<uint8_t> expected;
+        
+        WHEN( "Records are queued and the writer is destroyed" )
+        {
+            for (uint i = 0; i < 8; i++)
+            {
+                std::vector<uint8_t> record = new_test_record(i, i%4);
+                expected.insert(expected.end(), record.begin(), record.end());
+                REQUIRE( pWriter->QueueRecord(record) == true );
+            }
+            wait_for_queue_written(pWriter, 8);
+            
+            dsl_meta_export_sink_stats stats{0};
+            pWriter->GetStats(&stats);
+            REQUIRE( stats.queue_depth == 0 );
+            REQUIRE( stats.peak_queue_depth >= 1 );
+            REQUIRE( stats.connects == 0 );
+            REQUIRE( stats.records_written == 8 );
+            REQUIRE( stats.records_dropped == 0 );
+            REQUIRE( stats.raw_bytes == expected.size() );
+            REQUIRE( stats.bytes_written > expected.size() );
+            
+            pWriter->ClearStats();
+            pWriter->GetStats(&stats);
+            REQUIRE( stats.peak_queue_depth == 0 );
+            REQUIRE( stats.records_written == 0 );
+            REQUIRE( stats.raw_bytes == 0 );
+            REQUIRE( stats.bytes_written == 0 );
+            
+            pWriter = nullptr;
+            
+            THEN( "The file holds every record in order" )
+            {
+                int fd = open(filePath.c_str(), O_RDONLY);
+                REQUIRE( fd >= 0 );
+                REQUIRE( read_stream(fd, 8, DSL_META_EXPORT_CODEC_NONE) 
+                    == expected );
+                    
+                // nothing follows the last block
+                uint8_t byte;
+                REQUIRE( read(fd, &byte, 1) == 0 );
+                close(fd);
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaExportWriter connects to a Unix domain socket on first write", 
+    "[MetaExportWriter]" )
+{
+    GIVEN( "A new MetaExportWriter with a Unix domain socket transport" ) 
+    {
+        unlink(socketPath.c_str());
+
+        DSL_META_EXPORT_WRITER_PTR pWriter = DSL_META_EXPORT_WRITER_NEW(
+            writerName.c_str(), DSL_SINK_META_EXPORT_TRANSPORT_UNIX, 
+            socketPath.c_str(), 0, 16);
+            
+        dsl_meta_export_sink_stats stats{0};
+        
+        WHEN( "Records are queued with no reader listening" )
+        {
+            for (uint i = 0; i < 3; i++)
+            {
+                std::vector<uint8_t> record = new_test_record(i, 1);
+                REQUIRE( pWriter->QueueRecord(record) == true );
+            }
+            wait_for_queue_written(pWriter, 3);
+            
+            THEN( "The records are dropped without blocking" )
+            {
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.connects == 0 );
+                REQUIRE( stats.records_written == 0 );
+                REQUIRE( stats.records_dropped == 3 );
+            }
+        }
+        WHEN( "Records are queued with a reader listening" )
+        {
+            int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+            sockaddr_un address{0};
+            address.sun_family = AF_UNIX;
+            strcpy(address.sun_path, socketPath.c_str());
+            REQUIRE( bind(listenFd, (sockaddr*)&address, sizeof(address)) == 0 );
+            REQUIRE( listen(listenFd, 1) == 0 );
+            
+            std::vector<uint8_t> record = new_test_record(1, 2);
+            std::vector<uint8_t> expected(record);
+            REQUIRE( pWriter->QueueRecord(record) == true );
+            
+            THEN( "The reader receives the stream header and the record" )
+            {
+                int fd = accept(listenFd, NULL, NULL);
+                REQUIRE( fd >= 0 );
+                REQUIRE( read_stream(fd, 1, DSL_META_EXPORT_CODEC_NONE) 
+                    == expected );
+                    
+                wait_for_queue_written(pWriter, 1);
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.connects == 1 );
+                REQUIRE( stats.records_written == 1 );
+                REQUIRE( stats.records_dropped == 0 );
+                
+                close(fd);
+                close(listenFd);
+                unlink(socketPath.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaExportWriter fails to create with invalid parameters", 
+    "[MetaExportWriter]" )
+{
+    GIVEN( "Attributes for a new MetaExportWriter" ) 
+    {
+        WHEN( "Invalid parameters are used" )
+        {
+            THEN( "The MetaExportWriter throws an exception" )
+            {
+                REQUIRE_THROWS( DSL_META_EXPORT_WRITER_NEW(writerName.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_TCP+1, filePath.c_str(), 
+                    0, 16) );
+                REQUIRE_THROWS( DSL_META_EXPORT_WRITER_NEW(writerName.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, filePath.c_str(), 
+                    0, 0) );
+                REQUIRE_THROWS( DSL_META_EXPORT_WRITER_NEW(writerName.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, filePath.c_str(), 
+                    DSL_META_EXPORT_MAX_COMPRESSION_LEVEL+1, 16) );
+                REQUIRE_THROWS( DSL_META_EXPORT_WRITER_NEW(writerName.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+                    "./non-existent-dir/meta-export-test.bin", 0, 16) );
+                REQUIRE_THROWS( DSL_META_EXPORT_WRITER_NEW(writerName.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_TCP, "localhost", 0, 16) );
+#if BUILD_WITH_ZSTD != true
+                REQUIRE_THROWS( DSL_META_EXPORT_WRITER_NEW(writerName.c_str(), 
+                    DSL_SINK_META_EXPORT_TRANSPORT_FILE, filePath.c_str(), 
+                    3, 16) );
+#endif
+            }
+        }
+    }
+}
+
+#if BUILD_WITH_ZSTD == true
+SCENARIO( "A MetaExportWriter compresses each block with zstd", 
+    "[MetaExportWriter]" )
+{
+    GIVEN( "A new MetaExportWriter with a file transport and compression" ) 
+    {
+        DSL_META_EXPORT_WRITER_PTR pWriter = DSL_META_EXPORT_WRITER_NEW(
+            writerName.c_str(), DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+            filePath.c_str(), 3, 64);
+            
+        std::vector<uint8_t> expected;
+        
+        WHEN( "Records are queued and the writer is destroyed" )
+        {
+            for (uint i = 0; i < 32; i++)
+            {
+                std::vector<uint8_t> record = new_test_record(i, 16);
+                expected.insert(expected.end(), record.begin(), record.end());
+                REQUIRE( pWriter->QueueRecord(record) == true );
+            }
+            wait_for_queue_written(pWriter, 32);
+            
+            dsl_meta_export_sink_stats stats{0};
+            pWriter->GetStats(&stats);
+            REQUIRE( stats.records_written == 32 );
+            REQUIRE( stats.raw_bytes == expected.size() );
+            REQUIRE( stats.bytes_written < expected.size() );
+            
+            pWriter = nullptr;
+            
+            THEN( "The decompressed blocks hold every record in order" )
+            {
+                int fd = open(filePath.c_str(), O_RDONLY);
+                REQUIRE( fd >= 0 );
+                REQUIRE( read_stream(fd, 32, DSL_META_EXPORT_CODEC_ZSTD) 
+                    == expected );
+                close(fd);
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
+#endif
@@ -30,7 +30,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaBuilder displayMetaData;
 
 static void ode_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
     void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
@@ -806,6 +806,32 @@ SCENARIO( "A CustomLabelOdeAction handles an ODE Occurence correctly", "[OdeActi
                 REQUIRE( actualLabel == expectedLabel );
             }
         }
+        WHEN( "The Action handles Occurrences within a Frame Arena scope" )
+        {
+            DSL_ODE_ACTION_LABEL_CUSTOMIZE_PTR pAction = DSL_ODE_ACTION_LABEL_CUSTOMIZE_NEW(
+                actionName.c_str(), label_types);
+
+            FrameArena frameArena;
+
+            THEN( "The scratch label is allocated from the arena on every frame" )
+            {
+                std::string expectedLabel("L:10,10 | D:200x100 | IC:0.000000 | T:0s");
+
+                for (uint i = 0; i < 10; i++)
+                {
+                    FrameArenaScope frameArenaScope(&frameArena, true);
+
+                    pAction->HandleOccurrence(pTrigger, NULL, 
+                        displayMetaData, &frameMeta, &objectMeta);
+                    std::string actualLabel(objectMeta.text_params.display_text);
+                    REQUIRE( actualLabel == expectedLabel );
+                }
+                REQUIRE( frameArena.GetAllocationCount() >= 10 );
+                REQUIRE( frameArena.GetResetCount() == 10 );
+                REQUIRE( frameArena.GetBlockAllocationCount() == 1 );
+                REQUIRE( frameArena.GetBytesInUse() == 0 );
+            }
+        }
         WHEN( "A the Action is created with 0 content_types" )
         {
             std::vector<uint> label_types;
@@ -1053,3 +1053,48 @@ SCENARIO( "A new OdeExclusionArea is created correctly", "[OdeArea]" )
     }
 }
 
+
+SCENARIO( "A shared OdeInclusionArea adds its meta once per frame", "[OdeArea]" )
+{
+    GIVEN( "A new OdeInclusionArea with a static RGBA Polygon" ) 
+    {
+        std::string odeAreaName("ode-inclusion-area");
+        bool show(true);
+
+        std::string polygonName  = "my-polygon";
+        uint numCoordinates(4);
+        dsl_coordinate coordinates[] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint lineWidth(4);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-custom-color", 
+            0.12, 0.34, 0.56, 0.78);
+
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+            
+        DSL_ODE_AREA_INCLUSION_PTR pOdeArea = DSL_ODE_AREA_INCLUSION_NEW(
+            odeAreaName.c_str(), pPolygon, show, DSL_BBOX_POINT_ANY);
+
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        NvDsFrameMeta frameMeta{0};
+ 
+        WHEN( "The OdeInclusionArea is added twice for the same frame" )
+        {
+            DisplayMetaBuilder displayMetaData(pBatchMeta, 
+                DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED);
+
+            pOdeArea->AddMeta(displayMetaData, &frameMeta);
+            pOdeArea->AddMeta(displayMetaData, &frameMeta);
+
+            THEN( "The Polygon's lines are only added once" )
+            {
+                NvDsDisplayMeta* pDisplayMeta = displayMetaData.GetDisplayMeta();
+                REQUIRE( pDisplayMeta->num_lines == numCoordinates );
+                REQUIRE( pDisplayMeta->line_params[0].x1 == 100 );
+                REQUIRE( pDisplayMeta->line_params[0].y2 == 110 );
+                REQUIRE( pDisplayMeta->line_params[0].line_width == lineWidth );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
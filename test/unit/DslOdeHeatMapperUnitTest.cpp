@@ -28,7 +28,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaBuilder displayMetaData;
 
 SCENARIO( "A new OdeHeatMapper is created correctly", "[OdeHeatMapper]" )
 {
@@ -333,3 +333,250 @@ SCENARIO( "A new OdeHeatMapper can File metrics correctly", "[OdeHeatMapper]" )
     }
 }
 
+
+SCENARIO( "An OdeHeatMapper maps each source separately", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper in memory" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("heat-mapper");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_frame_width = DSL_1K_HD_WIDTH;
+        frameMeta.source_frame_height = DSL_1K_HD_HEIGHT;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        // two occurrences for source 0 in the first cell
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+        
+        // one occurrence for source 1 in the last cell
+        frameMeta.source_id = 1;
+        objectMeta.rect_params.left = DSL_1K_HD_WIDTH - 30;
+        objectMeta.rect_params.top = DSL_1K_HD_HEIGHT - 30;
+        
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+
+        WHEN( "The OdeHeatMapper is called to Get metrics" )
+        {
+            const uint64_t* outBuffer;
+            const uint64_t* sourceBuffer;
+            uint size, sourceSize;
+            
+            pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+
+            THEN( "The heat-map of all sources and of each source is correct" )
+            {
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[size-1] == 1 );
+                
+                REQUIRE( pOdeHeatMapper->GetSourceMetrics(0, 
+                    &sourceBuffer, &sourceSize) == true );
+                REQUIRE( sourceSize == cols*rows );
+                REQUIRE( sourceBuffer[0] == 2 );
+                REQUIRE( sourceBuffer[sourceSize-1] == 0 );
+                
+                REQUIRE( pOdeHeatMapper->GetSourceMetrics(1, 
+                    &sourceBuffer, &sourceSize) == true );
+                REQUIRE( sourceBuffer[0] == 0 );
+                REQUIRE( sourceBuffer[sourceSize-1] == 1 );
+                
+                REQUIRE( pOdeHeatMapper->GetSourceMetrics(2, 
+                    &sourceBuffer, &sourceSize) == false );
+            }
+        }
+        WHEN( "The OdeHeatMapper adds display meta for each source" )
+        {
+            NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+            
+            DisplayMetaBuilder sourceMetaData0(pBatchMeta, 
+                DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED);
+            frameMeta.source_id = 0;
+            pOdeHeatMapper->AddDisplayMeta(sourceMetaData0, &frameMeta);
+            
+            DisplayMetaBuilder sourceMetaData2(pBatchMeta, 
+                DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED);
+            frameMeta.source_id = 2;
+            pOdeHeatMapper->AddDisplayMeta(sourceMetaData2, &frameMeta);
+
+            THEN( "Only the cells of the frame's source are added" )
+            {
+                REQUIRE( sourceMetaData0.GetDisplayMeta()->num_rects == 1 );
+                REQUIRE( sourceMetaData2.GetAcquiredCount() == 0 );
+            }
+            nvds_destroy_batch_meta(pBatchMeta);
+        }
+        WHEN( "The OdeHeatMapper is called to Clear metrics" )
+        {
+            pOdeHeatMapper->ClearMetrics();
+
+            THEN( "All heat-maps are cleared" )
+            {
+                const uint64_t* outBuffer;
+                uint size;
+                
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                for (uint i=0; i<size; i++)
+                {
+                    REQUIRE( outBuffer[i] == 0 );
+                }
+                REQUIRE( pOdeHeatMapper->GetSourceMetrics(1, 
+                    &outBuffer, &size) == true );
+                REQUIRE( outBuffer[size-1] == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A HeatMap in window mode drops counts older than the window", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMap with a window of three intervals" ) 
+    {
+        HeatMap heatMap(4, 3);
+        heatMap.SetMode(DSL_HEAT_MAP_MODE_WINDOW, 10, 3);
+        
+        // first update starts the first interval.
+        REQUIRE( heatMap.Update(100) == false );
+        heatMap.Increment(1, 1);
+        heatMap.Increment(1, 1);
+
+        WHEN( "The HeatMap is updated over several intervals" )
+        {
+            REQUIRE( heatMap.Update(105) == false );
+            REQUIRE( heatMap.Update(110) == true );
+            heatMap.Increment(2, 2);
+            REQUIRE( heatMap.Update(120) == true );
+            
+            REQUIRE( heatMap.GetGrid().GetCell(1, 1) == 2 );
+            REQUIRE( heatMap.GetGrid().GetMax() == 2 );
+            
+            REQUIRE( heatMap.Update(130) == true );
+            
+            THEN( "Only the counts within the window remain" )
+            {
+                REQUIRE( heatMap.GetGrid().GetCell(1, 1) == 0 );
+                REQUIRE( heatMap.GetGrid().GetCell(2, 2) == 1 );
+                REQUIRE( heatMap.GetGrid().GetMax() == 1 );
+                
+                REQUIRE( heatMap.Update(1000) == true );
+                REQUIRE( heatMap.GetGrid().GetMax() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A HeatMap in decay mode halves its counts every half-life", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMap with a half-life of two intervals" ) 
+    {
+        HeatMap heatMap(4, 3);
+        heatMap.SetMode(DSL_HEAT_MAP_MODE_DECAY, 10, 2);
+        
+        REQUIRE( heatMap.Update(1) == false );
+        for (uint i=0; i < 100; i++)
+        {
+            heatMap.Increment(0, 0);
+        }
+        REQUIRE( heatMap.GetGrid().GetCell(0, 0) == 100 );
+
+        WHEN( "The HeatMap is updated after two intervals" )
+        {
+            REQUIRE( heatMap.Update(21) == true );
+            
+            THEN( "The counts are halved" )
+            {
+                REQUIRE( heatMap.GetGrid().GetCell(0, 0) == 50 );
+                REQUIRE( heatMap.GetGrid().GetMax() == 50 );
+                
+                REQUIRE( heatMap.Update(31) == true );
+                REQUIRE( heatMap.GetGrid().GetCell(0, 0) == 35 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeHeatMapper can Set and Get its mode correctly", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper in memory" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("heat-mapper");
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                16, 9, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        uint mode(99), interval(99), size(99);
+        pOdeHeatMapper->GetMode(&mode, &interval, &size);
+        REQUIRE( mode == DSL_HEAT_MAP_MODE_ACCUMULATE );
+        REQUIRE( interval == 0 );
+        REQUIRE( size == 0 );
+
+        WHEN( "The OdeHeatMapper's mode is set" )
+        {
+            REQUIRE( pOdeHeatMapper->SetMode(DSL_HEAT_MAP_MODE_WINDOW,
+                60, 10) == true );
+            
+            THEN( "The correct mode is returned on get" )
+            {
+                pOdeHeatMapper->GetMode(&mode, &interval, &size);
+                REQUIRE( mode == DSL_HEAT_MAP_MODE_WINDOW );
+                REQUIRE( interval == 60 );
+                REQUIRE( size == 10 );
+            }
+        }
+        WHEN( "The OdeHeatMapper's mode is set with invalid settings" )
+        {
+            REQUIRE( pOdeHeatMapper->SetMode(DSL_HEAT_MAP_MODE_WINDOW+1,
+                60, 10) == false );
+            REQUIRE( pOdeHeatMapper->SetMode(DSL_HEAT_MAP_MODE_DECAY,
+                0, 10) == false );
+            REQUIRE( pOdeHeatMapper->SetMode(DSL_HEAT_MAP_MODE_DECAY,
+                60, 0) == false );
+            
+            THEN( "The mode is unchanged" )
+            {
+                pOdeHeatMapper->GetMode(&mode, &interval, &size);
+                REQUIRE( mode == DSL_HEAT_MAP_MODE_ACCUMULATE );
+            }
+        }
+    }
+}
@@ -32,7 +32,7 @@ using namespace DSL;
 
 static std::wstring w_file_path(L"/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaBuilder displayMetaData;
 
 static boolean ode_check_for_occurrence_cb(void* buffer,
     void* frame_meta, void* object_meta, void* client_data)
@@ -133,6 +133,147 @@ SCENARIO( "A new OdeOccurreceTrigger is created correctly", "[OdeTrigger]" )
     }
 }
 
+SCENARIO( "An OdeOccurrenceTrigger keeps its streaming state per source", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeOccurrenceTrigger with no limits" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        REQUIRE( pOdeTrigger->IsSourceSharded() == true );
+        REQUIRE( pOdeTrigger->GetEventCount() == 0 );
+        REQUIRE( pOdeTrigger->GetFrameCount() == 0 );
+        REQUIRE( pOdeTrigger->GetOccurrencesAccumulated() == 0 );
+
+        WHEN( "The source state is requested for different sources" )
+        {
+            DSL_ODE_TRIGGER_SOURCE_STATE_PTR pSourceState1 = 
+                pOdeTrigger->GetSourceState(1);
+            DSL_ODE_TRIGGER_SOURCE_STATE_PTR pSourceState2 = 
+                pOdeTrigger->GetSourceState(2);
+            
+            THEN( "Each source has its own state, returned on each request" )
+            {
+                REQUIRE( pSourceState1 != pSourceState2 );
+                REQUIRE( pOdeTrigger->GetSourceState(1) == pSourceState1 );
+                REQUIRE( pOdeTrigger->GetSourceState(2) == pSourceState2 );
+                REQUIRE( pSourceState1->m_occurrences == 0 );
+                REQUIRE( pSourceState1->m_intervalCounter == 0 );
+                REQUIRE( pSourceState1->m_skipFrame == false );
+            }
+        }
+        WHEN( "The Trigger's event limit is set" )
+        {
+            pOdeTrigger->SetEventLimit(1);
+            
+            THEN( "The Trigger no longer reports its state as source-sharded" )
+            {
+                REQUIRE( pOdeTrigger->IsSourceSharded() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger counts per source when called from two threads",
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeOccurrenceTrigger with no limits" )
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger =
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(),
+                source.c_str(), classId, limit);
+
+        uint frameCount(1000);
+
+        WHEN( "Two sources, each with a different object count, are processed "
+            "on their own thread" )
+        {
+            std::vector<std::thread> threads;
+            std::vector<uint> mismatches(2, 0);
+            std::vector<uint64_t> lastEventIds(2, 0);
+
+            for (uint sourceId = 0; sourceId < 2; sourceId++)
+            {
+                threads.push_back(std::thread([&pOdeTrigger, &mismatches,
+                    &lastEventIds, sourceId, classId, frameCount]()
+                {
+                    // Each streaming thread builds its own display meta.
+                    DisplayMetaBuilder threadDisplayMetaData;
+
+                    // Source 0 has 2 objects per frame, source 1 has 3
+                    uint objectCount(sourceId + 2);
+
+                    NvDsFrameMeta frameMeta =  {0};
+                    frameMeta.bInferDone = true;
+                    frameMeta.source_id = sourceId;
+
+                    std::vector<NvDsObjectMeta> objectMetas(objectCount);
+                    for (auto& objectMeta: objectMetas)
+                    {
+                        objectMeta = {0};
+                        objectMeta.class_id = classId;
+                        objectMeta.rect_params.width = 200;
+                        objectMeta.rect_params.height = 100;
+                    }
+
+                    for (uint i = 0; i < frameCount; i++)
+                    {
+                        frameMeta.frame_num = i;
+
+                        pOdeTrigger->PreProcessFrame(NULL,
+                            threadDisplayMetaData, &frameMeta);
+                        for (auto& objectMeta: objectMetas)
+                        {
+                            pOdeTrigger->CheckForOccurrence(NULL,
+                                threadDisplayMetaData, &frameMeta, &objectMeta);
+                        }
+                        if (pOdeTrigger->PostProcessFrame(NULL,
+                            threadDisplayMetaData, &frameMeta) != objectCount)
+                        {
+                            mismatches[sourceId]++;
+                        }
+
+                        // Event ids are global, but must increase per source.
+                        uint64_t eventId =
+                            pOdeTrigger->GetSourceState(sourceId)->m_eventId;
+                        if (eventId <= lastEventIds[sourceId])
+                        {
+                            mismatches[sourceId]++;
+                        }
+                        lastEventIds[sourceId] = eventId;
+                    }
+                }));
+            }
+            for (auto& ithread: threads)
+            {
+                ithread.join();
+            }
+
+            THEN( "Each source's occurrences are counted independently" )
+            {
+                REQUIRE( mismatches[0] == 0 );
+                REQUIRE( mismatches[1] == 0 );
+                REQUIRE( pOdeTrigger->GetSourceState(0)->m_occurrences == 2 );
+                REQUIRE( pOdeTrigger->GetSourceState(1)->m_occurrences == 3 );
+                REQUIRE( pOdeTrigger->GetEventCount() == frameCount*(2+3) );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeOccurrenceTrigger checks its enabled setting ", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeTrigger with default criteria" ) 
@@ -1341,6 +1482,33 @@ SCENARIO( "An OdeOccurrenceTrigger checks its interval setting ", "[OdeTrigger]"
                     displayMetaData, &frameMeta, &objectMeta) == false );
             }
         }
+        WHEN( "The ODE Trigger's skip-interval is set for interleaved sources" )
+        {
+            pOdeTrigger->SetInterval(2);
+            
+            NvDsFrameMeta otherFrameMeta = frameMeta;
+            otherFrameMeta.source_id = 3;
+            
+            THEN( "The skip-interval is counted separately for each source" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &otherFrameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &otherFrameMeta, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &otherFrameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &otherFrameMeta, &objectMeta) == true );
+            }
+        }
         WHEN( "The ODE Trigger's skip-interval is disabled" )
         {
             pOdeTrigger->SetInterval(0);
@@ -1674,6 +1842,91 @@ SCENARIO( "An OdeOccurrenceTrigger checks its Areas in the correct order", "[Ode
     }
 }
 
+SCENARIO( "An OdeOccurrenceTrigger publishes a new config snapshot on update", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeOccurenceTrigger, ODE Action, and ODE Area" ) 
+    {
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        std::string odeActionName("ode-action");
+        std::string odeAreaName("ode-area");
+
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{100,100},{200,100},{200, 200},{100,200}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        std::string colorName  = "my-custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), 
+            red, green, blue, alpha);
+
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_PRINT_PTR pOdeAction = 
+            DSL_ODE_ACTION_PRINT_NEW(odeActionName.c_str(), false);
+
+        DSL_ODE_AREA_INCLUSION_PTR pOdeArea =
+            DSL_ODE_AREA_INCLUSION_NEW(odeAreaName.c_str(), 
+                pPolygon, false, DSL_BBOX_POINT_CENTER);
+
+        DSL_ODE_TRIGGER_CONFIG_PTR pOrgConfig = pOdeTrigger->GetConfig();
+        
+        REQUIRE( pOrgConfig->m_classId == classId );
+        REQUIRE( pOrgConfig->m_minConfidence == 0 );
+        REQUIRE( pOrgConfig->m_odeActions.size() == 0 );
+        REQUIRE( pOrgConfig->m_odeAreas.size() == 0 );
+
+        WHEN( "A criteria setter is called" )
+        {
+            pOdeTrigger->SetMinConfidence(0.5);
+            
+            THEN( "A new snapshot is published and the original is unchanged" )
+            {
+                DSL_ODE_TRIGGER_CONFIG_PTR pNewConfig = pOdeTrigger->GetConfig();
+                
+                REQUIRE( pNewConfig != pOrgConfig );
+                REQUIRE( pNewConfig->m_minConfidence == 0.5 );
+                REQUIRE( pNewConfig->m_classId == classId );
+                REQUIRE( pOrgConfig->m_minConfidence == 0 );
+            }
+        }
+        WHEN( "An ODE Action and ODE Area are added" )
+        {
+            REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );     
+            REQUIRE( pOdeTrigger->AddArea(pOdeArea) == true );     
+            
+            THEN( "The new snapshot holds the pre-cast children" )
+            {
+                DSL_ODE_TRIGGER_CONFIG_PTR pNewConfig = pOdeTrigger->GetConfig();
+                
+                REQUIRE( pNewConfig->m_odeActions.size() == 1 );
+                REQUIRE( pNewConfig->m_odeActions[0] == pOdeAction );
+                REQUIRE( pNewConfig->m_odeAreas.size() == 1 );
+                REQUIRE( pNewConfig->m_odeAreas[0] == pOdeArea );
+                REQUIRE( pOrgConfig->m_odeActions.size() == 0 );
+                REQUIRE( pOrgConfig->m_odeAreas.size() == 0 );
+                
+                pOdeTrigger->RemoveAllActions();
+                pOdeTrigger->RemoveAllAreas();
+                
+                REQUIRE( pOdeTrigger->GetConfig()->m_odeActions.size() == 0 );
+                REQUIRE( pOdeTrigger->GetConfig()->m_odeAreas.size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeAbsenceTrigger checks for Source Name correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeAbsenceTrigger with default criteria" ) 
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "DslPadProbeHandler.h"
 #include "DslTrackerBintr.h"
 #include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
 
 using namespace DSL;
 
@@ -94,6 +95,8 @@ SCENARIO( "A new OdePadProbeHandler is created correctly", "[PadProbeHandler]" )
             THEN( "The PadProbeHandler's memebers are setup and returned correctly" )
             {
                 REQUIRE( pPadProbeHandler->GetEnabled() == true );
+                REQUIRE( pPadProbeHandler->GetDisplayMetaAllocSize() == 
+                    DSL_PPH_ODE_DISPLAY_META_ALLOC_SIZE_UNLIMITED );
             }
         }
     }
@@ -127,6 +130,196 @@ SCENARIO( "A new OdePadProbeHandler can Disable and Re-enable", "[PadProbeHandle
     }
 }
 
+SCENARIO( "A new OdePadProbeHandler can Get/Set its Parallel Mode", "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler" ) 
+    {
+        std::string odeHandlerName("ode-handler");
+
+        DSL_PPH_ODE_PTR pPadProbeHandler = DSL_PPH_ODE_NEW(odeHandlerName.c_str());
+        
+        bool enabled(true);
+        uint numWorkers(99);
+        pPadProbeHandler->GetParallelMode(&enabled, &numWorkers);
+        REQUIRE( enabled == false );
+
+        WHEN( "Parallel Mode is enabled with a default number of workers" )
+        {
+            pPadProbeHandler->SetParallelMode(true, 0);
+
+            THEN( "At least one worker is used" )
+            {
+                pPadProbeHandler->GetParallelMode(&enabled, &numWorkers);
+                REQUIRE( enabled == true );
+                REQUIRE( numWorkers >= 1 );
+            }
+        }
+        WHEN( "Parallel Mode is enabled with a set number of workers" )
+        {
+            pPadProbeHandler->SetParallelMode(true, 4);
+
+            THEN( "The same number of workers is returned" )
+            {
+                pPadProbeHandler->GetParallelMode(&enabled, &numWorkers);
+                REQUIRE( enabled == true );
+                REQUIRE( numWorkers == 4 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new OdePadProbeHandler can Get/Set its Stats settings", "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler" ) 
+    {
+        std::string odeHandlerName("ode-handler");
+
+        DSL_PPH_ODE_PTR pPadProbeHandler = DSL_PPH_ODE_NEW(odeHandlerName.c_str());
+        
+        REQUIRE( pPadProbeHandler->GetStatsEnabled() == false );
+        REQUIRE( pPadProbeHandler->GetFrameBudget() == 0 );
+
+        WHEN( "Stats are enabled and a frame budget is set" )
+        {
+            pPadProbeHandler->SetStatsEnabled(true);
+            pPadProbeHandler->SetFrameBudget(5000, NULL, NULL);
+
+            THEN( "The correct settings are returned and no stats are found" )
+            {
+                REQUIRE( pPadProbeHandler->GetStatsEnabled() == true );
+                REQUIRE( pPadProbeHandler->GetFrameBudget() == 5000 );
+                
+                dsl_latency_stats stats;
+                REQUIRE( pPadProbeHandler->GetStats("trigger", 
+                    DSL_PPH_ODE_STATS_PHASE_CHECK, &stats) == false );
+                pPadProbeHandler->GetFrameStats(&stats);
+                REQUIRE( stats.count == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "OdeStats are recorded for each component and phase", "[PadProbeHandler]" )
+{
+    GIVEN( "New OdeStats and a component to time" ) 
+    {
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pComponent = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("component", "", 1, 0);
+        OdeStats odeStats;
+        
+        REQUIRE( pComponent->GetOdeStats() == NULL );
+
+        WHEN( "Calls are timed in different phases once the component is added" )
+        {
+            {
+                // components that have not been added record nothing
+                OdeStatsTimer statsTimer(&odeStats, pComponent.get(),
+                    DSL_PPH_ODE_STATS_PHASE_CHECK);
+            }
+            odeStats.AddComponent(pComponent.get());
+            REQUIRE( pComponent->GetOdeStats() != NULL );
+            {
+                OdeStatsTimer statsTimer(&odeStats, pComponent.get(),
+                    DSL_PPH_ODE_STATS_PHASE_CHECK);
+            }
+            {
+                OdeStatsTimer statsTimer(&odeStats, pComponent.get(),
+                    DSL_PPH_ODE_STATS_PHASE_CHECK);
+            }
+            {
+                // disabled timers record nothing
+                OdeStatsTimer statsTimer(NULL, pComponent.get(),
+                    DSL_PPH_ODE_STATS_PHASE_POST_PROCESS);
+            }
+            odeStats.Record(pComponent.get(), DSL_ODE_STATS_PHASE_ACTION, 1000);
+
+            THEN( "The stats for each phase are correct" )
+            {
+                dsl_latency_stats stats;
+                REQUIRE( odeStats.GetStats("component", 
+                    DSL_PPH_ODE_STATS_PHASE_CHECK, &stats) == true );
+                REQUIRE( stats.count == 2 );
+                REQUIRE( odeStats.GetStats("component", 
+                    DSL_PPH_ODE_STATS_PHASE_POST_PROCESS, &stats) == false );
+                REQUIRE( odeStats.GetStats("component", 
+                    DSL_ODE_STATS_PHASE_ACTION, &stats) == true );
+                REQUIRE( stats.count == 1 );
+                REQUIRE( stats.max == 1000 );
+                REQUIRE( odeStats.GetStats("other", 
+                    DSL_PPH_ODE_STATS_PHASE_CHECK, &stats) == false );
+                
+                odeStats.Clear();
+                REQUIRE( odeStats.GetStats("component", 
+                    DSL_PPH_ODE_STATS_PHASE_CHECK, &stats) == true );
+                REQUIRE( stats.count == 0 );
+                
+                odeStats.RemoveComponent(pComponent.get());
+                REQUIRE( pComponent->GetOdeStats() == NULL );
+                REQUIRE( odeStats.GetStats("component", 
+                    DSL_PPH_ODE_STATS_PHASE_CHECK, &stats) == false );
+            }
+        }
+        WHEN( "The component is added twice" )
+        {
+            odeStats.AddComponent(pComponent.get());
+            odeStats.AddComponent(pComponent.get());
+            
+            THEN( "It records its stats until removed twice" )
+            {
+                odeStats.RemoveComponent(pComponent.get());
+                REQUIRE( pComponent->GetOdeStats() != NULL );
+                odeStats.RemoveComponent(pComponent.get());
+                REQUIRE( pComponent->GetOdeStats() == NULL );
+            }
+        }
+        WHEN( "Stats are installed for the calling thread" )
+        {
+            REQUIRE( OdeStats::GetCurrent() == NULL );
+            {
+                OdeStatsScope odeStatsScope(&odeStats);
+                REQUIRE( OdeStats::GetCurrent() == &odeStats );
+            }
+            THEN( "They are uninstalled at the end of the scope" )
+            {
+                REQUIRE( OdeStats::GetCurrent() == NULL );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdePadProbeHandler resolves the stats of its Triggers and Actions on add", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler, OdeTrigger and OdeAction" ) 
+    {
+        DSL_PPH_ODE_PTR pPadProbeHandler = DSL_PPH_ODE_NEW("ode-handler");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger", "", 1, 0);
+            
+        DSL_ODE_ACTION_LOG_PTR pOdeAction = DSL_ODE_ACTION_LOG_NEW("action");
+        
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );
+
+        WHEN( "The Trigger is added to the OdePadProbeHandler" )
+        {
+            REQUIRE( pPadProbeHandler->AddChild(pOdeTrigger) == true );
+            
+            THEN( "Stats are stored on the Trigger and Action until removed" )
+            {
+                REQUIRE( pOdeTrigger->GetOdeStats() != NULL );
+                REQUIRE( pOdeAction->GetOdeStats() != NULL );
+                
+                REQUIRE( pOdeTrigger->RemoveAction(pOdeAction) == true );
+                REQUIRE( pOdeAction->GetOdeStats() == NULL );
+                
+                REQUIRE( pPadProbeHandler->RemoveChild(pOdeTrigger) == true );
+                REQUIRE( pOdeTrigger->GetOdeStats() == NULL );
+            }
+        }
+    }
+}
+
 SCENARIO( "A OdePadProbeHandler can add and remove an OdeTrigger", "[PadProbeHandler]" )
 {
     GIVEN( "A new OdePadProbeHandler and OdeTrigger" ) 
@@ -222,6 +415,84 @@ SCENARIO( "A new MeterPadProbeHandler can Get/Set attributes correctly", "[PadPr
     }
 }
 
+SCENARIO( "A new MeterPadProbeHandler with Stats Handler is created correctly", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "Attributes for a new MeterPadProbeHandler" ) 
+    {
+        std::string meterHandlerName("meter-handler");
+        uint interval(1);
+        dsl_pph_meter_stats_handler_cb statsHandler;
+
+        WHEN( "The PadProbeHandler is created " )
+        {
+            DSL_PPH_METER_PTR pPadProbeHandler = DSL_PPH_METER_STATS_NEW(
+                meterHandlerName.c_str(), interval, statsHandler, NULL);
+                
+            THEN( "The correct attribute values are returned" )
+            {
+                REQUIRE( pPadProbeHandler->GetEnabled() == true );
+                REQUIRE( pPadProbeHandler->GetInterval() == interval );
+                REQUIRE( pPadProbeHandler->GetStallThreshold() == 
+                    DSL_PPH_METER_DEFAULT_STALL_THRESHOLD_MS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A SourceMeter measures FPS, jitter, stalls and drops correctly", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new SourceMeter" ) 
+    {
+        DSL_SOURCE_METER_PTR pSourceMeter = DSL_SOURCE_METER_NEW(2);
+        
+        // 10 ms stall threshold
+        uint64_t stallThreshold(10000000);
+        uint64_t timestamp(1000000000);
+        
+        dsl_meter_source_stats stats;
+        pSourceMeter->GetStats(&stats);
+        REQUIRE( stats.source_id == 2 );
+        REQUIRE( stats.frame_count == 0 );
+        REQUIRE( stats.session_fps_avg == 0 );
+
+        WHEN( "Frames are received at a constant rate of 200 FPS" )
+        {
+            for (int i=0; i<11; i++)
+            {
+                pSourceMeter->Update(timestamp, i, stallThreshold);
+                timestamp += 5000000;
+            }
+            THEN( "The correct measurements are returned" )
+            {
+                pSourceMeter->GetStats(&stats);
+                REQUIRE( stats.frame_count == 11 );
+                REQUIRE( stats.session_fps_avg == 200 );
+                REQUIRE( stats.interval_fps_avg == 200 );
+                REQUIRE( stats.jitter_max == 0 );
+                REQUIRE( stats.stall_count == 0 );
+                REQUIRE( stats.drop_count == 0 );
+            }
+        }
+        WHEN( "Frames are received with a stall and missing frame numbers" )
+        {
+            pSourceMeter->Update(timestamp, 0, stallThreshold);
+            pSourceMeter->Update(timestamp+5000000, 1, stallThreshold);
+            pSourceMeter->Update(timestamp+25000000, 4, stallThreshold);
+            
+            THEN( "The stall and dropped frames are counted" )
+            {
+                pSourceMeter->GetStats(&stats);
+                REQUIRE( stats.frame_count == 3 );
+                REQUIRE( stats.stall_count == 1 );
+                REQUIRE( stats.drop_count == 2 );
+                REQUIRE( stats.jitter_max > 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new EosConsumerPadProbeEventHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new EosConsumerPadProbeEventHandler" ) 
@@ -266,9 +537,6 @@ SCENARIO( "A new TimestampPadProbeHandler is created correctly", "[PadProbeHandl
     GIVEN( "Attributes for a new TimestampPadProbeHandler" ) 
     {
         std::string handlerName("timestamp-handler");
-        struct timeval timestamp{0};
-        timestamp.tv_sec = 123;
-        timestamp.tv_usec = 456;
 
         WHEN( "The PadProbeHandler is created " )
         {
@@ -277,9 +545,8 @@ SCENARIO( "A new TimestampPadProbeHandler is created correctly", "[PadProbeHandl
                 
             THEN( "The correct attribute values are returned" )
             {
-                pPadProbeHandler->GetTime(timestamp);
-                REQUIRE( timestamp.tv_sec == 0 );
-                REQUIRE( timestamp.tv_usec == 0 );
+                REQUIRE( pPadProbeHandler->GetTimestamp() == 0 );
+                REQUIRE( pPadProbeHandler->GetTimestampPtr()->load() == 0 );
             }
         }
     }
@@ -290,8 +557,7 @@ SCENARIO( "When a TimestampPadProbeHandler timestamp is Set the correct value is
     GIVEN( "Attributes for a new TimestampPadProbeHandler" ) 
     {
         std::string handlerName("timestamp-handler");
-        struct timeval timestamp{123,345};
-        struct timeval retTimestamp{0,0};
+        uint64_t timestamp(123456789);
 
         DSL_PPH_TIMESTAMP_PTR pPadProbeHandler = 
             DSL_PPH_TIMESTAMP_NEW(handlerName.c_str());
@@ -301,10 +567,8 @@ SCENARIO( "When a TimestampPadProbeHandler timestamp is Set the correct value is
                 
             THEN( "The correct attribute values are returned" )
             {
-                pPadProbeHandler->SetTime(timestamp);
-                pPadProbeHandler->GetTime(retTimestamp);
-                REQUIRE( retTimestamp.tv_sec == timestamp.tv_sec );
-                REQUIRE( retTimestamp.tv_usec == timestamp.tv_usec );
+                pPadProbeHandler->SetTimestamp(timestamp);
+                REQUIRE( pPadProbeHandler->GetTimestamp() == timestamp );
             }
         }
     }
@@ -588,3 +852,72 @@ SCENARIO( "Multiple Pad-Probe-Event-Handlers can be added to the Pads of a Bintr
         } 
     }
 }
+
+static uint custom_pph_ok_cb(void* buffer, void* client_data)
+{
+    (*(uint*)client_data)++;
+    return DSL_PAD_PROBE_OK;
+}
+
+static uint custom_pph_remove_cb(void* buffer, void* client_data)
+{
+    (*(uint*)client_data)++;
+    return DSL_PAD_PROBE_REMOVE;
+}
+
+SCENARIO( "A PadBufferProbetr calls its Handler chain and removes Handlers on request", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A PadBufferProbetr with two Custom PadProbeHandlers" ) 
+    {
+        GstElement* pFakeSink = gst_element_factory_make("fakesink", NULL);
+        REQUIRE( pFakeSink != NULL );
+        
+        DSL_PAD_BUFFER_PROBE_PTR pBufferProbe = 
+            DSL_PAD_BUFFER_PROBE_NEW("sink-buffer-probe", "sink", pFakeSink);
+            
+        uint okCount(0), removeCount(0);
+        
+        DSL_PPH_CUSTOM_PTR pOkHandler = DSL_PPH_CUSTOM_NEW("ok-handler", 
+            custom_pph_ok_cb, &okCount);
+        DSL_PPH_CUSTOM_PTR pRemoveHandler = DSL_PPH_CUSTOM_NEW("remove-handler", 
+            custom_pph_remove_cb, &removeCount);
+            
+        REQUIRE( pBufferProbe->AddPadProbeHandler(pOkHandler) == true );
+        REQUIRE( pBufferProbe->AddPadProbeHandler(pRemoveHandler) == true );
+        REQUIRE( pBufferProbe->AddPadProbeHandler(pRemoveHandler) == false );
+        
+        GstBuffer* pBuffer = gst_buffer_new();
+        GstPadProbeInfo info = {};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+
+        WHEN( "A buffer is handled and one Handler requests removal" )
+        {
+            pBufferProbe->HandlePadProbe(NULL, &info);
+            pBufferProbe->HandlePadProbe(NULL, &info);
+            
+            THEN( "The Handler is called once and then removed" )
+            {
+                REQUIRE( okCount == 2 );
+                REQUIRE( removeCount == 1 );
+                REQUIRE( pBufferProbe->IsChild(pRemoveHandler) == false );
+                REQUIRE( pBufferProbe->IsChild(pOkHandler) == true );
+            }
+        }
+        WHEN( "A Handler is disabled" )
+        {
+            REQUIRE( pOkHandler->SetEnabled(false) == true );
+            pBufferProbe->HandlePadProbe(NULL, &info);
+            
+            THEN( "The disabled Handler is not called" )
+            {
+                REQUIRE( okCount == 0 );
+                REQUIRE( removeCount == 1 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+        pBufferProbe = nullptr;
+        gst_object_unref(pFakeSink);
+    }
+}
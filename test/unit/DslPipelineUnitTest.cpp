@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslSourceBintr.h"
 #include "DslSinkBintr.h"
 #include "DslPipelineBintr.h"
+#include "DslMetaExportWriter.h"
 
 #define TIME_TO_SLEEP_FOR std::chrono::milliseconds(1000)
 
@@ -1062,3 +1063,159 @@ SCENARIO( "A Pipeline with an FileSourceBintr is able to Link/UnlinkAll", "[Pipe
         }
     }
 }
+
+SCENARIO( "A Pipeline can add and remove Latency Points", "[PipelineBintr]" )
+{
+    GIVEN( "A new PipelineBintr and EglSinkBintr" ) 
+    {
+        DSL_EGL_SINK_PTR pSinkBintr = 
+            DSL_EGL_SINK_NEW(sinkName.c_str(), offsetX, offsetY, windowW, windowH);
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        
+        REQUIRE( pPipelineBintr->GetLatencyEnabled() == true );
+        
+        long sinkUseCount = pSinkBintr.use_count();
+            
+        WHEN( "Latency Points are added to the Streammuxer and Sink" )
+        {
+            REQUIRE( pPipelineBintr->AddLatencyPoint(pipelineName.c_str(),
+                pPipelineBintr->GetPipelineSourcesBintr(), DSL_PAD_SRC, false) == true );
+            REQUIRE( pPipelineBintr->AddLatencyPoint(sinkName.c_str(),
+                pSinkBintr, DSL_PAD_SINK, false) == true );
+
+            THEN( "The Latency Points can be queried and removed" )
+            {
+                // a Sink has no src pad probe
+                REQUIRE( pPipelineBintr->AddLatencyPoint(sinkName.c_str(),
+                    pSinkBintr, DSL_PAD_SRC, false) == false );
+                REQUIRE( pPipelineBintr->AddLatencyPoint(sinkName.c_str(),
+                    pSinkBintr, DSL_PAD_SINK, false) == false );
+                    
+                dsl_latency_stats stats;
+                REQUIRE( pPipelineBintr->GetLatencyPointStats(sinkName.c_str(),
+                    DSL_PAD_SINK, &stats) == true );
+                REQUIRE( stats.count == 0 );
+                REQUIRE( pPipelineBintr->GetLatencyPointStats(sinkName.c_str(),
+                    DSL_PAD_SRC, &stats) == false );
+                pPipelineBintr->GetLatencyTotalStats(&stats);
+                REQUIRE( stats.count == 0 );
+                
+                REQUIRE( pPipelineBintr->RemoveLatencyPoint(sinkName.c_str(),
+                    DSL_PAD_SINK) == true );
+                REQUIRE( pPipelineBintr->RemoveLatencyPoint(sinkName.c_str(),
+                    DSL_PAD_SINK) == false );
+                REQUIRE( pPipelineBintr->GetLatencyPointStats(sinkName.c_str(),
+                    DSL_PAD_SINK, &stats) == false );
+                REQUIRE( pPipelineBintr->RemoveLatencyPoint(pipelineName.c_str(),
+                    DSL_PAD_SRC) == true );
+                    
+                // removed while stopped, the point no longer holds the Sink.
+                REQUIRE( pSinkBintr.use_count() == sinkUseCount );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's terminal Latency Points each end the end-to-end latency", 
+    "[PipelineBintr]" )
+{
+    GIVEN( "A new PipelineBintr with a Latency Point before two branches" ) 
+    {
+        DSL_FAKE_SINK_PTR pSinkBintr = DSL_FAKE_SINK_NEW(sinkName.c_str());
+        DSL_FAKE_SINK_PTR pSinkBintr1 = DSL_FAKE_SINK_NEW(sinkName1.c_str());
+        DSL_FAKE_SINK_PTR pSinkBintr2 = DSL_FAKE_SINK_NEW(sinkName2.c_str());
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        
+        REQUIRE( pPipelineBintr->AddLatencyPoint(sinkName.c_str(),
+            pSinkBintr, DSL_PAD_SINK, false) == true );
+        REQUIRE( pPipelineBintr->AddLatencyPoint(sinkName1.c_str(),
+            pSinkBintr1, DSL_PAD_SINK, true) == true );
+        REQUIRE( pPipelineBintr->AddLatencyPoint(sinkName2.c_str(),
+            pSinkBintr2, DSL_PAD_SINK, true) == true );
+            
+        GstBuffer* pBuffer = gst_buffer_new();
+        GST_BUFFER_PTS(pBuffer) = 1000;
+        GstPadProbeInfo info = {};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+
+        WHEN( "A buffer crosses the first point and then each branch" )
+        {
+            pPipelineBintr->GetLatencyPoint(sinkName.c_str(), 
+                DSL_PAD_SINK)->HandlePadData(&info);
+            pPipelineBintr->GetLatencyPoint(sinkName1.c_str(), 
+                DSL_PAD_SINK)->HandlePadData(&info);
+            pPipelineBintr->GetLatencyPoint(sinkName2.c_str(), 
+                DSL_PAD_SINK)->HandlePadData(&info);
+            
+            // a repeated buffer is not measured twice
+            pPipelineBintr->GetLatencyPoint(sinkName2.c_str(), 
+                DSL_PAD_SINK)->HandlePadData(&info);
+            
+            THEN( "Both branches measure from the first point" )
+            {
+                dsl_latency_stats stats;
+                REQUIRE( pPipelineBintr->GetLatencyPointStats(sinkName1.c_str(),
+                    DSL_PAD_SINK, &stats) == true );
+                REQUIRE( stats.count == 1 );
+                REQUIRE( pPipelineBintr->GetLatencyPointStats(sinkName2.c_str(),
+                    DSL_PAD_SINK, &stats) == true );
+                REQUIRE( stats.count == 1 );
+                pPipelineBintr->GetLatencyTotalStats(&stats);
+                REQUIRE( stats.count == 2 );
+                
+                gst_buffer_unref(pBuffer);
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline with a MetaReplaySourceBintr can LinkAll and relink", 
+    "[PipelineBintr]" )
+{
+    GIVEN( "A new MetaReplaySourceBintr, FakeSinkBintr, and a PipelineBintr" ) 
+    {
+        std::string replayFilePath("./meta-replay-pipeline-test.bin");
+        
+        // An export writer with no records writes only the stream header.
+        DSL_META_EXPORT_WRITER_NEW("meta-export-writer", 
+            DSL_SINK_META_EXPORT_TRANSPORT_FILE, replayFilePath.c_str(), 0, 1);
+        
+        DSL_META_REPLAY_SOURCE_PTR pSourceBintr = DSL_META_REPLAY_SOURCE_NEW(
+            sourceName.c_str(), replayFilePath.c_str(), 0, 
+            DSL_SOURCE_META_REPLAY_SURFACE_NONE, 0, 0);
+            
+        DSL_URI_SOURCE_PTR pUriSourceBintr = DSL_URI_SOURCE_NEW(
+            sourceName1.c_str(), filePath.c_str(), false, false, 0);
+
+        DSL_FAKE_SINK_PTR pSinkBintr = DSL_FAKE_SINK_NEW(sinkName.c_str());
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+            
+        WHEN( "The MetaReplaySourceBintr is added to the PipelineBintr" )
+        {
+            REQUIRE( pSourceBintr->AddToParent(pPipelineBintr) == true );
+            REQUIRE( pSinkBintr->AddToParent(pPipelineBintr) == true );
+            
+            THEN( "No other Source can be added, and it can be relinked" )
+            {
+                REQUIRE( pSourceBintr->IsParent(pPipelineBintr) == true );
+                REQUIRE( pUriSourceBintr->AddToParent(pPipelineBintr) == false );
+                
+                REQUIRE( pPipelineBintr->LinkAll() == true );
+                REQUIRE( pSourceBintr->IsLinked() == true );
+                pPipelineBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->IsLinked() == false );
+                REQUIRE( pPipelineBintr->LinkAll() == true );
+                pPipelineBintr->UnlinkAll();
+                
+                REQUIRE( pSourceBintr->RemoveFromParent(pPipelineBintr) == true );
+                REQUIRE( pSourceBintr->IsParent(pPipelineBintr) == false );
+                
+                remove(replayFilePath.c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslReconnectionCoordinator.h"
+
+using namespace DSL;
+
+SCENARIO( "The ReconnectionCoordinator caps the number of concurrent attempts", 
+    "[ReconnectionCoordinator]" )
+{
+    GIVEN( "The ReconnectionCoordinator with a maximum of 2 concurrent attempts" ) 
+    {
+        ReconnectionCoordinator* pCoordinator = 
+            ReconnectionCoordinator::GetCoordinator();
+        REQUIRE( pCoordinator->SetParams(2, 
+            DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == true );
+        pCoordinator->ClearStats();
+
+        WHEN( "Three sources request an attempt" )
+        {
+            REQUIRE( pCoordinator->RequestAttempt("source-1", 100) == true );
+            REQUIRE( pCoordinator->RequestAttempt("source-2", 100) == true );
+            REQUIRE( pCoordinator->RequestAttempt("source-3", 100) == false );
+
+            THEN( "The third is deferred until a slot is released" )
+            {
+                dsl_rtsp_reconnection_stats stats{0};
+                pCoordinator->GetStats(&stats);
+                REQUIRE( stats.active == 2 );
+                REQUIRE( stats.waiting == 1 );
+                REQUIRE( stats.peak_active == 2 );
+                REQUIRE( stats.attempts == 2 );
+                REQUIRE( stats.deferrals == 1 );
+                
+                // a repeated request by the holder is granted
+                REQUIRE( pCoordinator->RequestAttempt("source-1", 100) == true );
+                
+                // a repeated request by the waiter is not counted twice
+                REQUIRE( pCoordinator->RequestAttempt("source-3", 100) == false );
+                
+                pCoordinator->ReleaseAttempt("source-1", true);
+                pCoordinator->ReleaseAttempt("source-2", false);
+                REQUIRE( pCoordinator->RequestAttempt("source-3", 100) == true );
+                pCoordinator->ReleaseAttempt("source-3", true);
+
+                pCoordinator->GetStats(&stats);
+                REQUIRE( stats.active == 0 );
+                REQUIRE( stats.waiting == 0 );
+                REQUIRE( stats.attempts == 3 );
+                REQUIRE( stats.successes == 2 );
+                REQUIRE( stats.failures == 1 );
+                REQUIRE( stats.deferrals == 1 );
+            }
+        }
+        REQUIRE( pCoordinator->SetParams(DSL_RTSP_RECONNECTION_MAX_CONCURRENT, 
+            DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == true );
+    }
+}
+
+SCENARIO( "The ReconnectionCoordinator grants slots to the most recently healthy source first", 
+    "[ReconnectionCoordinator]" )
+{
+    GIVEN( "The ReconnectionCoordinator with a maximum of 1 concurrent attempt" ) 
+    {
+        ReconnectionCoordinator* pCoordinator = 
+            ReconnectionCoordinator::GetCoordinator();
+        REQUIRE( pCoordinator->SetParams(1, 
+            DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == true );
+
+        REQUIRE( pCoordinator->RequestAttempt("source-1", 100) == true );
+
+        WHEN( "A long failed and a recently healthy source wait for a slot" )
+        {
+            REQUIRE( pCoordinator->RequestAttempt("never-healthy", 0) == false );
+            REQUIRE( pCoordinator->RequestAttempt("recently-healthy", 500) == false );
+            
+            pCoordinator->ReleaseAttempt("source-1", true);
+
+            THEN( "The recently healthy source is granted the free slot" )
+            {
+                REQUIRE( pCoordinator->RequestAttempt("never-healthy", 0) == false );
+                REQUIRE( pCoordinator->RequestAttempt("recently-healthy", 500) == true );
+                
+                pCoordinator->ReleaseAttempt("recently-healthy", true);
+                REQUIRE( pCoordinator->RequestAttempt("never-healthy", 0) == true );
+                pCoordinator->ReleaseAttempt("never-healthy", true);
+            }
+        }
+        WHEN( "A waiting source is cancelled" )
+        {
+            REQUIRE( pCoordinator->RequestAttempt("recently-healthy", 500) == false );
+            REQUIRE( pCoordinator->RequestAttempt("never-healthy", 0) == false );
+            pCoordinator->CancelAttempt("recently-healthy");
+            pCoordinator->CancelAttempt("source-1");
+
+            THEN( "The next waiter is granted the free slot" )
+            {
+                REQUIRE( pCoordinator->RequestAttempt("never-healthy", 0) == true );
+                pCoordinator->ReleaseAttempt("never-healthy", true);
+            }
+        }
+        REQUIRE( pCoordinator->SetParams(DSL_RTSP_RECONNECTION_MAX_CONCURRENT, 
+            DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == true );
+    }
+}
+
+SCENARIO( "The ReconnectionCoordinator calculates exponential backoff with jitter", 
+    "[ReconnectionCoordinator]" )
+{
+    GIVEN( "The ReconnectionCoordinator with a maximum backoff of 60 seconds" ) 
+    {
+        ReconnectionCoordinator* pCoordinator = 
+            ReconnectionCoordinator::GetCoordinator();
+        REQUIRE( pCoordinator->SetParams(DSL_RTSP_RECONNECTION_MAX_CONCURRENT, 
+            60) == true );
+        uint baseSleep(5);
+
+        WHEN( "The backoff is calculated for consecutive failures" )
+        {
+            THEN( "Each backoff is between half and all of the capped exponential" )
+            {
+                uint64_t expected[] = {5000, 10000, 20000, 40000, 60000, 60000};
+                bool jittered(false);
+                
+                for (uint failures = 1; failures <= 6; failures++)
+                {
+                    uint64_t backoff = pCoordinator->GetBackoff(baseSleep, failures);
+                    REQUIRE( backoff >= expected[failures-1]/2 );
+                    REQUIRE( backoff <= expected[failures-1] );
+                    
+                    jittered |= (backoff != 
+                        pCoordinator->GetBackoff(baseSleep, failures));
+                }
+                REQUIRE( jittered == true );
+                REQUIRE( pCoordinator->GetBackoff(0, 3) == 0 );
+            }
+        }
+        REQUIRE( pCoordinator->SetParams(DSL_RTSP_RECONNECTION_MAX_CONCURRENT, 
+            DSL_RTSP_RECONNECTION_MAX_BACKOFF_S) == true );
+    }
+}
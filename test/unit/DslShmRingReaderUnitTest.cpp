@@ -0,0 +1,259 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslShmRingReader.h"
+#include "DslShmProducer.h"
+
+using namespace DSL;
+
+static const std::string shmName("/dsl-test-shm-ring");
+static const uint width(64), height(32), fpsN(30), fpsD(1);
+static const uint slotSize(width*height*3/2);
+
+SCENARIO( "A ShmRingReader delivers committed frames in order", "[ShmRingReader]" )
+{
+    GIVEN( "A new ShmRingReader with 4 slots and an attached producer" ) 
+    {
+        dsl_shm_producer* pProducer(NULL);
+        
+        // the producer can't attach until the ring has been created
+        REQUIRE( dsl_shm_producer_open(shmName.c_str(), &pProducer) 
+            == DSL_SHM_PRODUCER_RESULT_RING_NOT_FOUND );
+
+        DSL_SHM_RING_READER_PTR pReader = DSL_SHM_RING_READER_NEW(
+            shmName.c_str(), "I420", width, height, fpsN, fpsD, slotSize, 4);
+        
+        REQUIRE( dsl_shm_producer_open(shmName.c_str(), &pProducer) 
+            == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            
+        const char* format(NULL);
+        uint32_t retWidth(0), retHeight(0), retSlotSize(0);
+        REQUIRE( dsl_shm_producer_format_get(pProducer, &format, &retWidth, 
+            &retHeight, &retSlotSize) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+        REQUIRE( std::string(format) == "I420" );
+        REQUIRE( retWidth == width );
+        REQUIRE( retHeight == height );
+        REQUIRE( retSlotSize == slotSize );
+        
+        uint64_t seq(0), size(0), timestamp(0);
+        void* data(NULL);
+
+        WHEN( "Three frames are committed by the producer" )
+        {
+            for (uint i = 0; i < 3; i++)
+            {
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+                REQUIRE( size == slotSize );
+                memset(data, i+1, 100);
+                REQUIRE( dsl_shm_producer_frame_commit(pProducer, 100, i*1000)
+                    == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+            // a second commit without an acquire must fail
+            REQUIRE( dsl_shm_producer_frame_commit(pProducer, 100, 0)
+                == DSL_SHM_PRODUCER_RESULT_FRAME_NOT_ACQUIRED );
+            
+            THEN( "The frames are read in place and in order" )
+            {
+                for (uint i = 0; i < 3; i++)
+                {
+                    REQUIRE( pReader->WaitForFrame(0, &seq, &data, 
+                        &size, &timestamp) == true );
+                    REQUIRE( seq == i );
+                    REQUIRE( size == 100 );
+                    REQUIRE( timestamp == i*1000 );
+                    REQUIRE( ((uint8_t*)data)[99] == i+1 );
+                }
+                REQUIRE( pReader->WaitForFrame(1, &seq, &data, 
+                    &size, &timestamp) == false );
+                
+                dsl_shm_source_stats stats;
+                pReader->GetStats(&stats);
+                REQUIRE( stats.num_slots == 4 );
+                REQUIRE( stats.occupied == 3 );
+                REQUIRE( stats.peak_occupied == 3 );
+                REQUIRE( stats.producer_attached == true );
+                REQUIRE( stats.producer_restarts == 0 );
+                REQUIRE( stats.frames_received == 3 );
+                REQUIRE( stats.overruns == 0 );
+                
+                // out-of-order releases free slots in ring order only
+                pReader->ReleaseFrame(1);
+                pReader->GetStats(&stats);
+                REQUIRE( stats.occupied == 3 );
+                pReader->ReleaseFrame(0);
+                pReader->GetStats(&stats);
+                REQUIRE( stats.occupied == 1 );
+                pReader->ReleaseFrame(2);
+                pReader->GetStats(&stats);
+                REQUIRE( stats.occupied == 0 );
+                
+                REQUIRE( dsl_shm_producer_close(pProducer) 
+                    == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The producer fills all slots of the ring" )
+        {
+            for (uint i = 0; i < 4; i++)
+            {
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+                REQUIRE( dsl_shm_producer_frame_commit(pProducer, size, 
+                    DSL_SHM_RING_TIMESTAMP_NONE) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+            THEN( "Further acquires overrun until a slot is released" )
+            {
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_RING_FULL );
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 5, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_RING_FULL );
+
+                dsl_shm_source_stats stats;
+                pReader->GetStats(&stats);
+                REQUIRE( stats.occupied == 4 );
+                REQUIRE( stats.overruns == 2 );
+                
+                // a blocked producer is woken by the release
+                REQUIRE( pReader->WaitForFrame(0, &seq, &data, 
+                    &size, &timestamp) == true );
+                std::thread releaser([&pReader, seq]()
+                {
+                    g_usleep(20000);
+                    pReader->ReleaseFrame(seq);
+                });
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 2000, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+                releaser.join();
+                
+                pReader->ClearStats();
+                pReader->GetStats(&stats);
+                REQUIRE( stats.overruns == 0 );
+                REQUIRE( stats.frames_received == 0 );
+                
+                REQUIRE( dsl_shm_producer_close(pProducer) 
+                    == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The producer restarts" )
+        {
+            REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( dsl_shm_producer_frame_commit(pProducer, size, 
+                DSL_SHM_RING_TIMESTAMP_NONE) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( pReader->WaitForFrame(0, &seq, &data, 
+                &size, &timestamp) == true );
+
+            // acquired but never committed by the first producer
+            REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( dsl_shm_producer_close(pProducer) 
+                == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            
+            dsl_shm_source_stats stats;
+            pReader->GetStats(&stats);
+            REQUIRE( stats.producer_attached == false );
+
+            REQUIRE( dsl_shm_producer_open(shmName.c_str(), &pProducer) 
+                == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( dsl_shm_producer_frame_commit(pProducer, size, 
+                DSL_SHM_RING_TIMESTAMP_NONE) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            
+            THEN( "The restart is detected and frames continue in sequence" )
+            {
+                REQUIRE( pReader->WaitForFrame(0, &seq, &data, 
+                    &size, &timestamp) == true );
+                REQUIRE( seq == 1 );
+                
+                pReader->GetStats(&stats);
+                REQUIRE( stats.producer_attached == true );
+                REQUIRE( stats.producer_restarts == 1 );
+                REQUIRE( stats.frames_received == 2 );
+
+                REQUIRE( dsl_shm_producer_close(pProducer) 
+                    == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The ShmRingReader is deleted" )
+        {
+            pReader = nullptr;
+            
+            THEN( "The producer finds the ring closed" )
+            {
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_RING_CLOSED );
+                REQUIRE( dsl_shm_producer_close(pProducer) 
+                    == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+                REQUIRE( dsl_shm_producer_open(shmName.c_str(), &pProducer) 
+                    == DSL_SHM_PRODUCER_RESULT_RING_NOT_FOUND );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ShmRingReader can Reset to skip unread frames", "[ShmRingReader]" )
+{
+    GIVEN( "A new ShmRingReader with unread frames in the ring" ) 
+    {
+        DSL_SHM_RING_READER_PTR pReader = DSL_SHM_RING_READER_NEW(
+            shmName.c_str(), "I420", width, height, fpsN, fpsD, slotSize, 2);
+        
+        dsl_shm_producer* pProducer(NULL);
+        REQUIRE( dsl_shm_producer_open(shmName.c_str(), &pProducer) 
+            == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            
+        uint64_t seq(0), size(0), timestamp(0);
+        void* data(NULL);
+        
+        for (uint i = 0; i < 2; i++)
+        {
+            REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( dsl_shm_producer_frame_commit(pProducer, size, 
+                DSL_SHM_RING_TIMESTAMP_NONE) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+        }
+
+        WHEN( "The ShmRingReader is Reset" )
+        {
+            pReader->Reset();
+            
+            THEN( "The unread frames are skipped and their slots are free" )
+            {
+                REQUIRE( pReader->WaitForFrame(1, &seq, &data, 
+                    &size, &timestamp) == false );
+                    
+                dsl_shm_source_stats stats;
+                pReader->GetStats(&stats);
+                REQUIRE( stats.occupied == 0 );
+                
+                REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 0, 
+                    &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+                REQUIRE( dsl_shm_producer_close(pProducer) 
+                    == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+        }
+    }
+}
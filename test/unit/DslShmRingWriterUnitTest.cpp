@@ -0,0 +1,298 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslShmRingWriter.h"
+#include "DslShmConsumer.h"
+
+using namespace DSL;
+
+static const std::string shmName("/dsl-test-shm-egress-ring");
+static const uint width(64), height(32);
+static const uint slotSize(width*height*4);
+
+static void write_frame(DSL_SHM_RING_WRITER_PTR pWriter, 
+    uint64_t frameNumber, uint numObjects)
+{
+    dsl_shm_egress_frame* pFrame = pWriter->BeginFrame();
+    dsl_shm_egress_object* pObjects = pWriter->GetObjects(pFrame);
+    
+    pFrame->timestamp = frameNumber*1000;
+    pFrame->frame_number = frameNumber;
+    pFrame->source_id = 1;
+    pFrame->data_size = slotSize;
+    memset(pWriter->GetData(pFrame), (uint8_t)frameNumber, slotSize);
+    
+    for (uint i = 0; i < numObjects and i < pWriter->GetMaxObjects(); i++)
+    {
+        pObjects[i] = {i, i%4, 1, 0.5f, (float)i, 0, 10, 10, 0};
+    }
+    pWriter->CommitFrame(pFrame, numObjects);
+}
+
+SCENARIO( "A ShmRingWriter delivers every frame to multiple readers", 
+    "[ShmRingWriter]" )
+{
+    GIVEN( "A new ShmRingWriter with 4 slots and two attached readers" ) 
+    {
+        dsl_shm_consumer* pConsumer1(NULL);
+        dsl_shm_consumer* pConsumer2(NULL);
+        
+        // readers can't attach until the ring has been created
+        REQUIRE( dsl_shm_consumer_open(shmName.c_str(), &pConsumer1) 
+            == DSL_SHM_CONSUMER_RESULT_RING_NOT_FOUND );
+
+        DSL_SHM_RING_WRITER_PTR pWriter = DSL_SHM_RING_WRITER_NEW(
+            shmName.c_str(), DSL_SHM_EGRESS_RING_DATA_TYPE_FRAMES, "RGBA", 
+            width, height, slotSize, 4);
+        
+        REQUIRE( dsl_shm_consumer_open(shmName.c_str(), &pConsumer1) 
+            == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+        REQUIRE( dsl_shm_consumer_open(shmName.c_str(), &pConsumer2) 
+            == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            
+        uint32_t dataType(0), retWidth(0), retHeight(0);
+        const char* format(NULL);
+        REQUIRE( dsl_shm_consumer_format_get(pConsumer1, &dataType, &format, 
+            &retWidth, &retHeight) == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+        REQUIRE( dataType == DSL_SHM_EGRESS_RING_DATA_TYPE_FRAMES );
+        REQUIRE( std::string(format) == "RGBA" );
+        REQUIRE( retWidth == width );
+        REQUIRE( retHeight == height );
+        
+        dsl_shm_sink_stats stats;
+        pWriter->GetStats(&stats);
+        REQUIRE( stats.num_slots == 4 );
+        REQUIRE( stats.readers == 2 );
+        REQUIRE( stats.slow_readers == 0 );
+        
+        const dsl_shm_egress_frame* pFrame(NULL);
+        const dsl_shm_egress_object* pObjects(NULL);
+        const void* pData(NULL);
+
+        WHEN( "Three frames are written" )
+        {
+            for (uint i = 1; i <= 3; i++)
+            {
+                write_frame(pWriter, i, i);
+            }
+            
+            THEN( "Each reader reads every frame in place and in order" )
+            {
+                for (auto pConsumer: {pConsumer1, pConsumer2})
+                {
+                    for (uint i = 1; i <= 3; i++)
+                    {
+                        REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer, 0,
+                            &pFrame, &pObjects, &pData) 
+                                == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                        REQUIRE( pFrame->frame_number == i );
+                        REQUIRE( pFrame->timestamp == i*1000 );
+                        REQUIRE( pFrame->num_objects == i );
+                        REQUIRE( pObjects[i-1].object_id == i-1 );
+                        REQUIRE( pFrame->data_size == slotSize );
+                        REQUIRE( ((uint8_t*)pData)[slotSize-1] == i );
+                        REQUIRE( dsl_shm_consumer_frame_release(pConsumer)
+                            == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                    }
+                    REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer, 0,
+                        &pFrame, &pObjects, &pData) 
+                            == DSL_SHM_CONSUMER_RESULT_TIMEOUT );
+                    REQUIRE( dsl_shm_consumer_frame_release(pConsumer)
+                        == DSL_SHM_CONSUMER_RESULT_FRAME_NOT_ACQUIRED );
+                        
+                    uint64_t framesRead(0), framesSkipped(0);
+                    REQUIRE( dsl_shm_consumer_stats_get(pConsumer, &framesRead,
+                        &framesSkipped) == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                    REQUIRE( framesRead == 3 );
+                    REQUIRE( framesSkipped == 0 );
+                }
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.frames_written == 3 );
+                REQUIRE( stats.reader_skips == 0 );
+                REQUIRE( stats.objects_dropped == 0 );
+                
+                REQUIRE( dsl_shm_consumer_close(pConsumer1) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.readers == 1 );
+                REQUIRE( dsl_shm_consumer_close(pConsumer2) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A frame has more objects than a slot can hold" )
+        {
+            write_frame(pWriter, 1, DSL_SHM_EGRESS_RING_MAX_OBJECTS+2);
+            
+            THEN( "The extra objects are dropped" )
+            {
+                REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer1, 0,
+                    &pFrame, &pObjects, &pData) 
+                        == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                REQUIRE( pFrame->num_objects == DSL_SHM_EGRESS_RING_MAX_OBJECTS );
+                    
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.objects_dropped == 2 );
+                
+                pWriter->ClearStats();
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.frames_written == 0 );
+                REQUIRE( stats.objects_dropped == 0 );
+                
+                REQUIRE( dsl_shm_consumer_close(pConsumer1) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                REQUIRE( dsl_shm_consumer_close(pConsumer2) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A slow reader skips ahead without blocking the ShmRingWriter", 
+    "[ShmRingWriter]" )
+{
+    GIVEN( "A new metadata-only ShmRingWriter with 4 slots and one reader" ) 
+    {
+        DSL_SHM_RING_WRITER_PTR pWriter = DSL_SHM_RING_WRITER_NEW(
+            shmName.c_str(), DSL_SHM_EGRESS_RING_DATA_TYPE_METADATA, "", 
+            0, 0, 0, 4);
+            
+        dsl_shm_consumer* pConsumer(NULL);
+        REQUIRE( dsl_shm_consumer_open(shmName.c_str(), &pConsumer) 
+            == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+        
+        const dsl_shm_egress_frame* pFrame(NULL);
+        const dsl_shm_egress_object* pObjects(NULL);
+        const void* pData(NULL);
+        dsl_shm_sink_stats stats;
+
+        WHEN( "The writer laps the reader" )
+        {
+            for (uint i = 1; i <= 10; i++)
+            {
+                dsl_shm_egress_frame* pWriteFrame = pWriter->BeginFrame();
+                pWriteFrame->frame_number = i;
+                pWriter->CommitFrame(pWriteFrame, 0);
+            }
+            pWriter->GetStats(&stats);
+            REQUIRE( stats.readers == 1 );
+            REQUIRE( stats.slow_readers == 1 );
+            
+            THEN( "The reader skips to the newest frame" )
+            {
+                REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer, 0,
+                    &pFrame, &pObjects, &pData) 
+                        == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                REQUIRE( pFrame->frame_number == 10 );
+                REQUIRE( pData == NULL );
+                REQUIRE( dsl_shm_consumer_frame_release(pConsumer)
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                    
+                uint64_t framesRead(0), framesSkipped(0);
+                REQUIRE( dsl_shm_consumer_stats_get(pConsumer, &framesRead,
+                    &framesSkipped) == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                REQUIRE( framesRead == 1 );
+                REQUIRE( framesSkipped == 9 );
+                
+                pWriter->GetStats(&stats);
+                REQUIRE( stats.slow_readers == 0 );
+                REQUIRE( stats.reader_skips == 9 );
+                
+                REQUIRE( dsl_shm_consumer_close(pConsumer) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A frame is overwritten while in use by the reader" )
+        {
+            dsl_shm_egress_frame* pWriteFrame = pWriter->BeginFrame();
+            pWriter->CommitFrame(pWriteFrame, 0);
+            
+            REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer, 0,
+                &pFrame, &pObjects, &pData) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                    
+            for (uint i = 0; i < 4; i++)
+            {
+                pWriteFrame = pWriter->BeginFrame();
+                pWriter->CommitFrame(pWriteFrame, 0);
+            }
+            
+            THEN( "The release reports the frame as overwritten" )
+            {
+                REQUIRE( dsl_shm_consumer_frame_release(pConsumer)
+                    == DSL_SHM_CONSUMER_RESULT_FRAME_OVERWRITTEN );
+                    
+                uint64_t framesRead(0), framesSkipped(0);
+                REQUIRE( dsl_shm_consumer_stats_get(pConsumer, &framesRead,
+                    &framesSkipped) == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                REQUIRE( framesRead == 0 );
+                REQUIRE( framesSkipped == 1 );
+                
+                REQUIRE( dsl_shm_consumer_close(pConsumer) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A reader is waiting when a frame is written" )
+        {
+            std::thread writerThread([pWriter]()
+            {
+                g_usleep(50000);
+                dsl_shm_egress_frame* pWriteFrame = pWriter->BeginFrame();
+                pWriteFrame->frame_number = 1;
+                pWriter->CommitFrame(pWriteFrame, 0);
+            });
+            
+            THEN( "The reader is woken with the new frame" )
+            {
+                REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer, 5000,
+                    &pFrame, &pObjects, &pData) 
+                        == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+                REQUIRE( pFrame->frame_number == 1 );
+                writerThread.join();
+                
+                REQUIRE( dsl_shm_consumer_close(pConsumer) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The writer closes the ring while a reader is waiting" )
+        {
+            std::thread writerThread([&pWriter]()
+            {
+                g_usleep(50000);
+                pWriter = nullptr;
+            });
+            
+            THEN( "The reader finds the ring closed" )
+            {
+                REQUIRE( dsl_shm_consumer_frame_acquire(pConsumer, 5000,
+                    &pFrame, &pObjects, &pData) 
+                        == DSL_SHM_CONSUMER_RESULT_RING_CLOSED );
+                writerThread.join();
+                
+                REQUIRE( dsl_shm_consumer_close(pConsumer) 
+                    == DSL_SHM_CONSUMER_RESULT_SUCCESS );
+            }
+        }
+    }
+}
@@ -84,6 +84,291 @@ SCENARIO( "A new AppSinkBintr can LinkAll Child Elementrs", "[SinkBintr]" )
     }
 }
 
+static std::atomic<bool> deliveryReleased(true);
+static std::atomic<uint> buffersDelivered(0);
+
+static uint blocking_new_data_cb(uint data_type, 
+    void* data, void* client_data)
+{
+    while (!deliveryReleased)
+    {
+        g_usleep(1000);
+    }
+    if (data_type == DSL_SINK_APP_DATA_TYPE_BUFFER_LIST)
+    {
+        buffersDelivered += gst_buffer_list_length((GstBufferList*)data);
+    }
+    else
+    {
+        buffersDelivered++;
+    }
+    return DSL_FLOW_OK;
+}
+
+static GstSample* new_test_sample()
+{
+    GstBuffer* pBuffer = gst_buffer_new();
+    GstSample* pSample = gst_sample_new(pBuffer, NULL, NULL, NULL);
+    gst_buffer_unref(pBuffer);
+    return pSample;
+}
+
+static void wait_for_delivery_queue_empty(DSL_APP_SINK_PTR pSinkBintr)
+{
+    dsl_sink_app_delivery_stats stats{0};
+    for (uint i = 0; i < 500; i++)
+    {
+        pSinkBintr->GetDeliveryStats(&stats);
+        if (!stats.queue_depth)
+        {
+            return;
+        }
+        g_usleep(1000);
+    }
+}
+
+SCENARIO( "An AppSinkBintr's delivery settings are updated correctly",  "[SinkBintr]" )
+{
+    GIVEN( "A new AppSinkBintr" ) 
+    {
+        std::string sinkName("app-sink");
+        uint queueSize(99), policy(99), batchSize(99);
+
+        DSL_APP_SINK_PTR pSinkBintr = DSL_APP_SINK_NEW(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, new_buffer_cb, NULL);
+
+        pSinkBintr->GetDeliverySettings(&queueSize, &policy, &batchSize);
+        REQUIRE( queueSize == 0 );
+        REQUIRE( policy == DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST );
+        REQUIRE( batchSize == 1 );
+
+        WHEN( "The delivery settings are updated while unlinked" )
+        {
+            REQUIRE( pSinkBintr->SetDeliverySettings(8, 
+                DSL_SINK_APP_DELIVERY_POLICY_BLOCK, 4) == true );
+
+            THEN( "The correct values are returned on get" )
+            {
+                pSinkBintr->GetDeliverySettings(&queueSize, &policy, &batchSize);
+                REQUIRE( queueSize == 8 );
+                REQUIRE( policy == DSL_SINK_APP_DELIVERY_POLICY_BLOCK );
+                REQUIRE( batchSize == 4 );
+                
+                // Settings can't be updated once linked
+                REQUIRE( pSinkBintr->LinkAll() == true );
+                REQUIRE( pSinkBintr->SetDeliverySettings(0, 
+                    DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST, 1) == false );
+                pSinkBintr->UnlinkAll();
+            }
+        }
+    }
+}
+
+SCENARIO( "An AppSinkBintr applies its delivery policy to a slow client",  "[SinkBintr]" )
+{
+    GIVEN( "A linked AppSinkBintr with a blocked client handler" ) 
+    {
+        std::string sinkName("app-sink");
+        dsl_sink_app_delivery_stats stats{0};
+
+        DSL_APP_SINK_PTR pSinkBintr = DSL_APP_SINK_NEW(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, blocking_new_data_cb, NULL);
+            
+        deliveryReleased = false;
+        buffersDelivered = 0;
+
+        WHEN( "The drop-oldest policy is used" )
+        {
+            REQUIRE( pSinkBintr->SetDeliverySettings(2, 
+                DSL_SINK_APP_DELIVERY_POLICY_DROP_OLDEST, 1) == true );
+            REQUIRE( pSinkBintr->LinkAll() == true );
+
+            // First sample is taken by the delivery thread and blocks
+            REQUIRE( pSinkBintr->QueueSample(new_test_sample()) == GST_FLOW_OK );
+            wait_for_delivery_queue_empty(pSinkBintr);
+            
+            for (uint i = 0; i < 4; i++)
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample()) == GST_FLOW_OK );
+            }
+            
+            THEN( "The oldest samples are dropped and the newest delivered" )
+            {
+                pSinkBintr->GetDeliveryStats(&stats);
+                REQUIRE( stats.received == 5 );
+                REQUIRE( stats.dropped == 2 );
+                REQUIRE( stats.queue_depth == 2 );
+                REQUIRE( stats.peak_queue_depth == 2 );
+                
+                deliveryReleased = true;
+                wait_for_delivery_queue_empty(pSinkBintr);
+                pSinkBintr->UnlinkAll();
+                
+                pSinkBintr->GetDeliveryStats(&stats);
+                REQUIRE( stats.delivered == 3 );
+                REQUIRE( stats.lag.count == 3 );
+                REQUIRE( buffersDelivered == 3 );
+            }
+        }
+        WHEN( "The drop-newest policy is used with batching" )
+        {
+            REQUIRE( pSinkBintr->SetDeliverySettings(2, 
+                DSL_SINK_APP_DELIVERY_POLICY_DROP_NEWEST, 4) == true );
+            REQUIRE( pSinkBintr->LinkAll() == true );
+
+            REQUIRE( pSinkBintr->QueueSample(new_test_sample()) == GST_FLOW_OK );
+            wait_for_delivery_queue_empty(pSinkBintr);
+            
+            for (uint i = 0; i < 4; i++)
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample()) == GST_FLOW_OK );
+            }
+            
+            THEN( "The newest samples are dropped and the queue delivered as a batch" )
+            {
+                pSinkBintr->GetDeliveryStats(&stats);
+                REQUIRE( stats.received == 5 );
+                REQUIRE( stats.dropped == 2 );
+                
+                deliveryReleased = true;
+                wait_for_delivery_queue_empty(pSinkBintr);
+                pSinkBintr->UnlinkAll();
+                
+                pSinkBintr->GetDeliveryStats(&stats);
+                REQUIRE( stats.delivered == 3 );
+                REQUIRE( buffersDelivered == 3 );
+                
+                pSinkBintr->ClearDeliveryStats();
+                pSinkBintr->GetDeliveryStats(&stats);
+                REQUIRE( stats.received == 0 );
+                REQUIRE( stats.delivered == 0 );
+                REQUIRE( stats.dropped == 0 );
+                REQUIRE( stats.lag.count == 0 );
+            }
+        }
+        deliveryReleased = true;
+    }
+}
+
+static AppSinkBintr* restartingSinkBintr(NULL);
+
+static uint restarting_new_data_cb(uint data_type, 
+    void* data, void* client_data)
+{
+    // Stop and restart delivery from within the delivery thread, and end
+    // the stream for the stopped session only.
+    if (++buffersDelivered == 1)
+    {
+        restartingSinkBintr->UnlinkAll();
+        restartingSinkBintr->LinkAll();
+        return DSL_FLOW_EOS;
+    }
+    return DSL_FLOW_OK;
+}
+
+SCENARIO( "An AppSinkBintr's delivery can be restarted from its client handler",  
+    "[SinkBintr]" )
+{
+    GIVEN( "A linked AppSinkBintr with a client handler that restarts delivery" ) 
+    {
+        std::string sinkName("app-sink");
+        dsl_sink_app_delivery_stats stats{0};
+
+        DSL_APP_SINK_PTR pSinkBintr = DSL_APP_SINK_NEW(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, restarting_new_data_cb, NULL);
+        restartingSinkBintr = pSinkBintr.get();
+        buffersDelivered = 0;
+            
+        REQUIRE( pSinkBintr->SetDeliverySettings(2, 
+            DSL_SINK_APP_DELIVERY_POLICY_BLOCK, 1) == true );
+        REQUIRE( pSinkBintr->LinkAll() == true );
+
+        WHEN( "The first sample is delivered" )
+        {
+            REQUIRE( pSinkBintr->QueueSample(new_test_sample()) == GST_FLOW_OK );
+            
+            for (uint i = 0; i < 500 and !stats.delivered; i++)
+            {
+                g_usleep(1000);
+                pSinkBintr->GetDeliveryStats(&stats);
+            }
+            REQUIRE( stats.delivered == 1 );
+            
+            THEN( "The stopped session's flow-return doesn't end the new session" )
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample()) == GST_FLOW_OK );
+                wait_for_delivery_queue_empty(pSinkBintr);
+                for (uint i = 0; i < 500 and buffersDelivered < 2; i++)
+                {
+                    g_usleep(1000);
+                }
+                REQUIRE( buffersDelivered == 2 );
+                
+                pSinkBintr->UnlinkAll();
+            }
+        }
+    }
+}
+
+SCENARIO( "An AppSinkBintr delivers all buffers from a videotestsrc with the block policy", 
+    "[SinkBintr]" )
+{
+    GIVEN( "A Pipeline with a videotestsrc and a batching AppSinkBintr" ) 
+    {
+        std::string sinkName("app-sink");
+        dsl_sink_app_delivery_stats stats{0};
+
+        DSL_APP_SINK_PTR pSinkBintr = DSL_APP_SINK_NEW(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, blocking_new_data_cb, NULL);
+        REQUIRE( pSinkBintr->SetSyncEnabled(false) == true );
+        REQUIRE( pSinkBintr->SetDeliverySettings(4, 
+            DSL_SINK_APP_DELIVERY_POLICY_BLOCK, 3) == true );
+        REQUIRE( pSinkBintr->LinkAll() == true );
+        
+        deliveryReleased = true;
+        buffersDelivered = 0;
+
+        GstElement* pPipeline = gst_pipeline_new("test-pipeline");
+        GstElement* pSource = gst_element_factory_make("videotestsrc", NULL);
+        g_object_set(pSource, "num-buffers", 30, NULL);
+        
+        // The Pipeline takes the floating reference - the AppSinkBintr keeps its own
+        gst_object_ref(pSinkBintr->GetGstElement());
+        gst_bin_add_many(GST_BIN(pPipeline), pSource, 
+            pSinkBintr->GetGstElement(), NULL);
+        REQUIRE( gst_element_link(pSource, pSinkBintr->GetGstElement()) == TRUE );
+
+        WHEN( "The Pipeline is played to end-of-stream" )
+        {
+            gst_element_set_state(pPipeline, GST_STATE_PLAYING);
+            
+            GstBus* pBus = gst_pipeline_get_bus(GST_PIPELINE(pPipeline));
+            GstMessage* pMessage = gst_bus_timed_pop_filtered(pBus, 
+                10*GST_SECOND, (GstMessageType)(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+            REQUIRE( pMessage != NULL );
+            REQUIRE( GST_MESSAGE_TYPE(pMessage) == GST_MESSAGE_EOS );
+            gst_message_unref(pMessage);
+            gst_object_unref(pBus);
+            
+            THEN( "Every buffer is delivered and none are dropped" )
+            {
+                wait_for_delivery_queue_empty(pSinkBintr);
+                g_usleep(10000);
+                
+                pSinkBintr->GetDeliveryStats(&stats);
+                REQUIRE( stats.received == 30 );
+                REQUIRE( stats.dropped == 0 );
+                REQUIRE( stats.delivered == 30 );
+                REQUIRE( buffersDelivered == 30 );
+            }
+        }
+        gst_element_set_state(pPipeline, GST_STATE_NULL);
+        pSinkBintr->UnlinkAll();
+        gst_bin_remove(GST_BIN(pPipeline), pSinkBintr->GetGstElement());
+        gst_object_unref(pPipeline);
+    }
+}
+
 SCENARIO( "A new FrameCaptureSinkBintr is created correctly",  "[SinkBintr]" )
 {
     GIVEN( "Attributes for a new App Sink" ) 
@@ -114,6 +399,136 @@ SCENARIO( "A new FrameCaptureSinkBintr is created correctly",  "[SinkBintr]" )
     }
 }
 
+SCENARIO( "A new ShmSinkBintr is created correctly",  "[SinkBintr]" )
+{
+    GIVEN( "Attributes for a new Shared Memory Sink" ) 
+    {
+        std::string sinkName("shm-sink");
+        std::string shmName("/dsl-test-shm-sink");
+
+        WHEN( "The ShmSinkBintr is created" )
+        {
+            DSL_SHM_SINK_PTR pSinkBintr = DSL_SHM_SINK_NEW(sinkName.c_str(), 
+                shmName.c_str(), DSL_SINK_SHM_DATA_TYPE_FRAMES, "RGBA", 
+                320, 240, 4);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                REQUIRE( pSinkBintr->GetDataType() == DSL_SINK_APP_DATA_TYPE_BUFFER );
+                REQUIRE( std::string(pSinkBintr->GetShmName()) == shmName );
+                
+                dsl_shm_sink_stats stats{0};
+                pSinkBintr->GetStats(&stats);
+                REQUIRE( stats.num_slots == 4 );
+                REQUIRE( stats.readers == 0 );
+                REQUIRE( stats.slow_readers == 0 );
+                REQUIRE( stats.frames_written == 0 );
+                REQUIRE( stats.objects_dropped == 0 );
+                REQUIRE( stats.reader_skips == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new ShmSinkBintr can LinkAll and UnlinkAll Child Elementrs", 
+    "[SinkBintr]" )
+{
+    GIVEN( "Attributes for a new ShmSinkBintr" ) 
+    {
+        std::string sinkName("shm-sink");
+        std::string shmName("/dsl-test-shm-sink");
+
+        WHEN( "A new metadata-only ShmSinkBintr is Linked and Unlinked" )
+        {
+            DSL_SHM_SINK_PTR pSinkBintr = DSL_SHM_SINK_NEW(sinkName.c_str(), 
+                shmName.c_str(), DSL_SINK_SHM_DATA_TYPE_METADATA, "RGBA", 
+                320, 240, 4);
+            REQUIRE( pSinkBintr->IsLinked() == false );
+
+            REQUIRE( pSinkBintr->LinkAll() == true );
+            REQUIRE( pSinkBintr->IsLinked() == true );
+            pSinkBintr->UnlinkAll();
+
+            THEN( "The ShmSinkBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+        WHEN( "A new frames ShmSinkBintr is Linked and Unlinked" )
+        {
+            DSL_SHM_SINK_PTR pSinkBintr = DSL_SHM_SINK_NEW(sinkName.c_str(), 
+                shmName.c_str(), DSL_SINK_SHM_DATA_TYPE_FRAMES, "RGBA", 
+                320, 240, 4);
+            REQUIRE( pSinkBintr->IsLinked() == false );
+
+            REQUIRE( pSinkBintr->LinkAll() == true );
+            REQUIRE( pSinkBintr->IsLinked() == true );
+            pSinkBintr->UnlinkAll();
+
+            THEN( "The ShmSinkBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new MetaExportSinkBintr is created correctly",  "[SinkBintr]" )
+{
+    GIVEN( "Attributes for a new Metadata Export Sink" ) 
+    {
+        std::string sinkName("meta-export-sink");
+        std::string location("./meta-export-sink.bin");
+
+        WHEN( "The MetaExportSinkBintr is created" )
+        {
+            DSL_META_EXPORT_SINK_PTR pSinkBintr = DSL_META_EXPORT_SINK_NEW(
+                sinkName.c_str(), DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+                location.c_str(), 0, 16);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                REQUIRE( pSinkBintr->GetDataType() == DSL_SINK_APP_DATA_TYPE_BUFFER );
+                
+                dsl_meta_export_sink_stats stats{0};
+                pSinkBintr->GetStats(&stats);
+                REQUIRE( stats.queue_depth == 0 );
+                REQUIRE( stats.connects == 0 );
+                REQUIRE( stats.records_written == 0 );
+                REQUIRE( stats.records_dropped == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new MetaExportSinkBintr can LinkAll and UnlinkAll Child Elementrs", 
+    "[SinkBintr]" )
+{
+    GIVEN( "A new MetaExportSinkBintr in an Unlinked state" ) 
+    {
+        std::string sinkName("meta-export-sink");
+        std::string location("./meta-export-sink.bin");
+
+        DSL_META_EXPORT_SINK_PTR pSinkBintr = DSL_META_EXPORT_SINK_NEW(
+            sinkName.c_str(), DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+            location.c_str(), 0, 16);
+
+        REQUIRE( pSinkBintr->IsLinked() == false );
+
+        WHEN( "The MetaExportSinkBintr is Linked and Unlinked" )
+        {
+            REQUIRE( pSinkBintr->LinkAll() == true );
+            REQUIRE( pSinkBintr->IsLinked() == true );
+            pSinkBintr->UnlinkAll();
+
+            THEN( "The MetaExportSinkBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new FakeSinkBintr is created correctly",  "[SinkBintr]" )
 {
     GIVEN( "Attributes for a new Fake Sink" ) 
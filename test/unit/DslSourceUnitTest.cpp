@@ -26,7 +26,10 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslSinkBintr.h"
 #include "DslSourceBintr.h"
+#include "DslShmProducer.h"
+#include "DslMetaExportWriter.h"
 #include "DslPipelineSourcesBintr.h"
+#include "DslDeadlineScheduler.h"
 
 static std::string sourceName("test-source");
 static std::string uri("/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
@@ -150,6 +153,269 @@ SCENARIO( "A AppSourceBintr can UnlinkAll all child Elementrs correctly",  "[Sou
     }
 }
 
+SCENARIO( "An AppSourceBintr with a buffer-pool acquires and recycles buffers correctly",
+    "[SourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr with a buffer-pool size of 2" ) 
+    {
+        boolean isLive(true);
+
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(
+            sourceName.c_str(), isLive, "I420", width, height, fps_n, fps_d);
+
+        void* buffer(NULL);
+        void* data(NULL);
+        uint64_t size(0);
+
+        REQUIRE( pSourceBintr->GetBufferPoolSize() == 0 );
+        REQUIRE( pSourceBintr->SetBufferPoolSize(2) == true );
+        REQUIRE( pSourceBintr->GetBufferPoolSize() == 2 );
+        
+        // acquire must fail until the pool is created on LinkAll
+        REQUIRE( pSourceBintr->AcquireBuffer(&buffer, &data, &size) == false );
+
+        REQUIRE( pSourceBintr->LinkAll() == true );
+
+        // pool-size can't be updated while linked
+        REQUIRE( pSourceBintr->SetBufferPoolSize(4) == false );
+
+        WHEN( "All buffers are acquired from the pool" )
+        {
+            void* buffers[2] = {NULL};
+            
+            for (auto i = 0; i < 2; i++)
+            {
+                REQUIRE( pSourceBintr->AcquireBuffer(&buffers[i], 
+                    &data, &size) == true );
+                REQUIRE( buffers[i] != NULL );
+                REQUIRE( data != NULL );
+                
+                // one I420 frame per buffer
+                REQUIRE( size == width*height*3/2 );
+            }
+            THEN( "Further acquires return NULL until the buffers are released" )
+            {
+                REQUIRE( pSourceBintr->AcquireBuffer(&buffer, 
+                    &data, &size) == true );
+                REQUIRE( buffer == NULL );
+
+                // The appsrc is flushing until the Pipeline is playing, so the
+                // push fails and the buffers return to the pool.
+                REQUIRE( pSourceBintr->PushBuffers(buffers, 2) == false );
+                
+                REQUIRE( pSourceBintr->AcquireBuffer(&buffer, 
+                    &data, &size) == true );
+                REQUIRE( buffer != NULL );
+                REQUIRE( pSourceBintr->PushBuffers(&buffer, 1) == false );
+                
+                pSourceBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->AcquireBuffer(&buffer, 
+                    &data, &size) == false );
+            }
+        }
+    }
+}
+
+static void wrapped_buffer_release_cb(void* data, void* client_data)
+{
+    (*(uint*)client_data)++;
+}
+
+SCENARIO( "An AppSourceBintr calls the release callback for each wrapped buffer",
+    "[SourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr and a batch of client memory blocks" ) 
+    {
+        boolean isLive(true);
+
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(
+            sourceName.c_str(), isLive, "I420", width, height, fps_n, fps_d);
+
+        std::vector<uint8_t> frames[3];
+        dsl_source_app_wrapped_buffer buffers[3];
+        uint releaseCount(0);
+        
+        for (auto i = 0; i < 3; i++)
+        {
+            frames[i].resize(width*height*3/2);
+            buffers[i] = {frames[i].data(), frames[i].size(), &releaseCount};
+        }
+
+        WHEN( "The batch is pushed while the AppSourceBintr is unlinked" )
+        {
+            REQUIRE( pSourceBintr->PushWrappedBuffers(buffers, 3, 
+                wrapped_buffer_release_cb) == false );
+            
+            THEN( "The memory remains with the client" )
+            {
+                REQUIRE( releaseCount == 0 );
+            }
+        }
+        WHEN( "The batch is pushed while the AppSourceBintr is linked" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+
+            // empty and invalid batches must fail
+            REQUIRE( pSourceBintr->PushWrappedBuffers(buffers, 0, 
+                wrapped_buffer_release_cb) == false );
+            buffers[1].size = 0;
+            REQUIRE( pSourceBintr->PushWrappedBuffers(buffers, 3, 
+                wrapped_buffer_release_cb) == false );
+            REQUIRE( releaseCount == 0 );
+            buffers[1].size = frames[1].size();
+            
+            // The appsrc is flushing until the Pipeline is playing, so the
+            // push fails and the wrapped memory is released immediately.
+            pSourceBintr->PushWrappedBuffers(buffers, 3, 
+                wrapped_buffer_release_cb);
+            
+            THEN( "The release callback is called once for each block" )
+            {
+                REQUIRE( releaseCount == 3 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ShmSourceBintr receives and releases producer frames correctly",
+    "[SourceBintr]" )
+{
+    GIVEN( "A new ShmSourceBintr in memory" ) 
+    {
+        std::string shmName("/dsl-test-shm-source");
+        uint numSlots(4);
+        
+        DSL_SHM_SOURCE_PTR pSourceBintr = DSL_SHM_SOURCE_NEW(
+            sourceName.c_str(), shmName.c_str(), "I420", 
+            width, height, fps_n, fps_d, numSlots);
+            
+        REQUIRE( std::string(pSourceBintr->GetShmName()) == shmName );
+        
+        dsl_shm_source_stats stats{0};
+        pSourceBintr->GetStats(&stats);
+        REQUIRE( stats.num_slots == numSlots );
+        REQUIRE( stats.producer_attached == false );
+
+        WHEN( "A producer commits a frame while the ShmSourceBintr is linked" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+
+            dsl_shm_producer* pProducer(NULL);
+            REQUIRE( dsl_shm_producer_open(shmName.c_str(), 
+                &pProducer) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            
+            void* data(NULL);
+            uint64_t size(0);
+            REQUIRE( dsl_shm_producer_frame_acquire(pProducer, 100,
+                &data, &size) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            REQUIRE( size == width*height*3/2 );
+            REQUIRE( dsl_shm_producer_frame_commit(pProducer, size, 
+                DSL_SHM_RING_TIMESTAMP_NONE) == DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            
+            // The appsrc is flushing until the Pipeline is playing, so the
+            // frame's buffer is released, and its slot freed, on push.
+            for (auto i = 0; i < 50; i++)
+            {
+                pSourceBintr->GetStats(&stats);
+                if (stats.frames_received and !stats.occupied)
+                {
+                    break;
+                }
+                g_usleep(10000);
+            }
+            pSourceBintr->UnlinkAll();
+            
+            THEN( "The frame is received and its slot returned to the producer" )
+            {
+                REQUIRE( stats.producer_attached == true );
+                REQUIRE( stats.frames_received == 1 );
+                REQUIRE( stats.occupied == 0 );
+                REQUIRE( stats.peak_occupied == 1 );
+                
+                pSourceBintr->ClearStats();
+                pSourceBintr->GetStats(&stats);
+                REQUIRE( stats.frames_received == 0 );
+                REQUIRE( stats.peak_occupied == 0 );
+                
+                REQUIRE( dsl_shm_producer_close(pProducer) == 
+                    DSL_SHM_PRODUCER_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+static void write_meta_replay_stream(const char* path, uint numRecords)
+{
+    DSL_META_EXPORT_WRITER_PTR pWriter = DSL_META_EXPORT_WRITER_NEW(
+        "meta-export-writer", DSL_SINK_META_EXPORT_TRANSPORT_FILE, 
+        path, 0, numRecords);
+        
+    for (uint i = 0; i < numRecords; i++)
+    {
+        std::vector<uint8_t> record(sizeof(dsl_meta_export_batch) 
+            + sizeof(dsl_meta_export_frame));
+        dsl_meta_export_batch batch{(uint32_t)record.size(), 
+            DSL_META_EXPORT_RECORD_TYPE_BATCH, 1, i*GST_SECOND/30};
+        dsl_meta_export_frame frame{0};
+        frame.frame_num = i;
+        memcpy(&record[0], &batch, sizeof(batch));
+        memcpy(&record[sizeof(batch)], &frame, sizeof(frame));
+        pWriter->QueueRecord(record);
+    }
+    // all queued records are written before the writer is destroyed.
+}
+
+SCENARIO( "A new MetaReplaySourceBintr is created correctly", "[SourceBintr]" )
+{
+    GIVEN( "A metadata stream recorded to file" ) 
+    {
+        std::string replayFilePath("./meta-replay-source-test.bin");
+        write_meta_replay_stream(replayFilePath.c_str(), 8);
+
+        WHEN( "A new MetaReplaySourceBintr is created for the stream" )
+        {
+            DSL_META_REPLAY_SOURCE_PTR pSourceBintr = DSL_META_REPLAY_SOURCE_NEW(
+                sourceName.c_str(), replayFilePath.c_str(), 1.0, 
+                DSL_SOURCE_META_REPLAY_SURFACE_TEST_PATTERN, width, height);
+
+            THEN( "All memeber variables are initialized correctly" )
+            {
+                REQUIRE( std::string(pSourceBintr->GetFilePath()) 
+                    == replayFilePath );
+                REQUIRE( pSourceBintr->IsLive() == false );
+                
+                dsl_meta_replay_source_stats stats{0};
+                pSourceBintr->GetStats(&stats);
+                REQUIRE( stats.batches_replayed == 0 );
+                REQUIRE( stats.bytes_read == 0 );
+
+                // Nothing is replayed until the appsrc requests data.
+                REQUIRE( pSourceBintr->LinkAll() == true );
+                REQUIRE( pSourceBintr->LinkAll() == false );
+                pSourceBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->LinkAll() == true );
+                pSourceBintr->UnlinkAll();
+                
+                pSourceBintr->GetStats(&stats);
+                REQUIRE( stats.batches_replayed == 0 );
+                
+                remove(replayFilePath.c_str());
+            }
+        }
+        WHEN( "A new MetaReplaySourceBintr is created for an invalid stream" )
+        {
+            THEN( "The MetaReplaySourceBintr throws an exception" )
+            {
+                REQUIRE_THROWS( DSL_META_REPLAY_SOURCE_NEW(sourceName.c_str(), 
+                    filePath.c_str(), 1.0, DSL_SOURCE_META_REPLAY_SURFACE_NONE, 
+                    0, 0) );
+                    
+                remove(replayFilePath.c_str());
+            }
+        }
+    }
+}
+
 SCENARIO( "A new CsiSourceBintr is created correctly",  "[SourceBintr]" )
 {
     if (dsl_info_gpu_type_get(0) == DSL_GPU_TYPE_INTEGRATED)
@@ -858,8 +1124,12 @@ SCENARIO( "An RtspSourceBintr calls all State Change Listeners on change of stat
             {
                 REQUIRE( pRtspSourceBintr->GetCurrentState() == GST_STATE_READY );
                 
-                // simulate timer callback
-                REQUIRE( pRtspSourceBintr->NotifyClientListeners() == FALSE );
+                // Listeners are called on the Callback Dispatcher's worker 
+                // threads - allow up to 1 second for both to be notified.
+                for (uint i=0; i<100 and (userData1 != 111 or userData2 != 222); i++)
+                {
+                    g_usleep(10000);
+                }
                 // Callbacks will change user data if called
                 REQUIRE( userData1 == 111 );
                 REQUIRE( userData2 == 222 );
@@ -923,9 +1193,8 @@ SCENARIO( "An RtspSourceBintr's Stream Management callback behaves correctly", "
             data.retries = 0;
             pRtspSourceBintr->_setConnectionData(data);
             // get the current time and update the Source buffer timestamp
-            timeval currentTime{0};
-            gettimeofday(&currentTime, NULL);
-            pRtspSourceBintr->_getTimestampPph()->SetTime(currentTime);
+            pRtspSourceBintr->_getTimestampPph()->SetTimestamp(
+                DeadlineScheduler::Now());
 
             THEN( "The Stream Management callback returns true immediately" )
             {
@@ -941,19 +1210,14 @@ SCENARIO( "An RtspSourceBintr's Stream Management callback behaves correctly", "
             pRtspSourceBintr->_setConnectionData(data);
             pRtspSourceBintr->SetCurrentState(GST_STATE_PLAYING);
             // get the current time and update the Source buffer timestamp
-            timeval currentTime{0};
-            gettimeofday(&currentTime, NULL);
-            currentTime.tv_sec -= timeout;
-            pRtspSourceBintr->_getTimestampPph()->SetTime(currentTime);
+            pRtspSourceBintr->_getTimestampPph()->SetTimestamp(
+                DeadlineScheduler::Now() - (uint64_t)timeout*1000000000);
 
             THEN( "The Stream Management callback Initiates a Reconnect Cycle" )
             {
                 // Note: this test requires (currently) additional manual/visual confirmation of console log output
                 REQUIRE( pRtspSourceBintr->StreamManager() == true );
 
-                // simulate timer callback
-                REQUIRE( pRtspSourceBintr->NotifyClientListeners() == FALSE );
-
                 // simulate a reconnection timer - 
                 REQUIRE( pRtspSourceBintr->ReconnectionManager() == true );
             }
@@ -0,0 +1,170 @@
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslWorkStealingPool.h"
+
+using namespace DSL;
+
+SCENARIO( "A new WorkStealingPool is created correctly", "[WorkStealingPool]" )
+{
+    GIVEN( "Attributes for a new WorkStealingPool" ) 
+    {
+        uint numWorkers(3);
+
+        WHEN( "A new WorkStealingPool is created" )
+        {
+            DSL_WORK_STEALING_POOL_PTR pPool = 
+                DSL_WORK_STEALING_POOL_NEW(numWorkers);
+
+            THEN( "The WorkStealingPool's memebers are setup and returned correctly" )
+            {
+                REQUIRE( pPool->GetNumWorkers() == numWorkers );
+                REQUIRE( pPool->GetStealCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A WorkStealingPool runs all tasks to completion", "[WorkStealingPool]" )
+{
+    GIVEN( "A new WorkStealingPool and a set of tasks" ) 
+    {
+        DSL_WORK_STEALING_POOL_PTR pPool = DSL_WORK_STEALING_POOL_NEW(4);
+        
+        std::vector<uint> results(64, 0);
+        std::vector<WorkStealingPool::Task> tasks;
+        
+        for (uint i = 0; i < results.size(); i++)
+        {
+            tasks.push_back([&results, i](){ results[i] = i*2; });
+        }
+
+        WHEN( "The tasks are run" )
+        {
+            pPool->Run(tasks);
+
+            THEN( "Every task has been executed exactly once" )
+            {
+                for (uint i = 0; i < results.size(); i++)
+                {
+                    REQUIRE( results[i] == i*2 );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A WorkStealingPool can be run repeatedly", "[WorkStealingPool]" )
+{
+    GIVEN( "A new WorkStealingPool and a counter" ) 
+    {
+        DSL_WORK_STEALING_POOL_PTR pPool = DSL_WORK_STEALING_POOL_NEW(2);
+        
+        std::atomic<uint> counter(0);
+
+        WHEN( "The pool is run many times with a small set of tasks" )
+        {
+            for (uint i = 0; i < 100; i++)
+            {
+                std::vector<WorkStealingPool::Task> tasks;
+                for (uint j = 0; j < 5; j++)
+                {
+                    tasks.push_back([&counter](){ counter++; });
+                }
+                pPool->Run(tasks);
+                
+                // Run must not return until all tasks are complete.
+                REQUIRE( counter == (i+1)*5 );
+            }
+            THEN( "The final count is correct" )
+            {
+                REQUIRE( counter == 500 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A WorkStealingPool with no workers runs all tasks on the calling thread", 
+    "[WorkStealingPool]" )
+{
+    GIVEN( "A new WorkStealingPool with no workers" ) 
+    {
+        DSL_WORK_STEALING_POOL_PTR pPool = DSL_WORK_STEALING_POOL_NEW(0);
+        
+        GThread* pCallingThread = g_thread_self();
+        bool allOnCallingThread(true);
+        
+        std::vector<WorkStealingPool::Task> tasks;
+        for (uint i = 0; i < 10; i++)
+        {
+            tasks.push_back([&]()
+            {
+                if (g_thread_self() != pCallingThread)
+                {
+                    allOnCallingThread = false;
+                }
+            });
+        }
+
+        WHEN( "The tasks are run" )
+        {
+            pPool->Run(tasks);
+
+            THEN( "All tasks were executed by the calling thread" )
+            {
+                REQUIRE( allOnCallingThread == true );
+                REQUIRE( pPool->GetStealCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A WorkStealingPool continues after a task throws an exception", 
+    "[WorkStealingPool]" )
+{
+    GIVEN( "A new WorkStealingPool and a task that throws" ) 
+    {
+        DSL_WORK_STEALING_POOL_PTR pPool = DSL_WORK_STEALING_POOL_NEW(2);
+        
+        std::atomic<uint> counter(0);
+        std::vector<WorkStealingPool::Task> tasks;
+        
+        tasks.push_back([](){ throw std::exception(); });
+        for (uint i = 0; i < 10; i++)
+        {
+            tasks.push_back([&counter](){ counter++; });
+        }
+
+        WHEN( "The tasks are run" )
+        {
+            pPool->Run(tasks);
+
+            THEN( "All other tasks are executed" )
+            {
+                REQUIRE( counter == 10 );
+            }
+        }
+    }
+}